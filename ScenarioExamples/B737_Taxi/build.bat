@@ -12,8 +12,25 @@ g++ -std=c++17 -I../../src -I../../src/I_ThirdPartyTools -o EventDrivenSimulatio
 ../../src/E_GlobalSharedDataSpace/GlobalSharedDataSpace.cpp ^
 ../../src/E_GlobalSharedDataSpace/GlobalSharedDataStruct.cpp ^
 ../../src/G_SimulationManager/LogAndData/DataRecorder.cpp ^
+../../src/G_SimulationManager/LogAndData/TimeSeriesCodec.cpp ^
+../../src/G_SimulationManager/LogAndData/TimeIndex.cpp ^
+../../src/G_SimulationManager/LogAndData/TelemetryRing.cpp ^
+../../src/G_SimulationManager/LogAndData/TelemetryPublisher.cpp ^
+../../src/G_SimulationManager/LogAndData/StreamingStatistics.cpp ^
+../../src/G_SimulationManager/LogAndData/MonteCarloAggregator.cpp ^
 ../../src/G_SimulationManager/A_TimeSYNC/Simulation_Clock.cpp ^
 ../../src/G_SimulationManager/B_SimManage/EventMonitor.cpp ^
+../../src/G_SimulationManager/B_SimManage/TerminationMonitor.cpp ^
+../../src/G_SimulationManager/B_SimManage/DataPack.cpp ^
+../../src/G_SimulationManager/B_SimManage/AllocationTracker.cpp ^
+../../src/G_SimulationManager/B_SimManage/ThreadPlacement.cpp ^
+../../src/G_SimulationManager/B_SimManage/PerfCounterProfiler.cpp ^
+../../src/G_SimulationManager/B_SimManage/InstrumentedMutex.cpp ^
+../../src/G_SimulationManager/B_SimManage/SimulationMetrics.cpp ^
+../../src/G_SimulationManager/B_SimManage/MetricsServer.cpp ^
+../../src/E_GlobalSharedDataSpace/StateTransport.cpp ^
+../../src/G_SimulationManager/A_TimeSYNC/TransportStepRelay.cpp ^
+../../src/G_SimulationManager/LogAndData/CsvExport.cpp ^
 ../../src/G_SimulationManager/C_ConfigManager/ConfigManager.cpp ^
 ../../src/F_ScenarioModelling/A_FlightPlanParser/FlightPlanParser.cpp ^
 ../../src/A_PilotAgentModel/PilotAgent.cpp ^
@@ -34,7 +51,11 @@ g++ -std=c++17 -I../../src -I../../src/I_ThirdPartyTools -o EventDrivenSimulatio
 ../../src/D_ATCAgentModel/ATC_002/ATC_002_Strategy.cpp ^
 ../../src/E_FlightDynamics/FlightDynamicsAgent.cpp ^
 ../../src/E_FlightDynamics/B737/B737_FlightDynamicsModel_New.cpp ^
--lpthread
+../../src/E_FlightDynamics/LandingGear.cpp ^
+../../src/E_FlightDynamics/LocalTangentFrame.cpp ^
+../../src/E_FlightDynamics/TrimSolver.cpp ^
+../../src/E_FlightDynamics/LinearModel.cpp ^
+-lpthread -lws2_32
 
 if %ERRORLEVEL% EQU 0 (
     echo.
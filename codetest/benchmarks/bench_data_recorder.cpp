@@ -0,0 +1,72 @@
+/**
+ * @file bench_data_recorder.cpp
+ * @brief 数据记录器基准：每步记录全部模块，以及仿真结束时的文件输出
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <string>
+
+#include "../../src/E_GlobalSharedDataSpace/GlobalSharedDataSpace.hpp"
+#include "../../src/G_SimulationManager/LogAndData/DataRecorder.hpp"
+
+using VFT_SMF::GlobalShared_DataSpace::GlobalSharedDataSpace;
+
+namespace {
+
+    std::string benchmarkOutputDirectory(const std::string& name) {
+        return (std::filesystem::temp_directory_path() / ("vft_bench_" + name)).string();
+    }
+
+} // namespace
+
+/**
+ * @brief 每步 recordAllData 开销（缓冲区足够大，不触发淘汰）
+ */
+static void BM_RecordAllData(benchmark::State& state) {
+    GlobalSharedDataSpace space;
+    VFT_SMF::DataRecorder recorder(benchmarkOutputDirectory("record"), 1 << 30);
+    recorder.initialize();
+
+    double t = 0.0;
+    for (auto _ : state) {
+        recorder.recordAllData(t, &space);
+        t += 0.01;
+    }
+    recorder.clearAllBuffers();
+}
+BENCHMARK(BM_RecordAllData);
+
+/**
+ * @brief 输出N步缓冲数据到文件（参数：步数，输出格式 0=CSV 1=压缩 2=两者）
+ */
+static void BM_FlushAllBuffers(benchmark::State& state) {
+    const int steps = static_cast<int>(state.range(0));
+    const auto format = static_cast<VFT_SMF::RecordFormat>(state.range(1));
+    const std::string directory = benchmarkOutputDirectory("flush");
+
+    GlobalSharedDataSpace space;
+    VFT_SMF::DataRecorder recorder(directory, steps + 1);
+    recorder.setRecordFormat(format);
+    recorder.initialize();
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        recorder.clearAllBuffers();
+        for (int i = 0; i < steps; ++i) {
+            recorder.recordAllData(i * 0.01, &space);
+        }
+        state.ResumeTiming();
+        recorder.flushAllBuffers();
+    }
+    state.counters["steps_per_second"] = benchmark::Counter(static_cast<double>(steps) * state.iterations(),
+                                                            benchmark::Counter::kIsRate);
+
+    recorder.clearAllBuffers();
+}
+BENCHMARK(BM_FlushAllBuffers)
+    ->ArgsProduct({{1000, 6000}, {0, 1, 2}})
+    ->ArgNames({"steps", "format"})
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,58 @@
+/**
+ * @file bench_event_monitor.cpp
+ * @brief 事件监测器基准：每步检查N个计划事件的触发条件
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+
+#include "../../src/G_SimulationManager/B_SimManage/EventMonitor.hpp"
+#include "../../src/E_GlobalSharedDataSpace/GlobalSharedDataSpace.hpp"
+
+using VFT_SMF::GlobalShared_DataSpace::GlobalSharedDataSpace;
+namespace Data = VFT_SMF::GlobalSharedDataStruct;
+
+namespace {
+
+    // 与飞行计划中常见的条件形式保持一致；阈值设置为不可达，保证每步都完整评估全部事件
+    const char* const CONDITIONS[] = {
+        "speed > 1000.0",
+        "distance > 1000000.0 || atc_brake_command_received",
+        "time > 100000.0",
+        "taxi_clearance_received",
+    };
+
+    std::shared_ptr<GlobalSharedDataSpace> spaceWithPlannedEvents(int event_count) {
+        auto space = std::make_shared<GlobalSharedDataSpace>();
+        Data::PlannedEventLibrary library;
+        for (int i = 0; i < event_count; ++i) {
+            Data::TriggerCondition condition(CONDITIONS[i % 4], "benchmark");
+            Data::DrivenProcess process("Pilot", "benchmark_controller", "benchmark", "maintain");
+            library.planned_events_list.emplace_back(i + 1, "event_" + std::to_string(i), "benchmark event",
+                                                     condition, process, "benchmark");
+        }
+        space->setPlannedEventLibrary(library);
+        return space;
+    }
+
+} // namespace
+
+static void BM_MonitorEvents(benchmark::State& state) {
+    const int event_count = static_cast<int>(state.range(0));
+    auto space = spaceWithPlannedEvents(event_count);
+    VFT_SMF::EventMonitor monitor(space);
+    monitor.initialize();
+
+    double t = 0.0;
+    for (auto _ : state) {
+        auto triggered = monitor.monitorEvents(t);
+        benchmark::DoNotOptimize(triggered);
+        t += 0.01;
+    }
+    state.SetComplexityN(event_count);
+    state.counters["events"] = event_count;
+}
+BENCHMARK(BM_MonitorEvents)->RangeMultiplier(4)->Range(4, 1024)->Complexity();
@@ -0,0 +1,113 @@
+/**
+ * @file bench_flight_dynamics.cpp
+ * @brief 飞行动力学代理单步更新基准
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "../../src/E_FlightDynamics/FlightDynamicsAgent.hpp"
+#include "../../src/E_FlightDynamics/FlightDynamicsPipeline.hpp"
+#include "../../src/E_FlightDynamics/B737/B737_FlightDynamicsModel_New.hpp"
+
+namespace Data = VFT_SMF::GlobalSharedDataStruct;
+
+namespace {
+
+    // 与B737_Taxi场景初始条件相近的地面滑行状态
+    Data::AircraftFlightState taxiInitialState() {
+        Data::AircraftFlightState state;
+        state.latitude = 39.9083;
+        state.longitude = 116.3975;
+        state.heading = 0.0;
+        state.landing_gear_deployed = true;
+        return state;
+    }
+
+    Data::AircraftSystemState taxiSystemState() {
+        Data::AircraftSystemState system_state;
+        system_state.current_mass = 70000.0;
+        system_state.current_fuel = 10000.0;
+        system_state.current_landing_gear_deployed = 1.0;
+        system_state.current_throttle_position = 0.3;
+        system_state.current_engine_rpm = 2500.0;
+        system_state.left_engine_rpm = 2500.0;
+        system_state.right_engine_rpm = 2500.0;
+        return system_state;
+    }
+
+} // namespace
+
+/**
+ * @brief 代理内部状态推进一步（不读取全局状态）
+ */
+static void BM_FlightDynamicsUpdate(benchmark::State& state) {
+    VFT_SMF::FlightDynamics::FlightDynamicsAgent agent("B737");
+    agent.initialize(taxiInitialState());
+    for (auto _ : state) {
+        auto next = agent.update(0.01);
+        benchmark::DoNotOptimize(next);
+    }
+}
+BENCHMARK(BM_FlightDynamicsUpdate);
+
+/**
+ * @brief 仿真线程实际调用路径：由全局系统/环境状态驱动推进一步
+ */
+static void BM_FlightDynamicsUpdateFromGlobalState(benchmark::State& state) {
+    VFT_SMF::FlightDynamics::FlightDynamicsAgent agent("B737");
+    agent.initialize(taxiInitialState());
+    const Data::AircraftSystemState system_state = taxiSystemState();
+    const Data::EnvironmentGlobalState env_state;
+    for (auto _ : state) {
+        auto next = agent.updateFromGlobalState(0.01, system_state, env_state);
+        benchmark::DoNotOptimize(next);
+    }
+}
+BENCHMARK(BM_FlightDynamicsUpdateFromGlobalState);
+
+/**
+ * @brief 水平位置积分方式对比：0 球面经纬度，1 切平面（步内只发布切平面位置），2 切平面且读端每步换算经纬度
+ */
+static void BM_FlightDynamicsPositionIntegration(benchmark::State& state) {
+    using VFT_SMF::FlightDynamics::PositionIntegration;
+    VFT_SMF::FlightDynamics::FlightDynamicsAgent agent("B737");
+    agent.setPositionIntegration(state.range(0) == 0 ? PositionIntegration::Spherical : PositionIntegration::LocalTangent,
+                                 20000.0);
+    agent.initialize(taxiInitialState());
+    VFT_SMF::FlightDynamics::GeodeticResolver resolver;
+    for (auto _ : state) {
+        auto next = agent.update(0.01);
+        if (state.range(0) == 2) {
+            resolver.resolve(next);
+        }
+        benchmark::DoNotOptimize(next);
+    }
+}
+BENCHMARK(BM_FlightDynamicsPositionIntegration)->Arg(0)->Arg(1)->Arg(2);
+
+/**
+ * @brief 编译期特化流水线直接推进（不经代理的类型擦除与锁）：0 加速度扰动，1 无扰动
+ */
+static void BM_FlightDynamicsPipelineStep(benchmark::State& state) {
+    using namespace VFT_SMF::FlightDynamics;
+    Data::AircraftFlightState flight_state = taxiInitialState();
+    const Data::AircraftSystemState system_state = taxiSystemState();
+    const Data::EnvironmentGlobalState env_state;
+    PipelineStep result;
+    if (state.range(0) == 0) {
+        FlightDynamicsPipeline<B737FlightDynamicsModel> pipeline("B737");
+        for (auto _ : state) {
+            pipeline.stepWithInput(flight_state, 0.01, system_state, env_state, result);
+            benchmark::DoNotOptimize(result);
+        }
+    } else {
+        FlightDynamicsPipeline<B737FlightDynamicsModel, SemiImplicitEulerIntegrator, NoAccelerationNoise> pipeline("B737");
+        for (auto _ : state) {
+            pipeline.stepWithInput(flight_state, 0.01, system_state, env_state, result);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+}
+BENCHMARK(BM_FlightDynamicsPipelineStep)->Arg(0)->Arg(1);
@@ -0,0 +1,100 @@
+/**
+ * @file bench_logger.cpp
+ * @brief 日志基准：调用方一侧的开销（关闭时的过滤、延迟格式化的参数拷贝、原字符串拼接）
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "../../src/G_SimulationManager/LogAndData/Logger.hpp"
+
+namespace {
+
+    /**
+     * @brief 基准期间替换全局日志实例（写到临时目录，不输出控制台）
+     */
+    class ScopedGlobalLogger {
+    public:
+        explicit ScopedGlobalLogger(bool enabled) {
+            previous.swap(VFT_SMF::globalLogger);
+            if (enabled) {
+                const auto directory = std::filesystem::temp_directory_path() / "vft_bench_logger";
+                std::filesystem::create_directories(directory);
+                VFT_SMF::initializeGlobalLogger((directory / "brief.log").string(), (directory / "detail.log").string(), false);
+            }
+        }
+        ~ScopedGlobalLogger() {
+            VFT_SMF::globalLogger.reset();
+            VFT_SMF::globalLogger.swap(previous);
+        }
+
+    private:
+        std::unique_ptr<VFT_SMF::Logger> previous;
+    };
+
+    const std::string benchmark_source = "flight_dynamics";
+
+} // namespace
+
+/**
+ * @brief 日志系统未启用（enable_logging=false）时的 VFT_LOG_DETAIL
+ */
+static void BM_LogDisabled(benchmark::State& state) {
+    ScopedGlobalLogger scoped(false);
+    double t = 0.0;
+    for (auto _ : state) {
+        VFT_LOG_DETAIL("飞行员代理 [{}] 更新 - 注意力: {}, 技能: {}", benchmark_source, t, t * 2.0);
+        t += 0.01;
+        benchmark::DoNotOptimize(t);
+    }
+}
+BENCHMARK(BM_LogDisabled);
+
+/**
+ * @brief 日志系统未启用时的原接口（参数字符串在检查前已拼接）
+ */
+static void BM_LogDisabledLegacy(benchmark::State& state) {
+    ScopedGlobalLogger scoped(false);
+    double t = 0.0;
+    for (auto _ : state) {
+        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "飞行员代理 [" + benchmark_source + "] 更新 - 注意力: " +
+                           std::to_string(t) + ", 技能: " + std::to_string(t * 2.0));
+        t += 0.01;
+    }
+}
+BENCHMARK(BM_LogDisabledLegacy);
+
+/**
+ * @brief 日志启用时 VFT_LOG_BRIEF 的调用方开销（参数拷贝入记录环，格式化在写线程）
+ */
+static void BM_LogDeferred(benchmark::State& state) {
+    ScopedGlobalLogger scoped(true);
+    VFT_SMF::globalLogger->setConsoleOutput(false);
+    double t = 0.0;
+    for (auto _ : state) {
+        VFT_LOG_BRIEF("飞行器飞行状态已存储到共享数据空间，数据来源: {}, 仿真时间: {}", benchmark_source, t);
+        t += 0.01;
+    }
+    VFT_SMF::globalLogger->flush();
+}
+BENCHMARK(BM_LogDeferred);
+
+/**
+ * @brief 日志启用时原接口的调用方开销（调用线程拼接字符串）
+ */
+static void BM_LogLegacy(benchmark::State& state) {
+    ScopedGlobalLogger scoped(true);
+    VFT_SMF::globalLogger->setConsoleOutput(false);
+    double t = 0.0;
+    for (auto _ : state) {
+        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "飞行器飞行状态已存储到共享数据空间，数据来源: " + benchmark_source +
+                          ", 仿真时间: " + std::to_string(t));
+        t += 0.01;
+    }
+    VFT_SMF::globalLogger->flush();
+}
+BENCHMARK(BM_LogLegacy);
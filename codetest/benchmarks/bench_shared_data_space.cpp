@@ -0,0 +1,156 @@
+/**
+ * @file bench_shared_data_space.cpp
+ * @brief 全局共享数据空间各模块读写基准
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+
+#include "../../src/E_GlobalSharedDataSpace/GlobalSharedDataSpace.hpp"
+#include "../../src/G_SimulationManager/B_SimManage/StepArena.hpp"
+
+using VFT_SMF::GlobalShared_DataSpace::GlobalSharedDataSpace;
+namespace Data = VFT_SMF::GlobalSharedDataStruct;
+
+static void BM_SetAircraftFlightState(benchmark::State& state) {
+    GlobalSharedDataSpace space;
+    Data::AircraftFlightState flight_state;
+    const auto source = Data::DataSourceRegistry::intern("benchmark");
+    for (auto _ : state) {
+        flight_state.latitude += 1e-7;
+        space.setAircraftFlightState(flight_state, source);
+    }
+}
+BENCHMARK(BM_SetAircraftFlightState);
+
+static void BM_SetAircraftFlightStateByName(benchmark::State& state) {
+    GlobalSharedDataSpace space;
+    Data::AircraftFlightState flight_state;
+    const std::string source = "benchmark";
+    for (auto _ : state) {
+        flight_state.latitude += 1e-7;
+        space.setAircraftFlightState(flight_state, source);
+    }
+}
+BENCHMARK(BM_SetAircraftFlightStateByName);
+
+static void BM_GetAircraftFlightState(benchmark::State& state) {
+    GlobalSharedDataSpace space;
+    space.setAircraftFlightState(Data::AircraftFlightState());
+    for (auto _ : state) {
+        Data::AircraftFlightState copy = space.getAircraftFlightState();
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_GetAircraftFlightState);
+
+static void BM_SetAircraftSystemState(benchmark::State& state) {
+    GlobalSharedDataSpace space;
+    Data::AircraftSystemState system_state;
+    const auto source = Data::DataSourceRegistry::intern("benchmark");
+    for (auto _ : state) {
+        system_state.current_throttle_position += 1e-6;
+        space.setAircraftSystemState(system_state, source);
+    }
+}
+BENCHMARK(BM_SetAircraftSystemState);
+
+static void BM_GetAircraftSystemState(benchmark::State& state) {
+    GlobalSharedDataSpace space;
+    for (auto _ : state) {
+        Data::AircraftSystemState copy = space.getAircraftSystemState();
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_GetAircraftSystemState);
+
+static void BM_SetPilotState(benchmark::State& state) {
+    GlobalSharedDataSpace space;
+    Data::PilotGlobalState pilot_state;
+    const auto source = Data::DataSourceRegistry::intern("benchmark");
+    for (auto _ : state) {
+        space.setPilotState(pilot_state, source);
+    }
+}
+BENCHMARK(BM_SetPilotState);
+
+static void BM_SetEnvironmentState(benchmark::State& state) {
+    GlobalSharedDataSpace space;
+    Data::EnvironmentGlobalState env_state;
+    const auto source = Data::DataSourceRegistry::intern("benchmark");
+    for (auto _ : state) {
+        space.setEnvironmentState(env_state, source);
+    }
+}
+BENCHMARK(BM_SetEnvironmentState);
+
+static void BM_SetAircraftNetForce(benchmark::State& state) {
+    GlobalSharedDataSpace space;
+    Data::AircraftNetForce net_force;
+    const auto source = Data::DataSourceRegistry::intern("benchmark");
+    for (auto _ : state) {
+        net_force.thrust_force += 1.0;
+        space.setAircraftNetForce(net_force, source);
+    }
+}
+BENCHMARK(BM_SetAircraftNetForce);
+
+static void BM_GetAircraftNetForce(benchmark::State& state) {
+    GlobalSharedDataSpace space;
+    for (auto _ : state) {
+        Data::AircraftNetForce copy = space.getAircraftNetForce();
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_GetAircraftNetForce);
+
+static void BM_SetATCCommand(benchmark::State& state) {
+    GlobalSharedDataSpace space;
+    Data::ATC_Command command;
+    for (auto _ : state) {
+        space.setATCCommand(command, "benchmark");
+    }
+}
+BENCHMARK(BM_SetATCCommand);
+
+static void BM_GetPlannedEventLibrary(benchmark::State& state) {
+    GlobalSharedDataSpace space;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(&space.getPlannedEventLibrary());
+    }
+}
+BENCHMARK(BM_GetPlannedEventLibrary);
+
+static Data::TriggeredEventLibrary makeStepEventLibrary() {
+    Data::TriggeredEventLibrary library;
+    for (int i = 0; i < 4; ++i) {
+        Data::StandardEvent event;
+        event.event_id = i;
+        event.event_name = "benchmark_event_" + std::to_string(i);
+        event.is_triggered = true;
+        library.addEventToStep(1.0, event);
+    }
+    return library;
+}
+
+static void BM_EventsAtStepHeap(benchmark::State& state) {
+    const Data::TriggeredEventLibrary library = makeStepEventLibrary();
+    for (auto _ : state) {
+        auto events = library.getEventsAtStep(1.0);
+        benchmark::DoNotOptimize(events.data());
+    }
+}
+BENCHMARK(BM_EventsAtStepHeap);
+
+static void BM_EventsAtStepArena(benchmark::State& state) {
+    const Data::TriggeredEventLibrary library = makeStepEventLibrary();
+    uint64_t step = 0;
+    for (auto _ : state) {
+        VFT_SMF::SimManage::StepArena::beginStep(++step);
+        auto events = library.getEventsAtStep(1.0, VFT_SMF::SimManage::StepArena::resource());
+        benchmark::DoNotOptimize(events.data());
+    }
+}
+BENCHMARK(BM_EventsAtStepArena);
@@ -0,0 +1,109 @@
+/**
+ * @file bench_simulation_clock.cpp
+ * @brief 仿真时钟步进基准：时钟推进一步并等待N个已注册线程完成
+ * @details 工作线程复现代理线程的同步协议（等待step_ready沿 → RUNNING → COMPLETED → 等待复位），
+ *          不做任何计算，测得的是每步纯同步开销。第二个参数为工作线程的轮询间隔（微秒），
+ *          0 表示让出CPU忙等，150 与代理线程实际使用的轮询间隔一致。
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../src/G_SimulationManager/A_TimeSYNC/Simulation_Clock.hpp"
+#include "../../src/E_GlobalSharedDataSpace/GlobalSharedDataSpace.hpp"
+
+using VFT_SMF::GlobalShared_DataSpace::GlobalSharedDataSpace;
+using VFT_SMF::GlobalSharedDataStruct::ThreadSyncState;
+
+namespace {
+
+    void pollWait(int poll_us) {
+        if (poll_us > 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(poll_us));
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    void agentLoop(const std::shared_ptr<GlobalSharedDataSpace>& space, const std::string& thread_id, int poll_us) {
+        uint64_t last_step = std::numeric_limits<uint64_t>::max();
+        while (!space->isSimulationOver()) {
+            space->updateThreadState(thread_id, ThreadSyncState::WAITING_FOR_CLOCK);
+            auto signal = space->getCurrentSyncSignal();
+            while (!(signal.step_ready && signal.current_step != last_step)) {
+                if (space->isSimulationOver()) return;
+                pollWait(poll_us);
+                signal = space->getCurrentSyncSignal();
+            }
+            space->updateThreadState(thread_id, ThreadSyncState::RUNNING);
+            last_step = signal.current_step;
+            space->updateThreadState(thread_id, ThreadSyncState::COMPLETED);
+            while (space->getCurrentSyncSignal().step_ready) {
+                if (space->isSimulationOver()) return;
+                pollWait(poll_us);
+            }
+        }
+    }
+
+} // namespace
+
+static void BM_ClockStepWithThreads(benchmark::State& state) {
+    const int thread_count = static_cast<int>(state.range(0));
+    const int poll_us = static_cast<int>(state.range(1));
+
+    auto space = std::make_shared<GlobalSharedDataSpace>();
+    VFT_SMF::SimulationConfig config;
+    config.time_step = 0.01;
+    config.step_time_increment = 0.01;
+    VFT_SMF::SimulationClock clock(config);
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < thread_count; ++i) {
+        const std::string thread_id = "bench_agent_" + std::to_string(i);
+        space->registerThread(thread_id, thread_id, "benchmark");
+        space->updateThreadState(thread_id, ThreadSyncState::COMPLETED);
+    }
+    clock.start(space);
+    space->resetSyncSignal();
+    for (int i = 0; i < thread_count; ++i) {
+        workers.emplace_back(agentLoop, space, "bench_agent_" + std::to_string(i), poll_us);
+    }
+
+    for (auto _ : state) {
+        clock.update(0.01, space);
+    }
+
+    clock.stop(space);
+    for (auto& worker : workers) worker.join();
+
+    state.counters["threads"] = thread_count;
+    state.counters["steps_per_second"] = benchmark::Counter(static_cast<double>(state.iterations()),
+                                                            benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_ClockStepWithThreads)
+    ->ArgsProduct({{1, 2, 4, 8}, {0, 150}})
+    ->ArgNames({"threads", "poll_us"})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+/**
+ * @brief 无注册线程时的纯时钟推进开销
+ */
+static void BM_ClockUpdateNoThreads(benchmark::State& state) {
+    VFT_SMF::SimulationConfig config;
+    config.time_step = 0.01;
+    VFT_SMF::SimulationClock clock(config);
+    clock.start(nullptr);
+    for (auto _ : state) {
+        clock.update(0.01);
+    }
+    benchmark::DoNotOptimize(clock.get_current_simulation_time());
+}
+BENCHMARK(BM_ClockUpdateNoThreads);
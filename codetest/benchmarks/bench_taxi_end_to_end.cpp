@@ -0,0 +1,68 @@
+/**
+ * @file bench_taxi_end_to_end.cpp
+ * @brief 端到端基准：运行完整的B737_Taxi场景（60 s仿真时间）
+ * @details 以子进程方式运行已编译的场景可执行文件，计时覆盖配置加载、全部代理线程、
+ *          数据记录与文件输出。可通过环境变量覆盖路径：
+ *          VFT_SMF_SCENARIO_DIR  场景目录（默认 ../ScenarioExamples/B737_Taxi，相对于codetest目录）
+ *          VFT_SMF_SIM_EXE       可执行文件（默认为场景目录下的 EventDrivenSimulation_NewArchitecture）
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+#ifdef _WIN32
+    const char* const DEFAULT_EXECUTABLE = "EventDrivenSimulation_NewArchitecture.exe";
+    const char* const NULL_DEVICE = "NUL";
+#else
+    const char* const DEFAULT_EXECUTABLE = "EventDrivenSimulation_NewArchitecture";
+    const char* const NULL_DEVICE = "/dev/null";
+#endif
+
+    const double TAXI_SIMULATION_SECONDS = 60.0;
+
+    std::string environmentOr(const char* name, const std::string& fallback) {
+        const char* value = std::getenv(name);
+        return (value && *value) ? std::string(value) : fallback;
+    }
+
+} // namespace
+
+static void BM_B737TaxiEndToEnd(benchmark::State& state) {
+    const fs::path scenario_dir = fs::absolute(environmentOr("VFT_SMF_SCENARIO_DIR", "../ScenarioExamples/B737_Taxi"));
+    const fs::path executable = fs::absolute(environmentOr("VFT_SMF_SIM_EXE", (scenario_dir / DEFAULT_EXECUTABLE).string()));
+    if (!fs::exists(executable) || !fs::exists(scenario_dir / "config" / "SimulationConfig.json")) {
+        state.SkipWithError(("未找到场景可执行文件或配置: " + executable.string()).c_str());
+        return;
+    }
+
+    fs::create_directories(scenario_dir / "output");  // 仓库中不保存输出目录，日志初始化需要其存在
+    const fs::path original_dir = fs::current_path();
+    const std::string command = "\"" + executable.string() + "\" > " + NULL_DEVICE + " 2>&1";
+
+    for (auto _ : state) {
+        fs::current_path(scenario_dir);
+        const auto start = std::chrono::steady_clock::now();
+        const int exit_code = std::system(command.c_str());
+        const auto end = std::chrono::steady_clock::now();
+        fs::current_path(original_dir);
+
+        if (exit_code != 0) {
+            state.SkipWithError(("场景运行失败，退出码: " + std::to_string(exit_code)).c_str());
+            break;
+        }
+        state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+    }
+
+    state.counters["sim_seconds_per_wall_second"] = benchmark::Counter(
+        TAXI_SIMULATION_SECONDS * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_B737TaxiEndToEnd)->Iterations(1)->UseManualTime()->Unit(benchmark::kSecond);
@@ -0,0 +1,96 @@
+@echo off
+chcp 65001 >nul
+echo ========================================
+echo VFT_SMF V3 - 性能基准编译脚本 (Google Benchmark)
+echo ========================================
+echo.
+
+:: 编译基准测试（需已安装Google Benchmark，例如 MSYS2: pacman -S mingw-w64-x86_64-benchmark）
+echo [1/2] 编译性能基准...
+if not exist "benchmark_output" mkdir benchmark_output
+g++ -std=c++17 -O2 -DNDEBUG ^
+    -I../src -I../src/I_ThirdPartyTools ^
+    -o benchmark_output/run_benchmarks.exe ^
+    benchmarks/bench_simulation_clock.cpp ^
+    benchmarks/bench_shared_data_space.cpp ^
+    benchmarks/bench_data_recorder.cpp ^
+    benchmarks/bench_flight_dynamics.cpp ^
+    benchmarks/bench_event_monitor.cpp ^
+    benchmarks/bench_taxi_end_to_end.cpp ^
+    benchmarks/bench_logger.cpp ^
+    ../src/G_SimulationManager/D_EventDrivenArchitecture/AgentThreadFunctions.cpp ^
+    ../src/G_SimulationManager/D_EventDrivenArchitecture/EventDispatcher.cpp ^
+    ../src/E_GlobalSharedDataSpace/GlobalSharedDataSpace.cpp ^
+    ../src/E_GlobalSharedDataSpace/GlobalSharedDataStruct.cpp ^
+    ../src/G_SimulationManager/LogAndData/DataRecorder.cpp ^
+    ../src/G_SimulationManager/LogAndData/TimeSeriesCodec.cpp ^
+    ../src/G_SimulationManager/LogAndData/TimeIndex.cpp ^
+    ../src/G_SimulationManager/LogAndData/TelemetryRing.cpp ^
+    ../src/G_SimulationManager/LogAndData/TelemetryPublisher.cpp ^
+    ../src/G_SimulationManager/LogAndData/StreamingStatistics.cpp ^
+    ../src/G_SimulationManager/LogAndData/MonteCarloAggregator.cpp ^
+    ../src/G_SimulationManager/A_TimeSYNC/Simulation_Clock.cpp ^
+    ../src/G_SimulationManager/B_SimManage/EventMonitor.cpp ^
+    ../src/G_SimulationManager/B_SimManage/TerminationMonitor.cpp ^
+    ../src/G_SimulationManager/B_SimManage/DataPack.cpp ^
+    ../src/G_SimulationManager/B_SimManage/AllocationTracker.cpp ^
+    ../src/G_SimulationManager/B_SimManage/ThreadPlacement.cpp ^
+    ../src/G_SimulationManager/B_SimManage/PerfCounterProfiler.cpp ^
+    ../src/G_SimulationManager/B_SimManage/InstrumentedMutex.cpp ^
+    ../src/G_SimulationManager/B_SimManage/SimulationMetrics.cpp ^
+    ../src/G_SimulationManager/B_SimManage/MetricsServer.cpp ^
+    ../src/E_GlobalSharedDataSpace/StateTransport.cpp ^
+    ../src/G_SimulationManager/A_TimeSYNC/TransportStepRelay.cpp ^
+    ../src/G_SimulationManager/LogAndData/CsvExport.cpp ^
+    ../src/G_SimulationManager/C_ConfigManager/ConfigManager.cpp ^
+    ../src/F_ScenarioModelling/A_FlightPlanParser/FlightPlanParser.cpp ^
+    ../src/A_PilotAgentModel/PilotAgent.cpp ^
+    ../src/A_PilotAgentModel/Pilot_001/Pilot_001_Strategy.cpp ^
+    ../src/A_PilotAgentModel/Pilot_002/Pilot_002_Strategy.cpp ^
+    ../src/A_PilotAgentModel/Pilot_001/ServiceTwin/PilotATCCommandHandler.cpp ^
+    ../src/A_PilotAgentModel/Pilot_001/ServiceTwin/PilotManualControlHandler.cpp ^
+    ../src/B_AircraftAgentModel/AircraftAgent.cpp ^
+    ../src/B_AircraftAgentModel/AircraftDigitalTwinFactory.cpp ^
+    ../src/B_AircraftAgentModel/B737/B737DigitalTwin.cpp ^
+    ../src/B_AircraftAgentModel/B737/ModelTwin/FlightControl/B737_AutoFlightControlLaw.cpp ^
+    ../src/B_AircraftAgentModel/B737/ServiceTwin/ServiceTwin_StateManager.cpp ^
+    ../src/B_AircraftAgentModel/B737/ServiceTwin/ControlPriorityManager.cpp ^
+    ../src/C_EnvirnomentAgentModel/EnvironmentAgent.cpp ^
+    ../src/C_EnvirnomentAgentModel/EnvironmentConfigManager.cpp ^
+    ../src/D_ATCAgentModel/A_StandardBase/ATCAgent.cpp ^
+    ../src/D_ATCAgentModel/ATC_001/ATC_001_Strategy.cpp ^
+    ../src/D_ATCAgentModel/ATC_002/ATC_002_Strategy.cpp ^
+    ../src/E_FlightDynamics/FlightDynamicsAgent.cpp ^
+    ../src/E_FlightDynamics/B737/B737_FlightDynamicsModel_New.cpp ^
+    ../src/E_FlightDynamics/LandingGear.cpp ^
+    ../src/E_FlightDynamics/LocalTangentFrame.cpp ^
+    ../src/E_FlightDynamics/TrimSolver.cpp ^
+    ../src/E_FlightDynamics/LinearModel.cpp ^
+    -lbenchmark_main -lbenchmark -lshlwapi -lpthread -lws2_32
+
+if %ERRORLEVEL% NEQ 0 (
+    echo 错误: 性能基准编译失败！
+    pause
+    exit /b 1
+)
+echo 性能基准编译成功！
+echo.
+
+:: 端到端基准需要已编译的B737_Taxi场景可执行文件（ScenarioExamples/B737_Taxi/build.bat）
+echo [2/2] 创建运行脚本...
+echo @echo off > benchmark_output/run_benchmarks.bat
+echo chcp 65001 ^>nul >> benchmark_output/run_benchmarks.bat
+echo cd .. >> benchmark_output/run_benchmarks.bat
+echo benchmark_output\run_benchmarks.exe --benchmark_out=benchmark_output/benchmark_results.json --benchmark_out_format=json %%* >> benchmark_output/run_benchmarks.bat
+echo pause >> benchmark_output/run_benchmarks.bat
+
+echo ========================================
+echo 性能基准编译完成！
+echo ========================================
+echo.
+echo 运行: benchmark_output\run_benchmarks.bat
+echo 结果(JSON): benchmark_output/benchmark_results.json
+echo 仅运行部分基准: benchmark_output\run_benchmarks.bat --benchmark_filter=BM_RecordAllData
+echo ========================================
+echo.
+pause
@@ -0,0 +1,99 @@
+#!/usr/bin/env bash
+# VFT_SMF V3 - 性能基准编译脚本 (Linux / macOS, Google Benchmark)
+# 用法: ./build_benchmarks.sh [--run] [Google Benchmark参数...]
+#   --run  编译后立即运行，结果以JSON写入 benchmark_output/benchmark_results.json
+# 依赖: g++ (C++17)、Google Benchmark (Debian/Ubuntu: apt install libbenchmark-dev)
+set -euo pipefail
+cd "$(dirname "$0")"
+
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:-"-std=c++17 -O2 -DNDEBUG"}
+LIBS="-lpthread"
+if [ "$(uname -s)" = "Linux" ]; then
+    LIBS="$LIBS -lrt"
+fi
+
+SIM_SOURCES=(
+    ../src/G_SimulationManager/D_EventDrivenArchitecture/AgentThreadFunctions.cpp
+    ../src/G_SimulationManager/D_EventDrivenArchitecture/EventDispatcher.cpp
+    ../src/E_GlobalSharedDataSpace/GlobalSharedDataSpace.cpp
+    ../src/E_GlobalSharedDataSpace/GlobalSharedDataStruct.cpp
+    ../src/G_SimulationManager/LogAndData/DataRecorder.cpp
+    ../src/G_SimulationManager/LogAndData/TimeSeriesCodec.cpp
+    ../src/G_SimulationManager/LogAndData/TimeIndex.cpp
+    ../src/G_SimulationManager/LogAndData/TelemetryRing.cpp
+    ../src/G_SimulationManager/LogAndData/TelemetryPublisher.cpp
+    ../src/G_SimulationManager/LogAndData/StreamingStatistics.cpp
+    ../src/G_SimulationManager/LogAndData/MonteCarloAggregator.cpp
+    ../src/G_SimulationManager/A_TimeSYNC/Simulation_Clock.cpp
+    ../src/G_SimulationManager/B_SimManage/EventMonitor.cpp
+    ../src/G_SimulationManager/B_SimManage/TerminationMonitor.cpp
+    ../src/G_SimulationManager/B_SimManage/DataPack.cpp
+    ../src/G_SimulationManager/B_SimManage/AllocationTracker.cpp
+    ../src/G_SimulationManager/B_SimManage/ThreadPlacement.cpp
+    ../src/G_SimulationManager/B_SimManage/PerfCounterProfiler.cpp
+    ../src/G_SimulationManager/B_SimManage/InstrumentedMutex.cpp
+    ../src/G_SimulationManager/B_SimManage/SimulationMetrics.cpp
+    ../src/G_SimulationManager/B_SimManage/MetricsServer.cpp
+    ../src/E_GlobalSharedDataSpace/StateTransport.cpp
+    ../src/G_SimulationManager/A_TimeSYNC/TransportStepRelay.cpp
+    ../src/G_SimulationManager/LogAndData/CsvExport.cpp
+    ../src/G_SimulationManager/C_ConfigManager/ConfigManager.cpp
+    ../src/F_ScenarioModelling/A_FlightPlanParser/FlightPlanParser.cpp
+    ../src/A_PilotAgentModel/PilotAgent.cpp
+    ../src/A_PilotAgentModel/Pilot_001/Pilot_001_Strategy.cpp
+    ../src/A_PilotAgentModel/Pilot_002/Pilot_002_Strategy.cpp
+    ../src/A_PilotAgentModel/Pilot_001/ServiceTwin/PilotATCCommandHandler.cpp
+    ../src/A_PilotAgentModel/Pilot_001/ServiceTwin/PilotManualControlHandler.cpp
+    ../src/B_AircraftAgentModel/AircraftAgent.cpp
+    ../src/B_AircraftAgentModel/AircraftDigitalTwinFactory.cpp
+    ../src/B_AircraftAgentModel/B737/B737DigitalTwin.cpp
+    ../src/B_AircraftAgentModel/B737/ModelTwin/FlightControl/B737_AutoFlightControlLaw.cpp
+    ../src/B_AircraftAgentModel/B737/ServiceTwin/ServiceTwin_StateManager.cpp
+    ../src/B_AircraftAgentModel/B737/ServiceTwin/ControlPriorityManager.cpp
+    ../src/C_EnvirnomentAgentModel/EnvironmentAgent.cpp
+    ../src/C_EnvirnomentAgentModel/EnvironmentConfigManager.cpp
+    ../src/D_ATCAgentModel/A_StandardBase/ATCAgent.cpp
+    ../src/D_ATCAgentModel/ATC_001/ATC_001_Strategy.cpp
+    ../src/D_ATCAgentModel/ATC_002/ATC_002_Strategy.cpp
+    ../src/E_FlightDynamics/FlightDynamicsAgent.cpp
+    ../src/E_FlightDynamics/B737/B737_FlightDynamicsModel_New.cpp
+    ../src/E_FlightDynamics/LandingGear.cpp
+    ../src/E_FlightDynamics/LocalTangentFrame.cpp
+    ../src/E_FlightDynamics/TrimSolver.cpp
+    ../src/E_FlightDynamics/LinearModel.cpp
+)
+
+BENCH_SOURCES=(
+    benchmarks/bench_simulation_clock.cpp
+    benchmarks/bench_shared_data_space.cpp
+    benchmarks/bench_data_recorder.cpp
+    benchmarks/bench_flight_dynamics.cpp
+    benchmarks/bench_event_monitor.cpp
+    benchmarks/bench_taxi_end_to_end.cpp
+    benchmarks/bench_logger.cpp
+)
+
+mkdir -p benchmark_output
+
+echo "[1/2] 编译B737_Taxi场景可执行文件（端到端基准使用）..."
+$CXX $CXXFLAGS -I../src -I../src/I_ThirdPartyTools \
+    -o ../ScenarioExamples/B737_Taxi/EventDrivenSimulation_NewArchitecture \
+    ../src/G_SimulationManager/D_EventDrivenArchitecture/EventDrivenMain_NewArchitecture.cpp \
+    "${SIM_SOURCES[@]}" $LIBS
+
+echo "[2/2] 编译性能基准..."
+$CXX $CXXFLAGS -I../src -I../src/I_ThirdPartyTools \
+    -o benchmark_output/run_benchmarks \
+    "${BENCH_SOURCES[@]}" "${SIM_SOURCES[@]}" \
+    -lbenchmark_main -lbenchmark $LIBS
+
+echo "性能基准编译完成: benchmark_output/run_benchmarks"
+
+if [ "${1:-}" = "--run" ]; then
+    shift
+    ./benchmark_output/run_benchmarks \
+        --benchmark_out=benchmark_output/benchmark_results.json \
+        --benchmark_out_format=json "$@"
+    echo "结果(JSON): benchmark_output/benchmark_results.json"
+fi
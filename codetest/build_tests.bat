@@ -44,14 +44,37 @@ g++ -std=c++17 ^
     -Igoogletest/googletest/include ^
     -Igoogletest/googlemock/include ^
     -Lgoogletest/build/lib -lgtest -lgtest_main -lgmock ^
-    -lpthread ^
+    -lpthread -lws2_32 ^
     -o test_output/run_tests.exe ^
     tests/unit/aircraft/test_b737_digital_twin.cpp ^
     tests/unit/aircraft/test_control_priority_manager.cpp ^
     tests/unit/pilot/test_pilot_manual_control.cpp ^
     tests/unit/simulation/test_simulation_clock.cpp ^
+    tests/unit/simulation/test_time_series_codec.cpp ^
+    tests/unit/simulation/test_time_index.cpp ^
+    tests/unit/simulation/test_telemetry_ring.cpp ^
+    tests/unit/simulation/test_data_source_registry.cpp ^
+    tests/unit/simulation/test_random_service.cpp ^
+    tests/unit/simulation/test_monte_carlo_aggregator.cpp ^
+    tests/unit/simulation/test_parameter_sweep.cpp ^
+    tests/unit/simulation/test_termination_monitor.cpp ^
+    tests/unit/simulation/test_trim_solver.cpp ^
+    tests/unit/simulation/test_linear_model.cpp ^
+    tests/unit/simulation/test_control_tuning.cpp ^
+    tests/unit/simulation/test_landing_gear.cpp ^
+    tests/unit/simulation/test_local_tangent_frame.cpp ^
+    tests/unit/simulation/test_flight_dynamics_pipeline.cpp ^
+    tests/unit/simulation/test_data_pack.cpp ^
+    tests/unit/simulation/test_step_arena.cpp ^
+    tests/unit/simulation/test_allocation_tracker.cpp ^
+    tests/unit/simulation/test_deferred_log.cpp ^
+    tests/unit/simulation/test_thread_placement.cpp ^
+    tests/unit/simulation/test_perf_counter_profiler.cpp ^
+    tests/unit/simulation/test_instrumented_mutex.cpp ^
+    tests/unit/simulation/test_metrics_server.cpp ^
+    tests/unit/simulation/test_state_transport.cpp ^
+    tests/unit/simulation/test_csv_export.cpp ^
     tests/integration/test_simulation_workflow.cpp ^
-    tests/performance/test_simulation_performance.cpp ^
     src/B_AircraftAgentModel/B737/B737DigitalTwin.cpp ^
     src/B_AircraftAgentModel/B737/ServiceTwin/ControlPriorityManager.cpp ^
     src/A_PilotAgentModel/Pilot_001/ServiceTwin/PilotManualControlHandler.cpp ^
@@ -59,6 +82,33 @@ g++ -std=c++17 ^
     src/E_GlobalSharedDataSpace/GlobalSharedDataSpace.cpp ^
     src/E_GlobalSharedDataSpace/GlobalSharedDataStruct.cpp ^
     src/G_SimulationManager/LogAndData/DataRecorder.cpp ^
+    src/G_SimulationManager/LogAndData/TimeSeriesCodec.cpp ^
+    src/G_SimulationManager/LogAndData/TimeIndex.cpp ^
+    src/G_SimulationManager/LogAndData/TelemetryRing.cpp ^
+    src/G_SimulationManager/LogAndData/TelemetryPublisher.cpp ^
+    src/G_SimulationManager/LogAndData/StreamingStatistics.cpp ^
+    src/G_SimulationManager/LogAndData/MonteCarloAggregator.cpp ^
+    src/F_ScenarioModelling/C_ParameterSweep/ParameterSweep.cpp ^
+    src/G_SimulationManager/B_SimManage/TerminationMonitor.cpp ^
+    src/G_SimulationManager/B_SimManage/DataPack.cpp ^
+    src/G_SimulationManager/B_SimManage/AllocationTracker.cpp ^
+    src/G_SimulationManager/B_SimManage/ThreadPlacement.cpp ^
+    src/G_SimulationManager/B_SimManage/PerfCounterProfiler.cpp ^
+    src/G_SimulationManager/B_SimManage/InstrumentedMutex.cpp ^
+    src/G_SimulationManager/B_SimManage/SimulationMetrics.cpp ^
+    src/G_SimulationManager/B_SimManage/MetricsServer.cpp ^
+    src/E_GlobalSharedDataSpace/StateTransport.cpp ^
+    src/G_SimulationManager/A_TimeSYNC/TransportStepRelay.cpp ^
+    src/G_SimulationManager/LogAndData/CsvExport.cpp ^
+    src/C_EnvirnomentAgentModel/EnvironmentConfigManager.cpp ^
+    src/E_FlightDynamics/FlightDynamicsAgent.cpp ^
+    src/E_FlightDynamics/B737/B737_FlightDynamicsModel_New.cpp ^
+    src/E_FlightDynamics/LandingGear.cpp ^
+    src/E_FlightDynamics/LocalTangentFrame.cpp ^
+    src/E_FlightDynamics/TrimSolver.cpp ^
+    src/E_FlightDynamics/LinearModel.cpp ^
+    src/B_AircraftAgentModel/B737/ModelTwin/FlightControl/B737_AutoFlightControlLaw.cpp ^
+    src/F_ScenarioModelling/D_ControlTuning/ControlTuning.cpp ^
     src/G_SimulationManager/C_ConfigManager/ConfigManager.cpp
 
 if %ERRORLEVEL% EQU 0 (
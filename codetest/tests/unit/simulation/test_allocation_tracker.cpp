@@ -0,0 +1,182 @@
+/**
+ * @file test_allocation_tracker.cpp
+ * @brief 堆分配计数与稳态零分配检查单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 包含被测试的头文件
+#include "../../../../src/G_SimulationManager/B_SimManage/AllocationTracker.hpp"
+
+using namespace VFT_SMF::SimManage;
+
+namespace {
+    // 经 volatile 指针发布，避免编译器消除成对的 new/delete
+    int* volatile allocation_sink = nullptr;
+
+    void allocateInts(int count) {
+        for (int i = 0; i < count; ++i) {
+            allocation_sink = new int(i);
+            delete allocation_sink;
+        }
+    }
+
+    const ThreadAllocationStats* findThread(const std::vector<ThreadAllocationStats>& stats, const std::string& name) {
+        for (const auto& entry : stats) {
+            if (entry.thread_name == name) return &entry;
+        }
+        return nullptr;
+    }
+}
+
+/**
+ * @brief 分配统计测试类
+ */
+class AllocationTrackerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        AllocationTracker::setMode(AllocationTrackingMode::Count);
+    }
+
+    void TearDown() override {
+        AllocationTracker::untagCurrentThread();
+        AllocationTracker::setMode(AllocationTrackingMode::Off);
+    }
+};
+
+/**
+ * @brief 测试模式名称解析
+ */
+TEST_F(AllocationTrackerTest, ParseModeTest) {
+    AllocationTrackingMode mode = AllocationTrackingMode::Off;
+    EXPECT_TRUE(AllocationTracker::parseMode("strict", mode));
+    EXPECT_EQ(mode, AllocationTrackingMode::Strict);
+    EXPECT_TRUE(AllocationTracker::parseMode("count", mode));
+    EXPECT_EQ(mode, AllocationTrackingMode::Count);
+    EXPECT_FALSE(AllocationTracker::parseMode("verbose", mode));
+    EXPECT_EQ(mode, AllocationTrackingMode::Count);
+}
+
+/**
+ * @brief 测试逐步计数：初始化分配与各步分配分别结算
+ */
+TEST_F(AllocationTrackerTest, PerStepCountTest) {
+    AllocationTracker::tagCurrentThread("Tracker_Test_Thread");
+    AllocationTracker::resetStatistics();
+    allocateInts(2);                 // 初始化阶段
+
+    AllocationTracker::beginStep(1);
+    allocateInts(3);
+    const uint64_t step_one = AllocationTracker::getCurrentStepAllocations();
+    const uint64_t step_one_bytes = AllocationTracker::getCurrentStepBytes();
+    AllocationTracker::beginStep(2);
+    allocateInts(5);
+    AllocationTracker::beginStep(3);
+    const uint64_t step_three = AllocationTracker::getCurrentStepAllocations();
+    AllocationTracker::untagCurrentThread();
+
+    EXPECT_EQ(step_one, 3u);
+    EXPECT_EQ(step_one_bytes, 3 * sizeof(int));
+    EXPECT_EQ(step_three, 0u);
+
+    const auto stats = AllocationTracker::snapshot();
+    const ThreadAllocationStats* thread = findThread(stats, "Tracker_Test_Thread");
+    ASSERT_NE(thread, nullptr);
+    EXPECT_GE(thread->init_allocations, 2u);
+    EXPECT_EQ(thread->steps, 3u);
+    ASSERT_EQ(thread->history.size(), 3u);
+    EXPECT_EQ(thread->history[0].step, 1u);
+    EXPECT_EQ(thread->history[0].allocations, 3u);
+    EXPECT_EQ(thread->history[1].allocations, 5u);
+    EXPECT_EQ(thread->max_step_allocations, 5u);
+    EXPECT_EQ(thread->max_step, 2u);
+    EXPECT_GE(thread->frees, 8u);
+}
+
+/**
+ * @brief 测试各线程分别计数，off 模式不计数
+ */
+TEST_F(AllocationTrackerTest, ThreadSeparationTest) {
+    uint64_t worker_count = 0;
+    std::thread worker([&]() {
+        AllocationTracker::tagCurrentThread("Tracker_Worker_Thread");
+        AllocationTracker::beginStep(1);
+        allocateInts(4);
+        worker_count = AllocationTracker::getCurrentStepAllocations();
+        AllocationTracker::untagCurrentThread();
+    });
+    worker.join();
+    EXPECT_EQ(worker_count, 4u);
+
+    AllocationTracker::setMode(AllocationTrackingMode::Off);
+    AllocationTracker::beginStep(1);
+    allocateInts(4);
+    EXPECT_EQ(AllocationTracker::getCurrentStepAllocations(), 0u);
+}
+
+/**
+ * @brief 测试 off 模式下已标记线程逐步调用 beginStep 不结算、不追加历史
+ */
+TEST_F(AllocationTrackerTest, OffModeSkipsHistoryTest) {
+    AllocationTracker::tagCurrentThread("Tracker_Off_Thread");
+    AllocationTracker::resetStatistics();
+    AllocationTracker::setMode(AllocationTrackingMode::Off);
+    for (uint64_t step = 1; step <= 3; ++step) {
+        AllocationTracker::beginStep(step);
+        allocateInts(2);
+    }
+    AllocationTracker::untagCurrentThread();
+
+    const auto stats = AllocationTracker::snapshot();
+    const ThreadAllocationStats* thread = findThread(stats, "Tracker_Off_Thread");
+    ASSERT_NE(thread, nullptr);
+    EXPECT_EQ(thread->steps, 0u);
+    EXPECT_TRUE(thread->history.empty());
+}
+
+/**
+ * @brief 测试稳态区域：count 模式下记录区域内的分配
+ */
+TEST_F(AllocationTrackerTest, SteadyStateCountTest) {
+    AllocationTracker::tagCurrentThread("Tracker_Steady_Thread");
+    AllocationTracker::resetStatistics();
+    AllocationTracker::beginStep(1);
+    {
+        AllocationTracker::SteadyStateScope steady_state("test_region");
+        allocateInts(2);
+    }
+    allocateInts(1);
+    AllocationTracker::untagCurrentThread();
+
+    const auto stats = AllocationTracker::snapshot();
+    const ThreadAllocationStats* thread = findThread(stats, "Tracker_Steady_Thread");
+    ASSERT_NE(thread, nullptr);
+    EXPECT_EQ(thread->steady_state_allocations, 2u);
+    EXPECT_EQ(thread->step_allocations, 3u);
+}
+
+/**
+ * @brief 测试 strict 模式：稳态区域内分配即中止并打印区域名
+ */
+TEST_F(AllocationTrackerTest, StrictModeAbortsTest) {
+    ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    EXPECT_DEATH({
+        AllocationTracker::setMode(AllocationTrackingMode::Strict);
+        AllocationTracker::SteadyStateScope steady_state("strict_region");
+        allocateInts(1);
+    }, "strict_region");
+
+    // 区域外分配不受影响
+    AllocationTracker::setMode(AllocationTrackingMode::Strict);
+    allocateInts(1);
+    {
+        AllocationTracker::SteadyStateScope steady_state("empty_region");
+        int local_values[4] = {1, 2, 3, 4};
+        EXPECT_EQ(local_values[3], 4);
+    }
+}
@@ -0,0 +1,124 @@
+/**
+ * @file test_control_tuning.cpp
+ * @brief 控制律增益整定单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+
+// 包含被测试的头文件
+#include "../../../../src/F_ScenarioModelling/D_ControlTuning/ControlTuning.hpp"
+
+using namespace VFT_SMF::ControlTuning;
+
+/**
+ * @brief 控制律整定测试类
+ */
+class ControlTuningTest : public ::testing::Test {
+protected:
+    TuningCase makeCase(TuningLoop loop, PlantModel plant, double step) {
+        TuningCase tuning_case;
+        tuning_case.loop = loop;
+        tuning_case.plant = plant;
+        tuning_case.step = step;
+        tuning_case.duration = 20.0;
+        return tuning_case;
+    }
+};
+
+/**
+ * @brief 测试默认增益取自控制律构造函数
+ */
+TEST_F(ControlTuningTest, DefaultGainsTest) {
+    const PidGains speed = StepResponseEvaluator::defaultGains(TuningLoop::Autothrottle);
+    EXPECT_DOUBLE_EQ(speed.kp, 0.5);
+    EXPECT_DOUBLE_EQ(speed.ki, 0.02);
+    EXPECT_DOUBLE_EQ(speed.kd, 0.1);
+
+    const PidGains yaw = StepResponseEvaluator::defaultGains(TuningLoop::YawDamper);
+    EXPECT_DOUBLE_EQ(yaw.kp, 0.8);
+    EXPECT_DOUBLE_EQ(yaw.ki, 0.0);
+
+    TuningLoop loop;
+    EXPECT_TRUE(parseTuningLoop("heading_hold", loop));
+    EXPECT_EQ(loop, TuningLoop::HeadingHold);
+    EXPECT_EQ(tuningLoopName(loop), "heading_hold");
+    EXPECT_FALSE(parseTuningLoop("flaps", loop));
+}
+
+/**
+ * @brief 测试阶跃响应指标：线性与非线性对象的自动油门速度阶跃一致
+ */
+TEST_F(ControlTuningTest, StepResponseMetricsTest) {
+    const PidGains gains = StepResponseEvaluator::defaultGains(TuningLoop::Autothrottle);
+
+    StepResponseEvaluator linear(makeCase(TuningLoop::Autothrottle, PlantModel::Linear, 5.0));
+    ASSERT_TRUE(linear.isReady());
+    std::vector<ResponseSample> trace;
+    const StepResponseMetrics metrics = linear.evaluate(gains, &trace);
+    EXPECT_TRUE(metrics.stable);
+    EXPECT_TRUE(metrics.settled);
+    EXPECT_GT(metrics.overshoot, 0.0);
+    EXPECT_LT(metrics.rise_time, metrics.settling_time);
+    EXPECT_LT(metrics.steady_state_error, 0.25);
+    EXPECT_GT(metrics.control_effort, 0.0);
+    ASSERT_EQ(trace.size(), 2000u);
+    EXPECT_NEAR(trace.back().response, 5.0, 0.25);
+
+    StepResponseEvaluator nonlinear(makeCase(TuningLoop::Autothrottle, PlantModel::Nonlinear, 5.0));
+    const StepResponseMetrics reference = nonlinear.evaluate(gains);
+    EXPECT_TRUE(reference.settled);
+    EXPECT_NEAR(metrics.settling_time, reference.settling_time, 0.2);
+    EXPECT_NEAR(metrics.overshoot, reference.overshoot, 0.5);
+
+    // 发散的增益得到更高代价，且越早发散代价越高
+    StepResponseMetrics early, late;
+    early.diverged_at = 1.0;
+    late.diverged_at = 10.0;
+    EXPECT_GT(linear.cost(early), linear.cost(late));
+    EXPECT_GT(linear.cost(late), linear.cost(metrics));
+}
+
+/**
+ * @brief 测试整定：代价下降，结果与并行线程数无关
+ */
+TEST_F(ControlTuningTest, TuningImprovesCostTest) {
+    StepResponseEvaluator evaluator(makeCase(TuningLoop::HeadingHold, PlantModel::Linear, 10.0));
+    ASSERT_TRUE(evaluator.isReady());
+
+    TuningOptions options;
+    options.initial_samples = 16;
+    options.max_iterations = 30;
+    options.parallel_workers = 1;
+    const PidGains initial = StepResponseEvaluator::defaultGains(TuningLoop::HeadingHold);
+    const TuningResult serial = GainTuner(evaluator, options).tune(initial);
+
+    EXPECT_LT(serial.best_cost, serial.initial_cost);
+    EXPECT_TRUE(serial.best_metrics.settled);
+    EXPECT_LT(serial.best_metrics.overshoot, serial.initial_metrics.overshoot);
+    EXPECT_GT(serial.evaluations, options.initial_samples);
+    EXPECT_DOUBLE_EQ(evaluator.cost(evaluator.evaluate(serial.best_gains)), serial.best_cost);
+
+    options.parallel_workers = 4;
+    const TuningResult parallel = GainTuner(evaluator, options).tune(initial);
+    EXPECT_DOUBLE_EQ(parallel.best_cost, serial.best_cost);
+    EXPECT_DOUBLE_EQ(parallel.best_gains.kp, serial.best_gains.kp);
+    EXPECT_EQ(parallel.evaluations, serial.evaluations);
+}
+
+/**
+ * @brief 测试偏航阻尼器：初始偏航角速度扰动被衰减
+ */
+TEST_F(ControlTuningTest, YawDamperDisturbanceTest) {
+    StepResponseEvaluator evaluator(makeCase(TuningLoop::YawDamper, PlantModel::Nonlinear, 2.0));
+    ASSERT_TRUE(evaluator.isReady());
+
+    std::vector<ResponseSample> trace;
+    const StepResponseMetrics metrics = evaluator.evaluate({0.2, 0.0, 0.0}, &trace);
+    EXPECT_TRUE(metrics.stable);
+    EXPECT_TRUE(metrics.settled);
+    EXPECT_NEAR(trace.back().response, -2.0, 0.1);   // 偏航角速度回到配平值
+    EXPECT_LT(trace.front().command, 0.0);           // 正偏航角速度对应负方向舵
+}
@@ -0,0 +1,265 @@
+/**
+ * @file test_csv_export.cpp
+ * @brief 定宽CSV快速写出单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// 包含被测试的头文件
+#include "../../../../src/G_SimulationManager/LogAndData/CsvExport.hpp"
+#include "../../../../src/G_SimulationManager/LogAndData/TimeIndex.hpp"
+#include "../../../../src/G_SimulationManager/LogAndData/DataRecorder.hpp"
+
+using namespace VFT_SMF::CsvExport;
+
+/**
+ * @brief CSV写出测试类
+ */
+class CsvExportTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        directory = std::filesystem::temp_directory_path() / "vft_csv_export_test";
+        std::filesystem::create_directories(directory);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(directory);
+    }
+
+    static std::string readFile(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    std::filesystem::path directory;
+};
+
+/**
+ * @brief 测试精度描述解析与查询优先级
+ */
+TEST_F(CsvExportTest, ColumnPrecisionParseTest) {
+    ColumnPrecision precision;
+    std::string error;
+    ASSERT_TRUE(ColumnPrecision::parse(" default=3; latitude=8 ;aircraft_net_force.pitch_moment=shortest;;", precision, error));
+    EXPECT_EQ(precision.get("aircraft_flight_state", "altitude"), 3);
+    EXPECT_EQ(precision.get("aircraft_flight_state", "latitude"), 8);
+    EXPECT_EQ(precision.get("aircraft_net_force", "pitch_moment"), SHORTEST);
+    EXPECT_EQ(precision.get("aircraft_net_force", "roll_moment"), 3);
+
+    // 模块限定优先于列名
+    ASSERT_TRUE(ColumnPrecision::parse("latitude=8;aircraft_logic.latitude=0", precision, error));
+    EXPECT_EQ(precision.get("aircraft_logic", "latitude"), 0);
+    EXPECT_EQ(precision.get("aircraft_flight_state", "latitude"), 8);
+    EXPECT_EQ(precision.get("aircraft_flight_state", "altitude"), DEFAULT_PRECISION);
+
+    // 空描述即默认精度，经纬度列默认 8 位
+    ASSERT_TRUE(ColumnPrecision::parse("", precision, error));
+    EXPECT_EQ(precision.get("aircraft_flight_state", "altitude"), DEFAULT_PRECISION);
+    EXPECT_EQ(precision.get("aircraft_flight_state", "latitude"), GEODETIC_PRECISION);
+    EXPECT_EQ(precision.get("aircraft_flight_state", "longitude"), GEODETIC_PRECISION);
+}
+
+/**
+ * @brief 测试格式错误的精度描述被拒绝且不修改原值
+ */
+TEST_F(CsvExportTest, ColumnPrecisionErrorTest) {
+    ColumnPrecision precision;
+    precision.set("latitude", 8);
+    std::string error;
+    for (const char* text : {"latitude", "latitude=abc", "latitude=18", "latitude=-1", "=3", "default=2x"}) {
+        error.clear();
+        EXPECT_FALSE(ColumnPrecision::parse(text, precision, error)) << text;
+        EXPECT_FALSE(error.empty()) << text;
+    }
+    EXPECT_EQ(precision.get("aircraft_flight_state", "latitude"), 8);
+}
+
+/**
+ * @brief 测试默认精度下输出与 iostream 定宽格式逐字节一致
+ */
+TEST_F(CsvExportTest, MatchesStreamFormatTest) {
+    const std::vector<double> values = {0.0, -0.0, 0.005, 0.015, 1.125, -0.004, -2.675, 30.1234567,
+                                        123456789.987, 1e15, -1e-9, 99999999999.999};
+    const std::string path = (directory / "format.csv").string();
+    std::ostringstream expected;
+    {
+        CsvFileWriter out(path);
+        ASSERT_TRUE(out.isOpen());
+        out.left();
+        expected << std::left << std::fixed << std::setprecision(2);
+        for (double value : values) {
+            out.number(value, DEFAULT_PRECISION, 15).raw(' ').text("source", 20).raw(' ')
+               .integer(-42, 10).raw(' ').boolean(value > 0, 10).raw('\n');
+            expected << std::setw(15) << value << " " << std::setw(20) << "source" << " "
+                     << std::setw(10) << -42 << " " << std::setw(10) << (value > 0 ? "true" : "false") << "\n";
+        }
+        // 超宽字段不截断
+        out.text("a_text_longer_than_its_column", 10).raw('\n');
+        expected << std::setw(10) << "a_text_longer_than_its_column" << "\n";
+        EXPECT_TRUE(out.close());
+    }
+    EXPECT_EQ(readFile(path), expected.str());
+}
+
+/**
+ * @brief 测试右对齐：未填满时与 setw 一致，填满时补一个空格
+ */
+TEST_F(CsvExportTest, RightAlignTest) {
+    const std::string path = (directory / "right.csv").string();
+    {
+        CsvFileWriter out(path);
+        out.right();
+        out.number(1.5, DEFAULT_PRECISION, 8).text("abc", 6).raw('\n');
+        out.number(123456.789, DEFAULT_PRECISION, 8).number(-1234567.5, 1, 8).raw('\n');
+        out.left().text("x", 3).right().text("yz", 2).raw('\n');
+        EXPECT_TRUE(out.close());
+    }
+    EXPECT_EQ(readFile(path), "    1.50   abc\n123456.79 -1234567.5\nx  yz\n");
+}
+
+/**
+ * @brief 测试非默认精度与最短往返表示
+ */
+TEST_F(CsvExportTest, PrecisionFormatTest) {
+    EXPECT_EQ(formatNumber(30.1234567, 8), "30.12345670");
+    EXPECT_EQ(formatNumber(2.5, 0), "2");
+    EXPECT_EQ(formatNumber(-0.004, 2), "-0.00");
+    EXPECT_EQ(formatNumber(0.1, SHORTEST), "0.1");
+    EXPECT_EQ(std::stod(formatNumber(0.1 + 0.2, SHORTEST)), 0.1 + 0.2);
+    EXPECT_EQ(formatNumber(1e308, 2).size(), 312u);
+}
+
+/**
+ * @brief 测试写出位置与时间索引（跨越缓冲区写出阈值）
+ */
+TEST_F(CsvExportTest, OffsetIndexTest) {
+    const std::string path = (directory / "indexed.csv").string();
+    const int rows = 40000;   // 约 2 MiB，跨越写出阈值
+    {
+        CsvFileWriter out(path);
+        VFT_SMF::TimeIndex::TimeIndexBuilder index(1000);
+        out.left();
+        out.text("SimulationTime", 15).raw(' ').text("value", 40).raw('\n');
+        for (int i = 0; i < rows; ++i) {
+            const double time = i * 0.01;
+            index.onRow(time, out.offset());
+            out.number(time, DEFAULT_PRECISION, 15).raw(' ').number(i * 0.5, DEFAULT_PRECISION, 40).raw('\n');
+        }
+        const uint64_t total = out.offset();
+        EXPECT_TRUE(out.close());
+        EXPECT_EQ(std::filesystem::file_size(path), total);
+        index.write(VFT_SMF::TimeIndex::indexPathFor(path));
+    }
+
+    std::vector<VFT_SMF::TimeIndex::IndexEntry> entries;
+    ASSERT_TRUE(VFT_SMF::TimeIndex::loadIndex(VFT_SMF::TimeIndex::indexPathFor(path), entries));
+    ASSERT_EQ(entries.size(), 40u);
+    std::ifstream file(path, std::ios::binary);
+    file.seekg(static_cast<std::streamoff>(entries[37].byte_offset));
+    std::string line;
+    std::getline(file, line);
+    EXPECT_EQ(line.substr(0, 6), "370.00");
+}
+
+/**
+ * @brief 测试并行写出任务全部执行，异常被汇总
+ */
+TEST_F(CsvExportTest, RunParallelTest) {
+    std::atomic<int> completed{0};
+    std::vector<std::function<void()>> tasks;
+    for (int i = 0; i < 8; ++i) {
+        tasks.push_back([&completed]() { completed.fetch_add(1); });
+    }
+    tasks.push_back([]() { throw std::runtime_error("无法创建文件: x.csv"); });
+
+    const auto errors = runParallel(tasks);
+    EXPECT_EQ(completed.load(), 8);
+    ASSERT_EQ(errors.size(), 1u);
+    EXPECT_EQ(errors[0], "无法创建文件: x.csv");
+    EXPECT_TRUE(runParallel({}).empty());
+}
+
+/**
+ * @brief 测试数据记录器按配置的列精度写出，其余列保持默认格式
+ */
+TEST_F(CsvExportTest, DataRecorderPrecisionTest) {
+    VFT_SMF::DataRecorder recorder(directory.string(), 100);
+    ASSERT_TRUE(recorder.initialize());
+    ColumnPrecision precision;
+    std::string error;
+    ASSERT_TRUE(ColumnPrecision::parse("latitude=7;aircraft_flight_state.longitude=shortest", precision, error));
+    recorder.setCsvPrecision(precision);
+
+    VFT_SMF::GlobalSharedDataStruct::AircraftFlightState state;
+    state.latitude = 30.1234567;
+    state.longitude = -120.25;
+    state.altitude = 12.345;
+    recorder.recordAircraftFlightState(0.5, state);
+    recorder.flushAllBuffers();
+
+    std::ifstream file((directory / "aircraft_flight_state.csv").string());
+    std::string header;
+    std::string row;
+    std::getline(file, header);
+    std::getline(file, row);
+    EXPECT_EQ(header.substr(0, 15), " SimulationTime");
+    std::istringstream fields(row);
+    std::string time, datasource, latitude, longitude, altitude;
+    fields >> time >> datasource >> latitude >> longitude >> altitude;
+    EXPECT_EQ(time, "0.50");
+    EXPECT_EQ(latitude, "30.1234567");
+    EXPECT_EQ(longitude, "-120.25");
+    EXPECT_EQ(altitude, "12.35");
+}
+
+/**
+ * @brief 测试默认精度下经纬度保留 8 位小数，累计距离按切平面水平距离计算
+ */
+TEST_F(CsvExportTest, DataRecorderGroundDistanceTest) {
+    VFT_SMF::DataRecorder recorder(directory.string(), 100);
+    ASSERT_TRUE(recorder.initialize());
+
+    const VFT_SMF::FlightDynamics::LocalTangentFrame frame(VFT_SMF::FlightDynamics::GeodeticPosition(39.9083, 116.3975, 0.0));
+    const VFT_SMF::FlightDynamics::NedPosition track[] = {{0.0, 0.0, 0.0}, {1000.0, 0.0, 0.0}, {1000.0, 1000.0, 0.0}};
+    double time = 0.0;
+    for (const auto& point : track) {
+        const VFT_SMF::FlightDynamics::GeodeticPosition position = frame.toGeodetic(point);
+        VFT_SMF::GlobalSharedDataStruct::AircraftFlightState state;
+        state.latitude = position.latitude;
+        state.longitude = position.longitude;
+        recorder.recordAircraftFlightState(time, state);
+        time += 1.0;
+    }
+    recorder.flushAllBuffers();
+
+    std::ifstream file((directory / "aircraft_flight_state.csv").string());
+    std::string line;
+    std::vector<std::vector<std::string>> rows;
+    std::getline(file, line);
+    while (std::getline(file, line)) {
+        std::istringstream fields(line);
+        std::vector<std::string> row;
+        for (std::string field; fields >> field;) row.push_back(field);
+        rows.push_back(row);
+    }
+    ASSERT_EQ(rows.size(), 3u);
+    ASSERT_EQ(rows[0].size(), 12u);
+    EXPECT_EQ(rows[0][2], "39.90830000");
+    EXPECT_EQ(rows[0][3], "116.39750000");
+    EXPECT_EQ(rows[0][11], "0.00");
+    EXPECT_NEAR(std::stod(rows[1][11]), 1000.0, 0.01);
+    EXPECT_NEAR(std::stod(rows[2][11]), 2000.0, 0.01);
+}
@@ -0,0 +1,181 @@
+/**
+ * @file test_data_pack.cpp
+ * @brief 只读二进制数据包单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+// 包含被测试的头文件
+#include "../../../../src/G_SimulationManager/B_SimManage/DataPack.hpp"
+#include "../../../../src/C_EnvirnomentAgentModel/EnvironmentConfigManager.hpp"
+
+using namespace VFT_SMF::SimManage;
+
+/**
+ * @brief 数据包测试类
+ */
+class DataPackTest : public ::testing::Test {
+protected:
+    std::filesystem::path test_directory;
+    std::string previous_cache_directory;
+
+    void SetUp() override {
+        test_directory = std::filesystem::temp_directory_path() / "vft_datapack_test";
+        std::filesystem::remove_all(test_directory);
+        std::filesystem::create_directories(test_directory);
+        previous_cache_directory = DataPack::getCacheDirectory();
+        DataPack::setCacheDirectory((test_directory / "cache").string());
+    }
+
+    void TearDown() override {
+        DataPack::setCacheDirectory(previous_cache_directory);
+        std::filesystem::remove_all(test_directory);
+    }
+
+    std::string environmentJson(double temperature) {
+        return std::string(R"({
+            "environment_model": {"name": "Test Runway", "airport_code": "ZBAA", "runway_code": "36L"},
+            "runway_data": {"length": 3200.0, "width": 45.0, "surface_type": "混凝土", "is_available": false, "elevation": 12.5},
+            "atmospheric_data": {"temperature": )") + std::to_string(temperature) + R"(, "pressure": 1008.0, "cloud_cover": "多云"},
+            "wind_data": {"wind_speed": 7.0, "wind_direction": 270.0, "is_turbulent": true},
+            "weather_model": {"weather_stability": 0.6, "transitions": [{"from": "CLEAR", "p": 0.1}]},
+            "update_parameters": {"temperature_change_range": [-1.5, 2.5], "update_frequency": 2.0, "random_seed": 7}
+        })";
+    }
+
+    void writeEnvironment(const std::string& model, const std::string& text) {
+        const std::filesystem::path directory = test_directory / "env" / model / "DataTwin";
+        std::filesystem::create_directories(directory);
+        std::ofstream(directory / "environment_config.json") << text;
+    }
+};
+
+/**
+ * @brief 测试写出、映射与查找：展平键、类型、数组对齐，同一路径只映射一次
+ */
+TEST_F(DataPackTest, WriteAndMapTest) {
+    DataPackWriter writer;
+    writer.addJson(nlohmann::json::parse(environmentJson(18.0)));
+    writer.setSourceHash(0x1234);
+    const std::string path = (test_directory / "env.vftpack").string();
+    ASSERT_TRUE(writer.write(path));
+
+    auto pack = DataPack::open(path);
+    ASSERT_NE(pack, nullptr);
+    EXPECT_EQ(pack->getEntryCount(), writer.getEntryCount());
+    EXPECT_EQ(pack->getSourceHash(), 0x1234u);
+    EXPECT_DOUBLE_EQ(pack->getNumber("runway_data/length", 0.0), 3200.0);
+    EXPECT_EQ(pack->getString("runway_data/surface_type", ""), "混凝土");
+    EXPECT_FALSE(pack->getBool("runway_data/is_available", true));
+    EXPECT_EQ(pack->getString("weather_model/transitions/0/from", ""), "CLEAR");
+    EXPECT_TRUE(pack->hasSection("wind_data"));
+    EXPECT_FALSE(pack->hasSection("wind"));
+
+    // 类型不符或缺失时返回默认值
+    EXPECT_DOUBLE_EQ(pack->getNumber("runway_data/surface_type", -1.0), -1.0);
+    EXPECT_DOUBLE_EQ(pack->getNumber("runway_data/missing", -2.0), -2.0);
+
+    const auto [values, count] = pack->getArray("update_parameters/temperature_change_range");
+    ASSERT_EQ(count, 2u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(values) % alignof(double), 0u);
+    EXPECT_DOUBLE_EQ(values[0], -1.5);
+    EXPECT_DOUBLE_EQ(values[1], 2.5);
+
+    EXPECT_EQ(DataPack::open(path).get(), pack.get());
+}
+
+/**
+ * @brief 测试损坏、截断与版本不符的数据包被拒绝
+ */
+TEST_F(DataPackTest, RejectCorruptPackTest) {
+    DataPackWriter writer;
+    writer.addJson(nlohmann::json::parse(environmentJson(18.0)));
+    const std::string path = (test_directory / "env.vftpack").string();
+    ASSERT_TRUE(writer.write(path));
+    const auto size = std::filesystem::file_size(path);
+
+    const std::string truncated = (test_directory / "truncated.vftpack").string();
+    std::filesystem::copy_file(path, truncated);
+    std::filesystem::resize_file(truncated, size - 8);
+    EXPECT_EQ(DataPack::open(truncated), nullptr);
+
+    const std::string wrong_version = (test_directory / "version.vftpack").string();
+    std::filesystem::copy_file(path, wrong_version);
+    {
+        std::fstream file(wrong_version, std::ios::in | std::ios::out | std::ios::binary);
+        const uint32_t version = DataPack::FORMAT_VERSION + 1;
+        file.seekp(offsetof(DataPackHeader, version));
+        file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    }
+    EXPECT_EQ(DataPack::open(wrong_version), nullptr);
+
+    const std::string bad_entry = (test_directory / "entry.vftpack").string();
+    std::filesystem::copy_file(path, bad_entry);
+    {
+        std::fstream file(bad_entry, std::ios::in | std::ios::out | std::ios::binary);
+        const uint32_t key_length = 0xFFFFFFF0u;
+        file.seekp(sizeof(DataPackHeader) + offsetof(DataPackEntry, key_length));
+        file.write(reinterpret_cast<const char*>(&key_length), sizeof(key_length));
+    }
+    EXPECT_EQ(DataPack::open(bad_entry), nullptr);
+    EXPECT_EQ(DataPack::open((test_directory / "missing.vftpack").string()), nullptr);
+}
+
+/**
+ * @brief 测试按内容寻址：相同源文本复用同一数据包，源文本变化时生成新数据包
+ */
+TEST_F(DataPackTest, ContentAddressedTest) {
+    auto first = DataPack::openForSource("environment_config", environmentJson(18.0));
+    auto second = DataPack::openForSource("environment_config", environmentJson(18.0));
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ(first->getSourceHash(), DataPack::hashBytes(environmentJson(18.0).data(), environmentJson(18.0).size()));
+
+    auto changed = DataPack::openForSource("environment_config", environmentJson(25.0));
+    ASSERT_NE(changed, nullptr);
+    EXPECT_NE(changed->getPath(), first->getPath());
+    EXPECT_DOUBLE_EQ(changed->getNumber("atmospheric_data/temperature", 0.0), 25.0);
+
+    EXPECT_EQ(DataPack::openForSource("environment_config", "{ not json"), nullptr);
+}
+
+/**
+ * @brief 测试环境配置管理器：数据包路径与 JSON 回退路径得到相同配置
+ */
+TEST_F(DataPackTest, EnvironmentConfigFromPackTest) {
+    writeEnvironment("TEST_Runway", environmentJson(18.0));
+    const std::string base = (test_directory / "env").string() + "/";
+
+    VFT_SMF::EnvironmentConfigManager pack_manager(base);
+    const VFT_SMF::EnvironmentConfig from_pack = pack_manager.get_environment_config("TEST_Runway");
+    EXPECT_FALSE(std::filesystem::is_empty(test_directory / "cache"));
+
+    // 缓存目录不可用（为普通文件）时回退到 JSON 解析
+    std::ofstream(test_directory / "not_a_directory") << "x";
+    DataPack::setCacheDirectory((test_directory / "not_a_directory").string());
+    VFT_SMF::EnvironmentConfigManager json_manager(base);
+    const VFT_SMF::EnvironmentConfig from_json = json_manager.get_environment_config("TEST_Runway");
+
+    EXPECT_EQ(from_pack.environment_model.name, "Test Runway");
+    EXPECT_EQ(from_pack.environment_model.name, from_json.environment_model.name);
+    EXPECT_EQ(from_pack.runway_data.surface_type, from_json.runway_data.surface_type);
+    EXPECT_DOUBLE_EQ(from_pack.runway_data.length, from_json.runway_data.length);
+    EXPECT_DOUBLE_EQ(from_pack.runway_data.friction_coefficient, from_json.runway_data.friction_coefficient);
+    EXPECT_EQ(from_pack.runway_data.is_available, from_json.runway_data.is_available);
+    EXPECT_DOUBLE_EQ(from_pack.atmospheric_data.temperature, 18.0);
+    EXPECT_DOUBLE_EQ(from_pack.atmospheric_data.temperature, from_json.atmospheric_data.temperature);
+    EXPECT_EQ(from_pack.atmospheric_data.cloud_cover, from_json.atmospheric_data.cloud_cover);
+    EXPECT_DOUBLE_EQ(from_pack.wind_data.wind_direction, from_json.wind_data.wind_direction);
+    EXPECT_EQ(from_pack.wind_data.is_turbulent, from_json.wind_data.is_turbulent);
+    EXPECT_DOUBLE_EQ(from_pack.weather_model.weather_stability, from_json.weather_model.weather_stability);
+    EXPECT_DOUBLE_EQ(from_pack.update_parameters.temperature_change_range.first, -1.5);
+    EXPECT_DOUBLE_EQ(from_pack.update_parameters.temperature_change_range.second,
+                     from_json.update_parameters.temperature_change_range.second);
+    EXPECT_EQ(from_pack.update_parameters.random_seed, 7);
+    EXPECT_EQ(from_pack.update_parameters.random_seed, from_json.update_parameters.random_seed);
+}
@@ -0,0 +1,81 @@
+/**
+ * @file test_data_source_registry.cpp
+ * @brief 数据来源驻留表与可平凡复制状态结构体单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 包含被测试的头文件
+#include "../../../../src/E_GlobalSharedDataSpace/GlobalSharedDataStruct.hpp"
+
+using namespace VFT_SMF::GlobalSharedDataStruct;
+
+/**
+ * @brief 数据来源驻留表测试类
+ */
+class DataSourceRegistryTest : public ::testing::Test {
+};
+
+/**
+ * @brief 测试登记幂等与名称回查
+ */
+TEST_F(DataSourceRegistryTest, InternRoundTripTest) {
+    EXPECT_EQ(DataSourceRegistry::name(INITIAL_DATASOURCE), "initialspace");
+    EXPECT_EQ(DataSourceRegistry::intern("initialspace"), INITIAL_DATASOURCE);
+
+    const DataSourceId a = DataSourceRegistry::intern("registry_test_source_a");
+    const DataSourceId b = DataSourceRegistry::intern("registry_test_source_b");
+    EXPECT_NE(a, b);
+    EXPECT_EQ(DataSourceRegistry::intern("registry_test_source_a"), a);
+    EXPECT_EQ(DataSourceRegistry::name(a), "registry_test_source_a");
+    EXPECT_EQ(DataSourceRegistry::name(b), "registry_test_source_b");
+    EXPECT_EQ(DataSourceRegistry::name(0xFFFFFFu), "unknown");
+}
+
+/**
+ * @brief 测试多线程并发登记同一组名称得到一致的ID
+ */
+TEST_F(DataSourceRegistryTest, ConcurrentInternTest) {
+    std::vector<std::vector<DataSourceId>> results(4);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < results.size(); ++t) {
+        threads.emplace_back([&results, t]() {
+            for (int i = 0; i < 64; ++i) {
+                results[t].push_back(DataSourceRegistry::intern("concurrent_source_" + std::to_string(i)));
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    for (size_t t = 1; t < results.size(); ++t) {
+        EXPECT_EQ(results[t], results[0]);
+    }
+    EXPECT_EQ(std::set<DataSourceId>(results[0].begin(), results[0].end()).size(), 64u);
+}
+
+/**
+ * @brief 测试状态结构体按字节复制后内容一致（可平凡复制）
+ */
+TEST_F(DataSourceRegistryTest, TriviallyCopyableStateTest) {
+    AircraftFlightState state;
+    state.datasource = DataSourceRegistry::intern("flight_dynamics");
+    state.latitude = 39.9;
+    state.groundspeed = 12.5;
+
+    AircraftFlightState copy;
+    std::memcpy(&copy, &state, sizeof(state));
+    EXPECT_EQ(DataSourceRegistry::name(copy.datasource), "flight_dynamics");
+    EXPECT_DOUBLE_EQ(copy.latitude, 39.9);
+    EXPECT_DOUBLE_EQ(copy.groundspeed, 12.5);
+
+    ATCGlobalState atc;
+    EXPECT_STREQ(atc.current_phase, "正常");
+    EXPECT_EQ(sizeof(AircraftNetForce) % 64, 0u);
+}
@@ -0,0 +1,140 @@
+/**
+ * @file test_deferred_log.cpp
+ * @brief 延迟格式化日志单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// 包含被测试的头文件
+#include "../../../../src/G_SimulationManager/LogAndData/Logger.hpp"
+
+using VFT_SMF::Logger;
+using VFT_SMF::LogLevel;
+using VFT_SMF::LogFormat::LogRecord;
+using VFT_SMF::LogFormat::captureRecord;
+using VFT_SMF::LogFormat::formatMessage;
+
+namespace {
+    enum class TestPriority { Low = 1, High = 3 };
+
+    template<typename... Args>
+    std::string formatDeferred(const char* format, const Args&... args) {
+        LogRecord record;
+        captureRecord<VFT_SMF::LogFormat::StoredType<Args>...>(record, format, args...);
+        std::string message;
+        formatMessage(record, message);
+        return message;
+    }
+
+    std::vector<std::string> readLines(const std::filesystem::path& path) {
+        std::ifstream file(path);
+        std::vector<std::string> lines;
+        std::string line;
+        while (std::getline(file, line)) {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+
+    bool endsWith(const std::string& text, const std::string& suffix) {
+        return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
+
+    int evaluation_count = 0;
+
+    int countedValue() {
+        ++evaluation_count;
+        return 7;
+    }
+}
+
+/**
+ * @brief 测试参数展开与 std::to_string 的输出一致
+ */
+TEST(DeferredLogTest, FormatArgumentsTest) {
+    const std::string source = "flight_dynamics";
+    EXPECT_EQ(formatDeferred("数据来源: {}", source), "数据来源: flight_dynamics");
+    EXPECT_EQ(formatDeferred("时间: {}s, 步骤: {}", 12.5, 1250), "时间: " + std::to_string(12.5) + "s, 步骤: 1250");
+    EXPECT_EQ(formatDeferred("clearance={}, brake={}", true, false), "clearance=1, brake=0");
+    EXPECT_EQ(formatDeferred("优先级: {}, 源: {}", TestPriority::High, "pilot_manual"), "优先级: 3, 源: pilot_manual");
+    EXPECT_EQ(formatDeferred("油门: {}", 0.35f), "油门: " + std::to_string(0.35f));
+    EXPECT_EQ(formatDeferred("无参数"), "无参数");
+}
+
+/**
+ * @brief 测试占位符与参数个数不一致时的输出
+ */
+TEST(DeferredLogTest, PlaceholderMismatchTest) {
+    EXPECT_EQ(formatDeferred("a={} b={}", 1), "a=1 b={}");
+    EXPECT_EQ(formatDeferred("a={}", 1, 2), "a=1 2");
+}
+
+/**
+ * @brief 测试参数放不进记录时改用堆上副本，内容完整
+ */
+TEST(DeferredLogTest, LongStringTest) {
+    const std::string long_text(1000, 'x');
+    EXPECT_EQ(formatDeferred("[{}] [{}]", long_text, std::string("tail")), "[" + long_text + "] [tail]");
+}
+
+/**
+ * @brief 测试写线程按提交顺序写出，Brief 同时写入两个文件、Detail 只写 detail 文件
+ */
+TEST(DeferredLogTest, LoggerRoutingTest) {
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "vft_deferred_log_test";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    const std::filesystem::path brief_path = directory / "brief.log";
+    const std::filesystem::path detail_path = directory / "detail.log";
+    {
+        Logger logger;
+        ASSERT_TRUE(logger.initialize(brief_path.string(), detail_path.string(), false));
+        logger.logDeferred(LogLevel::Brief, "飞行器飞行状态已存储到共享数据空间，数据来源: {}", std::string("flight_dynamics"));
+        logger.logDeferred(LogLevel::Detail, "飞行员线程更新 - 仿真时间: {}s, 步骤: {}", 1.25, 125);
+        logger.logBrief(LogLevel::Brief, "legacy message");
+        logger.setDetailEnabled(false);
+        EXPECT_FALSE(logger.isEnabled(LogLevel::Detail));
+        logger.logDetail(LogLevel::Detail, "suppressed");
+        logger.flush();
+    }
+
+    const auto brief_lines = readLines(brief_path);
+    const auto detail_lines = readLines(detail_path);
+    ASSERT_EQ(brief_lines.size(), 3u);   // 含初始化日志
+    ASSERT_EQ(detail_lines.size(), 5u);
+    EXPECT_TRUE(endsWith(brief_lines[1], "[Brief] 飞行器飞行状态已存储到共享数据空间，数据来源: flight_dynamics"));
+    EXPECT_TRUE(endsWith(brief_lines[2], "[Brief] legacy message"));
+    EXPECT_TRUE(endsWith(detail_lines[3], "[Detail] 飞行员线程更新 - 仿真时间: " + std::to_string(1.25) + "s, 步骤: 125"));
+    EXPECT_EQ(brief_lines[0].rfind("[", 0), 0u);
+    EXPECT_NE(brief_lines[0].find("] [Thread-"), std::string::npos);
+    std::filesystem::remove_all(directory);
+}
+
+/**
+ * @brief 测试日志未启用时 VFT_LOG_* 不对参数求值
+ */
+TEST(DeferredLogTest, DisabledSkipsArgumentsTest) {
+    ASSERT_EQ(VFT_SMF::globalLogger, nullptr);
+    evaluation_count = 0;
+    VFT_LOG_BRIEF("value: {}", countedValue());
+    VFT_LOG_DETAIL("value: {}", countedValue());
+    EXPECT_EQ(evaluation_count, 0);
+
+    // 运行期关闭 Detail：Brief 照常求值，Detail 不求值
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "vft_deferred_log_level_test";
+    std::filesystem::create_directories(directory);
+    VFT_SMF::initializeGlobalLogger((directory / "brief.log").string(), (directory / "detail.log").string(), false);
+    VFT_SMF::globalLogger->setDetailEnabled(false);
+    VFT_LOG_BRIEF("value: {}", countedValue());
+    VFT_LOG_DETAIL("value: {}", countedValue());
+    EXPECT_EQ(evaluation_count, 1);
+    VFT_SMF::globalLogger.reset();
+    std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,127 @@
+/**
+ * @file test_flight_dynamics_pipeline.cpp
+ * @brief 编译期特化飞行动力学流水线单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+
+// 包含被测试的头文件
+#include "../../../../src/E_FlightDynamics/FlightDynamicsPipeline.hpp"
+#include "../../../../src/E_FlightDynamics/B737/B737_FlightDynamicsModel_New.hpp"
+
+using namespace VFT_SMF::FlightDynamics;
+using VFT_SMF::GlobalSharedDataStruct::AircraftFlightState;
+using VFT_SMF::GlobalSharedDataStruct::AircraftSystemState;
+using VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState;
+
+/**
+ * @brief 流水线测试类
+ */
+class FlightDynamicsPipelineTest : public ::testing::Test {
+protected:
+    AircraftFlightState cruiseState() {
+        AircraftFlightState state;
+        state.latitude = 39.9083;
+        state.longitude = 116.3975;
+        state.altitude = 1000.0;
+        state.heading = 90.0;
+        state.pitch = 2.0;
+        state.airspeed = 120.0;
+        state.groundspeed = 120.0;
+        return state;
+    }
+
+    AircraftSystemState cruiseSystem() {
+        AircraftSystemState system_state;
+        system_state.current_throttle_position = 0.5;
+        system_state.current_landing_gear_deployed = 0.0;
+        system_state.current_elevator_deflection = 0.1;
+        return system_state;
+    }
+};
+
+/**
+ * @brief 测试预计算的惯量逆矩阵：含惯性积时 I·α 还原力矩
+ */
+TEST_F(FlightDynamicsPipelineTest, InverseInertiaTest) {
+    AircraftPhysicsParams params;
+    params.mass = 50000.0;
+    params.inertia_xx = 1.2e6;
+    params.inertia_yy = 2.5e6;
+    params.inertia_zz = 3.4e6;
+    params.inertia_xz = 0.1e6;
+    const SixAxisForces forces(5000.0, -200.0, 1000.0, 3.0e5, -1.0e5, 2.0e5);
+
+    const std::array<double, 6> a = InverseInertia(params).apply(forces);
+    EXPECT_DOUBLE_EQ(a[0], 0.1);
+    EXPECT_NEAR(params.inertia_xx * a[3] + params.inertia_xz * a[5], forces.moment_x, 1e-6);
+    EXPECT_NEAR(params.inertia_yy * a[4], forces.moment_y, 1e-6);
+    EXPECT_NEAR(params.inertia_xz * a[3] + params.inertia_zz * a[5], forces.moment_z, 1e-6);
+
+    // 静态接口与流水线共用同一实现
+    const std::array<double, 6> b = FlightDynamicsAgent::accelerationsFromForces(forces, params);
+    for (int i = 0; i < 6; ++i) {
+        EXPECT_DOUBLE_EQ(a[i], b[i]);
+    }
+}
+
+/**
+ * @brief 测试无扰动策略：逐步推进的加速度等于连续时间评估值，且两个代理逐位一致
+ */
+TEST_F(FlightDynamicsPipelineTest, NoNoisePolicyTest) {
+    FlightDynamicsAgent first("B737", false);
+    FlightDynamicsAgent second("B737", false);
+    first.initialize(cruiseState());
+    second.initialize(cruiseState());
+    const AircraftSystemState system_state = cruiseSystem();
+    const EnvironmentGlobalState env_state;
+
+    const std::array<double, 6> expected = first.evaluateAccelerations(cruiseState(), system_state, env_state);
+    const AircraftFlightState stepped = first.updateFromGlobalState(0.01, system_state, env_state);
+    EXPECT_DOUBLE_EQ(stepped.longitudinal_accel, expected[0]);
+    EXPECT_DOUBLE_EQ(stepped.vertical_accel, expected[2]);
+    EXPECT_DOUBLE_EQ(stepped.pitch_rate, expected[4] * 180.0 / M_PI * 0.01);
+
+    second.updateFromGlobalState(0.01, system_state, env_state);
+    for (int step = 0; step < 500; ++step) {
+        first.updateFromGlobalState(0.01, system_state, env_state);
+        second.updateFromGlobalState(0.01, system_state, env_state);
+    }
+    EXPECT_DOUBLE_EQ(first.getCurrentState().airspeed, second.getCurrentState().airspeed);
+    EXPECT_DOUBLE_EQ(first.getCurrentState().longitude, second.getCurrentState().longitude);
+}
+
+/**
+ * @brief 测试扰动策略与直接组合的流水线一致：代理只在场景边界经一次类型擦除
+ */
+TEST_F(FlightDynamicsPipelineTest, AgentMatchesPipelineTest) {
+    FlightDynamicsAgent agent("B737");
+    agent.initialize(cruiseState());
+    FlightDynamicsPipeline<B737FlightDynamicsModel> pipeline("B737");
+    AircraftFlightState state = cruiseState();
+    const AircraftSystemState system_state = cruiseSystem();
+    const EnvironmentGlobalState env_state;
+
+    PipelineStep result;
+    for (int step = 0; step < 100; ++step) {
+        const AircraftFlightState stepped = agent.updateFromGlobalState(0.01, system_state, env_state);
+        pipeline.stepWithInput(state, 0.01, system_state, env_state, result);
+        EXPECT_DOUBLE_EQ(stepped.airspeed, state.airspeed);
+        EXPECT_DOUBLE_EQ(stepped.vertical_speed, state.vertical_speed);
+        EXPECT_DOUBLE_EQ(stepped.pitch_rate, state.pitch_rate);
+        // 位置与姿态由代理推进，流水线只更新速度
+        state.pitch = stepped.pitch;
+        state.roll = stepped.roll;
+        state.altitude = stepped.altitude;
+    }
+    EXPECT_DOUBLE_EQ(agent.getCurrentForces().force_x, result.forces.force_x);
+
+    // 扰动量级：每轴标准差 0.001 m/s²
+    const std::array<double, 6> clean = agent.evaluateAccelerations(state, system_state, env_state);
+    pipeline.stepWithInput(state, 0.01, system_state, env_state, result);
+    EXPECT_NE(result.accelerations[0], clean[0]);
+    EXPECT_NEAR(result.accelerations[0], clean[0], 0.01);
+}
@@ -0,0 +1,210 @@
+/**
+ * @file test_instrumented_mutex.cpp
+ * @brief 带统计互斥锁单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+// 本翻译单元单独开启锁统计：只包含锁包装类（两种实现位于不同的内联命名空间），
+// 不包含内嵌这些锁的 DoubleBuffer、EventQueue、Logger 等头文件
+#define VFT_ENABLE_LOCK_STATS 1
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 包含被测试的头文件
+#include "../../../../src/G_SimulationManager/B_SimManage/InstrumentedMutex.hpp"
+
+using VFT_SMF::SimManage::InstrumentedConditionVariable;
+using VFT_SMF::SimManage::InstrumentedMutex;
+using VFT_SMF::SimManage::InstrumentedSharedMutex;
+using VFT_SMF::SimManage::InstrumentedUniqueLock;
+using VFT_SMF::SimManage::LockCounters;
+using VFT_SMF::SimManage::LockSiteStats;
+using VFT_SMF::SimManage::LockStats;
+
+namespace {
+    const LockSiteStats* findSite(const std::vector<LockSiteStats>& stats, const std::string& name) {
+        for (const auto& site : stats) {
+            if (site.name == name) return &site;
+        }
+        return nullptr;
+    }
+
+    const LockCounters* findThread(const LockSiteStats& site, const std::string& thread_name) {
+        for (const auto& entry : site.threads) {
+            if (entry.first == thread_name) return &entry.second;
+        }
+        return nullptr;
+    }
+
+    uint64_t histogramTotal(const uint64_t (&histogram)[VFT_SMF::SimManage::LOCK_HISTOGRAM_BUCKETS]) {
+        uint64_t total = 0;
+        for (uint64_t count : histogram) total += count;
+        return total;
+    }
+}
+
+/**
+ * @brief 测试直方图分桶
+ */
+TEST(InstrumentedMutexTest, HistogramBucketTest) {
+    EXPECT_EQ(LockStats::histogramBucket(0), 0);
+    EXPECT_EQ(LockStats::histogramBucket(1), 1);
+    EXPECT_EQ(LockStats::histogramBucket(1023), 10);
+    EXPECT_EQ(LockStats::histogramBucket(1024), 11);
+    EXPECT_EQ(LockStats::histogramBucket(~0ull), VFT_SMF::SimManage::LOCK_HISTOGRAM_BUCKETS - 1);
+}
+
+/**
+ * @brief 测试无竞争加锁：只计次数与持有时间，同名实例合并统计
+ */
+TEST(InstrumentedMutexTest, UncontendedAcquisitionTest) {
+    InstrumentedMutex first("Test.uncontended");
+    InstrumentedMutex second("Test.uncontended");
+    std::thread worker([&]() {
+        LockStats::tagCurrentThread("Uncontended_Thread");
+        for (int i = 0; i < 10; ++i) {
+            std::lock_guard<InstrumentedMutex> lock(i % 2 == 0 ? first : second);
+        }
+    });
+    worker.join();
+
+    const auto stats = LockStats::snapshot();
+    const LockSiteStats* site = findSite(stats, "Test.uncontended");
+    ASSERT_NE(site, nullptr);
+    EXPECT_EQ(site->totals.acquisitions, 10u);
+    EXPECT_EQ(site->totals.contended, 0u);
+    EXPECT_EQ(site->totals.wait_ns, 0u);
+    EXPECT_EQ(histogramTotal(site->totals.wait_histogram), 0u);
+    EXPECT_EQ(histogramTotal(site->totals.hold_histogram), 10u);
+
+    const LockCounters* thread = findThread(*site, "Uncontended_Thread");
+    ASSERT_NE(thread, nullptr);
+    EXPECT_EQ(thread->acquisitions, 10u);
+}
+
+/**
+ * @brief 测试同名线程（此处为两个未标记线程）在报告中合并为一行
+ */
+TEST(InstrumentedMutexTest, SameNameThreadsMergedTest) {
+    InstrumentedMutex mutex("Test.untagged_merge");
+    for (int t = 0; t < 2; ++t) {
+        std::thread worker([&]() {
+            for (int i = 0; i < 3; ++i) {
+                std::lock_guard<InstrumentedMutex> lock(mutex);
+            }
+        });
+        worker.join();
+    }
+
+    const auto stats = LockStats::snapshot();
+    const LockSiteStats* site = findSite(stats, "Test.untagged_merge");
+    ASSERT_NE(site, nullptr);
+    ASSERT_EQ(site->threads.size(), 1u);
+    EXPECT_EQ(site->threads[0].first, "untagged");
+    EXPECT_EQ(site->threads[0].second.acquisitions, 6u);
+}
+
+/**
+ * @brief 测试竞争加锁：等待方记一次竞争，等待时间不短于持有方的持有时间
+ */
+TEST(InstrumentedMutexTest, ContendedWaitTest) {
+    InstrumentedMutex mutex("Test.contended");
+    std::atomic<bool> held{false};
+
+    std::thread holder([&]() {
+        LockStats::tagCurrentThread("Holder_Thread");
+        std::lock_guard<InstrumentedMutex> lock(mutex);
+        held = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    });
+    while (!held) std::this_thread::yield();
+
+    std::thread waiter([&]() {
+        LockStats::tagCurrentThread("Waiter_Thread");
+        std::lock_guard<InstrumentedMutex> lock(mutex);
+    });
+    holder.join();
+    waiter.join();
+
+    const auto stats = LockStats::snapshot();
+    const LockSiteStats* site = findSite(stats, "Test.contended");
+    ASSERT_NE(site, nullptr);
+    EXPECT_EQ(site->totals.acquisitions, 2u);
+    EXPECT_EQ(site->totals.contended, 1u);
+
+    const LockCounters* holder_stats = findThread(*site, "Holder_Thread");
+    const LockCounters* waiter_stats = findThread(*site, "Waiter_Thread");
+    ASSERT_NE(holder_stats, nullptr);
+    ASSERT_NE(waiter_stats, nullptr);
+    EXPECT_EQ(holder_stats->contended, 0u);
+    EXPECT_GE(holder_stats->max_hold_ns, 15000000u);
+    EXPECT_EQ(waiter_stats->contended, 1u);
+    EXPECT_GT(waiter_stats->wait_ns, 0u);
+    EXPECT_EQ(histogramTotal(waiter_stats->wait_histogram), 1u);
+
+    // 等待时间最长的锁排在前面
+    EXPECT_EQ(stats.front().name, "Test.contended");
+    EXPECT_NE(LockStats::formatSummary().find("Waiter_Thread"), std::string::npos);
+}
+
+/**
+ * @brief 测试读写锁：共享加锁单独计数，共享持有时间按线程结算
+ */
+TEST(InstrumentedMutexTest, SharedMutexTest) {
+    InstrumentedSharedMutex mutex("Test.shared");
+    std::thread worker([&]() {
+        LockStats::tagCurrentThread("Shared_Thread");
+        for (int i = 0; i < 4; ++i) {
+            std::shared_lock<InstrumentedSharedMutex> lock(mutex);
+        }
+        {
+            std::shared_lock<InstrumentedSharedMutex> outer(mutex);
+            std::shared_lock<InstrumentedSharedMutex> inner(mutex);
+        }
+        std::unique_lock<InstrumentedSharedMutex> lock(mutex);
+    });
+    worker.join();
+
+    const auto stats = LockStats::snapshot();
+    const LockSiteStats* site = findSite(stats, "Test.shared");
+    ASSERT_NE(site, nullptr);
+    EXPECT_EQ(site->totals.acquisitions, 7u);
+    EXPECT_EQ(site->totals.shared_acquisitions, 6u);
+    EXPECT_EQ(site->totals.contended, 0u);
+    EXPECT_EQ(histogramTotal(site->totals.hold_histogram), 7u);
+}
+
+/**
+ * @brief 测试与条件变量配合使用
+ */
+TEST(InstrumentedMutexTest, ConditionVariableTest) {
+    InstrumentedMutex mutex("Test.condition");
+    InstrumentedConditionVariable ready_cv;
+    bool ready = false;
+
+    std::thread consumer([&]() {
+        InstrumentedUniqueLock lock(mutex);
+        ready_cv.wait(lock, [&]() { return ready; });
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    {
+        std::lock_guard<InstrumentedMutex> lock(mutex);
+        ready = true;
+    }
+    ready_cv.notify_one();
+    consumer.join();
+
+    const auto stats = LockStats::snapshot();
+    const LockSiteStats* site = findSite(stats, "Test.condition");
+    ASSERT_NE(site, nullptr);
+    // 消费方首次加锁、唤醒后重新加锁，生产方加锁一次
+    EXPECT_GE(site->totals.acquisitions, 3u);
+}
@@ -0,0 +1,164 @@
+/**
+ * @file test_landing_gear.cpp
+ * @brief 起落架地面接触模型单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+
+// 包含被测试的头文件
+#include "../../../../src/E_FlightDynamics/LandingGear.hpp"
+#include "../../../../src/E_FlightDynamics/FlightDynamicsAgent.hpp"
+
+using namespace VFT_SMF::FlightDynamics;
+using VFT_SMF::GlobalSharedDataStruct::AircraftFlightState;
+using VFT_SMF::GlobalSharedDataStruct::AircraftSystemState;
+using VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState;
+
+/**
+ * @brief 起落架测试类
+ */
+class LandingGearTest : public ::testing::Test {
+protected:
+    static constexpr double MASS = 45000.0;
+    static constexpr double WEIGHT = MASS * 9.81;
+    static constexpr double ELEVATION = 35.0;
+
+    GroundContactInput makeInput(double friction = 0.2, double brake = 0.0) {
+        GroundContactInput input;
+        input.runway_elevation = ELEVATION;
+        input.friction_coefficient = friction;
+        input.brake_ratio = brake;
+        input.gear_position = 1.0;
+        return input;
+    }
+
+    /**
+     * @brief 以与代理相同的半隐式欧拉推进垂直运动，返回落地后的高度历程峰谷
+     */
+    void dropTest(double dt, double duration, double& min_altitude, double& final_altitude, double& final_speed) {
+        const LandingGear gear = LandingGear::makeB737(MASS);
+        const GroundContactInput input = makeInput();
+        double altitude = ELEVATION + 0.5;
+        double vertical_speed = -3.0;
+        min_altitude = altitude;
+        for (int step = 0; step < static_cast<int>(duration / dt + 0.5); ++step) {
+            const GroundReaction reaction = gear.solve(altitude, vertical_speed, 0.0, -WEIGHT, 0.0, dt, input);
+            vertical_speed += (reaction.normal_force - WEIGHT) / MASS * dt;
+            altitude += vertical_speed * dt;
+            min_altitude = std::min(min_altitude, altitude);
+        }
+        final_altitude = altitude;
+        final_speed = vertical_speed;
+    }
+};
+
+/**
+ * @brief 测试静止平衡：跑道标高处支柱处于静压缩量，法向力恰好承担重力
+ */
+TEST_F(LandingGearTest, StaticEquilibriumTest) {
+    const LandingGear gear = LandingGear::makeB737(MASS);
+    EXPECT_NEAR(gear.getStaticCompression(LandingGear::NOSE), 0.15, 1e-12);
+    EXPECT_NEAR(gear.getStaticCompression(LandingGear::LEFT_MAIN), 0.15, 1e-12);
+
+    const GroundReaction reaction = gear.solve(ELEVATION, 0.0, 0.0, -WEIGHT, 0.0, 0.01, makeInput());
+    EXPECT_TRUE(reaction.on_ground);
+    EXPECT_NEAR(reaction.normal_force, WEIGHT, 1e-6 * WEIGHT);
+    EXPECT_NEAR(reaction.struts[LandingGear::NOSE].normal_force, 0.08 * WEIGHT, 1e-6 * WEIGHT);
+    EXPECT_NEAR(reaction.struts[LandingGear::LEFT_MAIN].normal_force,
+                reaction.struts[LandingGear::RIGHT_MAIN].normal_force, 1e-9);
+    EXPECT_NEAR(reaction.min_altitude, ELEVATION - 0.25, 1e-12);
+
+    // 离地高于静压缩量时无反力，起落架收起时由机体在跑道标高处刚性承载
+    EXPECT_FALSE(gear.solve(ELEVATION + 1.0, 0.0, 0.0, -WEIGHT, 0.0, 0.01, makeInput()).on_ground);
+    GroundContactInput retracted = makeInput();
+    retracted.gear_position = 0.0;
+    const GroundReaction belly = gear.solve(ELEVATION, 0.0, 0.0, -WEIGHT, 0.0, 0.01, retracted);
+    EXPECT_NEAR(belly.normal_force, WEIGHT, 1e-6);
+    EXPECT_DOUBLE_EQ(belly.min_altitude, ELEVATION);
+}
+
+/**
+ * @brief 测试隐式求解：以10倍步长接地仍稳定，且与小步长结果一致
+ */
+TEST_F(LandingGearTest, ImplicitStabilityTest) {
+    double fine_min, fine_final, fine_speed;
+    dropTest(0.01, 10.0, fine_min, fine_final, fine_speed);
+    EXPECT_NEAR(fine_final, ELEVATION, 1e-4);
+    EXPECT_NEAR(fine_speed, 0.0, 1e-4);
+    EXPECT_LT(fine_min, ELEVATION);
+    EXPECT_GT(fine_min, ELEVATION - 0.25);   // 未压到底
+
+    for (double dt : {0.05, 0.1}) {
+        double coarse_min, coarse_final, coarse_speed;
+        dropTest(dt, 10.0, coarse_min, coarse_final, coarse_speed);
+        EXPECT_NEAR(coarse_final, ELEVATION, 1e-4) << "dt=" << dt;
+        EXPECT_NEAR(coarse_speed, 0.0, 1e-4) << "dt=" << dt;
+        EXPECT_NEAR(coarse_min, fine_min, 0.05) << "dt=" << dt;
+    }
+
+    // 极大步长下法向力也不会越过平衡点振荡
+    double huge_min, huge_final, huge_speed;
+    dropTest(1.0, 20.0, huge_min, huge_final, huge_speed);
+    EXPECT_NEAR(huge_final, ELEVATION, 1e-3);
+}
+
+/**
+ * @brief 测试纵向摩擦：刹车摩擦随跑道摩擦系数变化，止动时不反向
+ */
+TEST_F(LandingGearTest, BrakingFrictionTest) {
+    const LandingGear gear = LandingGear::makeB737(MASS);
+
+    const GroundReaction dry = gear.solve(ELEVATION, 0.0, 20.0, -WEIGHT, 0.0, 0.01, makeInput(0.8, 1.0));
+    const GroundReaction wet = gear.solve(ELEVATION, 0.0, 20.0, -WEIGHT, 0.0, 0.01, makeInput(0.3, 1.0));
+    EXPECT_NEAR(dry.friction_force, (0.02 + 0.8 * 0.92) * WEIGHT, 1e-6 * WEIGHT);
+    EXPECT_NEAR(wet.friction_force, (0.02 + 0.3 * 0.92) * WEIGHT, 1e-6 * WEIGHT);
+    EXPECT_DOUBLE_EQ(dry.struts[LandingGear::NOSE].friction_force,
+                     0.02 * dry.struts[LandingGear::NOSE].normal_force);   // 前轮无刹车
+
+    // 刹停：止动所需的力小于摩擦上限时只取止动力，速度恰好降为0而不反向
+    const double slow = 0.05;
+    const GroundReaction stopping = gear.solve(ELEVATION, 0.0, slow, -WEIGHT, 0.0, 0.01, makeInput(0.8, 1.0));
+    EXPECT_NEAR(slow - stopping.friction_force / MASS * 0.01, 0.0, 1e-12);
+
+    // 驻车：慢车推力小于刹车摩擦时保持静止；松刹车后滚阻不足以阻止滑行
+    const double idle_thrust = 20000.0;
+    const GroundReaction parked = gear.solve(ELEVATION, 0.0, 0.0, -WEIGHT, idle_thrust, 0.01, makeInput(0.8, 1.0));
+    EXPECT_DOUBLE_EQ(parked.friction_force, idle_thrust);
+    const GroundReaction released = gear.solve(ELEVATION, 0.0, 0.0, -WEIGHT, idle_thrust, 0.01, makeInput(0.8, 0.0));
+    EXPECT_NEAR(released.friction_force, 0.02 * WEIGHT, 1e-6 * WEIGHT);
+}
+
+/**
+ * @brief 测试飞行动力学代理：读取环境跑道标高，5倍步长静止时无垂直振荡
+ */
+TEST_F(LandingGearTest, AgentRestsOnRunwayTest) {
+    AircraftFlightState initial;
+    initial.altitude = ELEVATION;
+    initial.airspeed = 0.0;
+    initial.vertical_speed = 0.0;
+
+    AircraftSystemState system_state;
+    system_state.current_landing_gear_deployed = 1.0;
+    system_state.current_throttle_position = 0.0;
+    EnvironmentGlobalState env_state;
+    env_state.runway_elevation = ELEVATION;
+    env_state.friction_coefficient = 0.8;
+
+    FlightDynamicsAgent agent("B737");
+    agent.initialize(initial);
+    double max_deviation = 0.0;
+    double max_vertical_accel = 0.0;
+    for (int step = 0; step < 400; ++step) {
+        const AircraftFlightState state = agent.updateFromGlobalState(0.05, system_state, env_state);
+        max_deviation = std::max(max_deviation, std::abs(state.altitude - ELEVATION));
+        max_vertical_accel = std::max(max_vertical_accel, std::abs(state.vertical_accel));
+    }
+    EXPECT_TRUE(agent.getGroundContact().on_ground);
+    EXPECT_LT(max_deviation, 1e-3);
+    EXPECT_LT(max_vertical_accel, 0.01);   // 仅剩代理注入的微小噪声
+    EXPECT_DOUBLE_EQ(agent.getCurrentState().roll, 0.0);
+}
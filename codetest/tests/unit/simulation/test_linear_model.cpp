@@ -0,0 +1,173 @@
+/**
+ * @file test_linear_model.cpp
+ * @brief 飞行动力学线性化与线性代理模型单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+
+// 包含被测试的头文件
+#include "../../../../src/E_FlightDynamics/LinearModel.hpp"
+
+using namespace VFT_SMF::FlightDynamics;
+using VFT_SMF::GlobalSharedDataStruct::AircraftFlightState;
+
+/**
+ * @brief 线性模型测试类
+ */
+class LinearModelTest : public ::testing::Test {
+protected:
+    TrimResult trim;
+
+    void SetUp() override {
+        TrimSolver solver;
+        TrimTarget target;
+        target.airspeed = 120.0;
+        target.altitude = 1000.0;
+        trim = solver.solve(target);
+        ASSERT_TRUE(trim.converged);
+    }
+};
+
+/**
+ * @brief 测试矩阵指数：对角矩阵与幂零矩阵的解析解
+ */
+TEST_F(LinearModelTest, MatrixExponentialTest) {
+    Matrix diagonal(2, 2);
+    diagonal(0, 0) = -40.0;
+    diagonal(1, 1) = 2.5;
+    const Matrix diagonal_exp = matrixExponential(diagonal);
+    EXPECT_NEAR(diagonal_exp(0, 0), std::exp(-40.0), 1e-25);
+    EXPECT_NEAR(diagonal_exp(1, 1) / std::exp(2.5), 1.0, 1e-12);
+    EXPECT_DOUBLE_EQ(diagonal_exp(0, 1), 0.0);
+
+    // exp([[0, t], [0, 0]]) = [[1, t], [0, 1]]
+    Matrix nilpotent(2, 2);
+    nilpotent(0, 1) = 3.0;
+    const Matrix nilpotent_exp = matrixExponential(nilpotent);
+    EXPECT_NEAR(nilpotent_exp(0, 0), 1.0, 1e-14);
+    EXPECT_NEAR(nilpotent_exp(0, 1), 3.0, 1e-13);
+    EXPECT_NEAR(nilpotent_exp(1, 0), 0.0, 1e-14);
+
+    // 旋转生成元：exp([[0, -w], [w, 0]]) 为旋转矩阵
+    Matrix rotation(2, 2);
+    rotation(0, 1) = -1.2;
+    rotation(1, 0) = 1.2;
+    const Matrix rotation_exp = matrixExponential(rotation);
+    EXPECT_NEAR(rotation_exp(0, 0), std::cos(1.2), 1e-13);
+    EXPECT_NEAR(rotation_exp(1, 0), std::sin(1.2), 1e-13);
+}
+
+/**
+ * @brief 测试配平点线性化：工作点导数为零，主要导数符号符合物理直觉
+ */
+TEST_F(LinearModelTest, LinearizeAtTrimTest) {
+    Linearizer linearizer;
+    const LinearModel model = linearizer.linearize(trim);
+
+    for (double value : model.derivative0) EXPECT_NEAR(value, 0.0, 1e-5);
+    EXPECT_LT(model.a(LinearModel::AIRSPEED, LinearModel::AIRSPEED), 0.0);     // 阻力随空速增大
+    EXPECT_GT(model.b(LinearModel::AIRSPEED, LinearModel::THROTTLE), 0.0);     // 推力随油门增大
+    EXPECT_LT(model.a(LinearModel::ROLL_RATE, LinearModel::ROLL_RATE), 0.0);   // 滚转阻尼
+    EXPECT_DOUBLE_EQ(model.a(LinearModel::ALTITUDE, LinearModel::VERTICAL_SPEED), 1.0);
+    EXPECT_NEAR(model.c(LinearModel::PITCH, LinearModel::PITCH), 1.0, 1e-9);
+    EXPECT_DOUBLE_EQ(model.c(LinearModel::LONGITUDINAL_ACCEL, LinearModel::AIRSPEED),
+                     model.a(LinearModel::AIRSPEED, LinearModel::AIRSPEED));
+    EXPECT_DOUBLE_EQ(model.d(LinearModel::LONGITUDINAL_ACCEL, LinearModel::THROTTLE),
+                     model.b(LinearModel::AIRSPEED, LinearModel::THROTTLE));
+}
+
+/**
+ * @brief 测试代理模型：零扰动保持工作点，小油门阶跃与非线性代理一致
+ */
+TEST_F(LinearModelTest, SurrogateMatchesNonlinearTest) {
+    Linearizer linearizer;
+    const LinearModel model = linearizer.linearize(trim);
+    LinearSurrogate surrogate(model, 0.01);
+
+    for (int step = 0; step < 1000; ++step) surrogate.step(model.input0);
+    EXPECT_NEAR(surrogate.getState()[LinearModel::AIRSPEED], 120.0, 1e-6);
+    EXPECT_NEAR(surrogate.getState()[LinearModel::ALTITUDE], 1000.0, 1e-4);
+
+    // 油门阶跃 +0.02，推进5秒
+    std::vector<double> input = model.input0;
+    input[LinearModel::THROTTLE] += 0.02;
+    VFT_SMF::GlobalSharedDataStruct::AircraftSystemState system_state = trim.system_state;
+    system_state.current_throttle_position = input[LinearModel::THROTTLE];
+
+    FlightDynamicsAgent agent("B737");
+    agent.initialize(trim.flight_state);
+    AircraftFlightState nonlinear = trim.flight_state;
+    surrogate.reset();
+    for (int step = 0; step < 500; ++step) {
+        nonlinear = agent.updateFromGlobalState(0.01, system_state, trim.env_state);
+        surrogate.step(input);
+    }
+    const AircraftFlightState linear = surrogate.getFlightState();
+
+    const double airspeed_change = nonlinear.airspeed - 120.0;
+    EXPECT_GT(airspeed_change, 0.1);
+    EXPECT_NEAR(linear.airspeed - 120.0, airspeed_change, 0.05 * airspeed_change + 0.02);
+    EXPECT_NEAR(linear.vertical_speed, nonlinear.vertical_speed, 0.05);
+    EXPECT_NEAR(linear.pitch, nonlinear.pitch, 0.05);
+}
+
+/**
+ * @brief 测试离散化：与连续模型细步长RK4积分一个离散步的结果一致
+ */
+TEST_F(LinearModelTest, DiscretizationTest) {
+    Linearizer linearizer;
+    const LinearModel model = linearizer.linearize(trim);
+    const double dt = 0.01;
+    LinearSurrogate surrogate(model, dt);
+
+    const size_t n = LinearModel::STATE_COUNT;
+    const size_t m = LinearModel::INPUT_COUNT;
+    auto integrate = [&](std::vector<double> x, const std::vector<double>& u) {
+        auto derivative = [&](const std::vector<double>& state) {
+            std::vector<double> result(n, 0.0);
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < n; ++j) result[i] += model.a(i, j) * state[j];
+                for (size_t j = 0; j < m; ++j) result[i] += model.b(i, j) * u[j];
+            }
+            return result;
+        };
+        const int substeps = 1000;
+        const double h = dt / substeps;
+        for (int step = 0; step < substeps; ++step) {
+            std::vector<double> tmp(n);
+            const auto k1 = derivative(x);
+            for (size_t i = 0; i < n; ++i) tmp[i] = x[i] + 0.5 * h * k1[i];
+            const auto k2 = derivative(tmp);
+            for (size_t i = 0; i < n; ++i) tmp[i] = x[i] + 0.5 * h * k2[i];
+            const auto k3 = derivative(tmp);
+            for (size_t i = 0; i < n; ++i) tmp[i] = x[i] + h * k3[i];
+            const auto k4 = derivative(tmp);
+            for (size_t i = 0; i < n; ++i) x[i] += h / 6.0 * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]);
+        }
+        return x;
+    };
+
+    // Ad 的第 j 列为 δx = e_j 的零输入响应，Bd 的第 j 列为 δu = e_j 的零状态响应
+    for (size_t j = 0; j < n; ++j) {
+        std::vector<double> x(n, 0.0);
+        x[j] = 1.0;
+        const auto reference = integrate(x, std::vector<double>(m, 0.0));
+        for (size_t i = 0; i < n; ++i) EXPECT_NEAR(surrogate.getAd()(i, j), reference[i], 1e-9 * std::max(1.0, std::abs(reference[i])));
+    }
+    for (size_t j = 0; j < m; ++j) {
+        std::vector<double> u(m, 0.0);
+        u[j] = 1.0;
+        const auto reference = integrate(std::vector<double>(n, 0.0), u);
+        for (size_t i = 0; i < n; ++i) EXPECT_NEAR(surrogate.getBd()(i, j), reference[i], 1e-9 * std::max(1.0, std::abs(reference[i])));
+    }
+
+    // 设置绝对状态后保持偏差
+    std::vector<double> state = model.state0;
+    state[LinearModel::ALTITUDE] += 10.0;
+    surrogate.setState(state);
+    surrogate.step(model.input0);
+    EXPECT_NEAR(surrogate.getState()[LinearModel::ALTITUDE], 1010.0, 1e-6);
+}
@@ -0,0 +1,149 @@
+/**
+ * @file test_local_tangent_frame.cpp
+ * @brief 局部切平面坐标系与切平面位置积分单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+
+// 包含被测试的头文件
+#include "../../../../src/E_FlightDynamics/LocalTangentFrame.hpp"
+#include "../../../../src/E_FlightDynamics/FlightDynamicsAgent.hpp"
+
+using namespace VFT_SMF::FlightDynamics;
+using VFT_SMF::GlobalSharedDataStruct::AircraftFlightState;
+
+/**
+ * @brief 切平面测试类
+ */
+class LocalTangentFrameTest : public ::testing::Test {
+protected:
+    const GeodeticPosition runway {39.9083, 116.3975, 35.0};
+
+    AircraftFlightState cruiseState() {
+        AircraftFlightState state;
+        state.latitude = runway.latitude;
+        state.longitude = runway.longitude;
+        state.altitude = 1000.0;
+        state.heading = 90.0;
+        state.airspeed = 120.0;
+        state.groundspeed = 120.0;
+        return state;
+    }
+};
+
+/**
+ * @brief 测试大地坐标与切平面坐标互转
+ */
+TEST_F(LocalTangentFrameTest, RoundTripTest) {
+    const LocalTangentFrame frame(runway);
+
+    const NedPosition anchor = frame.toNed(runway);
+    EXPECT_NEAR(anchor.north, 0.0, 1e-9);
+    EXPECT_NEAR(anchor.east, 0.0, 1e-9);
+    EXPECT_NEAR(anchor.down, 0.0, 1e-9);
+
+    const NedPosition point(12000.0, -34000.0, -9000.0);
+    const NedPosition back = frame.toNed(frame.toGeodetic(point));
+    EXPECT_NEAR(back.north, point.north, 1e-6);
+    EXPECT_NEAR(back.east, point.east, 1e-6);
+    EXPECT_NEAR(back.down, point.down, 1e-6);
+
+    // 极区与赤道附近的 ECEF 往返
+    for (const GeodeticPosition& position : {GeodeticPosition(89.99, -45.0, 3000.0), GeodeticPosition(-0.001, 179.9, -50.0)}) {
+        const GeodeticPosition result = LocalTangentFrame::ecefToGeodetic(LocalTangentFrame::geodeticToEcef(position));
+        EXPECT_NEAR(result.latitude, position.latitude, 1e-11);
+        EXPECT_NEAR(result.longitude, position.longitude, 1e-11);
+        EXPECT_NEAR(result.altitude, position.altitude, 1e-6);
+    }
+}
+
+/**
+ * @brief 测试锚点附近的尺度与曲率半径一致
+ */
+TEST_F(LocalTangentFrameTest, LocalScaleTest) {
+    const LocalTangentFrame frame(runway);
+    const double deg = M_PI / 180.0;
+
+    const GeodeticPosition north = frame.toGeodetic(NedPosition(1.0, 0.0, 0.0));
+    EXPECT_NEAR((north.latitude - runway.latitude) * deg * (frame.getMeridianRadius() + runway.altitude), 1.0, 1e-6);
+
+    const GeodeticPosition east = frame.toGeodetic(NedPosition(0.0, 1.0, 0.0));
+    EXPECT_NEAR((east.longitude - runway.longitude) * deg *
+                (frame.getPrimeVerticalRadius() + runway.altitude) * std::cos(runway.latitude * deg), 1.0, 1e-6);
+
+    // 切平面在 1 km 处高出椭球面约 d²/2R
+    EXPECT_NEAR(frame.toGeodetic(NedPosition(1000.0, 0.0, 0.0)).altitude - runway.altitude, 0.0785, 0.001);
+}
+
+/**
+ * @brief 测试切平面积分：远离锚点后的等航向飞行，重新锚定前后轨迹连续、沿等角航线
+ */
+TEST_F(LocalTangentFrameTest, AgentReanchorTest) {
+    FlightDynamicsAgent coarse("B737");
+    FlightDynamicsAgent fine("B737");
+    FlightDynamicsAgent spherical("B737");
+    coarse.setPositionIntegration(PositionIntegration::LocalTangent, 5000.0);
+    fine.setPositionIntegration(PositionIntegration::LocalTangent, 500.0);
+    spherical.setPositionIntegration(PositionIntegration::Spherical, 20000.0);
+    coarse.initialize(cruiseState());
+    fine.initialize(cruiseState());
+    spherical.initialize(cruiseState());
+
+    AircraftFlightState a, b, c;
+    double path = 0.0;
+    for (int step = 0; step < 60000; ++step) {
+        a = coarse.update(0.01);
+        b = fine.update(0.01);
+        c = spherical.update(0.01);
+        path += a.groundspeed * 0.01;
+    }
+    ASSERT_GT(path, 15000.0);
+    a = coarse.getCurrentState();
+    b = fine.getCurrentState();
+    EXPECT_GE(coarse.getReanchorCount(), 2);
+    EXPECT_GT(fine.getReanchorCount(), 10 * coarse.getReanchorCount());
+
+    // 两种锚定距离的结果在米级以内一致
+    const LocalTangentFrame frame(GeodeticPosition(b.latitude, b.longitude, b.altitude));
+    const NedPosition offset = frame.toNed(GeodeticPosition(a.latitude, a.longitude, b.altitude));
+    EXPECT_LT(std::hypot(offset.north, offset.east), 1.0);
+
+    // 与球面近似相比只差地球模型带来的千分之几
+    const NedPosition spherical_offset = frame.toNed(GeodeticPosition(c.latitude, c.longitude, b.altitude));
+    EXPECT_LT(std::hypot(spherical_offset.north, spherical_offset.east), 0.005 * path);
+    EXPECT_DOUBLE_EQ(a.altitude, c.altitude);
+}
+
+/**
+ * @brief 测试按需换算：update 只发布切平面位置，读端换算的经纬度与代理查询一致
+ */
+TEST_F(LocalTangentFrameTest, LazyGeodeticTest) {
+    FlightDynamicsAgent agent("B737");
+    agent.initialize(cruiseState());
+
+    AircraftFlightState published;
+    for (int step = 0; step < 1000; ++step) {
+        published = agent.update(0.01);
+    }
+    EXPECT_TRUE(published.geodetic_stale);
+    EXPECT_DOUBLE_EQ(published.longitude, runway.longitude);   // 步内未换算
+    EXPECT_DOUBLE_EQ(published.anchor_longitude, runway.longitude);
+
+    const AircraftFlightState queried = agent.getCurrentState();
+    EXPECT_FALSE(queried.geodetic_stale);
+    EXPECT_GT(queried.longitude, runway.longitude);
+
+    GeodeticResolver resolver;
+    const AircraftFlightState resolved = resolver.resolved(published);
+    EXPECT_FALSE(resolved.geodetic_stale);
+    EXPECT_DOUBLE_EQ(resolved.latitude, queried.latitude);
+    EXPECT_DOUBLE_EQ(resolved.longitude, queried.longitude);
+    EXPECT_DOUBLE_EQ(resolved.altitude, queried.altitude);
+
+    const NedPosition local = agent.getLocalPosition();
+    EXPECT_DOUBLE_EQ(local.east, published.local_east);
+    EXPECT_NEAR(local.east, 1000.0 * 0.01 * 0.5 * (120.0 + published.groundspeed), 50.0);
+}
@@ -0,0 +1,164 @@
+/**
+ * @file test_metrics_server.cpp
+ * @brief 运行指标与本机指标端点单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+// 包含被测试的头文件
+#include "../../../../src/G_SimulationManager/B_SimManage/MetricsServer.hpp"
+#include "../../../../src/G_SimulationManager/B_SimManage/SimulationMetrics.hpp"
+#include "../../../../src/E_GlobalSharedDataSpace/GlobalSharedDataSpace.hpp"
+
+using VFT_SMF::GlobalShared_DataSpace::GlobalSharedDataSpace;
+using VFT_SMF::GlobalSharedDataStruct::ThreadSyncState;
+using VFT_SMF::SimManage::LatencyHistogram;
+using VFT_SMF::SimManage::MetricsServer;
+using VFT_SMF::SimManage::SimulationMetrics;
+
+namespace {
+    /**
+     * @brief 向本机端口发送一次 HTTP 请求，返回完整应答
+     */
+    std::string httpGet(uint16_t port, const std::string& path) {
+#ifdef _WIN32
+        WSADATA wsa_data;
+        WSAStartup(MAKEWORD(2, 2), &wsa_data);
+        SOCKET client = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+#else
+        int client = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+#endif
+        sockaddr_in address;
+        std::memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = htons(port);
+        std::string response;
+        if (connect(client, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0) {
+            const std::string request = "GET " + path + " HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n";
+            send(client, request.data(), static_cast<int>(request.size()), 0);
+            char buffer[4096];
+            int received = 0;
+            while ((received = static_cast<int>(recv(client, buffer, sizeof(buffer), 0))) > 0) {
+                response.append(buffer, static_cast<size_t>(received));
+            }
+        }
+#ifdef _WIN32
+        closesocket(client);
+        WSACleanup();
+#else
+        close(client);
+#endif
+        return response;
+    }
+}
+
+/**
+ * @brief 测试耗时直方图的分位数估计
+ */
+TEST(MetricsServerTest, LatencyHistogramQuantileTest) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.quantileNanos(0.5), 0u);
+
+    // 1 µs 到 1000 µs 均匀分布
+    for (uint64_t us = 1; us <= 1000; ++us) {
+        histogram.record(us * 1000);
+    }
+    EXPECT_EQ(histogram.count(), 1000u);
+    EXPECT_EQ(histogram.maxNanos(), 1000000u);
+    EXPECT_EQ(histogram.sumNanos(), 500500000u);
+    EXPECT_NEAR(static_cast<double>(histogram.quantileNanos(0.5)), 500000.0, 500000.0 * 0.15);
+    EXPECT_NEAR(static_cast<double>(histogram.quantileNanos(0.99)), 990000.0, 990000.0 * 0.15);
+    EXPECT_LE(histogram.quantileNanos(0.99), histogram.maxNanos());
+
+    // 桶下界单调，且与分桶一致
+    for (int index = 1; index < LatencyHistogram::BUCKETS; ++index) {
+        EXPECT_GT(LatencyHistogram::bucketLowerBound(index), LatencyHistogram::bucketLowerBound(index - 1));
+        EXPECT_EQ(LatencyHistogram::bucketIndex(LatencyHistogram::bucketLowerBound(index)), index);
+    }
+}
+
+/**
+ * @brief 测试请求路由
+ */
+TEST(MetricsServerTest, BuildResponseTest) {
+    const MetricsServer::RenderFunction render = []() { return std::string("vft_test 1\n"); };
+
+    const std::string ok = MetricsServer::buildResponse("GET /metrics HTTP/1.1\r\nHost: x\r\n\r\n", render);
+    EXPECT_EQ(ok.rfind("HTTP/1.1 200 OK\r\n", 0), 0u);
+    EXPECT_NE(ok.find("Content-Type: text/plain; version=0.0.4"), std::string::npos);
+    EXPECT_NE(ok.find("Content-Length: 11\r\n"), std::string::npos);
+    EXPECT_EQ(ok.substr(ok.size() - 11), "vft_test 1\n");
+
+    EXPECT_EQ(MetricsServer::buildResponse("GET /metrics?x=1 HTTP/1.1\r\n\r\n", render).rfind("HTTP/1.1 200", 0), 0u);
+    EXPECT_EQ(MetricsServer::buildResponse("GET / HTTP/1.1\r\n\r\n", render).rfind("HTTP/1.1 404", 0), 0u);
+    EXPECT_EQ(MetricsServer::buildResponse("POST /metrics HTTP/1.1\r\n\r\n", render).rfind("HTTP/1.1 405", 0), 0u);
+}
+
+/**
+ * @brief 测试由共享数据空间与事件队列维护的计数
+ */
+TEST(MetricsServerTest, RenderSimulationMetricsTest) {
+    auto shared_data_space = std::make_unique<GlobalSharedDataSpace>();
+    ASSERT_TRUE(shared_data_space->registerThread("metrics_test_thread", "Metrics_Test_Thread", "test"));
+    for (int step = 0; step < 3; ++step) {
+        shared_data_space->updateThreadState("metrics_test_thread", ThreadSyncState::RUNNING);
+        shared_data_space->updateThreadState("metrics_test_thread", ThreadSyncState::COMPLETED);
+    }
+
+    VFT_SMF::GlobalSharedDataStruct::StandardEvent event;
+    event.event_name = "metrics_test_event";
+    shared_data_space->enqueueEvent(event, 1.0);
+    shared_data_space->enqueueEvent(event, 2.0);
+    VFT_SMF::GlobalSharedDataStruct::EventQueueItem item;
+    ASSERT_TRUE(shared_data_space->dequeueEvent(item));
+
+    const std::string text = SimulationMetrics::render(nullptr, shared_data_space.get(), nullptr, nullptr);
+    EXPECT_NE(text.find("# TYPE vft_agent_step_latency_seconds summary\n"), std::string::npos);
+    EXPECT_NE(text.find("vft_agent_step_latency_seconds_count{thread=\"Metrics_Test_Thread\"} 3\n"), std::string::npos);
+    EXPECT_NE(text.find("vft_agent_step_latency_seconds{thread=\"Metrics_Test_Thread\",quantile=\"0.99\"}"), std::string::npos);
+    EXPECT_NE(text.find("vft_event_queue_enqueued_total 2\n"), std::string::npos);
+    EXPECT_NE(text.find("vft_event_queue_dequeued_total 1\n"), std::string::npos);
+    EXPECT_NE(text.find("vft_event_queue_depth 1\n"), std::string::npos);
+    EXPECT_EQ(text.find("vft_sim_steps_total"), std::string::npos);   // 未提供时钟
+
+    shared_data_space->unregisterThread("metrics_test_thread");
+}
+
+/**
+ * @brief 测试端点在本机回环地址上应答
+ */
+TEST(MetricsServerTest, ServeOverLoopbackTest) {
+    MetricsServer server;
+    std::string error;
+    ASSERT_TRUE(server.start(0, []() { return std::string("vft_test_metric 42\n"); }, error)) << error;
+    ASSERT_NE(server.getPort(), 0);
+
+    const std::string response = httpGet(server.getPort(), "/metrics");
+    EXPECT_EQ(response.rfind("HTTP/1.1 200 OK", 0), 0u);
+    EXPECT_NE(response.find("\r\n\r\nvft_test_metric 42\n"), std::string::npos);
+    EXPECT_EQ(httpGet(server.getPort(), "/other").rfind("HTTP/1.1 404", 0), 0u);
+    EXPECT_EQ(server.getRequestCount(), 2u);
+
+    // 同一端口不能重复绑定
+    MetricsServer second;
+    EXPECT_FALSE(second.start(server.getPort(), []() { return std::string(); }, error));
+
+    server.stop();
+    EXPECT_FALSE(server.isRunning());
+}
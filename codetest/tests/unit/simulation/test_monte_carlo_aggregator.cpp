@@ -0,0 +1,253 @@
+/**
+ * @file test_monte_carlo_aggregator.cpp
+ * @brief 流式统计量与蒙特卡洛汇总器单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 包含被测试的头文件
+#include "../../../../src/G_SimulationManager/LogAndData/MonteCarloAggregator.hpp"
+
+using namespace VFT_SMF::MonteCarlo;
+
+/**
+ * @brief 蒙特卡洛汇总器测试类
+ */
+class MonteCarloAggregatorTest : public ::testing::Test {
+protected:
+    std::filesystem::path test_directory;
+
+    void SetUp() override {
+        test_directory = std::filesystem::temp_directory_path() / "vft_montecarlo_test";
+        std::filesystem::remove_all(test_directory);
+        std::filesystem::create_directories(test_directory);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(test_directory);
+    }
+
+    /**
+     * @brief 模拟一次运行：groundspeed 随时间线性增长，斜率由运行ID决定
+     */
+    static void simulateRun(MonteCarloAggregator& aggregator, uint32_t run_id) {
+        aggregator.beginRun(run_id);
+        for (int step = 0; step <= 100; ++step) {
+            const double t = step * 0.01;
+            aggregator.recordSample(0, t, (1.0 + run_id) * t);
+        }
+        aggregator.recordKpi("stop_distance", 100.0 + run_id);
+        aggregator.endRun();
+    }
+};
+
+/**
+ * @brief 测试Welford累计与分组合并结果一致
+ */
+TEST_F(MonteCarloAggregatorTest, RunningStatisticsMergeTest) {
+    std::mt19937 generator(7);
+    std::normal_distribution<double> normal(5.0, 2.0);
+    RunningStatistics all, left, right;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        const double value = normal(generator);
+        all.add(value, i);
+        (i % 3 == 0 ? left : right).add(value, i);
+    }
+    left.merge(right);
+    EXPECT_EQ(left.count, all.count);
+    EXPECT_NEAR(left.mean, all.mean, 1e-12);
+    EXPECT_NEAR(left.variance(), all.variance(), 1e-9);
+    EXPECT_EQ(left.min, all.min);
+    EXPECT_EQ(left.min_run, all.min_run);
+    EXPECT_EQ(left.max_run, all.max_run);
+}
+
+/**
+ * @brief 测试t-digest分位数精度与有界质心数
+ */
+TEST_F(MonteCarloAggregatorTest, TDigestQuantileAccuracyTest) {
+    std::mt19937 generator(11);
+    std::uniform_real_distribution<double> uniform(0.0, 1000.0);
+    TDigest digest(100.0), first_half(100.0), second_half(100.0);
+    std::vector<double> values;
+    for (int i = 0; i < 50000; ++i) {
+        const double value = uniform(generator);
+        values.push_back(value);
+        digest.add(value);
+        (i < 25000 ? first_half : second_half).add(value);
+    }
+    digest.compress();
+    first_half.merge(second_half);
+    std::sort(values.begin(), values.end());
+
+    EXPECT_LT(digest.centroidCount(), 200u);
+    for (double q : {0.01, 0.05, 0.5, 0.95, 0.99}) {
+        const double exact = values[static_cast<size_t>(q * (values.size() - 1))];
+        EXPECT_NEAR(digest.quantile(q), exact, 5.0) << "q=" << q;
+        EXPECT_NEAR(first_half.quantile(q), exact, 5.0) << "merged q=" << q;
+    }
+    EXPECT_DOUBLE_EQ(digest.quantile(0.0), values.front());
+    EXPECT_DOUBLE_EQ(digest.quantile(1.0), values.back());
+}
+
+/**
+ * @brief 测试逐时间点与KPI汇总，以及极值所属运行ID
+ */
+TEST_F(MonteCarloAggregatorTest, TimestepAndKpiSummaryTest) {
+    MonteCarloAggregator aggregator;
+    ASSERT_TRUE(aggregator.initialize("groundspeed,not_a_channel", 0.1));
+    ASSERT_EQ(aggregator.getChannelNames().size(), 1u);
+
+    for (uint32_t run = 0; run < 5; ++run) simulateRun(aggregator, run);
+    EXPECT_EQ(aggregator.getCompletedRuns(), 5u);
+    EXPECT_EQ(aggregator.getTimestepCount(0), 11u);
+
+    const Summary* at_one_second = aggregator.getTimestepSummary(0, 10);
+    ASSERT_NE(at_one_second, nullptr);
+    EXPECT_EQ(at_one_second->statistics.count, 5u);
+    EXPECT_NEAR(at_one_second->statistics.mean, 3.0, 1e-9);
+    EXPECT_EQ(at_one_second->statistics.max_run, 4u);
+
+    const Summary* stop_distance = aggregator.getKpiSummary("stop_distance");
+    ASSERT_NE(stop_distance, nullptr);
+    EXPECT_NEAR(stop_distance->statistics.mean, 102.0, 1e-9);
+    EXPECT_EQ(stop_distance->statistics.min_run, 0u);
+    ASSERT_NE(aggregator.getKpiSummary("groundspeed.max"), nullptr);
+}
+
+/**
+ * @brief 测试状态保存/载入累计与并行汇总器合并
+ */
+TEST_F(MonteCarloAggregatorTest, StatePersistenceAndMergeTest) {
+    const std::string state_file = (test_directory / "state.bin").string();
+
+    // 逐进程累计：每次载入状态、并入一次运行、写回
+    for (uint32_t run = 0; run < 4; ++run) {
+        MonteCarloAggregator per_process;
+        ASSERT_TRUE(per_process.initialize("groundspeed", 0.1));
+        per_process.loadState(state_file);
+        simulateRun(per_process, run);
+        ASSERT_TRUE(per_process.saveState(state_file));
+    }
+
+    // 两个并行汇总器合并
+    MonteCarloAggregator worker_a, worker_b;
+    ASSERT_TRUE(worker_a.initialize("groundspeed", 0.1));
+    ASSERT_TRUE(worker_b.initialize("groundspeed", 0.1));
+    simulateRun(worker_a, 0);
+    simulateRun(worker_a, 1);
+    simulateRun(worker_b, 2);
+    simulateRun(worker_b, 3);
+    ASSERT_TRUE(worker_a.merge(worker_b));
+
+    MonteCarloAggregator reloaded;
+    ASSERT_TRUE(reloaded.initialize("groundspeed", 0.1));
+    ASSERT_TRUE(reloaded.loadState(state_file));
+    EXPECT_EQ(reloaded.getCompletedRuns(), 4u);
+    EXPECT_EQ(worker_a.getCompletedRuns(), 4u);
+    EXPECT_NEAR(reloaded.getKpiSummary("stop_distance")->statistics.mean,
+                worker_a.getKpiSummary("stop_distance")->statistics.mean, 1e-12);
+    EXPECT_NEAR(reloaded.getTimestepSummary(0, 5)->statistics.variance(),
+                worker_a.getTimestepSummary(0, 5)->statistics.variance(), 1e-12);
+
+    // 通道不一致的状态文件不会被载入
+    MonteCarloAggregator mismatched;
+    ASSERT_TRUE(mismatched.initialize("latitude", 0.1));
+    EXPECT_FALSE(mismatched.loadState(state_file));
+
+    ASSERT_TRUE(reloaded.writeSummary(test_directory.string()));
+    std::ifstream kpi_file(test_directory / "montecarlo_kpi_summary.csv");
+    std::string header;
+    std::getline(kpi_file, header);
+    EXPECT_EQ(header, "kpi,count,mean,stddev,min,min_run,max,max_run,p05,p50,p95");
+}
+
+/**
+ * @brief 测试多个并行工作者共用同一状态文件：持锁并入，不互相覆盖
+ */
+TEST_F(MonteCarloAggregatorTest, ConcurrentMergeIntoStateTest) {
+    const std::string state_file = (test_directory / "shared" / "state.bin").string();
+    const uint32_t worker_count = 8;
+
+    std::vector<std::thread> workers;
+    std::vector<int> merged(worker_count, 0);
+    for (uint32_t worker = 0; worker < worker_count; ++worker) {
+        workers.emplace_back([&, worker]() {
+            MonteCarloAggregator aggregator;
+            aggregator.initialize("groundspeed", 0.1);
+            simulateRun(aggregator, worker);
+            merged[worker] = aggregator.mergeIntoState(state_file) ? 1 : 0;
+        });
+    }
+    for (auto& worker : workers) worker.join();
+    for (uint32_t worker = 0; worker < worker_count; ++worker) EXPECT_EQ(merged[worker], 1);
+
+    MonteCarloAggregator reloaded;
+    ASSERT_TRUE(reloaded.initialize("groundspeed", 0.1));
+    ASSERT_TRUE(reloaded.loadState(state_file));
+    EXPECT_EQ(reloaded.getCompletedRuns(), worker_count);
+    const Summary* stop_distance = reloaded.getKpiSummary("stop_distance");
+    ASSERT_NE(stop_distance, nullptr);
+    EXPECT_EQ(stop_distance->statistics.count, worker_count);
+    EXPECT_DOUBLE_EQ(stop_distance->statistics.min, 100.0);
+    EXPECT_DOUBLE_EQ(stop_distance->statistics.max, 100.0 + worker_count - 1);
+
+    // 不一致的状态文件不被覆盖
+    MonteCarloAggregator mismatched;
+    ASSERT_TRUE(mismatched.initialize("latitude", 0.1));
+    EXPECT_FALSE(mismatched.mergeIntoState(state_file));
+    ASSERT_TRUE(reloaded.loadState(state_file));
+    EXPECT_EQ(reloaded.getCompletedRuns(), worker_count);
+}
+
+/**
+ * @brief 测试截断或计数被篡改的状态文件被拒绝，且不改变汇总器状态
+ */
+TEST_F(MonteCarloAggregatorTest, CorruptStateRejectedTest) {
+    const auto state_file = test_directory / "state.bin";
+    {
+        MonteCarloAggregator aggregator;
+        ASSERT_TRUE(aggregator.initialize("groundspeed", 0.1));
+        simulateRun(aggregator, 0);
+        ASSERT_TRUE(aggregator.saveState(state_file.string()));
+    }
+    std::string content;
+    {
+        std::ifstream in(state_file, std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    // 截断
+    const auto truncated = test_directory / "truncated.bin";
+    std::ofstream(truncated, std::ios::binary) << content.substr(0, content.size() / 2);
+    MonteCarloAggregator reader;
+    ASSERT_TRUE(reader.initialize("groundspeed", 0.1));
+    EXPECT_FALSE(reader.loadState(truncated.string()));
+    EXPECT_EQ(reader.getCompletedRuns(), 0u);
+
+    // 时间点数被改为超大值（魔数8 + 运行数8 + 采样间隔/两个压缩参数24 + 通道数4 + 名称长度4 + "groundspeed"）
+    const size_t bin_count_offset = 8 + 8 + 24 + 4 + 4 + std::string("groundspeed").size();
+    std::string corrupted = content;
+    const uint32_t huge = 0xFFFFFFF0u;
+    std::memcpy(&corrupted[bin_count_offset], &huge, sizeof(huge));
+    const auto corrupted_file = test_directory / "corrupted.bin";
+    std::ofstream(corrupted_file, std::ios::binary) << corrupted;
+    EXPECT_FALSE(reader.loadState(corrupted_file.string()));
+    EXPECT_EQ(reader.getCompletedRuns(), 0u);
+
+    EXPECT_TRUE(reader.loadState(state_file.string()));
+    EXPECT_EQ(reader.getCompletedRuns(), 1u);
+}
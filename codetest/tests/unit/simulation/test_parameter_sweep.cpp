@@ -0,0 +1,268 @@
+/**
+ * @file test_parameter_sweep.cpp
+ * @brief 参数扫描（试验设计）引擎单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+// 包含被测试的头文件
+#include "../../../../src/F_ScenarioModelling/C_ParameterSweep/ParameterSweep.hpp"
+#include "../../../../src/G_SimulationManager/LogAndData/DataRecorder.hpp"
+
+using namespace VFT_SMF::ParameterSweep;
+
+/**
+ * @brief 参数扫描测试类
+ */
+class ParameterSweepTest : public ::testing::Test {
+protected:
+    std::filesystem::path test_directory;
+
+    void SetUp() override {
+        test_directory = std::filesystem::temp_directory_path() / "vft_parameter_sweep_test";
+        std::filesystem::remove_all(test_directory);
+        std::filesystem::create_directories(test_directory);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(test_directory);
+    }
+
+    static void writeFile(const std::filesystem::path& path, const std::string& content) {
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream(path) << content;
+    }
+
+    static nlohmann::json readJson(const std::filesystem::path& path) {
+        nlohmann::json document;
+        std::ifstream(path) >> document;
+        return document;
+    }
+
+    static SampleResult makeResult(std::vector<double> unit, bool passed) {
+        SampleResult result;
+        result.point.unit = std::move(unit);
+        result.exit_code = 0;
+        result.has_outcome = true;
+        result.passed = passed;
+        return result;
+    }
+};
+
+/**
+ * @brief 测试Sobol序列前几个点与参考值一致
+ */
+TEST_F(ParameterSweepTest, SobolSequenceTest) {
+    SobolSequence sequence(3);
+    const std::vector<std::vector<double>> expected = {
+        {0.5, 0.5, 0.5}, {0.75, 0.25, 0.25}, {0.25, 0.75, 0.75}, {0.375, 0.375, 0.625}
+    };
+    for (const auto& point : expected) {
+        const auto actual = sequence.next();
+        ASSERT_EQ(actual.size(), point.size());
+        for (size_t d = 0; d < point.size(); ++d) {
+            EXPECT_DOUBLE_EQ(actual[d], point[d]);
+        }
+    }
+
+    // 前 2^k 个点在每维的 2^k 等分区间中各出现一次（含原点的完整网，去掉原点后剩 2^k-1 个区间被占满）
+    const auto samples = generateSobol(SobolSequence::MAX_DIMENSIONS, 63);
+    for (size_t d = 0; d < SobolSequence::MAX_DIMENSIONS; ++d) {
+        std::set<int> bins;
+        for (const auto& sample : samples) bins.insert(static_cast<int>(sample[d] * 64));
+        EXPECT_EQ(bins.size(), 63u) << "dimension " << d;
+        EXPECT_EQ(bins.count(0), 0u);
+    }
+}
+
+/**
+ * @brief 测试拉丁超立方每维每层恰好一个样本，且同种子可复现
+ */
+TEST_F(ParameterSweepTest, LatinHypercubeStratificationTest) {
+    const size_t count = 20;
+    const auto samples = generateLatinHypercube(4, count, 7);
+    ASSERT_EQ(samples.size(), count);
+    for (size_t d = 0; d < 4; ++d) {
+        std::vector<int> strata;
+        for (const auto& sample : samples) {
+            ASSERT_GE(sample[d], 0.0);
+            ASSERT_LT(sample[d], 1.0);
+            strata.push_back(static_cast<int>(sample[d] * count));
+        }
+        std::sort(strata.begin(), strata.end());
+        for (size_t i = 0; i < count; ++i) EXPECT_EQ(strata[i], static_cast<int>(i));
+    }
+    EXPECT_EQ(generateLatinHypercube(4, count, 7), samples);
+    EXPECT_NE(generateLatinHypercube(4, count, 8), samples);
+}
+
+/**
+ * @brief 测试全因子设计规模与参数取值映射
+ */
+TEST_F(ParameterSweepTest, FullFactorialAndValueMappingTest) {
+    ParameterDefinition speed;
+    speed.min_value = 0.0;
+    speed.max_value = 10.0;
+    speed.levels = 3;
+    ParameterDefinition pilot;
+    pilot.values = {"Pilot_001", "Pilot_002"};
+    ParameterDefinition brake;
+    brake.min_value = 700.0;
+    brake.max_value = 1100.0;
+    brake.integer = true;
+    brake.levels = 1;
+    brake.value_template = "distance > {value} || atc_brake_command_received";
+
+    const auto samples = generateFullFactorial({speed, pilot, brake});
+    ASSERT_EQ(samples.size(), 6u);
+    std::set<std::string> combinations;
+    for (const auto& sample : samples) {
+        combinations.insert(speed.valueAt(sample[0]).dump() + "|" + pilot.valueAt(sample[1]).dump());
+        EXPECT_EQ(brake.valueAt(sample[2]), "distance > 900 || atc_brake_command_received");
+    }
+    EXPECT_EQ(combinations.size(), 6u);
+    EXPECT_DOUBLE_EQ(speed.valueAt(1.0).get<double>(), 10.0);
+    EXPECT_EQ(pilot.valueAt(1.0), "Pilot_002");
+}
+
+/**
+ * @brief 测试边界加密在通过/不通过样本之间取点
+ */
+TEST_F(ParameterSweepTest, BoundaryRefinementTest) {
+    std::vector<SampleResult> results = {
+        makeResult({0.1, 0.5}, true),
+        makeResult({0.3, 0.5}, true),
+        makeResult({0.7, 0.5}, false),
+        makeResult({0.9, 0.5}, false),
+    };
+    const auto refined = refineBoundary(results, 1);
+    ASSERT_EQ(refined.size(), 1u);
+    EXPECT_NEAR(refined[0][0], 0.5, 1e-12);
+    EXPECT_NEAR(refined[0][1], 0.5, 1e-12);
+
+    // 全部通过时无边界可加密
+    results[2].passed = results[3].passed = true;
+    EXPECT_TRUE(refineBoundary(results, 4).empty());
+}
+
+/**
+ * @brief 测试运行目录生成：三类配置文件的参数写入与环境配置重定向
+ */
+TEST_F(ParameterSweepTest, PrepareRunDirectoryTest) {
+    const auto scenario = test_directory / "scenario";
+    const auto environment = test_directory / "environment_models";
+    writeFile(scenario / "config" / "SimulationConfig.json",
+              R"({"simulation_config":{"simulation_params":{"random_seed":42}}})");
+    writeFile(scenario / "input" / "FlightPlan.json",
+              R"({"flight_plan":{"scenario_config":{"Environment_Name":"RWY_A","Pilot_ID":"Pilot_001"}}})");
+    writeFile(environment / "RWY_A" / "DataTwin" / "environment_config.json",
+              R"({"wind_data":{"wind_speed":8.0}})");
+
+    SweepDefinition definition;
+    definition.scenario_directory = scenario.string();
+    definition.environment_directory = environment.string();
+    ParameterDefinition wind;
+    wind.target = ConfigTarget::Environment;
+    wind.json_pointer = "/wind_data/wind_speed";
+    wind.min_value = 0.0;
+    wind.max_value = 20.0;
+    ParameterDefinition seed;
+    seed.json_pointer = "/simulation_config/simulation_params/random_seed";
+    seed.min_value = 1.0;
+    seed.max_value = 101.0;
+    seed.integer = true;
+    ParameterDefinition pilot;
+    pilot.target = ConfigTarget::FlightPlan;
+    pilot.json_pointer = "/flight_plan/scenario_config/Pilot_ID";
+    pilot.values = {"Pilot_001", "Pilot_002"};
+    definition.parameters = {wind, seed, pilot};
+
+    SamplePoint point;
+    point.unit = {0.25, 0.5, 0.75};
+    const auto run_dir = test_directory / "run_00000";
+    std::string error;
+    ASSERT_TRUE(prepareRunDirectory(definition, point, run_dir.string(), error)) << error;
+
+    EXPECT_TRUE(std::filesystem::is_directory(run_dir / "output"));
+    EXPECT_EQ(readJson(run_dir / "config" / "SimulationConfig.json")["simulation_config"]["simulation_params"]["random_seed"], 51);
+    const auto flight_plan = readJson(run_dir / "input" / "FlightPlan.json");
+    EXPECT_EQ(flight_plan["flight_plan"]["scenario_config"]["Pilot_ID"], "Pilot_002");
+    EXPECT_EQ(flight_plan["flight_plan"]["scenario_config"]["Environment_Config_Directory"], "environment/");
+    const auto environment_config = readJson(run_dir / "environment" / "RWY_A" / "DataTwin" / "environment_config.json");
+    EXPECT_DOUBLE_EQ(environment_config["wind_data"]["wind_speed"].get<double>(), 5.0);
+
+    // 基准场景文件不被修改
+    EXPECT_DOUBLE_EQ(readJson(environment / "RWY_A" / "DataTwin" / "environment_config.json")["wind_data"]["wind_speed"].get<double>(), 8.0);
+
+    // 无效JSON指针报错
+    definition.parameters[0].json_pointer = "wind_data";
+    EXPECT_FALSE(prepareRunDirectory(definition, point, run_dir.string(), error));
+    EXPECT_FALSE(error.empty());
+}
+
+/**
+ * @brief 测试从定宽记录器文件读取结果列（左对齐、数值长于列名）
+ */
+TEST_F(ParameterSweepTest, ReadOutcomeTest) {
+    writeFile(test_directory / "output" / "aircraft_flight_state.csv",
+              "time            source          distance_m\n"
+              "0.00            flight_dynamics 0.00\n"
+              "0.01            flight_dynamics 12.50\n"
+              "0.02            flight_dynamics 7.25\n");
+    OutcomeDefinition outcome;
+    double value = 0.0;
+    ASSERT_TRUE(readOutcome(test_directory.string(), outcome, value));
+    EXPECT_DOUBLE_EQ(value, 7.25);
+    outcome.reduce = "max";
+    ASSERT_TRUE(readOutcome(test_directory.string(), outcome, value));
+    EXPECT_DOUBLE_EQ(value, 12.5);
+    outcome.column = "missing";
+    EXPECT_FALSE(readOutcome(test_directory.string(), outcome, value));
+}
+
+/**
+ * @brief 测试读取真实记录器文件：数据源名与高精度数值溢出列宽的行不错位
+ */
+TEST_F(ParameterSweepTest, ReadOutcomeFromRecorderTest) {
+    const auto output = test_directory / "output";
+    std::filesystem::create_directories(output);
+    {
+        VFT_SMF::DataRecorder recorder(output.string(), 100);
+        ASSERT_TRUE(recorder.initialize());
+        VFT_SMF::CsvExport::ColumnPrecision precision;
+        std::string error;
+        ASSERT_TRUE(VFT_SMF::CsvExport::ColumnPrecision::parse("groundspeed=shortest", precision, error)) << error;
+        recorder.setCsvPrecision(precision);
+
+        VFT_SMF::GlobalSharedDataStruct::AircraftFlightState state;
+        state.latitude = 30.0;
+        state.longitude = 120.0;
+        state.groundspeed = 12.345678901234567;   // 最短表示长于15列
+        state.datasource = VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::intern("flight_dynamics_initial");
+        recorder.recordAircraftFlightState(0.0, state);
+        state.groundspeed = 48.25;
+        state.datasource = VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::intern("flight_dynamics");
+        recorder.recordAircraftFlightState(0.01, state);
+        recorder.flushAllBuffers();
+    }
+
+    OutcomeDefinition outcome;
+    outcome.column = "groundspeed";
+    outcome.reduce = "min";
+    double value = 0.0;
+    ASSERT_TRUE(readOutcome(test_directory.string(), outcome, value));
+    EXPECT_DOUBLE_EQ(value, 12.345678901234567);
+
+    outcome.column = "longitude";
+    outcome.reduce = "max";
+    ASSERT_TRUE(readOutcome(test_directory.string(), outcome, value));
+    EXPECT_DOUBLE_EQ(value, 120.0);
+}
@@ -0,0 +1,156 @@
+/**
+ * @file test_perf_counter_profiler.cpp
+ * @brief 性能计数器统计单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 包含被测试的头文件
+#include "../../../../src/G_SimulationManager/B_SimManage/PerfCounterProfiler.hpp"
+#include "../../../../src/G_SimulationManager/B_SimManage/AllocationTracker.hpp"
+
+using VFT_SMF::SimManage::PerfCounterMode;
+using VFT_SMF::SimManage::PerfCounterProfiler;
+using VFT_SMF::SimManage::ThreadPerfCounterStats;
+
+namespace {
+    volatile double sink = 0.0;
+
+    void busyWork() {
+        double value = 0.0;
+        for (int i = 0; i < 200000; ++i) {
+            value += static_cast<double>(i) * 0.5;
+        }
+        sink = value;
+    }
+
+    /**
+     * @brief 在新线程中以给定线程名运行若干步
+     */
+    void runThread(const std::string& thread_name, int steps) {
+        std::thread worker([&]() {
+            PerfCounterProfiler::attachCurrentThread(thread_name);
+            for (int step = 0; step < steps; ++step) {
+                PerfCounterProfiler::beginStep(static_cast<uint64_t>(step));
+                {
+                    PerfCounterProfiler::PhaseScope phase("compute");
+                    busyWork();
+                }
+                PerfCounterProfiler::endStep();
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            PerfCounterProfiler::detachCurrentThread();
+        });
+        worker.join();
+    }
+
+    const ThreadPerfCounterStats* findThread(const std::vector<ThreadPerfCounterStats>& stats, const std::string& thread_name) {
+        for (const auto& entry : stats) {
+            if (entry.thread_name == thread_name) return &entry;
+        }
+        return nullptr;
+    }
+}
+
+/**
+ * @brief 测试模式名称解析
+ */
+TEST(PerfCounterProfilerTest, ParseModeTest) {
+    PerfCounterMode mode = PerfCounterMode::Off;
+    EXPECT_TRUE(PerfCounterProfiler::parseMode("steps", mode));
+    EXPECT_EQ(mode, PerfCounterMode::Steps);
+    EXPECT_TRUE(PerfCounterProfiler::parseMode("summary", mode));
+    EXPECT_EQ(mode, PerfCounterMode::Summary);
+    EXPECT_FALSE(PerfCounterProfiler::parseMode("cycles", mode));
+    EXPECT_EQ(mode, PerfCounterMode::Summary);
+}
+
+/**
+ * @brief 测试 off 模式下不记录线程
+ */
+TEST(PerfCounterProfilerTest, OffModeTest) {
+    PerfCounterProfiler::setMode(PerfCounterMode::Off);
+    runThread("Off_Thread", 3);
+    EXPECT_EQ(findThread(PerfCounterProfiler::snapshot(), "Off_Thread"), nullptr);
+}
+
+/**
+ * @brief 测试按步、按阶段结算（计数器是否可用取决于运行环境，只检查可用的计数器）
+ */
+TEST(PerfCounterProfilerTest, StepAndPhaseAttributionTest) {
+    PerfCounterProfiler::setMode(PerfCounterMode::Steps);
+    runThread("Profiled_Thread", 5);
+    PerfCounterProfiler::setMode(PerfCounterMode::Off);
+
+    const auto stats = PerfCounterProfiler::snapshot();
+    const ThreadPerfCounterStats* thread = findThread(stats, "Profiled_Thread");
+    ASSERT_NE(thread, nullptr);
+    EXPECT_EQ(thread->steps, 5u);
+
+    std::vector<std::string> phase_names;
+    for (const auto& phase : thread->phases) phase_names.push_back(phase.phase);
+    EXPECT_EQ(phase_names, (std::vector<std::string>{"init", "step", "compute", "wait"}));
+    EXPECT_EQ(thread->phases[1].samples, 5u);
+    EXPECT_EQ(thread->phases[2].samples, 5u);
+    EXPECT_EQ(thread->phases[3].samples, 4u);
+    // 逐步明细：每步 step 与 compute，第 2 步起另有 wait
+    EXPECT_EQ(thread->history.size(), 5u * 2u + 4u);
+
+    if (thread->available[VFT_SMF::SimManage::PERF_TASK_CLOCK]) {
+        const auto& step_totals = thread->phases[1].totals.values;
+        const auto& compute_totals = thread->phases[2].totals.values;
+        EXPECT_GT(compute_totals[VFT_SMF::SimManage::PERF_TASK_CLOCK], 0u);
+        EXPECT_GE(step_totals[VFT_SMF::SimManage::PERF_TASK_CLOCK], compute_totals[VFT_SMF::SimManage::PERF_TASK_CLOCK]);
+    }
+    if (thread->available[VFT_SMF::SimManage::PERF_INSTRUCTIONS]) {
+        EXPECT_GT(thread->phases[2].totals.values[VFT_SMF::SimManage::PERF_INSTRUCTIONS], 200000u);
+    }
+
+    const std::string summary = PerfCounterProfiler::formatSummary();
+    EXPECT_NE(summary.find("Profiled_Thread"), std::string::npos);
+    EXPECT_NE(summary.find("倾向"), std::string::npos);
+}
+
+/**
+ * @brief 测试 steps 模式按预计步数预留明细后，步内结算不分配堆内存
+ */
+TEST(PerfCounterProfilerTest, ReservedHistoryTest) {
+    using VFT_SMF::SimManage::AllocationTracker;
+    using VFT_SMF::SimManage::AllocationTrackingMode;
+    PerfCounterProfiler::setMode(PerfCounterMode::Steps);
+    PerfCounterProfiler::reserveSteps(20);
+    AllocationTracker::setMode(AllocationTrackingMode::Count);
+
+    std::vector<uint64_t> step_allocations;
+    step_allocations.reserve(20);
+    std::thread worker([&]() {
+        AllocationTracker::tagCurrentThread("Reserved_History_Thread");
+        PerfCounterProfiler::attachCurrentThread("Reserved_History_Thread");
+        for (int step = 0; step < 20; ++step) {
+            AllocationTracker::beginStep(static_cast<uint64_t>(step));
+            PerfCounterProfiler::beginStep(static_cast<uint64_t>(step));
+            {
+                PerfCounterProfiler::PhaseScope phase("compute");
+            }
+            PerfCounterProfiler::endStep();
+            step_allocations.push_back(AllocationTracker::getCurrentStepAllocations());
+        }
+        PerfCounterProfiler::detachCurrentThread();
+        AllocationTracker::untagCurrentThread();
+    });
+    worker.join();
+    AllocationTracker::setMode(AllocationTrackingMode::Off);
+    PerfCounterProfiler::setMode(PerfCounterMode::Off);
+    PerfCounterProfiler::reserveSteps(0);
+
+    EXPECT_EQ(step_allocations, std::vector<uint64_t>(20, 0u));
+    const ThreadPerfCounterStats* thread = findThread(PerfCounterProfiler::snapshot(), "Reserved_History_Thread");
+    ASSERT_NE(thread, nullptr);
+    EXPECT_EQ(thread->history.size(), 20u * 2u + 19u);
+}
@@ -0,0 +1,119 @@
+/**
+ * @file test_random_service.cpp
+ * @brief 计数器型随机数服务单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+// 包含被测试的头文件
+#include "../../../../src/G_SimulationManager/B_SimManage/RandomService.hpp"
+
+using namespace VFT_SMF::SimManage;
+
+/**
+ * @brief 随机数服务测试类
+ */
+class RandomServiceTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        RandomService::setRunSeed(42);
+        RandomService::setCurrentStep(0);
+    }
+};
+
+/**
+ * @brief 测试Philox4x32-10已知答案（Random123 kat_vectors）
+ */
+TEST_F(RandomServiceTest, PhiloxKnownAnswerTest) {
+    const auto zero = Philox4x32::generate({0u, 0u, 0u, 0u}, {0u, 0u});
+    EXPECT_EQ(zero[0], 0x6627e8d5u);
+    EXPECT_EQ(zero[1], 0xe169c58du);
+    EXPECT_EQ(zero[2], 0xbc57ac4cu);
+    EXPECT_EQ(zero[3], 0x9b00dbd8u);
+
+    const auto pi = Philox4x32::generate({0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u},
+                                         {0xa4093822u, 0x299f31d0u});
+    EXPECT_EQ(pi[0], 0xd16cfe09u);
+    EXPECT_EQ(pi[1], 0x94fdccebu);
+    EXPECT_EQ(pi[2], 0x5001e420u);
+    EXPECT_EQ(pi[3], 0x24126ea1u);
+}
+
+/**
+ * @brief 测试同一键下的抽样可独立重算，且不同代理/流/种子互不相同
+ */
+TEST_F(RandomServiceTest, ReproducibleAndIndependentStreamsTest) {
+    RandomService::setRunSeed(2024);
+    RandomStream a = RandomService::stream("ENV_001", "environment_update");
+    RandomStream a_again = RandomService::stream("ENV_001", "environment_update");
+    RandomStream other_agent = RandomService::stream("ENV_002", "environment_update");
+    RandomStream other_stream = RandomService::stream("ENV_001", "weather");
+    RandomService::setRunSeed(2025);
+    RandomStream other_seed = RandomService::stream("ENV_001", "environment_update");
+
+    EXPECT_EQ(a.uniformAt(123, 4), a_again.uniformAt(123, 4));
+    EXPECT_NE(a.uniformAt(123, 4), a.uniformAt(123, 5));
+    EXPECT_NE(a.uniformAt(123, 4), a.uniformAt(124, 4));
+    EXPECT_NE(a.uniformAt(123, 4), other_agent.uniformAt(123, 4));
+    EXPECT_NE(a.uniformAt(123, 4), other_stream.uniformAt(123, 4));
+    EXPECT_NE(a.uniformAt(123, 4), other_seed.uniformAt(123, 4));
+
+    double batch[8];
+    a.fillUniform(123, 0, batch, 8);
+    for (uint32_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(batch[i], a.uniformAt(123, i));
+    }
+}
+
+/**
+ * @brief 测试游标按线程当前步定位，换步后抽样序号归零，与线程交错无关
+ */
+TEST_F(RandomServiceTest, CursorFollowsThreadStepTest) {
+    RandomStream stream = RandomService::stream("Pilot_001", "strategy");
+
+    RandomService::setCurrentStep(10);
+    const double first = stream.uniform();
+    const double second = stream.uniform();
+    EXPECT_DOUBLE_EQ(first, 1.0 - stream.uniformAt(10, 0));
+    EXPECT_DOUBLE_EQ(second, 1.0 - stream.uniformAt(10, 1));
+
+    RandomService::setCurrentStep(11);
+    EXPECT_DOUBLE_EQ(stream.uniform(), 1.0 - stream.uniformAt(11, 0));
+
+    // 其他线程的步号互不影响
+    double from_thread = 0.0;
+    std::thread worker([&]() {
+        RandomStream copy = RandomService::stream("Pilot_001", "strategy");
+        RandomService::setCurrentStep(10);
+        from_thread = copy.uniform();
+    });
+    worker.join();
+    EXPECT_EQ(from_thread, first);
+    EXPECT_EQ(RandomService::getCurrentStep(), 11u);
+}
+
+/**
+ * @brief 测试均匀数取值范围与正态数的样本矩
+ */
+TEST_F(RandomServiceTest, DistributionMomentsTest) {
+    RandomStream stream = RandomService::stream("flight_dynamics_B737", "acceleration_noise");
+    const int samples = 200000;
+    double uniform_sum = 0.0, normal_sum = 0.0, normal_square_sum = 0.0;
+    for (int i = 0; i < samples; ++i) {
+        const double u = stream.uniformAt(7, static_cast<uint32_t>(i));
+        ASSERT_GT(u, 0.0);
+        ASSERT_LE(u, 1.0);
+        uniform_sum += u;
+        const double n = stream.normalAt(7, static_cast<uint32_t>(i));
+        normal_sum += n;
+        normal_square_sum += n * n;
+    }
+    EXPECT_NEAR(uniform_sum / samples, 0.5, 0.005);
+    EXPECT_NEAR(normal_sum / samples, 0.0, 0.01);
+    EXPECT_NEAR(normal_square_sum / samples, 1.0, 0.02);
+}
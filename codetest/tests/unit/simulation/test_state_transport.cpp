@@ -0,0 +1,306 @@
+/**
+ * @file test_state_transport.cpp
+ * @brief 代理状态传输层单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <csignal>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+// 包含被测试的头文件
+#include "../../../../src/E_GlobalSharedDataSpace/StateTransport.hpp"
+#include "../../../../src/E_GlobalSharedDataSpace/GlobalSharedDataSpace.hpp"
+#include "../../../../src/G_SimulationManager/A_TimeSYNC/TransportStepRelay.hpp"
+
+using namespace VFT_SMF::GlobalShared_DataSpace;
+using VFT_SMF::GlobalSharedDataStruct::AircraftFlightState;
+using VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry;
+using VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState;
+
+namespace {
+    bool contains(const std::vector<std::string>& names, const std::string& name) {
+        return std::find(names.begin(), names.end(), name) != names.end();
+    }
+
+#ifndef _WIN32
+    /**
+     * @brief 在写入中途停住的参与端：占住状态槽、写入一半数据后不再继续
+     */
+    class StallingTransport : public SharedMemoryTransport {
+    public:
+        void stallMidWrite(StateChannel channel) {
+            TransportStateSlot& slot = segment->slots[static_cast<uint32_t>(channel)];
+            uint64_t sequence = slot.sequence.load();
+            while (!slot.sequence.compare_exchange_weak(sequence, makeSequence(currentProcessId(), sequenceCounter(sequence) + 1))) {
+            }
+            std::memset(slot.payload, 0xFF, MAX_STATE_BYTES / 2);
+        }
+    };
+#endif
+}
+
+// 状态槽发布与读取
+TEST(StateTransportTest, PublishReadRoundTripTest) {
+    auto coordinator = InProcessTransport::create();
+    auto participant = coordinator->connect();
+    ASSERT_TRUE(participant->attach("environment"));
+    EXPECT_EQ(participant->localParticipant(), 0);
+
+    EnvironmentGlobalState state;
+    StateSlotInfo info;
+    EXPECT_FALSE(coordinator->read(StateChannel::EnvironmentState, state, info));   // 从未写入
+
+    state.wind_speed = 7.5;
+    state.runway_length = 3800.0;
+    participant->publish(StateChannel::EnvironmentState, state, "ENV_REMOTE");
+    participant->publish(StateChannel::EnvironmentState, state, "ENV_REMOTE");
+
+    EnvironmentGlobalState received;
+    ASSERT_TRUE(coordinator->read(StateChannel::EnvironmentState, received, info));
+    EXPECT_DOUBLE_EQ(received.wind_speed, 7.5);
+    EXPECT_DOUBLE_EQ(received.runway_length, 3800.0);
+    EXPECT_EQ(info.version, 2u);
+    EXPECT_EQ(info.writer, 0);
+    EXPECT_STREQ(info.datasource, "ENV_REMOTE");
+
+    // 尺寸不符的读取被拒绝
+    AircraftFlightState wrong_type;
+    EXPECT_FALSE(coordinator->readState(StateChannel::EnvironmentState, &wrong_type, sizeof(wrong_type), info));
+}
+
+// 步信号下发与完成回报
+TEST(StateTransportTest, StepRoundTripTest) {
+    auto coordinator = InProcessTransport::create();
+    auto participant = coordinator->connect();
+    ASSERT_TRUE(participant->attach("environment"));
+
+    std::thread worker([participant]() {
+        uint64_t last_step = 0;
+        for (int i = 0; i < 3; ++i) {
+            uint64_t step = 0;
+            double simulation_time = 0.0;
+            if (participant->waitForStep(last_step, step, simulation_time, std::chrono::seconds(5)) != StepWaitResult::Step) return;
+            last_step = step;
+            participant->completeStep(step);
+        }
+    });
+
+    for (uint64_t step = 1; step <= 3; ++step) {
+        coordinator->beginStep(step, static_cast<double>(step) * 0.01);
+        EXPECT_TRUE(coordinator->waitForParticipants(step, std::chrono::seconds(5)).empty());
+    }
+    worker.join();
+    EXPECT_TRUE(contains(coordinator->getAttachedParticipants(), "environment"));
+
+    coordinator->shutdown();
+    uint64_t step = 0;
+    double simulation_time = 0.0;
+    EXPECT_EQ(participant->waitForStep(3, step, simulation_time, std::chrono::milliseconds(10)), StepWaitResult::Shutdown);
+}
+
+// 超时的参与端被剔除，之后可以同名重新附加
+TEST(StateTransportTest, EvictAndReattachTest) {
+    auto coordinator = InProcessTransport::create();
+    auto participant = coordinator->connect();
+    ASSERT_TRUE(participant->attach("environment"));
+
+    // 同名参与端仍在运行时拒绝附加
+    auto duplicate = coordinator->connect();
+    EXPECT_FALSE(duplicate->attach("environment"));
+
+    coordinator->beginStep(1, 0.01);
+    const auto start = std::chrono::steady_clock::now();
+    const auto evicted = coordinator->waitForParticipants(1, std::chrono::milliseconds(50));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2));
+    ASSERT_EQ(evicted.size(), 1u);
+    EXPECT_EQ(evicted[0], "environment（步超时）");
+    EXPECT_TRUE(coordinator->getAttachedParticipants().empty());
+
+    uint64_t step = 0;
+    double simulation_time = 0.0;
+    EXPECT_EQ(participant->waitForStep(0, step, simulation_time, std::chrono::milliseconds(10)), StepWaitResult::Detached);
+    EXPECT_FALSE(participant->isAttached());
+
+    // 重新附加后从下一步开始参与
+    ASSERT_TRUE(participant->attach("environment"));
+    coordinator->beginStep(2, 0.02);
+    ASSERT_EQ(participant->waitForStep(1, step, simulation_time, std::chrono::seconds(1)), StepWaitResult::Step);
+    EXPECT_EQ(step, 2u);
+    EXPECT_DOUBLE_EQ(simulation_time, 0.02);
+    participant->completeStep(step);
+    EXPECT_TRUE(coordinator->waitForParticipants(2, std::chrono::seconds(1)).empty());
+}
+
+// 共享数据空间之间经传输层交换状态
+TEST(StateTransportTest, GlobalSharedDataSpaceImportTest) {
+    auto coordinator = InProcessTransport::create();
+    auto participant = coordinator->connect();
+    ASSERT_TRUE(participant->attach("environment"));
+
+    GlobalSharedDataSpace main_space;
+    GlobalSharedDataSpace remote_space;
+    main_space.attachStateTransport(coordinator);
+    remote_space.attachStateTransport(participant);
+
+    AircraftFlightState flight_state;
+    flight_state.altitude = 1234.0;
+    main_space.setAircraftFlightState(flight_state, "FD_MAIN");
+    EXPECT_EQ(main_space.importTransportStates(), 0u);   // 本端写入不重复导入
+
+    EnvironmentGlobalState environment_state;
+    environment_state.wind_speed = 4.0;
+    remote_space.setEnvironmentState(environment_state, "ENV_REMOTE");
+
+    EXPECT_EQ(remote_space.importTransportStates(), 1u);
+    EXPECT_DOUBLE_EQ(remote_space.getAircraftFlightState().altitude, 1234.0);
+    EXPECT_EQ(DataSourceRegistry::name(remote_space.getAircraftFlightState().datasource), "FD_MAIN");
+
+    EXPECT_EQ(main_space.importTransportStates(), 1u);
+    EXPECT_DOUBLE_EQ(main_space.getEnvironmentState().wind_speed, 4.0);
+    EXPECT_EQ(DataSourceRegistry::name(main_space.getEnvironmentState().datasource), "ENV_REMOTE");
+    EXPECT_EQ(main_space.importTransportStates(), 0u);   // 版本未变
+}
+
+// 步信号转发器驱动参与端的共享数据空间
+TEST(StateTransportTest, StepRelayTest) {
+    auto coordinator = InProcessTransport::create();
+    auto participant = coordinator->connect();
+    ASSERT_TRUE(participant->attach("environment"));
+
+    auto main_space = std::make_shared<GlobalSharedDataSpace>();
+    auto remote_space = std::make_shared<GlobalSharedDataSpace>();
+    main_space->attachStateTransport(coordinator, std::chrono::seconds(5));
+    remote_space->attachStateTransport(participant);
+
+    VFT_SMF::TransportStepRelay relay(remote_space, participant, "environment");
+    std::thread relay_thread([&relay]() { relay.run(); });
+
+    for (uint64_t step = 1; step <= 5; ++step) {
+        main_space->updateSyncSignal(static_cast<double>(step) * 0.01, step);
+        main_space->waitForRemoteParticipants(step);
+        main_space->resetSyncSignal();
+    }
+    EXPECT_EQ(relay.getRelayedSteps(), 5u);
+    EXPECT_EQ(relay.getReattachCount(), 0u);
+
+    main_space->setSimulationOver(true);   // 协调端结束仿真，转发器随之返回
+    relay_thread.join();
+    EXPECT_TRUE(remote_space->isSimulationOver());
+}
+
+#ifndef _WIN32
+// 独立进程经共享内存附加；进程退出后被立即剔除
+TEST(StateTransportTest, SharedMemoryCrossProcessTest) {
+    const std::string segment_name = "vft_smf_test_transport_" + std::to_string(getpid());
+    SharedMemoryTransport coordinator;
+    ASSERT_TRUE(coordinator.create(segment_name));
+
+    const pid_t child = fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        SharedMemoryTransport participant;
+        if (!participant.open(segment_name) || !participant.attach("child")) _exit(1);
+        EnvironmentGlobalState state;
+        state.wind_speed = 9.0;
+        participant.publish(StateChannel::EnvironmentState, state, "ENV_CHILD");
+        uint64_t step = 0;
+        double simulation_time = 0.0;
+        if (participant.waitForStep(0, step, simulation_time, std::chrono::seconds(10)) != StepWaitResult::Step) _exit(2);
+        participant.completeStep(step);
+        pause();   // 保持附加，等待父进程结束本进程
+        _exit(0);
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!contains(coordinator.getAttachedParticipants(), "child") && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    ASSERT_TRUE(contains(coordinator.getAttachedParticipants(), "child"));
+
+    coordinator.beginStep(1, 0.01);
+    EXPECT_TRUE(coordinator.waitForParticipants(1, std::chrono::seconds(10)).empty());
+
+    EnvironmentGlobalState received;
+    StateSlotInfo info;
+    ASSERT_TRUE(coordinator.read(StateChannel::EnvironmentState, received, info));
+    EXPECT_DOUBLE_EQ(received.wind_speed, 9.0);
+    EXPECT_STREQ(info.datasource, "ENV_CHILD");
+
+    kill(child, SIGKILL);
+    waitpid(child, nullptr, 0);
+
+    // 进程已退出：不等超时即剔除
+    coordinator.beginStep(2, 0.02);
+    const auto start = std::chrono::steady_clock::now();
+    const auto evicted = coordinator.waitForParticipants(2, std::chrono::seconds(10));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+    ASSERT_EQ(evicted.size(), 1u);
+    EXPECT_EQ(evicted[0], "child（进程已退出）");
+}
+
+// 写者在写入中途停住但进程仍在运行（被抢占）时不接管，读端也不会拿到撕裂的数据；进程退出后才接管
+TEST(StateTransportTest, StalledWriterTakeoverTest) {
+    const std::string segment_name = "vft_smf_test_transport_stall_" + std::to_string(getpid());
+    SharedMemoryTransport coordinator;
+    ASSERT_TRUE(coordinator.create(segment_name));
+
+    EnvironmentGlobalState state;
+    state.wind_speed = 3.0;
+    coordinator.publish(StateChannel::EnvironmentState, state, "ENV_COORD");
+
+    int ready[2];
+    ASSERT_EQ(pipe(ready), 0);
+    const pid_t child = fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        StallingTransport participant;
+        if (!participant.open(segment_name) || !participant.attach("stalled")) _exit(1);
+        participant.stallMidWrite(StateChannel::EnvironmentState);
+        const char byte = 1;
+        if (write(ready[1], &byte, 1) != 1) _exit(2);
+        pause();
+        _exit(0);
+    }
+    char byte = 0;
+    ASSERT_EQ(read(ready[0], &byte, 1), 1);
+    close(ready[0]);
+    close(ready[1]);
+
+    std::atomic<bool> published{false};
+    std::thread writer([&]() {
+        EnvironmentGlobalState next;
+        next.wind_speed = 11.0;
+        coordinator.publish(StateChannel::EnvironmentState, next, "ENV_COORD");
+        published = true;
+    });
+
+    // 停住的写者仍在运行：远超接管自旋上限也不接管
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    EXPECT_FALSE(published.load());
+    EnvironmentGlobalState received;
+    StateSlotInfo info;
+    EXPECT_FALSE(coordinator.read(StateChannel::EnvironmentState, received, info));
+
+    kill(child, SIGKILL);
+    waitpid(child, nullptr, 0);
+    writer.join();
+
+    ASSERT_TRUE(coordinator.read(StateChannel::EnvironmentState, received, info));
+    EXPECT_DOUBLE_EQ(received.wind_speed, 11.0);
+    EXPECT_EQ(info.writer, COORDINATOR_WRITER);
+}
+#endif
@@ -0,0 +1,132 @@
+/**
+ * @file test_step_arena.cpp
+ * @brief 每步单调内存区单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 包含被测试的头文件
+#include "../../../../src/G_SimulationManager/B_SimManage/StepArena.hpp"
+#include "../../../../src/E_GlobalSharedDataSpace/GlobalSharedDataStruct.hpp"
+
+using VFT_SMF::SimManage::StepArena;
+using VFT_SMF::GlobalSharedDataStruct::StandardEvent;
+using VFT_SMF::GlobalSharedDataStruct::TriggeredEventLibrary;
+using VFT_SMF::GlobalSharedDataStruct::AgentEventQueue;
+using VFT_SMF::GlobalSharedDataStruct::AgentEventQueueItem;
+
+/**
+ * @brief 测试步内分配来自同一缓冲区、换步后地址复用
+ */
+TEST(StepArenaTest, ResetReusesBufferTest) {
+    StepArena::beginStep(1);
+    void* first = StepArena::resource()->allocate(256, 8);
+    void* second = StepArena::resource()->allocate(256, 8);
+    EXPECT_EQ(static_cast<char*>(second) - static_cast<char*>(first), 256);
+    EXPECT_EQ(StepArena::local().getOverflowBytes(), 0u);
+    EXPECT_EQ(StepArena::local().getStep(), 1u);
+
+    StepArena::beginStep(2);
+    EXPECT_EQ(StepArena::resource()->allocate(256, 8), first);
+}
+
+/**
+ * @brief 测试单步用量超过缓冲时向上游申请，下一步缓冲扩大后不再溢出
+ */
+TEST(StepArenaTest, GrowAfterOverflowTest) {
+    StepArena::beginStep(10);
+    const size_t capacity = StepArena::local().getCapacity();
+    const uint64_t grows = StepArena::local().getGrowCount();
+    {
+        std::pmr::vector<double> large(StepArena::resource());
+        large.resize(capacity / sizeof(double) + 1024);
+    }
+    EXPECT_GT(StepArena::local().getOverflowBytes(), 0u);
+
+    StepArena::beginStep(11);
+    EXPECT_GT(StepArena::local().getCapacity(), capacity);
+    EXPECT_EQ(StepArena::local().getGrowCount(), grows + 1);
+    {
+        std::pmr::vector<double> large(StepArena::resource());
+        large.resize(capacity / sizeof(double) + 1024);
+    }
+    EXPECT_EQ(StepArena::local().getOverflowBytes(), 0u);
+}
+
+/**
+ * @brief 测试各线程拥有独立的内存区
+ */
+TEST(StepArenaTest, ThreadLocalTest) {
+    StepArena::beginStep(5);
+    const StepArena* main_arena = &StepArena::local();
+    const StepArena* worker_arena = nullptr;
+    uint64_t worker_step = 0;
+    std::thread worker([&]() {
+        StepArena::beginStep(7);
+        worker_arena = &StepArena::local();
+        worker_step = StepArena::local().getStep();
+    });
+    worker.join();
+    EXPECT_NE(main_arena, worker_arena);
+    EXPECT_EQ(worker_step, 7u);
+    EXPECT_EQ(StepArena::local().getStep(), 5u);
+}
+
+/**
+ * @brief 测试按步查询事件：步内存区版本与原接口结果一致，按名称查询不复制列表
+ */
+TEST(StepArenaTest, EventsAtStepTest) {
+    TriggeredEventLibrary library;
+    StandardEvent clearance;
+    clearance.event_id = 1;
+    clearance.event_name = "TaxiClearance";
+    clearance.is_triggered = true;
+    StandardEvent brake;
+    brake.event_id = 2;
+    brake.event_name = "BrakeRelease";
+    brake.is_triggered = true;
+    library.addEventToStep(1.5, clearance);
+    library.addEventToStep(1.5, brake);
+
+    StepArena::beginStep(150);
+    const auto events = library.getEventsAtStep(1.5, StepArena::resource());
+    const auto reference = library.getEventsAtStep(1.5);
+    ASSERT_EQ(events.size(), reference.size());
+    for (size_t i = 0; i < events.size(); ++i) {
+        EXPECT_EQ(events[i].event_name, reference[i].event_name);
+    }
+    EXPECT_EQ(events.get_allocator().resource(), StepArena::resource());
+    EXPECT_TRUE(library.getEventsAtStep(2.0, StepArena::resource()).empty());
+
+    EXPECT_TRUE(library.isEventTriggered("BrakeRelease"));
+    EXPECT_FALSE(library.isEventTriggered("Takeoff"));
+}
+
+/**
+ * @brief 测试代理事件队列就地覆写槽位后出队内容完整
+ */
+TEST(StepArenaTest, AgentQueueInPlaceEnqueueTest) {
+    AgentEventQueue queue("ATC_001");
+    StandardEvent event;
+    event.event_id = 3;
+    event.event_name = "LineUp";
+    const size_t capacity = AgentEventQueue::MAX_AGENT_QUEUE_SIZE;
+    for (size_t i = 0; i < capacity + 2; ++i) {
+        queue.enqueueEvent(event, static_cast<double>(i), "ATC_command", "LineUp", {{"runway", "36L"}}, "test");
+    }
+    EXPECT_EQ(queue.getQueueSize(), capacity);
+
+    AgentEventQueueItem item;
+    ASSERT_TRUE(queue.dequeueEvent(item));
+    EXPECT_DOUBLE_EQ(item.trigger_time, 2.0);
+    EXPECT_EQ(item.event.event_name, "LineUp");
+    EXPECT_EQ(item.controller_type, "ATC_command");
+    EXPECT_EQ(item.parameters.at("runway"), "36L");
+    EXPECT_EQ(item.datasource, "test");
+    EXPECT_FALSE(item.is_processed);
+}
@@ -0,0 +1,148 @@
+/**
+ * @file test_telemetry_ring.cpp
+ * @brief 共享内存遥测环单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 包含被测试的头文件
+#include "../../../../src/G_SimulationManager/LogAndData/TelemetryRing.hpp"
+
+using namespace VFT_SMF::Telemetry;
+
+/**
+ * @brief 遥测环测试类
+ */
+class TelemetryRingTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        region_name = "vft_telemetry_test_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) +
+                      "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        channels = {"latitude", "altitude", "groundspeed"};
+    }
+
+    std::string region_name;
+    std::vector<std::string> channels;
+};
+
+/**
+ * @brief 测试写端与读端往返
+ */
+TEST_F(TelemetryRingTest, RoundTripTest) {
+    TelemetryRingWriter writer;
+    ASSERT_TRUE(writer.create(region_name, channels, 64));
+
+    TelemetryRingReader reader;
+    ASSERT_TRUE(reader.attach(region_name, true));
+    EXPECT_EQ(reader.getChannelNames(), channels);
+
+    for (int i = 0; i < 10; ++i) {
+        const double values[3] = {30.0 + i, 100.0 * i, 0.5 * i};
+        writer.push(0.01 * i, values);
+    }
+
+    TelemetrySample sample;
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(reader.next(sample));
+        EXPECT_EQ(sample.index, static_cast<uint64_t>(i));
+        EXPECT_DOUBLE_EQ(sample.simulation_time, 0.01 * i);
+        ASSERT_EQ(sample.values.size(), 3u);
+        EXPECT_DOUBLE_EQ(sample.values[1], 100.0 * i);
+    }
+    EXPECT_FALSE(reader.next(sample));
+    EXPECT_EQ(reader.getDroppedCount(), 0u);
+}
+
+/**
+ * @brief 测试覆盖最旧数据：读端落后时跳过被覆盖的样本并统计丢失数
+ */
+TEST_F(TelemetryRingTest, OverwriteOldestTest) {
+    TelemetryRingWriter writer;
+    ASSERT_TRUE(writer.create(region_name, channels, 16));
+
+    TelemetryRingReader reader;
+    ASSERT_TRUE(reader.attach(region_name, true));
+
+    for (int i = 0; i < 50; ++i) {
+        const double values[3] = {static_cast<double>(i), 0.0, 0.0};
+        writer.push(i, values);
+    }
+
+    TelemetrySample sample;
+    ASSERT_TRUE(reader.next(sample));
+    EXPECT_EQ(sample.index, 34u);   // 环中仍有效的最旧样本
+    EXPECT_DOUBLE_EQ(sample.values[0], 34.0);
+    EXPECT_EQ(reader.getDroppedCount(), 34u);
+
+    int remaining = 0;
+    while (reader.next(sample)) ++remaining;
+    EXPECT_EQ(remaining, 15);
+}
+
+/**
+ * @brief 测试多读者并发读取时数据一致（不出现撕裂样本）
+ */
+TEST_F(TelemetryRingTest, ConcurrentReadersTest) {
+    TelemetryRingWriter writer;
+    ASSERT_TRUE(writer.create(region_name, channels, 256));
+
+    constexpr int SAMPLE_COUNT = 200000;
+    std::atomic<bool> done(false);
+    std::atomic<int> torn(0);
+    std::atomic<int> readers_ready(0);
+
+    auto read_loop = [&]() {
+        TelemetryRingReader reader;
+        if (!reader.attach(region_name, false)) {
+            ++torn;
+            return;
+        }
+        ++readers_ready;
+        TelemetrySample sample;
+        uint64_t last_index = 0;
+        bool first = true;
+        while (!done.load() || reader.next(sample)) {
+            while (reader.next(sample)) {
+                // 每个样本的三个通道由同一个序号生成，撕裂时不再一致
+                const double base = sample.simulation_time;
+                if (sample.values[0] != base || sample.values[1] != 2.0 * base || sample.values[2] != 3.0 * base) {
+                    ++torn;
+                }
+                if (!first && sample.index <= last_index) ++torn;
+                last_index = sample.index;
+                first = false;
+            }
+        }
+    };
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 3; ++i) readers.emplace_back(read_loop);
+    while (readers_ready.load() < 3 && torn.load() == 0) std::this_thread::yield();
+
+    for (int i = 0; i < SAMPLE_COUNT; ++i) {
+        const double t = static_cast<double>(i);
+        const double values[3] = {t, 2.0 * t, 3.0 * t};
+        writer.push(t, values);
+    }
+    done = true;
+    for (auto& thread : readers) thread.join();
+
+    EXPECT_EQ(torn.load(), 0);
+}
+
+/**
+ * @brief 测试附加不存在的共享内存失败
+ */
+TEST_F(TelemetryRingTest, AttachMissingRegionTest) {
+    TelemetryRingReader reader;
+    EXPECT_FALSE(reader.attach(region_name + "_missing"));
+    EXPECT_FALSE(reader.isAttached());
+    TelemetrySample sample;
+    EXPECT_FALSE(reader.next(sample));
+}
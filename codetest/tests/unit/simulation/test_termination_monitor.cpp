@@ -0,0 +1,228 @@
+/**
+ * @file test_termination_monitor.cpp
+ * @brief 场景提前终止判据单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+// 包含被测试的头文件
+#include "../../../../src/G_SimulationManager/B_SimManage/TerminationMonitor.hpp"
+#include "../../../../src/E_GlobalSharedDataSpace/GlobalSharedDataSpace.hpp"
+#include "../../../../src/E_FlightDynamics/LocalTangentFrame.hpp"
+
+using namespace VFT_SMF::SimManage;
+using VFT_SMF::GlobalShared_DataSpace::GlobalSharedDataSpace;
+using VFT_SMF::GlobalSharedDataStruct::AircraftFlightState;
+using VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState;
+using VFT_SMF::FlightDynamics::GeodeticPosition;
+using VFT_SMF::FlightDynamics::LocalTangentFrame;
+using VFT_SMF::FlightDynamics::NedPosition;
+
+/**
+ * @brief 终止判据测试类
+ */
+class TerminationMonitorTest : public ::testing::Test {
+protected:
+    std::unique_ptr<GlobalSharedDataSpace> shared_data_space;
+    AircraftFlightState flight_state;
+
+    void SetUp() override {
+        shared_data_space = std::make_unique<GlobalSharedDataSpace>();
+        flight_state.latitude = 39.9;
+        flight_state.longitude = 116.4;
+        flight_state.heading = 0.0;
+        EnvironmentGlobalState environment;
+        environment.runway_length = 3800.0;
+        environment.runway_width = 60.0;
+        environment.runway_elevation = 35.0;
+        shared_data_space->setEnvironmentState(environment, "test");
+    }
+
+    void publish(double groundspeed, double altitude = 35.0) {
+        flight_state.groundspeed = groundspeed;
+        flight_state.altitude = altitude;
+        shared_data_space->setAircraftFlightState(flight_state, "test");
+    }
+
+    /**
+     * @brief 沿正北移动指定距离（米）
+     */
+    void moveNorth(double meters) {
+        const LocalTangentFrame frame(GeodeticPosition(flight_state.latitude, flight_state.longitude, 0.0));
+        flight_state.latitude = frame.toGeodetic(NedPosition(meters, 0.0, 0.0)).latitude;
+    }
+};
+
+/**
+ * @brief 测试表达式解析：比较符、单位换算、持续时间与起始时间
+ */
+TEST_F(TerminationMonitorTest, ParsePredicateTest) {
+    TerminationPredicate predicate;
+    std::string error;
+
+    ASSERT_TRUE(TerminationMonitor::parsePredicate("groundspeed < 0.1 for 2s after t>10", predicate, error)) << error;
+    EXPECT_EQ(predicate.channel, "groundspeed");
+    EXPECT_EQ(predicate.op, TerminationPredicate::Op::Less);
+    EXPECT_DOUBLE_EQ(predicate.threshold, 0.1);
+    EXPECT_DOUBLE_EQ(predicate.hold_time, 2.0);
+    EXPECT_DOUBLE_EQ(predicate.after_time, 10.0);
+
+    ASSERT_TRUE(TerminationMonitor::parsePredicate("height > 35ft", predicate, error)) << error;
+    EXPECT_EQ(predicate.channel, "height");
+    EXPECT_NEAR(predicate.threshold, 10.668, 1e-9);
+    EXPECT_DOUBLE_EQ(predicate.hold_time, 0.0);
+
+    ASSERT_TRUE(TerminationMonitor::parsePredicate("runway_excursion for 0.5s", predicate, error)) << error;
+    EXPECT_EQ(predicate.kind, TerminationPredicate::Kind::RunwayExcursion);
+    EXPECT_DOUBLE_EQ(predicate.hold_time, 0.5);
+
+    EXPECT_FALSE(TerminationMonitor::parsePredicate("not_a_channel > 1", predicate, error));
+    EXPECT_FALSE(TerminationMonitor::parsePredicate("altitude > 35 furlongs", predicate, error));
+    EXPECT_FALSE(TerminationMonitor::parsePredicate("groundspeed ~ 1", predicate, error));
+}
+
+/**
+ * @brief 测试持续时间与起始时间：条件中断后重新计时
+ */
+TEST_F(TerminationMonitorTest, HoldAndAfterTimeTest) {
+    TerminationMonitor monitor;
+    std::string error;
+    ASSERT_TRUE(monitor.addPredicate("aircraft_stopped", "groundspeed < 0.1 for 2s after t>10", error)) << error;
+
+    // t<=10 时即使已静止也不求值
+    publish(0.0);
+    EXPECT_FALSE(monitor.evaluate(5.0, *shared_data_space));
+    EXPECT_FALSE(monitor.evaluate(10.0, *shared_data_space));
+
+    EXPECT_FALSE(monitor.evaluate(11.0, *shared_data_space));
+    publish(1.0);
+    EXPECT_FALSE(monitor.evaluate(12.0, *shared_data_space));   // 中断
+    publish(0.05);
+    EXPECT_FALSE(monitor.evaluate(12.5, *shared_data_space));
+    EXPECT_FALSE(monitor.evaluate(14.0, *shared_data_space));
+    EXPECT_TRUE(monitor.evaluate(14.5, *shared_data_space));
+
+    const auto& result = monitor.getResult();
+    EXPECT_TRUE(result.terminated);
+    EXPECT_EQ(result.name, "aircraft_stopped");
+    EXPECT_DOUBLE_EQ(result.time, 14.5);
+
+    // 结果保持
+    publish(10.0);
+    EXPECT_TRUE(monitor.evaluate(15.0, *shared_data_space));
+    EXPECT_DOUBLE_EQ(monitor.getResult().time, 14.5);
+}
+
+/**
+ * @brief 测试冲出跑道判据与派生距离通道
+ */
+TEST_F(TerminationMonitorTest, RunwayExcursionTest) {
+    TerminationMonitor monitor;
+    std::string error;
+    ASSERT_TRUE(monitor.addPredicate("", "runway_excursion", error)) << error;
+
+    publish(20.0);
+    EXPECT_FALSE(monitor.evaluate(0.0, *shared_data_space));
+    moveNorth(3000.0);
+    publish(20.0);
+    EXPECT_FALSE(monitor.evaluate(1.0, *shared_data_space));
+    EXPECT_NEAR(monitor.getDistance(), 3000.0, 1.0);
+
+    // 侧向偏出跑道半宽
+    flight_state.longitude += 40.0 / (6371000.0 * std::cos(39.9 * 3.14159265358979323846 / 180.0)) * 180.0 / 3.14159265358979323846;
+    publish(20.0);
+    EXPECT_TRUE(monitor.evaluate(2.0, *shared_data_space));
+    EXPECT_EQ(monitor.getResult().name, "runway_excursion");
+}
+
+/**
+ * @brief 测试切平面发布状态：跑道坐标取发布的切平面位置，距离与经纬度换算后累计一致
+ */
+TEST_F(TerminationMonitorTest, TangentPlaneStateTest) {
+    TerminationMonitor monitor;
+    std::string error;
+    ASSERT_TRUE(monitor.addPredicate("", "runway_excursion", error)) << error;
+
+    // 切平面积分：锚点为起始位置，经纬度未换算
+    flight_state.anchor_latitude = flight_state.latitude;
+    flight_state.anchor_longitude = flight_state.longitude;
+    flight_state.anchor_altitude = 35.0;
+    flight_state.local_north = 100.0;
+    flight_state.geodetic_stale = true;
+    publish(20.0);
+    EXPECT_FALSE(monitor.evaluate(0.0, *shared_data_space));
+
+    flight_state.local_north = 2100.0;
+    flight_state.local_east = 25.0;
+    publish(20.0);
+    EXPECT_FALSE(monitor.evaluate(1.0, *shared_data_space));
+    // 距离按换算后的经纬度在椭球面上累计，与 35 m 高度处的切平面位移相差约 5 ppm
+    EXPECT_NEAR(monitor.getDistance(), std::hypot(2000.0, 25.0), 0.05);
+
+    flight_state.local_east = 31.0;
+    publish(20.0);
+    EXPECT_TRUE(monitor.evaluate(2.0, *shared_data_space));
+}
+
+/**
+ * @brief 测试离地高度通道：跑道标高 35 m 上静止时 height > 35ft 不成立，离地后才成立
+ */
+TEST_F(TerminationMonitorTest, HeightAboveRunwayTest) {
+    TerminationMonitor monitor;
+    std::string error;
+    ASSERT_TRUE(monitor.addPredicate("airborne", "height > 35ft", error)) << error;
+
+    // 地面滑跑：海拔高度 35 m（已超过 35ft），离地高度为 0
+    publish(0.0);
+    EXPECT_FALSE(monitor.evaluate(0.0, *shared_data_space));
+    publish(60.0, 35.5);
+    EXPECT_FALSE(monitor.evaluate(20.0, *shared_data_space));
+    publish(75.0, 35.0 + 10.0);
+    EXPECT_FALSE(monitor.evaluate(30.0, *shared_data_space));
+
+    publish(75.0, 35.0 + 11.0);
+    EXPECT_TRUE(monitor.evaluate(31.0, *shared_data_space));
+    EXPECT_EQ(monitor.getResult().name, "airborne");
+}
+
+/**
+ * @brief 测试从飞行计划加载条件并写出报告
+ */
+TEST_F(TerminationMonitorTest, LoadFromFlightPlanAndReportTest) {
+    const auto directory = std::filesystem::temp_directory_path() / "vft_termination_test";
+    std::filesystem::create_directories(directory);
+    const auto flight_plan = directory / "FlightPlan.json";
+    std::ofstream(flight_plan) << R"({"flight_plan":{"termination_conditions":[
+        "height > 35ft",
+        {"name": "overrun", "condition": "distance > 500"},
+        "bogus expression"
+    ]}})";
+
+    TerminationMonitor monitor;
+    EXPECT_EQ(monitor.loadFromFlightPlan(flight_plan.string()), 2u);
+    EXPECT_EQ(monitor.loadFromFlightPlan((directory / "missing.json").string()), 0u);
+
+    publish(50.0);
+    EXPECT_FALSE(monitor.evaluate(0.0, *shared_data_space));
+    moveNorth(600.0);
+    publish(50.0);
+    EXPECT_TRUE(monitor.evaluate(12.0, *shared_data_space));
+    EXPECT_EQ(monitor.getResult().name, "overrun");
+
+    const auto report = directory / "simulation_termination.txt";
+    ASSERT_TRUE(monitor.writeReport(report.string(), 12.0, 60.0));
+    std::ifstream file(report);
+    std::string first, second;
+    std::getline(file, first);
+    std::getline(file, second);
+    EXPECT_EQ(first, "terminated_early=1");
+    EXPECT_EQ(second, "reason=overrun");
+    std::filesystem::remove_all(directory);
+}
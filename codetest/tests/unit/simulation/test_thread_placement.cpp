@@ -0,0 +1,101 @@
+/**
+ * @file test_thread_placement.cpp
+ * @brief 线程放置单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 包含被测试的头文件
+#include "../../../../src/G_SimulationManager/B_SimManage/ThreadPlacement.hpp"
+
+using VFT_SMF::SimManage::ThreadPlacement;
+using VFT_SMF::SimManage::ThreadPlacementResult;
+using VFT_SMF::SimManage::ThreadPlacementSpec;
+
+namespace {
+    /**
+     * @brief 在新线程中应用放置并返回该线程的结果
+     */
+    ThreadPlacementResult applyInNewThread(const std::string& thread_name, const ThreadPlacementSpec& spec) {
+        ThreadPlacement::configure({{thread_name, spec}});
+        bool applied = false;
+        std::thread worker([&]() { applied = ThreadPlacement::applyToCurrentThread(thread_name); });
+        worker.join();
+        EXPECT_TRUE(applied);
+        const auto results = ThreadPlacement::snapshot();
+        EXPECT_EQ(results.size(), 1u);
+        return results.empty() ? ThreadPlacementResult{} : results.front();
+    }
+}
+
+/**
+ * @brief 测试放置描述解析
+ */
+TEST(ThreadPlacementTest, ParseSpecTest) {
+    ThreadPlacementSpec spec;
+    std::string error;
+    ASSERT_TRUE(ThreadPlacement::parseSpec("cpus=6,2-3; priority=80; numa=1", spec, error));
+    EXPECT_EQ(spec.cpus, (std::vector<int>{2, 3, 6}));
+    EXPECT_EQ(spec.realtime_priority, 80);
+    EXPECT_EQ(spec.numa_node, 1);
+    EXPECT_EQ(ThreadPlacement::formatCpuList(spec.cpus), "2-3,6");
+
+    ASSERT_TRUE(ThreadPlacement::parseSpec("", spec, error));
+    EXPECT_TRUE(spec.empty());
+
+    EXPECT_FALSE(ThreadPlacement::parseSpec("cpus=3-1", spec, error));
+    EXPECT_FALSE(ThreadPlacement::parseSpec("cpus=a", spec, error));
+    EXPECT_FALSE(ThreadPlacement::parseSpec("priority", spec, error));
+    EXPECT_FALSE(ThreadPlacement::parseSpec("core=1", spec, error));
+    EXPECT_FALSE(error.empty());
+}
+
+/**
+ * @brief 测试未配置的线程不做任何事
+ */
+TEST(ThreadPlacementTest, UnconfiguredThreadTest) {
+    ThreadPlacementSpec spec;
+    spec.cpus = {0};
+    ThreadPlacement::configure({{"Pilot_Thread", spec}, {"ATC_Thread", ThreadPlacementSpec{}}});
+    EXPECT_TRUE(ThreadPlacement::hasSpec("Pilot_Thread"));
+    EXPECT_FALSE(ThreadPlacement::hasSpec("ATC_Thread"));
+    EXPECT_FALSE(ThreadPlacement::applyToCurrentThread("ATC_Thread"));
+    EXPECT_TRUE(ThreadPlacement::snapshot().empty());
+}
+
+/**
+ * @brief 测试 CPU 集应用后回读到请求的 CPU
+ */
+TEST(ThreadPlacementTest, AffinityTest) {
+    ThreadPlacementSpec spec;
+    spec.cpus = {0};
+    const ThreadPlacementResult result = applyInNewThread("Flight_Dynamics_Thread", spec);
+    EXPECT_TRUE(result.affinity_applied) << result.affinity_note;
+    EXPECT_EQ(result.achieved_cpus, (std::vector<int>{0}));
+    EXPECT_NE(ThreadPlacement::formatReport().find("Flight_Dynamics_Thread"), std::string::npos);
+}
+
+/**
+ * @brief 测试无法满足的要求只记录原因，其余各项照常应用
+ */
+TEST(ThreadPlacementTest, GracefulFallbackTest) {
+    ThreadPlacementSpec spec;
+    spec.cpus = {0};
+    spec.realtime_priority = 150;    // 超出 SCHED_FIFO 范围，截断后应用；无权限时保持普通调度
+    spec.numa_node = 1000;           // 不存在的节点
+    const ThreadPlacementResult result = applyInNewThread("Environment_Thread", spec);
+    EXPECT_TRUE(result.affinity_applied);
+    EXPECT_FALSE(result.numa_applied);
+    EXPECT_FALSE(result.numa_note.empty());
+    EXPECT_FALSE(result.achieved_policy.empty());
+    EXPECT_FALSE(result.realtime_note.empty());
+    if (!result.realtime_applied) {
+        EXPECT_NE(result.achieved_policy, "SCHED_FIFO");
+    }
+}
@@ -0,0 +1,133 @@
+/**
+ * @file test_time_index.cpp
+ * @brief 稀疏时间索引与时间窗口读取单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+// 包含被测试的头文件
+#include "../../../../src/G_SimulationManager/LogAndData/TimeIndex.hpp"
+#include "../../../../src/G_SimulationManager/LogAndData/TimeSeriesCodec.hpp"
+
+using namespace VFT_SMF::TimeIndex;
+
+/**
+ * @brief 时间索引测试类
+ */
+class TimeIndexTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        directory = std::filesystem::temp_directory_path() / "vft_time_index_test";
+        std::filesystem::create_directories(directory);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(directory);
+    }
+
+    // 按记录器的定宽格式写出CSV并生成索引
+    std::string writeCsv(int rows) {
+        const std::string path = (directory / "channel.csv").string();
+        std::ofstream file(path);
+        TimeIndexBuilder index(64);
+        file << std::left << std::setw(15) << "SimulationTime" << " " << std::setw(20) << "datasource" << " "
+             << std::setw(15) << "altitude" << " " << std::setw(20) << "landing_gear_deployed" << "\n";
+        double t = 0.0;
+        for (int i = 0; i < rows; ++i) {
+            index.onRow(t, file);
+            file << std::left << std::setw(15) << std::fixed << std::setprecision(2) << t << " "
+                 << std::setw(20) << "flight_dynamics" << " "
+                 << std::setw(15) << i * 0.5 << " "
+                 << std::setw(20) << (i % 2 ? "true" : "false") << "\n";
+            t += 0.01;
+        }
+        file.close();
+        index.write(indexPathFor(path));
+        return path;
+    }
+
+    std::filesystem::path directory;
+};
+
+/**
+ * @brief 测试索引文件写出与读取
+ */
+TEST_F(TimeIndexTest, IndexRoundTripTest) {
+    const std::string path = writeCsv(1000);
+    std::vector<IndexEntry> entries;
+    ASSERT_TRUE(loadIndex(indexPathFor(path), entries));
+    ASSERT_EQ(entries.size(), 16u);  // ceil(1000 / 64)
+    EXPECT_EQ(entries[1].sample_index, 64u);
+    EXPECT_NEAR(entries[1].time, 0.64, 1e-9);
+
+    // 索引偏移应恰好指向对应行的行首
+    std::ifstream file(path);
+    file.seekg(static_cast<std::streamoff>(entries[3].byte_offset));
+    std::string line;
+    std::getline(file, line);
+    EXPECT_EQ(line.substr(0, 4), "1.92");
+}
+
+/**
+ * @brief 测试CSV时间窗口读取（使用索引与不使用索引结果一致）
+ */
+TEST_F(TimeIndexTest, CsvWindowTest) {
+    const std::string path = writeCsv(1000);
+
+    ChannelWindow window;
+    ASSERT_TRUE(readWindow(path, 5.0, 5.5, {"altitude", "landing_gear_deployed"}, window));
+    ASSERT_EQ(window.time.size(), 51u);
+    EXPECT_NEAR(window.time.front(), 5.0, 1e-9);
+    EXPECT_NEAR(window.time.back(), 5.5, 1e-9);
+    EXPECT_DOUBLE_EQ(window.columns[0].front(), 250.0);
+    EXPECT_DOUBLE_EQ(window.columns[1].front(), 0.0);
+    EXPECT_DOUBLE_EQ(window.columns[1][1], 1.0);
+
+    std::filesystem::remove(indexPathFor(path));
+    ChannelWindow full_scan;
+    ASSERT_TRUE(readWindow(path, 5.0, 5.5, {"altitude", "landing_gear_deployed"}, full_scan));
+    EXPECT_EQ(full_scan.time, window.time);
+    EXPECT_EQ(full_scan.columns, window.columns);
+}
+
+/**
+ * @brief 测试压缩通道的按块索引与窗口读取
+ */
+TEST_F(TimeIndexTest, CompressedWindowTest) {
+    const std::string path = (directory / "channel.vts").string();
+    {
+        VFT_SMF::TimeSeriesCodec::CompressedChannelWriter writer(path, {"altitude", "airspeed"}, 100);
+        double t = 0.0;
+        for (int i = 0; i < 1000; ++i) {
+            writer.append(t, {i * 0.5, 70.0 + i * 0.001});
+            t += 0.01;
+        }
+    }
+
+    std::vector<IndexEntry> entries;
+    ASSERT_TRUE(loadIndex(indexPathFor(path), entries));
+    ASSERT_EQ(entries.size(), 10u);
+    EXPECT_EQ(entries[4].sample_index, 400u);
+
+    ChannelWindow window;
+    ASSERT_TRUE(readWindow(path, 7.255, 7.505, {"airspeed"}, window));
+    ASSERT_EQ(window.column_names, std::vector<std::string>{"airspeed"});
+    ASSERT_EQ(window.time.size(), 25u);
+    EXPECT_DOUBLE_EQ(window.columns[0].front(), 70.0 + 726 * 0.001);
+}
+
+/**
+ * @brief 测试请求不存在的列
+ */
+TEST_F(TimeIndexTest, UnknownColumnTest) {
+    const std::string path = writeCsv(10);
+    ChannelWindow window;
+    EXPECT_FALSE(readWindow(path, 0.0, 1.0, {"no_such_column"}, window));
+}
@@ -0,0 +1,139 @@
+/**
+ * @file test_time_series_codec.cpp
+ * @brief 时间序列压缩编解码器单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+// 包含被测试的头文件
+#include "../../../../src/G_SimulationManager/LogAndData/TimeSeriesCodec.hpp"
+
+using namespace VFT_SMF::TimeSeriesCodec;
+
+namespace {
+    bool sameBits(double a, double b) {
+        return std::memcmp(&a, &b, sizeof(double)) == 0;
+    }
+}
+
+/**
+ * @brief 压缩编解码器测试类
+ */
+class TimeSeriesCodecTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        file_path = (std::filesystem::temp_directory_path() / "vft_codec_test.vts").string();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(file_path);
+        std::filesystem::remove(file_path + ".idx");
+    }
+
+    std::string file_path;
+};
+
+/**
+ * @brief 测试比特读写往返
+ */
+TEST_F(TimeSeriesCodecTest, BitRoundTripTest) {
+    BitWriter writer;
+    writer.writeBits(0b101, 3);
+    writer.writeBits(0xDEADBEEFCAFEBABEull, 64);
+    writer.writeBit(true);
+    writer.writeBits(0x3F, 7);
+    const auto& bytes = writer.finish();
+
+    BitReader reader(bytes.data(), bytes.size());
+    EXPECT_EQ(reader.readBits(3), 0b101u);
+    EXPECT_EQ(reader.readBits(64), 0xDEADBEEFCAFEBABEull);
+    EXPECT_TRUE(reader.readBit());
+    EXPECT_EQ(reader.readBits(7), 0x3Fu);
+}
+
+/**
+ * @brief 测试累加时间步与带噪声数值的无损往返（跨越多个数据块）
+ */
+TEST_F(TimeSeriesCodecTest, LosslessRoundTripTest) {
+    const std::vector<std::string> columns = {"latitude", "altitude", "throttle", "force"};
+    std::mt19937 rng(42);
+    std::normal_distribution<double> noise(0.0, 0.5);
+
+    std::vector<double> times;
+    std::vector<std::vector<double>> rows;
+    double t = 0.0;
+    for (int i = 0; i < 2500; ++i) {
+        t += 0.01;  // 与仿真主循环一致的累加误差
+        times.push_back(t);
+        rows.push_back({30.0 + i * 1e-7, 100.0 + noise(rng), (i / 500) * 0.25, i % 7 == 0 ? -0.0 : 1.5e5 + noise(rng)});
+    }
+    rows[100][3] = std::numeric_limits<double>::infinity();
+    rows[101][3] = std::numeric_limits<double>::quiet_NaN();
+
+    {
+        CompressedChannelWriter writer(file_path, columns, 256);
+        ASSERT_TRUE(writer.isOpen());
+        for (size_t i = 0; i < times.size(); ++i) {
+            writer.append(times[i], rows[i]);
+        }
+        EXPECT_EQ(writer.getSampleCount(), times.size());
+    }
+
+    CompressedChannelReader reader(file_path);
+    ASSERT_TRUE(reader.isOpen());
+    EXPECT_EQ(reader.getColumnNames(), columns);
+    EXPECT_EQ(reader.getBlockSize(), 256u);
+
+    double timestamp = 0.0;
+    std::vector<double> values;
+    size_t count = 0;
+    while (reader.next(timestamp, values)) {
+        ASSERT_LT(count, times.size());
+        EXPECT_TRUE(sameBits(timestamp, times[count]));
+        for (size_t c = 0; c < columns.size(); ++c) {
+            EXPECT_TRUE(sameBits(values[c], rows[count][c])) << "row " << count << " col " << c;
+        }
+        ++count;
+    }
+    EXPECT_EQ(count, times.size());
+}
+
+/**
+ * @brief 测试常值通道的压缩率
+ */
+TEST_F(TimeSeriesCodecTest, ConstantChannelCompressionTest) {
+    {
+        CompressedChannelWriter writer(file_path, {"runway_length", "air_density"});
+        double t = 0.0;
+        for (int i = 0; i < 6000; ++i) {
+            t += 0.01;
+            writer.append(t, {3000.0, 1.225});
+        }
+    }
+    // 6000个样本，原始数据约 6000*3*8 = 144000 字节
+    EXPECT_LT(std::filesystem::file_size(file_path), 144000u / 10);
+}
+
+/**
+ * @brief 测试非法文件被拒绝
+ */
+TEST_F(TimeSeriesCodecTest, InvalidFileTest) {
+    {
+        std::ofstream out(file_path, std::ios::binary);
+        out << "SimulationTime latitude\n0.00 30.0\n";
+    }
+    CompressedChannelReader reader(file_path);
+    EXPECT_FALSE(reader.isOpen());
+    double timestamp;
+    std::vector<double> values;
+    EXPECT_FALSE(reader.next(timestamp, values));
+}
@@ -0,0 +1,125 @@
+/**
+ * @file test_trim_solver.cpp
+ * @brief 飞行动力学配平求解器单元测试
+ * @author VFT_SMF V3 Team
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+
+// 包含被测试的头文件
+#include "../../../../src/E_FlightDynamics/TrimSolver.hpp"
+
+using namespace VFT_SMF::FlightDynamics;
+using VFT_SMF::GlobalSharedDataStruct::AircraftFlightState;
+
+/**
+ * @brief 配平求解器测试类
+ */
+class TrimSolverTest : public ::testing::Test {
+protected:
+    TrimSolver solver;
+
+    /**
+     * @brief 以配平结果初始化飞行动力学代理并推进指定时长
+     */
+    AircraftFlightState simulate(const TrimResult& result, double duration) {
+        FlightDynamicsAgent agent("B737");
+        agent.initialize(result.flight_state);
+        AircraftFlightState state = result.flight_state;
+        for (int step = 0; step < static_cast<int>(duration / 0.01); ++step) {
+            state = agent.updateFromGlobalState(0.01, result.system_state, result.env_state);
+        }
+        return state;
+    }
+};
+
+/**
+ * @brief 测试平飞配平：收敛且各分量残差为零
+ */
+TEST_F(TrimSolverTest, LevelFlightTest) {
+    TrimTarget target;
+    target.airspeed = 120.0;
+    target.altitude = 1000.0;
+
+    const TrimResult result = solver.solve(target);
+    ASSERT_TRUE(result.converged) << "residual=" << result.residual_norm;
+    EXPECT_LT(result.iterations, 20);
+    for (double residual : result.residuals) {
+        EXPECT_NEAR(residual, 0.0, 1e-6);
+    }
+
+    EXPECT_GT(result.throttle, 0.0);
+    EXPECT_LT(result.throttle, 1.0);
+    EXPECT_GT(result.pitch, 0.0);            // 升力需要正攻角
+    EXPECT_NEAR(result.aileron, 0.0, 1e-6);
+    EXPECT_NEAR(result.rudder, 0.0, 1e-6);
+    EXPECT_NEAR(result.roll, 0.0, 1e-6);
+    EXPECT_DOUBLE_EQ(result.system_state.current_throttle_position, result.throttle);
+}
+
+/**
+ * @brief 测试配平状态在代理积分下保持稳定（仅有加速度噪声引起的微小漂移）
+ */
+TEST_F(TrimSolverTest, AgentStaysSettledTest) {
+    TrimTarget target;
+    target.airspeed = 120.0;
+    target.altitude = 1000.0;
+    const TrimResult result = solver.solve(target);
+    ASSERT_TRUE(result.converged);
+
+    const AircraftFlightState state = simulate(result, 10.0);
+    EXPECT_NEAR(state.airspeed, 120.0, 0.1);
+    EXPECT_NEAR(state.vertical_speed, 0.0, 0.1);
+    EXPECT_NEAR(state.altitude, 1000.0, 1.0);
+    EXPECT_NEAR(state.pitch, result.pitch, 0.1);
+    EXPECT_NEAR(state.roll, 0.0, 0.1);
+
+    // 对照：未配平的操纵量会在同样时长内明显偏离
+    TrimResult untrimmed = result;
+    untrimmed.system_state.current_throttle_position = 0.3;
+    untrimmed.flight_state.pitch = 0.0;
+    const AircraftFlightState drifted = simulate(untrimmed, 10.0);
+    EXPECT_GT(std::abs(drifted.vertical_speed) + std::abs(drifted.airspeed - 120.0), 1.0);
+}
+
+/**
+ * @brief 测试爬升与协调转弯：垂直速度与转弯角速度保持目标值
+ */
+TEST_F(TrimSolverTest, ClimbAndTurnTest) {
+    TrimTarget target;
+    target.airspeed = 100.0;
+    target.altitude = 1500.0;
+    target.flight_path_angle = 3.0;
+    target.turn_rate = 3.0;
+
+    const TrimResult result = solver.solve(target);
+    ASSERT_TRUE(result.converged) << "residual=" << result.residual_norm;
+    EXPECT_NEAR(result.flight_state.vertical_speed, 100.0 * std::sin(3.0 * M_PI / 180.0), 1e-9);
+    EXPECT_DOUBLE_EQ(result.flight_state.yaw_rate, 3.0);
+    EXPECT_GT(result.roll, 0.0);             // 右转需要右坡度
+
+    const AircraftFlightState state = simulate(result, 5.0);
+    EXPECT_NEAR(state.yaw_rate, 3.0, 0.1);
+    EXPECT_NEAR(state.vertical_speed, result.flight_state.vertical_speed, 0.1);
+    EXPECT_NEAR(state.roll, result.roll, 0.1);
+}
+
+/**
+ * @brief 测试超出操纵限幅的目标：报告未收敛且结果停留在限幅内
+ */
+TEST_F(TrimSolverTest, UnreachableTargetTest) {
+    TrimTarget target;
+    target.airspeed = 40.0;                  // 低于最大俯仰角对应的失速速度
+    target.altitude = 1000.0;
+
+    TrimOptions options;
+    options.max_iterations = 50;
+    const TrimResult result = solver.solve(target, options);
+    EXPECT_FALSE(result.converged);
+    EXPECT_GT(result.residual_norm, 1e-3);
+    EXPECT_LE(result.pitch, 30.0);
+    EXPECT_GE(result.throttle, 0.0);
+    EXPECT_LE(result.throttle, 1.0);
+}
@@ -11,8 +11,8 @@
 
 #include "../F_ScenarioModelling/B_ScenarioModel/VFT_SMF_Base.hpp"
 #include "A_StandardBase/IPilotStrategy.hpp"
+#include "../G_SimulationManager/B_SimManage/RandomService.hpp"
 #include <vector>
-#include <random>
 #include <algorithm>
 #include <memory>
 
@@ -60,10 +60,8 @@ namespace VFT_SMF {
         PilotManualControlImpact manual_control_impact;
         PilotDecisionImpact decision_impact;
         
-        // 随机数生成器
-        std::random_device rd;
-        std::mt19937 gen;
-        std::uniform_real_distribution<double> dist;
+        // 随机数流（按代理ID与仿真步号可复现）
+        SimManage::RandomStream rng;
         
         // 飞行员策略（根据配置的Pilot_ID动态选择）
         std::unique_ptr<IPilotStrategy> pilot_strategy;
@@ -18,8 +18,7 @@ namespace VFT_SMF {
           total_operations_performed(0),
           successful_operations(0),
           last_operation_time(0.0),
-          gen(rd()),
-          dist(0.0, 1.0) {
+          rng(SimManage::RandomService::stream("Pilot_001", "strategy")) {
         // 构造函数初始化
     }
 
@@ -27,11 +26,12 @@ namespace VFT_SMF {
                                        const std::string& id) {
         shared_data_space = data_space;
         agent_id = id;
+        rng = SimManage::RandomService::stream(id, "Pilot_001_strategy");
         total_operations_performed = 0;
         successful_operations = 0;
         last_operation_time = 0.0;
         
-        logBrief(LogLevel::Brief, "Pilot_001 策略初始化完成，代理ID: " + agent_id);
+        VFT_LOG_BRIEF("Pilot_001 策略初始化完成，代理ID: {}", agent_id);
     }
 
     bool Pilot_001_Strategy::executeTaxiControlController(const std::map<std::string, std::string>& params, 
@@ -39,12 +39,12 @@ namespace VFT_SMF {
         logPilotAction("taxi_control", "执行标准滑行控制");
         
         if (!validateOperationConditions(current_time)) {
-            logBrief(LogLevel::Brief, "Pilot_001: 操作条件验证失败，拒绝滑行控制");
+            VFT_LOG_BRIEF("Pilot_001: 操作条件验证失败，拒绝滑行控制");
             return false;
         }
 
         if (!shouldExecuteOperation("taxi_control", current_time)) {
-            logBrief(LogLevel::Brief, "Pilot_001: 滑行控制条件不满足");
+            VFT_LOG_BRIEF("Pilot_001: 滑行控制条件不满足");
             return false;
         }
 
@@ -52,7 +52,7 @@ namespace VFT_SMF {
         applyStandardPilotLogic("taxi_control");
         updateOperationMetrics("taxi_control", true);
         
-        logBrief(LogLevel::Brief, "Pilot_001: 滑行控制已执行 - 总操作数: " + std::to_string(total_operations_performed));
+        VFT_LOG_BRIEF("Pilot_001: 滑行控制已执行 - 总操作数: {}", total_operations_performed);
         return true;
     }
 
@@ -61,12 +61,12 @@ namespace VFT_SMF {
         logPilotAction("takeoff_control", "执行标准起飞控制");
         
         if (!validateOperationConditions(current_time)) {
-            logBrief(LogLevel::Brief, "Pilot_001: 操作条件验证失败，拒绝起飞控制");
+            VFT_LOG_BRIEF("Pilot_001: 操作条件验证失败，拒绝起飞控制");
             return false;
         }
 
         if (!shouldExecuteOperation("takeoff_control", current_time)) {
-            logBrief(LogLevel::Brief, "Pilot_001: 起飞控制条件不满足");
+            VFT_LOG_BRIEF("Pilot_001: 起飞控制条件不满足");
             return false;
         }
 
@@ -74,7 +74,7 @@ namespace VFT_SMF {
         applyStandardPilotLogic("takeoff_control");
         updateOperationMetrics("takeoff_control", true);
         
-        logBrief(LogLevel::Brief, "Pilot_001: 起飞控制已执行 - 总操作数: " + std::to_string(total_operations_performed));
+        VFT_LOG_BRIEF("Pilot_001: 起飞控制已执行 - 总操作数: {}", total_operations_performed);
         return true;
     }
 
@@ -83,12 +83,12 @@ namespace VFT_SMF {
         logPilotAction("landing_control", "执行标准着陆控制");
         
         if (!validateOperationConditions(current_time)) {
-            logBrief(LogLevel::Brief, "Pilot_001: 操作条件验证失败，拒绝着陆控制");
+            VFT_LOG_BRIEF("Pilot_001: 操作条件验证失败，拒绝着陆控制");
             return false;
         }
 
         if (!shouldExecuteOperation("landing_control", current_time)) {
-            logBrief(LogLevel::Brief, "Pilot_001: 着陆控制条件不满足");
+            VFT_LOG_BRIEF("Pilot_001: 着陆控制条件不满足");
             return false;
         }
 
@@ -96,7 +96,7 @@ namespace VFT_SMF {
         applyStandardPilotLogic("landing_control");
         updateOperationMetrics("landing_control", true);
         
-        logBrief(LogLevel::Brief, "Pilot_001: 着陆控制已执行 - 总操作数: " + std::to_string(total_operations_performed));
+        VFT_LOG_BRIEF("Pilot_001: 着陆控制已执行 - 总操作数: {}", total_operations_performed);
         return true;
     }
 
@@ -106,14 +106,14 @@ namespace VFT_SMF {
         
         // 紧急情况下，降低验证标准
         if (!shouldExecuteOperation("emergency_response", current_time)) {
-            logBrief(LogLevel::Brief, "Pilot_001: 紧急响应条件不满足，但继续执行");
+            VFT_LOG_BRIEF("Pilot_001: 紧急响应条件不满足，但继续执行");
         }
 
         // 执行紧急响应逻辑
         applyStandardPilotLogic("emergency_response");
         updateOperationMetrics("emergency_response", true);
         
-        logBrief(LogLevel::Brief, "Pilot_001: 紧急响应已执行 - 总操作数: " + std::to_string(total_operations_performed));
+        VFT_LOG_BRIEF("Pilot_001: 紧急响应已执行 - 总操作数: {}", total_operations_performed);
         return true;
     }
 
@@ -122,12 +122,12 @@ namespace VFT_SMF {
         logPilotAction("atc_command_response", "执行标准ATC指令响应");
         
         if (!validateOperationConditions(current_time)) {
-            logBrief(LogLevel::Brief, "Pilot_001: 操作条件验证失败，拒绝ATC指令响应");
+            VFT_LOG_BRIEF("Pilot_001: 操作条件验证失败，拒绝ATC指令响应");
             return false;
         }
 
         if (!shouldExecuteOperation("atc_command_response", current_time)) {
-            logBrief(LogLevel::Brief, "Pilot_001: ATC指令响应条件不满足");
+            VFT_LOG_BRIEF("Pilot_001: ATC指令响应条件不满足");
             return false;
         }
 
@@ -135,7 +135,7 @@ namespace VFT_SMF {
         applyStandardPilotLogic("atc_command_response");
         updateOperationMetrics("atc_command_response", true);
         
-        logBrief(LogLevel::Brief, "Pilot_001: ATC指令响应已执行 - 总操作数: " + std::to_string(total_operations_performed));
+        VFT_LOG_BRIEF("Pilot_001: ATC指令响应已执行 - 总操作数: {}", total_operations_performed);
         return true;
     }
 
@@ -146,12 +146,12 @@ namespace VFT_SMF {
     bool Pilot_001_Strategy::validateOperationConditions(double current_time) {
         // 检查基本操作条件
         if (skill_level < 0.3) {
-            logBrief(LogLevel::Brief, "Pilot_001: 技能水平过低，无法执行操作");
+            VFT_LOG_BRIEF("Pilot_001: 技能水平过低，无法执行操作");
             return false;
         }
         
         if (attention_level < 0.4) {
-            logBrief(LogLevel::Brief, "Pilot_001: 注意力水平过低，无法执行操作");
+            VFT_LOG_BRIEF("Pilot_001: 注意力水平过低，无法执行操作");
             return false;
         }
         
@@ -160,19 +160,18 @@ namespace VFT_SMF {
 
     void Pilot_001_Strategy::updatePilotState(double delta_time) {
         // 注意力水平随时间缓慢变化（模拟疲劳和恢复）
-        double attention_change = (dist(gen) - 0.5) * 0.01 * delta_time;
+        double attention_change = (rng.uniform() - 0.5) * 0.01 * delta_time;
         attention_level = std::clamp(attention_level + attention_change, 0.3, 1.0);
         
         // 技能水平相对稳定，但可能有微小波动
-        double skill_change = (dist(gen) - 0.5) * 0.005 * delta_time;
+        double skill_change = (rng.uniform() - 0.5) * 0.005 * delta_time;
         skill_level = std::clamp(skill_level + skill_change, 0.5, 0.9);
         
-        logDetail(LogLevel::Detail, "Pilot_001 状态更新 - 注意力: " + std::to_string(attention_level) + 
-                                   ", 技能: " + std::to_string(skill_level));
+        VFT_LOG_DETAIL("Pilot_001 状态更新 - 注意力: {}, 技能: {}", attention_level, skill_level);
     }
 
     void Pilot_001_Strategy::logPilotAction(const std::string& action_type, const std::string& action) {
-        logBrief(LogLevel::Brief, "Pilot_001 策略 (" + agent_id + "): " + action + " - " + action_type);
+        VFT_LOG_BRIEF("Pilot_001 策略 ({}): {} - {}", agent_id, action, action_type);
     }
 
     void Pilot_001_Strategy::updateOperationMetrics(const std::string& operation_type, bool success) {
@@ -182,9 +181,8 @@ namespace VFT_SMF {
         }
         last_operation_time = 0.0; // 重置操作时间
         
-        logBrief(LogLevel::Brief, "Pilot_001 策略: 操作 '" + operation_type + "' 完成. " +
-                                 "总操作数: " + std::to_string(total_operations_performed) + 
-                                 ", 成功率: " + std::to_string(static_cast<double>(successful_operations) / total_operations_performed * 100) + "%");
+        VFT_LOG_BRIEF("Pilot_001 策略: 操作 '{}' 完成. 总操作数: {}, 成功率: {}%",
+                      operation_type, total_operations_performed, static_cast<double>(successful_operations) / total_operations_performed * 100);
     }
 
     bool Pilot_001_Strategy::shouldExecuteOperation(const std::string& operation_type, double current_time) {
@@ -204,13 +202,13 @@ namespace VFT_SMF {
 
     void Pilot_001_Strategy::applyStandardPilotLogic(const std::string& operation_type) {
         // 应用标准飞行员逻辑
-        logDetail(LogLevel::Detail, "Pilot_001 策略: 应用标准逻辑到 " + operation_type);
+        VFT_LOG_DETAIL("Pilot_001 策略: 应用标准逻辑到 {}", operation_type);
         
         // 这里可以添加具体的飞行员逻辑实现
         // 例如：更新共享数据空间中的飞行员状态
         if (shared_data_space) {
             // 更新飞行员状态数据
-            logDetail(LogLevel::Detail, "Pilot_001 策略: 更新共享数据空间状态");
+            VFT_LOG_DETAIL("Pilot_001 策略: 更新共享数据空间状态");
         }
     }
 
@@ -16,10 +16,10 @@
 #include "../A_StandardBase/IPilotStrategy.hpp"
 #include "../PilotAgent.hpp"  // 包含PilotExperienceLevel定义
 #include "../../G_SimulationManager/LogAndData/Logger.hpp"
+#include "../../G_SimulationManager/B_SimManage/RandomService.hpp"
 #include <string>
 #include <map>
 #include <memory>
-#include <random>
 
 namespace VFT_SMF {
 
@@ -42,9 +42,7 @@ namespace VFT_SMF {
         double last_operation_time;
         
         // 随机数生成器（用于模拟真实飞行员的不确定性）
-        std::random_device rd;
-        std::mt19937 gen;
-        std::uniform_real_distribution<double> dist;
+        SimManage::RandomStream rng;
 
     public:
         Pilot_001_Strategy();
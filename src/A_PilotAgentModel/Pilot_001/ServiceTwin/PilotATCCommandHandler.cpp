@@ -12,14 +12,13 @@ namespace VFT_SMF {
 
     PilotATCCommandHandler::PilotATCCommandHandler(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDataSpace> data_space)
         : shared_data_space(data_space) {
-        logBrief(LogLevel::Brief, "飞行员ATC指令处理器创建完成");
+        VFT_LOG_BRIEF("飞行员ATC指令处理器创建完成");
     }
 
     void PilotATCCommandHandler::handlePilotATCCommand(const GlobalSharedDataStruct::StandardEvent& event,
                                                        double current_time) {
         
-        logBrief(LogLevel::Brief, "飞行员ATC指令处理器: 处理事件 " + event.event_name + 
-                " (ID: " + event.getEventIdString() + ") - 时间: " + std::to_string(current_time) + "s");
+        VFT_LOG_BRIEF("飞行员ATC指令处理器: 处理事件 {} (ID: {}) - 时间: {}s", event.event_name, event.getEventIdString(), current_time);
         
         // 获取事件的驱动过程信息
         const auto& driven_process = event.driven_process;
@@ -35,13 +34,13 @@ namespace VFT_SMF {
             executeEmergencyBrake(current_time);
             
         } else {
-            logBrief(LogLevel::Brief, "飞行员: 收到未知ATC指令: " + controller_name);
+            VFT_LOG_BRIEF("飞行员: 收到未知ATC指令: {}", controller_name);
         }
     }
 
     void PilotATCCommandHandler::executeTaxiClearance(double current_time) {
         // 飞行员接收并确认滑行许可
-        logBrief(LogLevel::Brief, "飞行员: 收到滑行许可，开始执行滑行程序");
+        VFT_LOG_BRIEF("飞行员: 收到滑行许可，开始执行滑行程序");
         
         // 飞行员确认ATC指令的逻辑
         // 这里可以更新飞行员状态，例如设置"已收到滑行许可"标志
@@ -58,13 +57,13 @@ namespace VFT_SMF {
             flight_state.airspeed += 0.3;
             shared_data_space->setAircraftFlightState(flight_state);
             
-            logBrief(LogLevel::Brief, "飞行员: 开始滑行，当前地速: " + std::to_string(flight_state.groundspeed) + " m/s");
+            VFT_LOG_BRIEF("飞行员: 开始滑行，当前地速: {} m/s", flight_state.groundspeed);
         }
     }
 
     void PilotATCCommandHandler::executeEmergencyBrake(double current_time) {
         // 飞行员接收紧急刹车指令
-        logBrief(LogLevel::Brief, "飞行员: 收到紧急刹车指令，立即执行紧急刹车");
+        VFT_LOG_BRIEF("飞行员: 收到紧急刹车指令，立即执行紧急刹车");
         
         // 飞行员执行紧急刹车
         auto flight_state = shared_data_space->getAircraftFlightState();
@@ -82,11 +81,11 @@ namespace VFT_SMF {
         atc_cmd.datasource = "pilot_atc_handler";
         shared_data_space->setATCCommand(atc_cmd);
         
-        logBrief(LogLevel::Brief, "飞行员: 紧急刹车执行完成，当前地速: " + std::to_string(flight_state.groundspeed) + " m/s");
+        VFT_LOG_BRIEF("飞行员: 紧急刹车执行完成，当前地速: {} m/s", flight_state.groundspeed);
     }
 
     void PilotATCCommandHandler::logPilotAction(const std::string& action, const std::string& details) {
-        logBrief(LogLevel::Brief, "飞行员: " + action + " - " + details);
+        VFT_LOG_BRIEF("飞行员: {} - {}", action, details);
     }
 
 } // namespace VFT_SMF
@@ -12,8 +12,7 @@ namespace VFT_SMF {
 void PilotManualControlHandler::handleManualControl(const GlobalSharedDataStruct::StandardEvent& event,
                                                     double current_time) {
     const auto& controller_name = event.driven_process.controller_name;
-    logBrief(LogLevel::Brief, "飞行员手动控制处理器: 定义操作意图 " + controller_name +
-            " (事件: " + event.event_name + ", 时间: " + std::to_string(current_time) + "s)");
+    VFT_LOG_BRIEF("飞行员手动控制处理器: 定义操作意图 {} (事件: {}, 时间: {}s)", controller_name, event.event_name, current_time);
 
     if (controller_name == "throttle_push2max") {
         executeThrottlePush2Max(current_time);
@@ -22,7 +21,7 @@ void PilotManualControlHandler::handleManualControl(const GlobalSharedDataStruct
     } else if (controller_name == "MaintainSPDRunway") {
         executeMaintainSPDRunway(current_time);
     } else {
-        logBrief(LogLevel::Brief, "飞行员手动控制处理器: 未知的控制器操作: " + controller_name);
+        VFT_LOG_BRIEF("飞行员手动控制处理器: 未知的控制器操作: {}", controller_name);
     }
 }
 
@@ -57,7 +56,7 @@ void PilotManualControlHandler::executeThrottlePush2Max(double current_time) {
                                1.0, current_time, "飞行员意图：推油门到最大");
     sendOperationIntent(intent);
     
-    logBrief(LogLevel::Brief, "飞行员: 定义推油门到最大意图 - 由飞机模型执行具体控制");
+    VFT_LOG_BRIEF("飞行员: 定义推油门到最大意图 - 由飞机模型执行具体控制");
 }
 
 // 2. 飞行员意图：推刹车到最大
@@ -67,7 +66,7 @@ void PilotManualControlHandler::executeBrakePush2Max(double current_time) {
                                1.0, current_time, "飞行员意图：推刹车到最大");
     sendOperationIntent(intent);
     
-    logBrief(LogLevel::Brief, "飞行员: 定义推刹车到最大意图 - 由飞机模型执行具体控制");
+    VFT_LOG_BRIEF("飞行员: 定义推刹车到最大意图 - 由飞机模型执行具体控制");
 }
 
 // 3. 飞行员意图：保持跑道速度
@@ -84,8 +83,7 @@ void PilotManualControlHandler::executeMaintainSPDRunway(double current_time) {
                                "飞行员意图：保持跑道速度 " + std::to_string(speed_hold_target) + " m/s");
     sendOperationIntent(intent);
     
-    logBrief(LogLevel::Brief, "飞行员: 定义速度保持意图 - 目标速度=" + std::to_string(speed_hold_target) + 
-            " m/s, 由飞机模型执行PID控制");
+    VFT_LOG_BRIEF("飞行员: 定义速度保持意图 - 目标速度={} m/s, 由飞机模型执行PID控制", speed_hold_target);
 }
 
 // ================================ 辅助方法 ================================
@@ -112,11 +110,11 @@ void PilotManualControlHandler::sendOperationIntent(const PilotOperationIntent&
             break;
             
         default:
-            logBrief(LogLevel::Brief, "飞行员: 未知的操作意图类型");
+            VFT_LOG_BRIEF("飞行员: 未知的操作意图类型");
             break;
     }
     
-    logBrief(LogLevel::Brief, "飞行员: 发送操作意图 - " + intent.description);
+    VFT_LOG_BRIEF("飞行员: 发送操作意图 - {}", intent.description);
     
     // 方式2：直接调用飞机模型接口（未来扩展）
     // 这里可以添加对飞机模型控制律的直接调用
@@ -17,10 +17,10 @@
 #include "../A_StandardBase/IPilotStrategy.hpp"
 #include "../PilotAgent.hpp"  // 包含PilotExperienceLevel定义
 #include "../../G_SimulationManager/LogAndData/Logger.hpp"
+#include "../../G_SimulationManager/B_SimManage/RandomService.hpp"
 #include <string>
 #include <map>
 #include <memory>
-#include <random>
 
 namespace VFT_SMF {
 
@@ -49,9 +49,7 @@ namespace VFT_SMF {
         double fatigue_resistance;   // 疲劳抵抗能力
         
         // 随机数生成器
-        std::random_device rd;
-        std::mt19937 gen;
-        std::uniform_real_distribution<double> dist;
+        SimManage::RandomStream rng;
 
     public:
         Pilot_002_Strategy();
@@ -33,7 +33,7 @@ namespace VFT_SMF {
         // 从飞机配置文件读取飞机类型
         load_aircraft_config();
         
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "飞行器代理创建完成");
+        VFT_LOG_BRIEF("飞行器代理创建完成");
     }
 
 
@@ -168,16 +168,16 @@ namespace VFT_SMF {
             // 暂时使用硬编码的映射，后续可以改为从共享数据空间读取配置
             if (agent_id == "Aircraft_001") {
                 aircraft_type = AircraftType::BOEING_737; // B737-800
-                VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "飞机 " + agent_id + " 配置加载完成: B737-800");
+                VFT_LOG_DETAIL("飞机 {} 配置加载完成: B737-800", agent_id);
             } else if (agent_id == "Aircraft_002") {
                 aircraft_type = AircraftType::AIRBUS_A320; // A320
-                VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "飞机 " + agent_id + " 配置加载完成: A320");
+                VFT_LOG_DETAIL("飞机 {} 配置加载完成: A320", agent_id);
             } else if (agent_id == "B737_Test") {
                 aircraft_type = AircraftType::BOEING_737; // B737测试
-                VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "飞机 " + agent_id + " 配置加载完成: B737测试");
+                VFT_LOG_DETAIL("飞机 {} 配置加载完成: B737测试", agent_id);
             } else {
                 aircraft_type = AircraftType::BOEING_737; // 默认B737
-                VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "飞机 " + agent_id + " 使用默认配置: B737");
+                VFT_LOG_DETAIL("飞机 {} 使用默认配置: B737", agent_id);
             }
             
             // TODO: 从共享数据空间读取详细配置
@@ -186,7 +186,7 @@ namespace VFT_SMF {
             
         }
         catch (const std::exception& e) {
-            VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "飞机配置加载失败: " + std::string(e.what()) + "，使用默认配置");
+            VFT_LOG_DETAIL("飞机配置加载失败: {}，使用默认配置", e.what());
             aircraft_type = AircraftType::BOEING_737; // 默认B737
         }
     }
@@ -261,7 +261,7 @@ namespace VFT_SMF {
         
         // 如果数字孪生不可用，返回默认状态
         VFT_SMF::GlobalSharedDataStruct::AircraftSystemState system_state;
-        system_state.datasource = "aircraft_system";
+        system_state.datasource = VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::intern("aircraft_system");
         
         // 设置默认系统状态数据
         system_state.current_mass = 70000.0; // kg，B737典型质量
@@ -341,8 +341,7 @@ namespace VFT_SMF {
     bool AircraftAgent::executeController(const std::string& controller_name, 
                                         const std::map<std::string, std::string>& params,
                                         double current_time) {
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-            "飞机代理执行控制器: " + controller_name + " (时间: " + std::to_string(current_time) + "s)");
+        VFT_LOG_BRIEF("飞机代理执行控制器: {} (时间: {}s)", controller_name, current_time);
         
         bool executed = false;
         
@@ -351,16 +350,13 @@ namespace VFT_SMF {
         } else if (controller_name == "Break_Half") {
             executed = executeBreakHalfController(params, current_time);
         } else {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                "飞机代理: 未知的控制器名称: " + controller_name);
+            VFT_LOG_BRIEF("飞机代理: 未知的控制器名称: {}", controller_name);
         }
         
         if (executed) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                "飞机代理控制器执行成功: " + controller_name);
+            VFT_LOG_BRIEF("飞机代理控制器执行成功: {}", controller_name);
         } else {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                "飞机代理控制器执行失败: " + controller_name);
+            VFT_LOG_BRIEF("飞机代理控制器执行失败: {}", controller_name);
         }
         
         return executed;
@@ -369,7 +365,7 @@ namespace VFT_SMF {
     // 处理代理事件队列
     int AircraftAgent::processAgentEventQueue(double current_time) {
         if (!shared_data_space) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "飞机代理: 全局共享数据空间未设置");
+            VFT_LOG_BRIEF("飞机代理: 全局共享数据空间未设置");
             return 0;
         }
         
@@ -378,26 +374,21 @@ namespace VFT_SMF {
         
         // 处理代理事件队列中的所有事件
         while (shared_data_space->dequeueAgentEvent(get_agent_id(), queue_item)) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                "飞机代理处理事件: " + queue_item.event.event_name + 
-                " (控制器: " + queue_item.controller_type + "::" + queue_item.controller_name + ")");
+            VFT_LOG_BRIEF("飞机代理处理事件: {} (控制器: {}::{})", queue_item.event.event_name, queue_item.controller_type, queue_item.controller_name);
             
             // 执行对应的控制器
             bool executed = executeController(queue_item.controller_name, queue_item.parameters, current_time);
             
             if (executed) {
                 processed_count++;
-                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                    "飞机代理事件处理成功: " + queue_item.event.event_name);
+                VFT_LOG_BRIEF("飞机代理事件处理成功: {}", queue_item.event.event_name);
             } else {
-                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                    "飞机代理事件处理失败: " + queue_item.event.event_name);
+                VFT_LOG_BRIEF("飞机代理事件处理失败: {}", queue_item.event.event_name);
             }
         }
         
         if (processed_count > 0) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                "飞机代理本步处理事件数量: " + std::to_string(processed_count));
+            VFT_LOG_BRIEF("飞机代理本步处理事件数量: {}", processed_count);
         }
         
         return processed_count;
@@ -407,10 +398,10 @@ namespace VFT_SMF {
 
     // 执行左发动机失效控制器
     bool AircraftAgent::executeLeftEngineOutController(const std::map<std::string, std::string>& params, double current_time) {
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "飞机代理: 执行左发动机失效控制器");
+        VFT_LOG_BRIEF("飞机代理: 执行左发动机失效控制器");
         
         if (!shared_data_space) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "飞机代理: 全局共享数据空间未设置");
+            VFT_LOG_BRIEF("飞机代理: 全局共享数据空间未设置");
             return false;
         }
         
@@ -418,29 +409,29 @@ namespace VFT_SMF {
         auto system_state = shared_data_space->getAircraftSystemState();
         system_state.left_engine_failed = true;
         system_state.left_engine_rpm = 0.0;  // 左发动机转速为0
-        system_state.datasource = "Aircraft_001_Left_Engine_Out_Controller";
+        system_state.datasource = VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::intern("Aircraft_001_Left_Engine_Out_Controller");
         shared_data_space->setAircraftSystemState(system_state);
         
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "飞机代理: 左发动机失效，left_engine_failed设置为true，left_engine_rpm设置为0");
+        VFT_LOG_BRIEF("飞机代理: 左发动机失效，left_engine_failed设置为true，left_engine_rpm设置为0");
         return true;
     }
 
     // 执行刹车效率降低控制器
     bool AircraftAgent::executeBreakHalfController(const std::map<std::string, std::string>& params, double current_time) {
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "飞机代理: 执行刹车效率降低控制器");
+        VFT_LOG_BRIEF("飞机代理: 执行刹车效率降低控制器");
         
         if (!shared_data_space) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "飞机代理: 全局共享数据空间未设置");
+            VFT_LOG_BRIEF("飞机代理: 全局共享数据空间未设置");
             return false;
         }
         
         // 更新飞机系统状态：刹车效率降低
         auto system_state = shared_data_space->getAircraftSystemState();
         system_state.brake_efficiency = 0.5;  // 刹车效率降低到50%
-        system_state.datasource = "Aircraft_001_Break_Half_Controller";
+        system_state.datasource = VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::intern("Aircraft_001_Break_Half_Controller");
         shared_data_space->setAircraftSystemState(system_state);
         
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "飞机代理: 刹车效率降低，brake_efficiency设置为0.5");
+        VFT_LOG_BRIEF("飞机代理: 刹车效率降低，brake_efficiency设置为0.5");
         return true;
     }
 
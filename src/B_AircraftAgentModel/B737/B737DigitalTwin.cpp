@@ -16,13 +16,17 @@ namespace VFT_SMF {
     // ==================== 构造函数 ====================
     
     B737DigitalTwin::B737DigitalTwin(const std::string& id)
-        : aircraft_id(id), aircraft_name("B737_" + id), initialized(false), running(false), paused(false) {
+        : aircraft_id(id), aircraft_name("B737_" + id),
+          datasource_id(GlobalSharedDataStruct::DataSourceRegistry::intern("B737_DigitalTwin_" + id)),
+          initialized(false), running(false), paused(false) {
         initialize_components();
         update_cached_states(); // 初始化缓存状态
     }
 
     B737DigitalTwin::B737DigitalTwin(const std::string& id, const std::string& name)
-        : aircraft_id(id), aircraft_name(name), initialized(false), running(false), paused(false) {
+        : aircraft_id(id), aircraft_name(name),
+          datasource_id(GlobalSharedDataStruct::DataSourceRegistry::intern("B737_DigitalTwin_" + id)),
+          initialized(false), running(false), paused(false) {
         initialize_components();
         update_cached_states(); // 初始化缓存状态
     }
@@ -31,7 +35,7 @@ namespace VFT_SMF {
     
     void B737DigitalTwin::initialize() {
         if (initialized) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "B737数字孪生已经初始化: " + aircraft_id);
+            VFT_LOG_BRIEF("B737数字孪生已经初始化: {}", aircraft_id);
             return;
         }
 
@@ -40,64 +44,64 @@ namespace VFT_SMF {
             // 暂时注释掉，因为B737_DigitalTwin是header-only实现
             // if (data_twin) {
             //     // 数据层初始化逻辑
-            //     VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "B737数据层初始化完成: " + aircraft_id);
+            //     VFT_LOG_BRIEF("B737数据层初始化完成: {}", aircraft_id);
             // }
 
             // 初始化模型层
             if (model_twin) {
                 // 模型层初始化逻辑
-                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "B737模型层初始化完成: " + aircraft_id);
+                VFT_LOG_BRIEF("B737模型层初始化完成: {}", aircraft_id);
             }
 
             // 初始化服务层
             if (state_manager) {
                 state_manager->initialize();
-                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "B737状态管理器初始化完成: " + aircraft_id);
+                VFT_LOG_BRIEF("B737状态管理器初始化完成: {}", aircraft_id);
             }
 
             initialized = true;
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "B737数字孪生初始化完成: " + aircraft_id);
+            VFT_LOG_BRIEF("B737数字孪生初始化完成: {}", aircraft_id);
         } catch (const std::exception& e) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "B737数字孪生初始化失败: " + std::string(e.what()));
+            VFT_LOG_BRIEF("B737数字孪生初始化失败: {}", e.what());
             initialized = false;
         }
     }
 
     void B737DigitalTwin::start() {
         if (!initialized) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "B737数字孪生未初始化，无法启动: " + aircraft_id);
+            VFT_LOG_BRIEF("B737数字孪生未初始化，无法启动: {}", aircraft_id);
             return;
         }
 
         running = true;
         paused = false;
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "B737数字孪生启动: " + aircraft_id);
+        VFT_LOG_BRIEF("B737数字孪生启动: {}", aircraft_id);
     }
 
     void B737DigitalTwin::pause() {
         if (!running) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "B737数字孪生未运行，无法暂停: " + aircraft_id);
+            VFT_LOG_BRIEF("B737数字孪生未运行，无法暂停: {}", aircraft_id);
             return;
         }
 
         paused = true;
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "B737数字孪生暂停: " + aircraft_id);
+        VFT_LOG_BRIEF("B737数字孪生暂停: {}", aircraft_id);
     }
 
     void B737DigitalTwin::resume() {
         if (!paused) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "B737数字孪生未暂停，无法恢复: " + aircraft_id);
+            VFT_LOG_BRIEF("B737数字孪生未暂停，无法恢复: {}", aircraft_id);
             return;
         }
 
         paused = false;
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "B737数字孪生恢复: " + aircraft_id);
+        VFT_LOG_BRIEF("B737数字孪生恢复: {}", aircraft_id);
     }
 
     void B737DigitalTwin::stop() {
         running = false;
         paused = false;
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "B737数字孪生停止: " + aircraft_id);
+        VFT_LOG_BRIEF("B737数字孪生停止: {}", aircraft_id);
     }
 
     void B737DigitalTwin::update(double delta_time) {
@@ -151,7 +155,7 @@ namespace VFT_SMF {
     
     GlobalSharedDataStruct::AircraftSystemState B737DigitalTwin::getAircraftSystemState() const {
         GlobalSharedDataStruct::AircraftSystemState system_state;
-        system_state.datasource = "B737_DigitalTwin_" + aircraft_id;
+        system_state.datasource = datasource_id;
         
         // 设置系统状态数据
         system_state.current_mass = cached_current_mass;
@@ -284,7 +288,7 @@ namespace VFT_SMF {
     }
 
     void B737DigitalTwin::emergency_procedures() {
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "B737执行紧急程序: " + aircraft_id);
+        VFT_LOG_BRIEF("B737执行紧急程序: {}", aircraft_id);
     }
 
     // ==================== 性能监控接口 ====================
@@ -354,7 +358,7 @@ namespace VFT_SMF {
         // 更新缓存状态
         update_cached_states();
         
-        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "B737数字孪生状态已更新: " + aircraft_id);
+        VFT_LOG_DETAIL("B737数字孪生状态已更新: {}", aircraft_id);
     }
 
     // ==================== 私有辅助方法 ====================
@@ -371,9 +375,9 @@ namespace VFT_SMF {
             // 创建服务层组件
             state_manager = std::make_unique<ServiceTwin_StateManager>(aircraft_id, AircraftType::BOEING_737);
             
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "B737数字孪生组件创建完成: " + aircraft_id);
+            VFT_LOG_BRIEF("B737数字孪生组件创建完成: {}", aircraft_id);
         } catch (const std::exception& e) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "B737数字孪生组件创建失败: " + std::string(e.what()));
+            VFT_LOG_BRIEF("B737数字孪生组件创建失败: {}", e.what());
         }
     }
 
@@ -414,24 +418,19 @@ namespace VFT_SMF {
                     cached_thrust = 0.0;
                     cached_power_output = 0.0;
                     
-                    VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, 
-                        "B737数字孪生从飞行计划更新缓存状态: 油门=" + std::to_string(cached_throttle_position) +
-                        ", 燃油=" + std::to_string(cached_fuel_remaining));
+                    VFT_LOG_DETAIL("B737数字孪生从飞行计划更新缓存状态: 油门={}, 燃油={}", cached_throttle_position, cached_fuel_remaining);
                 } catch (const std::exception& e) {
-                    VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, 
-                        "B737数字孪生解析飞行计划数据失败: " + std::string(e.what()) + "，使用默认值");
+                    VFT_LOG_DETAIL("B737数字孪生解析飞行计划数据失败: {}，使用默认值", e.what());
                     // 解析失败时使用默认值
                     set_default_cached_states();
                 }
             } else {
-                VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, 
-                    "B737数字孪生未找到飞行计划中的飞机初始状态，使用默认值");
+                VFT_LOG_DETAIL("B737数字孪生未找到飞行计划中的飞机初始状态，使用默认值");
                 // 未找到飞机初始状态时使用默认值
                 set_default_cached_states();
             }
         } else {
-            VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, 
-                "B737数字孪生没有全局数据空间，使用默认值");
+            VFT_LOG_DETAIL("B737数字孪生没有全局数据空间，使用默认值");
             // 没有全局数据空间时使用默认值
             set_default_cached_states();
         }
@@ -453,8 +452,7 @@ namespace VFT_SMF {
         cached_thrust = 0.0;
         cached_power_output = 0.0;
         
-        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, 
-            "B737数字孪生使用默认缓存状态: 油门=" + std::to_string(cached_throttle_position));
+        VFT_LOG_DETAIL("B737数字孪生使用默认缓存状态: 油门={}", cached_throttle_position);
     }
 
     void B737DigitalTwin::validate_initialization() const {
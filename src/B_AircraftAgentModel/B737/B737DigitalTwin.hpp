@@ -29,6 +29,7 @@ namespace VFT_SMF {
     private:
         std::string aircraft_id;
         std::string aircraft_name;
+        GlobalSharedDataStruct::DataSourceId datasource_id;   ///< 驻留的数据来源ID（"B737_DigitalTwin_<id>"）
         
         // ==================== 数据层组件 ====================
         // 暂时注释掉，因为B737_DigitalTwin是header-only实现
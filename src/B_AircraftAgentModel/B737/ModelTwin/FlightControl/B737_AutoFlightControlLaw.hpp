@@ -177,6 +177,11 @@ public:
     void set_roll_gains(double kp, double ki, double kd);
     void set_pitch_gains(double kp, double ki, double kd);
     void set_yaw_gains(double kp, double ki, double kd);
+    
+    // 参数查询
+    const PIDController& get_roll_controller() const { return roll_controller; }
+    const PIDController& get_pitch_controller() const { return pitch_controller; }
+    const PIDController& get_yaw_controller() const { return yaw_controller; }
 };
 
 /**
@@ -206,6 +211,10 @@ public:
     // 参数设置
     void set_speed_gains(double kp, double ki, double kd);
     void set_n1_gains(double kp, double ki, double kd);
+    
+    // 参数查询
+    const PIDController& get_speed_controller() const { return speed_controller; }
+    const PIDController& get_n1_controller() const { return n1_controller; }
 };
 
 /**
@@ -234,6 +243,10 @@ public:
     // 参数设置
     void set_roll_gains(double kp, double ki, double kd);
     void set_pitch_gains(double kp, double ki, double kd);
+    
+    // 参数查询
+    const PIDController& get_roll_controller() const { return roll_controller; }
+    const PIDController& get_pitch_controller() const { return pitch_controller; }
 };
 
 /**
@@ -259,6 +272,9 @@ public:
     
     // 参数设置
     void set_gains(double kp, double ki, double kd);
+    
+    // 参数查询
+    const PIDController& get_yaw_rate_controller() const { return yaw_rate_controller; }
 };
 
 /**
@@ -37,14 +37,8 @@ namespace VFT_SMF {
 
     void ControlPriorityManager::logControlCommand(const GlobalSharedDataStruct::ControlCommand& command, 
                                                   const std::string& action) const {
-        logBrief(LogLevel::Brief, "控制优先级管理器: " + action + 
-                " - 源: " + command.source + 
-                ", 优先级: " + std::to_string(static_cast<int>(command.priority)) +
-                ", 油门: " + std::to_string(command.throttle_command) +
-                ", 升降舵: " + std::to_string(command.elevator_command) +
-                ", 副翼: " + std::to_string(command.aileron_command) +
-                ", 方向舵: " + std::to_string(command.rudder_command) +
-                ", 刹车: " + std::to_string(command.brake_command));
+        VFT_LOG_BRIEF("控制优先级管理器: {} - 源: {}, 优先级: {}, 油门: {}, 升降舵: {}, 副翼: {}, 方向舵: {}, 刹车: {}",
+                      action, command.source, static_cast<int>(command.priority), command.throttle_command, command.elevator_command, command.aileron_command, command.rudder_command, command.brake_command);
     }
 
     void ControlPriorityManager::limitControlCommand(GlobalSharedDataStruct::ControlCommand& command) const {
@@ -77,7 +71,7 @@ namespace VFT_SMF {
             shared_data_space->setControlCommand(command);
             logControlCommand(command, "设置飞行员手动控制指令");
         } else {
-            logBrief(LogLevel::Brief, "控制优先级管理器: 飞行员手动控制指令未通过安全检查");
+            VFT_LOG_BRIEF("控制优先级管理器: 飞行员手动控制指令未通过安全检查");
         }
     }
 
@@ -100,7 +94,7 @@ namespace VFT_SMF {
             shared_data_space->setControlCommand(command);
             logControlCommand(command, "设置自动驾驶仪控制指令");
         } else {
-            logBrief(LogLevel::Brief, "控制优先级管理器: 自动驾驶仪控制指令未通过安全检查");
+            VFT_LOG_BRIEF("控制优先级管理器: 自动驾驶仪控制指令未通过安全检查");
         }
     }
 
@@ -122,7 +116,7 @@ namespace VFT_SMF {
             shared_data_space->setControlCommand(command);
             logControlCommand(command, "设置自动油门控制指令");
         } else {
-            logBrief(LogLevel::Brief, "控制优先级管理器: 自动油门控制指令未通过安全检查");
+            VFT_LOG_BRIEF("控制优先级管理器: 自动油门控制指令未通过安全检查");
         }
     }
 
@@ -144,31 +138,31 @@ namespace VFT_SMF {
         // 紧急控制指令跳过安全检查
         shared_data_space->setControlCommand(command);
         logControlCommand(command, "设置紧急控制指令");
-        logBrief(LogLevel::Brief, "控制优先级管理器: 紧急控制指令已激活，覆盖所有其他控制源");
+        VFT_LOG_BRIEF("控制优先级管理器: 紧急控制指令已激活，覆盖所有其他控制源");
     }
 
     void ControlPriorityManager::clearControlCommand(GlobalSharedDataStruct::ControlPriority priority) {
         shared_data_space->clearControlCommand(priority);
-        logBrief(LogLevel::Brief, "控制优先级管理器: 清除优先级 " + std::to_string(static_cast<int>(priority)) + " 的控制指令");
+        VFT_LOG_BRIEF("控制优先级管理器: 清除优先级 {} 的控制指令", static_cast<int>(priority));
     }
 
     void ControlPriorityManager::clearAllControlCommands() {
         auto manager = shared_data_space->getControlPriorityManager();
         manager.clearAllCommands();
         shared_data_space->setControlPriorityManager(manager);
-        logBrief(LogLevel::Brief, "控制优先级管理器: 清除所有控制指令");
+        VFT_LOG_BRIEF("控制优先级管理器: 清除所有控制指令");
     }
 
     // ==================== 控制源状态管理 ====================
 
     void ControlPriorityManager::activateControlSource(const std::string& source_name) {
         control_source_status[source_name] = true;
-        logBrief(LogLevel::Brief, "控制优先级管理器: 激活控制源 " + source_name);
+        VFT_LOG_BRIEF("控制优先级管理器: 激活控制源 {}", source_name);
     }
 
     void ControlPriorityManager::deactivateControlSource(const std::string& source_name) {
         control_source_status[source_name] = false;
-        logBrief(LogLevel::Brief, "控制优先级管理器: 停用控制源 " + source_name);
+        VFT_LOG_BRIEF("控制优先级管理器: 停用控制源 {}", source_name);
     }
 
     bool ControlPriorityManager::isControlSourceActive(const std::string& source_name) const {
@@ -195,27 +189,27 @@ namespace VFT_SMF {
     bool ControlPriorityManager::validateControlCommand(const GlobalSharedDataStruct::ControlCommand& command) const {
         // 基本范围检查
         if (command.throttle_command < 0.0 || command.throttle_command > 1.0) {
-            logBrief(LogLevel::Brief, "控制优先级管理器: 油门指令超出范围 [0.0, 1.0]");
+            VFT_LOG_BRIEF("控制优先级管理器: 油门指令超出范围 [0.0, 1.0]");
             return false;
         }
         
         if (std::abs(command.elevator_command) > 1.0) {
-            logBrief(LogLevel::Brief, "控制优先级管理器: 升降舵指令超出范围 [-1.0, 1.0]");
+            VFT_LOG_BRIEF("控制优先级管理器: 升降舵指令超出范围 [-1.0, 1.0]");
             return false;
         }
         
         if (std::abs(command.aileron_command) > 1.0) {
-            logBrief(LogLevel::Brief, "控制优先级管理器: 副翼指令超出范围 [-1.0, 1.0]");
+            VFT_LOG_BRIEF("控制优先级管理器: 副翼指令超出范围 [-1.0, 1.0]");
             return false;
         }
         
         if (std::abs(command.rudder_command) > 1.0) {
-            logBrief(LogLevel::Brief, "控制优先级管理器: 方向舵指令超出范围 [-1.0, 1.0]");
+            VFT_LOG_BRIEF("控制优先级管理器: 方向舵指令超出范围 [-1.0, 1.0]");
             return false;
         }
         
         if (command.brake_command < 0.0 || command.brake_command > 1.0) {
-            logBrief(LogLevel::Brief, "控制优先级管理器: 刹车指令超出范围 [0.0, 1.0]");
+            VFT_LOG_BRIEF("控制优先级管理器: 刹车指令超出范围 [0.0, 1.0]");
             return false;
         }
 
@@ -233,10 +227,10 @@ namespace VFT_SMF {
         
         // 优先级高的指令获胜
         if (static_cast<int>(command1.priority) < static_cast<int>(command2.priority)) {
-            logBrief(LogLevel::Brief, "控制优先级管理器: 解决冲突，选择优先级更高的指令: " + command1.source);
+            VFT_LOG_BRIEF("控制优先级管理器: 解决冲突，选择优先级更高的指令: {}", command1.source);
             return command1;
         } else {
-            logBrief(LogLevel::Brief, "控制优先级管理器: 解决冲突，选择优先级更高的指令: " + command2.source);
+            VFT_LOG_BRIEF("控制优先级管理器: 解决冲突，选择优先级更高的指令: {}", command2.source);
             return command2;
         }
     }
@@ -253,13 +247,11 @@ namespace VFT_SMF {
             system_state.current_rudder_deflection = final_command.rudder_command * 50.0;
             system_state.current_brake_pressure = final_command.brake_command * 1e6; // 转换为Pa
             system_state.timestamp = SimulationTimePoint{};
-            system_state.datasource = "control_priority_manager";
+            static const auto control_priority_source =
+                GlobalSharedDataStruct::DataSourceRegistry::intern("control_priority_manager");
+            shared_data_space->setAircraftSystemState(system_state, control_priority_source);
             
-            shared_data_space->setAircraftSystemState(system_state, "control_priority_manager");
-            
-            logBrief(LogLevel::Brief, "控制优先级管理器: 应用最终控制指令 - 源: " + final_command.source +
-                    ", 油门: " + std::to_string(final_command.throttle_command) +
-                    ", 刹车: " + std::to_string(final_command.brake_command));
+            VFT_LOG_BRIEF("控制优先级管理器: 应用最终控制指令 - 源: {}, 油门: {}, 刹车: {}", final_command.source, final_command.throttle_command, final_command.brake_command);
         }
     }
 
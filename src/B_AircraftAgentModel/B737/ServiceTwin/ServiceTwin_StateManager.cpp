@@ -51,7 +51,7 @@ namespace VFT_SMF {
     }
 
     VFT_SMF::GlobalSharedDataStruct::AircraftSystemState ServiceTwin_StateManager::get_system_state(const std::string& system_name) const {
-        std::shared_lock<std::shared_mutex> lock(system_state_mutex);
+        std::shared_lock<VFT_SMF::SimManage::InstrumentedSharedMutex> lock(system_state_mutex);
         auto it = system_states.find(system_name);
         if (it != system_states.end()) {
             return it->second;
@@ -60,13 +60,13 @@ namespace VFT_SMF {
     }
 
     void ServiceTwin_StateManager::update_system_state(const std::string& system_name, const VFT_SMF::GlobalSharedDataStruct::AircraftSystemState& state) {
-        std::unique_lock<std::shared_mutex> lock(system_state_mutex);
+        std::unique_lock<VFT_SMF::SimManage::InstrumentedSharedMutex> lock(system_state_mutex);
         system_states[system_name] = state;
         last_update_time = state.timestamp;
     }
 
     void ServiceTwin_StateManager::add_system(const std::string& name) {
-        std::unique_lock<std::shared_mutex> lock(system_state_mutex);
+        std::unique_lock<VFT_SMF::SimManage::InstrumentedSharedMutex> lock(system_state_mutex);
         system_states.emplace(name, VFT_SMF::GlobalSharedDataStruct::AircraftSystemState{});
     }
 
@@ -75,7 +75,7 @@ namespace VFT_SMF {
     }
 
     std::string ServiceTwin_StateManager::get_system_state_summary() const {
-        std::shared_lock<std::shared_mutex> lock(system_state_mutex);
+        std::shared_lock<VFT_SMF::SimManage::InstrumentedSharedMutex> lock(system_state_mutex);
         return "系统数: " + std::to_string(system_states.size());
     }
 
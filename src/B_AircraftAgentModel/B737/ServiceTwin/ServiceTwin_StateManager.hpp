@@ -36,7 +36,7 @@ namespace VFT_SMF {
         VFT_SMF::SimulationTimePoint last_update_time;
         
         // 线程安全
-        mutable std::shared_mutex system_state_mutex;
+        mutable VFT_SMF::SimManage::InstrumentedSharedMutex system_state_mutex{"ServiceTwin_StateManager.system_state"};
         
         // 服务状态
         bool initialized;
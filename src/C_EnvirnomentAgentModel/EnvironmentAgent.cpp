@@ -26,19 +26,18 @@ namespace VFT_SMF {
           current_weather(WeatherCondition::CLEAR),
           weather_stability(0.8),
           change_rate(0.1),
-          gen(rd()),
-          dist(0.0, 1.0) {
+          rng(SimManage::RandomService::stream("environment_model", "weather")) {
     }
 
     void EnvironmentModel::step(double delta_time) {
         // 基于天气稳定性决定是否发生天气变化
-        if (dist(gen) > weather_stability) {
+        if (rng.uniform() > weather_stability) {
             // 天气可能发生变化
             double change_probability = change_rate * delta_time;
-            if (dist(gen) < change_probability) {
+            if (rng.uniform() < change_probability) {
                 // 随机选择新的天气状况
                 int weather_options = static_cast<int>(WeatherCondition::TURBULENT) + 1;
-                int new_weather = static_cast<int>(dist(gen) * weather_options);
+                int new_weather = static_cast<int>(rng.uniform() * weather_options);
                 current_weather = static_cast<WeatherCondition>(new_weather);
             }
         }
@@ -56,8 +55,7 @@ namespace VFT_SMF {
           average_update_time(0.0),
           airport_code(env_config.airport_code),
           runway_code(env_config.runway_code),
-          gen(rd()),
-          dist(0.0, 1.0) {
+          rng(SimManage::RandomService::stream(id, "environment_update")) {
         
         agent_id = id;
         agent_name = name;
@@ -68,7 +66,7 @@ namespace VFT_SMF {
         environment_model = std::make_unique<EnvironmentModel>(type);
         
         // 创建配置管理器
-        config_manager = std::make_unique<EnvironmentConfigManager>("../../src/C_EnvirnomentAgentModel/");
+        config_manager = std::make_unique<EnvironmentConfigManager>(env_config.config_directory);
         
         // 初始化环境数据
         initialize_environment_data();
@@ -76,37 +74,37 @@ namespace VFT_SMF {
         // 设置默认环境模型名称
         environment_model_name = "Default_Environment";
         
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "环境代理创建完成");
+        VFT_LOG_BRIEF("环境代理创建完成");
     }
 
     void EnvironmentAgent::initialize() {
-        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "环境代理初始化: " + get_agent_name());
+        VFT_LOG_DETAIL("环境代理初始化: {}", get_agent_name());
         set_current_state(AgentState::READY);
     }
 
     void EnvironmentAgent::start() {
-        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "环境代理启动: " + get_agent_name());
+        VFT_LOG_DETAIL("环境代理启动: {}", get_agent_name());
         set_current_state(AgentState::RUNNING);
     }
 
     void EnvironmentAgent::pause() {
-        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "环境代理暂停: " + get_agent_name());
+        VFT_LOG_DETAIL("环境代理暂停: {}", get_agent_name());
         set_current_state(AgentState::PAUSED);
     }
 
     void EnvironmentAgent::resume() {
-        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "环境代理恢复: " + get_agent_name());
+        VFT_LOG_DETAIL("环境代理恢复: {}", get_agent_name());
         set_current_state(AgentState::RUNNING);
     }
 
     void EnvironmentAgent::stop() {
-        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "环境代理停止: " + get_agent_name());
+        VFT_LOG_DETAIL("环境代理停止: {}", get_agent_name());
         set_current_state(AgentState::STOPPED);
     }
 
     void EnvironmentAgent::update(double delta_time) {
         if (get_current_state() != AgentState::RUNNING) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "环境代理状态不是RUNNING，当前状态: " + std::to_string(static_cast<int>(get_current_state())));
+            VFT_LOG_BRIEF("环境代理状态不是RUNNING，当前状态: {}", static_cast<int>(get_current_state()));
             return;
         }
         
@@ -114,8 +112,7 @@ namespace VFT_SMF {
         processAgentEventQueue(delta_time);
         
         // 记录时钟通知
-        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "环境代理 [" + get_agent_id() + "] 收到时钟通知，时间步长: " + 
-                           std::to_string(delta_time) + " 秒");
+        VFT_LOG_DETAIL("环境代理 [{}] 收到时钟通知，时间步长: {} 秒", get_agent_id(), delta_time);
         
         // 更新环境模型
         environment_model->step(delta_time);
@@ -127,43 +124,41 @@ namespace VFT_SMF {
         EnvironmentEvent current_event = generate_environment_event();
         
         // 记录事件生成
-        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "环境代理生成事件: " + current_event.event_name + 
-                           " (严重程度: " + std::to_string(current_event.severity) + ")");
+        VFT_LOG_DETAIL("环境代理生成事件: {} (严重程度: {})", current_event.event_name, current_event.severity);
         
         // 更新性能统计
         total_events_generated++;
         
         // 记录当前状态
-        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "环境代理状态 - 天气: " + std::to_string(static_cast<int>(get_current_weather())) + 
-                           ", 稳定性: " + std::to_string(environment_model->get_weather_stability()) + 
-                           ", 变化率: " + std::to_string(environment_model->get_change_rate()));
+        VFT_LOG_DETAIL("环境代理状态 - 天气: {}, 稳定性: {}, 变化率: {}",
+                       static_cast<int>(get_current_weather()), environment_model->get_weather_stability(), environment_model->get_change_rate());
         
         // 作为数据制造者，将环境数据发布到全局共享数据空间
         publish_to_global_data_space();
     }
 
     void EnvironmentAgent::handle_event(const Event& event) {
-        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "环境代理处理事件: " + event.id);
+        VFT_LOG_DETAIL("环境代理处理事件: {}", event.id);
         
         // 根据事件类型处理
         switch (event.type) {
             case EventType::ENVIRONMENT_EVENT:
                 // 处理环境相关事件
-                VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "处理环境事件: " + event.description);
+                VFT_LOG_DETAIL("处理环境事件: {}", event.description);
                 break;
             case EventType::SYSTEM_EVENT:
                 // 处理系统事件
-                VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "处理系统事件: " + event.description);
+                VFT_LOG_DETAIL("处理系统事件: {}", event.description);
                 break;
             default:
                 // 其他类型事件
-                VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "处理其他类型事件: " + event.description);
+                VFT_LOG_DETAIL("处理其他类型事件: {}", event.description);
                 break;
         }
     }
 
     void EnvironmentAgent::send_event(const Event& event) {
-        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "环境代理发送事件: " + event.id);
+        VFT_LOG_DETAIL("环境代理发送事件: {}", event.id);
         // 这里可以添加事件发送逻辑
     }
 
@@ -327,14 +322,14 @@ namespace VFT_SMF {
     // ==================== 私有方法 ====================
     
     void EnvironmentAgent::initialize_environment_data() {
-        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "初始化环境数据");
+        VFT_LOG_DETAIL("初始化环境数据");
         
         // 尝试从配置文件加载数据
         if (config_manager && !environment_model_name.empty() && environment_model_name != "Default_Environment") {
             if (config_manager->load_environment_config(environment_model_name)) {
                 current_config = config_manager->get_environment_config(environment_model_name);
                 
-                VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "从配置文件加载环境数据: " + environment_model_name);
+                VFT_LOG_DETAIL("从配置文件加载环境数据: {}", environment_model_name);
                 
                 // 从配置文件初始化跑道数据
                 environment_data.runway_data.length = current_config.runway_data.length;
@@ -377,15 +372,15 @@ namespace VFT_SMF {
                     environment_model->set_change_rate(current_config.weather_model.change_rate);
                 }
                 
-                VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "配置文件加载成功: " + current_config.environment_model.name);
+                VFT_LOG_DETAIL("配置文件加载成功: {}", current_config.environment_model.name);
                 return;
             } else {
-                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "配置文件加载失败，使用默认值: " + environment_model_name);
+                VFT_LOG_BRIEF("配置文件加载失败，使用默认值: {}", environment_model_name);
             }
         }
         
         // 使用默认值（原有的硬编码数据）
-        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "使用默认环境数据");
+        VFT_LOG_DETAIL("使用默认环境数据");
         
         // 初始化跑道数据
         environment_data.runway_data.length = 3800.0;  // 3800米
@@ -435,20 +430,15 @@ namespace VFT_SMF {
             pressure_max = current_config.update_parameters.pressure_change_range.second;
         }
         
-        // 创建分布对象
-        std::uniform_real_distribution<> temp_change(temp_min, temp_max);
-        std::uniform_real_distribution<> wind_change(wind_min, wind_max);
-        std::uniform_real_distribution<> pressure_change(pressure_min, pressure_max);
-        
         // 温度变化
-        environment_data.atmospheric_data.temperature += temp_change(gen) * delta_time;
+        environment_data.atmospheric_data.temperature += rng.uniform(temp_min, temp_max) * delta_time;
         
         // 风速变化
-        environment_data.wind_data.wind_speed += wind_change(gen) * delta_time;
+        environment_data.wind_data.wind_speed += rng.uniform(wind_min, wind_max) * delta_time;
         environment_data.wind_data.wind_speed = std::max(0.0, environment_data.wind_data.wind_speed);
         
         // 气压变化
-        environment_data.atmospheric_data.pressure += pressure_change(gen) * delta_time;
+        environment_data.atmospheric_data.pressure += rng.uniform(pressure_min, pressure_max) * delta_time;
         
         // 更新空气密度
         update_air_density();
@@ -485,7 +475,7 @@ namespace VFT_SMF {
 
     void EnvironmentAgent::publish_to_global_data_space() {
         if (!global_data_space) {
-            VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "警告：环境代理未设置全局共享数据空间，无法发布数据");
+            VFT_LOG_DETAIL("警告：环境代理未设置全局共享数据空间，无法发布数据");
             return;
         }
         
@@ -495,6 +485,7 @@ namespace VFT_SMF {
         // 从环境数据填充全局状态
         env_state.runway_length = environment_data.runway_data.length;
         env_state.runway_width = environment_data.runway_data.width;
+        env_state.runway_elevation = environment_data.runway_data.elevation;
         env_state.friction_coefficient = environment_data.runway_data.friction_coefficient;
         env_state.air_density = environment_data.atmospheric_data.air_density;
         env_state.wind_speed = environment_data.wind_data.wind_speed;
@@ -509,10 +500,10 @@ namespace VFT_SMF {
         // 将环境状态写入全局共享数据空间，设置正确的数据源
         global_data_space->setEnvironmentState(env_state, get_agent_id());
         
-        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "环境代理 [" + get_agent_id() + "] 已将环境数据发布到全局共享数据空间");
-        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "  - 跑道宽度: " + std::to_string(env_state.runway_width) + " 米");
-        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "  - 风速: " + std::to_string(env_state.wind_speed) + " m/s");
-        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "  - 空气密度: " + std::to_string(env_state.air_density) + " kg/m³");
+        VFT_LOG_DETAIL("环境代理 [{}] 已将环境数据发布到全局共享数据空间", get_agent_id());
+        VFT_LOG_DETAIL("  - 跑道宽度: {} 米", env_state.runway_width);
+        VFT_LOG_DETAIL("  - 风速: {} m/s", env_state.wind_speed);
+        VFT_LOG_DETAIL("  - 空气密度: {} kg/m³", env_state.air_density);
     }
 
     // ==================== 统一控制器接口实现 ====================
@@ -520,24 +511,20 @@ namespace VFT_SMF {
     bool EnvironmentAgent::executeController(const std::string& controller_name, 
                                           const std::map<std::string, std::string>& params,
                                           double current_time) {
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-            "环境代理执行控制器: " + controller_name + " (时间: " + std::to_string(current_time) + "s)");
+        VFT_LOG_BRIEF("环境代理执行控制器: {} (时间: {}s)", controller_name, current_time);
         
         bool executed = false;
         
         if (controller_name == "Runway_Condition_Change") {
             executed = executeRunwayConditionChangeController(params, current_time);
         } else {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                "环境代理: 未知的控制器名称: " + controller_name);
+            VFT_LOG_BRIEF("环境代理: 未知的控制器名称: {}", controller_name);
         }
         
         if (executed) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                "环境代理控制器执行成功: " + controller_name);
+            VFT_LOG_BRIEF("环境代理控制器执行成功: {}", controller_name);
         } else {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                "环境代理控制器执行失败: " + controller_name);
+            VFT_LOG_BRIEF("环境代理控制器执行失败: {}", controller_name);
         }
         
         return executed;
@@ -545,7 +532,7 @@ namespace VFT_SMF {
 
     int EnvironmentAgent::processAgentEventQueue(double current_time) {
         if (!global_data_space) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "环境代理: 全局共享数据空间未设置");
+            VFT_LOG_BRIEF("环境代理: 全局共享数据空间未设置");
             return 0;
         }
         
@@ -554,26 +541,21 @@ namespace VFT_SMF {
         
         // 处理代理事件队列中的所有事件
         while (global_data_space->dequeueAgentEvent(get_agent_id(), queue_item)) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                "环境代理处理事件: " + queue_item.event.event_name + 
-                " (控制器: " + queue_item.controller_type + "::" + queue_item.controller_name + ")");
+            VFT_LOG_BRIEF("环境代理处理事件: {} (控制器: {}::{})", queue_item.event.event_name, queue_item.controller_type, queue_item.controller_name);
             
             // 执行对应的控制器
             bool executed = executeController(queue_item.controller_name, queue_item.parameters, current_time);
             
             if (executed) {
                 processed_count++;
-                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                    "环境代理事件处理成功: " + queue_item.event.event_name);
+                VFT_LOG_BRIEF("环境代理事件处理成功: {}", queue_item.event.event_name);
             } else {
-                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                    "环境代理事件处理失败: " + queue_item.event.event_name);
+                VFT_LOG_BRIEF("环境代理事件处理失败: {}", queue_item.event.event_name);
             }
         }
         
         if (processed_count > 0) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                "环境代理本步处理事件数量: " + std::to_string(processed_count));
+            VFT_LOG_BRIEF("环境代理本步处理事件数量: {}", processed_count);
         }
         
         return processed_count;
@@ -582,31 +564,31 @@ namespace VFT_SMF {
     // ==================== 环境控制器具体实现 ====================
 
     bool EnvironmentAgent::executeRunwayConditionChangeController(const std::map<std::string, std::string>& params, double current_time) {
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "环境代理: 执行跑道条件变化控制器");
+        VFT_LOG_BRIEF("环境代理: 执行跑道条件变化控制器");
         
         if (!global_data_space) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "环境代理: 全局共享数据空间未设置");
+            VFT_LOG_BRIEF("环境代理: 全局共享数据空间未设置");
             return false;
         }
         
         // 更新环境状态：跑道条件变化
         auto env_state = global_data_space->getEnvironmentState();
         env_state.friction_coefficient = 0.3;  // 跑道摩擦系数降低到0.3（湿滑跑道）
-        env_state.datasource = "Environment_001_Runway_Condition_Change_Controller";
+        env_state.datasource = VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::intern("Environment_001_Runway_Condition_Change_Controller");
         global_data_space->setEnvironmentState(env_state);
         
         // 同时更新内部环境数据
         environment_data.runway_data.friction_coefficient = 0.3;
         environment_data.runway_data.condition = "湿滑";
         
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "环境代理: 跑道条件变化，friction_coefficient设置为0.3，condition设置为湿滑");
+        VFT_LOG_BRIEF("环境代理: 跑道条件变化，friction_coefficient设置为0.3，condition设置为湿滑");
         return true;
     }
 
     // ==================== 环境模型配置驱动实现 ====================
 
     void EnvironmentAgent::initializeEnvironmentModel(const std::string& model_name) {
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "环境代理: 初始化环境模型: " + model_name);
+        VFT_LOG_BRIEF("环境代理: 初始化环境模型: {}", model_name);
         
         environment_model_name = model_name;
         
@@ -614,7 +596,7 @@ namespace VFT_SMF {
         if (config_manager && config_manager->load_environment_config(model_name)) {
             current_config = config_manager->get_environment_config(model_name);
             
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "环境代理: 配置文件加载成功: " + current_config.environment_model.name);
+            VFT_LOG_BRIEF("环境代理: 配置文件加载成功: {}", current_config.environment_model.name);
             
             // 从配置文件设置环境参数
             airport_code = current_config.environment_model.airport_code;
@@ -642,11 +624,11 @@ namespace VFT_SMF {
             // 重新初始化环境数据
             initialize_environment_data();
             
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "环境代理: " + model_name + " 模型初始化完成");
+            VFT_LOG_BRIEF("环境代理: {} 模型初始化完成", model_name);
             
         } else {
             // 配置文件加载失败，使用默认配置
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "环境代理: 配置文件加载失败，使用默认配置: " + model_name);
+            VFT_LOG_BRIEF("环境代理: 配置文件加载失败，使用默认配置: {}", model_name);
             
             // 根据模型名称设置特定的环境参数（原有的硬编码逻辑）
             if (model_name == "PVG_Runway_05") {
@@ -671,11 +653,11 @@ namespace VFT_SMF {
                 
             } else {
                 // 默认配置
-                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "环境代理: 使用默认环境模型配置");
+                VFT_LOG_BRIEF("环境代理: 使用默认环境模型配置");
             }
         }
         
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "环境代理: 环境模型初始化完成 - " + model_name);
+        VFT_LOG_BRIEF("环境代理: 环境模型初始化完成 - {}", model_name);
     }
 
     std::string EnvironmentAgent::getEnvironmentModelConfig() const {
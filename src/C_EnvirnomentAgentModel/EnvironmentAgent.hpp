@@ -12,9 +12,9 @@
 #include "../F_ScenarioModelling/B_ScenarioModel/VFT_SMF_Base.hpp"
 #include "EnvironmentAgent_DataSpace.hpp"
 #include "EnvironmentConfigManager.hpp"
+#include "../G_SimulationManager/B_SimManage/RandomService.hpp"
 #include <vector>
 #include <queue>
-#include <random>
 #include <algorithm>
 #include <memory>
 
@@ -86,9 +86,7 @@ namespace VFT_SMF {
         double weather_stability;      // 天气稳定性 [0.0, 1.0]
         double change_rate;            // 变化速率 [0.0, 1.0]
         
-        std::random_device rd;
-        std::mt19937 gen;
-        std::uniform_real_distribution<double> dist;
+        SimManage::RandomStream rng;   // 天气演变随机流
 
     public:
         EnvironmentModel(EnvironmentType type = EnvironmentType::AIRPORT_RUNWAY);
@@ -140,10 +138,8 @@ namespace VFT_SMF {
         // 环境模型名称（用于配置驱动）
         std::string environment_model_name;
         
-        // 随机数生成器
-        std::random_device rd;
-        std::mt19937 gen;
-        std::uniform_real_distribution<double> dist;
+        // 随机数流（按代理ID与仿真步号可复现）
+        SimManage::RandomStream rng;
 
     public:
         EnvironmentAgent(const std::string& id, const std::string& name, 
@@ -24,6 +24,7 @@ namespace VFT_SMF {
             std::string airport_code;              ///< 机场代码
             std::string runway_code;               ///< 跑道代码
             std::string weather_code;              ///< 天气代码
+            std::string config_directory = "../../src/C_EnvirnomentAgentModel/"; ///< 环境模型配置根目录
             
             EnvironmentAgentConfig() = default;
             
@@ -7,11 +7,152 @@
 
 #include "EnvironmentConfigManager.hpp"
 #include "../G_SimulationManager/LogAndData/Logger.hpp"
+#include "../G_SimulationManager/B_SimManage/DataPack.hpp"
 #include <filesystem>
 #include <regex>
 
 namespace VFT_SMF {
 
+    namespace {
+        /**
+         * @brief JSON 文档作为配置来源
+         */
+        struct JsonConfigSource {
+            const nlohmann::json& root;
+
+            bool has(const char* section) const { return root.contains(section); }
+            std::string text(const char* section, const char* key, const char* default_value) const {
+                return root[section].value(key, default_value);
+            }
+            double number(const char* section, const char* key, double default_value) const {
+                return root[section].value(key, default_value);
+            }
+            int integer(const char* section, const char* key, int default_value) const {
+                return root[section].value(key, default_value);
+            }
+            bool flag(const char* section, const char* key, bool default_value) const {
+                return root[section].value(key, default_value);
+            }
+            bool range(const char* section, const char* key, std::pair<double, double>& out) const {
+                const auto& node = root[section];
+                if (!node.contains(key) || !node[key].is_array() || node[key].size() < 2) return false;
+                out = {node[key][0], node[key][1]};
+                return true;
+            }
+        };
+
+        /**
+         * @brief 数据包作为配置来源（键为 "section/key"）
+         */
+        struct PackConfigSource {
+            const SimManage::DataPack& pack;
+
+            static std::string path(const char* section, const char* key) {
+                return std::string(section) + "/" + key;
+            }
+            bool has(const char* section) const { return pack.hasSection(section); }
+            std::string text(const char* section, const char* key, const char* default_value) const {
+                return std::string(pack.getString(path(section, key), default_value));
+            }
+            double number(const char* section, const char* key, double default_value) const {
+                return pack.getNumber(path(section, key), default_value);
+            }
+            int integer(const char* section, const char* key, int default_value) const {
+                return static_cast<int>(pack.getNumber(path(section, key), default_value));
+            }
+            bool flag(const char* section, const char* key, bool default_value) const {
+                return pack.getBool(path(section, key), default_value);
+            }
+            bool range(const char* section, const char* key, std::pair<double, double>& out) const {
+                const auto [values, count] = pack.getArray(path(section, key));
+                if (count < 2) return false;
+                out = {values[0], values[1]};
+                return true;
+            }
+        };
+
+        /**
+         * @brief 字段映射与默认值（JSON 与数据包共用）
+         */
+        template<typename Source>
+        void fillConfig(const Source& source, EnvironmentConfig& config) {
+            // 解析环境模型信息
+            if (source.has("environment_model")) {
+                const char* s = "environment_model";
+                config.environment_model.name = source.text(s, "name", "");
+                config.environment_model.airport_code = source.text(s, "airport_code", "");
+                config.environment_model.runway_code = source.text(s, "runway_code", "");
+                config.environment_model.environment_type = source.text(s, "environment_type", "");
+                config.environment_model.description = source.text(s, "description", "");
+            }
+            
+            // 解析跑道数据
+            if (source.has("runway_data")) {
+                const char* s = "runway_data";
+                config.runway_data.length = source.number(s, "length", 3800.0);
+                config.runway_data.width = source.number(s, "width", 60.0);
+                config.runway_data.surface_type = source.text(s, "surface_type", "沥青");
+                config.runway_data.friction_coefficient = source.number(s, "friction_coefficient", 0.8);
+                config.runway_data.condition = source.text(s, "condition", "干");
+                config.runway_data.is_available = source.flag(s, "is_available", true);
+                config.runway_data.elevation = source.number(s, "elevation", 35.0);
+                config.runway_data.slope = source.number(s, "slope", 0.0);
+                config.runway_data.heading = source.number(s, "heading", 0.0);
+                config.runway_data.ils_frequency = source.text(s, "ils_frequency", "");
+                config.runway_data.approach_lights = source.text(s, "approach_lights", "");
+            }
+            
+            // 解析大气数据
+            if (source.has("atmospheric_data")) {
+                const char* s = "atmospheric_data";
+                config.atmospheric_data.temperature = source.number(s, "temperature", 15.0);
+                config.atmospheric_data.pressure = source.number(s, "pressure", 1013.25);
+                config.atmospheric_data.humidity = source.number(s, "humidity", 50.0);
+                config.atmospheric_data.visibility = source.number(s, "visibility", 10000.0);
+                config.atmospheric_data.density_altitude = source.number(s, "density_altitude", 35.0);
+                config.atmospheric_data.dew_point = source.number(s, "dew_point", 5.0);
+                config.atmospheric_data.air_density = source.number(s, "air_density", 1.225);
+                config.atmospheric_data.cloud_cover = source.text(s, "cloud_cover", "少云");
+                config.atmospheric_data.cloud_base = source.number(s, "cloud_base", 1000.0);
+                config.atmospheric_data.ceiling = source.number(s, "ceiling", 1500.0);
+                config.atmospheric_data.precipitation = source.text(s, "precipitation", "无");
+                config.atmospheric_data.precipitation_intensity = source.number(s, "precipitation_intensity", 0.0);
+            }
+            
+            // 解析风数据
+            if (source.has("wind_data")) {
+                const char* s = "wind_data";
+                config.wind_data.wind_speed = source.number(s, "wind_speed", 5.0);
+                config.wind_data.wind_direction = source.number(s, "wind_direction", 0.0);
+                config.wind_data.gust_speed = source.number(s, "gust_speed", 0.0);
+                config.wind_data.crosswind_component = source.number(s, "crosswind_component", 0.0);
+                config.wind_data.headwind_component = source.number(s, "headwind_component", 5.0);
+                config.wind_data.wind_shear = source.number(s, "wind_shear", 0.0);
+                config.wind_data.wind_condition = source.text(s, "wind_condition", "轻风");
+                config.wind_data.is_turbulent = source.flag(s, "is_turbulent", false);
+                config.wind_data.wind_altitude = source.number(s, "wind_altitude", 10.0);
+            }
+            
+            // 解析天气模型
+            if (source.has("weather_model")) {
+                const char* s = "weather_model";
+                config.weather_model.weather_stability = source.number(s, "weather_stability", 0.8);
+                config.weather_model.change_rate = source.number(s, "change_rate", 0.1);
+                config.weather_model.default_weather = source.text(s, "default_weather", "CLEAR");
+            }
+            
+            // 解析更新参数
+            if (source.has("update_parameters")) {
+                const char* s = "update_parameters";
+                source.range(s, "temperature_change_range", config.update_parameters.temperature_change_range);
+                source.range(s, "wind_change_range", config.update_parameters.wind_change_range);
+                source.range(s, "pressure_change_range", config.update_parameters.pressure_change_range);
+                config.update_parameters.update_frequency = source.number(s, "update_frequency", 1.0);
+                config.update_parameters.random_seed = source.integer(s, "random_seed", 42);
+            }
+        }
+    }
+
     EnvironmentConfigManager::EnvironmentConfigManager(const std::string& base_path)
         : base_config_path(base_path) {
         VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "环境配置管理器初始化，基础路径: " + base_path);
@@ -295,17 +436,24 @@ namespace VFT_SMF {
         VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "加载配置文件: " + config_path);
         
         try {
-            std::ifstream file(config_path);
+            std::ifstream file(config_path, std::ios::binary);
             if (!file.is_open()) {
                 VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "无法打开配置文件: " + config_path);
                 return false;
             }
             
-            nlohmann::json json_data;
-            file >> json_data;
+            std::ostringstream buffer;
+            buffer << file.rdbuf();
             file.close();
+            const std::string text = buffer.str();
             
-            return parse_json_config(json_data, config);
+            // 优先使用与源文件内容一致的数据包（并行运行共用同一映射），不可用时回退到JSON解析
+            if (auto pack = SimManage::DataPack::openForSource("environment_config", text)) {
+                VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "使用环境数据包: " + pack->getPath());
+                return parse_pack_config(*pack, config);
+            }
+            
+            return parse_json_config(nlohmann::json::parse(text), config);
             
         } catch (const std::exception& e) {
             VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "解析配置文件失败: " + std::string(e.what()));
@@ -315,100 +463,7 @@ namespace VFT_SMF {
 
     bool EnvironmentConfigManager::parse_json_config(const nlohmann::json& json_data, EnvironmentConfig& config) {
         try {
-            // 解析环境模型信息
-            if (json_data.contains("environment_model")) {
-                const auto& env_model = json_data["environment_model"];
-                config.environment_model.name = env_model.value("name", "");
-                config.environment_model.airport_code = env_model.value("airport_code", "");
-                config.environment_model.runway_code = env_model.value("runway_code", "");
-                config.environment_model.environment_type = env_model.value("environment_type", "");
-                config.environment_model.description = env_model.value("description", "");
-            }
-            
-            // 解析跑道数据
-            if (json_data.contains("runway_data")) {
-                const auto& runway = json_data["runway_data"];
-                config.runway_data.length = runway.value("length", 3800.0);
-                config.runway_data.width = runway.value("width", 60.0);
-                config.runway_data.surface_type = runway.value("surface_type", "沥青");
-                config.runway_data.friction_coefficient = runway.value("friction_coefficient", 0.8);
-                config.runway_data.condition = runway.value("condition", "干");
-                config.runway_data.is_available = runway.value("is_available", true);
-                config.runway_data.elevation = runway.value("elevation", 35.0);
-                config.runway_data.slope = runway.value("slope", 0.0);
-                config.runway_data.heading = runway.value("heading", 0.0);
-                config.runway_data.ils_frequency = runway.value("ils_frequency", "");
-                config.runway_data.approach_lights = runway.value("approach_lights", "");
-            }
-            
-            // 解析大气数据
-            if (json_data.contains("atmospheric_data")) {
-                const auto& atmospheric = json_data["atmospheric_data"];
-                config.atmospheric_data.temperature = atmospheric.value("temperature", 15.0);
-                config.atmospheric_data.pressure = atmospheric.value("pressure", 1013.25);
-                config.atmospheric_data.humidity = atmospheric.value("humidity", 50.0);
-                config.atmospheric_data.visibility = atmospheric.value("visibility", 10000.0);
-                config.atmospheric_data.density_altitude = atmospheric.value("density_altitude", 35.0);
-                config.atmospheric_data.dew_point = atmospheric.value("dew_point", 5.0);
-                config.atmospheric_data.air_density = atmospheric.value("air_density", 1.225);
-                config.atmospheric_data.cloud_cover = atmospheric.value("cloud_cover", "少云");
-                config.atmospheric_data.cloud_base = atmospheric.value("cloud_base", 1000.0);
-                config.atmospheric_data.ceiling = atmospheric.value("ceiling", 1500.0);
-                config.atmospheric_data.precipitation = atmospheric.value("precipitation", "无");
-                config.atmospheric_data.precipitation_intensity = atmospheric.value("precipitation_intensity", 0.0);
-            }
-            
-            // 解析风数据
-            if (json_data.contains("wind_data")) {
-                const auto& wind = json_data["wind_data"];
-                config.wind_data.wind_speed = wind.value("wind_speed", 5.0);
-                config.wind_data.wind_direction = wind.value("wind_direction", 0.0);
-                config.wind_data.gust_speed = wind.value("gust_speed", 0.0);
-                config.wind_data.crosswind_component = wind.value("crosswind_component", 0.0);
-                config.wind_data.headwind_component = wind.value("headwind_component", 5.0);
-                config.wind_data.wind_shear = wind.value("wind_shear", 0.0);
-                config.wind_data.wind_condition = wind.value("wind_condition", "轻风");
-                config.wind_data.is_turbulent = wind.value("is_turbulent", false);
-                config.wind_data.wind_altitude = wind.value("wind_altitude", 10.0);
-            }
-            
-            // 解析天气模型
-            if (json_data.contains("weather_model")) {
-                const auto& weather = json_data["weather_model"];
-                config.weather_model.weather_stability = weather.value("weather_stability", 0.8);
-                config.weather_model.change_rate = weather.value("change_rate", 0.1);
-                config.weather_model.default_weather = weather.value("default_weather", "CLEAR");
-            }
-            
-            // 解析更新参数
-            if (json_data.contains("update_parameters")) {
-                const auto& update = json_data["update_parameters"];
-                
-                if (update.contains("temperature_change_range") && update["temperature_change_range"].is_array()) {
-                    auto temp_range = update["temperature_change_range"];
-                    if (temp_range.size() >= 2) {
-                        config.update_parameters.temperature_change_range = {temp_range[0], temp_range[1]};
-                    }
-                }
-                
-                if (update.contains("wind_change_range") && update["wind_change_range"].is_array()) {
-                    auto wind_range = update["wind_change_range"];
-                    if (wind_range.size() >= 2) {
-                        config.update_parameters.wind_change_range = {wind_range[0], wind_range[1]};
-                    }
-                }
-                
-                if (update.contains("pressure_change_range") && update["pressure_change_range"].is_array()) {
-                    auto pressure_range = update["pressure_change_range"];
-                    if (pressure_range.size() >= 2) {
-                        config.update_parameters.pressure_change_range = {pressure_range[0], pressure_range[1]};
-                    }
-                }
-                
-                config.update_parameters.update_frequency = update.value("update_frequency", 1.0);
-                config.update_parameters.random_seed = update.value("random_seed", 42);
-            }
-            
+            fillConfig(JsonConfigSource{json_data}, config);
             return true;
             
         } catch (const std::exception& e) {
@@ -417,6 +472,11 @@ namespace VFT_SMF {
         }
     }
 
+    bool EnvironmentConfigManager::parse_pack_config(const SimManage::DataPack& pack, EnvironmentConfig& config) {
+        fillConfig(PackConfigSource{pack}, config);
+        return true;
+    }
+
     std::string EnvironmentConfigManager::get_config_file_path(const std::string& model_name) {
         return base_config_path + model_name + "/DataTwin/environment_config.json";
     }
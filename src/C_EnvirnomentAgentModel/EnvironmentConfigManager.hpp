@@ -20,6 +20,8 @@
 
 namespace VFT_SMF {
 
+    namespace SimManage { class DataPack; }
+
     /**
      * @brief 环境配置数据结构
      */
@@ -129,6 +131,7 @@ namespace VFT_SMF {
         // 私有方法
         bool load_config_from_file(const std::string& model_name, EnvironmentConfig& config);
         bool parse_json_config(const nlohmann::json& json_data, EnvironmentConfig& config);
+        bool parse_pack_config(const SimManage::DataPack& pack, EnvironmentConfig& config);
         std::string get_config_file_path(const std::string& model_name);
         void validate_config(const EnvironmentConfig& config);
         
@@ -17,7 +17,7 @@ namespace VFT_SMF {
         emergency_interventions = 0;
         last_update_time = 0.0;
         
-        logBrief(LogLevel::Brief, "ATC_001策略初始化完成 - 代理ID: " + agent_id);
+        VFT_LOG_BRIEF("ATC_001策略初始化完成 - 代理ID: {}", agent_id);
     }
 
     bool ATC_001_Strategy::executeClearanceController(const std::map<std::string, std::string>& params, 
@@ -26,12 +26,12 @@ namespace VFT_SMF {
         
         // ATC_001 标准滑行许可逻辑
         if (!validateStandardConditions(current_time)) {
-            logBrief(LogLevel::Brief, "ATC_001: 标准条件验证失败，拒绝滑行许可");
+            VFT_LOG_BRIEF("ATC_001: 标准条件验证失败，拒绝滑行许可");
             return false;
         }
 
         if (!checkAircraftStatus()) {
-            logBrief(LogLevel::Brief, "ATC_001: 飞机状态检查失败，拒绝滑行许可");
+            VFT_LOG_BRIEF("ATC_001: 飞机状态检查失败，拒绝滑行许可");
             return false;
         }
 
@@ -39,7 +39,7 @@ namespace VFT_SMF {
         updateATCCommand("clearance_granted", true);
         total_clearances_issued++;
         
-        logBrief(LogLevel::Brief, "ATC_001: 滑行许可已发布 - 总许可数: " + std::to_string(total_clearances_issued));
+        VFT_LOG_BRIEF("ATC_001: 滑行许可已发布 - 总许可数: {}", total_clearances_issued);
         return true;
     }
 
@@ -51,7 +51,7 @@ namespace VFT_SMF {
         updateATCCommand("emergency_brake", true);
         emergency_interventions++;
         
-        logBrief(LogLevel::Brief, "ATC_001: 紧急刹车指令已发布 - 总紧急干预次数: " + std::to_string(emergency_interventions));
+        VFT_LOG_BRIEF("ATC_001: 紧急刹车指令已发布 - 总紧急干预次数: {}", emergency_interventions);
         return true;
     }
 
@@ -61,21 +61,21 @@ namespace VFT_SMF {
         
         // ATC_001 标准起飞许可逻辑
         if (!validateStandardConditions(current_time)) {
-            logBrief(LogLevel::Brief, "ATC_001: 标准条件验证失败，拒绝起飞许可");
+            VFT_LOG_BRIEF("ATC_001: 标准条件验证失败，拒绝起飞许可");
             return false;
         }
 
         // 检查起飞条件
         auto flight_state = shared_data_space->getAircraftFlightState();
         if (flight_state.airspeed > 5.0) {  // 标准阈值
-            logBrief(LogLevel::Brief, "ATC_001: 飞机速度过高，拒绝起飞许可");
+            VFT_LOG_BRIEF("ATC_001: 飞机速度过高，拒绝起飞许可");
             return false;
         }
 
         updateATCCommand("clearance_granted", true);
         total_clearances_issued++;
         
-        logBrief(LogLevel::Brief, "ATC_001: 起飞许可已发布");
+        VFT_LOG_BRIEF("ATC_001: 起飞许可已发布");
         return true;
     }
 
@@ -85,21 +85,21 @@ namespace VFT_SMF {
         
         // ATC_001 标准着陆许可逻辑
         if (!validateStandardConditions(current_time)) {
-            logBrief(LogLevel::Brief, "ATC_001: 标准条件验证失败，拒绝着陆许可");
+            VFT_LOG_BRIEF("ATC_001: 标准条件验证失败，拒绝着陆许可");
             return false;
         }
 
         // 检查着陆条件
         auto flight_state = shared_data_space->getAircraftFlightState();
         if (flight_state.altitude > 200.0) {  // 标准阈值
-            logBrief(LogLevel::Brief, "ATC_001: 飞机高度过高，拒绝着陆许可");
+            VFT_LOG_BRIEF("ATC_001: 飞机高度过高，拒绝着陆许可");
             return false;
         }
 
         updateATCCommand("clearance_granted", true);
         total_clearances_issued++;
         
-        logBrief(LogLevel::Brief, "ATC_001: 着陆许可已发布");
+        VFT_LOG_BRIEF("ATC_001: 着陆许可已发布");
         return true;
     }
 
@@ -138,7 +138,7 @@ namespace VFT_SMF {
     }
 
     void ATC_001_Strategy::logATCAction(const std::string& action, const std::string& details) {
-        logBrief(LogLevel::Brief, "ATC_001 " + action + ": " + details);
+        VFT_LOG_BRIEF("ATC_001 {}: {}", action, details);
     }
 
     void ATC_001_Strategy::updateATCCommand(const std::string& command_type, bool value) {
@@ -153,7 +153,7 @@ namespace VFT_SMF {
         // 使用代理ID作为数据源
         shared_data_space->setATCCommand(current_atc_command, agent_id + "_standard_strategy");
         
-        logBrief(LogLevel::Brief, "ATC_001 指令状态更新: " + command_type + " = " + (value ? "true" : "false"));
+        VFT_LOG_BRIEF("ATC_001 指令状态更新: {} = {}", command_type, (value ? "true" : "false"));
     }
 
     bool ATC_001_Strategy::checkAircraftStatus() {
@@ -162,12 +162,12 @@ namespace VFT_SMF {
         
         // ATC_001 标准飞机状态检查
         if (flight_state.groundspeed > 30.0) {  // 标准速度阈值
-            logBrief(LogLevel::Brief, "ATC_001: 飞机地面速度过高");
+            VFT_LOG_BRIEF("ATC_001: 飞机地面速度过高");
             return false;
         }
         
         if (system_state.current_brake_pressure < 50000.0) {  // 标准刹车压力阈值
-            logBrief(LogLevel::Brief, "ATC_001: 刹车压力不足");
+            VFT_LOG_BRIEF("ATC_001: 刹车压力不足");
             return false;
         }
         
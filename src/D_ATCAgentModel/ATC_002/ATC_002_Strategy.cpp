@@ -19,7 +19,7 @@ namespace VFT_SMF {
         safety_violations_detected = 0;
         clearances_denied = 0;
         
-        logBrief(LogLevel::Brief, "ATC_002策略初始化完成 - 严格模式已启用 - 代理ID: " + agent_id);
+        VFT_LOG_BRIEF("ATC_002策略初始化完成 - 严格模式已启用 - 代理ID: {}", agent_id);
     }
 
     bool ATC_002_Strategy::executeClearanceController(const std::map<std::string, std::string>& params, 
@@ -29,21 +29,21 @@ namespace VFT_SMF {
         // 执行严格安全检查
         if (!performStrictSafetyCheck(current_time)) {
             clearances_denied++;
-            logBrief(LogLevel::Brief, "ATC_002: 严格安全检查失败，拒绝滑行许可");
+            VFT_LOG_BRIEF("ATC_002: 严格安全检查失败，拒绝滑行许可");
             return false;
         }
 
         // 严格条件验证
         if (!validateStrictConditions("taxi", current_time)) {
             clearances_denied++;
-            logBrief(LogLevel::Brief, "ATC_002: 严格条件验证失败，拒绝滑行许可");
+            VFT_LOG_BRIEF("ATC_002: 严格条件验证失败，拒绝滑行许可");
             return false;
         }
 
         // 判断是否应该发布许可
         if (!shouldIssueClearance("taxi", current_time)) {
             clearances_denied++;
-            logBrief(LogLevel::Brief, "ATC_002: 安全评估不通过，拒绝滑行许可");
+            VFT_LOG_BRIEF("ATC_002: 安全评估不通过，拒绝滑行许可");
             return false;
         }
 
@@ -52,7 +52,7 @@ namespace VFT_SMF {
         applyStrictModeLogic("taxi_clearance");
         total_commands_issued++;
         
-        logBrief(LogLevel::Brief, "ATC_002: 滑行许可已发布（严格模式） - 总指令数: " + std::to_string(total_commands_issued));
+        VFT_LOG_BRIEF("ATC_002: 滑行许可已发布（严格模式） - 总指令数: {}", total_commands_issued);
         return true;
     }
 
@@ -68,7 +68,7 @@ namespace VFT_SMF {
         // 记录紧急情况
         safety_violations_detected++;
         
-        logBrief(LogLevel::Brief, "ATC_002: 紧急刹车指令已发布（严格模式） - 安全违规检测数: " + std::to_string(safety_violations_detected));
+        VFT_LOG_BRIEF("ATC_002: 紧急刹车指令已发布（严格模式） - 安全违规检测数: {}", safety_violations_detected);
         return true;
     }
 
@@ -79,14 +79,14 @@ namespace VFT_SMF {
         // 执行严格安全检查
         if (!performStrictSafetyCheck(current_time)) {
             clearances_denied++;
-            logBrief(LogLevel::Brief, "ATC_002: 严格安全检查失败，拒绝起飞许可");
+            VFT_LOG_BRIEF("ATC_002: 严格安全检查失败，拒绝起飞许可");
             return false;
         }
 
         // 严格条件验证
         if (!validateStrictConditions("takeoff", current_time)) {
             clearances_denied++;
-            logBrief(LogLevel::Brief, "ATC_002: 严格条件验证失败，拒绝起飞许可");
+            VFT_LOG_BRIEF("ATC_002: 严格条件验证失败，拒绝起飞许可");
             return false;
         }
 
@@ -94,14 +94,14 @@ namespace VFT_SMF {
         auto flight_state = shared_data_space->getAircraftFlightState();
         if (flight_state.airspeed > 0.5) {  // 更严格的阈值
             clearances_denied++;
-            logBrief(LogLevel::Brief, "ATC_002: 飞机速度超过严格阈值，拒绝起飞许可");
+            VFT_LOG_BRIEF("ATC_002: 飞机速度超过严格阈值，拒绝起飞许可");
             return false;
         }
 
         // 额外的时间要求
         if (current_time < 15.0) {  // 至少15秒后才允许起飞
             clearances_denied++;
-            logBrief(LogLevel::Brief, "ATC_002: 起飞时间过早，拒绝起飞许可");
+            VFT_LOG_BRIEF("ATC_002: 起飞时间过早，拒绝起飞许可");
             return false;
         }
 
@@ -109,7 +109,7 @@ namespace VFT_SMF {
         applyStrictModeLogic("takeoff_clearance");
         total_commands_issued++;
         
-        logBrief(LogLevel::Brief, "ATC_002: 起飞许可已发布（严格验证通过）");
+        VFT_LOG_BRIEF("ATC_002: 起飞许可已发布（严格验证通过）");
         return true;
     }
 
@@ -120,14 +120,14 @@ namespace VFT_SMF {
         // 执行严格安全检查
         if (!performStrictSafetyCheck(current_time)) {
             clearances_denied++;
-            logBrief(LogLevel::Brief, "ATC_002: 严格安全检查失败，拒绝着陆许可");
+            VFT_LOG_BRIEF("ATC_002: 严格安全检查失败，拒绝着陆许可");
             return false;
         }
 
         // 严格条件验证
         if (!validateStrictConditions("landing", current_time)) {
             clearances_denied++;
-            logBrief(LogLevel::Brief, "ATC_002: 严格条件验证失败，拒绝着陆许可");
+            VFT_LOG_BRIEF("ATC_002: 严格条件验证失败，拒绝着陆许可");
             return false;
         }
 
@@ -135,13 +135,13 @@ namespace VFT_SMF {
         auto flight_state = shared_data_space->getAircraftFlightState();
         if (flight_state.altitude > 100.0) {  // 更严格的高度阈值
             clearances_denied++;
-            logBrief(LogLevel::Brief, "ATC_002: 飞机高度超过严格阈值，拒绝着陆许可");
+            VFT_LOG_BRIEF("ATC_002: 飞机高度超过严格阈值，拒绝着陆许可");
             return false;
         }
 
         if (flight_state.airspeed > 25.0) {  // 更严格的速度阈值
             clearances_denied++;
-            logBrief(LogLevel::Brief, "ATC_002: 飞机速度超过严格阈值，拒绝着陆许可");
+            VFT_LOG_BRIEF("ATC_002: 飞机速度超过严格阈值，拒绝着陆许可");
             return false;
         }
 
@@ -149,7 +149,7 @@ namespace VFT_SMF {
         applyStrictModeLogic("landing_clearance");
         total_commands_issued++;
         
-        logBrief(LogLevel::Brief, "ATC_002: 着陆许可已发布（严格验证通过）");
+        VFT_LOG_BRIEF("ATC_002: 着陆许可已发布（严格验证通过）");
         return true;
     }
 
@@ -186,24 +186,24 @@ namespace VFT_SMF {
             // 严格的安全检查条件
             if (flight_state.airspeed > 40.0) {  // 更严格的速度限制
                 safety_violations_detected++;
-                logBrief(LogLevel::Brief, "ATC_002 安全检查: 空速过高警告 - " + std::to_string(flight_state.airspeed));
+                VFT_LOG_BRIEF("ATC_002 安全检查: 空速过高警告 - {}", flight_state.airspeed);
                 return false;
             }
             
             if (system_state.current_brake_pressure < 80000.0) {  // 更严格的刹车压力要求
                 safety_violations_detected++;
-                logBrief(LogLevel::Brief, "ATC_002 安全检查: 刹车压力不足警告 - " + std::to_string(system_state.current_brake_pressure));
+                VFT_LOG_BRIEF("ATC_002 安全检查: 刹车压力不足警告 - {}", system_state.current_brake_pressure);
                 return false;
             }
             
             // 检查发动机状态
             if (system_state.left_engine_failed || system_state.right_engine_failed) {
                 safety_violations_detected++;
-                logBrief(LogLevel::Brief, "ATC_002 安全检查: 发动机故障检测");
+                VFT_LOG_BRIEF("ATC_002 安全检查: 发动机故障检测");
                 return false;
             }
             
-            logBrief(LogLevel::Brief, "ATC_002 严格安全检查通过 - 时间: " + std::to_string(current_time) + "s");
+            VFT_LOG_BRIEF("ATC_002 严格安全检查通过 - 时间: {}s", current_time);
         }
         
         return true;
@@ -223,7 +223,7 @@ namespace VFT_SMF {
         if (operation_type == "takeoff") {
             auto flight_state = shared_data_space->getAircraftFlightState();
             if (flight_state.groundspeed > 0.1) {  // 起飞前必须完全静止
-                logBrief(LogLevel::Brief, "ATC_002: 起飞验证失败 - 飞机未完全静止");
+                VFT_LOG_BRIEF("ATC_002: 起飞验证失败 - 飞机未完全静止");
                 return false;
             }
         }
@@ -251,18 +251,18 @@ namespace VFT_SMF {
 
     void ATC_002_Strategy::applyStrictModeLogic(const std::string& command_type) {
         if (strict_mode_enabled) {
-            logBrief(LogLevel::Brief, "ATC_002 严格模式: 应用额外安全措施 - " + command_type);
+            VFT_LOG_BRIEF("ATC_002 严格模式: 应用额外安全措施 - {}", command_type);
             
             // 额外的安全措施
             if (command_type.find("clearance") != std::string::npos) {
-                logBrief(LogLevel::Brief, "ATC_002: 执行许可确认程序");
+                VFT_LOG_BRIEF("ATC_002: 执行许可确认程序");
                 // 可以在这里添加额外的确认步骤
             }
         }
     }
 
     void ATC_002_Strategy::logATCAction(const std::string& action, const std::string& details) {
-        logBrief(LogLevel::Brief, "ATC_002 " + action + ": " + details);
+        VFT_LOG_BRIEF("ATC_002 {}: {}", action, details);
     }
 
     void ATC_002_Strategy::updateATCCommand(const std::string& command_type, bool value) {
@@ -277,7 +277,7 @@ namespace VFT_SMF {
         // 使用代理ID作为数据源，标识为严格策略
         shared_data_space->setATCCommand(current_atc_command, agent_id + "_strict_strategy");
         
-        logBrief(LogLevel::Brief, "ATC_002 指令状态更新: " + command_type + " = " + (value ? "true" : "false"));
+        VFT_LOG_BRIEF("ATC_002 指令状态更新: {} = {}", command_type, (value ? "true" : "false"));
     }
 
     bool ATC_002_Strategy::checkAdvancedAircraftStatus() {
@@ -286,18 +286,18 @@ namespace VFT_SMF {
         
         // ATC_002 严格飞机状态检查
         if (flight_state.groundspeed > 15.0) {  // 更严格的速度阈值
-            logBrief(LogLevel::Brief, "ATC_002: 飞机地面速度超过严格限制");
+            VFT_LOG_BRIEF("ATC_002: 飞机地面速度超过严格限制");
             return false;
         }
         
         if (system_state.current_brake_pressure < 80000.0) {  // 更严格的刹车压力阈值
-            logBrief(LogLevel::Brief, "ATC_002: 刹车压力不满足严格要求");
+            VFT_LOG_BRIEF("ATC_002: 刹车压力不满足严格要求");
             return false;
         }
         
         // 检查刹车效率
         if (system_state.brake_efficiency < 0.8) {  // 要求较高的刹车效率
-            logBrief(LogLevel::Brief, "ATC_002: 刹车效率不满足严格要求");
+            VFT_LOG_BRIEF("ATC_002: 刹车效率不满足严格要求");
             return false;
         }
         
@@ -311,7 +311,7 @@ namespace VFT_SMF {
         
         // 每10次更新输出一次详细统计
         if (update_counter % 10 == 0) {
-            logBrief(LogLevel::Brief, getPerformanceStats());
+            VFT_LOG_BRIEF("{}", getPerformanceStats());
         }
     }
 
@@ -27,7 +27,7 @@ namespace VFT_SMF {
         is_running = false;
         current_state = AgentState::UNINITIALIZED;
         
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理创建完成: " + name);
+        VFT_LOG_BRIEF("ATC代理创建完成: {}", name);
     }
 
     void ATCAgent::initialize() {
@@ -38,35 +38,35 @@ namespace VFT_SMF {
         parse_logic_lines_and_generate_instructions();
         
         current_state = AgentState::READY;
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理初始化完成: " + get_agent_name());
+        VFT_LOG_BRIEF("ATC代理初始化完成: {}", get_agent_name());
     }
 
     void ATCAgent::start() {
         std::cout << "ATC代理启动: " << get_agent_name() << std::endl;
         is_running = true;
         current_state = AgentState::RUNNING;
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理启动: " + get_agent_name());
+        VFT_LOG_BRIEF("ATC代理启动: {}", get_agent_name());
     }
 
     void ATCAgent::pause() {
         std::cout << "ATC代理暂停: " << get_agent_name() << std::endl;
         is_running = false;
         current_state = AgentState::PAUSED;
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理暂停: " + get_agent_name());
+        VFT_LOG_BRIEF("ATC代理暂停: {}", get_agent_name());
     }
 
     void ATCAgent::resume() {
         std::cout << "ATC代理恢复: " << get_agent_name() << std::endl;
         is_running = true;
         current_state = AgentState::RUNNING;
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理恢复: " + get_agent_name());
+        VFT_LOG_BRIEF("ATC代理恢复: {}", get_agent_name());
     }
 
     void ATCAgent::stop() {
         std::cout << "ATC代理停止: " << get_agent_name() << std::endl;
         is_running = false;
         current_state = AgentState::STOPPED;
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理停止: " + get_agent_name());
+        VFT_LOG_BRIEF("ATC代理停止: {}", get_agent_name());
     }
 
     void ATCAgent::update(double delta_time) {
@@ -84,7 +84,7 @@ namespace VFT_SMF {
 
     void ATCAgent::handle_event(const Event& event) {
         std::cout << "ATC代理处理事件: " << event.id << std::endl;
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理处理事件: " + event.id);
+        VFT_LOG_BRIEF("ATC代理处理事件: {}", event.id);
         
         // 根据事件类型处理
         if (event.type == EventType::ATC_EVENT) {
@@ -95,7 +95,7 @@ namespace VFT_SMF {
 
     void ATCAgent::send_event(const Event& event) {
         std::cout << "ATC代理发送事件: " << event.id << std::endl;
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理发送事件: " + event.id);
+        VFT_LOG_BRIEF("ATC代理发送事件: {}", event.id);
     }
 
     std::string ATCAgent::get_status() const {
@@ -110,28 +110,28 @@ namespace VFT_SMF {
 
     void ATCAgent::set_shared_data_space(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDataSpace> data_space) {
         shared_data_space = data_space;
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理设置全局共享数据空间");
+        VFT_LOG_BRIEF("ATC代理设置全局共享数据空间");
     }
 
     void ATCAgent::setATCStrategy(std::unique_ptr<IATCStrategy> strategy) {
         atc_strategy = std::move(strategy);
         if (atc_strategy) {
             atc_strategy->initialize(shared_data_space, get_agent_id());
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理设置策略成功: " + atc_strategy->getStrategyId());
+            VFT_LOG_BRIEF("ATC代理设置策略成功: {}", atc_strategy->getStrategyId());
         } else {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理设置策略失败");
+            VFT_LOG_BRIEF("ATC代理设置策略失败");
         }
     }
 
     void ATCAgent::initializeATCStrategy(const std::string& atc_id) {
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理初始化策略: " + atc_id);
+        VFT_LOG_BRIEF("ATC代理初始化策略: {}", atc_id);
         
         if (atc_id == "ATC_001") {
             setATCStrategy(std::make_unique<ATC_001_Strategy>());
         } else if (atc_id == "ATC_002") {
             setATCStrategy(std::make_unique<ATC_002_Strategy>());
         } else {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "未知的ATC_ID: " + atc_id + "，使用默认策略ATC_001");
+            VFT_LOG_BRIEF("未知的ATC_ID: {}，使用默认策略ATC_001", atc_id);
             setATCStrategy(std::make_unique<ATC_001_Strategy>());
         }
     }
@@ -145,14 +145,14 @@ namespace VFT_SMF {
 
     void ATCAgent::set_flight_plan_data(const VFT_SMF::GlobalSharedDataStruct::FlightPlanData& plan_data) {
         flight_plan_data = plan_data;
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理设置飞行计划数据");
+        VFT_LOG_BRIEF("ATC代理设置飞行计划数据");
     }
 
     void ATCAgent::parse_logic_lines_and_generate_instructions() {
         logic_line_results.clear();
         
         if (flight_plan_data.logic_lines.empty()) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理: 飞行计划中没有逻辑线数据");
+            VFT_LOG_BRIEF("ATC代理: 飞行计划中没有逻辑线数据");
             return;
         }
         
@@ -173,17 +173,15 @@ namespace VFT_SMF {
             LogicLineResult logic_result(line_id, "", instruction_type, instruction_content);
             logic_line_results.push_back(logic_result);
             
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                "ATC代理解析逻辑线: " + line_id + " -> " + instruction_content);
+            VFT_LOG_BRIEF("ATC代理解析逻辑线: {} -> {}", line_id, instruction_content);
         }
         
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-            "ATC代理完成逻辑线解析，共解析 " + std::to_string(logic_line_results.size()) + " 条逻辑线");
+        VFT_LOG_BRIEF("ATC代理完成逻辑线解析，共解析 {} 条逻辑线", logic_line_results.size());
     }
 
     void ATCAgent::check_event_triggers_and_issue_instructions(double current_time) {
         if (!shared_data_space) {
-                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理: 全局共享数据空间未设置");
+                VFT_LOG_BRIEF("ATC代理: 全局共享数据空间未设置");
             return;
         }
         
@@ -205,16 +203,14 @@ namespace VFT_SMF {
                 logic_result.is_triggered = true;
                 logic_result.trigger_time = current_time;
                 
-                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                    "ATC代理发出指令: " + instruction.instruction_content + 
-                    " 时间: " + std::to_string(current_time));
+                VFT_LOG_BRIEF("ATC代理发出指令: {} 时间: {}", instruction.instruction_content, current_time);
             }
         }
     }
 
     void ATCAgent::issue_atc_instruction(const ATCInstruction& instruction) {
         if (!shared_data_space) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理: 全局共享数据空间未设置，无法发出指令");
+            VFT_LOG_BRIEF("ATC代理: 全局共享数据空间未设置，无法发出指令");
             return;
         }
         
@@ -225,8 +221,7 @@ namespace VFT_SMF {
         issued_instructions.push_back(instruction);
         total_instructions_issued++;
         
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-            "ATC代理指令已写入全局共享数据空间: " + instruction.instruction_content);
+        VFT_LOG_BRIEF("ATC代理指令已写入全局共享数据空间: {}", instruction.instruction_content);
     }
 
     void ATCAgent::update_instruction_status(const std::string& instruction_id, bool acknowledged, bool executed) {
@@ -368,8 +363,7 @@ namespace VFT_SMF {
                  bool ATCAgent::executeController(const std::string& controller_name, 
                                       const std::map<std::string, std::string>& params,
                                       double current_time) {
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-            "ATC代理执行控制器: " + controller_name + " (时间: " + std::to_string(current_time) + "s)");
+        VFT_LOG_BRIEF("ATC代理执行控制器: {} (时间: {}s)", controller_name, current_time);
         
         bool executed = false;
         
@@ -386,8 +380,7 @@ namespace VFT_SMF {
             }
             
             if (executed) {
-                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                    "ATC代理: 使用策略 " + atc_strategy->getStrategyId() + " 执行控制器: " + controller_name);
+                VFT_LOG_BRIEF("ATC代理: 使用策略 {} 执行控制器: {}", atc_strategy->getStrategyId(), controller_name);
             }
         }
         
@@ -402,22 +395,18 @@ namespace VFT_SMF {
             } else if (controller_name == "issue_landing_clearance") {
                 executed = executeLandingClearanceController(params, current_time);
             } else {
-                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                    "ATC代理: 未知的控制器名称: " + controller_name);
+                VFT_LOG_BRIEF("ATC代理: 未知的控制器名称: {}", controller_name);
             }
             
             if (executed) {
-                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                    "ATC代理: 使用默认实现执行控制器: " + controller_name);
+                VFT_LOG_BRIEF("ATC代理: 使用默认实现执行控制器: {}", controller_name);
             }
         }
         
         if (executed) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                "ATC代理控制器执行成功: " + controller_name);
+            VFT_LOG_BRIEF("ATC代理控制器执行成功: {}", controller_name);
         } else {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                "ATC代理控制器执行失败: " + controller_name);
+            VFT_LOG_BRIEF("ATC代理控制器执行失败: {}", controller_name);
         }
         
         return executed;
@@ -425,7 +414,7 @@ namespace VFT_SMF {
 
     int ATCAgent::processAgentEventQueue(double current_time) {
         if (!shared_data_space) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理: 全局共享数据空间未设置");
+            VFT_LOG_BRIEF("ATC代理: 全局共享数据空间未设置");
             return 0;
         }
         
@@ -434,26 +423,21 @@ namespace VFT_SMF {
         
         // 处理代理事件队列中的所有事件
         while (shared_data_space->dequeueAgentEvent(get_agent_id(), queue_item)) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                "ATC代理处理事件: " + queue_item.event.event_name + 
-                " (控制器: " + queue_item.controller_type + "::" + queue_item.controller_name + ")");
+            VFT_LOG_BRIEF("ATC代理处理事件: {} (控制器: {}::{})", queue_item.event.event_name, queue_item.controller_type, queue_item.controller_name);
             
             // 执行对应的控制器
             bool executed = executeController(queue_item.controller_name, queue_item.parameters, current_time);
             
             if (executed) {
                 processed_count++;
-                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                    "ATC代理事件处理成功: " + queue_item.event.event_name);
+                VFT_LOG_BRIEF("ATC代理事件处理成功: {}", queue_item.event.event_name);
             } else {
-                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                    "ATC代理事件处理失败: " + queue_item.event.event_name);
+                VFT_LOG_BRIEF("ATC代理事件处理失败: {}", queue_item.event.event_name);
             }
         }
         
         if (processed_count > 0) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                "ATC代理本步处理事件数量: " + std::to_string(processed_count));
+            VFT_LOG_BRIEF("ATC代理本步处理事件数量: {}", processed_count);
         }
         
         return processed_count;
@@ -462,10 +446,10 @@ namespace VFT_SMF {
     // ==================== ATC控制器具体实现 ====================
 
     bool ATCAgent::executeClearanceController(const std::map<std::string, std::string>& params, double current_time) {
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理: 执行滑行许可控制器");
+        VFT_LOG_BRIEF("ATC代理: 执行滑行许可控制器");
         
         if (!shared_data_space) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理: 全局共享数据空间未设置");
+            VFT_LOG_BRIEF("ATC代理: 全局共享数据空间未设置");
             return false;
         }
         
@@ -475,15 +459,15 @@ namespace VFT_SMF {
         atc_command.datasource = agent_id + "_clearance_controller";
         shared_data_space->setATCCommand(atc_command);
         
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理: 滑行许可已发放，clearance_granted设置为true");
+        VFT_LOG_BRIEF("ATC代理: 滑行许可已发放，clearance_granted设置为true");
         return true;
     }
 
     bool ATCAgent::executeEmergencyBrakeController(const std::map<std::string, std::string>& params, double current_time) {
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理: 执行紧急刹车控制器");
+        VFT_LOG_BRIEF("ATC代理: 执行紧急刹车控制器");
         
         if (!shared_data_space) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理: 全局共享数据空间未设置");
+            VFT_LOG_BRIEF("ATC代理: 全局共享数据空间未设置");
             return false;
         }
         
@@ -503,15 +487,15 @@ namespace VFT_SMF {
         system_state.current_brake_pressure = 2000000.0;  // 紧急刹车压力设为最大值
         shared_data_space->setAircraftSystemState(system_state);
         
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理: 紧急刹车指令已执行，emergency_brake设置为true");
+        VFT_LOG_BRIEF("ATC代理: 紧急刹车指令已执行，emergency_brake设置为true");
         return true;
     }
 
     bool ATCAgent::executeTakeoffClearanceController(const std::map<std::string, std::string>& params, double current_time) {
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理: 执行起飞许可控制器");
+        VFT_LOG_BRIEF("ATC代理: 执行起飞许可控制器");
         
         if (!shared_data_space) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理: 全局共享数据空间未设置");
+            VFT_LOG_BRIEF("ATC代理: 全局共享数据空间未设置");
             return false;
         }
         
@@ -521,15 +505,15 @@ namespace VFT_SMF {
         atc_command.datasource = agent_id + "_takeoff_clearance_controller";
         shared_data_space->setATCCommand(atc_command);
         
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理: 起飞许可已发放，clearance_granted设置为true");
+        VFT_LOG_BRIEF("ATC代理: 起飞许可已发放，clearance_granted设置为true");
         return true;
     }
 
     bool ATCAgent::executeLandingClearanceController(const std::map<std::string, std::string>& params, double current_time) {
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理: 执行着陆许可控制器");
+        VFT_LOG_BRIEF("ATC代理: 执行着陆许可控制器");
         
         if (!shared_data_space) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理: 全局共享数据空间未设置");
+            VFT_LOG_BRIEF("ATC代理: 全局共享数据空间未设置");
             return false;
         }
         
@@ -539,7 +523,7 @@ namespace VFT_SMF {
         atc_command.datasource = agent_id + "_landing_clearance_controller";
         shared_data_space->setATCCommand(atc_command);
         
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC代理: 着陆许可已发放，clearance_granted设置为true");
+        VFT_LOG_BRIEF("ATC代理: 着陆许可已发放，clearance_granted设置为true");
         return true;
     }
 
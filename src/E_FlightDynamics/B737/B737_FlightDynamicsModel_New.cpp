@@ -26,7 +26,7 @@ namespace FlightDynamics {
 
     // ==================== B737FlightDynamicsModel 实现 ====================
 
-    B737FlightDynamicsModel::B737FlightDynamicsModel() {
+    B737FlightDynamicsModel::B737FlightDynamicsModel() : landing_gear(LandingGear::makeB737(B737_EMPTY_WEIGHT)) {
         // 初始化B737物理参数
         physics_params.mass = B737_EMPTY_WEIGHT;
         
@@ -38,7 +38,7 @@ namespace FlightDynamics {
         physics_params.inertia_xz = 0.0;       // XZ惯性积（通常为0）
         physics_params.inertia_yz = 0.0;       // YZ惯性积（通常为0）
         
-        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "B737飞行动力学模型已创建");
+        VFT_LOG_DETAIL("B737飞行动力学模型已创建");
     }
 
     SixAxisForces B737FlightDynamicsModel::calculateForces(const VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& current_state) {
@@ -53,34 +53,18 @@ namespace FlightDynamics {
         double gravity = physics_params.mass * 9.81;
         forces.force_z = lift - gravity; // 升力 - 重力
         
-        // 地面支反力（法向力）：当接地时抵消向下合力，并加入速度阻尼，避免垂直速度持续向下
-        // 跑道高度简化为0
-        const double runway_elevation = 0.0;
-        if (current_state.altitude <= runway_elevation + 1e-6) {
-            // 线性阻尼项：仅对向下速度施加阻尼，使N随下冲速度增大
-            const double damping_coefficient = 5e5; // N·s/m（可调）
-            const double v_down = std::min(0.0, current_state.vertical_speed); // 向下为负
-            const double damping = damping_coefficient * (-v_down);
-            // 反力基值：抵消向下合力的负值部分，确保不把机体“吸”到地里
-            const double normal_base = std::max(0.0, -forces.force_z);
-            const double normal_force = normal_base + damping;
-            forces.force_z += normal_force;
-
-            // 跑道滚阻与制动纵向摩擦（基于法向力）
-            // 取地面切向速度近似为地速（airspeed）
-            const double vx = current_state.airspeed;
-            const double sgn_vx = (vx > 1e-3) ? 1.0 : ((vx < -1e-3) ? -1.0 : 0.0);
-            // 滚动阻力
-            const double c_rr = 0.02; // 经验滚阻系数
-            const double F_rr = c_rr * normal_force * sgn_vx;
-            // 制动摩擦：环境摩擦系数 * 刹车比例 * N
-            // 直接使用环境摩擦与刹车比例：
-            const double env_mu = 0.2; // 如需从环境状态读取，可通过 updateInputFromGlobalState 传入
-            const double brake_ratio = std::max(0.0, std::min(1.0, current_input.brake_pressure)); // 0..1
-            const double F_brk = env_mu * brake_ratio * normal_force * sgn_vx;
-            // 将滚阻与刹车力作用到纵向
-            forces.force_x -= (F_rr + F_brk);
-        }
+        // 地面反力：起落架按本步步长隐式求解法向力，纵向为滚阻与主轮刹车的库仑约束
+        GroundContactInput ground_input;
+        ground_input.runway_elevation = current_input.runway_elevation;
+        ground_input.friction_coefficient = current_input.runway_friction;
+        ground_input.brake_ratio = current_input.brake_pressure;
+        ground_input.gear_position = current_input.landing_gear_position;
+        // 取地面切向速度近似为地速（airspeed）
+        last_ground_reaction = landing_gear.solve(current_state.altitude, current_state.vertical_speed,
+                                                  current_state.airspeed, forces.force_z, forces.force_x,
+                                                  integration_step, ground_input);
+        forces.force_z += last_ground_reaction.normal_force;
+        forces.force_x -= last_ground_reaction.friction_force;
         
         forces.moment_x = calculateRollMoment(current_state);
         forces.moment_y = calculatePitchMoment(current_state);
@@ -89,6 +73,13 @@ namespace FlightDynamics {
         return forces;
     }
 
+    GroundContact B737FlightDynamicsModel::getGroundContact() const {
+        GroundContact contact;
+        contact.on_ground = last_ground_reaction.on_ground;
+        contact.min_altitude = last_ground_reaction.min_altitude;
+        return contact;
+    }
+
     AircraftPhysicsParams B737FlightDynamicsModel::getPhysicsParams() const {
         return physics_params;
     }
@@ -99,10 +90,7 @@ namespace FlightDynamics {
 
     void B737FlightDynamicsModel::initialize(const VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& initial_state) {
         this->initial_state = initial_state;
-        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, 
-                           "B737飞行动力学模型已初始化: 位置=(" + 
-                           std::to_string(initial_state.latitude) + ", " + 
-                           std::to_string(initial_state.longitude) + ")");
+        VFT_LOG_DETAIL("B737飞行动力学模型已初始化: 位置=({}, {})", initial_state.latitude, initial_state.longitude);
     }
 
     void B737FlightDynamicsModel::updateInputFromGlobalState(
@@ -123,6 +111,9 @@ namespace FlightDynamics {
         current_input.wind_direction = env_state.wind_direction;
         current_input.air_density = env_state.air_density;
         current_input.temperature = 288.15; // 标准大气温度
+        current_input.runway_elevation = env_state.runway_elevation;
+        // 环境未给出摩擦系数时沿用干跑道刹车摩擦经验值
+        current_input.runway_friction = env_state.friction_coefficient > 0.0 ? env_state.friction_coefficient : 0.2;
     }
 
     // ==================== 私有方法实现 ====================
@@ -228,7 +219,7 @@ namespace FlightDynamics {
         // 添加数值限制，防止异常值导致计算复杂度爆炸
         const double MAX_MOMENT = 1e6; // 最大力矩限制 (N·m)
         if (std::abs(roll_moment) > MAX_MOMENT) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "力矩数值异常: 滚转力矩 " + std::to_string(roll_moment) + " 超过限制，已限制为 " + std::to_string(MAX_MOMENT));
+            VFT_LOG_BRIEF("力矩数值异常: 滚转力矩 {} 超过限制，已限制为 {}", roll_moment, MAX_MOMENT);
             roll_moment = (roll_moment > 0) ? MAX_MOMENT : -MAX_MOMENT;
         }
         
@@ -257,7 +248,7 @@ namespace FlightDynamics {
         // 添加数值限制，防止异常值导致计算复杂度爆炸
         const double MAX_MOMENT = 1e6; // 最大力矩限制 (N·m)
         if (std::abs(pitch_moment) > MAX_MOMENT) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "力矩数值异常: 俯仰力矩 " + std::to_string(pitch_moment) + " 超过限制，已限制为 " + std::to_string(MAX_MOMENT));
+            VFT_LOG_BRIEF("力矩数值异常: 俯仰力矩 {} 超过限制，已限制为 {}", pitch_moment, MAX_MOMENT);
             pitch_moment = (pitch_moment > 0) ? MAX_MOMENT : -MAX_MOMENT;
         }
         
@@ -286,7 +277,7 @@ namespace FlightDynamics {
         // 添加数值限制，防止异常值导致计算复杂度爆炸
         const double MAX_MOMENT = 1e6; // 最大力矩限制 (N·m)
         if (std::abs(yaw_moment) > MAX_MOMENT) {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "力矩数值异常: 偏航力矩 " + std::to_string(yaw_moment) + " 超过限制，已限制为 " + std::to_string(MAX_MOMENT));
+            VFT_LOG_BRIEF("力矩数值异常: 偏航力矩 {} 超过限制，已限制为 {}", yaw_moment, MAX_MOMENT);
             yaw_moment = (yaw_moment > 0) ? MAX_MOMENT : -MAX_MOMENT;
         }
         
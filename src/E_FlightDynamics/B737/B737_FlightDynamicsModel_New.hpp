@@ -10,6 +10,7 @@
 #define B737_FLIGHT_DYNAMICS_MODEL_NEW_HPP
 
 #include "../FlightDynamicsAgent.hpp"
+#include "../LandingGear.hpp"
 #include "../../E_GlobalSharedDataSpace/GlobalSharedDataSpace.hpp"
 #include "../../G_SimulationManager/LogAndData/Logger.hpp"
 #include <string>
@@ -22,7 +23,7 @@ namespace FlightDynamics {
      * @brief B737飞行动力学模型
      * @details 实现B737机型的6分量外力计算
      */
-    class B737FlightDynamicsModel : public IFlightDynamicsModel {
+    class B737FlightDynamicsModel final : public IFlightDynamicsModel {
     private:
         // B737特定的输入状态
         struct B737InputState {
@@ -40,16 +41,22 @@ namespace FlightDynamics {
             double wind_direction;         ///< 风向 (度)
             double air_density;            ///< 空气密度 (kg/m³)
             double temperature;            ///< 温度 (K)
+            double runway_elevation;       ///< 跑道标高 (m)
+            double runway_friction;        ///< 跑道摩擦系数
             
             B737InputState() : throttle_position(0.0), elevator_deflection(0.0),
                               aileron_deflection(0.0), rudder_deflection(0.0),
                               flap_position(0.0), landing_gear_position(1.0),
                               brake_pressure(0.0), wind_speed(0.0),
                               wind_direction(0.0), air_density(1.225),
-                              temperature(288.15) {}
+                              temperature(288.15), runway_elevation(0.0),
+                              runway_friction(0.2) {}
         };
         
         B737InputState current_input;
+        LandingGear landing_gear;
+        double integration_step {0.0};
+        GroundReaction last_ground_reaction;
         VFT_SMF::GlobalSharedDataStruct::AircraftFlightState initial_state;
         AircraftPhysicsParams physics_params;
         // 最近一次计算的发动机相关量（用于外部读取/记录）
@@ -101,6 +108,24 @@ namespace FlightDynamics {
         void updateInputFromGlobalState(
             const VFT_SMF::GlobalSharedDataStruct::AircraftSystemState& system_state,
             const VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState& env_state) override;
+        
+        /**
+         * @brief 设置起落架隐式求解的积分步长
+         * @param delta_time 时间步长 (秒)
+         */
+        void setIntegrationStep(double delta_time) override { integration_step = delta_time; }
+        
+        /**
+         * @brief 获取最近一次起落架求解得到的地面接触状态
+         * @return 地面接触状态
+         */
+        GroundContact getGroundContact() const override;
+        
+        /**
+         * @brief 获取最近一次起落架求解的各支柱状态
+         * @return 地面反力
+         */
+        const GroundReaction& getGroundReaction() const { return last_ground_reaction; }
 
     private:
         /**
@@ -10,16 +10,18 @@
 #ifndef FLIGHT_DYNAMICS_AGENT_HPP
 #define FLIGHT_DYNAMICS_AGENT_HPP
 
+#include <array>
 #include <string>
 #include <memory>
 #include <chrono>
 #include <cmath>
-#include <random>
 #include <mutex>
 #include <algorithm>
 #include "../E_GlobalSharedDataSpace/GlobalSharedDataSpace.hpp"
 #include "../G_SimulationManager/B_SimManage/SimulationNameSpace.hpp"
+#include "../G_SimulationManager/B_SimManage/RandomService.hpp"
 #include "../G_SimulationManager/LogAndData/Logger.hpp"
+#include "LocalTangentFrame.hpp"
 
 // 定义M_PI（Windows上可能未定义）
 #ifndef M_PI
@@ -53,6 +55,17 @@ namespace FlightDynamics {
               moment_x(mx), moment_y(my), moment_z(mz) {}
     };
 
+    /**
+     * @brief 地面接触状态
+     * @details 由机型模型在计算外力时给出，代理据此施加地面硬约束与滚转约束
+     */
+    struct GroundContact {
+        bool on_ground;        ///< 起落架（或机体）承载
+        double min_altitude;   ///< 高度下限 (m)，低于此值时钳制高度并消除向下速度
+
+        GroundContact() : on_ground(false), min_altitude(0.0) {}
+    };
+
 
 
     /**
@@ -116,6 +129,30 @@ namespace FlightDynamics {
         virtual void updateInputFromGlobalState(
             const VFT_SMF::GlobalSharedDataStruct::AircraftSystemState& system_state,
             const VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState& env_state) = 0;
+        
+        /**
+         * @brief 设置下一次 calculateForces 对应的积分步长
+         * @details 隐式求解的力（如起落架）需要步长；0 表示连续时间力
+         * @param delta_time 时间步长 (秒)
+         */
+        virtual void setIntegrationStep(double delta_time) { (void)delta_time; }
+        
+        /**
+         * @brief 获取最近一次 calculateForces 得到的地面接触状态
+         * @return 地面接触状态，默认以高度0为地面
+         */
+        virtual GroundContact getGroundContact() const { return GroundContact(); }
+    };
+
+    class IFlightDynamicsPipeline;
+    struct PipelineStep;
+
+    /**
+     * @brief 水平位置积分方式
+     */
+    enum class PositionIntegration {
+        Spherical,       ///< 每步以球面近似直接积分经纬度
+        LocalTangent     ///< 在锚定的 WGS-84 切平面（NED）内积分，按需转换经纬度
     };
 
     /**
@@ -129,17 +166,9 @@ namespace FlightDynamics {
         
         // 物理参数
         AircraftPhysicsParams physics_params;
-        // 预计算的惯量逆矩阵（仅用于对角矩阵场景）
-        struct InverseInertiaMatrix {
-            double inv_xx;
-            double inv_yy;
-            double inv_zz;
-            bool diagonal_only; // 若为 true，表示惯量积为0，可用对角逆
-            InverseInertiaMatrix() : inv_xx(0.0), inv_yy(0.0), inv_zz(0.0), diagonal_only(true) {}
-        } inverse_inertia;
-        
-        // 机型模型
-        std::unique_ptr<IFlightDynamicsModel> aircraft_model;
+        
+        // 机型流水线（机型模型、积分器与噪声策略编译期组合，见 FlightDynamicsPipeline.hpp）
+        std::unique_ptr<IFlightDynamicsPipeline> pipeline;
         std::string current_aircraft_type;
         
         // 时间管理
@@ -148,24 +177,33 @@ namespace FlightDynamics {
         // 线程安全
         mutable std::mutex agent_mutex;
         
-        // 随机数生成器（用于模拟真实飞行中的微小扰动）
-        std::random_device rd;
-        std::mt19937 gen;
-        std::normal_distribution<double> noise_dist;
         // 缓存上一帧计算的外力，避免重复计算
         SixAxisForces last_forces;
+        // 缓存上一帧的地面接触状态
+        GroundContact last_ground_contact;
+        
+        // 水平位置积分：切平面模式下经纬度只在需要时由切平面坐标换算
+        PositionIntegration position_integration;
+        double reanchor_distance;          ///< 离锚点超过此水平距离时重新锚定 (m)
+        LocalTangentFrame local_frame;     ///< 锚点与切平面位置随 current_state 一并发布
+        int reanchor_count {0};
+        
+        // 新建代理的默认位置积分方式（由仿真配置设置）
+        static PositionIntegration default_position_integration;
+        static double default_reanchor_distance;
 
     public:
         /**
          * @brief 构造函数
          * @param aircraft_type 飞机类型
+         * @param acceleration_noise 是否加入加速度扰动
          */
-        FlightDynamicsAgent(const std::string& aircraft_type = "B737");
+        FlightDynamicsAgent(const std::string& aircraft_type = "B737", bool acceleration_noise = true);
         
         /**
          * @brief 析构函数
          */
-        ~FlightDynamicsAgent() = default;
+        ~FlightDynamicsAgent();
         
         /**
          * @brief 初始化代理
@@ -209,22 +247,76 @@ namespace FlightDynamics {
          */
         SixAxisForces getCurrentForces() const;
         
-
-
-    private:
         /**
-         * @brief 计算加速度
+         * @brief 设置水平位置积分方式（应在 initialize 之前调用）
+         * @param mode 积分方式
+         * @param reanchor_distance_m 切平面重新锚定距离 (m)
+         */
+        void setPositionIntegration(PositionIntegration mode, double reanchor_distance_m);
+        
+        /**
+         * @brief 获取切平面坐标系
+         */
+        LocalTangentFrame getLocalFrame() const;
+        
+        /**
+         * @brief 获取相对当前锚点的切平面位置（地向由高度换算）
+         */
+        NedPosition getLocalPosition() const;
+        
+        /**
+         * @brief 获取重新锚定次数
+         */
+        int getReanchorCount() const;
+        
+        /**
+         * @brief 设置新建代理的默认位置积分方式
+         * @param mode 积分方式
+         * @param reanchor_distance_m 切平面重新锚定距离 (m)
+         */
+        static void setDefaultPositionIntegration(PositionIntegration mode, double reanchor_distance_m);
+        
+        /**
+         * @brief 解析位置积分方式名称（"local_ned" / "spherical"）
+         * @return 是否识别
+         */
+        static bool parsePositionIntegration(const std::string& name, PositionIntegration& mode);
+        
+        /**
+         * @brief 获取当前地面接触状态
+         * @return 地面接触状态
+         */
+        GroundContact getGroundContact() const;
+        
+        /**
+         * @brief 计算给定状态与输入下的加速度（不加噪声、不推进状态）
+         * @details 供配平、线性化等离线分析使用；会以给定输入刷新机型模型，
+         *          之后的 updateFromGlobalState 会重新写入实际输入
+         * @param state 飞机飞行状态
+         * @param system_state 飞机系统状态
+         * @param env_state 环境状态
+         * @return 6分量加速度（3个线性加速度 m/s² + 3个角加速度 rad/s²）
+         */
+        std::array<double, 6> evaluateAccelerations(
+            const VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& state,
+            const VFT_SMF::GlobalSharedDataStruct::AircraftSystemState& system_state,
+            const VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState& env_state);
+        
+        /**
+         * @brief 由外力计算加速度（不加噪声）
          * @param forces 6分量外力
+         * @param params 飞机物理参数
          * @return 6分量加速度（3个线性加速度 + 3个角加速度）
          */
-        std::array<double, 6> calculateAccelerations(const SixAxisForces& forces);
-        
+        static std::array<double, 6> accelerationsFromForces(const SixAxisForces& forces, const AircraftPhysicsParams& params);
+
+    private:
         /**
-         * @brief 更新速度
+         * @brief 记录流水线本步结果并推进位置和姿态
+         * @param result 流水线本步结果
          * @param delta_time 时间步长
-         * @param accelerations 加速度
          */
-        void updateVelocities(double delta_time, const std::array<double, 6>& accelerations);
+        void finishStep(const PipelineStep& result, double delta_time);
         
         /**
          * @brief 更新位置和姿态
@@ -233,19 +325,20 @@ namespace FlightDynamics {
         void updatePositionAndAttitude(double delta_time);
         
         /**
-         * @brief 添加噪声
-         * @param value 原始值
-         * @param noise_level 噪声水平
-         * @return 添加噪声后的值
+         * @brief 以当前位置为切平面锚点，切平面位置清零
          */
-        double addNoise(double value, double noise_level);
+        void reanchorAtCurrentPosition();
         
         /**
-         * @brief 创建机型模型
-         * @param aircraft_type 飞机类型
-         * @return 机型模型指针
+         * @brief 把切平面位置换算为经纬度写入 current_state
          */
-        std::unique_ptr<IFlightDynamicsModel> createAircraftModel(const std::string& aircraft_type);
+        void resolveGeodetic();
+        
+        /**
+         * @brief 切平面位置换算为大地坐标
+         */
+        GeodeticPosition localToGeodetic() const;
+        
     };
 
 } // namespace FlightDynamics
@@ -0,0 +1,275 @@
+/**
+ * @file FlightDynamicsPipeline.hpp
+ * @brief 编译期特化的飞行动力学单步流水线
+ * @details 外力 → 加速度 → 噪声 → 速度积分 的单步计算以模板组合：
+ *          机型模型、积分器与噪声策略均为模板参数，流水线内部对具体类型直接调用（无虚函数分派），
+ *          惯量逆矩阵在构造时预计算。
+ *
+ *          只有场景边界（FlightDynamicsAgent 按机型名称创建流水线）经过一层类型擦除接口
+ *          IFlightDynamicsPipeline，每步一次间接调用。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#ifndef FLIGHT_DYNAMICS_PIPELINE_HPP
+#define FLIGHT_DYNAMICS_PIPELINE_HPP
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <algorithm>
+#include "FlightDynamicsAgent.hpp"
+
+namespace VFT_SMF {
+namespace FlightDynamics {
+
+    /**
+     * @brief 单步计算结果
+     */
+    struct PipelineStep {
+        SixAxisForces forces;                     ///< 6分量外力
+        GroundContact ground_contact;             ///< 地面接触状态
+        std::array<double, 6> accelerations {};   ///< 加噪声后的6分量加速度
+    };
+
+    /**
+     * @brief 惯量逆矩阵（构造时预计算，逐步只做乘加）
+     * @details 行列式接近0时退化为对角惯量
+     */
+    class InverseInertia {
+    public:
+        explicit InverseInertia(const AircraftPhysicsParams& params) : mass(params.mass) {
+            const double det_I = params.inertia_xx * params.inertia_yy * params.inertia_zz +
+                                 params.inertia_xy * params.inertia_yz * params.inertia_xz +
+                                 params.inertia_xz * params.inertia_xy * params.inertia_yz -
+                                 params.inertia_xz * params.inertia_yy * params.inertia_xz -
+                                 params.inertia_xy * params.inertia_xy * params.inertia_zz -
+                                 params.inertia_xx * params.inertia_yz * params.inertia_yz;
+            diagonal_only = std::abs(det_I) < 1e-6;
+            if (diagonal_only) {
+                inv_xx = params.inertia_xx;
+                inv_yy = params.inertia_yy;
+                inv_zz = params.inertia_zz;
+                inv_xy = inv_xz = inv_yz = 0.0;
+                return;
+            }
+            inv_xx = (params.inertia_yy * params.inertia_zz - params.inertia_yz * params.inertia_yz) / det_I;
+            inv_yy = (params.inertia_xx * params.inertia_zz - params.inertia_xz * params.inertia_xz) / det_I;
+            inv_zz = (params.inertia_xx * params.inertia_yy - params.inertia_xy * params.inertia_xy) / det_I;
+            inv_xy = -(params.inertia_xy * params.inertia_zz - params.inertia_xz * params.inertia_yz) / det_I;
+            inv_xz = (params.inertia_xy * params.inertia_yz - params.inertia_xz * params.inertia_yy) / det_I;
+            inv_yz = -(params.inertia_xx * params.inertia_yz - params.inertia_xz * params.inertia_xy) / det_I;
+        }
+
+        /**
+         * @brief 由外力计算加速度（F = ma，α = I⁻¹M）
+         */
+        std::array<double, 6> apply(const SixAxisForces& forces) const {
+            std::array<double, 6> accelerations;
+            accelerations[0] = forces.force_x / mass;
+            accelerations[1] = forces.force_y / mass;
+            accelerations[2] = forces.force_z / mass;
+            if (diagonal_only) {
+                // 退化情形存放的是惯量本身
+                accelerations[3] = forces.moment_x / inv_xx;
+                accelerations[4] = forces.moment_y / inv_yy;
+                accelerations[5] = forces.moment_z / inv_zz;
+                return accelerations;
+            }
+            accelerations[3] = inv_xx * forces.moment_x + inv_xy * forces.moment_y + inv_xz * forces.moment_z;
+            accelerations[4] = inv_xy * forces.moment_x + inv_yy * forces.moment_y + inv_yz * forces.moment_z;
+            accelerations[5] = inv_xz * forces.moment_x + inv_yz * forces.moment_y + inv_zz * forces.moment_z;
+
+            // 角加速度限制，防止异常值导致数值不稳定
+            const double MAX_ANGULAR_ACCEL = 1000.0; // 最大角加速度限制 (rad/s²)
+            for (int i = 3; i < 6; ++i) {
+                if (std::abs(accelerations[i]) > MAX_ANGULAR_ACCEL) {
+                    VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "角加速度数值异常: 轴" + std::to_string(i-2) + " 角加速度 " + std::to_string(accelerations[i]) + " 超过限制，已限制为 " + std::to_string(MAX_ANGULAR_ACCEL));
+                    accelerations[i] = (accelerations[i] > 0) ? MAX_ANGULAR_ACCEL : -MAX_ANGULAR_ACCEL;
+                }
+            }
+            return accelerations;
+        }
+
+    private:
+        double mass;
+        double inv_xx, inv_yy, inv_zz, inv_xy, inv_xz, inv_yz;
+        bool diagonal_only;
+    };
+
+    // ==================== 噪声策略 ====================
+
+    /**
+     * @brief 加速度高斯扰动（模拟真实飞行中的微小扰动，按机型与仿真步号可复现）
+     */
+    class GaussianAccelerationNoise {
+    public:
+        explicit GaussianAccelerationNoise(const std::string& aircraft_type)
+            : rng(SimManage::RandomService::stream("flight_dynamics_" + aircraft_type, "acceleration_noise")) {}
+
+        void apply(std::array<double, 6>& accelerations) {
+            for (int i = 0; i < 6; ++i) {
+                accelerations[i] += rng.normal(0.0, 0.1) * NOISE_LEVEL;
+            }
+        }
+
+    private:
+        static constexpr double NOISE_LEVEL = 0.01;
+        SimManage::RandomStream rng;
+    };
+
+    /**
+     * @brief 无扰动（确定性离线分析）
+     */
+    struct NoAccelerationNoise {
+        explicit NoAccelerationNoise(const std::string&) {}
+        void apply(std::array<double, 6>&) {}
+    };
+
+    // ==================== 积分器策略 ====================
+
+    /**
+     * @brief 半隐式欧拉：加速度积分为空速、垂直速度与角速度（位置与姿态由代理按位置积分方式推进）
+     */
+    struct SemiImplicitEulerIntegrator {
+        static void integrateVelocities(VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& state,
+                                        const std::array<double, 6>& accelerations, double delta_time) {
+            state.longitudinal_accel = accelerations[0];
+            state.lateral_accel = accelerations[1];
+            state.vertical_accel = accelerations[2];
+
+            // 更新空速（简化：假设空速主要受纵向加速度影响）
+            state.airspeed += accelerations[0] * delta_time;
+            state.airspeed = std::max(0.0, state.airspeed);
+
+            // 更新垂直速度
+            state.vertical_speed += accelerations[2] * delta_time;
+            state.vertical_speed = std::max(-50.0, std::min(50.0, state.vertical_speed));
+
+            // 计算地速（简化：假设地速等于空速）
+            state.groundspeed = std::max(0.0, state.airspeed);
+
+            // 更新角速度（角加速度积分，转换为度/秒）
+            state.roll_rate += accelerations[3] * 180.0 / M_PI * delta_time;
+            state.pitch_rate += accelerations[4] * 180.0 / M_PI * delta_time;
+            state.yaw_rate += accelerations[5] * 180.0 / M_PI * delta_time;
+
+            clampRate(state.roll_rate, "滚转");
+            clampRate(state.pitch_rate, "俯仰");
+            clampRate(state.yaw_rate, "偏航");
+        }
+
+    private:
+        static void clampRate(double& rate, const char* axis) {
+            const double MAX_ANGULAR_RATE = 360.0; // 最大角速度限制 (度/秒)
+            if (std::abs(rate) > MAX_ANGULAR_RATE) {
+                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, std::string("角速度数值异常: ") + axis + "角速度 " + std::to_string(rate) + " 超过限制，已限制为 " + std::to_string(MAX_ANGULAR_RATE));
+                rate = (rate > 0) ? MAX_ANGULAR_RATE : -MAX_ANGULAR_RATE;
+            }
+        }
+    };
+
+    // ==================== 类型擦除边界 ====================
+
+    /**
+     * @brief 飞行动力学流水线接口（场景边界的类型擦除层）
+     */
+    class IFlightDynamicsPipeline {
+    public:
+        virtual ~IFlightDynamicsPipeline() = default;
+
+        /**
+         * @brief 推进一步：外力 → 加速度 → 噪声 → 速度积分
+         * @param state 飞行状态（原地更新速度与加速度）
+         * @param delta_time 时间步长 (秒)
+         * @param result 本步外力、地面接触与加速度
+         */
+        virtual void step(VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& state, double delta_time,
+                          PipelineStep& result) = 0;
+
+        /**
+         * @brief 以全局状态刷新模型输入后推进一步
+         */
+        virtual void stepWithInput(VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& state, double delta_time,
+                                   const VFT_SMF::GlobalSharedDataStruct::AircraftSystemState& system_state,
+                                   const VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState& env_state,
+                                   PipelineStep& result) = 0;
+
+        /**
+         * @brief 给定状态与输入下的连续时间加速度（不加噪声、不推进状态）
+         */
+        virtual std::array<double, 6> evaluate(const VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& state,
+                                               const VFT_SMF::GlobalSharedDataStruct::AircraftSystemState& system_state,
+                                               const VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState& env_state) = 0;
+
+        /**
+         * @brief 机型模型（初始化、查询等非逐步调用）
+         */
+        virtual IFlightDynamicsModel& getModel() = 0;
+    };
+
+    /**
+     * @brief 编译期特化的飞行动力学流水线
+     * @tparam Model 具体机型模型（直接成员，调用在编译期确定）
+     * @tparam Integrator 积分器策略
+     * @tparam Noise 噪声策略
+     */
+    template <class Model, class Integrator = SemiImplicitEulerIntegrator, class Noise = GaussianAccelerationNoise>
+    class FlightDynamicsPipeline final : public IFlightDynamicsPipeline {
+    public:
+        explicit FlightDynamicsPipeline(const std::string& aircraft_type)
+            : noise(aircraft_type), inverse_inertia(model.getPhysicsParams()) {}
+
+        void step(VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& state, double delta_time,
+                  PipelineStep& result) override {
+            advance(state, delta_time, result);
+        }
+
+        void stepWithInput(VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& state, double delta_time,
+                           const VFT_SMF::GlobalSharedDataStruct::AircraftSystemState& system_state,
+                           const VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState& env_state,
+                           PipelineStep& result) override {
+            model.updateInputFromGlobalState(system_state, env_state);
+            advance(state, delta_time, result);
+        }
+
+        std::array<double, 6> evaluate(const VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& state,
+                                       const VFT_SMF::GlobalSharedDataStruct::AircraftSystemState& system_state,
+                                       const VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState& env_state) override {
+            model.updateInputFromGlobalState(system_state, env_state);
+            model.setIntegrationStep(0.0);
+            return inverse_inertia.apply(model.calculateForces(state));
+        }
+
+        IFlightDynamicsModel& getModel() override { return model; }
+
+    private:
+        void advance(VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& state, double delta_time,
+                     PipelineStep& result) {
+            // 地面反力按本步步长隐式求解
+            model.setIntegrationStep(delta_time);
+            result.forces = model.calculateForces(state);
+            result.ground_contact = model.getGroundContact();
+            result.accelerations = inverse_inertia.apply(result.forces);
+            noise.apply(result.accelerations);
+            Integrator::integrateVelocities(state, result.accelerations, delta_time);
+        }
+
+        Model model;
+        Noise noise;
+        InverseInertia inverse_inertia;
+    };
+
+    /**
+     * @brief 按机型名称创建流水线（场景边界，仅在构造代理时调用）
+     * @param aircraft_type 飞机类型，未知机型使用 B737
+     * @param acceleration_noise 是否加入加速度扰动
+     */
+    std::unique_ptr<IFlightDynamicsPipeline> createFlightDynamicsPipeline(const std::string& aircraft_type,
+                                                                          bool acceleration_noise);
+
+} // namespace FlightDynamics
+} // namespace VFT_SMF
+
+#endif // FLIGHT_DYNAMICS_PIPELINE_HPP
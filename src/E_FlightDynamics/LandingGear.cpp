@@ -0,0 +1,158 @@
+/**
+ * @file LandingGear.cpp
+ * @brief 起落架地面接触模型实现
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include "LandingGear.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace VFT_SMF {
+namespace FlightDynamics {
+
+    namespace {
+        constexpr double GRAVITY = 9.81;                  ///< 重力加速度 (m/s²)
+        constexpr double GEAR_DOWN_THRESHOLD = 0.99;      ///< 起落架视为放下锁定的位置阈值
+
+        // B737起落架参数
+        constexpr double B737_NOSE_LOAD_FRACTION = 0.08;  ///< 前起落架静载比例
+        constexpr double B737_STATIC_COMPRESSION = 0.15;  ///< 静压缩量 (m)
+        constexpr double B737_DAMPING_RATIO = 0.7;        ///< 垂直方向阻尼比
+        constexpr double B737_MAX_STROKE = 0.40;          ///< 最大行程 (m)
+        constexpr double B737_ROLLING_RESISTANCE = 0.02;  ///< 轮胎滚动阻力系数
+    }
+
+    LandingGear::LandingGear(double aircraft_mass, const std::array<OleoStrutParams, STRUT_COUNT>& strut_params)
+        : mass(aircraft_mass), struts(strut_params) {
+        for (int i = 0; i < STRUT_COUNT; ++i) {
+            const double static_load = struts[i].static_load_fraction * mass * GRAVITY;
+            static_compression[i] = struts[i].stiffness > 0.0 ? static_load / struts[i].stiffness : 0.0;
+        }
+    }
+
+    LandingGear LandingGear::makeB737(double mass) {
+        const double weight = mass * GRAVITY;
+        const double total_stiffness = weight / B737_STATIC_COMPRESSION;
+        const double total_damping = 2.0 * B737_DAMPING_RATIO * std::sqrt(total_stiffness * mass);
+        const double main_load_fraction = 0.5 * (1.0 - B737_NOSE_LOAD_FRACTION);
+
+        std::array<OleoStrutParams, STRUT_COUNT> params;
+        const char* names[STRUT_COUNT] = {"nose", "left_main", "right_main"};
+        for (int i = 0; i < STRUT_COUNT; ++i) {
+            OleoStrutParams& strut = params[i];
+            strut.name = names[i];
+            strut.static_load_fraction = (i == NOSE) ? B737_NOSE_LOAD_FRACTION : main_load_fraction;
+            strut.stiffness = strut.static_load_fraction * total_stiffness;
+            strut.damping = strut.static_load_fraction * total_damping;
+            strut.max_stroke = B737_MAX_STROKE;
+            strut.rolling_resistance = B737_ROLLING_RESISTANCE;
+            strut.braked = (i != NOSE);
+        }
+        return LandingGear(mass, params);
+    }
+
+    GroundReaction LandingGear::solve(double altitude, double vertical_speed, double ground_speed,
+                                      double vertical_force, double longitudinal_force,
+                                      double delta_time, const GroundContactInput& input) const {
+        GroundReaction reaction;
+
+        // 起落架未放下锁定时机体在跑道标高处刚性接触：法向力恰好消除向下合力与下沉速度，
+        // 纵向按跑道摩擦系数滑动
+        if (input.gear_position < GEAR_DOWN_THRESHOLD) {
+            reaction.min_altitude = input.runway_elevation;
+            if (altitude <= input.runway_elevation) {
+                const double sink_rate = delta_time > 0.0 ? mass * std::max(0.0, -vertical_speed) / delta_time : 0.0;
+                reaction.normal_force = std::max(0.0, -vertical_force + sink_rate);
+                reaction.on_ground = true;
+                const double direction = (ground_speed > 1e-3) ? 1.0 : ((ground_speed < -1e-3) ? -1.0 : 0.0);
+                reaction.friction_force = std::max(0.0, input.friction_coefficient) * reaction.normal_force * direction;
+            }
+            return reaction;
+        }
+
+        double min_margin = std::numeric_limits<double>::max();
+        for (int i = 0; i < STRUT_COUNT; ++i) {
+            min_margin = std::min(min_margin, struts[i].max_stroke - static_compression[i]);
+        }
+        reaction.min_altitude = input.runway_elevation - std::max(0.0, min_margin);
+
+        // 下沉量：高度低于跑道标高的部分，支柱压缩量 = 下沉量 + 静压缩量
+        const double sink = input.runway_elevation - altitude;
+        const double dt = std::max(0.0, delta_time);
+
+        // 步末垂直速度 v 处第 i 根支柱的力：k(sink + s - v·dt) - c·v，随 v 单调递减；
+        // 力降为0的速度即该支柱的脱离点，按脱离点从高到低依次加入活动集
+        std::array<double, STRUT_COUNT> release_speed;
+        std::array<int, STRUT_COUNT> order;
+        for (int i = 0; i < STRUT_COUNT; ++i) {
+            const double stiffness_term = struts[i].stiffness * dt + struts[i].damping;
+            const double preload = struts[i].stiffness * (sink + static_compression[i]);
+            release_speed[i] = stiffness_term > 0.0 ? preload / stiffness_term
+                                                    : (preload > 0.0 ? std::numeric_limits<double>::max()
+                                                                     : -std::numeric_limits<double>::max());
+            order[i] = i;
+        }
+        std::sort(order.begin(), order.end(), [&](int a, int b) { return release_speed[a] > release_speed[b]; });
+
+        // 步长为0：连续时间力，速度不随支柱力变化
+        double end_speed = vertical_speed;
+        int active_count = 0;
+        if (dt > 0.0) {
+            // 后向欧拉：m(v' - v)/dt = F_ext + Σ_active [P_i - D_i v']
+            double preload_sum = 0.0;
+            double stiffness_sum = 0.0;
+            for (int j = 0; j <= STRUT_COUNT; ++j) {
+                const double candidate = (vertical_speed + dt / mass * (vertical_force + preload_sum)) /
+                                         (1.0 + dt / mass * stiffness_sum);
+                const bool below_active = (j == 0) || candidate < release_speed[order[j - 1]];
+                const bool above_inactive = (j == STRUT_COUNT) || candidate >= release_speed[order[j]];
+                if (below_active && above_inactive) {
+                    end_speed = candidate;
+                    active_count = j;
+                    break;
+                }
+                if (j < STRUT_COUNT) {
+                    const Strut strut = static_cast<Strut>(order[j]);
+                    preload_sum += struts[strut].stiffness * (sink + static_compression[strut]);
+                    stiffness_sum += struts[strut].stiffness * dt + struts[strut].damping;
+                }
+            }
+        } else {
+            for (int j = 0; j < STRUT_COUNT; ++j) {
+                if (release_speed[order[j]] > end_speed) active_count = j + 1;
+            }
+        }
+
+        // 各支柱法向力与摩擦力上限
+        const double brake_mu = std::max(0.0, input.friction_coefficient) * std::clamp(input.brake_ratio, 0.0, 1.0);
+        double friction_limit = 0.0;
+        for (int j = 0; j < active_count; ++j) {
+            const int i = order[j];
+            StrutState& state = reaction.struts[i];
+            state.compression = sink + static_compression[i] - end_speed * dt;
+            state.normal_force = std::max(0.0, struts[i].stiffness * state.compression - struts[i].damping * end_speed);
+            state.in_contact = state.normal_force > 0.0;
+            const double mu = struts[i].rolling_resistance + (struts[i].braked ? brake_mu : 0.0);
+            state.friction_force = mu * state.normal_force;
+            reaction.normal_force += state.normal_force;
+            friction_limit += state.friction_force;
+            reaction.on_ground = reaction.on_ground || state.in_contact;
+        }
+
+        // 纵向库仑约束：止动所需的力在摩擦上限内时取止动力，否则取上限
+        if (dt > 0.0) {
+            const double stopping_force = mass * ground_speed / dt + longitudinal_force;
+            reaction.friction_force = std::clamp(stopping_force, -friction_limit, friction_limit);
+        } else {
+            const double direction = (ground_speed > 1e-3) ? 1.0 : ((ground_speed < -1e-3) ? -1.0 : 0.0);
+            reaction.friction_force = friction_limit * direction;
+        }
+
+        return reaction;
+    }
+
+} // namespace FlightDynamics
+} // namespace VFT_SMF
@@ -0,0 +1,144 @@
+/**
+ * @file LandingGear.hpp
+ * @brief 起落架地面接触模型
+ * @details 前起落架与左右主起落架各为一根油气减震支柱（弹簧+阻尼），支柱力只能为压力；
+ *          轮胎滚动阻力与主轮刹车摩擦按各支柱法向力计算。
+ *
+ *          垂直方向按后向欧拉隐式求解：支柱力取步末压缩量与步末下沉速度处的值，
+ *          与步末垂直速度联立为一元线性方程，按活动集剔除伸长脱离的支柱后重解，
+ *          因此对任意步长无条件稳定，静止时不会出现法向力振荡。
+ *          纵向摩擦按库仑约束处理：所需的止动力不超过可用摩擦力时取止动力（刹停/驻车），
+ *          否则取可用摩擦力，避免低速时摩擦力来回换向。
+ *          步长为0时退化为连续时间力（供配平、线性化求导数）。
+ *
+ *          高度参考：飞机高度等于跑道标高时支柱处于静压缩量，即重力由起落架恰好承担。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#ifndef LANDING_GEAR_HPP
+#define LANDING_GEAR_HPP
+
+#include <array>
+#include <string>
+
+namespace VFT_SMF {
+namespace FlightDynamics {
+
+    /**
+     * @brief 单根油气减震支柱参数
+     */
+    struct OleoStrutParams {
+        std::string name;                 ///< 支柱名称
+        double static_load_fraction;      ///< 静载分配比例
+        double stiffness;                 ///< 支柱刚度 (N/m)
+        double damping;                   ///< 支柱阻尼 (N·s/m)
+        double max_stroke;                ///< 最大行程 (m)
+        double rolling_resistance;        ///< 轮胎滚动阻力系数
+        bool braked;                      ///< 是否装有刹车
+
+        OleoStrutParams() : static_load_fraction(0.0), stiffness(0.0), damping(0.0),
+                            max_stroke(0.0), rolling_resistance(0.0), braked(false) {}
+    };
+
+    /**
+     * @brief 地面接触输入（来自环境与系统状态）
+     */
+    struct GroundContactInput {
+        double runway_elevation;          ///< 跑道标高 (m)
+        double friction_coefficient;      ///< 跑道摩擦系数
+        double brake_ratio;               ///< 刹车比例 [0.0, 1.0]
+        double gear_position;             ///< 起落架位置 [0.0, 1.0]，1 为放下锁定
+
+        GroundContactInput() : runway_elevation(0.0), friction_coefficient(0.2),
+                               brake_ratio(0.0), gear_position(1.0) {}
+    };
+
+    /**
+     * @brief 单根支柱的求解结果
+     */
+    struct StrutState {
+        bool in_contact;                  ///< 是否承载
+        double compression;               ///< 步末压缩量 (m)
+        double normal_force;              ///< 法向力 (N)
+        double friction_force;            ///< 纵向摩擦力上限 (N)
+
+        StrutState() : in_contact(false), compression(0.0), normal_force(0.0), friction_force(0.0) {}
+    };
+
+    /**
+     * @brief 地面反力求解结果
+     */
+    struct GroundReaction {
+        bool on_ground;                   ///< 任一支柱承载
+        double normal_force;              ///< 法向力合力，向上为正 (N)
+        double friction_force;            ///< 纵向摩擦力，与前进方向相反为正 (N)
+        double min_altitude;              ///< 支柱压到底时的高度 (m)，低于此值由机体硬约束
+        std::array<StrutState, 3> struts; ///< 各支柱状态
+
+        GroundReaction() : on_ground(false), normal_force(0.0), friction_force(0.0), min_altitude(0.0) {}
+    };
+
+    /**
+     * @brief 起落架模型
+     */
+    class LandingGear {
+    public:
+        /**
+         * @brief 支柱编号
+         */
+        enum Strut {
+            NOSE = 0,
+            LEFT_MAIN,
+            RIGHT_MAIN,
+            STRUT_COUNT
+        };
+
+        /**
+         * @brief 构造函数
+         * @param mass 飞机质量 (kg)，用于确定静压缩量与隐式求解
+         * @param struts 支柱参数
+         */
+        LandingGear(double mass, const std::array<OleoStrutParams, STRUT_COUNT>& struts);
+
+        /**
+         * @brief B737起落架参数：静压缩量0.15 m、阻尼比约0.7
+         * @param mass 飞机质量 (kg)
+         */
+        static LandingGear makeB737(double mass);
+
+        /**
+         * @brief 求解一个积分步的地面反力
+         * @param altitude 步初高度 (m)
+         * @param vertical_speed 步初垂直速度，向上为正 (m/s)
+         * @param ground_speed 步初前进速度 (m/s)
+         * @param vertical_force 除起落架外的垂直合力，向上为正 (N)
+         * @param longitudinal_force 除起落架外的纵向合力，向前为正 (N)
+         * @param delta_time 积分步长 (s)，0 表示连续时间
+         * @param input 地面接触输入
+         * @return 地面反力
+         */
+        GroundReaction solve(double altitude, double vertical_speed, double ground_speed,
+                             double vertical_force, double longitudinal_force,
+                             double delta_time, const GroundContactInput& input) const;
+
+        /**
+         * @brief 获取支柱参数
+         */
+        const OleoStrutParams& getStrut(Strut strut) const { return struts[strut]; }
+
+        /**
+         * @brief 获取支柱静压缩量 (m)
+         */
+        double getStaticCompression(Strut strut) const { return static_compression[strut]; }
+
+    private:
+        double mass;
+        std::array<OleoStrutParams, STRUT_COUNT> struts;
+        std::array<double, STRUT_COUNT> static_compression;
+    };
+
+} // namespace FlightDynamics
+} // namespace VFT_SMF
+
+#endif // LANDING_GEAR_HPP
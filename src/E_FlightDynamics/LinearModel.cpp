@@ -0,0 +1,422 @@
+/**
+ * @file LinearModel.cpp
+ * @brief 飞行动力学数值线性化与线性状态空间代理模型实现
+ * @author VFT_SMF Framework
+ * @date 2024
+ */
+
+#include "LinearModel.hpp"
+#include "../G_SimulationManager/LogAndData/Logger.hpp"
+#include "../I_ThirdPartyTools/json.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace VFT_SMF {
+namespace FlightDynamics {
+
+    namespace {
+
+        const double RAD_TO_DEG = 180.0 / M_PI;
+
+        // 6阶Padé近似在 ‖A‖₁ ≤ 0.5 时截断误差低于双精度舍入
+        const int PADE_ORDER = 6;
+        const double PADE_NORM_LIMIT = 0.5;
+
+        // 中心差分相对步长
+        const double DIFFERENCE_STEP = 1e-4;
+
+        nlohmann::json matrixToJson(const Matrix& matrix) {
+            nlohmann::json rows = nlohmann::json::array();
+            for (size_t i = 0; i < matrix.rows; ++i) {
+                nlohmann::json row = nlohmann::json::array();
+                for (size_t j = 0; j < matrix.cols; ++j) row.push_back(matrix(i, j));
+                rows.push_back(row);
+            }
+            return rows;
+        }
+
+    } // namespace
+
+    // ==================== Matrix ====================
+
+    Matrix Matrix::identity(size_t size) {
+        Matrix result(size, size);
+        for (size_t i = 0; i < size; ++i) result(i, i) = 1.0;
+        return result;
+    }
+
+    Matrix Matrix::operator*(const Matrix& other) const {
+        Matrix result(rows, other.cols);
+        for (size_t i = 0; i < rows; ++i) {
+            for (size_t k = 0; k < cols; ++k) {
+                const double value = (*this)(i, k);
+                if (value == 0.0) continue;
+                for (size_t j = 0; j < other.cols; ++j) result(i, j) += value * other(k, j);
+            }
+        }
+        return result;
+    }
+
+    Matrix Matrix::operator+(const Matrix& other) const {
+        Matrix result = *this;
+        for (size_t i = 0; i < data.size(); ++i) result.data[i] += other.data[i];
+        return result;
+    }
+
+    Matrix Matrix::operator*(double scale) const {
+        Matrix result = *this;
+        for (double& value : result.data) value *= scale;
+        return result;
+    }
+
+    double Matrix::norm1() const {
+        double norm = 0.0;
+        for (size_t j = 0; j < cols; ++j) {
+            double sum = 0.0;
+            for (size_t i = 0; i < rows; ++i) sum += std::abs((*this)(i, j));
+            norm = std::max(norm, sum);
+        }
+        return norm;
+    }
+
+    Matrix Matrix::block(size_t row, size_t col, size_t row_count, size_t col_count) const {
+        Matrix result(row_count, col_count);
+        for (size_t i = 0; i < row_count; ++i) {
+            for (size_t j = 0; j < col_count; ++j) result(i, j) = (*this)(row + i, col + j);
+        }
+        return result;
+    }
+
+    bool solveMatrix(const Matrix& a, const Matrix& b, Matrix& x) {
+        const size_t n = a.rows;
+        Matrix lu = a;
+        x = b;
+        for (size_t col = 0; col < n; ++col) {
+            size_t pivot = col;
+            for (size_t row = col + 1; row < n; ++row) {
+                if (std::abs(lu(row, col)) > std::abs(lu(pivot, col))) pivot = row;
+            }
+            if (std::abs(lu(pivot, col)) < 1e-300) return false;
+            if (pivot != col) {
+                for (size_t k = 0; k < n; ++k) std::swap(lu(pivot, k), lu(col, k));
+                for (size_t k = 0; k < x.cols; ++k) std::swap(x(pivot, k), x(col, k));
+            }
+            for (size_t row = col + 1; row < n; ++row) {
+                const double factor = lu(row, col) / lu(col, col);
+                if (factor == 0.0) continue;
+                for (size_t k = col; k < n; ++k) lu(row, k) -= factor * lu(col, k);
+                for (size_t k = 0; k < x.cols; ++k) x(row, k) -= factor * x(col, k);
+            }
+        }
+        for (size_t i = n; i-- > 0;) {
+            for (size_t k = 0; k < x.cols; ++k) {
+                double sum = x(i, k);
+                for (size_t j = i + 1; j < n; ++j) sum -= lu(i, j) * x(j, k);
+                x(i, k) = sum / lu(i, i);
+            }
+        }
+        return true;
+    }
+
+    Matrix matrixExponential(const Matrix& a) {
+        const size_t n = a.rows;
+
+        // 缩放：exp(A) = exp(A/2^s)^(2^s)
+        int squarings = 0;
+        const double norm = a.norm1();
+        if (norm > PADE_NORM_LIMIT) {
+            squarings = static_cast<int>(std::ceil(std::log2(norm / PADE_NORM_LIMIT)));
+        }
+        const Matrix scaled = a * std::ldexp(1.0, -squarings);
+
+        // Padé近似 N(A)/D(A)，D(A) = N(-A)
+        Matrix numerator = Matrix::identity(n);
+        Matrix denominator = Matrix::identity(n);
+        Matrix power = Matrix::identity(n);
+        double coefficient = 1.0;
+        for (int k = 1; k <= PADE_ORDER; ++k) {
+            coefficient *= static_cast<double>(PADE_ORDER - k + 1) / (k * (2 * PADE_ORDER - k + 1));
+            power = power * scaled;
+            numerator = numerator + power * coefficient;
+            denominator = denominator + power * ((k % 2 == 0) ? coefficient : -coefficient);
+        }
+
+        Matrix result;
+        if (!solveMatrix(denominator, numerator, result)) {
+            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "矩阵指数计算失败：Padé分母矩阵奇异");
+            return Matrix::identity(n);
+        }
+
+        // 平方还原
+        for (int i = 0; i < squarings; ++i) result = result * result;
+        return result;
+    }
+
+    // ==================== LinearModel ====================
+
+    const std::vector<std::string>& LinearModel::stateNames() {
+        static const std::vector<std::string> names = {
+            "airspeed", "vertical_speed", "altitude", "roll", "pitch", "heading", "roll_rate", "pitch_rate", "yaw_rate",
+        };
+        return names;
+    }
+
+    const std::vector<std::string>& LinearModel::inputNames() {
+        static const std::vector<std::string> names = {"throttle", "elevator", "aileron", "rudder"};
+        return names;
+    }
+
+    const std::vector<std::string>& LinearModel::outputNames() {
+        static const std::vector<std::string> names = [] {
+            std::vector<std::string> result = stateNames();
+            result.push_back("longitudinal_accel");
+            result.push_back("lateral_accel");
+            result.push_back("vertical_accel");
+            return result;
+        }();
+        return names;
+    }
+
+    bool LinearModel::writeJson(const std::string& file_path) const {
+        nlohmann::json json;
+        json["states"] = stateNames();
+        json["inputs"] = inputNames();
+        json["outputs"] = outputNames();
+        json["state0"] = state0;
+        json["input0"] = input0;
+        json["output0"] = output0;
+        json["derivative0"] = derivative0;
+        json["A"] = matrixToJson(a);
+        json["B"] = matrixToJson(b);
+        json["C"] = matrixToJson(c);
+        json["D"] = matrixToJson(d);
+
+        std::ofstream file(file_path);
+        if (!file.is_open()) {
+            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "无法写出线性模型: " + file_path);
+            return false;
+        }
+        file << json.dump(2) << std::endl;
+        return true;
+    }
+
+    // ==================== Linearizer ====================
+
+    Linearizer::Linearizer(const std::string& aircraft_type) : agent(aircraft_type) {}
+
+    std::vector<double> Linearizer::stateFromFlightState(const VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& flight_state) {
+        return {
+            flight_state.airspeed,
+            flight_state.vertical_speed,
+            flight_state.altitude,
+            flight_state.roll,
+            flight_state.pitch,
+            flight_state.heading,
+            flight_state.roll_rate,
+            flight_state.pitch_rate,
+            flight_state.yaw_rate,
+        };
+    }
+
+    std::vector<double> Linearizer::inputFromSystemState(const VFT_SMF::GlobalSharedDataStruct::AircraftSystemState& system_state) {
+        return {
+            system_state.current_throttle_position,
+            system_state.current_elevator_deflection,
+            system_state.current_aileron_deflection,
+            system_state.current_rudder_deflection,
+        };
+    }
+
+    void Linearizer::evaluate(const std::vector<double>& state, const std::vector<double>& input,
+                              const VFT_SMF::GlobalSharedDataStruct::AircraftSystemState& system_state,
+                              const VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState& env_state,
+                              std::vector<double>& derivative, std::vector<double>& output) {
+        VFT_SMF::GlobalSharedDataStruct::AircraftFlightState flight_state;
+        flight_state.airspeed = state[LinearModel::AIRSPEED];
+        flight_state.groundspeed = state[LinearModel::AIRSPEED];
+        flight_state.vertical_speed = state[LinearModel::VERTICAL_SPEED];
+        flight_state.altitude = state[LinearModel::ALTITUDE];
+        flight_state.roll = state[LinearModel::ROLL];
+        flight_state.pitch = state[LinearModel::PITCH];
+        flight_state.heading = state[LinearModel::HEADING];
+        flight_state.roll_rate = state[LinearModel::ROLL_RATE];
+        flight_state.pitch_rate = state[LinearModel::PITCH_RATE];
+        flight_state.yaw_rate = state[LinearModel::YAW_RATE];
+        flight_state.landing_gear_deployed = system_state.current_landing_gear_deployed > 0.5;
+        flight_state.flaps_deployed = system_state.current_flaps_deployed > 0.0;
+
+        VFT_SMF::GlobalSharedDataStruct::AircraftSystemState controls = system_state;
+        controls.current_throttle_position = input[LinearModel::THROTTLE];
+        controls.current_elevator_deflection = input[LinearModel::ELEVATOR];
+        controls.current_aileron_deflection = input[LinearModel::AILERON];
+        controls.current_rudder_deflection = input[LinearModel::RUDDER];
+
+        const auto accelerations = agent.evaluateAccelerations(flight_state, controls, env_state);
+
+        // 与代理积分一致：空速与垂直速度由纵向、垂直加速度驱动，角速度单位为度/秒
+        derivative.assign(LinearModel::STATE_COUNT, 0.0);
+        derivative[LinearModel::AIRSPEED] = accelerations[0];
+        derivative[LinearModel::VERTICAL_SPEED] = accelerations[2];
+        derivative[LinearModel::ALTITUDE] = state[LinearModel::VERTICAL_SPEED];
+        derivative[LinearModel::ROLL] = state[LinearModel::ROLL_RATE];
+        derivative[LinearModel::PITCH] = state[LinearModel::PITCH_RATE];
+        derivative[LinearModel::HEADING] = state[LinearModel::YAW_RATE];
+        derivative[LinearModel::ROLL_RATE] = accelerations[3] * RAD_TO_DEG;
+        derivative[LinearModel::PITCH_RATE] = accelerations[4] * RAD_TO_DEG;
+        derivative[LinearModel::YAW_RATE] = accelerations[5] * RAD_TO_DEG;
+
+        output.assign(state.begin(), state.end());
+        output.push_back(accelerations[0]);
+        output.push_back(accelerations[1]);
+        output.push_back(accelerations[2]);
+    }
+
+    LinearModel Linearizer::linearize(const TrimResult& operating_point) {
+        return linearize(stateFromFlightState(operating_point.flight_state), inputFromSystemState(operating_point.system_state),
+                         operating_point.system_state, operating_point.env_state);
+    }
+
+    LinearModel Linearizer::linearize(const std::vector<double>& state, const std::vector<double>& input,
+                                      const VFT_SMF::GlobalSharedDataStruct::AircraftSystemState& system_state,
+                                      const VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState& env_state) {
+        LinearModel model;
+        model.state0 = state;
+        model.input0 = input;
+        model.system_state = system_state;
+        model.env_state = env_state;
+        evaluate(state, input, system_state, env_state, model.derivative0, model.output0);
+
+        model.a = Matrix(LinearModel::STATE_COUNT, LinearModel::STATE_COUNT);
+        model.b = Matrix(LinearModel::STATE_COUNT, LinearModel::INPUT_COUNT);
+        model.c = Matrix(LinearModel::OUTPUT_COUNT, LinearModel::STATE_COUNT);
+        model.d = Matrix(LinearModel::OUTPUT_COUNT, LinearModel::INPUT_COUNT);
+
+        std::vector<double> plus_derivative, minus_derivative, plus_output, minus_output;
+
+        // 对状态做中心差分：A 与 C
+        for (size_t j = 0; j < LinearModel::STATE_COUNT; ++j) {
+            const double step = DIFFERENCE_STEP * std::max(1.0, std::abs(state[j]));
+            std::vector<double> plus = state, minus = state;
+            plus[j] += step;
+            minus[j] -= step;
+            evaluate(plus, input, system_state, env_state, plus_derivative, plus_output);
+            evaluate(minus, input, system_state, env_state, minus_derivative, minus_output);
+            for (size_t i = 0; i < LinearModel::STATE_COUNT; ++i) {
+                model.a(i, j) = (plus_derivative[i] - minus_derivative[i]) / (2.0 * step);
+            }
+            for (size_t i = 0; i < LinearModel::OUTPUT_COUNT; ++i) {
+                model.c(i, j) = (plus_output[i] - minus_output[i]) / (2.0 * step);
+            }
+        }
+
+        // 对输入做中心差分：B 与 D
+        for (size_t j = 0; j < LinearModel::INPUT_COUNT; ++j) {
+            const double step = DIFFERENCE_STEP * std::max(1.0, std::abs(input[j]));
+            std::vector<double> plus = input, minus = input;
+            plus[j] += step;
+            minus[j] -= step;
+            evaluate(state, plus, system_state, env_state, plus_derivative, plus_output);
+            evaluate(state, minus, system_state, env_state, minus_derivative, minus_output);
+            for (size_t i = 0; i < LinearModel::STATE_COUNT; ++i) {
+                model.b(i, j) = (plus_derivative[i] - minus_derivative[i]) / (2.0 * step);
+            }
+            for (size_t i = 0; i < LinearModel::OUTPUT_COUNT; ++i) {
+                model.d(i, j) = (plus_output[i] - minus_output[i]) / (2.0 * step);
+            }
+        }
+
+        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail,
+                           "线性化完成: 空速=" + std::to_string(state[LinearModel::AIRSPEED]) +
+                           "m/s, 高度=" + std::to_string(state[LinearModel::ALTITUDE]) + "m");
+        return model;
+    }
+
+    // ==================== LinearSurrogate ====================
+
+    LinearSurrogate::LinearSurrogate(const LinearModel& linear_model, double discrete_step)
+        : model(linear_model), time_step(discrete_step) {
+        const size_t n = LinearModel::STATE_COUNT;
+        const size_t m = LinearModel::INPUT_COUNT;
+
+        // Van Loan：exp([[A, B, ẋ0], [0, 0, 0]]·dt) = [[Ad, Bd, drift], [0, I, 0]]
+        Matrix augmented(n + m + 1, n + m + 1);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j) augmented(i, j) = model.a(i, j) * time_step;
+            for (size_t j = 0; j < m; ++j) augmented(i, n + j) = model.b(i, j) * time_step;
+            augmented(i, n + m) = model.derivative0[i] * time_step;
+        }
+        const Matrix exponential = matrixExponential(augmented);
+        ad = exponential.block(0, 0, n, n);
+        bd = exponential.block(0, n, n, m);
+        drift.resize(n);
+        for (size_t i = 0; i < n; ++i) drift[i] = exponential(i, n + m);
+
+        next.resize(n);
+        reset();
+    }
+
+    void LinearSurrogate::reset() {
+        state = model.state0;
+        deviation.assign(LinearModel::STATE_COUNT, 0.0);
+        input_deviation.assign(LinearModel::INPUT_COUNT, 0.0);
+    }
+
+    void LinearSurrogate::setState(const std::vector<double>& absolute_state) {
+        state = absolute_state;
+        for (size_t i = 0; i < LinearModel::STATE_COUNT; ++i) deviation[i] = state[i] - model.state0[i];
+    }
+
+    const std::vector<double>& LinearSurrogate::step(const std::vector<double>& input) {
+        const size_t n = LinearModel::STATE_COUNT;
+        const size_t m = LinearModel::INPUT_COUNT;
+        for (size_t j = 0; j < m; ++j) input_deviation[j] = input[j] - model.input0[j];
+
+        for (size_t i = 0; i < n; ++i) {
+            double value = drift[i];
+            const double* ad_row = &ad.data[i * n];
+            const double* bd_row = &bd.data[i * m];
+            for (size_t j = 0; j < n; ++j) value += ad_row[j] * deviation[j];
+            for (size_t j = 0; j < m; ++j) value += bd_row[j] * input_deviation[j];
+            next[i] = value;
+        }
+        deviation.swap(next);
+        for (size_t i = 0; i < n; ++i) state[i] = model.state0[i] + deviation[i];
+        return state;
+    }
+
+    std::vector<double> LinearSurrogate::outputs(const std::vector<double>& input) const {
+        std::vector<double> result = model.output0;
+        for (size_t i = 0; i < LinearModel::OUTPUT_COUNT; ++i) {
+            for (size_t j = 0; j < LinearModel::STATE_COUNT; ++j) result[i] += model.c(i, j) * deviation[j];
+            for (size_t j = 0; j < LinearModel::INPUT_COUNT; ++j) result[i] += model.d(i, j) * (input[j] - model.input0[j]);
+        }
+        return result;
+    }
+
+    VFT_SMF::GlobalSharedDataStruct::AircraftFlightState LinearSurrogate::getFlightState() const {
+        std::vector<double> input = model.input0;
+        for (size_t j = 0; j < LinearModel::INPUT_COUNT; ++j) input[j] += input_deviation[j];
+        const std::vector<double> output = outputs(input);
+
+        VFT_SMF::GlobalSharedDataStruct::AircraftFlightState flight_state;
+        flight_state.airspeed = output[LinearModel::AIRSPEED];
+        flight_state.groundspeed = output[LinearModel::AIRSPEED];
+        flight_state.vertical_speed = output[LinearModel::VERTICAL_SPEED];
+        flight_state.altitude = output[LinearModel::ALTITUDE];
+        flight_state.roll = output[LinearModel::ROLL];
+        flight_state.pitch = output[LinearModel::PITCH];
+        flight_state.heading = output[LinearModel::HEADING];
+        flight_state.roll_rate = output[LinearModel::ROLL_RATE];
+        flight_state.pitch_rate = output[LinearModel::PITCH_RATE];
+        flight_state.yaw_rate = output[LinearModel::YAW_RATE];
+        flight_state.longitudinal_accel = output[LinearModel::LONGITUDINAL_ACCEL];
+        flight_state.lateral_accel = output[LinearModel::LATERAL_ACCEL];
+        flight_state.vertical_accel = output[LinearModel::VERTICAL_ACCEL];
+        flight_state.landing_gear_deployed = model.system_state.current_landing_gear_deployed > 0.5;
+        flight_state.flaps_deployed = model.system_state.current_flaps_deployed > 0.0;
+        return flight_state;
+    }
+
+} // namespace FlightDynamics
+} // namespace VFT_SMF
@@ -0,0 +1,205 @@
+/**
+ * @file LinearModel.hpp
+ * @brief 飞行动力学数值线性化与线性状态空间代理模型
+ * @details 在配平点（见 TrimSolver）对 FlightDynamicsAgent 的状态方程做中心差分，得到
+ *            ẋ = A·δx + B·δu,  y = y0 + C·δx + D·δu
+ *          状态量与 AircraftFlightState 中代理积分的量一致（单位相同）：
+ *            空速、垂直速度、高度、滚转角、俯仰角、航向、滚转/俯仰/偏航角速度；
+ *          输入为油门、升降舵、副翼、方向舵；输出为全部状态量加纵向/横向/垂直加速度。
+ *
+ *          非配平工作点的 ẋ0 作为常值输入一并离散化。
+ *
+ *          LinearSurrogate 以精确离散化（矩阵指数，Van Loan 增广矩阵求零阶保持输入矩阵）
+ *          推进线性模型，单步只有一次小矩阵乘向量，不经过时钟、线程、日志与记录器，
+ *          用于配平点附近的小扰动控制律研究（自动驾驶、自动油门的稳定裕度与增益扫描）。
+ * @author VFT_SMF Framework
+ * @date 2024
+ */
+
+#ifndef LINEAR_MODEL_HPP
+#define LINEAR_MODEL_HPP
+
+#include "TrimSolver.hpp"
+#include <string>
+#include <vector>
+
+namespace VFT_SMF {
+namespace FlightDynamics {
+
+    /**
+     * @brief 行优先稠密矩阵（仅用于小规模状态空间运算）
+     */
+    struct Matrix {
+        size_t rows = 0;
+        size_t cols = 0;
+        std::vector<double> data;
+
+        Matrix() = default;
+        Matrix(size_t row_count, size_t col_count, double value = 0.0)
+            : rows(row_count), cols(col_count), data(row_count * col_count, value) {}
+
+        double& operator()(size_t row, size_t col) { return data[row * cols + col]; }
+        double operator()(size_t row, size_t col) const { return data[row * cols + col]; }
+
+        static Matrix identity(size_t size);
+        Matrix operator*(const Matrix& other) const;
+        Matrix operator+(const Matrix& other) const;
+        Matrix operator*(double scale) const;
+
+        /**
+         * @brief 1-范数（最大列绝对值和）
+         */
+        double norm1() const;
+
+        /**
+         * @brief 取子矩阵 [row, row+row_count) × [col, col+col_count)
+         */
+        Matrix block(size_t row, size_t col, size_t row_count, size_t col_count) const;
+    };
+
+    /**
+     * @brief 求解 A·X = B（部分主元LU，B可有多列），奇异时返回false
+     */
+    bool solveMatrix(const Matrix& a, const Matrix& b, Matrix& x);
+
+    /**
+     * @brief 矩阵指数 exp(A)，缩放与平方 + 6阶Padé近似
+     */
+    Matrix matrixExponential(const Matrix& a);
+
+    /**
+     * @brief 线性状态空间模型（在工作点附近的小扰动模型）
+     */
+    struct LinearModel {
+        enum State { AIRSPEED = 0, VERTICAL_SPEED, ALTITUDE, ROLL, PITCH, HEADING, ROLL_RATE, PITCH_RATE, YAW_RATE, STATE_COUNT };
+        enum Input { THROTTLE = 0, ELEVATOR, AILERON, RUDDER, INPUT_COUNT };
+        enum Output { LONGITUDINAL_ACCEL = STATE_COUNT, LATERAL_ACCEL, VERTICAL_ACCEL, OUTPUT_COUNT };
+
+        static const std::vector<std::string>& stateNames();
+        static const std::vector<std::string>& inputNames();
+        static const std::vector<std::string>& outputNames();
+
+        Matrix a;                          ///< STATE_COUNT × STATE_COUNT
+        Matrix b;                          ///< STATE_COUNT × INPUT_COUNT
+        Matrix c;                          ///< OUTPUT_COUNT × STATE_COUNT
+        Matrix d;                          ///< OUTPUT_COUNT × INPUT_COUNT
+
+        std::vector<double> state0;        ///< 工作点状态
+        std::vector<double> input0;        ///< 工作点输入
+        std::vector<double> output0;       ///< 工作点输出
+        std::vector<double> derivative0;   ///< 工作点状态导数（配平点为零，非配平点作为常值漂移项）
+
+        /// 工作点的构型与环境（线性化时保持不变）
+        VFT_SMF::GlobalSharedDataStruct::AircraftSystemState system_state;
+        VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState env_state;
+
+        /**
+         * @brief 写出为JSON（矩阵为二维数组）
+         */
+        bool writeJson(const std::string& file_path) const;
+    };
+
+    /**
+     * @brief 数值线性化器：对 FlightDynamicsAgent 的状态方程做中心差分
+     */
+    class Linearizer {
+    public:
+        explicit Linearizer(const std::string& aircraft_type = "B737");
+
+        /**
+         * @brief 在配平点线性化
+         */
+        LinearModel linearize(const TrimResult& operating_point);
+
+        /**
+         * @brief 在任意工作点线性化
+         * @param state 工作点状态（LinearModel::State 顺序）
+         * @param input 工作点输入（LinearModel::Input 顺序）
+         * @param system_state 构型（襟翼、起落架等，操纵量由 input 覆盖）
+         * @param env_state 环境状态
+         */
+        LinearModel linearize(const std::vector<double>& state, const std::vector<double>& input,
+                              const VFT_SMF::GlobalSharedDataStruct::AircraftSystemState& system_state,
+                              const VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState& env_state);
+
+        /**
+         * @brief 计算状态导数与输出
+         * @param derivative 输出 ẋ
+         * @param output 输出 y
+         */
+        void evaluate(const std::vector<double>& state, const std::vector<double>& input,
+                      const VFT_SMF::GlobalSharedDataStruct::AircraftSystemState& system_state,
+                      const VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState& env_state,
+                      std::vector<double>& derivative, std::vector<double>& output);
+
+        /**
+         * @brief 状态向量与飞行状态互转
+         */
+        static std::vector<double> stateFromFlightState(const VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& flight_state);
+        static std::vector<double> inputFromSystemState(const VFT_SMF::GlobalSharedDataStruct::AircraftSystemState& system_state);
+
+    private:
+        FlightDynamicsAgent agent;
+    };
+
+    /**
+     * @brief 线性代理模型：以精确离散化推进 δx[k+1] = Ad·δx[k] + Bd·δu[k]
+     */
+    class LinearSurrogate {
+    public:
+        /**
+         * @param model 线性模型
+         * @param time_step 离散步长 (s)，与仿真步长一致时为0.01
+         */
+        LinearSurrogate(const LinearModel& model, double time_step);
+
+        /**
+         * @brief 回到工作点
+         */
+        void reset();
+
+        /**
+         * @brief 设置绝对状态（LinearModel::State 顺序）
+         */
+        void setState(const std::vector<double>& state);
+
+        /**
+         * @brief 以绝对输入推进一步，返回推进后的绝对状态
+         */
+        const std::vector<double>& step(const std::vector<double>& input);
+
+        /**
+         * @brief 当前绝对状态
+         */
+        const std::vector<double>& getState() const { return state; }
+
+        /**
+         * @brief 当前状态与给定绝对输入下的绝对输出
+         */
+        std::vector<double> outputs(const std::vector<double>& input) const;
+
+        /**
+         * @brief 以飞行状态形式返回当前状态（经纬度不在线性模型中，保持为0）
+         */
+        VFT_SMF::GlobalSharedDataStruct::AircraftFlightState getFlightState() const;
+
+        const Matrix& getAd() const { return ad; }
+        const Matrix& getBd() const { return bd; }
+        double getTimeStep() const { return time_step; }
+
+    private:
+        LinearModel model;
+        double time_step;
+        Matrix ad;
+        Matrix bd;
+        std::vector<double> state;
+        std::vector<double> deviation;     ///< 当前 δx
+        std::vector<double> input_deviation;   ///< 最近一步的 δu
+        std::vector<double> drift;         ///< 工作点漂移项的离散化结果
+        std::vector<double> next;          ///< 推进缓冲，避免每步分配
+    };
+
+} // namespace FlightDynamics
+} // namespace VFT_SMF
+
+#endif // LINEAR_MODEL_HPP
@@ -0,0 +1,156 @@
+/**
+ * @file LocalTangentFrame.cpp
+ * @brief WGS-84 局部切平面（NED）坐标系实现
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include "LocalTangentFrame.hpp"
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace VFT_SMF {
+namespace FlightDynamics {
+
+    namespace {
+        constexpr double DEG_TO_RAD = M_PI / 180.0;
+        constexpr double RAD_TO_DEG = 180.0 / M_PI;
+    }
+
+    LocalTangentFrame::LocalTangentFrame() {
+        setAnchor(GeodeticPosition());
+    }
+
+    LocalTangentFrame::LocalTangentFrame(const GeodeticPosition& anchor_position) {
+        setAnchor(anchor_position);
+    }
+
+    void LocalTangentFrame::setAnchor(const GeodeticPosition& anchor_position) {
+        anchor = anchor_position;
+        anchor_ecef = geodeticToEcef(anchor);
+        const double lat = anchor.latitude * DEG_TO_RAD;
+        const double lon = anchor.longitude * DEG_TO_RAD;
+        sin_lat = std::sin(lat);
+        cos_lat = std::cos(lat);
+        sin_lon = std::sin(lon);
+        cos_lon = std::cos(lon);
+
+        const double w = std::sqrt(1.0 - WGS84_E2 * sin_lat * sin_lat);
+        prime_vertical_radius = WGS84_A / w;
+        meridian_radius = WGS84_A * (1.0 - WGS84_E2) / (w * w * w);
+        convergence_rate = sin_lat / (cos_lat * prime_vertical_radius);
+    }
+
+    NedPosition LocalTangentFrame::toNed(const GeodeticPosition& position) const {
+        const std::array<double, 3> ecef = geodeticToEcef(position);
+        const double dx = ecef[0] - anchor_ecef[0];
+        const double dy = ecef[1] - anchor_ecef[1];
+        const double dz = ecef[2] - anchor_ecef[2];
+
+        // 旋转 R = [-sinφcosλ -sinφsinλ cosφ; -sinλ cosλ 0; -cosφcosλ -cosφsinλ -sinφ]
+        NedPosition ned;
+        ned.north = -sin_lat * cos_lon * dx - sin_lat * sin_lon * dy + cos_lat * dz;
+        ned.east = -sin_lon * dx + cos_lon * dy;
+        ned.down = -cos_lat * cos_lon * dx - cos_lat * sin_lon * dy - sin_lat * dz;
+        return ned;
+    }
+
+    GeodeticPosition LocalTangentFrame::toGeodetic(const NedPosition& position) const {
+        // R 的转置
+        const double dx = -sin_lat * cos_lon * position.north - sin_lon * position.east - cos_lat * cos_lon * position.down;
+        const double dy = -sin_lat * sin_lon * position.north + cos_lon * position.east - cos_lat * sin_lon * position.down;
+        const double dz = cos_lat * position.north - sin_lat * position.down;
+        return ecefToGeodetic({anchor_ecef[0] + dx, anchor_ecef[1] + dy, anchor_ecef[2] + dz});
+    }
+
+    GeodeticPosition LocalTangentFrame::horizontalToGeodetic(double north, double east, double altitude) const {
+        const NedPosition position(north, east, anchor.altitude - altitude + curvatureDrop(north, east));
+        GeodeticPosition result = toGeodetic(position);
+        result.altitude = altitude;
+        return result;
+    }
+
+    double LocalTangentFrame::curvatureDrop(double north, double east) const {
+        return (north * north + east * east) / (2.0 * std::sqrt(meridian_radius * prime_vertical_radius));
+    }
+
+    std::array<double, 3> LocalTangentFrame::geodeticToEcef(const GeodeticPosition& position) {
+        const double lat = position.latitude * DEG_TO_RAD;
+        const double lon = position.longitude * DEG_TO_RAD;
+        const double s = std::sin(lat);
+        const double c = std::cos(lat);
+        const double n = WGS84_A / std::sqrt(1.0 - WGS84_E2 * s * s);
+        return {(n + position.altitude) * c * std::cos(lon),
+                (n + position.altitude) * c * std::sin(lon),
+                (n * (1.0 - WGS84_E2) + position.altitude) * s};
+    }
+
+    GeodeticPosition LocalTangentFrame::ecefToGeodetic(const std::array<double, 3>& ecef) {
+        const double p = std::sqrt(ecef[0] * ecef[0] + ecef[1] * ecef[1]);
+        const double lon = std::atan2(ecef[1], ecef[0]);
+
+        // Bowring 迭代：以当前纬度的卯酉圈半径修正 z 方向
+        double lat = std::atan2(ecef[2], p * (1.0 - WGS84_E2));
+        for (int iteration = 0; iteration < 5; ++iteration) {
+            const double s = std::sin(lat);
+            const double n = WGS84_A / std::sqrt(1.0 - WGS84_E2 * s * s);
+            const double next = std::atan2(ecef[2] + WGS84_E2 * n * s, p);
+            const bool converged = std::abs(next - lat) < 1e-15;
+            lat = next;
+            if (converged) break;
+        }
+
+        // 高度公式对极区同样适用（不除以 cos 纬度）
+        const double s = std::sin(lat);
+        const double c = std::cos(lat);
+        const double n = WGS84_A / std::sqrt(1.0 - WGS84_E2 * s * s);
+        const double altitude = p * c + ecef[2] * s - WGS84_A * WGS84_A / n;
+        return GeodeticPosition(lat * RAD_TO_DEG, lon * RAD_TO_DEG, altitude);
+    }
+
+    void GeodeticResolver::resolve(VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& state) {
+        if (!state.geodetic_stale) {
+            return;
+        }
+        const GeodeticPosition& anchor = frame.getAnchor();
+        if (anchor.latitude != state.anchor_latitude || anchor.longitude != state.anchor_longitude ||
+            anchor.altitude != state.anchor_altitude) {
+            frame.setAnchor(GeodeticPosition(state.anchor_latitude, state.anchor_longitude, state.anchor_altitude));
+        }
+        const GeodeticPosition position = frame.horizontalToGeodetic(state.local_north, state.local_east, state.altitude);
+        state.latitude = position.latitude;
+        state.longitude = position.longitude;
+        state.geodetic_stale = false;
+    }
+
+    VFT_SMF::GlobalSharedDataStruct::AircraftFlightState GeodeticResolver::resolved(const VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& state) {
+        VFT_SMF::GlobalSharedDataStruct::AircraftFlightState copy = state;
+        resolve(copy);
+        return copy;
+    }
+
+    double GroundDistance::add(double latitude, double longitude) {
+        if (!std::isfinite(latitude) || !std::isfinite(longitude)) {
+            return total;
+        }
+        const GeodeticPosition position(latitude, longitude, 0.0);
+        if (!has_previous) {
+            frame.setAnchor(position);
+            has_previous = true;
+            return total;
+        }
+        NedPosition current = frame.toNed(position);
+        total += std::hypot(current.north - previous.north, current.east - previous.east);
+        if (current.north * current.north + current.east * current.east > REANCHOR_DISTANCE_M * REANCHOR_DISTANCE_M) {
+            frame.setAnchor(position);
+            current = NedPosition();
+        }
+        previous = current;
+        return total;
+    }
+
+} // namespace FlightDynamics
+} // namespace VFT_SMF
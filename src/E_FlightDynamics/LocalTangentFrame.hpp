@@ -0,0 +1,171 @@
+/**
+ * @file LocalTangentFrame.hpp
+ * @brief WGS-84 局部切平面（NED）坐标系
+ * @details 以锚点（通常为起始跑道位置）为原点的北-东-地坐标系，与大地坐标（经纬高）双精度互转：
+ *          大地坐标 → ECEF → 绕锚点旋转得到 NED；逆变换经 ECEF 迭代求纬度与高度（Bowring，
+ *          亚毫米级一般2次迭代收敛）。
+ *
+ *          飞行动力学在切平面内积分水平位置，只在需要经纬度时才做一次转换；
+ *          切平面与椭球面的偏离随距离平方增长，远离锚点后应重新锚定（见 FlightDynamicsAgent）。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#ifndef LOCAL_TANGENT_FRAME_HPP
+#define LOCAL_TANGENT_FRAME_HPP
+
+#include <array>
+#include "../E_GlobalSharedDataSpace/GlobalSharedDataStruct.hpp"
+
+namespace VFT_SMF {
+namespace FlightDynamics {
+
+    /**
+     * @brief 大地坐标
+     */
+    struct GeodeticPosition {
+        double latitude;     ///< 纬度 (度)
+        double longitude;    ///< 经度 (度)
+        double altitude;     ///< 椭球高 (m)
+
+        GeodeticPosition() : latitude(0.0), longitude(0.0), altitude(0.0) {}
+        GeodeticPosition(double lat, double lon, double alt) : latitude(lat), longitude(lon), altitude(alt) {}
+    };
+
+    /**
+     * @brief 切平面坐标（北-东-地）
+     */
+    struct NedPosition {
+        double north;        ///< 北向 (m)
+        double east;         ///< 东向 (m)
+        double down;         ///< 地向 (m)
+
+        NedPosition() : north(0.0), east(0.0), down(0.0) {}
+        NedPosition(double n, double e, double d) : north(n), east(e), down(d) {}
+    };
+
+    /**
+     * @brief WGS-84 局部切平面坐标系
+     */
+    class LocalTangentFrame {
+    public:
+        static constexpr double WGS84_A = 6378137.0;                       ///< 长半轴 (m)
+        static constexpr double WGS84_F = 1.0 / 298.257223563;             ///< 扁率
+        static constexpr double WGS84_E2 = WGS84_F * (2.0 - WGS84_F);      ///< 第一偏心率平方
+
+        /**
+         * @brief 构造函数，锚点为经纬高 (0, 0, 0)
+         */
+        LocalTangentFrame();
+
+        /**
+         * @brief 构造函数
+         * @param anchor 锚点
+         */
+        explicit LocalTangentFrame(const GeodeticPosition& anchor);
+
+        /**
+         * @brief 重新设置锚点
+         * @param anchor 锚点
+         */
+        void setAnchor(const GeodeticPosition& anchor);
+
+        const GeodeticPosition& getAnchor() const { return anchor; }
+
+        /**
+         * @brief 大地坐标 → 切平面坐标
+         */
+        NedPosition toNed(const GeodeticPosition& position) const;
+
+        /**
+         * @brief 切平面坐标 → 大地坐标
+         */
+        GeodeticPosition toGeodetic(const NedPosition& position) const;
+
+        /**
+         * @brief 切平面水平位置 + 高度 → 大地坐标
+         * @details 切平面上的点按地球曲率下沉，使换算点落在给定高度面上；返回值的高度即 altitude
+         */
+        GeodeticPosition horizontalToGeodetic(double north, double east, double altitude) const;
+
+        /**
+         * @brief 水平偏离锚点 (north, east) 处椭球面相对切平面的下沉量 (m)
+         */
+        double curvatureDrop(double north, double east) const;
+
+        /**
+         * @brief 锚点处卯酉圈曲率半径 N (m)
+         */
+        double getPrimeVerticalRadius() const { return prime_vertical_radius; }
+
+        /**
+         * @brief 锚点处子午圈曲率半径 M (m)
+         */
+        double getMeridianRadius() const { return meridian_radius; }
+
+        /**
+         * @brief 锚点处子午线收敛率 tan(纬度)/N (rad/m)：东向每米，当地真北相对切平面北向西偏的角度
+         */
+        double getConvergenceRate() const { return convergence_rate; }
+
+        static std::array<double, 3> geodeticToEcef(const GeodeticPosition& position);
+        static GeodeticPosition ecefToGeodetic(const std::array<double, 3>& ecef);
+
+    private:
+        GeodeticPosition anchor;
+        std::array<double, 3> anchor_ecef;
+        double sin_lat, cos_lat, sin_lon, cos_lon;
+        double prime_vertical_radius;
+        double meridian_radius;
+        double convergence_rate;
+    };
+
+    /**
+     * @brief 发布状态的经纬度换算器
+     * @details 切平面积分时飞行动力学只发布切平面位置与锚点（geodetic_stale 置位），不在步内换算；
+     *          读端（数据记录器采样、遥测、终止判据）读经纬度前调用 resolve。锚点不变时复用缓存的坐标系，
+     *          每个读端持有自己的实例（非线程安全）。
+     */
+    class GeodeticResolver {
+    public:
+        /**
+         * @brief 经纬度过期时按切平面位置换算并写回，清除 geodetic_stale
+         */
+        void resolve(VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& state);
+
+        /**
+         * @brief 返回经纬度已换算的状态副本
+         */
+        VFT_SMF::GlobalSharedDataStruct::AircraftFlightState resolved(const VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& state);
+
+    private:
+        LocalTangentFrame frame;
+    };
+
+    /**
+     * @brief 累计地面距离：相邻采样点投影到 WGS-84 切平面后的水平距离之和
+     * @details 切平面锚定在首个有效采样点，离锚点超过 REANCHOR_DISTANCE_M 时在当前点重新锚定；
+     *          经纬度无效的采样不计入，也不作为下一段的起点。数据记录器的 distance_m 与终止判据的
+     *          distance 通道共用此累计方式。
+     */
+    class GroundDistance {
+    public:
+        /**
+         * @brief 累加到当前采样点，返回累计距离 (m)
+         */
+        double add(double latitude, double longitude);
+
+        double getTotal() const { return total; }
+
+    private:
+        static constexpr double REANCHOR_DISTANCE_M = 20000.0;
+        LocalTangentFrame frame;
+        NedPosition previous;
+        bool has_previous = false;
+        double total = 0.0;
+    };
+
+} // namespace FlightDynamics
+} // namespace VFT_SMF
+
+#endif // LOCAL_TANGENT_FRAME_HPP
@@ -0,0 +1,209 @@
+/**
+ * @file TrimSolver.cpp
+ * @brief 飞行动力学配平求解器实现
+ * @author VFT_SMF Framework
+ * @date 2024
+ */
+
+#include "TrimSolver.hpp"
+#include "../G_SimulationManager/LogAndData/Logger.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace VFT_SMF {
+namespace FlightDynamics {
+
+    namespace {
+
+        using Vector = std::array<double, TrimSolver::UNKNOWN_COUNT>;
+        using Matrix = std::array<Vector, TrimSolver::UNKNOWN_COUNT>;
+
+        // 未知量顺序：油门、升降舵、副翼、方向舵、俯仰角、滚转角
+        enum Unknown { THROTTLE = 0, ELEVATOR, AILERON, RUDDER, PITCH, ROLL };
+
+        // 未知量限幅：油门为模型输入范围，俯仰角、滚转角与代理的姿态限幅一致
+        const Vector LOWER_BOUND = {0.0, -25.0, -20.0, -25.0, -30.0, -60.0};
+        const Vector UPPER_BOUND = {1.0,  25.0,  20.0,  25.0,  30.0,  60.0};
+        const Vector INITIAL_GUESS = {0.5, 0.0, 0.0, 0.0, 2.0, 0.0};
+
+        const double RAD_TO_DEG = 180.0 / M_PI;
+        const double MAX_DAMPING = 1e12;
+
+        double squaredNorm(const std::array<double, 6>& values) {
+            double sum = 0.0;
+            for (double value : values) sum += value * value;
+            return sum;
+        }
+
+        Vector clampToBounds(Vector unknowns) {
+            for (size_t i = 0; i < unknowns.size(); ++i) {
+                unknowns[i] = std::max(LOWER_BOUND[i], std::min(UPPER_BOUND[i], unknowns[i]));
+            }
+            return unknowns;
+        }
+
+        /**
+         * @brief 部分主元高斯消元求解 A·x = b，奇异时返回false
+         */
+        bool solveLinearSystem(Matrix a, Vector b, Vector& x) {
+            const size_t n = b.size();
+            for (size_t col = 0; col < n; ++col) {
+                size_t pivot = col;
+                for (size_t row = col + 1; row < n; ++row) {
+                    if (std::abs(a[row][col]) > std::abs(a[pivot][col])) pivot = row;
+                }
+                if (std::abs(a[pivot][col]) < 1e-300) return false;
+                std::swap(a[pivot], a[col]);
+                std::swap(b[pivot], b[col]);
+                for (size_t row = col + 1; row < n; ++row) {
+                    const double factor = a[row][col] / a[col][col];
+                    for (size_t k = col; k < n; ++k) a[row][k] -= factor * a[col][k];
+                    b[row] -= factor * b[col];
+                }
+            }
+            for (size_t i = n; i-- > 0;) {
+                double sum = b[i];
+                for (size_t k = i + 1; k < n; ++k) sum -= a[i][k] * x[k];
+                x[i] = sum / a[i][i];
+            }
+            return true;
+        }
+
+    } // namespace
+
+    TrimSolver::TrimSolver(const std::string& aircraft_type) : agent(aircraft_type) {}
+
+    void TrimSolver::buildStates(const TrimTarget& target, const Vector& unknowns,
+                                 VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& flight_state,
+                                 VFT_SMF::GlobalSharedDataStruct::AircraftSystemState& system_state,
+                                 VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState& env_state) {
+        // 代理把空速视为水平速度（位置按空速与航向推进），航迹角只进入垂直速度
+        flight_state = VFT_SMF::GlobalSharedDataStruct::AircraftFlightState();
+        flight_state.altitude = target.altitude;
+        flight_state.heading = target.heading;
+        flight_state.pitch = unknowns[PITCH];
+        flight_state.roll = unknowns[ROLL];
+        flight_state.airspeed = target.airspeed;
+        flight_state.groundspeed = target.airspeed;
+        flight_state.vertical_speed = target.airspeed * std::sin(target.flight_path_angle / RAD_TO_DEG);
+        flight_state.roll_rate = 0.0;
+        flight_state.pitch_rate = 0.0;
+        flight_state.yaw_rate = target.turn_rate;
+        flight_state.landing_gear_deployed = target.landing_gear > 0.5;
+        flight_state.flaps_deployed = target.flap_position > 0.0;
+
+        system_state = VFT_SMF::GlobalSharedDataStruct::AircraftSystemState();
+        system_state.current_landing_gear_deployed = target.landing_gear;
+        system_state.current_flaps_deployed = target.flap_position;
+        system_state.current_spoilers_deployed = 0.0;
+        system_state.current_brake_pressure = 0.0;
+        system_state.current_throttle_position = unknowns[THROTTLE];
+        system_state.current_elevator_deflection = unknowns[ELEVATOR];
+        system_state.current_aileron_deflection = unknowns[AILERON];
+        system_state.current_rudder_deflection = unknowns[RUDDER];
+
+        env_state = VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState();
+        env_state.air_density = target.air_density;
+    }
+
+    std::array<double, 6> TrimSolver::residuals(const TrimTarget& target, const Vector& unknowns) {
+        VFT_SMF::GlobalSharedDataStruct::AircraftFlightState flight_state;
+        VFT_SMF::GlobalSharedDataStruct::AircraftSystemState system_state;
+        VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState env_state;
+        buildStates(target, unknowns, flight_state, system_state, env_state);
+
+        const auto accelerations = agent.evaluateAccelerations(flight_state, system_state, env_state);
+        return {
+            accelerations[0],
+            accelerations[1],
+            accelerations[2],
+            accelerations[3] * RAD_TO_DEG,
+            accelerations[4] * RAD_TO_DEG,
+            accelerations[5] * RAD_TO_DEG,
+        };
+    }
+
+    TrimResult TrimSolver::solve(const TrimTarget& target, const TrimOptions& options) {
+        TrimResult result;
+
+        Vector unknowns = INITIAL_GUESS;
+        std::array<double, 6> residual = residuals(target, unknowns);
+        double cost = squaredNorm(residual);
+        double damping = options.initial_damping;
+
+        int iteration = 0;
+        for (; iteration < options.max_iterations && std::sqrt(cost) > options.tolerance; ++iteration) {
+            // 前向差分雅可比；在上界处向内侧取差分
+            Matrix jacobian {};
+            for (size_t j = 0; j < UNKNOWN_COUNT; ++j) {
+                double step = 1e-6 * std::max(1.0, std::abs(unknowns[j]));
+                if (unknowns[j] + step > UPPER_BOUND[j]) step = -step;
+                Vector perturbed = unknowns;
+                perturbed[j] += step;
+                const auto perturbed_residual = residuals(target, perturbed);
+                for (size_t i = 0; i < residual.size(); ++i) {
+                    jacobian[i][j] = (perturbed_residual[i] - residual[i]) / step;
+                }
+            }
+
+            // 法方程 JᵀJ 与梯度 Jᵀr
+            Matrix normal {};
+            Vector gradient {};
+            for (size_t j = 0; j < UNKNOWN_COUNT; ++j) {
+                for (size_t k = 0; k < UNKNOWN_COUNT; ++k) {
+                    for (size_t i = 0; i < residual.size(); ++i) normal[j][k] += jacobian[i][j] * jacobian[i][k];
+                }
+                for (size_t i = 0; i < residual.size(); ++i) gradient[j] -= jacobian[i][j] * residual[i];
+            }
+
+            // 增大阻尼直到代价下降
+            bool improved = false;
+            while (!improved && damping < MAX_DAMPING) {
+                Matrix damped = normal;
+                for (size_t j = 0; j < UNKNOWN_COUNT; ++j) damped[j][j] += damping * std::max(normal[j][j], 1e-12);
+
+                Vector delta {};
+                if (solveLinearSystem(damped, gradient, delta)) {
+                    Vector candidate = unknowns;
+                    for (size_t j = 0; j < UNKNOWN_COUNT; ++j) candidate[j] += delta[j];
+                    candidate = clampToBounds(candidate);
+                    const auto candidate_residual = residuals(target, candidate);
+                    const double candidate_cost = squaredNorm(candidate_residual);
+                    if (candidate_cost < cost) {
+                        unknowns = candidate;
+                        residual = candidate_residual;
+                        cost = candidate_cost;
+                        damping = std::max(damping / 3.0, 1e-12);
+                        improved = true;
+                        break;
+                    }
+                }
+                damping *= 4.0;
+            }
+            if (!improved) break;   // 已到局部极小（如目标超出限幅范围）
+        }
+
+        result.iterations = iteration;
+        result.residual_norm = std::sqrt(cost);
+        result.converged = result.residual_norm <= options.tolerance;
+        result.residuals = residual;
+        result.throttle = unknowns[THROTTLE];
+        result.elevator = unknowns[ELEVATOR];
+        result.aileron = unknowns[AILERON];
+        result.rudder = unknowns[RUDDER];
+        result.pitch = unknowns[PITCH];
+        result.roll = unknowns[ROLL];
+        buildStates(target, unknowns, result.flight_state, result.system_state, result.env_state);
+
+        VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail,
+                           std::string("配平求解") + (result.converged ? "收敛" : "未收敛") +
+                           ": 迭代=" + std::to_string(result.iterations) +
+                           ", 残差=" + std::to_string(result.residual_norm) +
+                           ", 油门=" + std::to_string(result.throttle) +
+                           ", 升降舵=" + std::to_string(result.elevator) +
+                           "°, 俯仰角=" + std::to_string(result.pitch) + "°");
+        return result;
+    }
+
+} // namespace FlightDynamics
+} // namespace VFT_SMF
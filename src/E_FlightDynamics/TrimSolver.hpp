@@ -0,0 +1,116 @@
+/**
+ * @file TrimSolver.hpp
+ * @brief 飞行动力学配平求解器
+ * @details 给定目标空速、航迹角、转弯角速度与构型，求使飞行动力学代理的状态导数为零的
+ *          油门、升降舵、副翼、方向舵与姿态，用于空中场景的初始状态，避免仿真开始后
+ *          出现与场景无关的初始瞬态。
+ *
+ *          残差为 FlightDynamicsAgent 在目标状态下的6分量加速度（不加噪声）：
+ *            - 线性加速度 ax、ay、az 为零，空速与垂直速度保持不变；
+ *            - 角加速度为零，角速度保持在目标值（滚转、俯仰为零，偏航为转弯角速度）。
+ *          未知量为油门、升降舵、副翼、方向舵、俯仰角、滚转角，采用有限差分雅可比的
+ *          Levenberg-Marquardt 迭代，并把未知量投影到代理与机型模型的限幅范围内。
+ *          当前机型模型以俯仰角作为攻角，航迹角只体现在垂直速度上。
+ * @author VFT_SMF Framework
+ * @date 2024
+ */
+
+#ifndef TRIM_SOLVER_HPP
+#define TRIM_SOLVER_HPP
+
+#include "FlightDynamicsAgent.hpp"
+#include <array>
+#include <string>
+
+namespace VFT_SMF {
+namespace FlightDynamics {
+
+    /**
+     * @brief 配平目标
+     */
+    struct TrimTarget {
+        double airspeed = 120.0;            ///< 空速 (m/s)
+        double altitude = 1000.0;           ///< 高度 (m)
+        double heading = 0.0;               ///< 航向 (度)
+        double flight_path_angle = 0.0;     ///< 航迹角 (度)，爬升为正
+        double turn_rate = 0.0;             ///< 转弯角速度 (度/秒)，右转为正
+        double flap_position = 0.0;         ///< 襟翼位置 (度，与系统状态 current_flaps_deployed 一致)
+        double landing_gear = 0.0;          ///< 起落架位置 [0.0, 1.0]
+        double air_density = 1.225;         ///< 空气密度 (kg/m³)
+    };
+
+    /**
+     * @brief 配平求解选项
+     */
+    struct TrimOptions {
+        int max_iterations = 100;           ///< 最大迭代次数
+        double tolerance = 1e-6;            ///< 残差范数收敛阈值
+        double initial_damping = 1e-3;      ///< Levenberg-Marquardt 初始阻尼
+    };
+
+    /**
+     * @brief 配平结果
+     */
+    struct TrimResult {
+        bool converged = false;
+        int iterations = 0;
+        double residual_norm = 0.0;
+
+        // 操纵量
+        double throttle = 0.0;              ///< 油门位置 [0.0, 1.0]
+        double elevator = 0.0;              ///< 升降舵偏角 (度)
+        double aileron = 0.0;               ///< 副翼偏角 (度)
+        double rudder = 0.0;                ///< 方向舵偏角 (度)
+
+        // 姿态（机型模型以俯仰角作为攻角）
+        double pitch = 0.0;                 ///< 俯仰角 (度)
+        double roll = 0.0;                  ///< 滚转角 (度)
+
+        std::array<double, 6> residuals {}; ///< 配平点残差（3个线性加速度 m/s² + 3个角加速度 度/秒²）
+
+        VFT_SMF::GlobalSharedDataStruct::AircraftFlightState flight_state;   ///< 配平后的初始飞行状态
+        VFT_SMF::GlobalSharedDataStruct::AircraftSystemState system_state;   ///< 配平后的系统状态（操纵量与构型）
+        VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState env_state;   ///< 求解所用环境状态
+    };
+
+    /**
+     * @brief 配平求解器
+     */
+    class TrimSolver {
+    public:
+        static constexpr size_t UNKNOWN_COUNT = 6;
+
+        /**
+         * @brief 构造函数
+         * @param aircraft_type 飞机类型（与 FlightDynamicsAgent 一致）
+         */
+        explicit TrimSolver(const std::string& aircraft_type = "B737");
+
+        /**
+         * @brief 求解配平
+         * @param target 配平目标
+         * @param options 求解选项
+         * @return 配平结果；未收敛时 converged 为 false，其余字段为迭代得到的最优点
+         */
+        TrimResult solve(const TrimTarget& target, const TrimOptions& options = TrimOptions());
+
+        /**
+         * @brief 计算给定未知量下的配平残差
+         * @param target 配平目标
+         * @param unknowns 油门、升降舵、副翼、方向舵、俯仰角、滚转角
+         */
+        std::array<double, 6> residuals(const TrimTarget& target, const std::array<double, UNKNOWN_COUNT>& unknowns);
+
+    private:
+        FlightDynamicsAgent agent;
+
+        static void buildStates(const TrimTarget& target, const std::array<double, UNKNOWN_COUNT>& unknowns,
+                                VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& flight_state,
+                                VFT_SMF::GlobalSharedDataStruct::AircraftSystemState& system_state,
+                                VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState& env_state);
+    };
+
+} // namespace FlightDynamics
+} // namespace VFT_SMF
+
+#endif // TRIM_SOLVER_HPP
@@ -0,0 +1,85 @@
+/**
+ * @file DataSourceRegistry.hpp
+ * @brief 数据来源标识驻留表
+ * @details 每步状态结构体只保存一个整数来源ID，来源名称在全局驻留表中只存一份。
+ *          ID在进程内稳定且只增不减，0 固定为 "initialspace"。
+ *          intern() 为首次登记的慢路径，热路径调用方应缓存返回的ID。
+ *          驻留表在进程生命周期内不析构。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "../G_SimulationManager/B_SimManage/InstrumentedMutex.hpp"
+
+namespace VFT_SMF {
+    namespace GlobalSharedDataStruct {
+
+        using DataSourceId = uint32_t;
+
+        constexpr DataSourceId INITIAL_DATASOURCE = 0;   ///< "initialspace"
+
+        /**
+         * @brief 数据来源驻留表（线程安全）
+         */
+        class DataSourceRegistry {
+        private:
+            mutable VFT_SMF::SimManage::InstrumentedSharedMutex registry_mutex{"DataSourceRegistry.registry"};
+            std::deque<std::string> names;                          ///< 按ID存放，deque保证引用稳定
+            std::unordered_map<std::string, DataSourceId> ids;
+
+            DataSourceRegistry() {
+                names.emplace_back("initialspace");
+                ids.emplace(names.back(), INITIAL_DATASOURCE);
+            }
+
+            // 有意不析构：全局数据记录器在静态析构阶段刷新文件时仍需回查来源名称
+            static DataSourceRegistry& instance() {
+                static DataSourceRegistry* registry = new DataSourceRegistry();
+                return *registry;
+            }
+
+        public:
+            DataSourceRegistry(const DataSourceRegistry&) = delete;
+            DataSourceRegistry& operator=(const DataSourceRegistry&) = delete;
+
+            /**
+             * @brief 登记来源名称并返回其ID（已登记则直接返回）
+             */
+            static DataSourceId intern(const std::string& source_name) {
+                DataSourceRegistry& registry = instance();
+                {
+                    std::shared_lock<VFT_SMF::SimManage::InstrumentedSharedMutex> lock(registry.registry_mutex);
+                    auto it = registry.ids.find(source_name);
+                    if (it != registry.ids.end()) return it->second;
+                }
+                std::unique_lock<VFT_SMF::SimManage::InstrumentedSharedMutex> lock(registry.registry_mutex);
+                auto it = registry.ids.find(source_name);
+                if (it != registry.ids.end()) return it->second;
+                const DataSourceId id = static_cast<DataSourceId>(registry.names.size());
+                registry.names.push_back(source_name);
+                registry.ids.emplace(source_name, id);
+                return id;
+            }
+
+            /**
+             * @brief 查询来源名称，未知ID返回 "unknown"
+             */
+            static const std::string& name(DataSourceId id) {
+                static const std::string unknown = "unknown";
+                DataSourceRegistry& registry = instance();
+                std::shared_lock<VFT_SMF::SimManage::InstrumentedSharedMutex> lock(registry.registry_mutex);
+                return id < registry.names.size() ? registry.names[id] : unknown;
+            }
+        };
+
+    } // namespace GlobalSharedDataStruct
+} // namespace VFT_SMF
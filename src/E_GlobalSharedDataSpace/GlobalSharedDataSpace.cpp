@@ -6,6 +6,14 @@
  */
 
 #include "GlobalSharedDataSpace.hpp"
+#include "../G_SimulationManager/B_SimManage/AllocationTracker.hpp"
+#include "../G_SimulationManager/B_SimManage/ThreadPlacement.hpp"
+#include "../G_SimulationManager/B_SimManage/PerfCounterProfiler.hpp"
+#include "../G_SimulationManager/B_SimManage/InstrumentedMutex.hpp"
+#include "../G_SimulationManager/B_SimManage/SimulationMetrics.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <iterator>
 
 namespace VFT_SMF {
 namespace GlobalShared_DataSpace {
@@ -15,9 +23,7 @@ namespace GlobalShared_DataSpace {
 bool GlobalSharedDataSpace::registerThread(const std::string& thread_id, const std::string& thread_name, const std::string& thread_type) {
     // 检查线程是否已经注册
     if (thread_sync_manager.registered_threads.find(thread_id) != thread_sync_manager.registered_threads.end()) {
-        if (VFT_SMF::globalLogger) {
-            VFT_SMF::globalLogger->warning("线程 " + thread_id + " 已经注册");
-        }
+        VFT_LOG_BRIEF("线程 {} 已经注册", thread_id);
         return false;
     }
     
@@ -32,30 +38,47 @@ bool GlobalSharedDataSpace::registerThread(const std::string& thread_id, const s
     thread_info.last_completion_time = 0.0;
     thread_info.current_step_time = 0.0;
     
+    // 分配步耗时统计槽位（超出上限的线程不统计）
+    const int slot = thread_sync_manager.step_metrics_count.fetch_add(1);
+    if (slot < VFT_SMF::GlobalSharedDataStruct::ThreadSyncManager::MAX_STEP_METRICS_THREADS) {
+        auto& metrics = thread_sync_manager.step_metrics[slot];
+        std::snprintf(metrics.thread_name, sizeof(metrics.thread_name), "%s", thread_name.c_str());
+        metrics.in_use.store(true, std::memory_order_release);
+        thread_info.metrics_slot = slot;
+    }
+    
     // 注册线程
     thread_sync_manager.registered_threads[thread_id] = thread_info;
     
-    if (VFT_SMF::globalLogger) {
-        VFT_SMF::globalLogger->info("线程 " + thread_id + " (" + thread_name + ") 注册成功");
+    // 注册在线程自身中进行：此后该线程的堆分配（及开启锁统计时的加锁）以线程名计数
+    VFT_SMF::SimManage::AllocationTracker::tagCurrentThread(thread_name);
+    VFT_SMF::SimManage::PerfCounterProfiler::attachCurrentThread(thread_name);
+    if (VFT_SMF::SimManage::LockStats::compiledIn()) {
+        VFT_SMF::SimManage::LockStats::tagCurrentThread(thread_name);
+    }
+    
+    // 同理在线程自身中应用配置的 CPU 集、实时优先级与 NUMA 节点（未配置时不做任何事）
+    if (VFT_SMF::SimManage::ThreadPlacement::applyToCurrentThread(thread_name)) {
+        VFT_LOG_BRIEF("线程 {} 已应用线程放置", thread_name);
     }
     
+    VFT_LOG_BRIEF("线程 {} ({}) 注册成功", thread_id, thread_name);
+    
     return true;
 }
 
 bool GlobalSharedDataSpace::unregisterThread(const std::string& thread_id) {
     auto it = thread_sync_manager.registered_threads.find(thread_id);
     if (it == thread_sync_manager.registered_threads.end()) {
-        if (VFT_SMF::globalLogger) {
-            VFT_SMF::globalLogger->warning("线程 " + thread_id + " 未注册");
-        }
+        VFT_LOG_BRIEF("线程 {} 未注册", thread_id);
         return false;
     }
     
     thread_sync_manager.registered_threads.erase(it);
+    VFT_SMF::SimManage::AllocationTracker::untagCurrentThread();
+    VFT_SMF::SimManage::PerfCounterProfiler::detachCurrentThread();
     
-    if (VFT_SMF::globalLogger) {
-        VFT_SMF::globalLogger->info("线程 " + thread_id + " 注销成功");
-    }
+    VFT_LOG_BRIEF("线程 {} 注销成功", thread_id);
     
     return true;
 }
@@ -63,21 +86,34 @@ bool GlobalSharedDataSpace::unregisterThread(const std::string& thread_id) {
 void GlobalSharedDataSpace::updateThreadState(const std::string& thread_id, VFT_SMF::GlobalSharedDataStruct::ThreadSyncState state) {
     auto it = thread_sync_manager.registered_threads.find(thread_id);
     if (it == thread_sync_manager.registered_threads.end()) {
-        if (VFT_SMF::globalLogger) {
-            VFT_SMF::globalLogger->warning("线程 " + thread_id + " 未注册，无法更新状态");
-        }
+        VFT_LOG_BRIEF("线程 {} 未注册，无法更新状态", thread_id);
         return;
     }
     
     it->second.sync_state = state;
     
-    // 降低日志频率：改为detail，避免每步大量info
-    if (VFT_SMF::globalLogger) {
-        VFT_SMF::globalLogger->debug("线程 " + thread_id + " 状态更新为: " + std::to_string(static_cast<int>(state)));
+    // 步耗时：由线程自身在 RUNNING 与 COMPLETED 之间计时
+    if (it->second.metrics_slot >= 0) {
+        auto& metrics = thread_sync_manager.step_metrics[it->second.metrics_slot];
+        if (state == VFT_SMF::GlobalSharedDataStruct::ThreadSyncState::RUNNING) {
+            metrics.running_since_ns = VFT_SMF::SimManage::SimulationMetrics::nowNanos();
+        } else if (state == VFT_SMF::GlobalSharedDataStruct::ThreadSyncState::COMPLETED && metrics.running_since_ns != 0) {
+            metrics.step_latency.record(VFT_SMF::SimManage::SimulationMetrics::nowNanos() - metrics.running_since_ns);
+            metrics.running_since_ns = 0;
+        }
     }
+    
+    // 降低日志频率：改为detail，避免每步大量info
+    VFT_LOG_DETAIL("线程 {} 状态更新为: {}", thread_id, static_cast<int>(state));
     // 回退：不做条件变量通知
 }
 
+const VFT_SMF::GlobalSharedDataStruct::ThreadStepMetrics* GlobalSharedDataSpace::getThreadStepMetrics(int& count) const {
+    count = std::min(thread_sync_manager.step_metrics_count.load(),
+                     VFT_SMF::GlobalSharedDataStruct::ThreadSyncManager::MAX_STEP_METRICS_THREADS);
+    return thread_sync_manager.step_metrics;
+}
+
 VFT_SMF::GlobalSharedDataStruct::ThreadSyncState GlobalSharedDataSpace::getThreadState(const std::string& thread_id) {
     auto it = thread_sync_manager.registered_threads.find(thread_id);
     if (it == thread_sync_manager.registered_threads.end()) {
@@ -94,17 +130,16 @@ std::map<std::string, VFT_SMF::GlobalSharedDataStruct::ThreadRegistrationInfo> G
 void GlobalSharedDataSpace::setClockRunning(bool running) {
     thread_sync_manager.clock_running = running;
     
-    if (VFT_SMF::globalLogger) {
-        VFT_SMF::globalLogger->info("时钟运行状态设置为: " + std::string(running ? "运行" : "停止"));
-    }
+    VFT_LOG_BRIEF("时钟运行状态设置为: {}", running ? "运行" : "停止");
 }
 
 void GlobalSharedDataSpace::setSimulationOver(bool is_over) {
     thread_sync_manager.is_sim_over = is_over;
-    
-    if (VFT_SMF::globalLogger) {
-        VFT_SMF::globalLogger->info("仿真结束标志设置为: " + std::string(is_over ? "结束" : "运行中"));
+    if (is_over && state_transport && state_transport->isCoordinator()) {
+        state_transport->shutdown();
     }
+    
+    VFT_LOG_BRIEF("仿真结束标志设置为: {}", is_over ? "结束" : "运行中");
     // 回退：不做条件变量通知
 }
 
@@ -121,10 +156,13 @@ void GlobalSharedDataSpace::updateSyncSignal(double simulation_time, uint64_t st
     thread_sync_manager.current_sync_signal.completed_threads.clear();
     thread_sync_manager.current_sync_signal.waiting_threads.clear();
     
-    // 降低日志频率：改为detail
-    if (VFT_SMF::globalLogger) {
-        VFT_SMF::globalLogger->debug("同步信号已更新，仿真时间: " + std::to_string(simulation_time) + "s, 步骤: " + std::to_string(step));
+    // 远程参与端由传输层的步信号唤醒
+    if (state_transport && state_transport->isCoordinator()) {
+        state_transport->beginStep(step, simulation_time);
     }
+    
+    // 降低日志频率：改为detail
+    VFT_LOG_DETAIL("同步信号已更新，仿真时间: {}s, 步骤: {}", simulation_time, step);
     // 回退：不做条件变量通知
 }
 
@@ -134,9 +172,7 @@ void GlobalSharedDataSpace::resetSyncSignal() {
     thread_sync_manager.current_sync_signal.all_threads_completed = true;
     
     // 降低日志频率：改为detail
-    if (VFT_SMF::globalLogger) {
-        VFT_SMF::globalLogger->debug("同步信号已重置，等待下一步骤");
-    }
+    VFT_LOG_DETAIL("同步信号已重置，等待下一步骤");
 }
 
 VFT_SMF::GlobalSharedDataStruct::ClockSyncSignal GlobalSharedDataSpace::getCurrentSyncSignal() {
@@ -148,9 +184,7 @@ VFT_SMF::GlobalSharedDataStruct::ClockSyncSignal GlobalSharedDataSpace::getCurre
 void GlobalSharedDataSpace::createAgentEventQueue(const std::string& agent_id) {
     agent_event_queue_manager.createAgentQueue(agent_id);
     
-    if (VFT_SMF::globalLogger) {
-        VFT_SMF::globalLogger->info("为代理 " + agent_id + " 创建事件队列");
-    }
+    VFT_LOG_BRIEF("为代理 {} 创建事件队列", agent_id);
 }
 
 void GlobalSharedDataSpace::enqueueAgentEvent(const std::string& agent_id, 
@@ -160,18 +194,15 @@ void GlobalSharedDataSpace::enqueueAgentEvent(const std::string& agent_id,
                                              const std::map<std::string, std::string>& params) {
     agent_event_queue_manager.enqueueAgentEvent(agent_id, event, trigger_time, ctrl_type, ctrl_name, params);
     
-    if (VFT_SMF::globalLogger) {
-        VFT_SMF::globalLogger->debug("向代理 " + agent_id + " 队列添加事件: " + event.event_name + 
-                                    " (控制器: " + ctrl_type + "::" + ctrl_name + ")");
-    }
+    VFT_LOG_DETAIL("向代理 {} 队列添加事件: {} (控制器: {}::{})", agent_id, event.event_name, ctrl_type, ctrl_name);
 }
 
 bool GlobalSharedDataSpace::dequeueAgentEvent(const std::string& agent_id, 
                                              VFT_SMF::GlobalSharedDataStruct::AgentEventQueueItem& item) {
     bool success = agent_event_queue_manager.dequeueAgentEvent(agent_id, item);
     
-    if (success && VFT_SMF::globalLogger) {
-        VFT_SMF::globalLogger->debug("从代理 " + agent_id + " 队列取出事件: " + item.event.event_name);
+    if (success) {
+        VFT_LOG_DETAIL("从代理 {} 队列取出事件: {}", agent_id, item.event.event_name);
     }
     
     return success;
@@ -189,6 +220,57 @@ std::vector<std::string> GlobalSharedDataSpace::getAgentEventQueueIds() const {
     return agent_event_queue_manager.getAgentIds();
 }
 
+// ==================== 代理状态传输实现 ====================
+
+void GlobalSharedDataSpace::attachStateTransport(std::shared_ptr<StateTransport> transport, std::chrono::milliseconds step_timeout) {
+    state_transport = std::move(transport);
+    remote_step_timeout = step_timeout;
+    std::fill(std::begin(imported_state_versions), std::end(imported_state_versions), 0);
+    
+    VFT_LOG_BRIEF("已附加代理状态传输层（{}）", state_transport && state_transport->isCoordinator() ? "协调端" : "参与端");
+}
+
+template <typename T>
+bool GlobalSharedDataSpace::importTransportState(StateChannel channel, DoubleBuffer<T>& buffer) {
+    StateSlotInfo info;
+    T state;
+    if (!state_transport->read(channel, state, info)) return false;
+    
+    // 只导入其他端写入的新版本；本端写入的状态已在本地双缓冲中
+    uint64_t& imported_version = imported_state_versions[static_cast<uint32_t>(channel)];
+    if (info.version == imported_version || info.writer == state_transport->localParticipant()) return false;
+    imported_version = info.version;
+    
+    // 驻留ID只在进程内有效，按来源名称重新登记
+    state.datasource = VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::intern(info.datasource);
+    buffer.write() = state;
+    buffer.swap();
+    return true;
+}
+
+size_t GlobalSharedDataSpace::importTransportStates() {
+    if (!state_transport) return 0;
+    
+    size_t imported = 0;
+    imported += importTransportState(StateChannel::AircraftFlightState, aircraftFlightStateBuffer);
+    imported += importTransportState(StateChannel::AircraftSystemState, aircraftSystemStateBuffer);
+    imported += importTransportState(StateChannel::PilotState, pilotStateBuffer);
+    imported += importTransportState(StateChannel::EnvironmentState, environmentStateBuffer);
+    imported += importTransportState(StateChannel::ATCState, atcStateBuffer);
+    imported += importTransportState(StateChannel::AircraftNetForce, aircraftNetForceBuffer);
+    return imported;
+}
+
+void GlobalSharedDataSpace::waitForRemoteParticipants(uint64_t step) {
+    if (!state_transport || !state_transport->isCoordinator()) return;
+    
+    // 崩溃或超时的参与端被剔除，其状态保持最后一次写入的值，仿真继续
+    for (const auto& evicted : state_transport->waitForParticipants(step, remote_step_timeout)) {
+        VFT_LOG_BRIEF("远程参与端 {} 已剔除，仿真继续，步骤: {}", evicted, step);
+    }
+    importTransportStates();
+}
+
 // 回退：不提供条件变量等待接口
 
 } // namespace GlobalShared_DataSpace
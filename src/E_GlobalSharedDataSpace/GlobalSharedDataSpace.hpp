@@ -13,10 +13,14 @@
 #pragma once
 
 #include "GlobalSharedDataStruct.hpp"
+#include "StateTransport.hpp"
 #include "../F_ScenarioModelling/B_ScenarioModel/VFT_SMF_Base.hpp"
 #include "../G_SimulationManager/B_SimManage/SimulationNameSpace.hpp"
+#include "../G_SimulationManager/B_SimManage/InstrumentedMutex.hpp"
 #include "../G_SimulationManager/LogAndData/Logger.hpp"
 #include "../G_SimulationManager/LogAndData/DataRecorder.hpp"
+#include "../G_SimulationManager/LogAndData/TelemetryPublisher.hpp"
+#include "../G_SimulationManager/LogAndData/MonteCarloAggregator.hpp"
 #include <unordered_map>
 #include <vector>
 #include <queue>
@@ -41,7 +45,7 @@ namespace VFT_SMF {
      template <typename T>
      class DoubleBuffer {
      public:
-        DoubleBuffer() : frontBuffer(&bufferA), backBuffer(&bufferB) {}
+        explicit DoubleBuffer(const char* lock_name = "DoubleBuffer") : frontBuffer(&bufferA), backBuffer(&bufferB), swapMutex(lock_name) {}
         
         // 获取只读的前端缓冲区（消费者使用）
         const T& read() const {
@@ -55,7 +59,7 @@ namespace VFT_SMF {
         
         // 交换前后端缓冲区
         void swap() {
-            std::lock_guard<std::mutex> lock(swapMutex);
+            std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(swapMutex);
             std::swap(frontBuffer, backBuffer);
         }
         
@@ -64,7 +68,7 @@ namespace VFT_SMF {
         T bufferB;
         T* frontBuffer;  // 前端缓冲区（只读）
         T* backBuffer;   // 后端缓冲区（可写）
-        std::mutex swapMutex;
+        VFT_SMF::SimManage::InstrumentedMutex swapMutex;
     };
 
     // ==================== 3. 定义全局共享数据空间主类 ====================
@@ -72,37 +76,37 @@ namespace VFT_SMF {
     private:
         
         // 3.1 双缓冲数据容器实现- 状态数据模块（7个）
-        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::FlightPlanData> flightPlanBuffer;
-        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::AircraftFlightState> aircraftFlightStateBuffer;
-        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::AircraftSystemState> aircraftSystemStateBuffer;
-        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::PilotGlobalState> pilotStateBuffer;
-        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState> environmentStateBuffer;
-        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::ATCGlobalState> atcStateBuffer;
-        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::AircraftNetForce> aircraftNetForceBuffer;
+        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::FlightPlanData> flightPlanBuffer{"DoubleBuffer.flightPlanBuffer"};
+        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::AircraftFlightState> aircraftFlightStateBuffer{"DoubleBuffer.aircraftFlightStateBuffer"};
+        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::AircraftSystemState> aircraftSystemStateBuffer{"DoubleBuffer.aircraftSystemStateBuffer"};
+        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::PilotGlobalState> pilotStateBuffer{"DoubleBuffer.pilotStateBuffer"};
+        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState> environmentStateBuffer{"DoubleBuffer.environmentStateBuffer"};
+        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::ATCGlobalState> atcStateBuffer{"DoubleBuffer.atcStateBuffer"};
+        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::AircraftNetForce> aircraftNetForceBuffer{"DoubleBuffer.aircraftNetForceBuffer"};
         
         // 3.2 双缓冲数据容器实现- 逻辑数据模块（4个）
-        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::AircraftGlobalLogic> aircraftLogicBuffer;
-        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::PilotGlobalLogic> pilotLogicBuffer;
-        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalLogic> environmentLogicBuffer;
-        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::ATCGlobalLogic> atcLogicBuffer;
+        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::AircraftGlobalLogic> aircraftLogicBuffer{"DoubleBuffer.aircraftLogicBuffer"};
+        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::PilotGlobalLogic> pilotLogicBuffer{"DoubleBuffer.pilotLogicBuffer"};
+        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalLogic> environmentLogicBuffer{"DoubleBuffer.environmentLogicBuffer"};
+        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::ATCGlobalLogic> atcLogicBuffer{"DoubleBuffer.atcLogicBuffer"};
         
         // 3.3 事件系统数据容器（3个）
         VFT_SMF::GlobalSharedDataStruct::PlannedEventLibrary planned_event_library;       ///< 计划事件库 - 存储预定义事件，来自飞行计划
         VFT_SMF::GlobalSharedDataStruct::TriggeredEventLibrary triggered_event_library;   ///< 已触发事件库 - 存储已触发事件记录，来自事件系统
         VFT_SMF::GlobalSharedDataStruct::EventQueue eventQueue;       ///< 事件队列 - 存储待处理事件队列（单缓冲区实现）
-        mutable std::mutex eventQueueAccessMutex;  ///< 事件队列访问锁
+        mutable VFT_SMF::SimManage::InstrumentedMutex eventQueueAccessMutex{"GlobalSharedDataSpace.eventQueueAccess"};  ///< 事件队列访问锁
         
         // 3.4 ATC指令数据容器（1个）
-        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::ATC_Command> atcCommandBuffer;      ///< ATC指令数据 - 存储ATC发出的指令
+        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::ATC_Command> atcCommandBuffer{"DoubleBuffer.atcCommandBuffer"};      ///< ATC指令数据 - 存储ATC发出的指令
         
         // 3.5 计划控制器数据容器（1个）
-        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::PlanedControllersLibrary> planedControllersBuffer; ///< 计划控制器数据 - 存储飞行计划中定义的控制器
+        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::PlanedControllersLibrary> planedControllersBuffer{"DoubleBuffer.planedControllersBuffer"}; ///< 计划控制器数据 - 存储飞行计划中定义的控制器
         
         // 3.6 控制器执行状态数据容器（1个）
-        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::ControllerExecutionStatus> controllerExecutionStatusBuffer; ///< 控制器执行状态跟踪数据 - 存储每个控制器的运行状态
+        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::ControllerExecutionStatus> controllerExecutionStatusBuffer{"DoubleBuffer.controllerExecutionStatusBuffer"}; ///< 控制器执行状态跟踪数据 - 存储每个控制器的运行状态
         
         // 3.7 控制优先级管理器数据容器（1个）
-        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::ControlPriorityManager> controlPriorityManagerBuffer; ///< 控制优先级管理器 - 管理不同控制源的优先级
+        DoubleBuffer<VFT_SMF::GlobalSharedDataStruct::ControlPriorityManager> controlPriorityManagerBuffer{"DoubleBuffer.controlPriorityManagerBuffer"}; ///< 控制优先级管理器 - 管理不同控制源的优先级
         
         // 3.8 线程同步管理器
         VFT_SMF::GlobalSharedDataStruct::ThreadSyncManager thread_sync_manager;           ///< 线程同步管理器
@@ -110,6 +114,23 @@ namespace VFT_SMF {
         // 3.8 代理事件队列管理器
         VFT_SMF::GlobalSharedDataStruct::AgentEventQueueManager agent_event_queue_manager; ///< 代理事件队列管理器
         
+        // 3.9 代理状态传输层（未附加时为空，状态只在本进程的双缓冲中交换）
+        std::shared_ptr<StateTransport> state_transport;
+        std::chrono::milliseconds remote_step_timeout{1000};                ///< 等待远程参与端完成一步的上限
+        uint64_t imported_state_versions[STATE_CHANNEL_COUNT] = {};         ///< 各状态槽已导入的写入次数
+        
+        // 状态写入本地双缓冲后同步发布到传输层（未附加时只多一次判空）
+        template <typename T>
+        void publishStateToTransport(StateChannel channel, const T& state) {
+            if (state_transport) {
+                state_transport->publish(channel, state, VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::name(state.datasource).c_str());
+            }
+        }
+        
+        // 从传输层导入单个状态模块
+        template <typename T>
+        bool importTransportState(StateChannel channel, DoubleBuffer<T>& buffer);
+        
         // （回退）移除栅栏相关成员，恢复轮询方案
         
     public:
@@ -122,7 +143,7 @@ namespace VFT_SMF {
         void setFlightPlanData(const VFT_SMF::GlobalSharedDataStruct::FlightPlanData& data) {
             flightPlanBuffer.write() = data;
             flightPlanBuffer.swap(); // 立即交换，使读端能读到最新数据
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "飞行计划数据已存储到共享数据空间");
+            VFT_LOG_BRIEF("飞行计划数据已存储到共享数据空间");
         }
         
         // 3.3.1.1 设置飞行计划数据（带数据来源）
@@ -131,7 +152,7 @@ namespace VFT_SMF {
             data_with_source.datasource = datasource;
             flightPlanBuffer.write() = data_with_source;
             flightPlanBuffer.swap(); // 立即交换，使读端能读到最新数据
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "飞行计划数据已存储到共享数据空间，数据来源: " + datasource);
+            VFT_LOG_BRIEF("飞行计划数据已存储到共享数据空间，数据来源: {}", datasource);
         }
         
         // 3.3.2 设置飞机飞行状态数据
@@ -139,33 +160,47 @@ namespace VFT_SMF {
             aircraftFlightStateBuffer.write() = state;
             // 写入后立即交换，使读端能在本步读到最新飞行状态数据
             aircraftFlightStateBuffer.swap();
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "飞行器飞行状态已存储到共享数据空间");
+            publishStateToTransport(StateChannel::AircraftFlightState, aircraftFlightStateBuffer.read());
+            VFT_LOG_BRIEF("飞行器飞行状态已存储到共享数据空间");
         }
         
         // 3.3.2.1 设置飞机飞行状态数据（带数据来源）
         void setAircraftFlightState(const VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& state, const std::string& datasource) {
-            VFT_SMF::GlobalSharedDataStruct::AircraftFlightState state_with_source = state;
-            state_with_source.datasource = datasource;
-            aircraftFlightStateBuffer.write() = state_with_source;
+            setAircraftFlightState(state, VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::intern(datasource));
+        }
+        
+        // 3.3.2.2 设置飞机飞行状态数据（带数据来源ID，调用方缓存ID可免去每步查表）
+        void setAircraftFlightState(const VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& state, VFT_SMF::GlobalSharedDataStruct::DataSourceId datasource) {
+            auto& slot = aircraftFlightStateBuffer.write();
+            slot = state;
+            slot.datasource = datasource;
             // 写入后立即交换，使读端能在本步读到最新飞行状态数据
             aircraftFlightStateBuffer.swap();
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "飞行器飞行状态已存储到共享数据空间，数据来源: " + datasource);
+            publishStateToTransport(StateChannel::AircraftFlightState, aircraftFlightStateBuffer.read());
+            VFT_LOG_BRIEF("飞行器飞行状态已存储到共享数据空间，数据来源: {}", VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::name(datasource));
         }
         
         // 3.3.3 设置飞机系统状态数据
         void setAircraftSystemState(const VFT_SMF::GlobalSharedDataStruct::AircraftSystemState& state) {
             aircraftSystemStateBuffer.write() = state;
             aircraftSystemStateBuffer.swap(); // 立即交换，使读端能读到最新数据
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "飞行器系统状态已存储到共享数据空间");
+            publishStateToTransport(StateChannel::AircraftSystemState, aircraftSystemStateBuffer.read());
+            VFT_LOG_BRIEF("飞行器系统状态已存储到共享数据空间");
         }
         
         // 3.3.3.1 设置飞机系统状态数据（带数据来源）
         void setAircraftSystemState(const VFT_SMF::GlobalSharedDataStruct::AircraftSystemState& state, const std::string& datasource) {
-            VFT_SMF::GlobalSharedDataStruct::AircraftSystemState state_with_source = state;
-            state_with_source.datasource = datasource;
-            aircraftSystemStateBuffer.write() = state_with_source;
+            setAircraftSystemState(state, VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::intern(datasource));
+        }
+        
+        // 3.3.3.2 设置飞机系统状态数据（带数据来源ID，调用方缓存ID可免去每步查表）
+        void setAircraftSystemState(const VFT_SMF::GlobalSharedDataStruct::AircraftSystemState& state, VFT_SMF::GlobalSharedDataStruct::DataSourceId datasource) {
+            auto& slot = aircraftSystemStateBuffer.write();
+            slot = state;
+            slot.datasource = datasource;
             aircraftSystemStateBuffer.swap(); // 立即交换，使读端能读到最新数据
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "飞行器系统状态已存储到共享数据空间，数据来源: " + datasource);
+            publishStateToTransport(StateChannel::AircraftSystemState, aircraftSystemStateBuffer.read());
+            VFT_LOG_BRIEF("飞行器系统状态已存储到共享数据空间，数据来源: {}", VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::name(datasource));
         }
         
         // 3.3.4 设置飞行员状态数据
@@ -173,17 +208,24 @@ namespace VFT_SMF {
             pilotStateBuffer.write() = state;
             // 写入后立即交换，使读端能在本步读到最新飞行员数据
             pilotStateBuffer.swap(); 
-            VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "飞行员状态已存储到共享数据空间");
+            publishStateToTransport(StateChannel::PilotState, pilotStateBuffer.read());
+            VFT_LOG_DETAIL("飞行员状态已存储到共享数据空间");
         }
         
         // 3.3.4.1 设置飞行员状态数据（带数据来源）
         void setPilotState(const VFT_SMF::GlobalSharedDataStruct::PilotGlobalState& state, const std::string& datasource) {
-            VFT_SMF::GlobalSharedDataStruct::PilotGlobalState state_with_source = state;
-            state_with_source.datasource = datasource;
-            pilotStateBuffer.write() = state_with_source;
+            setPilotState(state, VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::intern(datasource));
+        }
+        
+        // 3.3.4.2 设置飞行员状态数据（带数据来源ID，调用方缓存ID可免去每步查表）
+        void setPilotState(const VFT_SMF::GlobalSharedDataStruct::PilotGlobalState& state, VFT_SMF::GlobalSharedDataStruct::DataSourceId datasource) {
+            auto& slot = pilotStateBuffer.write();
+            slot = state;
+            slot.datasource = datasource;
             // 写入后立即交换，使读端能在本步读到最新飞行员数据
             pilotStateBuffer.swap();
-            VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "飞行员状态已存储到共享数据空间，数据来源: " + datasource);
+            publishStateToTransport(StateChannel::PilotState, pilotStateBuffer.read());
+            VFT_LOG_DETAIL("飞行员状态已存储到共享数据空间，数据来源: {}", VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::name(datasource));
         }
         
         // 3.3.5 设置环境状态数据
@@ -191,40 +233,54 @@ namespace VFT_SMF {
             environmentStateBuffer.write() = state;
             // 写入后立即交换，使读端能在本步读到最新环境数据
             environmentStateBuffer.swap();
-            VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "环境状态已存储到共享数据空间");
+            publishStateToTransport(StateChannel::EnvironmentState, environmentStateBuffer.read());
+            VFT_LOG_DETAIL("环境状态已存储到共享数据空间");
         }
         
         // 3.3.5.1 设置环境状态数据（带数据来源）
         void setEnvironmentState(const VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState& state, const std::string& datasource) {
-            VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState state_with_source = state;
-            state_with_source.datasource = datasource;
-            environmentStateBuffer.write() = state_with_source;
+            setEnvironmentState(state, VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::intern(datasource));
+        }
+        
+        // 3.3.5.2 设置环境状态数据（带数据来源ID，调用方缓存ID可免去每步查表）
+        void setEnvironmentState(const VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState& state, VFT_SMF::GlobalSharedDataStruct::DataSourceId datasource) {
+            auto& slot = environmentStateBuffer.write();
+            slot = state;
+            slot.datasource = datasource;
             // 写入后立即交换，使读端能在本步读到最新环境数据
             environmentStateBuffer.swap();
-            VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "环境状态已存储到共享数据空间，数据来源: " + datasource);
+            publishStateToTransport(StateChannel::EnvironmentState, environmentStateBuffer.read());
+            VFT_LOG_DETAIL("环境状态已存储到共享数据空间，数据来源: {}", VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::name(datasource));
         }
         
         // 3.3.6 设置ATC状态数据
         void setATCState(const VFT_SMF::GlobalSharedDataStruct::ATCGlobalState& state) {
             atcStateBuffer.write() = state;
             atcStateBuffer.swap(); // 立即交换，使读端能读到最新数据
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC状态已存储到共享数据空间");
+            publishStateToTransport(StateChannel::ATCState, atcStateBuffer.read());
+            VFT_LOG_BRIEF("ATC状态已存储到共享数据空间");
         }
         
         // 3.3.6.1 设置ATC状态数据（带数据来源）
         void setATCState(const VFT_SMF::GlobalSharedDataStruct::ATCGlobalState& state, const std::string& datasource) {
-            VFT_SMF::GlobalSharedDataStruct::ATCGlobalState state_with_source = state;
-            state_with_source.datasource = datasource;
-            atcStateBuffer.write() = state_with_source;
+            setATCState(state, VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::intern(datasource));
+        }
+        
+        // 3.3.6.2 设置ATC状态数据（带数据来源ID，调用方缓存ID可免去每步查表）
+        void setATCState(const VFT_SMF::GlobalSharedDataStruct::ATCGlobalState& state, VFT_SMF::GlobalSharedDataStruct::DataSourceId datasource) {
+            auto& slot = atcStateBuffer.write();
+            slot = state;
+            slot.datasource = datasource;
             atcStateBuffer.swap(); // 立即交换，使读端能读到最新数据
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC状态已存储到共享数据空间，数据来源: " + datasource);
+            publishStateToTransport(StateChannel::ATCState, atcStateBuffer.read());
+            VFT_LOG_BRIEF("ATC状态已存储到共享数据空间，数据来源: {}", VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::name(datasource));
         }
         
         // 3.3.7 设置飞机逻辑数据
         void setAircraftLogic(const VFT_SMF::GlobalSharedDataStruct::AircraftGlobalLogic& logic) {
             aircraftLogicBuffer.write() = logic;
             aircraftLogicBuffer.swap(); // 立即交换，使读端能读到最新数据
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "飞行器逻辑数据已存储到共享数据空间");
+            VFT_LOG_BRIEF("飞行器逻辑数据已存储到共享数据空间");
         }
         
         // 3.3.7.1 设置飞机逻辑数据（带数据来源）
@@ -233,14 +289,14 @@ namespace VFT_SMF {
             logic_with_source.datasource = datasource;
             aircraftLogicBuffer.write() = logic_with_source;
             aircraftLogicBuffer.swap(); // 立即交换，使读端能读到最新数据
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "飞行器逻辑数据已存储到共享数据空间，数据来源: " + datasource);
+            VFT_LOG_BRIEF("飞行器逻辑数据已存储到共享数据空间，数据来源: {}", datasource);
         }
         
         // 3.3.8 设置飞行员逻辑数据
         void setPilotLogic(const VFT_SMF::GlobalSharedDataStruct::PilotGlobalLogic& logic) {
             pilotLogicBuffer.write() = logic;
             pilotLogicBuffer.swap(); // 立即交换，使读端能读到最新数据
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "飞行员逻辑数据已存储到共享数据空间");
+            VFT_LOG_BRIEF("飞行员逻辑数据已存储到共享数据空间");
         }
         
         // 3.3.8.1 设置飞行员逻辑数据（带数据来源）
@@ -249,14 +305,14 @@ namespace VFT_SMF {
             logic_with_source.datasource = datasource;
             pilotLogicBuffer.write() = logic_with_source;
             pilotLogicBuffer.swap(); // 立即交换，使读端能读到最新数据
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "飞行员逻辑数据已存储到共享数据空间，数据来源: " + datasource);
+            VFT_LOG_BRIEF("飞行员逻辑数据已存储到共享数据空间，数据来源: {}", datasource);
         }
         
         // 3.3.9 设置环境逻辑数据
         void setEnvironmentLogic(const VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalLogic& logic) {
             environmentLogicBuffer.write() = logic;
             environmentLogicBuffer.swap(); // 立即交换，使读端能读到最新数据
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "环境逻辑数据已存储到共享数据空间");
+            VFT_LOG_BRIEF("环境逻辑数据已存储到共享数据空间");
         }
         
         // 3.3.9.1 设置环境逻辑数据（带数据来源）
@@ -265,14 +321,14 @@ namespace VFT_SMF {
             logic_with_source.datasource = datasource;
             environmentLogicBuffer.write() = logic_with_source;
             environmentLogicBuffer.swap(); // 立即交换，使读端能读到最新数据
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "环境逻辑数据已存储到共享数据空间，数据来源: " + datasource);
+            VFT_LOG_BRIEF("环境逻辑数据已存储到共享数据空间，数据来源: {}", datasource);
         }
         
         // 3.3.10 设置ATC逻辑数据
         void setATCLogic(const VFT_SMF::GlobalSharedDataStruct::ATCGlobalLogic& logic) {
             atcLogicBuffer.write() = logic;
             atcLogicBuffer.swap(); // 立即交换，使读端能读到最新数据
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC逻辑数据已存储到共享数据空间");
+            VFT_LOG_BRIEF("ATC逻辑数据已存储到共享数据空间");
         }
         
         // 3.3.10.1 设置ATC逻辑数据（带数据来源）
@@ -281,29 +337,36 @@ namespace VFT_SMF {
             logic_with_source.datasource = datasource;
             atcLogicBuffer.write() = logic_with_source;
             atcLogicBuffer.swap(); // 立即交换，使读端能读到最新数据
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC逻辑数据已存储到共享数据空间，数据来源: " + datasource);
+            VFT_LOG_BRIEF("ATC逻辑数据已存储到共享数据空间，数据来源: {}", datasource);
         }
         
         // 3.3.11 设置六分量合外力数据
         void setAircraftNetForce(const VFT_SMF::GlobalSharedDataStruct::AircraftNetForce& net_force) {
             aircraftNetForceBuffer.write() = net_force;
             aircraftNetForceBuffer.swap(); // 立即交换，使读端能读到最新数据
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "六分量合外力数据已存储到共享数据空间");
+            publishStateToTransport(StateChannel::AircraftNetForce, aircraftNetForceBuffer.read());
+            VFT_LOG_BRIEF("六分量合外力数据已存储到共享数据空间");
         }
         
         // 3.3.11.1 设置六分量合外力数据（带数据来源）
         void setAircraftNetForce(const VFT_SMF::GlobalSharedDataStruct::AircraftNetForce& net_force, const std::string& datasource) {
-            VFT_SMF::GlobalSharedDataStruct::AircraftNetForce net_force_with_source = net_force;
-            net_force_with_source.datasource = datasource;
-            aircraftNetForceBuffer.write() = net_force_with_source;
+            setAircraftNetForce(net_force, VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::intern(datasource));
+        }
+        
+        // 3.3.11.2 设置六分量合外力数据（带数据来源ID，调用方缓存ID可免去每步查表）
+        void setAircraftNetForce(const VFT_SMF::GlobalSharedDataStruct::AircraftNetForce& net_force, VFT_SMF::GlobalSharedDataStruct::DataSourceId datasource) {
+            auto& slot = aircraftNetForceBuffer.write();
+            slot = net_force;
+            slot.datasource = datasource;
             aircraftNetForceBuffer.swap(); // 立即交换，使读端能读到最新数据
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "六分量合外力数据已存储到共享数据空间，数据来源: " + datasource);
+            publishStateToTransport(StateChannel::AircraftNetForce, aircraftNetForceBuffer.read());
+            VFT_LOG_BRIEF("六分量合外力数据已存储到共享数据空间，数据来源: {}", VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::name(datasource));
         }
 
         // 3.3.11 设置计划事件库数据
         void setPlannedEventLibrary(const VFT_SMF::GlobalSharedDataStruct::PlannedEventLibrary& library) {
             planned_event_library = library;
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "计划事件库数据已存储到共享数据空间");
+            VFT_LOG_BRIEF("计划事件库数据已存储到共享数据空间");
         }
         
         // 3.3.11.1 设置计划事件库数据（带数据来源）
@@ -311,13 +374,13 @@ namespace VFT_SMF {
             VFT_SMF::GlobalSharedDataStruct::PlannedEventLibrary library_with_source = library;
             library_with_source.datasource = datasource;
             planned_event_library = library_with_source;
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "计划事件库数据已存储到共享数据空间，数据来源: " + datasource);
+            VFT_LOG_BRIEF("计划事件库数据已存储到共享数据空间，数据来源: {}", datasource);
         }
         
         // 3.3.12 设置已触发事件库数据
         void setTriggeredEventLibrary(const VFT_SMF::GlobalSharedDataStruct::TriggeredEventLibrary& library) {
             triggered_event_library = library;
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "已触发事件库数据已存储到共享数据空间");
+            VFT_LOG_BRIEF("已触发事件库数据已存储到共享数据空间");
         }
         
         // 3.3.12.1 设置已触发事件库数据（带数据来源）
@@ -325,14 +388,14 @@ namespace VFT_SMF {
             VFT_SMF::GlobalSharedDataStruct::TriggeredEventLibrary library_with_source = library;
             library_with_source.datasource = datasource;
             triggered_event_library = library_with_source;
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "已触发事件库数据已存储到共享数据空间，数据来�? " + datasource);
+            VFT_LOG_BRIEF("已触发事件库数据已存储到共享数据空间，数据来�? {}", datasource);
         }
         
         // 3.3.13 清除事件库中的所有事件（仿真开始时调用）
         void clearEventLibrary() {
             planned_event_library.clearPlannedEvents();
             triggered_event_library.clearTriggeredEvents();
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "事件库已清除");
+            VFT_LOG_BRIEF("事件库已清除");
         }
         
         // 3.3.14 标记事件为已触发
@@ -345,7 +408,7 @@ namespace VFT_SMF {
                 // 添加到已触发事件库
                 triggered_event_library.addTriggeredEvent(*event);
                 
-                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "事件已触发: " + event_id + " at " + std::to_string(trigger_time) + "s");
+                VFT_LOG_BRIEF("事件已触发: {} at {}s", event_id, trigger_time);
                 return true;
             }
             return false;
@@ -355,7 +418,7 @@ namespace VFT_SMF {
         void setATCCommand(const VFT_SMF::GlobalSharedDataStruct::ATC_Command& command) {
             atcCommandBuffer.write() = command;
             atcCommandBuffer.swap(); // 立即交换，使读端能读到最新指令
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC指令已存储到共享数据空间: clearance=" + std::to_string(command.clearance_granted) + ", emergency_brake=" + std::to_string(command.emergency_brake));
+            VFT_LOG_BRIEF("ATC指令已存储到共享数据空间: clearance={}, emergency_brake={}", command.clearance_granted, command.emergency_brake);
         }
         
         // 3.3.15.1 设置ATC指令数据（带数据来源）
@@ -364,7 +427,7 @@ namespace VFT_SMF {
             command_with_source.datasource = datasource;
             atcCommandBuffer.write() = command_with_source;
             atcCommandBuffer.swap(); // 立即交换，使读端能读到最新指令
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "ATC指令已存储到共享数据空间，数据来源: " + datasource + ", clearance=" + std::to_string(command.clearance_granted) + ", emergency_brake=" + std::to_string(command.emergency_brake));
+            VFT_LOG_BRIEF("ATC指令已存储到共享数据空间，数据来源: {}, clearance={}, emergency_brake={}", datasource, command.clearance_granted, command.emergency_brake);
         }
 
         // ==================== 5. 定义数据读取接口 ====================
@@ -497,57 +560,51 @@ namespace VFT_SMF {
         void addEventToStep(double step_time, const VFT_SMF::GlobalSharedDataStruct::StandardEvent& event) {
             triggered_event_library.addEventToStep(step_time, event);
             // 添加调试日志
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                "事件已添加到时间�? " + std::to_string(step_time) + 
-                "s, 事件名称: " + event.event_name + 
-                ", 事件ID: " + event.getEventIdString() + 
-                ", 当前step_events_map大小: " + std::to_string(triggered_event_library.getStepEventsMap().size()));
+            VFT_LOG_BRIEF("事件已添加到时间�? {}s, 事件名称: {}, 事件ID: {}, 当前step_events_map大小: {}",
+                          step_time, event.event_name, event.getEventIdString(), triggered_event_library.getStepEventsMap().size());
         }
 
                 // 5.15 获取事件队列数据
         VFT_SMF::GlobalSharedDataStruct::EventQueue getEventQueue() const {
-            std::lock_guard<std::mutex> lock(eventQueueAccessMutex);
+            std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(eventQueueAccessMutex);
             return eventQueue;  // 返回副本而不是引用，避免锁释放后的数据竞争
         }
 
         // 5.16 设置事件队列数据
         void setEventQueue(const VFT_SMF::GlobalSharedDataStruct::EventQueue& event_queue,
                           const std::string& datasource = "unknown") {
-            std::lock_guard<std::mutex> lock(eventQueueAccessMutex);
+            std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(eventQueueAccessMutex);
             eventQueue = event_queue;
             eventQueue.datasource = datasource;
             eventQueue.timestamp = VFT_SMF::SimulationTimePoint{};
 
-            if (VFT_SMF::globalLogger) {
-                VFT_SMF::globalLogger->info("事件队列数据已存储到共享数据空间，数据来�? " + datasource);
-            }
+            VFT_LOG_BRIEF("事件队列数据已存储到共享数据空间，数据来�? {}", datasource);
         }
 
         // 5.17 添加事件到队列
         void enqueueEvent(const VFT_SMF::GlobalSharedDataStruct::StandardEvent& event,
                          double trigger_time,
                          const std::string& source = "event_monitor") {
-            std::lock_guard<std::mutex> lock(eventQueueAccessMutex);
+            std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(eventQueueAccessMutex);
             eventQueue.enqueueEvent(event, trigger_time, source);
 
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief,
-                "事件已添加到队列: " + event.event_name +
-                ", 触发时间: " + std::to_string(trigger_time) +
-                "s, 来源: " + source +
-                ", 队列大小: " + std::to_string(eventQueue.getQueueSize()));
+            VFT_LOG_BRIEF("事件已添加到队列: {}, 触发时间: {}s, 来源: {}, 队列大小: {}", event.event_name, trigger_time, source, eventQueue.getQueueSize());
         }
 
         // 5.18 从队列中取出事件
         bool dequeueEvent(VFT_SMF::GlobalSharedDataStruct::EventQueueItem& item) {
-            std::lock_guard<std::mutex> lock(eventQueueAccessMutex);
+            std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(eventQueueAccessMutex);
             bool success = eventQueue.dequeueEvent(item);
             if (success) {
-                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                    "事件已从队列取出: " + item.event.event_name + 
-                    ", 触发时间: " + std::to_string(item.trigger_time) + "s");
+                VFT_LOG_BRIEF("事件已从队列取出: {}, 触发时间: {}s", item.event.event_name, item.trigger_time);
             }
             return success;
         }
+
+        // 5.19 获取事件队列运行计数（不加锁，供指标端点采集）
+        VFT_SMF::GlobalSharedDataStruct::EventQueueCounters getEventQueueCounters() const {
+            return eventQueue.getCounters();
+        }
         
         // 5.14 获取ATC指令数据
         const VFT_SMF::GlobalSharedDataStruct::ATC_Command& getATCCommand() const {
@@ -568,9 +625,7 @@ namespace VFT_SMF {
             write_buffer.timestamp = VFT_SMF::SimulationTimePoint{};
             planedControllersBuffer.swap();
             
-            if (VFT_SMF::globalLogger) {
-                VFT_SMF::globalLogger->info("计划控制器库数据已存储到共享数据空间，数据来�? " + datasource);
-            }
+            VFT_LOG_BRIEF("计划控制器库数据已存储到共享数据空间，数据来�? {}", datasource);
         }
 
         // 5.17 获取控制器执行状态数据
@@ -587,9 +642,7 @@ namespace VFT_SMF {
             write_buffer.timestamp = VFT_SMF::SimulationTimePoint{};
             controllerExecutionStatusBuffer.swap();
             
-            if (VFT_SMF::globalLogger) {
-                VFT_SMF::globalLogger->info("控制器执行状态数据已存储到共享数据空间，数据来源: " + datasource);
-            }
+            VFT_LOG_BRIEF("控制器执行状态数据已存储到共享数据空间，数据来源: {}", datasource);
         }
 
         // 5.19 更新单个控制器状态
@@ -606,9 +659,7 @@ namespace VFT_SMF {
         void setControlPriorityManager(const VFT_SMF::GlobalSharedDataStruct::ControlPriorityManager& manager) {
             controlPriorityManagerBuffer.write() = manager;
             controlPriorityManagerBuffer.swap(); // 立即交换，使读端能读到最新数据
-            if (VFT_SMF::globalLogger) {
-                VFT_SMF::globalLogger->info("控制优先级管理器已存储到共享数据空间");
-            }
+            VFT_LOG_BRIEF("控制优先级管理器已存储到共享数据空间");
         }
 
         // 5.21 设置控制指令（便捷方法）
@@ -617,9 +668,7 @@ namespace VFT_SMF {
             manager.setControlCommand(command);
             controlPriorityManagerBuffer.write() = manager;
             controlPriorityManagerBuffer.swap();
-            if (VFT_SMF::globalLogger) {
-                VFT_SMF::globalLogger->info("控制指令已设置，优先级: " + std::to_string(static_cast<int>(command.priority)) + ", 源: " + command.source);
-            }
+            VFT_LOG_BRIEF("控制指令已设置，优先级: {}, 源: {}", static_cast<int>(command.priority), command.source);
         }
 
         // 5.22 清除控制指令（便捷方法）
@@ -628,9 +677,7 @@ namespace VFT_SMF {
             manager.clearControlCommand(priority);
             controlPriorityManagerBuffer.write() = manager;
             controlPriorityManagerBuffer.swap();
-            if (VFT_SMF::globalLogger) {
-                VFT_SMF::globalLogger->info("控制指令已清除，优先级: " + std::to_string(static_cast<int>(priority)));
-            }
+            VFT_LOG_BRIEF("控制指令已清除，优先级: {}", static_cast<int>(priority));
         }
 
         // 5.23 获取控制优先级管理器
@@ -657,13 +704,19 @@ namespace VFT_SMF {
                 // 发布所有核心数据模块到数据记录器
                 VFT_SMF::globalDataRecorder->recordAllData(simulation_time, this);
                 
-                if (VFT_SMF::globalLogger) {
-                    VFT_SMF::globalLogger->info("数据已发布到数据记录器，仿真时间: " + std::to_string(simulation_time));
-                }
+                VFT_LOG_BRIEF("数据已发布到数据记录器，仿真时间: {}", simulation_time);
             } else {
-                if (VFT_SMF::globalLogger) {
-                    VFT_SMF::globalLogger->info("数据记录器不可用，跳过数据发布，仿真时间: " + std::to_string(simulation_time));
-                }
+                VFT_LOG_BRIEF("数据记录器不可用，跳过数据发布，仿真时间: {}", simulation_time);
+            }
+
+            // 镜像选定通道到共享内存遥测环（未启用时为空指针）
+            if (VFT_SMF::Telemetry::globalTelemetryPublisher) {
+                VFT_SMF::Telemetry::globalTelemetryPublisher->publish(simulation_time, *this);
+            }
+
+            // 蒙特卡洛逐时间点汇总（未启用时为空指针）
+            if (VFT_SMF::MonteCarlo::globalMonteCarloAggregator) {
+                VFT_SMF::MonteCarlo::globalMonteCarloAggregator->observe(simulation_time, *this);
             }
         }
         
@@ -695,9 +748,7 @@ namespace VFT_SMF {
         void publishEventDataToRecorder(double simulation_time = 0.0) {
             // 数据记录器只被动接收数据，不主动获取
             // 事件数据发布由外部调用者负责
-            if (VFT_SMF::globalLogger) {
-                VFT_SMF::globalLogger->info("Event data publishing ready at time: " + std::to_string(simulation_time));
-            }
+            VFT_LOG_BRIEF("Event data publishing ready at time: {}", simulation_time);
         }
 
         // ==================== 7. 数据清理 ====================
@@ -757,6 +808,13 @@ namespace VFT_SMF {
          */
         std::map<std::string, VFT_SMF::GlobalSharedDataStruct::ThreadRegistrationInfo> getRegisteredThreads();
         
+        /**
+         * @brief 获取各线程步耗时统计（不加锁，供指标端点采集）
+         * @param count 输出已分配的槽位数
+         * @return 槽位数组，只读取 in_use 已置位的槽位
+         */
+        const VFT_SMF::GlobalSharedDataStruct::ThreadStepMetrics* getThreadStepMetrics(int& count) const;
+        
         /**
          * @brief 设置时钟运行状态
          * @param running 是否运行
@@ -842,6 +900,33 @@ namespace VFT_SMF {
          */
         std::vector<std::string> getAgentEventQueueIds() const;
 
+        // ==================== 10. 代理状态传输 ====================
+        
+        /**
+         * @brief 附加传输层（须在代理线程启动前调用）
+         * @param transport 协调端（仿真主进程）或参与端（独立代理进程）
+         * @param step_timeout 协调端等待远程参与端完成一步的上限，超时的参与端被剔除
+         */
+        void attachStateTransport(std::shared_ptr<StateTransport> transport,
+                                  std::chrono::milliseconds step_timeout = std::chrono::milliseconds(1000));
+        
+        /**
+         * @brief 获取已附加的传输层（未附加时为空指针）
+         */
+        StateTransport* getStateTransport() const { return state_transport.get(); }
+        
+        /**
+         * @brief 把其他端写入的新状态导入本地双缓冲（不回写传输层）
+         * @return 导入的状态模块数
+         */
+        size_t importTransportStates();
+        
+        /**
+         * @brief 协调端：等待远程参与端完成指定步并导入其状态；未附加传输层时立即返回
+         * @param step 仿真步数
+         */
+        void waitForRemoteParticipants(uint64_t step);
+
         // 回退：不提供栅栏等待接口
     };
 
@@ -26,14 +26,19 @@
 #include <string>
 #include <map>
 #include <vector>
+#include <memory_resource>
 #include <queue>
 #include <mutex>
 #include <tuple>
 #include <chrono>
 #include <algorithm>
+#include <type_traits>
 #include "../F_ScenarioModelling/B_ScenarioModel/VFT_SMF_Base.hpp"
 #include "../G_SimulationManager/B_SimManage/SimulationNameSpace.hpp"
 #include "../G_SimulationManager/LogAndData/Logger.hpp"
+#include "../G_SimulationManager/B_SimManage/InstrumentedMutex.hpp"
+#include "../G_SimulationManager/B_SimManage/SimulationMetrics.hpp"
+#include "DataSourceRegistry.hpp"
 #include "../G_SimulationManager/B_SimManage/SimulationNameSpace.hpp"
 #include <atomic>
 #include <condition_variable>
@@ -66,10 +71,21 @@ namespace VFT_SMF {
             ThreadSyncState sync_state;      ///< 同步状态
             double last_completion_time;     ///< 上次完成时间
             double current_step_time;        ///< 当前步骤时间
+            int metrics_slot;                ///< ThreadSyncManager::step_metrics 下标（-1 表示未分配）
             
             ThreadRegistrationInfo() : is_registered(false), is_ready(false),
                                      sync_state(ThreadSyncState::WAITING_FOR_CLOCK),
-                                     last_completion_time(0.0), current_step_time(0.0) {}
+                                     last_completion_time(0.0), current_step_time(0.0), metrics_slot(-1) {}
+        };
+        
+        /**
+         * @brief 单个线程的步耗时统计（RUNNING 到 COMPLETED），只由该线程写入，指标端点无锁读取
+         */
+        struct ThreadStepMetrics {
+            std::atomic<bool> in_use{false};                     ///< 线程名写好后置位
+            char thread_name[64] = {};
+            uint64_t running_since_ns = 0;                       ///< 本步进入 RUNNING 的时刻，仅该线程读写
+            VFT_SMF::SimManage::LatencyHistogram step_latency;
         };
         
         /**
@@ -97,7 +113,11 @@ namespace VFT_SMF {
             std::atomic<bool> step_in_progress;                               ///< 步骤是否进行中
             std::atomic<bool> is_sim_over;                                    ///< 仿真是否结束标志
             
-            ThreadSyncManager() : clock_running(false), step_in_progress(false), is_sim_over(false) {}
+            static constexpr int MAX_STEP_METRICS_THREADS = 16;
+            ThreadStepMetrics step_metrics[MAX_STEP_METRICS_THREADS];         ///< 各线程步耗时统计（注册时分配，不回收）
+            std::atomic<int> step_metrics_count;                              ///< 已分配的槽位数
+            
+            ThreadSyncManager() : clock_running(false), step_in_progress(false), is_sim_over(false), step_metrics_count(0) {}
         };
          
         // 1）飞行计划数据结构体
@@ -235,14 +255,14 @@ namespace VFT_SMF {
         struct PlannedEventLibrary {
             std::string datasource;    ///< 数据来源标识
             std::vector<StandardEvent> planned_events_list;  ///< 预定义事件列表
-            mutable std::mutex events_mutex;           ///< 事件库互斥锁
+            mutable VFT_SMF::SimManage::InstrumentedMutex events_mutex{"PlannedEventLibrary.events"};  ///< 事件库互斥锁
             
             // 默认构造函数
             PlannedEventLibrary() : datasource("initialspace") {}
             
             // 复制构造函数
             PlannedEventLibrary(const PlannedEventLibrary& other) {
-                std::lock_guard<std::mutex> lock(other.events_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(other.events_mutex);
                 datasource = other.datasource;
                 planned_events_list = other.planned_events_list;
             }
@@ -250,8 +270,8 @@ namespace VFT_SMF {
             // 赋值操作符
             PlannedEventLibrary& operator=(const PlannedEventLibrary& other) {
                 if (this != &other) {
-                    std::lock_guard<std::mutex> lock1(events_mutex);
-                    std::lock_guard<std::mutex> lock2(other.events_mutex);
+                    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock1(events_mutex);
+                    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock2(other.events_mutex);
                     datasource = other.datasource;
                     planned_events_list = other.planned_events_list;
                 }
@@ -260,19 +280,19 @@ namespace VFT_SMF {
             
             // 添加预定义事件
             void addPlannedEvent(const StandardEvent& event) {
-                std::lock_guard<std::mutex> lock(events_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(events_mutex);
                 planned_events_list.push_back(event);
             }
             
             // 获取预定义事件列表
             std::vector<StandardEvent> getPlannedEvents() const {
-                std::lock_guard<std::mutex> lock(events_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(events_mutex);
                 return planned_events_list;
             }
             
             // 根据ID查找预定义事件
             StandardEvent* findPlannedEvent(const std::string& event_id) {
-                std::lock_guard<std::mutex> lock(events_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(events_mutex);
                 for (auto& event : planned_events_list) {
                     if (event.getEventIdString() == event_id) { // 使用 getEventIdString 进行比较
                         return &event;
@@ -283,13 +303,13 @@ namespace VFT_SMF {
             
             // 清空预定义事件列表
             void clearPlannedEvents() {
-                std::lock_guard<std::mutex> lock(events_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(events_mutex);
                 planned_events_list.clear();
             }
             
             // 标记事件为已触发
             bool markEventAsTriggered(const std::string& event_id, double trigger_time) {
-                std::lock_guard<std::mutex> lock(events_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(events_mutex);
                 for (auto& event : planned_events_list  ) {
                     if (event.getEventIdString() == event_id && !event.is_triggered) { // 使用 getEventIdString 进行比较
                         event.is_triggered = true;
@@ -389,14 +409,14 @@ namespace VFT_SMF {
             std::string datasource;    ///< 数据来源标识
             std::vector<StandardEvent> triggered_events_list;  ///< 已触发事件列表
             std::map<double, std::vector<StandardEvent>> step_events_map;  ///< 按时间步记录的事件映射
-            mutable std::mutex events_mutex;           ///< 事件库互斥锁
+            mutable VFT_SMF::SimManage::InstrumentedMutex events_mutex{"TriggeredEventLibrary.events"};  ///< 事件库互斥锁
             
             // 默认构造函数
             TriggeredEventLibrary() : datasource("initialspace") {}
             
             // 复制构造函数
             TriggeredEventLibrary(const TriggeredEventLibrary& other) {
-                std::lock_guard<std::mutex> lock(other.events_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(other.events_mutex);
                 datasource = other.datasource;
                 triggered_events_list = other.triggered_events_list;
                 step_events_map = other.step_events_map;  // 拷贝step_events_map
@@ -405,8 +425,8 @@ namespace VFT_SMF {
             // 赋值操作符
             TriggeredEventLibrary& operator=(const TriggeredEventLibrary& other) {
                 if (this != &other) {
-                    std::lock_guard<std::mutex> lock1(events_mutex);
-                    std::lock_guard<std::mutex> lock2(other.events_mutex);
+                    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock1(events_mutex);
+                    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock2(other.events_mutex);
                     datasource = other.datasource;
                     triggered_events_list = other.triggered_events_list;
                     step_events_map = other.step_events_map;  // 拷贝step_events_map
@@ -416,19 +436,19 @@ namespace VFT_SMF {
             
             // 添加已触发事件
             void addTriggeredEvent(const StandardEvent& event) {
-                std::lock_guard<std::mutex> lock(events_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(events_mutex);
                 triggered_events_list.push_back(event);
             }
             
             // 获取已触发事件列表
             std::vector<StandardEvent> getTriggeredEvents() const {
-                std::lock_guard<std::mutex> lock(events_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(events_mutex);
                 return triggered_events_list;
             }
             
             // 根据ID查找已触发事件
             StandardEvent* findTriggeredEvent(const std::string& event_id) {
-                std::lock_guard<std::mutex> lock(events_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(events_mutex);
                 for (auto& event : triggered_events_list) {
                     if (event.getEventIdString() == event_id) {
                         return &event;
@@ -439,19 +459,19 @@ namespace VFT_SMF {
             
             // 清空已触发事件列表
             void clearTriggeredEvents() {
-                std::lock_guard<std::mutex> lock(events_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(events_mutex);
                 triggered_events_list.clear();
             }
             
             // 获取已触发事件数量
             size_t getTriggeredEventCount() const {
-                std::lock_guard<std::mutex> lock(events_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(events_mutex);
                 return triggered_events_list.size();
             }
             
             // 按时间步添加事件
             void addEventToStep(double step_time, const StandardEvent& event) {
-                std::lock_guard<std::mutex> lock(events_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(events_mutex);
                 auto& vec = step_events_map[step_time];
                 // 去重：同一时间步内按 event_id 去重
                 auto same_id = std::find_if(vec.begin(), vec.end(), [&](const StandardEvent& e){
@@ -471,7 +491,7 @@ namespace VFT_SMF {
             
             // 获取指定时间步的事件列表
             std::vector<StandardEvent> getEventsAtStep(double step_time) const {
-                std::lock_guard<std::mutex> lock(events_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(events_mutex);
                 auto it = step_events_map.find(step_time);
                 if (it != step_events_map.end()) {
                     return it->second;
@@ -479,15 +499,33 @@ namespace VFT_SMF {
                 return std::vector<StandardEvent>();
             }
             
+            // 获取指定时间步的事件列表，结果分配在调用方给出的内存资源上（代理线程传入步内存区）
+            std::pmr::vector<StandardEvent> getEventsAtStep(double step_time, std::pmr::memory_resource* resource) const {
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(events_mutex);
+                std::pmr::vector<StandardEvent> events(resource);
+                auto it = step_events_map.find(step_time);
+                if (it != step_events_map.end()) {
+                    events.assign(it->second.begin(), it->second.end());
+                }
+                return events;
+            }
+            
+            // 是否已有指定名称的事件被触发（不复制事件列表）
+            bool isEventTriggered(const std::string& event_name) const {
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(events_mutex);
+                return std::any_of(triggered_events_list.begin(), triggered_events_list.end(),
+                                   [&](const StandardEvent& e){ return e.event_name == event_name; });
+            }
+            
             // 获取所有时间步的事件映射
             const std::map<double, std::vector<StandardEvent>>& getStepEventsMap() const {
-                std::lock_guard<std::mutex> lock(events_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(events_mutex);
                 return step_events_map;
             }
             
             // 生成事件列表的JSON字符串（用于CSV记录）
             std::string generateEventListString(double step_time) const {
-                std::lock_guard<std::mutex> lock(events_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(events_mutex);
                 auto it = step_events_map.find(step_time);
                 if (it == step_events_map.end() || it->second.empty()) {
                     return "[]";
@@ -509,8 +547,8 @@ namespace VFT_SMF {
 
     
         // 5 ）飞行动力学状态数据结构体
-        struct AircraftFlightState {
-            std::string datasource;    ///< 数据来源标识
+        struct alignas(64) AircraftFlightState {
+            DataSourceId datasource;   ///< 数据来源标识（DataSourceRegistry中的ID）
             
             // 位置和姿态
             double latitude;           ///< 纬度 (度)
@@ -545,22 +583,32 @@ namespace VFT_SMF {
             double center_of_gravity;   ///< 重心位置 (m)
             double wing_loading;        ///< 翼载 (N/m²)
             
+            // 切平面位置：飞行动力学按切平面积分时只发布此项，经纬度由读端按需换算（见 GeodeticResolver）
+            double local_north;         ///< 相对锚点北向位置 (m)
+            double local_east;          ///< 相对锚点东向位置 (m)
+            double anchor_latitude;     ///< 切平面锚点纬度 (度)
+            double anchor_longitude;    ///< 切平面锚点经度 (度)
+            double anchor_altitude;     ///< 切平面锚点高度 (米)
+            bool geodetic_stale;        ///< latitude/longitude 落后于切平面位置
+            
             // 时间戳
             SimulationTimePoint timestamp;
             
-            AircraftFlightState() : datasource("initialspace"), latitude(0.0), longitude(0.0), altitude(0.0), heading(0.0),
+            AircraftFlightState() : datasource(INITIAL_DATASOURCE), latitude(0.0), longitude(0.0), altitude(0.0), heading(0.0),
                                    pitch(0.0), roll(0.0), airspeed(0.0), groundspeed(0.0),
                                    vertical_speed(0.0), pitch_rate(0.0), roll_rate(0.0), yaw_rate(0.0),
                                    longitudinal_accel(0.0), lateral_accel(0.0), vertical_accel(0.0),
                                    landing_gear_deployed(false),
                                    flaps_deployed(false), spoilers_deployed(false), brake_pressure(0.0),
                                    center_of_gravity(0.0), wing_loading(0.0),
+                                   local_north(0.0), local_east(0.0), anchor_latitude(0.0),
+                                   anchor_longitude(0.0), anchor_altitude(0.0), geodetic_stale(false),
                                    timestamp(SimulationTimePoint{}) {}
         };
              
         // 6）飞机系统状态数据结构体
-        struct AircraftSystemState {
-            std::string datasource;    ///< 数据来源标识
+        struct alignas(64) AircraftSystemState {
+            DataSourceId datasource;   ///< 数据来源标识（DataSourceRegistry中的ID）
             
             // 系统状态
             double current_mass;        ///< 当前飞机总质量(kg)
@@ -589,30 +637,32 @@ namespace VFT_SMF {
             // 时间戳
             SimulationTimePoint timestamp;
             
-            AircraftSystemState() : datasource("initialspace"), current_mass(0.0), current_fuel(0.0),
+            AircraftSystemState() : datasource(INITIAL_DATASOURCE), current_mass(0.0), current_fuel(0.0),
                                    current_center_of_gravity(0.0), current_brake_pressure(0.0),
                                    current_landing_gear_deployed(0.0), current_flaps_deployed(0.0),
-                                   current_spoilers_deployed(0.0), current_engine_rpm(0.0),
+                                   current_spoilers_deployed(0.0), current_aileron_deflection(0.0),
+                                   current_elevator_deflection(0.0), current_rudder_deflection(0.0),
+                                   current_throttle_position(0.0), current_engine_rpm(0.0),
                                    left_engine_failed(false), left_engine_rpm(0.0),
                                    right_engine_failed(false), right_engine_rpm(0.0),
                                    brake_efficiency(1.0), timestamp(SimulationTimePoint{}) {}
         };
         
         // 7）飞行员全局状态数据
-       struct PilotGlobalState {
-        std::string datasource;    ///< 数据来源标识
+       struct alignas(64) PilotGlobalState {
+        DataSourceId datasource;   ///< 数据来源标识（DataSourceRegistry中的ID）
         double attention_level;     ///< 注意力水平 [0.0, 1.0]     
         // 技能状态
         double skill_level;         ///< 技能水平 [0.0, 1.0]                
         // 时间戳
         SimulationTimePoint timestamp;        
-        PilotGlobalState() : datasource("initialspace"), attention_level(1.0), skill_level(0.88),
+        PilotGlobalState() : datasource(INITIAL_DATASOURCE), attention_level(1.0), skill_level(0.88),
                             timestamp(SimulationTimePoint{}) {}
     };
 
         // 8）六分量合外力数据结构体
-        struct AircraftNetForce {
-            std::string datasource;    ///< 数据来源标识
+        struct alignas(64) AircraftNetForce {
+            DataSourceId datasource;   ///< 数据来源标识（DataSourceRegistry中的ID）
             
             // 线性力分量 (N)
             double longitudinal_force;    ///< 纵向力 (推力-阻力)
@@ -634,7 +684,7 @@ namespace VFT_SMF {
             // 时间戳
             SimulationTimePoint timestamp;
             
-            AircraftNetForce() : datasource("initialspace"), longitudinal_force(0.0), lateral_force(0.0), vertical_force(0.0),
+            AircraftNetForce() : datasource(INITIAL_DATASOURCE), longitudinal_force(0.0), lateral_force(0.0), vertical_force(0.0),
                                 roll_moment(0.0), pitch_moment(0.0), yaw_moment(0.0),
                                 thrust_force(0.0), drag_force(0.0), lift_force(0.0),
                                 weight_force(0.0), side_force(0.0),
@@ -642,11 +692,12 @@ namespace VFT_SMF {
         };
 
         // 9）环境状态数据结构体
-        struct EnvironmentGlobalState {
-            std::string datasource;    ///< 数据来源标识
+        struct alignas(64) EnvironmentGlobalState {
+            DataSourceId datasource;   ///< 数据来源标识（DataSourceRegistry中的ID）
             
             double runway_length;                ///< 跑道长度 (米)
             double runway_width;                 ///< 跑道宽度 (米)
+            double runway_elevation;             ///< 跑道标高 (米，与飞行状态高度同一基准)
             double friction_coefficient;         ///< 摩擦系数 [0.0, 1.0]
             double air_density;                  ///< 空气密度 (kg/m³)
         
@@ -655,15 +706,15 @@ namespace VFT_SMF {
         
             SimulationTimePoint timestamp;       ///< 数据时间戳
         
-        EnvironmentGlobalState() : datasource("initialspace"), runway_length(0.0), runway_width(0.0), 
-                                  friction_coefficient(0.0), air_density(1.225),
+        EnvironmentGlobalState() : datasource(INITIAL_DATASOURCE), runway_length(0.0), runway_width(0.0), 
+                                  runway_elevation(0.0), friction_coefficient(0.0), air_density(1.225),
                                   wind_speed(0.0), wind_direction(0.0), 
                                   timestamp(SimulationTimePoint{}) {}
     };
 
         // 9）ATC全局状态数据
-        struct ATCGlobalState {
-            std::string datasource;    ///< 数据来源标识
+        struct alignas(64) ATCGlobalState {
+            DataSourceId datasource;   ///< 数据来源标识（DataSourceRegistry中的ID）
             
             double controller_workload; ///< 管制员工作负荷 [0.0, 1.0]
             double controller_attention; ///< 管制员注意力 [0.0, 1.0]
@@ -680,19 +731,28 @@ namespace VFT_SMF {
         
             bool radar_operational;     ///< 雷达是否工作
             bool communication_system_operational; ///< 通信系统是否工作
-            std::string current_phase;  ///< 当前管制阶段
+            char current_phase[32];     ///< 当前管制阶段（UTF-8，定长以保持可平凡复制）
         
             SimulationTimePoint timestamp;
         
-        ATCGlobalState() : datasource("initialspace"), controller_workload(0.3), controller_attention(1.0),
+        ATCGlobalState() : datasource(INITIAL_DATASOURCE), controller_workload(0.3), controller_attention(1.0),
                           active_aircraft_count(0), pending_commands(0),
                           airspace_congestion(0.2), conflict_count(0),
                           separation_violations(0.0), communication_load(0.2),
                           active_frequencies(1), response_time(2.0),
                           radar_operational(true), communication_system_operational(true),
-                          current_phase("正常"), timestamp(SimulationTimePoint{}) {}
+                          current_phase{"正常"}, timestamp(SimulationTimePoint{}) {}
     };
 
+        // 每步在双缓冲与数据记录器之间多次复制的状态结构体必须可平凡复制（复制即memcpy，无堆分配）
+        static_assert(std::is_trivially_copyable_v<AircraftFlightState>, "AircraftFlightState必须可平凡复制");
+        static_assert(std::is_trivially_copyable_v<AircraftSystemState>, "AircraftSystemState必须可平凡复制");
+        static_assert(std::is_trivially_copyable_v<PilotGlobalState>, "PilotGlobalState必须可平凡复制");
+        static_assert(std::is_trivially_copyable_v<AircraftNetForce>, "AircraftNetForce必须可平凡复制");
+        static_assert(std::is_trivially_copyable_v<EnvironmentGlobalState>, "EnvironmentGlobalState必须可平凡复制");
+        static_assert(std::is_trivially_copyable_v<ATCGlobalState>, "ATCGlobalState必须可平凡复制");
+        static_assert(alignof(AircraftFlightState) == 64 && alignof(AircraftNetForce) == 64, "状态结构体按缓存行对齐");
+
         // 10）飞机全局逻辑数据
         struct AircraftGlobalLogic {
         std::string datasource;    ///< 数据来源标识
@@ -926,6 +986,16 @@ namespace VFT_SMF {
                   datasource(source), timestamp(SimulationTimePoint{}) {}
         };
 
+        /**
+         * @brief 事件队列运行计数快照
+         */
+        struct EventQueueCounters {
+            uint64_t enqueued = 0;
+            uint64_t dequeued = 0;
+            uint64_t overwritten = 0;
+            size_t depth = 0;
+        };
+
         // 18）事件队列数据结构体（单缓冲区实现）
         struct EventQueue {
             static const size_t MAX_QUEUE_SIZE = 1000;        ///< 最大队列容量
@@ -936,16 +1006,22 @@ namespace VFT_SMF {
             size_t tail_index;                                ///< 队列尾索引（下一个要插入的位置）
             size_t current_size;                              ///< 当前队列大小
             std::vector<EventQueueItem> processed_events;     ///< 已处理事件列表
-            mutable std::mutex queue_mutex;                   ///< 队列互斥锁
+            mutable VFT_SMF::SimManage::InstrumentedMutex queue_mutex{"EventQueue.queue"};  ///< 队列互斥锁
             SimulationTimePoint timestamp;                    ///< 时间戳
 
+            // 运行计数（入队出队时在锁内更新，指标端点无锁读取）
+            std::atomic<uint64_t> enqueued_total{0};          ///< 入队次数
+            std::atomic<uint64_t> dequeued_total{0};          ///< 出队次数
+            std::atomic<uint64_t> overwritten_total{0};       ///< 队列满时被覆盖的最旧事件数
+            std::atomic<size_t> depth{0};                     ///< current_size 的无锁镜像
+
             EventQueue() : datasource("initialspace"), head_index(0), tail_index(0), current_size(0), timestamp(SimulationTimePoint{}) {
                 event_buffer.resize(MAX_QUEUE_SIZE);
             }
 
             // 复制构造函数
             EventQueue(const EventQueue& other) {
-                std::lock_guard<std::mutex> lock(other.queue_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(other.queue_mutex);
                 datasource = other.datasource;
                 event_buffer = other.event_buffer;
                 head_index = other.head_index;
@@ -953,13 +1029,14 @@ namespace VFT_SMF {
                 current_size = other.current_size;
                 processed_events = other.processed_events;
                 timestamp = other.timestamp;
+                copyCounters(other);
             }
 
             // 赋值操作符
             EventQueue& operator=(const EventQueue& other) {
                 if (this != &other) {
-                    std::lock_guard<std::mutex> lock1(queue_mutex);
-                    std::lock_guard<std::mutex> lock2(other.queue_mutex);
+                    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock1(queue_mutex);
+                    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock2(other.queue_mutex);
                     datasource = other.datasource;
                     event_buffer = other.event_buffer;
                     head_index = other.head_index;
@@ -967,28 +1044,39 @@ namespace VFT_SMF {
                     current_size = other.current_size;
                     processed_events = other.processed_events;
                     timestamp = other.timestamp;
+                    copyCounters(other);
                 }
                 return *this;
             }
 
+            void copyCounters(const EventQueue& other) {
+                enqueued_total.store(other.enqueued_total.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                dequeued_total.store(other.dequeued_total.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                overwritten_total.store(other.overwritten_total.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                depth.store(other.depth.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+
             // 添加事件到队列
             void enqueueEvent(const StandardEvent& event, double trigger_time, const std::string& source = "event_monitor") {
-                std::lock_guard<std::mutex> lock(queue_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(queue_mutex);
                 if (current_size >= MAX_QUEUE_SIZE) {
                     // 队列满了，覆盖最旧的事件（环形缓冲区行为）
                     head_index = (head_index + 1) % MAX_QUEUE_SIZE;
                     current_size--;
+                    overwritten_total.fetch_add(1, std::memory_order_relaxed);
                 }
                 
                 EventQueueItem item(event, trigger_time, source);
                 event_buffer[tail_index] = item;
                 tail_index = (tail_index + 1) % MAX_QUEUE_SIZE;
                 current_size++;
+                enqueued_total.fetch_add(1, std::memory_order_relaxed);
+                depth.store(current_size, std::memory_order_relaxed);
             }
 
             // 从队列中取出下一个待处理事件
             bool dequeueEvent(EventQueueItem& item) {
-                std::lock_guard<std::mutex> lock(queue_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(queue_mutex);
                 if (current_size == 0) {
                     return false;
                 }
@@ -996,12 +1084,14 @@ namespace VFT_SMF {
                 item = event_buffer[head_index];
                 head_index = (head_index + 1) % MAX_QUEUE_SIZE;
                 current_size--;
+                dequeued_total.fetch_add(1, std::memory_order_relaxed);
+                depth.store(current_size, std::memory_order_relaxed);
                 return true;
             }
 
             // 标记事件为已处理
             void markEventAsProcessed(const EventQueueItem& item) {
-                std::lock_guard<std::mutex> lock(queue_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(queue_mutex);
                 EventQueueItem processed_item = item;
                 processed_item.is_processed = true;
                 processed_events.push_back(processed_item);
@@ -1009,34 +1099,45 @@ namespace VFT_SMF {
 
             // 获取队列大小
             size_t getQueueSize() const {
-                std::lock_guard<std::mutex> lock(queue_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(queue_mutex);
                 return current_size;
             }
 
+            // 获取运行计数（不加锁）
+            EventQueueCounters getCounters() const {
+                EventQueueCounters counters;
+                counters.enqueued = enqueued_total.load(std::memory_order_relaxed);
+                counters.dequeued = dequeued_total.load(std::memory_order_relaxed);
+                counters.overwritten = overwritten_total.load(std::memory_order_relaxed);
+                counters.depth = depth.load(std::memory_order_relaxed);
+                return counters;
+            }
+
             // 获取已处理事件数量
             size_t getProcessedCount() const {
-                std::lock_guard<std::mutex> lock(queue_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(queue_mutex);
                 return processed_events.size();
             }
 
             // 检查队列是否为空
             bool isEmpty() const {
-                std::lock_guard<std::mutex> lock(queue_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(queue_mutex);
                 return current_size == 0;
             }
 
             // 清空队列
             void clear() {
-                std::lock_guard<std::mutex> lock(queue_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(queue_mutex);
                 head_index = 0;
                 tail_index = 0;
                 current_size = 0;
+                depth.store(0, std::memory_order_relaxed);
                 processed_events.clear();
             }
 
             // 获取所有待处理事件（用于调试）
             std::vector<EventQueueItem> getPendingEvents() const {
-                std::lock_guard<std::mutex> lock(queue_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(queue_mutex);
                 std::vector<EventQueueItem> events;
                 for (size_t i = 0; i < current_size; ++i) {
                     size_t index = (head_index + i) % MAX_QUEUE_SIZE;
@@ -1047,7 +1148,7 @@ namespace VFT_SMF {
 
             // 获取所有已处理事件
             const std::vector<EventQueueItem>& getProcessedEvents() const {
-                std::lock_guard<std::mutex> lock(queue_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(queue_mutex);
                 return processed_events;
             }
         };
@@ -1085,7 +1186,7 @@ namespace VFT_SMF {
             size_t tail_index;                                ///< 队列尾索引
             size_t current_size;                              ///< 当前队列大小
             std::vector<AgentEventQueueItem> processed_events; ///< 已处理事件列表
-            mutable std::mutex queue_mutex;                   ///< 队列互斥锁
+            mutable VFT_SMF::SimManage::InstrumentedMutex queue_mutex{"AgentEventQueue.queue"};  ///< 队列互斥锁
             SimulationTimePoint timestamp;                    ///< 时间戳
 
             AgentEventQueue() : agent_id(""), datasource("controller_manager"), 
@@ -1103,22 +1204,30 @@ namespace VFT_SMF {
                              const std::string& ctrl_type, const std::string& ctrl_name,
                              const std::map<std::string, std::string>& params = {},
                              const std::string& source = "controller_manager") {
-                std::lock_guard<std::mutex> lock(queue_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(queue_mutex);
                 if (current_size >= MAX_AGENT_QUEUE_SIZE) {
                     // 队列满了，覆盖最旧的事件
                     head_index = (head_index + 1) % MAX_AGENT_QUEUE_SIZE;
                     current_size--;
                 }
                 
-                AgentEventQueueItem item(event, trigger_time, ctrl_type, ctrl_name, params, source);
-                event_buffer[tail_index] = item;
+                // 就地覆写环形缓冲槽位，复用槽位中字符串与映射已有的存储
+                AgentEventQueueItem& slot = event_buffer[tail_index];
+                slot.event = event;
+                slot.trigger_time = trigger_time;
+                slot.controller_type = ctrl_type;
+                slot.controller_name = ctrl_name;
+                slot.parameters = params;
+                slot.is_processed = false;
+                slot.datasource = source;
+                slot.timestamp = SimulationTimePoint{};
                 tail_index = (tail_index + 1) % MAX_AGENT_QUEUE_SIZE;
                 current_size++;
             }
 
             // 从代理队列中取出下一个待处理事件
             bool dequeueEvent(AgentEventQueueItem& item) {
-                std::lock_guard<std::mutex> lock(queue_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(queue_mutex);
                 if (current_size == 0) {
                     return false;
                 }
@@ -1131,7 +1240,7 @@ namespace VFT_SMF {
 
             // 标记事件为已处理
             void markEventAsProcessed(const AgentEventQueueItem& item) {
-                std::lock_guard<std::mutex> lock(queue_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(queue_mutex);
                 AgentEventQueueItem processed_item = item;
                 processed_item.is_processed = true;
                 processed_events.push_back(processed_item);
@@ -1139,19 +1248,19 @@ namespace VFT_SMF {
 
             // 获取队列大小
             size_t getQueueSize() const {
-                std::lock_guard<std::mutex> lock(queue_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(queue_mutex);
                 return current_size;
             }
 
             // 检查队列是否为空
             bool isEmpty() const {
-                std::lock_guard<std::mutex> lock(queue_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(queue_mutex);
                 return current_size == 0;
             }
 
             // 清空队列
             void clear() {
-                std::lock_guard<std::mutex> lock(queue_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(queue_mutex);
                 head_index = 0;
                 tail_index = 0;
                 current_size = 0;
@@ -1162,14 +1271,14 @@ namespace VFT_SMF {
         // 21）代理事件队列管理器结构体
         struct AgentEventQueueManager {
             std::map<std::string, AgentEventQueue> agent_queues; ///< 各代理的事件队列
-            mutable std::mutex manager_mutex;                    ///< 管理器互斥锁
+            mutable VFT_SMF::SimManage::InstrumentedMutex manager_mutex{"AgentEventQueueManager.manager"};  ///< 管理器互斥锁
             SimulationTimePoint timestamp;                       ///< 时间戳
 
             AgentEventQueueManager() : timestamp(SimulationTimePoint{}) {}
 
             // 为代理创建事件队列
             void createAgentQueue(const std::string& agent_id) {
-                std::lock_guard<std::mutex> lock(manager_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(manager_mutex);
                 if (agent_queues.find(agent_id) == agent_queues.end()) {
                     agent_queues.emplace(
                         std::piecewise_construct,
@@ -1184,7 +1293,7 @@ namespace VFT_SMF {
                                   double trigger_time, const std::string& ctrl_type, 
                                   const std::string& ctrl_name,
                                   const std::map<std::string, std::string>& params = {}) {
-                std::lock_guard<std::mutex> lock(manager_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(manager_mutex);
                 auto it = agent_queues.find(agent_id);
                 if (it != agent_queues.end()) {
                     it->second.enqueueEvent(event, trigger_time, ctrl_type, ctrl_name, params);
@@ -1193,7 +1302,7 @@ namespace VFT_SMF {
 
             // 从指定代理队列取出事件
             bool dequeueAgentEvent(const std::string& agent_id, AgentEventQueueItem& item) {
-                std::lock_guard<std::mutex> lock(manager_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(manager_mutex);
                 auto it = agent_queues.find(agent_id);
                 if (it != agent_queues.end()) {
                     return it->second.dequeueEvent(item);
@@ -1203,7 +1312,7 @@ namespace VFT_SMF {
 
             // 获取指定代理队列大小
             size_t getAgentQueueSize(const std::string& agent_id) const {
-                std::lock_guard<std::mutex> lock(manager_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(manager_mutex);
                 auto it = agent_queues.find(agent_id);
                 if (it != agent_queues.end()) {
                     return it->second.getQueueSize();
@@ -1213,7 +1322,7 @@ namespace VFT_SMF {
 
             // 检查指定代理队列是否为空
             bool isAgentQueueEmpty(const std::string& agent_id) const {
-                std::lock_guard<std::mutex> lock(manager_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(manager_mutex);
                 auto it = agent_queues.find(agent_id);
                 if (it != agent_queues.end()) {
                     return it->second.isEmpty();
@@ -1223,7 +1332,7 @@ namespace VFT_SMF {
 
             // 获取所有代理ID列表
             std::vector<std::string> getAgentIds() const {
-                std::lock_guard<std::mutex> lock(manager_mutex);
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(manager_mutex);
                 std::vector<std::string> agent_ids;
                 for (const auto& pair : agent_queues) {
                     agent_ids.push_back(pair.first);
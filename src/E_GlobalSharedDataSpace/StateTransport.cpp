@@ -0,0 +1,499 @@
+/**
+ * @file StateTransport.cpp
+ * @brief 代理状态传输层实现
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include "StateTransport.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <cerrno>
+#include <csignal>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+
+namespace VFT_SMF {
+namespace GlobalShared_DataSpace {
+
+    namespace {
+        constexpr int SPIN_ITERATIONS = 2000;                       ///< 进入内核等待前的自旋次数（约数微秒）
+        constexpr int STALE_WRITER_SPINS = 1 << 20;                 ///< 状态槽停留在写入中多久后检查占位进程是否已退出
+        constexpr std::chrono::milliseconds WAIT_SLICE{20};         ///< 单次内核等待上限，期间检查进程存活与剔除
+
+        inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#elif defined(__aarch64__)
+            asm volatile("yield");
+#endif
+        }
+
+        /**
+         * @brief 短暂自旋等待计数字变化
+         * @return 计数字已变化
+         */
+        bool spinUntilChanged(const std::atomic<uint32_t>& word, uint32_t expected) {
+            for (int i = 0; i < SPIN_ITERATIONS; ++i) {
+                if (word.load(std::memory_order_acquire) != expected) return true;
+                cpuRelax();
+            }
+            return false;
+        }
+
+        /**
+         * @brief 计数字仍为 expected 时阻塞等待，直到被唤醒或超时
+         */
+        void waitOnWord(std::atomic<uint32_t>& word, uint32_t expected, std::chrono::nanoseconds timeout, bool process_shared) {
+            if (timeout.count() <= 0) return;
+#ifdef __linux__
+            timespec relative;
+            relative.tv_sec = static_cast<time_t>(timeout.count() / 1000000000LL);
+            relative.tv_nsec = static_cast<long>(timeout.count() % 1000000000LL);
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), process_shared ? FUTEX_WAIT : FUTEX_WAIT_PRIVATE,
+                    expected, &relative, nullptr, 0);
+#else
+            // 无 futex：短睡眠后由调用方重新检查
+            (void)process_shared;
+            if (word.load(std::memory_order_acquire) == expected) {
+                std::this_thread::sleep_for(std::min<std::chrono::nanoseconds>(timeout, std::chrono::microseconds(100)));
+            }
+#endif
+        }
+
+        void wakeWord(std::atomic<uint32_t>& word, bool process_shared) {
+#ifdef __linux__
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), process_shared ? FUTEX_WAKE : FUTEX_WAKE_PRIVATE,
+                    INT_MAX, nullptr, nullptr, 0);
+#else
+            (void)word;
+            (void)process_shared;
+#endif
+        }
+
+        uint64_t doubleToBits(double value) {
+            uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        double bitsToDouble(uint64_t bits) {
+            double value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        void copyName(char* destination, size_t capacity, const char* source) {
+            std::strncpy(destination, source ? source : "", capacity - 1);
+            destination[capacity - 1] = '\0';
+        }
+
+        int64_t currentProcessIdentifier() {
+#ifdef _WIN32
+            return static_cast<int64_t>(GetCurrentProcessId());
+#else
+            return static_cast<int64_t>(getpid());
+#endif
+        }
+
+        bool processAlive(int64_t process_id) {
+            if (process_id <= 0) return false;
+#ifdef _WIN32
+            HANDLE process = OpenProcess(SYNCHRONIZE, FALSE, static_cast<DWORD>(process_id));
+            if (!process) return GetLastError() == ERROR_ACCESS_DENIED;
+            const bool running = WaitForSingleObject(process, 0) == WAIT_TIMEOUT;
+            CloseHandle(process);
+            return running;
+#else
+            return kill(static_cast<pid_t>(process_id), 0) == 0 || errno == EPERM;
+#endif
+        }
+    }
+
+    // ==================== 段初始化 ====================
+
+    void SegmentTransport::initializeSegment(TransportSegment* target) {
+        std::memset(static_cast<void*>(target), 0, sizeof(TransportSegment));
+        new (target) TransportSegment();
+        target->version = TRANSPORT_VERSION;
+        target->segment_size = static_cast<uint32_t>(sizeof(TransportSegment));
+        target->coordinator_process_id = currentProcessIdentifier();
+        target->step_word.store(0, std::memory_order_relaxed);
+        target->shutdown_flag.store(0, std::memory_order_relaxed);
+        target->current_step.store(0, std::memory_order_relaxed);
+        target->current_time_bits.store(doubleToBits(0.0), std::memory_order_relaxed);
+        target->completion_word.store(0, std::memory_order_relaxed);
+        for (auto& participant : target->participants) {
+            participant.status.store(FREE, std::memory_order_relaxed);
+            participant.generation.store(0, std::memory_order_relaxed);
+            participant.completed_step.store(0, std::memory_order_relaxed);
+        }
+        for (auto& slot : target->slots) {
+            slot.sequence.store(0, std::memory_order_relaxed);
+        }
+        // magic 最后写入并以 release 发布，参与端看到 magic 即可认为段完整
+        std::atomic_thread_fence(std::memory_order_release);
+        target->magic = TRANSPORT_MAGIC;
+    }
+
+    bool SegmentTransport::validateSegment(const TransportSegment* candidate, size_t mapped_size) {
+        if (!candidate || mapped_size < sizeof(TransportSegment)) return false;
+        if (candidate->magic != TRANSPORT_MAGIC || candidate->version != TRANSPORT_VERSION ||
+            candidate->segment_size != sizeof(TransportSegment)) {
+            return false;
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return true;
+    }
+
+    // ==================== 状态槽 ====================
+
+    void SegmentTransport::publishState(StateChannel channel, const void* data, size_t size, const char* datasource) {
+        const uint32_t index = static_cast<uint32_t>(channel);
+        if (!segment || index >= STATE_CHANNEL_COUNT || size > MAX_STATE_BYTES) return;
+        TransportStateSlot& slot = segment->slots[index];
+        const int64_t process_id = currentProcessId();
+
+        // 写端占位：计数偶数 -> 奇数并同时记下本进程号，同一通道偶有多个写者时互斥。
+        // 计数长时间停留在奇数且占位进程已退出（写入中途崩溃）时接管，计数保持奇数；
+        // 占位进程仍在运行（只是被抢占）、是本进程或协调端时一律等待，避免与其复活后的写入交错
+        uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+        uint64_t observed = sequence;
+        int spins = 0;
+        while (true) {
+            const uint64_t counter = sequenceCounter(sequence);
+            if ((counter & 1) == 0) {
+                if (slot.sequence.compare_exchange_weak(sequence, makeSequence(process_id, counter + 1),
+                                                        std::memory_order_acquire, std::memory_order_relaxed)) {
+                    sequence = makeSequence(process_id, counter + 1);
+                    break;
+                }
+                continue;
+            }
+            if (sequence != observed) {
+                observed = sequence;
+                spins = 0;
+            }
+            if (++spins > STALE_WRITER_SPINS) {
+                spins = 0;
+                const int64_t owner = sequenceWriterProcess(sequence);
+                if (owner != process_id && owner != segment->coordinator_process_id && !isProcessAlive(owner) &&
+                    slot.sequence.compare_exchange_strong(sequence, makeSequence(process_id, counter + 2),
+                                                          std::memory_order_acquire, std::memory_order_relaxed)) {
+                    sequence = makeSequence(process_id, counter + 2);
+                    break;
+                }
+            }
+            cpuRelax();
+            sequence = slot.sequence.load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+
+        slot.writer = participant_index;
+        slot.size = static_cast<uint32_t>(size);
+        copyName(slot.datasource, sizeof(slot.datasource), datasource);
+        std::memcpy(slot.payload, data, size);
+
+        slot.sequence.store(makeSequence(process_id, sequenceCounter(sequence) + 1), std::memory_order_release);
+    }
+
+    bool SegmentTransport::readState(StateChannel channel, void* data, size_t size, StateSlotInfo& info) const {
+        const uint32_t index = static_cast<uint32_t>(channel);
+        if (!segment || index >= STATE_CHANNEL_COUNT || size > MAX_STATE_BYTES) return false;
+        const TransportStateSlot& slot = segment->slots[index];
+
+        for (int attempt = 0; attempt < STALE_WRITER_SPINS; ++attempt) {
+            const uint64_t before = slot.sequence.load(std::memory_order_acquire);
+            if (before == 0) return false;   // 从未写入
+            if (sequenceCounter(before) & 1) {
+                cpuRelax();
+                continue;
+            }
+
+            const uint32_t stored_size = slot.size;
+            const int32_t writer = slot.writer;
+            std::memcpy(info.datasource, slot.datasource, sizeof(info.datasource));
+            std::memcpy(data, slot.payload, std::min<size_t>(size, stored_size));
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != before) continue;   // 读取期间被改写，重读
+
+            if (stored_size != size) return false;
+            info.datasource[sizeof(info.datasource) - 1] = '\0';
+            info.version = sequenceCounter(before) / 2;
+            info.writer = writer;
+            return true;
+        }
+        return false;
+    }
+
+    // ==================== 步信号（协调端） ====================
+
+    void SegmentTransport::beginStep(uint64_t step, double simulation_time) {
+        if (!segment || !coordinator) return;
+        segment->current_time_bits.store(doubleToBits(simulation_time), std::memory_order_relaxed);
+        segment->current_step.store(step, std::memory_order_release);
+        segment->step_word.fetch_add(1, std::memory_order_release);
+        wakeWord(segment->step_word, process_shared);
+    }
+
+    void SegmentTransport::evict(uint32_t index, std::vector<std::string>& evicted, const char* reason) {
+        TransportParticipant& participant = segment->participants[index];
+        uint32_t expected = ATTACHED;
+        if (participant.status.compare_exchange_strong(expected, FREE, std::memory_order_acq_rel)) {
+            evicted.push_back(std::string(participant.name, strnlen(participant.name, TRANSPORT_NAME_LENGTH)) + "（" + reason + "）");
+        }
+    }
+
+    std::vector<std::string> SegmentTransport::waitForParticipants(uint64_t step, std::chrono::milliseconds timeout) {
+        std::vector<std::string> evicted;
+        if (!segment || !coordinator) return evicted;
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+        while (true) {
+            const uint32_t word = segment->completion_word.load(std::memory_order_acquire);
+            bool lagging = false;
+            for (uint32_t i = 0; i < MAX_TRANSPORT_PARTICIPANTS; ++i) {
+                TransportParticipant& participant = segment->participants[i];
+                if (participant.status.load(std::memory_order_acquire) != ATTACHED) continue;
+                if (participant.completed_step.load(std::memory_order_acquire) >= step) continue;
+                if (!isProcessAlive(participant.process_id)) {
+                    evict(i, evicted, "进程已退出");
+                    continue;
+                }
+                lagging = true;
+            }
+            if (!lagging) return evicted;
+
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                for (uint32_t i = 0; i < MAX_TRANSPORT_PARTICIPANTS; ++i) {
+                    TransportParticipant& participant = segment->participants[i];
+                    if (participant.status.load(std::memory_order_acquire) == ATTACHED &&
+                        participant.completed_step.load(std::memory_order_acquire) < step) {
+                        evict(i, evicted, "步超时");
+                    }
+                }
+                return evicted;
+            }
+
+            if (spinUntilChanged(segment->completion_word, word)) continue;
+            waitOnWord(segment->completion_word, word,
+                       std::min<std::chrono::nanoseconds>(WAIT_SLICE, deadline - now), process_shared);
+        }
+    }
+
+    void SegmentTransport::shutdown() {
+        if (!segment || !coordinator) return;
+        segment->shutdown_flag.store(1, std::memory_order_release);
+        segment->step_word.fetch_add(1, std::memory_order_release);
+        wakeWord(segment->step_word, process_shared);
+    }
+
+    std::vector<std::string> SegmentTransport::getAttachedParticipants() const {
+        std::vector<std::string> names;
+        if (!segment) return names;
+        for (const auto& participant : segment->participants) {
+            if (participant.status.load(std::memory_order_acquire) == ATTACHED) {
+                names.emplace_back(participant.name, strnlen(participant.name, TRANSPORT_NAME_LENGTH));
+            }
+        }
+        return names;
+    }
+
+    // ==================== 参与端 ====================
+
+    bool SegmentTransport::attach(const std::string& participant_name) {
+        if (!segment || coordinator || participant_name.empty()) return false;
+        detach();
+
+        const int64_t process_id = currentProcessId();
+        int32_t target = -1;
+
+        // 同名参与端：其进程已退出时取代之，仍在运行时拒绝
+        for (uint32_t i = 0; i < MAX_TRANSPORT_PARTICIPANTS && target < 0; ++i) {
+            TransportParticipant& participant = segment->participants[i];
+            if (participant.status.load(std::memory_order_acquire) != ATTACHED ||
+                participant_name.compare(0, TRANSPORT_NAME_LENGTH - 1,
+                                         std::string(participant.name, strnlen(participant.name, TRANSPORT_NAME_LENGTH))) != 0) {
+                continue;
+            }
+            if (isProcessAlive(participant.process_id)) return false;
+            uint32_t expected = ATTACHED;
+            if (!participant.status.compare_exchange_strong(expected, CLAIMING, std::memory_order_acq_rel)) return false;
+            target = static_cast<int32_t>(i);
+        }
+
+        for (uint32_t i = 0; i < MAX_TRANSPORT_PARTICIPANTS && target < 0; ++i) {
+            uint32_t expected = FREE;
+            if (segment->participants[i].status.compare_exchange_strong(expected, CLAIMING, std::memory_order_acq_rel)) {
+                target = static_cast<int32_t>(i);
+            }
+        }
+        if (target < 0) return false;
+
+        TransportParticipant& participant = segment->participants[target];
+        participant.process_id = process_id;
+        copyName(participant.name, sizeof(participant.name), participant_name.c_str());
+        // 视为已完成当前步：中途附加不拖住协调端正在等待的这一步
+        participant.completed_step.store(segment->current_step.load(std::memory_order_acquire), std::memory_order_relaxed);
+        participant_generation = participant.generation.fetch_add(1, std::memory_order_relaxed) + 1;
+        participant.status.store(ATTACHED, std::memory_order_release);
+        participant_index = target;
+        return true;
+    }
+
+    void SegmentTransport::detach() {
+        if (!isAttached()) {
+            participant_index = COORDINATOR_WRITER;
+            return;
+        }
+        uint32_t expected = ATTACHED;
+        segment->participants[participant_index].status.compare_exchange_strong(expected, FREE, std::memory_order_acq_rel);
+        participant_index = COORDINATOR_WRITER;
+        // 协调端可能正在等待本端完成
+        segment->completion_word.fetch_add(1, std::memory_order_release);
+        wakeWord(segment->completion_word, process_shared);
+    }
+
+    bool SegmentTransport::isAttached() const {
+        if (!segment || coordinator || participant_index < 0) return false;
+        const TransportParticipant& participant = segment->participants[participant_index];
+        return participant.status.load(std::memory_order_acquire) == ATTACHED &&
+               participant.generation.load(std::memory_order_relaxed) == participant_generation;
+    }
+
+    StepWaitResult SegmentTransport::waitForStep(uint64_t last_step, uint64_t& step, double& simulation_time,
+                                                 std::chrono::milliseconds timeout) {
+        if (!segment) return StepWaitResult::Shutdown;
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+        while (true) {
+            if (segment->shutdown_flag.load(std::memory_order_acquire) != 0) return StepWaitResult::Shutdown;
+            if (!isAttached()) return StepWaitResult::Detached;
+
+            const uint32_t word = segment->step_word.load(std::memory_order_acquire);
+            const uint64_t current = segment->current_step.load(std::memory_order_acquire);
+            if (current != 0 && current != last_step) {
+                step = current;
+                simulation_time = bitsToDouble(segment->current_time_bits.load(std::memory_order_relaxed));
+                return StepWaitResult::Step;
+            }
+
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                // 协调端异常退出时不会再置结束标志
+                return isProcessAlive(segment->coordinator_process_id) ? StepWaitResult::Timeout : StepWaitResult::Shutdown;
+            }
+            if (spinUntilChanged(segment->step_word, word)) continue;
+            waitOnWord(segment->step_word, word, std::min<std::chrono::nanoseconds>(WAIT_SLICE, deadline - now), process_shared);
+        }
+    }
+
+    void SegmentTransport::completeStep(uint64_t step) {
+        if (!isAttached()) return;
+        segment->participants[participant_index].completed_step.store(step, std::memory_order_release);
+        segment->completion_word.fetch_add(1, std::memory_order_release);
+        wakeWord(segment->completion_word, process_shared);
+    }
+
+    bool SegmentTransport::isShutdown() const {
+        return !segment || segment->shutdown_flag.load(std::memory_order_acquire) != 0;
+    }
+
+    // ==================== InProcessTransport ====================
+
+    InProcessTransport::~InProcessTransport() {
+        if (!segment) return;
+        if (coordinator) {
+            shutdown();
+        } else {
+            detach();
+        }
+    }
+
+    std::shared_ptr<InProcessTransport> InProcessTransport::create() {
+        auto transport = std::make_shared<InProcessTransport>();
+        transport->shared_segment = std::make_shared<TransportSegment>();
+        initializeSegment(transport->shared_segment.get());
+        transport->segment = transport->shared_segment.get();
+        transport->coordinator = true;
+        transport->process_shared = false;
+        return transport;
+    }
+
+    std::shared_ptr<InProcessTransport> InProcessTransport::connect() const {
+        auto endpoint = std::make_shared<InProcessTransport>();
+        endpoint->shared_segment = shared_segment;
+        endpoint->segment = shared_segment.get();
+        endpoint->coordinator = false;
+        endpoint->process_shared = false;
+        return endpoint;
+    }
+
+    int64_t InProcessTransport::currentProcessId() const {
+        return currentProcessIdentifier();
+    }
+
+    // ==================== SharedMemoryTransport ====================
+
+    SharedMemoryTransport::~SharedMemoryTransport() {
+        if (!segment) return;
+        if (coordinator) {
+            shutdown();
+        } else {
+            detach();
+        }
+    }
+
+    bool SharedMemoryTransport::create(const std::string& segment_name) {
+        segment = nullptr;
+        if (!region.create(segment_name, sizeof(TransportSegment))) return false;
+        segment = static_cast<TransportSegment*>(region.data());
+        initializeSegment(segment);
+        coordinator = true;
+        process_shared = true;
+        participant_index = COORDINATOR_WRITER;
+        return true;
+    }
+
+    bool SharedMemoryTransport::open(const std::string& segment_name) {
+        segment = nullptr;
+        if (!region.open(segment_name, true)) return false;
+        TransportSegment* candidate = static_cast<TransportSegment*>(region.data());
+        if (!validateSegment(candidate, region.getSize())) {
+            region.close();
+            return false;
+        }
+        segment = candidate;
+        coordinator = false;
+        process_shared = true;
+        participant_index = COORDINATOR_WRITER;
+        return true;
+    }
+
+    bool SharedMemoryTransport::isProcessAlive(int64_t process_id) const {
+        return processAlive(process_id);
+    }
+
+    int64_t SharedMemoryTransport::currentProcessId() const {
+        return currentProcessIdentifier();
+    }
+
+} // namespace GlobalShared_DataSpace
+} // namespace VFT_SMF
@@ -0,0 +1,290 @@
+/**
+ * @file StateTransport.hpp
+ * @brief 代理状态传输层（全局共享数据空间之下）
+ * @details 全局共享数据空间把可平凡复制的状态模块（飞行状态、系统状态、飞行员、环境、ATC、合外力）
+ *          经由传输层发布给其他参与端，并以同一传输层下发步信号、回收各参与端的完成标志。
+ *          - InProcessTransport：段位于本进程堆上，供同进程内以传输接口驱动代理（测试、嵌入式宿主）；
+ *          - SharedMemoryTransport：段位于 shm_open 共享内存（Windows 为命名文件映射），
+ *            代理可作为同机独立进程运行，崩溃或卡死只影响该代理，协调端剔除后继续仿真，
+ *            同名参与端可随时重新附加（重启或替换代理）。
+ *          状态槽以序号做 seqlock 保护（写端 CAS 占位，读端校验前后序号）；步信号与完成信号是
+ *          两个 32 位计数字，Linux 下先短暂自旋再以 futex 等待/唤醒，其他平台退化为自旋加短睡眠。
+ *          协调端（仿真主进程）唯一，参与端至多 MAX_TRANSPORT_PARTICIPANTS 个。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#pragma once
+
+#include "../G_SimulationManager/LogAndData/TelemetryRing.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace VFT_SMF {
+namespace GlobalShared_DataSpace {
+
+    /**
+     * @brief 经传输层交换的状态模块
+     */
+    enum class StateChannel : uint32_t {
+        AircraftFlightState = 0,
+        AircraftSystemState,
+        PilotState,
+        EnvironmentState,
+        ATCState,
+        AircraftNetForce,
+        COUNT
+    };
+
+    constexpr uint32_t STATE_CHANNEL_COUNT = static_cast<uint32_t>(StateChannel::COUNT);
+    constexpr uint32_t TRANSPORT_MAGIC = 0x56545350;           ///< "VTSP"
+    constexpr uint32_t TRANSPORT_VERSION = 2;
+    constexpr uint32_t MAX_TRANSPORT_PARTICIPANTS = 16;
+    constexpr uint32_t TRANSPORT_NAME_LENGTH = 32;
+    constexpr uint32_t TRANSPORT_DATASOURCE_LENGTH = 64;
+    constexpr uint32_t MAX_STATE_BYTES = 512;                  ///< 单个状态模块的上限
+    constexpr int32_t COORDINATOR_WRITER = -1;                 ///< 协调端写入的状态槽写者编号
+
+    static_assert(std::atomic<uint32_t>::is_always_lock_free && std::atomic<uint64_t>::is_always_lock_free,
+                  "共享内存中的原子变量必须无锁");
+
+    /**
+     * @brief 读取状态槽时附带的信息
+     */
+    struct StateSlotInfo {
+        uint64_t version = 0;                          ///< 写入次数（0 表示从未写入）
+        int32_t writer = COORDINATOR_WRITER;           ///< 写者：协调端或参与端编号
+        char datasource[TRANSPORT_DATASOURCE_LENGTH] = {};   ///< 数据来源名称（进程间不共享驻留ID）
+    };
+
+    /**
+     * @brief 参与端等待步信号的结果
+     */
+    enum class StepWaitResult {
+        Step,       ///< 新步已开始
+        Timeout,    ///< 超时，无新步
+        Shutdown,   ///< 协调端已结束仿真
+        Detached    ///< 本端已被剔除（超时或被同名参与端取代），需要重新附加
+    };
+
+    /**
+     * @brief 传输层接口
+     */
+    class StateTransport {
+    public:
+        virtual ~StateTransport() = default;
+
+        // ---------- 角色 ----------
+        virtual bool isCoordinator() const = 0;
+        /// 参与端编号，协调端返回 COORDINATOR_WRITER
+        virtual int32_t localParticipant() const = 0;
+
+        // ---------- 状态槽 ----------
+        virtual void publishState(StateChannel channel, const void* data, size_t size, const char* datasource) = 0;
+        /// 读取状态槽，从未写入或尺寸不符时返回 false
+        virtual bool readState(StateChannel channel, void* data, size_t size, StateSlotInfo& info) const = 0;
+
+        template <typename T>
+        void publish(StateChannel channel, const T& state, const char* datasource) {
+            static_assert(std::is_trivially_copyable_v<T> && sizeof(T) <= MAX_STATE_BYTES, "只能传输可平凡复制的状态模块");
+            publishState(channel, &state, sizeof(T), datasource);
+        }
+
+        template <typename T>
+        bool read(StateChannel channel, T& state, StateSlotInfo& info) const {
+            static_assert(std::is_trivially_copyable_v<T> && sizeof(T) <= MAX_STATE_BYTES, "只能传输可平凡复制的状态模块");
+            return readState(channel, &state, sizeof(T), info);
+        }
+
+        // ---------- 步信号（协调端） ----------
+        /// 开始新步并唤醒所有参与端
+        virtual void beginStep(uint64_t step, double simulation_time) = 0;
+        /**
+         * @brief 等待所有已附加参与端完成指定步
+         * @details 进程已退出的参与端立即剔除；超时仍未完成的参与端同样剔除，仿真照常继续
+         * @return 本次被剔除的参与端，形如 "environment（步超时）"（名称后附剔除原因）
+         */
+        virtual std::vector<std::string> waitForParticipants(uint64_t step, std::chrono::milliseconds timeout) = 0;
+        /// 结束仿真，唤醒所有参与端
+        virtual void shutdown() = 0;
+        virtual std::vector<std::string> getAttachedParticipants() const = 0;
+
+        // ---------- 参与端 ----------
+        /**
+         * @brief 以名称附加为参与端（同名且进程已退出的旧参与端被取代）
+         * @return 名额已满或同名参与端仍在运行时返回 false
+         */
+        virtual bool attach(const std::string& participant_name) = 0;
+        virtual void detach() = 0;
+        virtual bool isAttached() const = 0;
+        /**
+         * @brief 等待步号不同于 last_step 的新步
+         * @param step 输出步号
+         * @param simulation_time 输出仿真时间
+         */
+        virtual StepWaitResult waitForStep(uint64_t last_step, uint64_t& step, double& simulation_time,
+                                           std::chrono::milliseconds timeout) = 0;
+        /// 回报本端已完成指定步
+        virtual void completeStep(uint64_t step) = 0;
+        virtual bool isShutdown() const = 0;
+    };
+
+    // ==================== 传输段布局（进程内与共享内存共用） ====================
+
+    /**
+     * @brief 状态槽
+     * @details sequence 低 32 位为写入计数：奇数表示正在写入，2*n 表示已完成第 n 次写入；
+     *          高 32 位为占位写者的进程号，与计数一同原子更新，接管崩溃写者时据此判断其是否已退出
+     */
+    struct alignas(64) TransportStateSlot {
+        std::atomic<uint64_t> sequence;
+        int32_t writer;
+        uint32_t size;
+        char datasource[TRANSPORT_DATASOURCE_LENGTH];
+        alignas(64) unsigned char payload[MAX_STATE_BYTES];
+    };
+
+    /**
+     * @brief 参与端登记项
+     */
+    struct alignas(64) TransportParticipant {
+        std::atomic<uint32_t> status;           ///< 见 SegmentTransport::ParticipantStatus
+        std::atomic<uint32_t> generation;       ///< 每次附加递增，旧进程据此发现自己已被取代
+        std::atomic<uint64_t> completed_step;   ///< 已完成的步号
+        int64_t process_id;
+        char name[TRANSPORT_NAME_LENGTH];
+    };
+
+    /**
+     * @brief 传输段
+     */
+    struct TransportSegment {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t segment_size;
+        int64_t coordinator_process_id;                     ///< 参与端据此发现协调端已异常退出
+        alignas(64) std::atomic<uint32_t> step_word;        ///< 每次开始新步或结束时递增（futex）
+        std::atomic<uint32_t> shutdown_flag;
+        std::atomic<uint64_t> current_step;
+        std::atomic<uint64_t> current_time_bits;            ///< 仿真时间（double 位模式）
+        alignas(64) std::atomic<uint32_t> completion_word;  ///< 每次参与端回报完成时递增（futex）
+        TransportParticipant participants[MAX_TRANSPORT_PARTICIPANTS];
+        TransportStateSlot slots[STATE_CHANNEL_COUNT];
+    };
+
+    /**
+     * @brief 基于传输段的实现（两种传输共用，派生类只负责段的来源与进程存活判断）
+     */
+    class SegmentTransport : public StateTransport {
+    public:
+        enum ParticipantStatus : uint32_t { FREE = 0, CLAIMING = 1, ATTACHED = 2 };
+
+        bool isCoordinator() const override { return coordinator; }
+        int32_t localParticipant() const override { return participant_index; }
+
+        void publishState(StateChannel channel, const void* data, size_t size, const char* datasource) override;
+        bool readState(StateChannel channel, void* data, size_t size, StateSlotInfo& info) const override;
+
+        void beginStep(uint64_t step, double simulation_time) override;
+        std::vector<std::string> waitForParticipants(uint64_t step, std::chrono::milliseconds timeout) override;
+        void shutdown() override;
+        std::vector<std::string> getAttachedParticipants() const override;
+
+        bool attach(const std::string& participant_name) override;
+        void detach() override;
+        bool isAttached() const override;
+        StepWaitResult waitForStep(uint64_t last_step, uint64_t& step, double& simulation_time,
+                                   std::chrono::milliseconds timeout) override;
+        void completeStep(uint64_t step) override;
+        bool isShutdown() const override;
+
+    protected:
+        SegmentTransport() = default;
+
+        /// 初始化新段（协调端）
+        static void initializeSegment(TransportSegment* segment);
+        /// 校验已存在的段
+        static bool validateSegment(const TransportSegment* segment, size_t mapped_size);
+
+        /// 状态槽序号字的组成（见 TransportStateSlot）
+        static uint64_t makeSequence(int64_t process_id, uint64_t counter) {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(process_id)) << 32) | (counter & 0xFFFFFFFFULL);
+        }
+        static uint64_t sequenceCounter(uint64_t sequence) { return sequence & 0xFFFFFFFFULL; }
+        static int64_t sequenceWriterProcess(uint64_t sequence) { return static_cast<int64_t>(sequence >> 32); }
+
+        /// 参与端进程是否仍在运行
+        virtual bool isProcessAlive(int64_t process_id) const = 0;
+        virtual int64_t currentProcessId() const = 0;
+
+        TransportSegment* segment = nullptr;
+        bool coordinator = false;
+        bool process_shared = false;    ///< futex 是否跨进程
+        int32_t participant_index = COORDINATOR_WRITER;
+        uint32_t participant_generation = 0;
+
+    private:
+        void evict(uint32_t index, std::vector<std::string>& evicted, const char* reason);
+    };
+
+    /**
+     * @brief 进程内传输：段在堆上，协调端与各参与端是共享同一段的不同端点
+     */
+    class InProcessTransport : public SegmentTransport {
+    public:
+        InProcessTransport() = default;
+        ~InProcessTransport() override;
+        InProcessTransport(const InProcessTransport&) = delete;
+        InProcessTransport& operator=(const InProcessTransport&) = delete;
+
+        /// 创建协调端
+        static std::shared_ptr<InProcessTransport> create();
+        /// 连接到同一段的新端点（随后 attach 为参与端）
+        std::shared_ptr<InProcessTransport> connect() const;
+
+    protected:
+        bool isProcessAlive(int64_t) const override { return true; }
+        int64_t currentProcessId() const override;
+
+    private:
+        std::shared_ptr<TransportSegment> shared_segment;
+    };
+
+    /**
+     * @brief 共享内存传输：协调端 create，参与端（独立进程）open 后 attach
+     */
+    class SharedMemoryTransport : public SegmentTransport {
+    public:
+        SharedMemoryTransport() = default;
+        ~SharedMemoryTransport() override;
+        SharedMemoryTransport(const SharedMemoryTransport&) = delete;
+        SharedMemoryTransport& operator=(const SharedMemoryTransport&) = delete;
+
+        /**
+         * @brief 创建（或重建）传输段，成为协调端
+         * @param segment_name 共享内存名称（不含前导'/'）
+         */
+        bool create(const std::string& segment_name);
+
+        /**
+         * @brief 打开协调端已创建的传输段（版本或布局不符时失败）
+         */
+        bool open(const std::string& segment_name);
+
+    protected:
+        bool isProcessAlive(int64_t process_id) const override;
+        int64_t currentProcessId() const override;
+
+    private:
+        VFT_SMF::Telemetry::SharedMemoryRegion region;
+    };
+
+} // namespace GlobalShared_DataSpace
+} // namespace VFT_SMF
@@ -8,6 +8,7 @@
 #include "FlightPlanParser.hpp"
 #include "../../G_SimulationManager/LogAndData/Logger.hpp"
 #include "../../E_GlobalSharedDataSpace/GlobalSharedDataSpace.hpp"
+#include "../../E_FlightDynamics/TrimSolver.hpp"
 #include <iostream>
 #include <sstream>
 #include <fstream>
@@ -40,6 +41,8 @@ namespace VFT_SMF {
                 return false;
             }
 
+            apply_trim_condition();
+
             is_parsed = true;
             return true;
         }
@@ -385,6 +388,95 @@ namespace VFT_SMF {
         return atc_data;
     }
 
+    double FlightPlanParser::environment_air_density(const nlohmann::json& environment_data) {
+        if (!environment_data.is_object() || !environment_data.contains("weather")) {
+            return 1.225; // 标准大气密度
+        }
+        const auto& weather_data = environment_data["weather"];
+        const double atmospheric_pressure = weather_data.value("atmospheric_pressure", 1013.25);   // hPa
+        const double temperature = weather_data.value("temperature", 15.0);
+        return atmospheric_pressure * 100.0 / (287.0 * (temperature + 273.15));
+    }
+
+    void FlightPlanParser::apply_trim_condition() {
+        auto& global_state = flight_plan_data["flight_plan"]["global_initial_state"];
+        if (!global_state.contains("flight_dynamics_initial_state")) return;
+        auto& flight_dynamics = global_state["flight_dynamics_initial_state"];
+        if (!flight_dynamics.contains("trim") || !flight_dynamics["trim"].is_object()) return;
+        const auto& trim = flight_dynamics["trim"];
+        if (!trim.value("enabled", true)) return;
+
+        const auto position = flight_dynamics.value("position", nlohmann::json::object());
+        const auto attitude = flight_dynamics.value("attitude", nlohmann::json::object());
+        const auto velocity = flight_dynamics.value("velocity", nlohmann::json::object());
+        const auto aircraft = global_state.value("aircraft_initial_state", nlohmann::json::object());
+        const auto environment = global_state.value("environment_initial_state", nlohmann::json::object());
+
+        VFT_SMF::FlightDynamics::TrimTarget target;
+        const double vx = velocity.value("vx", 0.0);
+        const double vy = velocity.value("vy", 0.0);
+        target.airspeed = trim.value("airspeed", std::sqrt(vx * vx + vy * vy));
+        target.altitude = trim.value("altitude", -position.value("z", 0.0));
+        target.heading = attitude.value("yaw", 90.0);
+        target.flight_path_angle = trim.value("flight_path_angle", 0.0);
+        target.turn_rate = trim.value("turn_rate", 0.0);
+        target.air_density = trim.value("air_density", environment_air_density(environment));
+        target.flap_position = aircraft.value("flaps_position", 0.0);
+        target.landing_gear = aircraft.value("landing_gear_position", "down_locked") == "down_locked" ? 1.0 : 0.0;
+
+        if (target.altitude <= 0.0 || target.airspeed <= 0.0) {
+            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "配平已跳过: 初始高度与空速须为正（高度=" +
+                              std::to_string(target.altitude) + "m, 空速=" + std::to_string(target.airspeed) + " m/s）");
+            return;
+        }
+
+        VFT_SMF::FlightDynamics::TrimSolver solver;
+        const auto result = solver.solve(target);
+        if (!result.converged) {
+            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "配平未收敛，保留原始初始状态: 残差=" +
+                              std::to_string(result.residual_norm) + "，目标可能超出操纵限幅");
+            return;
+        }
+
+        // 回写初始状态：空速按航向分解为水平速度，航迹角对应垂直速度（NED，z向下）
+        const double heading = target.heading * M_PI / 180.0;
+        flight_dynamics["position"]["z"] = -target.altitude;
+        flight_dynamics["attitude"]["pitch"] = result.pitch;
+        flight_dynamics["attitude"]["roll"] = result.roll;
+        flight_dynamics["attitude"]["yaw"] = target.heading;
+        flight_dynamics["velocity"]["vx"] = target.airspeed * std::cos(heading);
+        flight_dynamics["velocity"]["vy"] = target.airspeed * std::sin(heading);
+        flight_dynamics["velocity"]["vz"] = -result.flight_state.vertical_speed;
+        flight_dynamics["angular_velocity"]["roll_rate"] = 0.0;
+        flight_dynamics["angular_velocity"]["pitch_rate"] = 0.0;
+        flight_dynamics["angular_velocity"]["yaw_rate"] = target.turn_rate;
+
+        auto& aircraft_state = global_state["aircraft_initial_state"];
+        aircraft_state["throttle_position"] = result.throttle;
+        aircraft_state["elevator_position"] = result.elevator;
+        aircraft_state["aileron_position"] = result.aileron;
+        aircraft_state["rudder_position"] = result.rudder;
+
+        flight_dynamics["trim_result"] = {
+            {"iterations", result.iterations},
+            {"residual_norm", result.residual_norm},
+            {"throttle", result.throttle},
+            {"elevator", result.elevator},
+            {"aileron", result.aileron},
+            {"rudder", result.rudder},
+            {"pitch", result.pitch},
+            {"roll", result.roll}
+        };
+
+        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "配平完成: 空速=" + std::to_string(target.airspeed) +
+                          " m/s, 航迹角=" + std::to_string(target.flight_path_angle) +
+                          "°, 转弯角速度=" + std::to_string(target.turn_rate) +
+                          "°/s -> 油门=" + std::to_string(result.throttle) +
+                          ", 升降舵=" + std::to_string(result.elevator) +
+                          "°, 俯仰角=" + std::to_string(result.pitch) +
+                          "°, 滚转角=" + std::to_string(result.roll) + "°");
+    }
+
     std::vector<VFT_SMF::GlobalSharedDataStruct::FlightPlanData::ScenarioEvent> FlightPlanParser::parse_logic_sequence(const nlohmann::json& logic_sequence) const {
         std::vector<VFT_SMF::GlobalSharedDataStruct::FlightPlanData::ScenarioEvent> events;
         
@@ -680,6 +772,14 @@ namespace VFT_SMF {
                     flight_state.vertical_speed = 0.0;
                 }
                 
+                // 解析角速度信息
+                if (flight_dynamics_data.contains("angular_velocity")) {
+                    const auto& angular_velocity = flight_dynamics_data["angular_velocity"];
+                    flight_state.roll_rate = angular_velocity.value("roll_rate", 0.0);
+                    flight_state.pitch_rate = angular_velocity.value("pitch_rate", 0.0);
+                    flight_state.yaw_rate = angular_velocity.value("yaw_rate", 0.0);
+                }
+                
                 // 设置其他飞行状态参数
                 flight_state.landing_gear_deployed = true;
                 flight_state.flaps_deployed = false;
@@ -720,24 +820,17 @@ namespace VFT_SMF {
                     const auto& runway_data = env_data["runway"];
                     env_state.runway_length = runway_data.value("length", 3800.0);
                     env_state.runway_width = runway_data.value("width", 60.0);
+                    env_state.runway_elevation = runway_data.value("elevation", 0.0);
                     env_state.friction_coefficient = runway_data.value("friction_coefficient", 0.7);
                 } else {
                     env_state.runway_length = 3800.0;
                     env_state.runway_width = 60.0;
+                    env_state.runway_elevation = 0.0;
                     env_state.friction_coefficient = 0.7;
                 }
                 
-                // 解析天气信息
-                if (env_data.contains("weather")) {
-                    const auto& weather_data = env_data["weather"];
-                    // 从大气压力计算空气密度 (简化计算)
-                    double atmospheric_pressure = weather_data.value("atmospheric_pressure", 1013.25);
-                    double temperature = weather_data.value("temperature", 15.0);
-                    // 使用理想气体定律计算空气密度 (简化)
-                    env_state.air_density = atmospheric_pressure / (287.0 * (temperature + 273.15));
-                } else {
-                    env_state.air_density = 1.225; // 标准大气密度
-                }
+                // 由天气信息计算空气密度（与配平共用）
+                env_state.air_density = environment_air_density(env_data);
                 
                 // 解析风信息
                 if (env_data.contains("wind")) {
@@ -754,7 +847,8 @@ namespace VFT_SMF {
                 
                 VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "环境初始状态已从飞行计划解析并设置: 跑道长度=" + 
                                    std::to_string(env_state.runway_length) + "m, 跑道宽度=" + 
-                                   std::to_string(env_state.runway_width) + "m, 摩擦系数=" + 
+                                   std::to_string(env_state.runway_width) + "m, 跑道标高=" + 
+                                   std::to_string(env_state.runway_elevation) + "m, 摩擦系数=" + 
                                    std::to_string(env_state.friction_coefficient) + ", 风速=" + 
                                    std::to_string(env_state.wind_speed) + " m/s, 风向=" + 
                                    std::to_string(env_state.wind_direction) + "°");
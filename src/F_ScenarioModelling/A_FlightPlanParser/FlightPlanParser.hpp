@@ -168,6 +168,24 @@ namespace VFT_SMF {
          */
         nlohmann::json parse_atc_state(const nlohmann::json& atc_data) const;
 
+        /**
+         * @brief 由环境初始状态的天气（气压 hPa、温度 ℃）按理想气体定律计算空气密度
+         * @details 环境初始状态与配平共用，无天气信息时为标准大气密度 1.225 kg/m³
+         * @param environment_data environment_initial_state
+         * @return 空气密度 (kg/m³)
+         */
+        static double environment_air_density(const nlohmann::json& environment_data);
+
+        /**
+         * @brief 按 flight_dynamics_initial_state.trim 求解配平并回写初始状态
+         * @details 配平块示例：{"enabled": true, "airspeed": 120.0, "flight_path_angle": 0.0, "turn_rate": 0.0}，
+         *          可选 altitude（默认取 -position.z）与 air_density（默认由 environment_initial_state 的天气计算，
+         *          与飞行动力学读到的环境密度一致）；构型取自 aircraft_initial_state。
+         *          收敛后改写初始位置高度、姿态、速度、角速度与飞机操纵量，使场景从稳定状态开始；
+         *          未收敛或高度不在空中时保留原始初始状态
+         */
+        void apply_trim_condition();
+
         /**
          * @brief 解析逻辑序列
          * @param logic_sequence 逻辑序列数据
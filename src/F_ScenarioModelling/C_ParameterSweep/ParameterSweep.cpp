@@ -0,0 +1,595 @@
+/**
+ * @file ParameterSweep.cpp
+ * @brief 场景配置参数扫描（试验设计）引擎实现
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include "ParameterSweep.hpp"
+#include "../../G_SimulationManager/B_SimManage/RandomService.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+namespace VFT_SMF {
+namespace ParameterSweep {
+
+    namespace {
+
+        /**
+         * @brief Joe-Kuo (new-joe-kuo-6.21201) 第2维起的本原多项式与初始方向数
+         */
+        struct SobolPolynomial {
+            uint32_t degree;
+            uint32_t coefficients;
+            uint32_t initial[5];
+        };
+
+        const SobolPolynomial SOBOL_POLYNOMIALS[SobolSequence::MAX_DIMENSIONS - 1] = {
+            {1, 0,  {1, 0, 0, 0, 0}},
+            {2, 1,  {1, 3, 0, 0, 0}},
+            {3, 1,  {1, 3, 1, 0, 0}},
+            {3, 2,  {1, 1, 1, 0, 0}},
+            {4, 1,  {1, 1, 3, 3, 0}},
+            {4, 4,  {1, 3, 5, 13, 0}},
+            {5, 2,  {1, 1, 5, 5, 17}},
+            {5, 4,  {1, 1, 5, 5, 5}},
+            {5, 7,  {1, 1, 7, 11, 19}},
+            {5, 11, {1, 1, 5, 1, 1}},
+            {5, 13, {1, 1, 1, 3, 11}},
+        };
+
+        const uint32_t SOBOL_BITS = 32;
+
+        std::string formatNumber(double value) {
+            std::ostringstream oss;
+            oss << std::setprecision(10) << value;
+            return oss.str();
+        }
+
+        bool readJsonFile(const fs::path& path, nlohmann::json& document, std::string& error) {
+            std::ifstream file(path);
+            if (!file.is_open()) {
+                error = "无法打开文件: " + path.string();
+                return false;
+            }
+            try {
+                file >> document;
+            } catch (const std::exception& e) {
+                error = "解析JSON失败: " + path.string() + "，" + e.what();
+                return false;
+            }
+            return true;
+        }
+
+        bool writeJsonFile(const fs::path& path, const nlohmann::json& document) {
+            std::ofstream file(path);
+            if (!file.is_open()) return false;
+            file << document.dump(4) << "\n";
+            return file.good();
+        }
+
+        ConfigTarget parseTarget(const std::string& text) {
+            if (text == "flight_plan") return ConfigTarget::FlightPlan;
+            if (text == "environment") return ConfigTarget::Environment;
+            return ConfigTarget::Simulation;
+        }
+
+        SweepMethod parseMethod(const std::string& text) {
+            if (text == "full_factorial") return SweepMethod::FullFactorial;
+            if (text == "sobol") return SweepMethod::Sobol;
+            return SweepMethod::LatinHypercube;
+        }
+
+        std::string resolvePath(const fs::path& base, const std::string& path) {
+            if (path.empty()) return path;
+            const fs::path candidate(path);
+            return (candidate.is_absolute() ? candidate : (base / candidate)).lexically_normal().string();
+        }
+
+        double squaredDistance(const std::vector<double>& a, const std::vector<double>& b) {
+            double sum = 0.0;
+            for (size_t i = 0; i < a.size() && i < b.size(); ++i) {
+                sum += (a[i] - b[i]) * (a[i] - b[i]);
+            }
+            return sum;
+        }
+
+        std::string shellQuote(const std::string& text) {
+            return "\"" + text + "\"";
+        }
+
+    } // namespace
+
+    // ==================== ParameterDefinition ====================
+
+    size_t ParameterDefinition::levelCount() const {
+        if (!values.empty()) return values.size();
+        return static_cast<size_t>(std::max(levels, 1));
+    }
+
+    nlohmann::json ParameterDefinition::valueAt(double unit) const {
+        unit = std::clamp(unit, 0.0, 1.0);
+        nlohmann::json value;
+        if (!values.empty()) {
+            const size_t index = std::min(static_cast<size_t>(unit * values.size()), values.size() - 1);
+            value = values[index];
+        } else {
+            double number = min_value + (max_value - min_value) * unit;
+            if (integer) {
+                value = static_cast<int64_t>(std::llround(number));
+            } else {
+                value = number;
+            }
+        }
+        if (value_template.empty()) return value;
+
+        std::string text = value_template;
+        const std::string replacement = value.is_string() ? value.get<std::string>()
+                                      : value.is_number_integer() ? std::to_string(value.get<int64_t>())
+                                      : formatNumber(value.get<double>());
+        for (size_t pos = text.find("{value}"); pos != std::string::npos; pos = text.find("{value}", pos + replacement.size())) {
+            text.replace(pos, 7, replacement);
+        }
+        return text;
+    }
+
+    // ==================== SweepDefinition ====================
+
+    bool SweepDefinition::load(const std::string& file_path, SweepDefinition& definition, std::string& error) {
+        nlohmann::json document;
+        if (!readJsonFile(file_path, document, error)) return false;
+
+        const fs::path base = fs::absolute(fs::path(file_path)).parent_path();
+        try {
+            definition = SweepDefinition();
+            definition.scenario_directory = resolvePath(base, document.value("scenario_directory", std::string()));
+            definition.executable = resolvePath(base, document.value("executable", std::string()));
+            definition.output_directory = resolvePath(base, document.value("output_directory", std::string("sweep_output")));
+            const std::string environment_directory = document.value("environment_directory", std::string());
+            definition.environment_directory = environment_directory.empty()
+                ? resolvePath(fs::path(definition.scenario_directory), "../../src/C_EnvirnomentAgentModel")
+                : resolvePath(base, environment_directory);
+            definition.method = parseMethod(document.value("method", std::string("latin_hypercube")));
+            definition.sample_count = document.value("samples", static_cast<size_t>(16));
+            definition.seed = document.value("seed", static_cast<uint64_t>(1));
+            definition.parallel_runs = std::max(1, document.value("parallel_runs", 1));
+
+            for (const auto& item : document.at("parameters")) {
+                ParameterDefinition parameter;
+                parameter.name = item.at("name").get<std::string>();
+                parameter.target = parseTarget(item.value("file", std::string("simulation")));
+                parameter.json_pointer = item.at("path").get<std::string>();
+                parameter.min_value = item.value("min", 0.0);
+                parameter.max_value = item.value("max", 1.0);
+                parameter.levels = item.value("levels", 3);
+                parameter.integer = item.value("integer", false);
+                parameter.value_template = item.value("template", std::string());
+                if (item.contains("values")) {
+                    for (const auto& value : item.at("values")) parameter.values.push_back(value);
+                }
+                definition.parameters.push_back(parameter);
+            }
+
+            if (document.contains("outcome")) {
+                const auto& outcome = document.at("outcome");
+                definition.outcome.enabled = true;
+                definition.outcome.file = outcome.value("file", definition.outcome.file);
+                definition.outcome.column = outcome.value("column", definition.outcome.column);
+                definition.outcome.reduce = outcome.value("reduce", definition.outcome.reduce);
+                definition.outcome.threshold = outcome.value("threshold", 0.0);
+                definition.outcome.pass_if_below = outcome.value("pass_if", std::string("below")) != "above";
+            }
+            if (document.contains("adaptive_refinement")) {
+                const auto& refinement = document.at("adaptive_refinement");
+                definition.refinement_rounds = refinement.value("rounds", 0);
+                definition.refinement_samples = refinement.value("samples_per_round", static_cast<size_t>(8));
+            }
+        } catch (const std::exception& e) {
+            error = "扫描定义字段错误: " + std::string(e.what());
+            return false;
+        }
+
+        if (definition.parameters.empty()) {
+            error = "扫描定义中没有参数";
+            return false;
+        }
+        if (definition.method == SweepMethod::Sobol && definition.parameters.size() > SobolSequence::MAX_DIMENSIONS) {
+            error = "Sobol序列最多支持 " + std::to_string(SobolSequence::MAX_DIMENSIONS) + " 个参数";
+            return false;
+        }
+        if (definition.refinement_rounds > 0 && !definition.outcome.enabled) {
+            error = "自适应加密需要配置 outcome 判据";
+            return false;
+        }
+        return true;
+    }
+
+    // ==================== SobolSequence ====================
+
+    SobolSequence::SobolSequence(size_t dimension_count)
+        : dimensions(std::min(dimension_count, MAX_DIMENSIONS)), index(0),
+          direction(dimensions, std::vector<uint32_t>(SOBOL_BITS + 1, 0)), state(dimensions, 0) {
+        for (size_t d = 0; d < dimensions; ++d) {
+            auto& v = direction[d];
+            if (d == 0) {
+                for (uint32_t k = 1; k <= SOBOL_BITS; ++k) v[k] = 1u << (SOBOL_BITS - k);
+                continue;
+            }
+            const SobolPolynomial& poly = SOBOL_POLYNOMIALS[d - 1];
+            const uint32_t s = poly.degree;
+            for (uint32_t k = 1; k <= s; ++k) v[k] = poly.initial[k - 1] << (SOBOL_BITS - k);
+            for (uint32_t k = s + 1; k <= SOBOL_BITS; ++k) {
+                v[k] = v[k - s] ^ (v[k - s] >> s);
+                for (uint32_t i = 1; i < s; ++i) {
+                    if ((poly.coefficients >> (s - 1 - i)) & 1u) v[k] ^= v[k - i];
+                }
+            }
+        }
+    }
+
+    std::vector<double> SobolSequence::next() {
+        // Gray码递推：翻转 index 最低位0所在的方向数
+        uint32_t c = 1;
+        for (uint32_t value = index; value & 1u; value >>= 1) ++c;
+        ++index;
+        std::vector<double> point(dimensions);
+        for (size_t d = 0; d < dimensions; ++d) {
+            state[d] ^= direction[d][c];
+            point[d] = static_cast<double>(state[d]) / 4294967296.0;
+        }
+        return point;
+    }
+
+    // ==================== 样本生成 ====================
+
+    std::vector<std::vector<double>> generateFullFactorial(const std::vector<ParameterDefinition>& parameters) {
+        std::vector<std::vector<double>> samples;
+        if (parameters.empty()) return samples;
+
+        std::vector<size_t> counters(parameters.size(), 0);
+        while (true) {
+            std::vector<double> point(parameters.size());
+            for (size_t d = 0; d < parameters.size(); ++d) {
+                const size_t levels = parameters[d].levelCount();
+                if (!parameters[d].values.empty()) {
+                    point[d] = (counters[d] + 0.5) / static_cast<double>(levels);   // 离散值取各区间中点
+                } else {
+                    point[d] = levels > 1 ? static_cast<double>(counters[d]) / static_cast<double>(levels - 1) : 0.5;
+                }
+            }
+            samples.push_back(point);
+
+            size_t d = 0;
+            while (d < parameters.size() && ++counters[d] == parameters[d].levelCount()) {
+                counters[d] = 0;
+                ++d;
+            }
+            if (d == parameters.size()) break;
+        }
+        return samples;
+    }
+
+    std::vector<std::vector<double>> generateLatinHypercube(size_t dimensions, size_t count, uint64_t seed) {
+        std::vector<std::vector<double>> samples(count, std::vector<double>(dimensions));
+        if (count == 0) return samples;
+
+        // 复用计数器型随机流：同一种子的设计逐位可复现
+        VFT_SMF::SimManage::RandomStream stream(seed, VFT_SMF::SimManage::RandomService::hashName("parameter_sweep"),
+                                                VFT_SMF::SimManage::RandomService::hashName("latin_hypercube"));
+        uint32_t draw = 0;
+        for (size_t d = 0; d < dimensions; ++d) {
+            std::vector<size_t> strata(count);
+            std::iota(strata.begin(), strata.end(), 0);
+            for (size_t i = count - 1; i > 0; --i) {
+                const size_t j = std::min(static_cast<size_t>(stream.uniformAt(d, draw++) * (i + 1)), i);
+                std::swap(strata[i], strata[j]);
+            }
+            for (size_t i = 0; i < count; ++i) {
+                const double jitter = 1.0 - stream.uniformAt(d, draw++);   // [0, 1)
+                samples[i][d] = (static_cast<double>(strata[i]) + jitter) / static_cast<double>(count);
+            }
+        }
+        return samples;
+    }
+
+    std::vector<std::vector<double>> generateSobol(size_t dimensions, size_t count) {
+        SobolSequence sequence(dimensions);
+        std::vector<std::vector<double>> samples;
+        samples.reserve(count);
+        for (size_t i = 0; i < count; ++i) samples.push_back(sequence.next());
+        return samples;
+    }
+
+    std::vector<std::vector<double>> refineBoundary(const std::vector<SampleResult>& results, size_t max_new) {
+        struct Candidate {
+            double distance;
+            std::vector<double> point;
+        };
+        std::vector<const SampleResult*> passed, failed;
+        for (const auto& result : results) {
+            if (!result.has_outcome) continue;
+            (result.passed ? passed : failed).push_back(&result);
+        }
+
+        std::vector<Candidate> candidates;
+        for (const SampleResult* fail : failed) {
+            const SampleResult* nearest = nullptr;
+            double best = std::numeric_limits<double>::infinity();
+            for (const SampleResult* pass : passed) {
+                const double distance = squaredDistance(fail->point.unit, pass->point.unit);
+                if (distance < best) {
+                    best = distance;
+                    nearest = pass;
+                }
+            }
+            if (!nearest) continue;
+            std::vector<double> midpoint(fail->point.unit.size());
+            for (size_t d = 0; d < midpoint.size(); ++d) {
+                midpoint[d] = 0.5 * (fail->point.unit[d] + nearest->point.unit[d]);
+            }
+            candidates.push_back({best, midpoint});
+        }
+        std::sort(candidates.begin(), candidates.end(),
+                  [](const Candidate& a, const Candidate& b) { return a.distance < b.distance; });
+
+        std::vector<std::vector<double>> refined;
+        auto already_sampled = [&](const std::vector<double>& point) {
+            for (const auto& result : results) {
+                if (squaredDistance(result.point.unit, point) < 1e-18) return true;
+            }
+            for (const auto& existing : refined) {
+                if (squaredDistance(existing, point) < 1e-18) return true;
+            }
+            return false;
+        };
+        for (const auto& candidate : candidates) {
+            if (refined.size() >= max_new) break;
+            if (!already_sampled(candidate.point)) refined.push_back(candidate.point);
+        }
+        return refined;
+    }
+
+    // ==================== 运行目录与结果 ====================
+
+    bool prepareRunDirectory(const SweepDefinition& definition, const SamplePoint& point,
+                             const std::string& run_directory, std::string& error) {
+        const fs::path run_dir(run_directory);
+        const fs::path scenario_dir(definition.scenario_directory);
+        std::error_code ec;
+        fs::remove_all(run_dir, ec);
+        fs::create_directories(run_dir / "config", ec);
+        fs::create_directories(run_dir / "input", ec);
+        fs::create_directories(run_dir / "output", ec);
+        if (ec) {
+            error = "创建运行目录失败: " + run_dir.string();
+            return false;
+        }
+
+        nlohmann::json simulation_config, flight_plan, environment_config;
+        if (!readJsonFile(scenario_dir / "config" / "SimulationConfig.json", simulation_config, error)) return false;
+        if (!readJsonFile(scenario_dir / "input" / "FlightPlan.json", flight_plan, error)) return false;
+
+        std::string environment_name = "PEK_Runway_02";
+        const nlohmann::json::json_pointer environment_name_pointer("/flight_plan/scenario_config/Environment_Name");
+        if (flight_plan.contains(environment_name_pointer)) {
+            environment_name = flight_plan[environment_name_pointer].get<std::string>();
+        }
+        const fs::path environment_source = fs::path(definition.environment_directory) / environment_name / "DataTwin" / "environment_config.json";
+        if (!readJsonFile(environment_source, environment_config, error)) return false;
+
+        // 写入参数值（环境模型名称可能被扫描参数改写，故先应用飞行计划参数再定位环境配置）
+        for (size_t d = 0; d < definition.parameters.size() && d < point.unit.size(); ++d) {
+            const auto& parameter = definition.parameters[d];
+            nlohmann::json& document = parameter.target == ConfigTarget::FlightPlan ? flight_plan
+                                     : parameter.target == ConfigTarget::Environment ? environment_config
+                                     : simulation_config;
+            try {
+                document[nlohmann::json::json_pointer(parameter.json_pointer)] = parameter.valueAt(point.unit[d]);
+            } catch (const std::exception& e) {
+                error = "参数 " + parameter.name + " 的路径无效: " + parameter.json_pointer + "，" + e.what();
+                return false;
+            }
+        }
+        if (flight_plan.contains(environment_name_pointer) &&
+            flight_plan[environment_name_pointer].get<std::string>() != environment_name) {
+            environment_name = flight_plan[environment_name_pointer].get<std::string>();
+            nlohmann::json switched;
+            if (!readJsonFile(fs::path(definition.environment_directory) / environment_name / "DataTwin" / "environment_config.json",
+                              switched, error)) return false;
+            for (size_t d = 0; d < definition.parameters.size() && d < point.unit.size(); ++d) {
+                const auto& parameter = definition.parameters[d];
+                if (parameter.target != ConfigTarget::Environment) continue;
+                switched[nlohmann::json::json_pointer(parameter.json_pointer)] = parameter.valueAt(point.unit[d]);
+            }
+            environment_config = switched;
+        }
+
+        // 环境配置使用运行目录内的副本，避免并行运行互相覆盖
+        flight_plan["flight_plan"]["scenario_config"]["Environment_Config_Directory"] = "environment/";
+        const fs::path environment_target = run_dir / "environment" / environment_name / "DataTwin";
+        fs::create_directories(environment_target, ec);
+
+        if (!writeJsonFile(run_dir / "config" / "SimulationConfig.json", simulation_config) ||
+            !writeJsonFile(run_dir / "input" / "FlightPlan.json", flight_plan) ||
+            !writeJsonFile(environment_target / "environment_config.json", environment_config)) {
+            error = "写入运行配置失败: " + run_dir.string();
+            return false;
+        }
+        return true;
+    }
+
+    bool readOutcome(const std::string& run_directory, const OutcomeDefinition& outcome, double& value) {
+        std::ifstream file(fs::path(run_directory) / outcome.file);
+        if (!file.is_open()) return false;
+
+        // 记录器输出为定宽文本，左右对齐因模块而异，列宽溢出时仍以空格分隔且字段内不含空格：
+        // 按空白切分，以结果列在表头中的序号取值
+        std::string header;
+        if (!std::getline(file, header)) return false;
+        std::istringstream header_fields(header);
+        size_t column_index = 0;
+        bool has_column = false;
+        for (std::string name; header_fields >> name; ++column_index) {
+            if (name == outcome.column) {
+                has_column = true;
+                break;
+            }
+        }
+        if (!has_column) return false;
+
+        bool found = false;
+        std::string line;
+        while (std::getline(file, line)) {
+            std::istringstream fields(line);
+            std::string field;
+            size_t index = 0;
+            while (index <= column_index && fields >> field) ++index;
+            if (index <= column_index) continue;   // 行内字段不足
+            char* parse_end = nullptr;
+            const double sample = std::strtod(field.c_str(), &parse_end);
+            if (parse_end == field.c_str()) continue;
+            if (!found || outcome.reduce == "final") {
+                value = sample;
+            } else if (outcome.reduce == "max") {
+                value = std::max(value, sample);
+            } else if (outcome.reduce == "min") {
+                value = std::min(value, sample);
+            }
+            found = true;
+        }
+        return found;
+    }
+
+    // ==================== SweepRunner ====================
+
+    std::vector<std::vector<double>> SweepRunner::initialDesign() const {
+        switch (definition.method) {
+            case SweepMethod::FullFactorial:
+                return generateFullFactorial(definition.parameters);
+            case SweepMethod::Sobol:
+                return generateSobol(definition.parameters.size(), definition.sample_count);
+            case SweepMethod::LatinHypercube:
+            default:
+                return generateLatinHypercube(definition.parameters.size(), definition.sample_count, definition.seed);
+        }
+    }
+
+    std::string SweepRunner::runDirectory(uint32_t sample_id) const {
+        std::ostringstream oss;
+        oss << "run_" << std::setw(5) << std::setfill('0') << sample_id;
+        return (fs::path(definition.output_directory) / oss.str()).string();
+    }
+
+    void SweepRunner::executeBatch(std::vector<SampleResult>& batch, bool dry_run, size_t completed_before,
+                                   size_t total, const ProgressCallback& progress) const {
+        std::atomic<size_t> next_index{0};
+        std::atomic<size_t> completed{completed_before};
+        std::mutex progress_mutex;
+
+        auto worker = [&]() {
+            for (size_t i = next_index++; i < batch.size(); i = next_index++) {
+                SampleResult& result = batch[i];
+                const std::string run_dir = runDirectory(result.point.id);
+                std::string error;
+                if (!prepareRunDirectory(definition, result.point, run_dir, error)) {
+                    std::ofstream(fs::path(run_dir) / "sweep_error.log") << error << "\n";
+                    result.exit_code = -1;
+                } else if (dry_run) {
+                    result.exit_code = 0;
+                } else {
+#ifdef _WIN32
+                    const std::string command = "cd /d " + shellQuote(run_dir) + " && " + shellQuote(definition.executable) + " > run.log 2>&1";
+                    result.exit_code = std::system(("\"" + command + "\"").c_str());
+#else
+                    const std::string command = "cd " + shellQuote(run_dir) + " && " + shellQuote(definition.executable) + " > run.log 2>&1";
+                    result.exit_code = std::system(command.c_str());
+#endif
+                    if (result.exit_code == 0 && definition.outcome.enabled) {
+                        result.has_outcome = readOutcome(run_dir, definition.outcome, result.outcome);
+                        if (result.has_outcome) {
+                            result.passed = definition.outcome.pass_if_below ? result.outcome < definition.outcome.threshold
+                                                                             : result.outcome > definition.outcome.threshold;
+                        }
+                    }
+                }
+                const size_t done = ++completed;
+                if (progress) {
+                    std::lock_guard<std::mutex> lock(progress_mutex);
+                    progress(result, done, total);
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        const int worker_count = std::min<int>(definition.parallel_runs, static_cast<int>(batch.size()));
+        for (int i = 0; i < worker_count; ++i) workers.emplace_back(worker);
+        for (auto& thread : workers) thread.join();
+    }
+
+    std::vector<SampleResult> SweepRunner::run(bool dry_run, ProgressCallback progress) {
+        fs::create_directories(definition.output_directory);
+        std::vector<SampleResult> results;
+        uint32_t next_id = 0;
+
+        auto make_batch = [&](const std::vector<std::vector<double>>& points, int round) {
+            std::vector<SampleResult> batch;
+            for (const auto& unit : points) {
+                SampleResult result;
+                result.point.id = next_id++;
+                result.point.round = round;
+                result.point.unit = unit;
+                batch.push_back(result);
+            }
+            return batch;
+        };
+
+        auto batch = make_batch(initialDesign(), 0);
+        size_t planned = batch.size() + (dry_run ? 0 : definition.refinement_rounds * definition.refinement_samples);
+        executeBatch(batch, dry_run, 0, planned, progress);
+        results.insert(results.end(), batch.begin(), batch.end());
+
+        for (int round = 1; round <= definition.refinement_rounds && !dry_run; ++round) {
+            auto refined = refineBoundary(results, definition.refinement_samples);
+            if (refined.empty()) break;
+            batch = make_batch(refined, round);
+            executeBatch(batch, dry_run, results.size(), planned, progress);
+            results.insert(results.end(), batch.begin(), batch.end());
+        }
+
+        writeResults(results);
+        return results;
+    }
+
+    bool SweepRunner::writeResults(const std::vector<SampleResult>& results) const {
+        std::ofstream file(fs::path(definition.output_directory) / "sweep_results.csv");
+        if (!file.is_open()) return false;
+        file << "run_id,round";
+        for (const auto& parameter : definition.parameters) file << ',' << parameter.name;
+        file << ",exit_code,outcome,passed\n";
+        for (const auto& result : results) {
+            file << result.point.id << ',' << result.point.round;
+            for (size_t d = 0; d < definition.parameters.size(); ++d) {
+                const nlohmann::json value = definition.parameters[d].valueAt(result.point.unit[d]);
+                file << ',' << (value.is_string() ? "\"" + value.get<std::string>() + "\"" : value.dump());
+            }
+            file << ',' << result.exit_code << ',';
+            if (result.has_outcome) file << std::setprecision(10) << result.outcome;
+            file << ',' << (result.has_outcome ? (result.passed ? "1" : "0") : "") << '\n';
+        }
+        return file.good();
+    }
+
+} // namespace ParameterSweep
+} // namespace VFT_SMF
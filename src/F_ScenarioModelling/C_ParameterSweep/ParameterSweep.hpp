@@ -0,0 +1,196 @@
+/**
+ * @file ParameterSweep.hpp
+ * @brief 场景配置参数扫描（试验设计）引擎
+ * @details 读取参数空间定义，把每个参数映射到场景配置文件中的某个字段
+ *          （SimulationConfig.json / FlightPlan.json / environment_config.json，以JSON指针定位），
+ *          生成全因子、拉丁超立方、Sobol序列样本，并可在结果的通过/不通过边界附近自适应加密。
+ *          每个样本生成独立的运行目录（配置副本 + 输出目录），由 SweepRunner 在一个扫描进程内
+ *          并行调度场景可执行文件，最后汇总为 sweep_results.csv。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#pragma once
+
+#include "../../I_ThirdPartyTools/json.hpp"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace VFT_SMF {
+namespace ParameterSweep {
+
+    /**
+     * @brief 采样方法
+     */
+    enum class SweepMethod {
+        FullFactorial,   ///< 全因子（每个参数取 levels 个水平）
+        LatinHypercube,  ///< 拉丁超立方
+        Sobol            ///< Sobol低差异序列
+    };
+
+    /**
+     * @brief 参数所修改的配置文件
+     */
+    enum class ConfigTarget {
+        Simulation,      ///< config/SimulationConfig.json
+        FlightPlan,      ///< input/FlightPlan.json
+        Environment      ///< 环境模型 DataTwin/environment_config.json
+    };
+
+    /**
+     * @brief 单个扫描参数
+     */
+    struct ParameterDefinition {
+        std::string name;
+        ConfigTarget target = ConfigTarget::Simulation;
+        std::string json_pointer;                ///< 目标字段，如 "/wind_data/wind_speed"
+        double min_value = 0.0;
+        double max_value = 1.0;
+        int levels = 3;                          ///< 全因子水平数
+        bool integer = false;                    ///< 取整后写入
+        std::vector<nlohmann::json> values;      ///< 离散取值（非空时忽略 min/max）
+        std::string value_template;              ///< 非空时以 "{value}" 替换后写入字符串
+
+        /**
+         * @brief 由 [0, 1] 单位坐标得到写入配置的值
+         */
+        nlohmann::json valueAt(double unit) const;
+
+        /**
+         * @brief 全因子设计下该参数的水平数
+         */
+        size_t levelCount() const;
+    };
+
+    /**
+     * @brief 运行结果判据：从记录器文件取某列的统计值，与阈值比较
+     */
+    struct OutcomeDefinition {
+        bool enabled = false;
+        std::string file = "output/aircraft_flight_state.csv";   ///< 相对运行目录
+        std::string column = "distance_m";
+        std::string reduce = "final";            ///< "final" / "max" / "min"
+        double threshold = 0.0;
+        bool pass_if_below = true;               ///< 值低于阈值为通过（如"在跑道端前停住"）
+    };
+
+    /**
+     * @brief 扫描定义
+     */
+    struct SweepDefinition {
+        std::string scenario_directory;          ///< 基准场景目录（含 config/ 与 input/）
+        std::string environment_directory;       ///< 环境模型配置根目录
+        std::string executable;                  ///< 场景可执行文件
+        std::string output_directory = "sweep_output";
+        SweepMethod method = SweepMethod::LatinHypercube;
+        size_t sample_count = 16;                ///< 拉丁超立方 / Sobol 样本数
+        uint64_t seed = 1;
+        int parallel_runs = 1;
+        std::vector<ParameterDefinition> parameters;
+        OutcomeDefinition outcome;
+        int refinement_rounds = 0;               ///< 自适应加密轮数（需启用 outcome）
+        size_t refinement_samples = 8;           ///< 每轮新增样本上限
+
+        /**
+         * @brief 从JSON文件加载，相对路径以该文件所在目录为基准
+         */
+        static bool load(const std::string& file_path, SweepDefinition& definition, std::string& error);
+    };
+
+    /**
+     * @brief 样本点（单位超立方体坐标）
+     */
+    struct SamplePoint {
+        uint32_t id = 0;
+        int round = 0;                           ///< 0 为初始设计，>0 为加密轮次
+        std::vector<double> unit;
+    };
+
+    /**
+     * @brief 单次运行结果
+     */
+    struct SampleResult {
+        SamplePoint point;
+        int exit_code = -1;
+        bool has_outcome = false;
+        double outcome = 0.0;
+        bool passed = false;
+    };
+
+    /**
+     * @brief Sobol序列生成器（Joe-Kuo方向数，Gray码递推，跳过原点）
+     */
+    class SobolSequence {
+    public:
+        static constexpr size_t MAX_DIMENSIONS = 12;
+
+        explicit SobolSequence(size_t dimensions);
+        std::vector<double> next();
+
+    private:
+        size_t dimensions;
+        uint32_t index;
+        std::vector<std::vector<uint32_t>> direction;   ///< [维度][位]
+        std::vector<uint32_t> state;
+    };
+
+    // ==================== 样本生成 ====================
+
+    std::vector<std::vector<double>> generateFullFactorial(const std::vector<ParameterDefinition>& parameters);
+    std::vector<std::vector<double>> generateLatinHypercube(size_t dimensions, size_t count, uint64_t seed);
+    std::vector<std::vector<double>> generateSobol(size_t dimensions, size_t count);
+
+    /**
+     * @brief 边界自适应加密：取每个不通过样本与其最近的通过样本的中点，按间距由小到大选取
+     * @param results 已完成的运行结果
+     * @param max_new 新增样本上限
+     */
+    std::vector<std::vector<double>> refineBoundary(const std::vector<SampleResult>& results, size_t max_new);
+
+    // ==================== 运行目录与结果 ====================
+
+    /**
+     * @brief 生成样本的运行目录：复制场景配置与环境配置，写入参数值
+     */
+    bool prepareRunDirectory(const SweepDefinition& definition, const SamplePoint& point,
+                             const std::string& run_directory, std::string& error);
+
+    /**
+     * @brief 从定宽记录器文件读取结果列（按空白切分，以表头中的列序号取值）并按 reduce 规约
+     */
+    bool readOutcome(const std::string& run_directory, const OutcomeDefinition& outcome, double& value);
+
+    /**
+     * @brief 扫描执行器
+     */
+    class SweepRunner {
+    public:
+        using ProgressCallback = std::function<void(const SampleResult&, size_t completed, size_t total)>;
+
+        explicit SweepRunner(SweepDefinition sweep_definition) : definition(std::move(sweep_definition)) {}
+
+        /**
+         * @brief 执行完整扫描（初始设计 + 自适应加密），结果写入 <output_directory>/sweep_results.csv
+         * @param dry_run 只生成运行目录不执行
+         */
+        std::vector<SampleResult> run(bool dry_run = false, ProgressCallback progress = nullptr);
+
+        /**
+         * @brief 生成初始设计
+         */
+        std::vector<std::vector<double>> initialDesign() const;
+
+        std::string runDirectory(uint32_t sample_id) const;
+
+    private:
+        SweepDefinition definition;
+
+        void executeBatch(std::vector<SampleResult>& batch, bool dry_run, size_t completed_before,
+                          size_t total, const ProgressCallback& progress) const;
+        bool writeResults(const std::vector<SampleResult>& results) const;
+    };
+
+} // namespace ParameterSweep
+} // namespace VFT_SMF
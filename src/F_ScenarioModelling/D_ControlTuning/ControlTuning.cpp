@@ -0,0 +1,377 @@
+/**
+ * @file ControlTuning.cpp
+ * @brief 自动飞行控制律PID增益离线整定实现
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include "ControlTuning.hpp"
+#include "../C_ParameterSweep/ParameterSweep.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+namespace VFT_SMF {
+namespace ControlTuning {
+
+    using namespace SMF::AircraftDigitalTwin::B737;
+
+    namespace {
+
+        using FlightDynamics::LinearModel;
+        using GlobalSharedDataStruct::AircraftFlightState;
+
+        // 操纵量限幅（与配平求解器一致）：油门、升降舵、副翼、方向舵
+        const double INPUT_MIN[LinearModel::INPUT_COUNT] = {0.0, -25.0, -20.0, -25.0};
+        const double INPUT_MAX[LinearModel::INPUT_COUNT] = {1.0, 25.0, 20.0, 25.0};
+
+        // 归一化响应偏离目标超过此倍数视为发散
+        const double DIVERGENCE_LIMIT = 10.0;
+
+        double wrapAngle(double angle) {
+            while (angle > 180.0) angle -= 360.0;
+            while (angle < -180.0) angle += 360.0;
+            return angle;
+        }
+
+        FlightParameters toFlightParameters(const AircraftFlightState& state) {
+            FlightParameters params;
+            params.latitude = state.latitude;
+            params.longitude = state.longitude;
+            params.altitude = state.altitude;
+            params.heading = state.heading;
+            params.airspeed = state.airspeed;
+            params.groundspeed = state.groundspeed;
+            params.vertical_speed = state.vertical_speed;
+            params.roll_angle = state.roll;
+            params.pitch_angle = state.pitch;
+            params.yaw_angle = state.heading;
+            params.roll_rate = state.roll_rate;
+            params.pitch_rate = state.pitch_rate;
+            params.yaw_rate = state.yaw_rate;
+            return params;
+        }
+
+        void applyLinearState(const std::vector<double>& x, AircraftFlightState& state) {
+            state.airspeed = x[LinearModel::AIRSPEED];
+            state.groundspeed = x[LinearModel::AIRSPEED];
+            state.vertical_speed = x[LinearModel::VERTICAL_SPEED];
+            state.altitude = x[LinearModel::ALTITUDE];
+            state.roll = x[LinearModel::ROLL];
+            state.pitch = x[LinearModel::PITCH];
+            state.heading = x[LinearModel::HEADING];
+            state.roll_rate = x[LinearModel::ROLL_RATE];
+            state.pitch_rate = x[LinearModel::PITCH_RATE];
+            state.yaw_rate = x[LinearModel::YAW_RATE];
+        }
+
+        /**
+         * @brief 回路输出（回路单位）
+         */
+        double loopOutput(TuningLoop loop, const AircraftFlightState& state) {
+            switch (loop) {
+                case TuningLoop::Autothrottle: return state.airspeed;
+                case TuningLoop::AltitudeHold: return state.altitude;
+                case TuningLoop::HeadingHold:  return state.heading;
+                case TuningLoop::YawDamper:    return state.yaw_rate;
+            }
+            return 0.0;
+        }
+
+        size_t loopInput(TuningLoop loop) {
+            switch (loop) {
+                case TuningLoop::Autothrottle: return LinearModel::THROTTLE;
+                case TuningLoop::AltitudeHold: return LinearModel::ELEVATOR;
+                case TuningLoop::HeadingHold:  return LinearModel::AILERON;
+                case TuningLoop::YawDamper:    return LinearModel::RUDDER;
+            }
+            return LinearModel::THROTTLE;
+        }
+
+        PidGains gainsOf(const PIDController& controller) {
+            return {controller.kp, controller.ki, controller.kd};
+        }
+
+    } // namespace
+
+    bool parseTuningLoop(const std::string& name, TuningLoop& loop) {
+        if (name == "autothrottle") loop = TuningLoop::Autothrottle;
+        else if (name == "altitude_hold") loop = TuningLoop::AltitudeHold;
+        else if (name == "heading_hold") loop = TuningLoop::HeadingHold;
+        else if (name == "yaw_damper") loop = TuningLoop::YawDamper;
+        else return false;
+        return true;
+    }
+
+    std::string tuningLoopName(TuningLoop loop) {
+        switch (loop) {
+            case TuningLoop::Autothrottle: return "autothrottle";
+            case TuningLoop::AltitudeHold: return "altitude_hold";
+            case TuningLoop::HeadingHold:  return "heading_hold";
+            case TuningLoop::YawDamper:    return "yaw_damper";
+        }
+        return "unknown";
+    }
+
+    // ==================== StepResponseEvaluator ====================
+
+    StepResponseEvaluator::StepResponseEvaluator(const TuningCase& definition) : tuning_case(definition) {
+        FlightDynamics::TrimSolver solver;
+        trim = solver.solve(tuning_case.operating_point);
+        if (trim.converged && tuning_case.plant == PlantModel::Linear) {
+            FlightDynamics::Linearizer linearizer;
+            surrogate = std::make_unique<FlightDynamics::LinearSurrogate>(linearizer.linearize(trim), tuning_case.time_step);
+        }
+    }
+
+    PidGains StepResponseEvaluator::defaultGains(TuningLoop loop) {
+        switch (loop) {
+            case TuningLoop::Autothrottle: return gainsOf(AutothrottleControlLaw().get_speed_controller());
+            case TuningLoop::AltitudeHold: return gainsOf(AutopilotControlLaw().get_pitch_controller());
+            case TuningLoop::HeadingHold:  return gainsOf(AutopilotControlLaw().get_roll_controller());
+            case TuningLoop::YawDamper:    return gainsOf(YawDamperControlLaw().get_yaw_rate_controller());
+        }
+        return PidGains();
+    }
+
+    StepResponseMetrics StepResponseEvaluator::evaluate(const PidGains& gains, std::vector<ResponseSample>* trace) const {
+        StepResponseMetrics metrics;
+        const TuningLoop loop = tuning_case.loop;
+        const double dt = tuning_case.time_step;
+        const int steps = static_cast<int>(std::round(tuning_case.duration / dt));
+        metrics.rise_time = metrics.settling_time = metrics.diverged_at = steps * dt;
+        if (!trim.converged || tuning_case.step == 0.0) return metrics;
+
+        // 控制律与目标
+        AutothrottleControlLaw autothrottle;
+        AutopilotControlLaw autopilot;
+        YawDamperControlLaw yaw_damper;
+        TargetParameters target;
+        target.target_airspeed = trim.flight_state.airspeed;
+        target.target_altitude = trim.flight_state.altitude;
+        target.target_heading = trim.flight_state.heading;
+        switch (loop) {
+            case TuningLoop::Autothrottle:
+                autothrottle.set_speed_gains(gains.kp, gains.ki, gains.kd);
+                autothrottle.engage(FlightMode::AUTOTHROTTLE_SPEED);
+                target.target_airspeed += tuning_case.step;
+                break;
+            case TuningLoop::AltitudeHold:
+                autopilot.set_pitch_gains(gains.kp, gains.ki, gains.kd);
+                autopilot.engage(FlightMode::AUTOPILOT_ALT_HOLD);
+                target.target_altitude += tuning_case.step;
+                break;
+            case TuningLoop::HeadingHold:
+                autopilot.set_roll_gains(gains.kp, gains.ki, gains.kd);
+                autopilot.engage(FlightMode::AUTOPILOT_HDG);
+                target.target_heading = std::fmod(target.target_heading + tuning_case.step + 360.0, 360.0);
+                break;
+            case TuningLoop::YawDamper:
+                yaw_damper.set_gains(gains.kp, gains.ki, gains.kd);
+                yaw_damper.activate();
+                break;
+        }
+
+        // 初始状态：偏航阻尼器以初始偏航角速度扰动代替阶跃
+        AircraftFlightState state = trim.flight_state;
+        if (loop == TuningLoop::YawDamper) state.yaw_rate += tuning_case.step;
+        const double target_change = (loop == TuningLoop::YawDamper) ? -tuning_case.step : tuning_case.step;
+
+        std::unique_ptr<FlightDynamics::FlightDynamicsAgent> agent;
+        std::unique_ptr<FlightDynamics::LinearSurrogate> linear;
+        if (tuning_case.plant == PlantModel::Linear) {
+            linear = std::make_unique<FlightDynamics::LinearSurrogate>(*surrogate);
+            linear->setState(FlightDynamics::Linearizer::stateFromFlightState(state));
+        } else {
+            agent = std::make_unique<FlightDynamics::FlightDynamicsAgent>("B737");
+            agent->initialize(state);
+        }
+
+        GlobalSharedDataStruct::AircraftSystemState system_state = trim.system_state;
+        std::vector<double> input = FlightDynamics::Linearizer::inputFromSystemState(trim.system_state);
+        const size_t channel = loopInput(loop);
+        const double base_input = input[channel];
+        const double initial_output = loopOutput(loop, state);
+
+        double peak = 0.0;
+        double last_outside = 0.0;
+        double effort_squared = 0.0;
+        double integral_error = 0.0;
+        double normalized = 0.0;
+        bool rose = false;
+        int step = 0;
+        metrics.stable = true;
+        for (; step < steps; ++step) {
+            const FlightParameters params = toFlightParameters(state);
+            double command = 0.0;
+            switch (loop) {
+                case TuningLoop::Autothrottle: command = autothrottle.calculate_throttle_command(params, target, dt); break;
+                case TuningLoop::AltitudeHold: command = autopilot.calculate_pitch_command(params, target, dt); break;
+                case TuningLoop::HeadingHold:  command = autopilot.calculate_roll_command(params, target, dt); break;
+                case TuningLoop::YawDamper:    command = yaw_damper.calculate_yaw_damper_command(params, dt); break;
+            }
+            input[channel] = std::max(INPUT_MIN[channel], std::min(INPUT_MAX[channel], base_input + command));
+            const double applied = input[channel] - base_input;
+
+            if (linear) {
+                applyLinearState(linear->step(input), state);
+            } else {
+                system_state.current_throttle_position = input[LinearModel::THROTTLE];
+                system_state.current_elevator_deflection = input[LinearModel::ELEVATOR];
+                system_state.current_aileron_deflection = input[LinearModel::AILERON];
+                system_state.current_rudder_deflection = input[LinearModel::RUDDER];
+                state = agent->updateFromGlobalState(dt, system_state, trim.env_state);
+            }
+
+            const double time = (step + 1) * dt;
+            double change = loopOutput(loop, state) - initial_output;
+            if (loop == TuningLoop::HeadingHold) change = wrapAngle(change);
+            normalized = change / target_change;
+            effort_squared += applied * applied;
+            integral_error += std::abs(1.0 - normalized) * dt;
+
+            if (trace) trace->push_back({time, change, applied});
+
+            if (!std::isfinite(normalized) || std::abs(normalized - 1.0) > DIVERGENCE_LIMIT) {
+                metrics.stable = false;
+                metrics.diverged_at = time;
+                ++step;
+                break;
+            }
+            peak = std::max(peak, normalized);
+            if (!rose && normalized >= 0.9) {
+                rose = true;
+                metrics.rise_time = time;
+            }
+            if (std::abs(normalized - 1.0) > tuning_case.settling_band) last_outside = time;
+        }
+
+        metrics.overshoot = std::max(0.0, peak - 1.0) * 100.0;
+        metrics.settled = metrics.stable && std::abs(normalized - 1.0) <= tuning_case.settling_band;
+        metrics.settling_time = metrics.settled ? last_outside : steps * dt;
+        metrics.steady_state_error = std::abs((1.0 - normalized) * target_change);
+        metrics.control_effort = step > 0 ? std::sqrt(effort_squared / step) : 0.0;
+        metrics.integral_error = integral_error;
+        return metrics;
+    }
+
+    double StepResponseEvaluator::cost(const StepResponseMetrics& metrics) const {
+        const CostWeights& weights = tuning_case.weights;
+        if (!metrics.stable) {
+            return weights.unstable_penalty * (2.0 - metrics.diverged_at / tuning_case.duration);
+        }
+        return weights.settling_time * metrics.settling_time +
+               weights.overshoot * metrics.overshoot +
+               weights.integral_error * metrics.integral_error +
+               weights.steady_state_error * metrics.steady_state_error / std::abs(tuning_case.step) +
+               weights.control_effort * metrics.control_effort;
+    }
+
+    // ==================== GainTuner ====================
+
+    std::vector<double> GainTuner::evaluateBatch(const std::vector<PidGains>& candidates,
+                                                 std::vector<StepResponseMetrics>& metrics) const {
+        std::vector<double> costs(candidates.size(), 0.0);
+        metrics.assign(candidates.size(), StepResponseMetrics());
+
+        std::atomic<size_t> next_index{0};
+        auto worker = [&]() {
+            for (size_t i = next_index++; i < candidates.size(); i = next_index++) {
+                metrics[i] = evaluator.evaluate(candidates[i]);
+                costs[i] = evaluator.cost(metrics[i]);
+            }
+        };
+
+        int worker_count = options.parallel_workers > 0 ? options.parallel_workers
+                                                        : static_cast<int>(std::thread::hardware_concurrency());
+        worker_count = std::max(1, std::min<int>(worker_count, static_cast<int>(candidates.size())));
+        if (worker_count == 1) {
+            worker();
+            return costs;
+        }
+        std::vector<std::thread> workers;
+        for (int i = 0; i < worker_count; ++i) workers.emplace_back(worker);
+        for (auto& thread : workers) thread.join();
+        return costs;
+    }
+
+    TuningResult GainTuner::tune(const PidGains& initial, ProgressCallback progress) const {
+        const auto start = std::chrono::steady_clock::now();
+        const double lower = std::log10(options.min_gain);
+        const double upper = std::log10(options.max_gain);
+
+        // log10 空间；下限处的增益视为0，便于搜索关掉积分或微分项
+        auto toLog = [&](double gain) { return gain <= options.min_gain ? lower : std::min(upper, std::log10(gain)); };
+        auto fromLog = [&](double value) { return value <= lower ? 0.0 : std::pow(10.0, value); };
+        auto toGains = [&](const std::array<double, 3>& x) { return PidGains{fromLog(x[0]), fromLog(x[1]), fromLog(x[2])}; };
+
+        TuningResult result;
+        result.initial_gains = initial;
+        std::array<double, 3> current = {toLog(initial.kp), toLog(initial.ki), toLog(initial.kd)};
+
+        std::vector<StepResponseMetrics> metrics;
+        const auto initial_cost = evaluateBatch({initial}, metrics);
+        result.initial_metrics = result.best_metrics = metrics[0];
+        result.initial_cost = result.best_cost = initial_cost[0];
+        result.best_gains = initial;
+        result.evaluations = 1;
+
+        // 全局筛选：Sobol样本覆盖整个增益范围，避开起点附近的平坦区（如极限环）
+        if (options.initial_samples > 0) {
+            std::vector<std::array<double, 3>> points;
+            std::vector<PidGains> candidates;
+            for (const auto& unit : ParameterSweep::generateSobol(3, options.initial_samples)) {
+                points.push_back({lower + unit[0] * (upper - lower), lower + unit[1] * (upper - lower), lower + unit[2] * (upper - lower)});
+                candidates.push_back(toGains(points.back()));
+            }
+            const auto costs = evaluateBatch(candidates, metrics);
+            result.evaluations += candidates.size();
+            const size_t best = std::min_element(costs.begin(), costs.end()) - costs.begin();
+            if (costs[best] < result.best_cost) {
+                current = points[best];
+                result.best_cost = costs[best];
+                result.best_gains = candidates[best];
+                result.best_metrics = metrics[best];
+            }
+        }
+
+        double step = options.initial_step;
+        int iteration = 0;
+        for (; iteration < options.max_iterations && step >= options.min_step; ++iteration) {
+            // 每个坐标 ±step 的探测点
+            std::vector<std::array<double, 3>> points;
+            for (size_t axis = 0; axis < current.size(); ++axis) {
+                for (double direction : {1.0, -1.0}) {
+                    std::array<double, 3> point = current;
+                    point[axis] = std::max(lower, std::min(upper, point[axis] + direction * step));
+                    if (point[axis] != current[axis]) points.push_back(point);
+                }
+            }
+            std::vector<PidGains> candidates;
+            for (const auto& point : points) candidates.push_back(toGains(point));
+
+            const auto costs = evaluateBatch(candidates, metrics);
+            result.evaluations += candidates.size();
+
+            const size_t best = std::min_element(costs.begin(), costs.end()) - costs.begin();
+            if (!costs.empty() && costs[best] < result.best_cost) {
+                current = points[best];
+                result.best_cost = costs[best];
+                result.best_gains = candidates[best];
+                result.best_metrics = metrics[best];
+            } else {
+                step *= 0.5;
+            }
+            if (progress) progress(iteration + 1, result.best_gains, result.best_cost, step);
+        }
+
+        result.iterations = iteration;
+        result.elapsed_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return result;
+    }
+
+} // namespace ControlTuning
+} // namespace VFT_SMF
@@ -0,0 +1,196 @@
+/**
+ * @file ControlTuning.hpp
+ * @brief 自动飞行控制律PID增益离线整定
+ * @details 把单个控制律（自动油门速度保持、自动驾驶高度保持/航向保持、偏航阻尼器）与飞行动力学
+ *          模型直接耦合，在单线程紧循环中推进阶跃响应，不经过仿真时钟、智能体线程、日志与记录器。
+ *          被控对象可选非线性 FlightDynamicsAgent 或配平点线性代理模型（LinearSurrogate）。
+ *
+ *          控制律输出作为配平操纵量上的增量作用到对应舵面（油门 [0,1]，舵面为度），
+ *          由阶跃响应得到超调、调节时间、误差积分、稳态误差与控制量均方根，按权重合成代价；
+ *          GainTuner 先在 log10(kp, ki, kd) 空间取Sobol样本做全局筛选，再从最优点做模式搜索，
+ *          每批候选增益并行评估。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#pragma once
+
+#include "../../E_FlightDynamics/LinearModel.hpp"
+#include "../../B_AircraftAgentModel/B737/ModelTwin/FlightControl/B737_AutoFlightControlLaw.hpp"
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace VFT_SMF {
+namespace ControlTuning {
+
+    /**
+     * @brief 被整定的控制回路
+     */
+    enum class TuningLoop {
+        Autothrottle,    ///< 自动油门速度保持：速度PID → 油门
+        AltitudeHold,    ///< 自动驾驶高度保持：俯仰PID → 升降舵
+        HeadingHold,     ///< 自动驾驶航向保持：滚转PID → 副翼
+        YawDamper        ///< 偏航阻尼器：偏航角速度PID → 方向舵（初始偏航角速度扰动的恢复）
+    };
+
+    /**
+     * @brief 被控对象模型
+     */
+    enum class PlantModel {
+        Nonlinear,       ///< FlightDynamicsAgent
+        Linear           ///< 配平点线性代理模型
+    };
+
+    bool parseTuningLoop(const std::string& name, TuningLoop& loop);
+    std::string tuningLoopName(TuningLoop loop);
+
+    /**
+     * @brief PID增益
+     */
+    struct PidGains {
+        double kp = 0.0;
+        double ki = 0.0;
+        double kd = 0.0;
+    };
+
+    /**
+     * @brief 阶跃响应指标（响应已归一化：0 为初值，1 为目标）
+     */
+    struct StepResponseMetrics {
+        bool stable = false;             ///< 全程未发散
+        bool settled = false;            ///< 在结束前进入并保持在调节带内
+        double rise_time = 0.0;          ///< 首次达到90%的时间 (s)，未达到时为仿真时长
+        double overshoot = 0.0;          ///< 超调量 (%)
+        double settling_time = 0.0;      ///< 调节时间 (s)，未调节时为仿真时长
+        double integral_error = 0.0;     ///< 归一化误差绝对值积分 (s)
+        double steady_state_error = 0.0; ///< 结束时的误差（回路单位）
+        double control_effort = 0.0;     ///< 控制量增量均方根（油门或度）
+        double diverged_at = 0.0;        ///< 发散时刻 (s)，稳定时为仿真时长
+    };
+
+    /**
+     * @brief 代价权重
+     */
+    struct CostWeights {
+        double settling_time = 1.0;      ///< 每秒调节时间
+        double overshoot = 0.2;          ///< 每1%超调
+        double integral_error = 1.0;     ///< 每秒归一化误差积分
+        double steady_state_error = 10.0;///< 每单位归一化稳态误差
+        double control_effort = 0.0;     ///< 每单位控制量均方根
+        double unstable_penalty = 1000.0;///< 发散惩罚（按发散时刻递减，越晚发散代价越低）
+    };
+
+    /**
+     * @brief 整定工况
+     */
+    struct TuningCase {
+        TuningLoop loop = TuningLoop::Autothrottle;
+        PlantModel plant = PlantModel::Nonlinear;
+        FlightDynamics::TrimTarget operating_point;   ///< 配平工作点
+        double step = 5.0;               ///< 阶跃幅值：m/s、m、度，偏航阻尼器为初始偏航角速度 (度/秒)
+        double duration = 60.0;          ///< 响应时长 (s)
+        double time_step = 0.01;         ///< 步长 (s)，与仿真步长一致
+        double settling_band = 0.05;     ///< 调节带（阶跃幅值的比例）
+        CostWeights weights;
+    };
+
+    /**
+     * @brief 整定选项
+     */
+    struct TuningOptions {
+        size_t initial_samples = 32;     ///< 全局筛选的Sobol样本数，0 为只做局部搜索
+        int max_iterations = 100;        ///< 最大模式搜索轮数
+        double initial_step = 0.5;       ///< 初始搜索步长（log10 单位，即约3倍）
+        double min_step = 0.01;          ///< 最小搜索步长
+        double min_gain = 1e-4;          ///< 增益下限（低于此值视为0）
+        double max_gain = 1e2;           ///< 增益上限
+        int parallel_workers = 0;        ///< 并行评估线程数，0 为硬件并发数
+    };
+
+    /**
+     * @brief 整定结果
+     */
+    struct TuningResult {
+        PidGains initial_gains;
+        PidGains best_gains;
+        StepResponseMetrics initial_metrics;
+        StepResponseMetrics best_metrics;
+        double initial_cost = 0.0;
+        double best_cost = 0.0;
+        int iterations = 0;
+        size_t evaluations = 0;
+        double elapsed_seconds = 0.0;
+    };
+
+    /**
+     * @brief 阶跃响应采样点
+     */
+    struct ResponseSample {
+        double time = 0.0;
+        double response = 0.0;           ///< 回路输出（回路单位，相对初值）
+        double command = 0.0;            ///< 控制量增量
+    };
+
+    /**
+     * @brief 阶跃响应评估器：构造时求配平（线性对象时同时线性化并离散化），evaluate 可并发调用
+     */
+    class StepResponseEvaluator {
+    public:
+        explicit StepResponseEvaluator(const TuningCase& tuning_case);
+
+        bool isReady() const { return trim.converged; }
+        const FlightDynamics::TrimResult& getTrim() const { return trim; }
+        const TuningCase& getCase() const { return tuning_case; }
+
+        /**
+         * @brief 以给定增益推进一次阶跃响应
+         * @param trace 非空时记录每步的响应与控制量
+         */
+        StepResponseMetrics evaluate(const PidGains& gains, std::vector<ResponseSample>* trace = nullptr) const;
+
+        /**
+         * @brief 按工况权重计算代价
+         */
+        double cost(const StepResponseMetrics& metrics) const;
+
+        /**
+         * @brief 控制律构造函数中的默认增益
+         */
+        static PidGains defaultGains(TuningLoop loop);
+
+    private:
+        TuningCase tuning_case;
+        FlightDynamics::TrimResult trim;
+        std::unique_ptr<FlightDynamics::LinearSurrogate> surrogate;   ///< 线性对象模板，每次评估复制
+    };
+
+    /**
+     * @brief 增益整定器：log10 空间的Sobol全局筛选 + 并行模式搜索
+     */
+    class GainTuner {
+    public:
+        using ProgressCallback = std::function<void(int iteration, const PidGains& best, double best_cost, double step)>;
+
+        GainTuner(const StepResponseEvaluator& step_evaluator, TuningOptions tuning_options = TuningOptions())
+            : evaluator(step_evaluator), options(tuning_options) {}
+
+        /**
+         * @brief 从初始增益出发整定
+         */
+        TuningResult tune(const PidGains& initial, ProgressCallback progress = nullptr) const;
+
+        /**
+         * @brief 并行评估一批增益，返回各自代价
+         */
+        std::vector<double> evaluateBatch(const std::vector<PidGains>& candidates,
+                                          std::vector<StepResponseMetrics>& metrics) const;
+
+    private:
+        const StepResponseEvaluator& evaluator;
+        TuningOptions options;
+    };
+
+} // namespace ControlTuning
+} // namespace VFT_SMF
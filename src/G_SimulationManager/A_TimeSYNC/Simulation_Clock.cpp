@@ -36,7 +36,7 @@ SimulationClock::SimulationClock(const SimulationConfig& config)
 
 
 void SimulationClock::start(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDataSpace> shared_data_space) {
-    std::unique_lock<std::mutex> lock(clock_mutex);
+    std::unique_lock<VFT_SMF::SimManage::InstrumentedMutex> lock(clock_mutex);
     if (!is_running) {
         is_running = true;
         is_paused = false;
@@ -54,7 +54,7 @@ void SimulationClock::start(std::shared_ptr<GlobalShared_DataSpace::GlobalShared
 
 
 void SimulationClock::stop(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDataSpace> shared_data_space) {
-    std::unique_lock<std::mutex> lock(clock_mutex);
+    std::unique_lock<VFT_SMF::SimManage::InstrumentedMutex> lock(clock_mutex);
     if (is_running) {
         is_running = false;
         is_paused = false;
@@ -67,7 +67,7 @@ void SimulationClock::stop(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedD
 }
 
 void SimulationClock::pause() {
-    std::unique_lock<std::mutex> lock(clock_mutex);
+    std::unique_lock<VFT_SMF::SimManage::InstrumentedMutex> lock(clock_mutex);
     
     if (is_running && !is_paused) {
         is_paused = true;
@@ -78,7 +78,7 @@ void SimulationClock::pause() {
 }
 
 void SimulationClock::resume() {
-    std::unique_lock<std::mutex> lock(clock_mutex);
+    std::unique_lock<VFT_SMF::SimManage::InstrumentedMutex> lock(clock_mutex);
     
     if (is_running && is_paused) {
         is_paused = false;
@@ -90,7 +90,7 @@ void SimulationClock::resume() {
 }
 
 void SimulationClock::reset() {
-    std::unique_lock<std::mutex> lock(clock_mutex);
+    std::unique_lock<VFT_SMF::SimManage::InstrumentedMutex> lock(clock_mutex);
     
     current_simulation_time = 0.0;
     current_frame = 0;
@@ -106,7 +106,7 @@ void SimulationClock::update(double delta_sim_time) {
         return;
     }
     
-    std::unique_lock<std::mutex> lock(clock_mutex);
+    std::unique_lock<VFT_SMF::SimManage::InstrumentedMutex> lock(clock_mutex);
     
     // 根据时间模式计算仿真时间增量
     double delta_simulation_time = 0.0;
@@ -140,7 +140,8 @@ void SimulationClock::update(double delta_sim_time, std::shared_ptr<GlobalShared
         return;
     }
     
-    std::unique_lock<std::mutex> lock(clock_mutex);
+    const auto step_start = std::chrono::steady_clock::now();
+    std::unique_lock<VFT_SMF::SimManage::InstrumentedMutex> lock(clock_mutex);
     
     // 根据时间模式计算仿真时间增量
     double delta_simulation_time = 0.0;
@@ -222,6 +223,9 @@ void SimulationClock::update(double delta_sim_time, std::shared_ptr<GlobalShared
                 VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "所有线程已完成，继续推进仿真时间");
             }
 
+            // 独立进程中的远程代理（经传输层附加）同样须完成本步，其状态随后导入本地
+            shared_data_space->waitForRemoteParticipants(current_frame.load());
+
             // 所有线程完成后，重置同步信号，准备下一步
             if (all_completed) {
                 shared_data_space->resetSyncSignal();
@@ -231,6 +235,11 @@ void SimulationClock::update(double delta_sim_time, std::shared_ptr<GlobalShared
             // 重新获取时钟锁，继续后续流程
             lock.lock();
     }
+    
+    const uint64_t step_wall_ns = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - step_start).count());
+    last_step_wall_ns.store(step_wall_ns, std::memory_order_relaxed);
+    step_wall_ns_total.fetch_add(step_wall_ns, std::memory_order_relaxed);
    
             
 }
@@ -246,6 +255,16 @@ uint64_t SimulationClock::get_current_step() const {
     return current_frame.load();
 }
 
+SimulationClockMetrics SimulationClock::get_metrics() const {
+    SimulationClockMetrics metrics;
+    metrics.steps = current_frame.load();
+    metrics.simulation_time = current_simulation_time.load();
+    metrics.step_wall_seconds_total = static_cast<double>(step_wall_ns_total.load(std::memory_order_relaxed)) * 1e-9;
+    metrics.last_step_wall_seconds = static_cast<double>(last_step_wall_ns.load(std::memory_order_relaxed)) * 1e-9;
+    metrics.running = is_running.load();
+    return metrics;
+}
+
 SimulationTimePoint SimulationClock::get_current_simulation_time_point() const {
     return SimulationTimePoint(current_simulation_time.load(), current_frame.load());
 }
@@ -271,7 +290,7 @@ double SimulationClock::get_simulation_time_step() const {
 // ==================== 时间模式控制 ====================
 
 void SimulationClock::set_time_mode(SimulationMode mode) {
-    std::lock_guard<std::mutex> lock(clock_mutex);
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(clock_mutex);
     
     current_mode = mode;
     config.mode = mode;
@@ -292,7 +311,7 @@ SimulationMode SimulationClock::get_time_mode() const {
 // ==================== 同步管理 ====================
 
 void SimulationClock::set_sync_strategy(TimeSyncStrategy strategy) {
-    std::lock_guard<std::mutex> lock(clock_mutex);
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(clock_mutex);
     config.sync_strategy = strategy;
     std::cout << "同步策略已设置为: " << static_cast<int>(strategy) << std::endl;
 }
@@ -306,7 +325,7 @@ TimeSyncStrategy SimulationClock::get_sync_strategy() const {
 // 同步状态/容差接口已移除
 
 void SimulationClock::set_step_time_increment(double increment) {
-    std::unique_lock<std::mutex> lock(clock_mutex);
+    std::unique_lock<VFT_SMF::SimManage::InstrumentedMutex> lock(clock_mutex);
     config.step_time_increment = std::max(0.0001, increment);
     std::cout << "仿真步时间增量已设置为: " << config.step_time_increment << "s" << std::endl;
 }
@@ -336,12 +355,12 @@ bool SimulationClock::is_clock_paused() const {
 }
 
 SimulationConfig SimulationClock::get_config() const {
-    std::unique_lock<std::mutex> lock(clock_mutex);
+    std::unique_lock<VFT_SMF::SimManage::InstrumentedMutex> lock(clock_mutex);
     return config;
 }
 
 void SimulationClock::set_config(const SimulationConfig& new_config) {
-    std::lock_guard<std::mutex> lock(clock_mutex);
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(clock_mutex);
     config = new_config;
     current_mode = config.mode;
     std::cout << "时钟配置已更新" << std::endl;
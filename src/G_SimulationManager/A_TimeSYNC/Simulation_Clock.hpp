@@ -30,6 +30,17 @@
 
 namespace VFT_SMF {
 
+    /**
+     * @brief 仿真时钟运行计数快照
+     */
+    struct SimulationClockMetrics {
+        uint64_t steps = 0;                    ///< 已推进步数
+        double simulation_time = 0.0;          ///< 当前仿真时间（秒）
+        double step_wall_seconds_total = 0.0;  ///< 推进与等待各线程完成的墙钟时间合计（秒）
+        double last_step_wall_seconds = 0.0;   ///< 最近一步的墙钟时间（秒）
+        bool running = false;
+    };
+
     /**
      * @brief 仿真时钟类
      * 
@@ -58,9 +69,13 @@ namespace VFT_SMF {
         
         // 统计信息结构已移除
         
+        // 运行计数（指标端点无锁读取）
+        std::atomic<uint64_t> step_wall_ns_total{0};  ///< 各步推进与等待各线程完成的墙钟时间合计
+        std::atomic<uint64_t> last_step_wall_ns{0};   ///< 最近一步的墙钟时间
+        
         TimeUpdateCallback time_update_callback;      ///< 时间更新回调
         
-        mutable std::mutex clock_mutex;       ///< 时钟互斥锁
+        mutable VFT_SMF::SimManage::InstrumentedMutex clock_mutex{"Simulation_Clock.clock"};  ///< 时钟互斥锁
         
      
         
@@ -238,6 +253,12 @@ namespace VFT_SMF {
         
         // FPS/统计接口已移除
         
+        /**
+         * @brief 获取运行计数（不加锁，供指标端点采集）
+         * @return 运行计数快照
+         */
+        SimulationClockMetrics get_metrics() const;
+        
         // ==================== 回调函数设置 ====================
         
         /**
@@ -0,0 +1,95 @@
+/**
+ * @file TransportStepRelay.cpp
+ * @brief 远程代理进程的步信号转发实现
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include "TransportStepRelay.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace VFT_SMF {
+
+    namespace {
+        constexpr std::chrono::milliseconds STEP_WAIT_SLICE{200};   ///< 单次等待步信号的上限，期间检查 stop()
+        constexpr std::chrono::milliseconds REATTACH_BACKOFF{50};
+    }
+
+    TransportStepRelay::TransportStepRelay(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDataSpace> shared_data_space,
+                                           std::shared_ptr<GlobalShared_DataSpace::StateTransport> transport,
+                                           std::string participant_name)
+        : shared_data_space(std::move(shared_data_space)), transport(std::move(transport)),
+          participant_name(std::move(participant_name)) {}
+
+    bool TransportStepRelay::waitForLocalThreads(GlobalSharedDataStruct::ThreadSyncState state) {
+        // 与时钟相同的自适应退避轮询：先让出，再逐步延长睡眠
+        int sleep_us = 0;
+        const int sleep_us_max = 200;
+        while (!stop_requested.load()) {
+            bool all_reached = true;
+            for (const auto& thread_pair : shared_data_space->getRegisteredThreads()) {
+                if (shared_data_space->getThreadState(thread_pair.first) != state) {
+                    all_reached = false;
+                    break;
+                }
+            }
+            if (all_reached) return true;
+
+            if (sleep_us == 0) {
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds(sleep_us));
+            }
+            sleep_us = std::min(sleep_us + 20, sleep_us_max);
+        }
+        return false;
+    }
+
+    uint64_t TransportStepRelay::run() {
+        uint64_t last_step = 0;
+        VFT_LOG_BRIEF("步信号转发开始，参与端: {}", participant_name);
+
+        while (!stop_requested.load()) {
+            uint64_t step = 0;
+            double simulation_time = 0.0;
+            const auto result = transport->waitForStep(last_step, step, simulation_time, STEP_WAIT_SLICE);
+            if (result == GlobalShared_DataSpace::StepWaitResult::Shutdown) {
+                VFT_LOG_BRIEF("协调端已结束仿真，步信号转发结束");
+                break;
+            }
+            if (result == GlobalShared_DataSpace::StepWaitResult::Timeout) {
+                continue;
+            }
+            if (result == GlobalShared_DataSpace::StepWaitResult::Detached) {
+                // 被协调端剔除（如单步超时）：以同一名称重新附加，从下一步继续
+                if (transport->attach(participant_name)) {
+                    reattach_count.fetch_add(1);
+                    VFT_LOG_BRIEF("参与端 {} 已被剔除，重新附加成功", participant_name);
+                } else {
+                    std::this_thread::sleep_for(REATTACH_BACKOFF);
+                }
+                continue;
+            }
+
+            // 上一步的代理线程须回到等待状态后再下发新步，避免把上一步的完成状态误认为本步
+            if (!waitForLocalThreads(GlobalSharedDataStruct::ThreadSyncState::WAITING_FOR_CLOCK)) break;
+
+            last_step = step;
+            shared_data_space->importTransportStates();
+            shared_data_space->updateSyncSignal(simulation_time, step);
+            if (!waitForLocalThreads(GlobalSharedDataStruct::ThreadSyncState::COMPLETED)) break;
+            shared_data_space->resetSyncSignal();
+
+            // 先计数再回报：协调端等到本步完成时计数已更新
+            relayed_steps.fetch_add(1);
+            transport->completeStep(step);
+        }
+
+        shared_data_space->setSimulationOver(true);
+        return relayed_steps.load();
+    }
+
+} // namespace VFT_SMF
@@ -0,0 +1,69 @@
+/**
+ * @file TransportStepRelay.hpp
+ * @brief 远程代理进程的步信号转发
+ * @author VFT_SMF Development Team
+ * @date 2024
+ *
+ * 代理以独立进程运行时，本进程没有仿真时钟：转发器等待协调端经传输层下发的步信号，
+ * 把其他端的最新状态导入本进程的共享数据空间，再以本地同步信号驱动本进程内的代理线程
+ * （与主进程中同一个线程函数，无需改动），全部完成后经传输层回报完成。
+ * 被协调端剔除（步超时）后自动以同一名称重新附加；协调端结束仿真或异常退出后返回。
+ */
+
+#pragma once
+
+#include "../../E_GlobalSharedDataSpace/GlobalSharedDataSpace.hpp"
+#include "../../E_GlobalSharedDataSpace/StateTransport.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace VFT_SMF {
+
+    /**
+     * @brief 步信号转发器
+     */
+    class TransportStepRelay {
+    public:
+        /**
+         * @param shared_data_space 本进程的共享数据空间（已附加 transport）
+         * @param transport 已附加为参与端的传输层
+         * @param participant_name 参与端名称（被剔除后以此名称重新附加）
+         */
+        TransportStepRelay(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDataSpace> shared_data_space,
+                           std::shared_ptr<GlobalShared_DataSpace::StateTransport> transport,
+                           std::string participant_name);
+
+        /**
+         * @brief 转发步信号，直到协调端结束仿真或调用 stop()
+         * @details 返回前设置本进程的仿真结束标志，本进程代理线程随之退出
+         * @return 已转发的步数
+         */
+        uint64_t run();
+
+        /**
+         * @brief 请求 run() 返回（可从其他线程调用）
+         */
+        void stop() { stop_requested.store(true); }
+
+        uint64_t getRelayedSteps() const { return relayed_steps.load(); }
+        uint64_t getReattachCount() const { return reattach_count.load(); }
+
+    private:
+        /**
+         * @brief 等待本进程已注册的线程全部进入指定状态
+         * @return stop() 被调用时返回 false
+         */
+        bool waitForLocalThreads(GlobalSharedDataStruct::ThreadSyncState state);
+
+        std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDataSpace> shared_data_space;
+        std::shared_ptr<GlobalShared_DataSpace::StateTransport> transport;
+        std::string participant_name;
+        std::atomic<bool> stop_requested{false};
+        std::atomic<uint64_t> relayed_steps{0};
+        std::atomic<uint64_t> reattach_count{0};
+    };
+
+} // namespace VFT_SMF
@@ -0,0 +1,412 @@
+/**
+ * @file AllocationTracker.cpp
+ * @brief 堆分配计数实现与全局 operator new/delete 替换
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include "AllocationTracker.hpp"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <sstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <malloc.h>
+#else
+#include <execinfo.h>
+#include <unistd.h>
+#endif
+
+namespace VFT_SMF {
+namespace SimManage {
+
+    namespace {
+        /**
+         * @brief 已标记线程的统计记录（线程结束后保留，供报告使用）
+         */
+        struct ThreadRecord {
+            std::mutex mutex;                 ///< 所属线程结算与 snapshot() 读取互斥
+            ThreadAllocationStats stats;
+        };
+
+        /**
+         * @brief 线程局部计数（常量初始化，operator new 中可直接使用）
+         */
+        struct ThreadState {
+            ThreadRecord* record;
+            uint64_t allocations;
+            uint64_t bytes;
+            uint64_t frees;
+            uint64_t steady_allocations;
+            uint64_t step;
+            bool in_step;
+            bool internal;                    ///< 统计器自身分配时置位，不计数
+            int steady_depth;
+            const char* steady_region;
+        };
+
+        thread_local ThreadState thread_state = {};
+        std::atomic<int> tracking_mode{static_cast<int>(AllocationTrackingMode::Off)};
+
+        std::mutex& registryMutex() {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        // 记录在进程退出前一直有效（静态析构期间仍可能有线程释放内存）
+        std::vector<ThreadRecord*>& registry() {
+            static std::vector<ThreadRecord*>* records = new std::vector<ThreadRecord*>();
+            return *records;
+        }
+
+        class InternalScope {
+        public:
+            explicit InternalScope(ThreadState& state) : state(state), previous(state.internal) { state.internal = true; }
+            ~InternalScope() { state.internal = previous; }
+        private:
+            ThreadState& state;
+            bool previous;
+        };
+
+        void clearCounters(ThreadState& state) {
+            state.allocations = 0;
+            state.bytes = 0;
+            state.frees = 0;
+            state.steady_allocations = 0;
+        }
+
+        /**
+         * @brief 结算当前步并清零线程局部计数，返回是否处于统计模式
+         * @details 关闭统计时不加锁、不追加历史，只清零计数（模式切换前残留的计数不带入下一步）
+         */
+        bool flushStep(ThreadState& state) {
+            if (tracking_mode.load(std::memory_order_relaxed) == static_cast<int>(AllocationTrackingMode::Off)) {
+                clearCounters(state);
+                return false;
+            }
+            if (state.record) {
+                InternalScope guard(state);
+                std::lock_guard<std::mutex> lock(state.record->mutex);
+                ThreadAllocationStats& stats = state.record->stats;
+                if (!state.in_step) {
+                    stats.init_allocations += state.allocations;
+                    stats.init_bytes += state.bytes;
+                } else {
+                    ++stats.steps;
+                    stats.step_allocations += state.allocations;
+                    stats.step_bytes += state.bytes;
+                    if (state.allocations > stats.max_step_allocations) {
+                        stats.max_step_allocations = state.allocations;
+                        stats.max_step = state.step;
+                    }
+                    stats.history.push_back({state.step, state.allocations, state.bytes});
+                }
+                stats.steady_state_allocations += state.steady_allocations;
+                stats.frees += state.frees;
+            }
+            clearCounters(state);
+            return true;
+        }
+
+        void printStackTrace() {
+#ifdef _WIN32
+            void* frames[62];
+            const USHORT count = CaptureStackBackTrace(0, 62, frames, nullptr);
+            for (USHORT i = 0; i < count; ++i) {
+                std::fprintf(stderr, "  #%u %p\n", static_cast<unsigned>(i), frames[i]);
+            }
+#else
+            void* frames[64];
+            const int count = backtrace(frames, 64);
+            backtrace_symbols_fd(frames, count, STDERR_FILENO);
+#endif
+        }
+
+        [[noreturn]] void steadyStateViolation(ThreadState& state, size_t bytes) {
+            state.internal = true;
+            const char* thread_name = state.record ? state.record->stats.thread_name.c_str() : "untagged";
+            std::fprintf(stderr, "[AllocationTracker] 稳态区域 \"%s\" 内发生堆分配: 线程 %s, 步 %llu, %llu 字节\n",
+                         state.steady_region ? state.steady_region : "", thread_name,
+                         static_cast<unsigned long long>(state.step), static_cast<unsigned long long>(bytes));
+            printStackTrace();
+            std::fflush(stderr);
+            std::abort();
+        }
+    }
+
+    void AllocationTracker::setMode(AllocationTrackingMode mode) {
+        tracking_mode.store(static_cast<int>(mode), std::memory_order_relaxed);
+    }
+
+    AllocationTrackingMode AllocationTracker::getMode() {
+        return static_cast<AllocationTrackingMode>(tracking_mode.load(std::memory_order_relaxed));
+    }
+
+    bool AllocationTracker::parseMode(const std::string& name, AllocationTrackingMode& mode) {
+        if (name == "off") {
+            mode = AllocationTrackingMode::Off;
+        } else if (name == "count") {
+            mode = AllocationTrackingMode::Count;
+        } else if (name == "strict") {
+            mode = AllocationTrackingMode::Strict;
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    void AllocationTracker::tagCurrentThread(const std::string& thread_name) {
+        ThreadState& state = thread_state;
+        flushStep(state);
+        InternalScope guard(state);
+        std::lock_guard<std::mutex> lock(registryMutex());
+        ThreadRecord* record = nullptr;
+        for (ThreadRecord* existing : registry()) {
+            if (existing->stats.thread_name == thread_name) {
+                record = existing;
+                break;
+            }
+        }
+        if (!record) {
+            record = new ThreadRecord();
+            record->stats.thread_name = thread_name;
+            registry().push_back(record);
+        }
+        state.record = record;
+        state.in_step = false;
+    }
+
+    void AllocationTracker::untagCurrentThread() {
+        ThreadState& state = thread_state;
+        flushStep(state);
+        state.record = nullptr;
+        state.in_step = false;
+    }
+
+    void AllocationTracker::beginStep(uint64_t step) {
+        ThreadState& state = thread_state;
+        if (!flushStep(state)) {
+            return;
+        }
+        state.step = step;
+        state.in_step = true;
+    }
+
+    uint64_t AllocationTracker::getCurrentStepAllocations() {
+        return thread_state.allocations;
+    }
+
+    uint64_t AllocationTracker::getCurrentStepBytes() {
+        return thread_state.bytes;
+    }
+
+    std::vector<ThreadAllocationStats> AllocationTracker::snapshot() {
+        std::vector<ThreadAllocationStats> result;
+        std::lock_guard<std::mutex> lock(registryMutex());
+        for (ThreadRecord* record : registry()) {
+            std::lock_guard<std::mutex> record_lock(record->mutex);
+            result.push_back(record->stats);
+        }
+        return result;
+    }
+
+    void AllocationTracker::resetStatistics() {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        for (ThreadRecord* record : registry()) {
+            std::lock_guard<std::mutex> record_lock(record->mutex);
+            const std::string name = record->stats.thread_name;
+            record->stats = ThreadAllocationStats();
+            record->stats.thread_name = name;
+        }
+    }
+
+    std::string AllocationTracker::formatSummary() {
+        std::ostringstream out;
+        out << "# 堆分配统计（模式: ";
+        switch (getMode()) {
+            case AllocationTrackingMode::Off: out << "off"; break;
+            case AllocationTrackingMode::Count: out << "count"; break;
+            case AllocationTrackingMode::Strict: out << "strict"; break;
+        }
+        out << "）\n";
+        out << std::left << std::setw(28) << "thread" << std::right
+            << std::setw(12) << "init_allocs" << std::setw(10) << "steps"
+            << std::setw(14) << "step_allocs" << std::setw(14) << "allocs/step"
+            << std::setw(14) << "bytes/step" << std::setw(12) << "max/step"
+            << std::setw(10) << "max_at" << std::setw(12) << "steady" << "\n";
+        out << std::fixed << std::setprecision(2);
+        for (const auto& stats : snapshot()) {
+            const double steps = stats.steps > 0 ? static_cast<double>(stats.steps) : 1.0;
+            out << std::left << std::setw(28) << stats.thread_name << std::right
+                << std::setw(12) << stats.init_allocations << std::setw(10) << stats.steps
+                << std::setw(14) << stats.step_allocations
+                << std::setw(14) << static_cast<double>(stats.step_allocations) / steps
+                << std::setw(14) << static_cast<double>(stats.step_bytes) / steps
+                << std::setw(12) << stats.max_step_allocations << std::setw(10) << stats.max_step
+                << std::setw(12) << stats.steady_state_allocations << "\n";
+        }
+        return out.str();
+    }
+
+    bool AllocationTracker::writeReport(const std::string& summary_path, const std::string& steps_path) {
+        std::ofstream summary(summary_path);
+        if (!summary.is_open()) {
+            return false;
+        }
+        summary << formatSummary();
+
+        if (!steps_path.empty()) {
+            std::ofstream steps(steps_path);
+            if (!steps.is_open()) {
+                return false;
+            }
+            steps << "thread,step,allocations,bytes\n";
+            for (const auto& stats : snapshot()) {
+                for (const auto& sample : stats.history) {
+                    steps << stats.thread_name << ',' << sample.step << ',' << sample.allocations << ',' << sample.bytes << '\n';
+                }
+            }
+        }
+        return true;
+    }
+
+    AllocationTracker::SteadyStateScope::SteadyStateScope(const char* region_name)
+        : previous_region(thread_state.steady_region) {
+        ++thread_state.steady_depth;
+        thread_state.steady_region = region_name;
+    }
+
+    AllocationTracker::SteadyStateScope::~SteadyStateScope() {
+        --thread_state.steady_depth;
+        thread_state.steady_region = previous_region;
+    }
+
+    void AllocationTracker::onAllocate(size_t bytes) {
+        const int mode = tracking_mode.load(std::memory_order_relaxed);
+        if (mode == static_cast<int>(AllocationTrackingMode::Off)) {
+            return;
+        }
+        ThreadState& state = thread_state;
+        if (state.internal) {
+            return;
+        }
+        ++state.allocations;
+        state.bytes += bytes;
+        if (state.steady_depth > 0) {
+            ++state.steady_allocations;
+            if (mode == static_cast<int>(AllocationTrackingMode::Strict)) {
+                steadyStateViolation(state, bytes);
+            }
+        }
+    }
+
+    void AllocationTracker::onDeallocate() {
+        if (tracking_mode.load(std::memory_order_relaxed) == static_cast<int>(AllocationTrackingMode::Off)) {
+            return;
+        }
+        ThreadState& state = thread_state;
+        if (!state.internal) {
+            ++state.frees;
+        }
+    }
+
+} // namespace SimManage
+} // namespace VFT_SMF
+
+// ==================== 全局 operator new/delete 替换 ====================
+
+namespace {
+    using VFT_SMF::SimManage::AllocationTracker;
+
+    void* allocateOrNull(std::size_t size) {
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    void* allocateAlignedOrNull(std::size_t size, std::size_t alignment) {
+        if (size == 0) size = 1;
+#ifdef _WIN32
+        return _aligned_malloc(size, alignment);
+#else
+        if (alignment < sizeof(void*)) alignment = sizeof(void*);
+        void* p = nullptr;
+        return posix_memalign(&p, alignment, size) == 0 ? p : nullptr;
+#endif
+    }
+
+    void freeAligned(void* p) {
+#ifdef _WIN32
+        _aligned_free(p);
+#else
+        std::free(p);
+#endif
+    }
+
+    void* allocate(std::size_t size) {
+        AllocationTracker::onAllocate(size);
+        for (;;) {
+            if (void* p = allocateOrNull(size)) return p;
+            std::new_handler handler = std::get_new_handler();
+            if (!handler) throw std::bad_alloc();
+            handler();
+        }
+    }
+
+    void* allocateAligned(std::size_t size, std::align_val_t alignment) {
+        AllocationTracker::onAllocate(size);
+        for (;;) {
+            if (void* p = allocateAlignedOrNull(size, static_cast<std::size_t>(alignment))) return p;
+            std::new_handler handler = std::get_new_handler();
+            if (!handler) throw std::bad_alloc();
+            handler();
+        }
+    }
+
+    void deallocate(void* p) noexcept {
+        if (!p) return;
+        AllocationTracker::onDeallocate();
+        std::free(p);
+    }
+
+    void deallocateAligned(void* p) noexcept {
+        if (!p) return;
+        AllocationTracker::onDeallocate();
+        freeAligned(p);
+    }
+}
+
+void* operator new(std::size_t size) { return allocate(size); }
+void* operator new[](std::size_t size) { return allocate(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try { return allocate(size); } catch (...) { return nullptr; }
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try { return allocate(size); } catch (...) { return nullptr; }
+}
+void* operator new(std::size_t size, std::align_val_t alignment) { return allocateAligned(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return allocateAligned(size, alignment); }
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    try { return allocateAligned(size, alignment); } catch (...) { return nullptr; }
+}
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    try { return allocateAligned(size, alignment); } catch (...) { return nullptr; }
+}
+
+void operator delete(void* p) noexcept { deallocate(p); }
+void operator delete[](void* p) noexcept { deallocate(p); }
+void operator delete(void* p, std::size_t) noexcept { deallocate(p); }
+void operator delete[](void* p, std::size_t) noexcept { deallocate(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { deallocate(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { deallocate(p); }
+void operator delete(void* p, std::align_val_t) noexcept { deallocateAligned(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { deallocateAligned(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { deallocateAligned(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { deallocateAligned(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { deallocateAligned(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { deallocateAligned(p); }
@@ -0,0 +1,140 @@
+/**
+ * @file AllocationTracker.hpp
+ * @brief 堆分配计数与稳态零分配检查
+ * @details AllocationTracker.cpp 替换全局 operator new/delete，按线程统计分配次数与字节数：
+ *          1. 线程在共享数据空间注册时以线程名（ThreadSyncManager 中的 thread_name）打标签，
+ *             注销时结算最后一步；
+ *          2. 代理线程每步开始时调用 beginStep()，上一步的计数记入该线程的逐步历史，
+ *             第一次 beginStep() 之前的分配计为初始化分配；
+ *          3. SteadyStateScope 标记稳态区域：count 模式下记录区域内的分配次数，
+ *             strict 模式下区域内任何分配都会打印调用栈并中止进程。
+ *
+ *          模式由 SimulationConfig.json 的 allocation_tracking 选择（off / count / strict），
+ *          默认 off，此时钩子只多一次原子读。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace VFT_SMF {
+    namespace SimManage {
+
+        /**
+         * @brief 分配统计模式
+         */
+        enum class AllocationTrackingMode {
+            Off,       ///< 不统计
+            Count,     ///< 统计分配次数与字节数
+            Strict     ///< 统计，且稳态区域内分配即中止
+        };
+
+        /**
+         * @brief 单步分配量
+         */
+        struct AllocationStepSample {
+            uint64_t step;
+            uint64_t allocations;
+            uint64_t bytes;
+        };
+
+        /**
+         * @brief 单个线程的分配统计
+         */
+        struct ThreadAllocationStats {
+            std::string thread_name;
+            uint64_t init_allocations = 0;          ///< 第一次 beginStep() 之前的分配次数
+            uint64_t init_bytes = 0;
+            uint64_t steps = 0;                     ///< 已结算步数
+            uint64_t step_allocations = 0;          ///< 各步分配次数之和
+            uint64_t step_bytes = 0;
+            uint64_t max_step_allocations = 0;      ///< 单步最大分配次数
+            uint64_t max_step = 0;                  ///< 出现单步最大分配次数的步号
+            uint64_t steady_state_allocations = 0;  ///< 稳态区域内的分配次数
+            uint64_t frees = 0;                     ///< 释放次数
+            std::vector<AllocationStepSample> history;   ///< 逐步分配量
+        };
+
+        /**
+         * @brief 分配统计器（全部为静态接口）
+         */
+        class AllocationTracker {
+        public:
+            static void setMode(AllocationTrackingMode mode);
+            static AllocationTrackingMode getMode();
+
+            /**
+             * @brief 解析模式名称（off / count / strict）
+             * @return 名称无法识别时返回 false，mode 不变
+             */
+            static bool parseMode(const std::string& name, AllocationTrackingMode& mode);
+
+            /**
+             * @brief 以线程名标记当前线程，之后的分配计入该线程
+             */
+            static void tagCurrentThread(const std::string& thread_name);
+
+            /**
+             * @brief 结算当前线程最后一步并取消标记
+             */
+            static void untagCurrentThread();
+
+            /**
+             * @brief 步边界：结算当前线程上一步的分配
+             */
+            static void beginStep(uint64_t step);
+
+            /**
+             * @brief 当前线程自标记（或上一次 beginStep()）以来的分配次数与字节数
+             */
+            static uint64_t getCurrentStepAllocations();
+            static uint64_t getCurrentStepBytes();
+
+            /**
+             * @brief 各线程统计快照（在线程结束后调用可得到完整结果）
+             */
+            static std::vector<ThreadAllocationStats> snapshot();
+
+            /**
+             * @brief 清空所有线程的统计（线程标签保留）
+             */
+            static void resetStatistics();
+
+            /**
+             * @brief 写出统计报告
+             * @param summary_path 各线程汇总（文本）
+             * @param steps_path 逐步明细 CSV（thread,step,allocations,bytes），为空时不写
+             */
+            static bool writeReport(const std::string& summary_path, const std::string& steps_path);
+
+            /**
+             * @brief 各线程汇总文本
+             */
+            static std::string formatSummary();
+
+            /**
+             * @brief 稳态区域（可嵌套）
+             */
+            class SteadyStateScope {
+            public:
+                explicit SteadyStateScope(const char* region_name);
+                ~SteadyStateScope();
+                SteadyStateScope(const SteadyStateScope&) = delete;
+                SteadyStateScope& operator=(const SteadyStateScope&) = delete;
+
+            private:
+                const char* previous_region;
+            };
+
+            // 由 operator new/delete 调用
+            static void onAllocate(size_t bytes);
+            static void onDeallocate();
+        };
+
+    } // namespace SimManage
+} // namespace VFT_SMF
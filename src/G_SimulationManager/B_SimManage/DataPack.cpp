@@ -0,0 +1,397 @@
+/**
+ * @file DataPack.cpp
+ * @brief 只读二进制数据包实现
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include "DataPack.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace VFT_SMF {
+namespace SimManage {
+
+    namespace {
+        constexpr char PACK_MAGIC[8] = {'V', 'F', 'T', 'P', 'A', 'C', 'K', '\0'};
+
+        // 进程内已映射的数据包（按路径），最后一个使用者释放后自动解除映射
+        std::mutex registry_mutex;
+        std::map<std::string, std::weak_ptr<const DataPack>> open_packs;
+        std::string cache_directory;
+
+        bool rangeFits(uint64_t offset, uint64_t length, uint64_t limit) {
+            return offset <= limit && length <= limit - offset;
+        }
+    }
+
+    // ==================== DataPack ====================
+
+    DataPack::~DataPack() {
+        unmap();
+    }
+
+    std::shared_ptr<const DataPack> DataPack::open(const std::string& path) {
+        std::lock_guard<std::mutex> lock(registry_mutex);
+        auto it = open_packs.find(path);
+        if (it != open_packs.end()) {
+            if (auto existing = it->second.lock()) {
+                return existing;
+            }
+        }
+
+        std::shared_ptr<DataPack> pack(new DataPack());
+        if (!pack->map(path) || !pack->validate()) {
+            return nullptr;
+        }
+        open_packs[path] = pack;
+        return pack;
+    }
+
+    std::shared_ptr<const DataPack> DataPack::openForSource(const std::string& name, const std::string& source_text) {
+        namespace fs = std::filesystem;
+        const uint64_t hash = hashBytes(source_text.data(), source_text.size());
+        char hex[17];
+        std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+        const fs::path directory(getCacheDirectory());
+        const std::string file = (directory / (name + "-" + hex + ".vftpack")).string();
+
+        if (auto pack = open(file)) {
+            if (pack->getSourceHash() == hash) {
+                return pack;
+            }
+        }
+
+        // 缓存中没有：解析一次源 JSON 生成数据包，之后的运行直接映射
+        DataPackWriter writer;
+        try {
+            writer.addJson(nlohmann::json::parse(source_text));
+        } catch (const std::exception&) {
+            return nullptr;
+        }
+        writer.setSourceHash(hash);
+        std::error_code ec;
+        fs::create_directories(directory, ec);
+        if (!writer.write(file)) {
+            return nullptr;
+        }
+        auto pack = open(file);
+        return (pack && pack->getSourceHash() == hash) ? pack : nullptr;
+    }
+
+    void DataPack::setCacheDirectory(const std::string& directory) {
+        std::lock_guard<std::mutex> lock(registry_mutex);
+        cache_directory = directory;
+    }
+
+    std::string DataPack::getCacheDirectory() {
+        {
+            std::lock_guard<std::mutex> lock(registry_mutex);
+            if (!cache_directory.empty()) {
+                return cache_directory;
+            }
+        }
+        std::error_code ec;
+        const std::filesystem::path temp = std::filesystem::temp_directory_path(ec);
+        return ((ec ? std::filesystem::path(".") : temp) / "vft_smf_datapacks").string();
+    }
+
+    uint64_t DataPack::hashBytes(const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        uint64_t hash = 1469598103934665603ull;
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    bool DataPack::hasSection(std::string_view prefix) const {
+        if (!header) return false;
+        const std::string section = std::string(prefix) + "/";
+        const DataPackEntry* end = entries + header->entry_count;
+        const DataPackEntry* it = std::lower_bound(entries, end, std::string_view(section),
+            [this](const DataPackEntry& entry, std::string_view key) { return keyOf(entry) < key; });
+        return it != end && keyOf(*it).substr(0, section.size()) == section;
+    }
+
+    double DataPack::getNumber(std::string_view key, double default_value) const {
+        const DataPackEntry* entry = find(key);
+        return (entry && entry->type == DataPackValueType::Number) ? entry->number : default_value;
+    }
+
+    bool DataPack::getBool(std::string_view key, bool default_value) const {
+        const DataPackEntry* entry = find(key);
+        return (entry && entry->type == DataPackValueType::Boolean) ? entry->number != 0.0 : default_value;
+    }
+
+    std::string_view DataPack::getString(std::string_view key, std::string_view default_value) const {
+        const DataPackEntry* entry = find(key);
+        if (!entry || entry->type != DataPackValueType::String) return default_value;
+        return std::string_view(blob + entry->value_offset, entry->count);
+    }
+
+    std::pair<const double*, size_t> DataPack::getArray(std::string_view key) const {
+        const DataPackEntry* entry = find(key);
+        if (!entry || entry->type != DataPackValueType::NumberArray) return {nullptr, 0};
+        return {reinterpret_cast<const double*>(blob + entry->value_offset), entry->count};
+    }
+
+    const DataPackEntry* DataPack::find(std::string_view key) const {
+        if (!header) return nullptr;
+        const DataPackEntry* end = entries + header->entry_count;
+        const DataPackEntry* it = std::lower_bound(entries, end, key,
+            [this](const DataPackEntry& entry, std::string_view target) { return keyOf(entry) < target; });
+        return (it != end && keyOf(*it) == key) ? it : nullptr;
+    }
+
+    std::string_view DataPack::keyOf(const DataPackEntry& entry) const {
+        return std::string_view(blob + entry.key_offset, entry.key_length);
+    }
+
+    bool DataPack::validate() {
+        if (size < sizeof(DataPackHeader)) return false;
+        const DataPackHeader* head = reinterpret_cast<const DataPackHeader*>(base);
+        if (std::memcmp(head->magic, PACK_MAGIC, sizeof(PACK_MAGIC)) != 0) return false;
+        if (head->version != FORMAT_VERSION || head->total_size != size) return false;
+        const uint64_t table_end = sizeof(DataPackHeader) + static_cast<uint64_t>(head->entry_count) * sizeof(DataPackEntry);
+        if (table_end > head->blob_offset || head->blob_offset > size || head->blob_offset % 8 != 0) return false;
+
+        // 逐项检查越界与键序，之后的查找不再做边界检查
+        const DataPackEntry* table = reinterpret_cast<const DataPackEntry*>(base + sizeof(DataPackHeader));
+        const char* data = base + head->blob_offset;
+        const uint64_t data_size = size - head->blob_offset;
+        std::string_view previous;
+        for (uint32_t i = 0; i < head->entry_count; ++i) {
+            const DataPackEntry& entry = table[i];
+            if (!rangeFits(entry.key_offset, entry.key_length, data_size)) return false;
+            const std::string_view key(data + entry.key_offset, entry.key_length);
+            if (i > 0 && !(previous < key)) return false;
+            previous = key;
+            switch (entry.type) {
+                case DataPackValueType::Number:
+                case DataPackValueType::Boolean:
+                    break;
+                case DataPackValueType::String:
+                    if (!rangeFits(entry.value_offset, entry.count, data_size)) return false;
+                    break;
+                case DataPackValueType::NumberArray:
+                    if (entry.value_offset % 8 != 0 ||
+                        !rangeFits(entry.value_offset, static_cast<uint64_t>(entry.count) * sizeof(double), data_size)) return false;
+                    break;
+                default:
+                    return false;
+            }
+        }
+
+        header = head;
+        entries = table;
+        blob = data;
+        blob_size = static_cast<size_t>(data_size);
+        return true;
+    }
+
+#ifdef _WIN32
+    bool DataPack::map(const std::string& file_path) {
+        HANDLE file = CreateFileA(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart <= 0) {
+            CloseHandle(file);
+            return false;
+        }
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (!mapping) return false;
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view) {
+            CloseHandle(mapping);
+            return false;
+        }
+        path = file_path;
+        handle = mapping;
+        base = static_cast<const char*>(view);
+        size = static_cast<size_t>(file_size.QuadPart);
+        return true;
+    }
+
+    void DataPack::unmap() {
+        if (base) UnmapViewOfFile(base);
+        if (handle) CloseHandle(static_cast<HANDLE>(handle));
+        base = nullptr;
+        handle = nullptr;
+        size = 0;
+    }
+#else
+    bool DataPack::map(const std::string& file_path) {
+        int fd = ::open(file_path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+            ::close(fd);
+            return false;
+        }
+        void* mapped = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapped == MAP_FAILED) return false;
+        path = file_path;
+        base = static_cast<const char*>(mapped);
+        size = static_cast<size_t>(info.st_size);
+        return true;
+    }
+
+    void DataPack::unmap() {
+        if (base) munmap(const_cast<char*>(base), size);
+        base = nullptr;
+        size = 0;
+    }
+#endif
+
+    // ==================== DataPackWriter ====================
+
+    void DataPackWriter::addNumber(const std::string& key, double value) {
+        Value& entry = values[key];
+        entry = Value();
+        entry.type = DataPackValueType::Number;
+        entry.number = value;
+    }
+
+    void DataPackWriter::addBool(const std::string& key, bool value) {
+        Value& entry = values[key];
+        entry = Value();
+        entry.type = DataPackValueType::Boolean;
+        entry.number = value ? 1.0 : 0.0;
+    }
+
+    void DataPackWriter::addString(const std::string& key, const std::string& value) {
+        Value& entry = values[key];
+        entry = Value();
+        entry.type = DataPackValueType::String;
+        entry.text = value;
+    }
+
+    void DataPackWriter::addArray(const std::string& key, const std::vector<double>& array) {
+        Value& entry = values[key];
+        entry = Value();
+        entry.type = DataPackValueType::NumberArray;
+        entry.array = array;
+    }
+
+    void DataPackWriter::addJson(const nlohmann::json& document, const std::string& prefix) {
+        const auto child = [&prefix](const std::string& key) { return prefix.empty() ? key : prefix + "/" + key; };
+        if (document.is_object()) {
+            for (auto it = document.begin(); it != document.end(); ++it) {
+                addJson(it.value(), child(it.key()));
+            }
+        } else if (document.is_array()) {
+            const bool numeric = std::all_of(document.begin(), document.end(),
+                                             [](const nlohmann::json& item) { return item.is_number(); });
+            if (numeric) {
+                std::vector<double> array;
+                array.reserve(document.size());
+                for (const auto& item : document) array.push_back(item.get<double>());
+                addArray(prefix, array);
+            } else {
+                for (size_t i = 0; i < document.size(); ++i) {
+                    addJson(document[i], child(std::to_string(i)));
+                }
+            }
+        } else if (document.is_boolean()) {
+            addBool(prefix, document.get<bool>());
+        } else if (document.is_number()) {
+            addNumber(prefix, document.get<double>());
+        } else if (document.is_string()) {
+            addString(prefix, document.get<std::string>());
+        }
+    }
+
+    bool DataPackWriter::write(const std::string& path, std::string* error) const {
+        const size_t count = values.size();
+        const uint64_t blob_offset = sizeof(DataPackHeader) + count * sizeof(DataPackEntry);   // 8的倍数
+
+        std::vector<DataPackEntry> table;
+        table.reserve(count);
+        std::string data;
+        for (const auto& [key, value] : values) {
+            DataPackEntry entry {};
+            entry.key_offset = static_cast<uint32_t>(data.size());
+            entry.key_length = static_cast<uint32_t>(key.size());
+            entry.type = value.type;
+            entry.number = value.number;
+            data += key;
+            if (value.type == DataPackValueType::String) {
+                entry.value_offset = data.size();
+                entry.count = static_cast<uint32_t>(value.text.size());
+                data += value.text;
+            } else if (value.type == DataPackValueType::NumberArray) {
+                data.resize((data.size() + 7) / 8 * 8, '\0');
+                entry.value_offset = data.size();
+                entry.count = static_cast<uint32_t>(value.array.size());
+                const size_t bytes = value.array.size() * sizeof(double);
+                data.resize(data.size() + bytes);
+                if (bytes > 0) std::memcpy(&data[entry.value_offset], value.array.data(), bytes);
+            }
+            table.push_back(entry);
+        }
+
+        DataPackHeader header {};
+        std::memcpy(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC));
+        header.version = DataPack::FORMAT_VERSION;
+        header.entry_count = static_cast<uint32_t>(count);
+        header.source_hash = source_hash;
+        header.blob_offset = blob_offset;
+        header.total_size = blob_offset + data.size();
+
+        // 临时文件名区分进程与线程，改名在同一目录内完成
+        const uint64_t unique = std::hash<std::thread::id>{}(std::this_thread::get_id()) ^
+                                static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        const std::string temp_path = path + ".tmp" + std::to_string(unique);
+        {
+            std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) {
+                if (error) *error = "无法写入数据包: " + temp_path;
+                return false;
+            }
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(table.size() * sizeof(DataPackEntry)));
+            file.write(data.data(), static_cast<std::streamsize>(data.size()));
+            if (!file) {
+                if (error) *error = "写入数据包失败: " + temp_path;
+                file.close();
+                std::remove(temp_path.c_str());
+                return false;
+            }
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(temp_path, path, ec);
+        if (ec) {
+            std::error_code cleanup_ec;   // 清理失败不抛出，保留改名错误信息
+            std::filesystem::remove(temp_path, cleanup_ec);
+            // 另一进程已写出同内容的数据包（Windows 下改名不覆盖已存在文件）
+            if (std::filesystem::exists(path, cleanup_ec)) return true;
+            if (error) *error = "数据包改名失败: " + ec.message();
+            return false;
+        }
+        return true;
+    }
+
+} // namespace SimManage
+} // namespace VFT_SMF
@@ -0,0 +1,186 @@
+/**
+ * @file DataPack.hpp
+ * @brief 只读二进制数据包（机场/机型静态数据）
+ * @details 把 JSON 配置展平为按键排序的二进制表，以只读方式映射（mmap / MapViewOfFile），
+ *          读取时在映射内存上二分查找，不做反序列化。
+ *
+ *          文件布局（小端，所有偏移相对文件起始，可重定位）：
+ *            DataPackHeader | DataPackEntry[entry_count]（按键字节序排序）| 数据区（键、字符串、8字节对齐的数组）
+ *          键为 JSON 路径，以 '/' 连接，例如 "runway_data/elevation"；数值数组整体存为一项，
+ *          其他数组按下标展开（"a/0"、"a/1"）。
+ *
+ *          数据包按源文本内容寻址：缓存目录下的文件名含源 JSON 的 FNV-1a 哈希，
+ *          内容相同的配置（如同机并行的多次运行）共用同一文件与页缓存；
+ *          进程内同一文件只映射一次，各线程共享。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#pragma once
+
+#include "../../I_ThirdPartyTools/json.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace VFT_SMF {
+namespace SimManage {
+
+    /**
+     * @brief 数据项类型
+     */
+    enum class DataPackValueType : uint32_t {
+        Number = 1,
+        Boolean = 2,
+        String = 3,
+        NumberArray = 4
+    };
+
+    /**
+     * @brief 文件头
+     */
+    struct DataPackHeader {
+        char magic[8];               ///< "VFTPACK\0"
+        uint32_t version;            ///< 格式版本
+        uint32_t entry_count;        ///< 数据项个数
+        uint64_t source_hash;        ///< 源 JSON 文本的 FNV-1a 64 哈希
+        uint64_t blob_offset;        ///< 数据区偏移
+        uint64_t total_size;         ///< 文件总字节数
+    };
+
+    /**
+     * @brief 数据项（定长，按键排序）
+     */
+    struct DataPackEntry {
+        uint32_t key_offset;         ///< 键在数据区内的偏移
+        uint32_t key_length;         ///< 键字节数
+        DataPackValueType type;      ///< 类型
+        uint32_t count;              ///< 字符串字节数或数组元素数
+        double number;               ///< 数值或布尔值
+        uint64_t value_offset;       ///< 字符串或数组在数据区内的偏移
+    };
+
+    static_assert(sizeof(DataPackHeader) == 40, "DataPackHeader layout");
+    static_assert(sizeof(DataPackEntry) == 32, "DataPackEntry layout");
+
+    /**
+     * @brief 只读映射的数据包
+     */
+    class DataPack {
+    public:
+        static constexpr uint32_t FORMAT_VERSION = 1;
+
+        ~DataPack();
+        DataPack(const DataPack&) = delete;
+        DataPack& operator=(const DataPack&) = delete;
+
+        /**
+         * @brief 映射数据包文件（进程内同一路径只映射一次）
+         * @return 格式或大小校验失败时返回空
+         */
+        static std::shared_ptr<const DataPack> open(const std::string& path);
+
+        /**
+         * @brief 按源 JSON 文本取数据包：缓存目录中已有同内容的数据包则直接映射，否则生成后映射
+         * @param name 文件名前缀（如 "environment_config"）
+         * @param source_text 源 JSON 文本
+         * @return JSON 无法解析或缓存目录不可写时返回空，调用方应回退到 JSON 解析
+         */
+        static std::shared_ptr<const DataPack> openForSource(const std::string& name, const std::string& source_text);
+
+        /**
+         * @brief 设置数据包缓存目录（默认为系统临时目录下的 vft_smf_datapacks）
+         */
+        static void setCacheDirectory(const std::string& directory);
+        static std::string getCacheDirectory();
+
+        /**
+         * @brief FNV-1a 64 哈希
+         */
+        static uint64_t hashBytes(const void* data, size_t size);
+
+        bool contains(std::string_view key) const { return find(key) != nullptr; }
+
+        /**
+         * @brief 是否存在以 prefix + "/" 开头的键（对应 JSON 中存在该对象）
+         */
+        bool hasSection(std::string_view prefix) const;
+
+        double getNumber(std::string_view key, double default_value) const;
+        bool getBool(std::string_view key, bool default_value) const;
+        std::string_view getString(std::string_view key, std::string_view default_value) const;
+
+        /**
+         * @brief 数值数组（指向映射内存，生命周期同数据包）
+         * @return {首元素指针, 元素数}，键不存在或类型不符时为 {nullptr, 0}
+         */
+        std::pair<const double*, size_t> getArray(std::string_view key) const;
+
+        size_t getEntryCount() const { return header ? header->entry_count : 0; }
+        uint64_t getSourceHash() const { return header ? header->source_hash : 0; }
+        size_t getSize() const { return size; }
+        const std::string& getPath() const { return path; }
+
+    private:
+        DataPack() = default;
+
+        bool map(const std::string& file_path);
+        bool validate();
+        void unmap();
+        const DataPackEntry* find(std::string_view key) const;
+        std::string_view keyOf(const DataPackEntry& entry) const;
+
+        std::string path;
+        const char* base = nullptr;
+        size_t size = 0;
+        void* handle = nullptr;      ///< Windows映射句柄；POSIX下不使用
+        const DataPackHeader* header = nullptr;
+        const DataPackEntry* entries = nullptr;
+        const char* blob = nullptr;
+        size_t blob_size = 0;
+    };
+
+    /**
+     * @brief 数据包生成器
+     */
+    class DataPackWriter {
+    public:
+        void addNumber(const std::string& key, double value);
+        void addBool(const std::string& key, bool value);
+        void addString(const std::string& key, const std::string& value);
+        void addArray(const std::string& key, const std::vector<double>& values);
+
+        /**
+         * @brief 展平 JSON 文档加入数据包
+         * @param document JSON 文档
+         * @param prefix 键前缀（不含结尾 '/'）
+         */
+        void addJson(const nlohmann::json& document, const std::string& prefix = "");
+
+        void setSourceHash(uint64_t hash) { source_hash = hash; }
+        size_t getEntryCount() const { return values.size(); }
+
+        /**
+         * @brief 写出数据包（先写临时文件再改名，并发写同一路径时读端不会看到半截文件）
+         */
+        bool write(const std::string& path, std::string* error = nullptr) const;
+
+    private:
+        struct Value {
+            DataPackValueType type = DataPackValueType::Number;
+            double number = 0.0;
+            std::string text;
+            std::vector<double> array;
+        };
+
+        std::map<std::string, Value> values;   ///< std::string 按字节序排序，与读端二分查找一致
+        uint64_t source_hash = 0;
+    };
+
+} // namespace SimManage
+} // namespace VFT_SMF
@@ -14,12 +14,12 @@ namespace VFT_SMF {
 
 EventMonitor::EventMonitor(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDataSpace> data_space)
     : shared_data_space(std::move(data_space)) {
-    VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "事件监测器已创建");
+    VFT_LOG_DETAIL("事件监测器已创建");
 }
 
 void EventMonitor::initialize() {
     if (!shared_data_space) {
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "事件监测器初始化失败：共享数据空间为空");
+        VFT_LOG_BRIEF("事件监测器初始化失败：共享数据空间为空");
         return;
     }
     
@@ -32,7 +32,7 @@ void EventMonitor::initialize() {
     // 清空触发状态记录
     event_trigger_status.clear();
     
-    VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "事件监测器初始化完成");
+    VFT_LOG_BRIEF("事件监测器初始化完成");
 }
 
 std::vector<VFT_SMF::GlobalSharedDataStruct::StandardEvent> EventMonitor::monitorEvents(double current_time) {
@@ -73,8 +73,7 @@ std::vector<VFT_SMF::GlobalSharedDataStruct::StandardEvent> EventMonitor::monito
             // 标记为已触发
             event_trigger_status[event.getEventIdString()] = true;
             
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                "事件监测器检测到新触发事件: " + event.event_name + " (ID: " + event.getEventIdString() + ")");
+            VFT_LOG_BRIEF("事件监测器检测到新触发事件: {} (ID: {})", event.event_name, event.getEventIdString());
         }
     }
     
@@ -98,8 +97,7 @@ void EventMonitor::recordEventTrigger(const VFT_SMF::GlobalSharedDataStruct::Sta
     // 更新统计信息
     updateStatistics(event, trigger_time);
     
-    VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, 
-        "事件触发已记录: " + event.event_name + " at " + std::to_string(trigger_time) + "s");
+    VFT_LOG_DETAIL("事件触发已记录: {} at {}s", event.event_name, trigger_time);
 }
 
 void EventMonitor::markEventAsExecuted(const std::string& event_id) {
@@ -109,8 +107,7 @@ void EventMonitor::markEventAsExecuted(const std::string& event_id) {
             record.is_executed = true;
             statistics.executed_events++;
             
-            VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, 
-                "事件已标记为执行: " + event_id);
+            VFT_LOG_DETAIL("事件已标记为执行: {}", event_id);
             break;
         }
     }
@@ -121,7 +118,7 @@ void EventMonitor::reset() {
     event_trigger_status.clear();
     statistics = EventTriggerStatistics();
     
-    VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "事件监测器已重置");
+    VFT_LOG_BRIEF("事件监测器已重置");
 }
 
 std::string EventMonitor::generateReport() const {
@@ -167,9 +164,7 @@ bool EventMonitor::checkEventTriggerCondition(const VFT_SMF::GlobalSharedDataStr
     if (!condition.empty()) {
         bool triggered = parseCompoundCondition(condition, current_time, aircraft_state, atc_command);
         if (triggered) {
-            VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, 
-                "事件条件触发: " + event.event_name + " (条件: " + condition + 
-                ", 时间: " + std::to_string(current_time) + ")");
+            VFT_LOG_DETAIL("事件条件触发: {} (条件: {}, 时间: {})", event.event_name, condition, current_time);
         }
         return triggered;
     }
@@ -186,8 +181,7 @@ bool EventMonitor::parseTimeCondition(const std::string& condition, double curre
                 double trigger_time = std::stod(time_str);
                 return current_time > trigger_time;  // 修复：使用 > 而不是 >=
             } catch (...) {
-                VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, 
-                    "时间条件解析失败: " + condition);
+                VFT_LOG_DETAIL("时间条件解析失败: {}", condition);
             }
         }
     }
@@ -205,8 +199,7 @@ bool EventMonitor::parseDistanceCondition(const std::string& condition, double c
                 double current_distance = calculateDistance(current_time, aircraft_state);
                 return current_distance >= trigger_distance;
             } catch (...) {
-                VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, 
-                    "距离条件解析失败: " + condition);
+                VFT_LOG_DETAIL("距离条件解析失败: {}", condition);
             }
         }
     }
@@ -223,8 +216,7 @@ bool EventMonitor::parseSpeedCondition(const std::string& condition,
                 double trigger_speed = std::stod(speed_str);
                 return aircraft_state.groundspeed >= trigger_speed;
             } catch (...) {
-                VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, 
-                    "速度条件解析失败: " + condition);
+                VFT_LOG_DETAIL("速度条件解析失败: {}", condition);
             }
         }
     }
@@ -339,7 +331,7 @@ void EventMonitor::updateStatistics(const VFT_SMF::GlobalSharedDataStruct::Stand
 void EventMonitor::registerConditionParsers() {
     // 这里可以注册更多的条件解析器
     // 目前使用内联解析方法，未来可以扩展为插件式架构
-    VFT_SMF::logDetail(VFT_SMF::LogLevel::Detail, "条件解析器注册完成");
+    VFT_LOG_DETAIL("条件解析器注册完成");
 }
 
 } // namespace VFT_SMF
@@ -0,0 +1,337 @@
+/**
+ * @file InstrumentedMutex.cpp
+ * @brief 锁统计注册表与报告实现
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include "InstrumentedMutex.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+
+namespace VFT_SMF {
+namespace SimManage {
+
+    namespace {
+        constexpr int MAX_LOCK_SITES = 64;               ///< 锁名上限，超出的锁合并到最后一项
+        constexpr int MAX_SHARED_HOLDS = 8;              ///< 单线程同时共享持有的锁数上限，超出的不计持有时间
+
+        /**
+         * @brief 单个线程上单个锁的计数（只由所属线程写入，报告线程读取）
+         */
+        struct AtomicLockCounters {
+            std::atomic<uint64_t> acquisitions{0};
+            std::atomic<uint64_t> contended{0};
+            std::atomic<uint64_t> shared_acquisitions{0};
+            std::atomic<uint64_t> wait_ns{0};
+            std::atomic<uint64_t> max_wait_ns{0};
+            std::atomic<uint64_t> hold_ns{0};
+            std::atomic<uint64_t> max_hold_ns{0};
+            std::atomic<uint64_t> wait_histogram[LOCK_HISTOGRAM_BUCKETS] = {};
+            std::atomic<uint64_t> hold_histogram[LOCK_HISTOGRAM_BUCKETS] = {};
+        };
+
+        /**
+         * @brief 线程的锁计数表（线程结束后保留，供报告使用）
+         */
+        struct ThreadLockTable {
+            std::string thread_name;                     ///< 受注册表互斥保护
+            AtomicLockCounters sites[MAX_LOCK_SITES];
+        };
+
+        struct LockRegistry {
+            std::mutex mutex;
+            std::vector<std::string> site_names;
+            std::vector<ThreadLockTable*> tables;
+        };
+
+        // 有意不析构：静态析构阶段仍可能有加锁（如数据记录器刷新时回查数据来源名称）
+        LockRegistry& registry() {
+            static LockRegistry* lock_registry = new LockRegistry();
+            return *lock_registry;
+        }
+
+        struct SharedHold {
+            const void* mutex;
+            uint64_t start_ns;
+        };
+
+        thread_local ThreadLockTable* thread_table = nullptr;
+        thread_local const std::string* thread_tag = nullptr;
+        thread_local SharedHold shared_holds[MAX_SHARED_HOLDS];
+        thread_local int shared_hold_count = 0;
+
+        inline void increment(std::atomic<uint64_t>& counter, uint64_t value) {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        inline void raiseMax(std::atomic<uint64_t>& counter, uint64_t value) {
+            if (value > counter.load(std::memory_order_relaxed)) {
+                counter.store(value, std::memory_order_relaxed);
+            }
+        }
+
+        ThreadLockTable& currentTable() {
+            if (thread_table == nullptr) {
+                auto* table = new ThreadLockTable();
+                LockRegistry& lock_registry = registry();
+                std::lock_guard<std::mutex> lock(lock_registry.mutex);
+                table->thread_name = thread_tag ? *thread_tag : "untagged";
+                lock_registry.tables.push_back(table);
+                thread_table = table;
+            }
+            return *thread_table;
+        }
+
+        void load(const AtomicLockCounters& source, LockCounters& target) {
+            target.acquisitions = source.acquisitions.load(std::memory_order_relaxed);
+            target.contended = source.contended.load(std::memory_order_relaxed);
+            target.shared_acquisitions = source.shared_acquisitions.load(std::memory_order_relaxed);
+            target.wait_ns = source.wait_ns.load(std::memory_order_relaxed);
+            target.max_wait_ns = source.max_wait_ns.load(std::memory_order_relaxed);
+            target.hold_ns = source.hold_ns.load(std::memory_order_relaxed);
+            target.max_hold_ns = source.max_hold_ns.load(std::memory_order_relaxed);
+            for (int bucket = 0; bucket < LOCK_HISTOGRAM_BUCKETS; ++bucket) {
+                target.wait_histogram[bucket] = source.wait_histogram[bucket].load(std::memory_order_relaxed);
+                target.hold_histogram[bucket] = source.hold_histogram[bucket].load(std::memory_order_relaxed);
+            }
+        }
+
+        uint64_t bucketUpperBound(int bucket) {
+            return bucket == 0 ? 0 : (uint64_t(1) << bucket);
+        }
+
+        /**
+         * @brief 直方图分位数（所在桶的上界）
+         */
+        uint64_t percentile(const uint64_t* histogram, double fraction) {
+            uint64_t total = 0;
+            for (int bucket = 0; bucket < LOCK_HISTOGRAM_BUCKETS; ++bucket) total += histogram[bucket];
+            if (total == 0) return 0;
+            const double target = fraction * static_cast<double>(total);
+            uint64_t cumulative = 0;
+            for (int bucket = 0; bucket < LOCK_HISTOGRAM_BUCKETS; ++bucket) {
+                cumulative += histogram[bucket];
+                if (static_cast<double>(cumulative) >= target) return bucketUpperBound(bucket);
+            }
+            return bucketUpperBound(LOCK_HISTOGRAM_BUCKETS - 1);
+        }
+
+        double toMilliseconds(uint64_t ns) {
+            return static_cast<double>(ns) / 1.0e6;
+        }
+    } // namespace
+
+    void LockCounters::add(const LockCounters& other) {
+        acquisitions += other.acquisitions;
+        contended += other.contended;
+        shared_acquisitions += other.shared_acquisitions;
+        wait_ns += other.wait_ns;
+        max_wait_ns = std::max(max_wait_ns, other.max_wait_ns);
+        hold_ns += other.hold_ns;
+        max_hold_ns = std::max(max_hold_ns, other.max_hold_ns);
+        for (int bucket = 0; bucket < LOCK_HISTOGRAM_BUCKETS; ++bucket) {
+            wait_histogram[bucket] += other.wait_histogram[bucket];
+            hold_histogram[bucket] += other.hold_histogram[bucket];
+        }
+    }
+
+    void LockStats::tagCurrentThread(const std::string& thread_name) {
+        LockRegistry& lock_registry = registry();
+        std::lock_guard<std::mutex> lock(lock_registry.mutex);
+        // 线程名随线程表保留到进程结束
+        static std::vector<std::unique_ptr<std::string>>* tags = new std::vector<std::unique_ptr<std::string>>();
+        tags->push_back(std::make_unique<std::string>(thread_name));
+        thread_tag = tags->back().get();
+        if (thread_table != nullptr) {
+            thread_table->thread_name = thread_name;
+        }
+    }
+
+    int LockStats::registerSite(const char* name) {
+        LockRegistry& lock_registry = registry();
+        std::lock_guard<std::mutex> lock(lock_registry.mutex);
+        for (size_t site = 0; site < lock_registry.site_names.size(); ++site) {
+            if (lock_registry.site_names[site] == name) {
+                return static_cast<int>(site);
+            }
+        }
+        if (lock_registry.site_names.size() + 1 >= static_cast<size_t>(MAX_LOCK_SITES)) {
+            if (lock_registry.site_names.size() + 1 == static_cast<size_t>(MAX_LOCK_SITES)) {
+                lock_registry.site_names.push_back("(other)");
+            }
+            return MAX_LOCK_SITES - 1;
+        }
+        lock_registry.site_names.push_back(name);
+        return static_cast<int>(lock_registry.site_names.size() - 1);
+    }
+
+    void LockStats::recordAcquire(int site, bool shared, bool contended, uint64_t wait_ns) {
+        AtomicLockCounters& counters = currentTable().sites[site];
+        increment(counters.acquisitions, 1);
+        if (shared) {
+            increment(counters.shared_acquisitions, 1);
+        }
+        if (contended) {
+            increment(counters.contended, 1);
+            increment(counters.wait_ns, wait_ns);
+            raiseMax(counters.max_wait_ns, wait_ns);
+            increment(counters.wait_histogram[histogramBucket(wait_ns)], 1);
+        }
+    }
+
+    void LockStats::recordRelease(int site, uint64_t hold_ns) {
+        AtomicLockCounters& counters = currentTable().sites[site];
+        increment(counters.hold_ns, hold_ns);
+        raiseMax(counters.max_hold_ns, hold_ns);
+        increment(counters.hold_histogram[histogramBucket(hold_ns)], 1);
+    }
+
+    void LockStats::beginSharedHold(const void* mutex, uint64_t now_ns) {
+        if (shared_hold_count < MAX_SHARED_HOLDS) {
+            shared_holds[shared_hold_count++] = SharedHold{mutex, now_ns};
+        }
+    }
+
+    uint64_t LockStats::endSharedHold(const void* mutex, uint64_t now_ns) {
+        for (int i = shared_hold_count - 1; i >= 0; --i) {
+            if (shared_holds[i].mutex == mutex) {
+                const uint64_t held = now_ns - shared_holds[i].start_ns;
+                shared_holds[i] = shared_holds[--shared_hold_count];
+                return held;
+            }
+        }
+        return 0;
+    }
+
+    uint64_t LockStats::nowNanos() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    std::vector<LockSiteStats> LockStats::snapshot() {
+        LockRegistry& lock_registry = registry();
+        std::vector<LockSiteStats> result;
+        {
+            std::lock_guard<std::mutex> lock(lock_registry.mutex);
+            result.resize(lock_registry.site_names.size());
+            for (size_t site = 0; site < lock_registry.site_names.size(); ++site) {
+                LockSiteStats& stats = result[site];
+                stats.name = lock_registry.site_names[site];
+                for (const ThreadLockTable* table : lock_registry.tables) {
+                    LockCounters counters;
+                    load(table->sites[site], counters);
+                    if (counters.acquisitions == 0) {
+                        continue;
+                    }
+                    stats.totals.add(counters);
+                    // 同名线程（如多个未标记线程、先后创建的同名线程）合并为一行
+                    auto same_name = std::find_if(stats.threads.begin(), stats.threads.end(),
+                                                  [table](const std::pair<std::string, LockCounters>& thread) {
+                                                      return thread.first == table->thread_name;
+                                                  });
+                    if (same_name != stats.threads.end()) {
+                        same_name->second.add(counters);
+                    } else {
+                        stats.threads.emplace_back(table->thread_name, counters);
+                    }
+                }
+            }
+        }
+        std::stable_sort(result.begin(), result.end(), [](const LockSiteStats& a, const LockSiteStats& b) {
+            if (a.totals.wait_ns != b.totals.wait_ns) return a.totals.wait_ns > b.totals.wait_ns;
+            return a.totals.hold_ns > b.totals.hold_ns;
+        });
+        return result;
+    }
+
+    void LockStats::resetStatistics() {
+        LockRegistry& lock_registry = registry();
+        std::lock_guard<std::mutex> lock(lock_registry.mutex);
+        for (ThreadLockTable* table : lock_registry.tables) {
+            for (AtomicLockCounters& counters : table->sites) {
+                counters.acquisitions.store(0, std::memory_order_relaxed);
+                counters.contended.store(0, std::memory_order_relaxed);
+                counters.shared_acquisitions.store(0, std::memory_order_relaxed);
+                counters.wait_ns.store(0, std::memory_order_relaxed);
+                counters.max_wait_ns.store(0, std::memory_order_relaxed);
+                counters.hold_ns.store(0, std::memory_order_relaxed);
+                counters.max_hold_ns.store(0, std::memory_order_relaxed);
+                for (int bucket = 0; bucket < LOCK_HISTOGRAM_BUCKETS; ++bucket) {
+                    counters.wait_histogram[bucket].store(0, std::memory_order_relaxed);
+                    counters.hold_histogram[bucket].store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    std::string LockStats::formatSummary() {
+        std::vector<LockSiteStats> sites = snapshot();
+        sites.erase(std::remove_if(sites.begin(), sites.end(),
+                                   [](const LockSiteStats& stats) { return stats.totals.acquisitions == 0; }),
+                    sites.end());
+        std::ostringstream summary;
+        summary << std::fixed << std::setprecision(3);
+        summary << "锁统计: " << sites.size() << " 个锁（按等待时间合计排序）\n";
+        int rank = 0;
+        for (const auto& stats : sites) {
+            const LockCounters& totals = stats.totals;
+            summary << "[" << ++rank << "] " << stats.name << "\n";
+            summary << "    加锁 " << totals.acquisitions << " 次（共享 " << totals.shared_acquisitions << " 次），竞争 "
+                    << totals.contended << " 次 ("
+                    << (totals.acquisitions ? 100.0 * static_cast<double>(totals.contended) / static_cast<double>(totals.acquisitions) : 0.0)
+                    << "%)\n";
+            summary << "    等待: 合计 " << toMilliseconds(totals.wait_ns) << " ms，平均 "
+                    << (totals.contended ? totals.wait_ns / totals.contended : 0) << " ns/次竞争，p99 <= "
+                    << percentile(totals.wait_histogram, 0.99) << " ns，最大 " << totals.max_wait_ns << " ns\n";
+            summary << "    持有: 合计 " << toMilliseconds(totals.hold_ns) << " ms，平均 "
+                    << (totals.acquisitions ? totals.hold_ns / totals.acquisitions : 0) << " ns，p99 <= "
+                    << percentile(totals.hold_histogram, 0.99) << " ns，最大 " << totals.max_hold_ns << " ns\n";
+            for (const auto& thread : stats.threads) {
+                const LockCounters& counters = thread.second;
+                summary << "    线程 " << thread.first << ": 加锁 " << counters.acquisitions << "，竞争 " << counters.contended
+                        << "，等待 " << toMilliseconds(counters.wait_ns) << " ms，持有 " << toMilliseconds(counters.hold_ns) << " ms\n";
+            }
+        }
+        return summary.str();
+    }
+
+    bool LockStats::writeReport(const std::string& summary_path, const std::string& histogram_path) {
+        std::ofstream summary(summary_path);
+        if (!summary.is_open()) {
+            return false;
+        }
+        summary << formatSummary();
+
+        if (!histogram_path.empty()) {
+            std::ofstream histogram(histogram_path);
+            if (!histogram.is_open()) {
+                return false;
+            }
+            histogram << "lock,thread,kind,bucket_upper_ns,count\n";
+            for (const auto& stats : snapshot()) {
+                for (const auto& thread : stats.threads) {
+                    const std::pair<const char*, const uint64_t*> kinds[] = {
+                        {"wait", thread.second.wait_histogram}, {"hold", thread.second.hold_histogram}};
+                    for (const auto& kind : kinds) {
+                        for (int bucket = 0; bucket < LOCK_HISTOGRAM_BUCKETS; ++bucket) {
+                            if (kind.second[bucket] != 0) {
+                                histogram << stats.name << ',' << thread.first << ',' << kind.first << ','
+                                          << bucketUpperBound(bucket) << ',' << kind.second[bucket] << '\n';
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+} // namespace SimManage
+} // namespace VFT_SMF
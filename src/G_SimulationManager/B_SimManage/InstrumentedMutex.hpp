@@ -0,0 +1,255 @@
+/**
+ * @file InstrumentedMutex.hpp
+ * @brief 带锁竞争与等待/持有时间统计的互斥锁
+ * @details 共享数据相关的锁（双缓冲交换、事件队列、代理事件队列管理器、日志记录环、数据记录器、
+ *          数据来源驻留表、ServiceTwin 状态、仿真时钟）统一声明为带名称的 InstrumentedMutex /
+ *          InstrumentedSharedMutex，同名的多个实例合并统计：
+ *              mutable InstrumentedMutex queue_mutex{"EventQueue.queue"};
+ *              std::lock_guard<InstrumentedMutex> lock(queue_mutex);
+ *          与条件变量配合时使用 InstrumentedConditionVariable 与 InstrumentedUniqueLock。
+ *
+ *          编译期开关 VFT_ENABLE_LOCK_STATS（须所有翻译单元一致）：
+ *          - 0（默认）：InstrumentedMutex 即 std::mutex（派生、无额外成员），条件变量为 std::condition_variable；
+ *          - 1：每次加锁先 try_lock，失败记为一次竞争并计时等待；解锁时记录持有时间。
+ *            按锁名、按线程（共享数据空间注册时的线程名）统计加锁次数、竞争次数、
+ *            等待时间与持有时间（对数分桶直方图），由 LockStats 排序输出。
+ *          两种实现位于不同的内联命名空间，因此包装类本身不会冲突；但 DoubleBuffer<T>、EventQueue、Logger 等
+ *          以成员形式内嵌这些锁，其布局随开关变化，包含这些头文件的所有翻译单元必须使用相同的开关值。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+// 锁统计开关（编译期）：0 关闭（默认），1 开启
+#ifndef VFT_ENABLE_LOCK_STATS
+#define VFT_ENABLE_LOCK_STATS 0
+#endif
+
+namespace VFT_SMF {
+    namespace SimManage {
+
+        constexpr int LOCK_HISTOGRAM_BUCKETS = 32;   ///< 第 i 桶: [2^(i-1), 2^i) ns，第 0 桶: 0 ns，末桶含更长时间
+
+        /**
+         * @brief 一组锁统计（某个锁在某个线程上，或合计）
+         */
+        struct LockCounters {
+            uint64_t acquisitions = 0;           ///< 加锁次数（含共享加锁）
+            uint64_t contended = 0;              ///< try_lock 失败后阻塞等待的次数
+            uint64_t shared_acquisitions = 0;    ///< 其中共享加锁次数
+            uint64_t wait_ns = 0;                ///< 等待时间合计
+            uint64_t max_wait_ns = 0;
+            uint64_t hold_ns = 0;                ///< 持有时间合计
+            uint64_t max_hold_ns = 0;
+            uint64_t wait_histogram[LOCK_HISTOGRAM_BUCKETS] = {};   ///< 仅竞争加锁
+            uint64_t hold_histogram[LOCK_HISTOGRAM_BUCKETS] = {};
+
+            void add(const LockCounters& other);
+        };
+
+        /**
+         * @brief 单个锁（按名称合并）的统计
+         */
+        struct LockSiteStats {
+            std::string name;
+            LockCounters totals;
+            std::vector<std::pair<std::string, LockCounters>> threads;   ///< 线程名 -> 该线程上的统计（同名线程合并）
+        };
+
+        /**
+         * @brief 锁统计注册表与报告（全部为静态接口；VFT_ENABLE_LOCK_STATS=0 时没有数据）
+         */
+        class LockStats {
+        public:
+            static constexpr bool compiledIn() { return VFT_ENABLE_LOCK_STATS != 0; }
+
+            /**
+             * @brief 以线程名标记当前线程，之后的加锁计入该线程（未标记的线程记为 "untagged"）
+             */
+            static void tagCurrentThread(const std::string& thread_name);
+
+            /**
+             * @brief 登记锁名，返回锁编号（同名返回同一编号）
+             */
+            static int registerSite(const char* name);
+
+            // 由 InstrumentedMutex 调用
+            static void recordAcquire(int site, bool shared, bool contended, uint64_t wait_ns);
+            static void recordRelease(int site, uint64_t hold_ns);
+            static void beginSharedHold(const void* mutex, uint64_t now_ns);
+            static uint64_t endSharedHold(const void* mutex, uint64_t now_ns);
+
+            /**
+             * @brief 各锁统计快照，按等待时间合计降序（再按持有时间）
+             */
+            static std::vector<LockSiteStats> snapshot();
+
+            /**
+             * @brief 清空所有统计（锁名与线程标签保留）
+             */
+            static void resetStatistics();
+
+            /**
+             * @brief 按代价排序的汇总文本
+             */
+            static std::string formatSummary();
+
+            /**
+             * @brief 写出统计报告
+             * @param summary_path 汇总（文本）
+             * @param histogram_path 直方图 CSV（lock,thread,kind,bucket_upper_ns,count），为空时不写
+             */
+            static bool writeReport(const std::string& summary_path, const std::string& histogram_path);
+
+            static int histogramBucket(uint64_t ns) {
+                if (ns == 0) return 0;
+                const int bucket = 64 - __builtin_clzll(ns);
+                return bucket < LOCK_HISTOGRAM_BUCKETS ? bucket : LOCK_HISTOGRAM_BUCKETS - 1;
+            }
+
+            static uint64_t nowNanos();
+        };
+
+#if VFT_ENABLE_LOCK_STATS
+        inline namespace lock_stats_enabled {
+
+            /**
+             * @brief 带统计的互斥锁
+             */
+            class InstrumentedMutex {
+            public:
+                explicit InstrumentedMutex(const char* name) : site(LockStats::registerSite(name)) {}
+                InstrumentedMutex(const InstrumentedMutex&) = delete;
+                InstrumentedMutex& operator=(const InstrumentedMutex&) = delete;
+
+                void lock() {
+                    if (mutex.try_lock()) {
+                        LockStats::recordAcquire(site, false, false, 0);
+                    } else {
+                        const uint64_t start = LockStats::nowNanos();
+                        mutex.lock();
+                        LockStats::recordAcquire(site, false, true, LockStats::nowNanos() - start);
+                    }
+                    hold_start = LockStats::nowNanos();
+                }
+
+                bool try_lock() {
+                    if (!mutex.try_lock()) return false;
+                    LockStats::recordAcquire(site, false, false, 0);
+                    hold_start = LockStats::nowNanos();
+                    return true;
+                }
+
+                void unlock() {
+                    const uint64_t held = LockStats::nowNanos() - hold_start;
+                    mutex.unlock();
+                    LockStats::recordRelease(site, held);
+                }
+
+            private:
+                std::mutex mutex;
+                int site;
+                uint64_t hold_start = 0;   ///< 仅持锁线程读写
+            };
+
+            /**
+             * @brief 带统计的读写锁（共享持有时间按线程记录）
+             */
+            class InstrumentedSharedMutex {
+            public:
+                explicit InstrumentedSharedMutex(const char* name) : site(LockStats::registerSite(name)) {}
+                InstrumentedSharedMutex(const InstrumentedSharedMutex&) = delete;
+                InstrumentedSharedMutex& operator=(const InstrumentedSharedMutex&) = delete;
+
+                void lock() {
+                    if (mutex.try_lock()) {
+                        LockStats::recordAcquire(site, false, false, 0);
+                    } else {
+                        const uint64_t start = LockStats::nowNanos();
+                        mutex.lock();
+                        LockStats::recordAcquire(site, false, true, LockStats::nowNanos() - start);
+                    }
+                    hold_start = LockStats::nowNanos();
+                }
+
+                bool try_lock() {
+                    if (!mutex.try_lock()) return false;
+                    LockStats::recordAcquire(site, false, false, 0);
+                    hold_start = LockStats::nowNanos();
+                    return true;
+                }
+
+                void unlock() {
+                    const uint64_t held = LockStats::nowNanos() - hold_start;
+                    mutex.unlock();
+                    LockStats::recordRelease(site, held);
+                }
+
+                void lock_shared() {
+                    if (mutex.try_lock_shared()) {
+                        LockStats::recordAcquire(site, true, false, 0);
+                    } else {
+                        const uint64_t start = LockStats::nowNanos();
+                        mutex.lock_shared();
+                        LockStats::recordAcquire(site, true, true, LockStats::nowNanos() - start);
+                    }
+                    LockStats::beginSharedHold(this, LockStats::nowNanos());
+                }
+
+                bool try_lock_shared() {
+                    if (!mutex.try_lock_shared()) return false;
+                    LockStats::recordAcquire(site, true, false, 0);
+                    LockStats::beginSharedHold(this, LockStats::nowNanos());
+                    return true;
+                }
+
+                void unlock_shared() {
+                    const uint64_t held = LockStats::endSharedHold(this, LockStats::nowNanos());
+                    mutex.unlock_shared();
+                    LockStats::recordRelease(site, held);
+                }
+
+            private:
+                std::shared_mutex mutex;
+                int site;
+                uint64_t hold_start = 0;   ///< 独占持有开始时间，仅持锁线程读写
+            };
+
+            using InstrumentedConditionVariable = std::condition_variable_any;
+            using InstrumentedUniqueLock = std::unique_lock<InstrumentedMutex>;
+
+        } // inline namespace lock_stats_enabled
+#else
+        inline namespace lock_stats_disabled {
+
+            /**
+             * @brief 关闭统计时即 std::mutex（名称仅用于开启统计时）
+             */
+            class InstrumentedMutex : public std::mutex {
+            public:
+                explicit constexpr InstrumentedMutex(const char*) noexcept {}
+            };
+
+            class InstrumentedSharedMutex : public std::shared_mutex {
+            public:
+                explicit InstrumentedSharedMutex(const char*) {}
+            };
+
+            using InstrumentedConditionVariable = std::condition_variable;
+            using InstrumentedUniqueLock = std::unique_lock<std::mutex>;
+
+            static_assert(sizeof(InstrumentedMutex) == sizeof(std::mutex), "关闭统计时 InstrumentedMutex 应与 std::mutex 等价");
+
+        } // inline namespace lock_stats_disabled
+#endif
+
+    } // namespace SimManage
+} // namespace VFT_SMF
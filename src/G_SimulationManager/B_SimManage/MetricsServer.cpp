@@ -0,0 +1,220 @@
+/**
+ * @file MetricsServer.cpp
+ * @brief 本机指标端点实现
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include "MetricsServer.hpp"
+
+#include <cstring>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <cerrno>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+namespace VFT_SMF {
+namespace SimManage {
+
+    namespace {
+#ifdef _WIN32
+        using SocketHandle = SOCKET;
+        const SocketHandle INVALID_HANDLE = INVALID_SOCKET;
+
+        void closeSocket(SocketHandle socket_handle) { closesocket(socket_handle); }
+
+        std::string lastSocketError() { return "Winsock 错误 " + std::to_string(WSAGetLastError()); }
+#else
+        using SocketHandle = int;
+        const SocketHandle INVALID_HANDLE = -1;
+
+        void closeSocket(SocketHandle socket_handle) { close(socket_handle); }
+
+        std::string lastSocketError() { return std::strerror(errno); }
+#endif
+
+        constexpr int POLL_INTERVAL_MS = 200;      ///< 检查停止标志的间隔
+        constexpr int CLIENT_TIMEOUT_MS = 1000;    ///< 读取请求的超时
+        constexpr size_t MAX_REQUEST_BYTES = 8192;
+
+        /**
+         * @brief 等待监听套接字可读（有连接到达），超时返回 false
+         */
+        bool waitReadable(SocketHandle socket_handle, int timeout_ms) {
+#ifdef _WIN32
+            fd_set read_set;
+            FD_ZERO(&read_set);
+            FD_SET(socket_handle, &read_set);
+            timeval timeout{timeout_ms / 1000, (timeout_ms % 1000) * 1000};
+            return select(0, &read_set, nullptr, nullptr, &timeout) > 0;
+#else
+            pollfd descriptor{socket_handle, POLLIN, 0};
+            return poll(&descriptor, 1, timeout_ms) > 0 && (descriptor.revents & POLLIN) != 0;
+#endif
+        }
+
+        void setReceiveTimeout(SocketHandle socket_handle, int timeout_ms) {
+#ifdef _WIN32
+            DWORD timeout = static_cast<DWORD>(timeout_ms);
+            setsockopt(socket_handle, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&timeout), sizeof(timeout));
+#else
+            timeval timeout{timeout_ms / 1000, (timeout_ms % 1000) * 1000};
+            setsockopt(socket_handle, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+#endif
+        }
+
+        void sendAll(SocketHandle socket_handle, const std::string& data) {
+            size_t sent = 0;
+            while (sent < data.size()) {
+#ifdef _WIN32
+                const int result = send(socket_handle, data.data() + sent, static_cast<int>(data.size() - sent), 0);
+#else
+                const ssize_t result = send(socket_handle, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+#endif
+                if (result <= 0) return;
+                sent += static_cast<size_t>(result);
+            }
+        }
+
+        std::string statusResponse(const char* status, const std::string& body, const char* content_type) {
+            std::string response = "HTTP/1.1 ";
+            response += status;
+            response += "\r\nContent-Type: ";
+            response += content_type;
+            response += "\r\nContent-Length: ";
+            response += std::to_string(body.size());
+            response += "\r\nConnection: close\r\n\r\n";
+            response += body;
+            return response;
+        }
+    }
+
+    MetricsServer::~MetricsServer() {
+        stop();
+    }
+
+    bool MetricsServer::start(uint16_t port, RenderFunction render, std::string& error) {
+        if (running.load()) {
+            error = "指标端点已在运行";
+            return false;
+        }
+#ifdef _WIN32
+        WSADATA wsa_data;
+        if (WSAStartup(MAKEWORD(2, 2), &wsa_data) != 0) {
+            error = "WSAStartup 失败";
+            return false;
+        }
+#endif
+        const SocketHandle socket_handle = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        if (socket_handle == INVALID_HANDLE) {
+            error = "创建套接字失败: " + lastSocketError();
+#ifdef _WIN32
+            WSACleanup();
+#endif
+            return false;
+        }
+
+        // 允许重启后立即重新绑定（TIME_WAIT），但不允许与仍在监听的进程共用端口
+        const int option = 1;
+#ifdef _WIN32
+        setsockopt(socket_handle, SOL_SOCKET, SO_EXCLUSIVEADDRUSE, reinterpret_cast<const char*>(&option), sizeof(option));
+#else
+        setsockopt(socket_handle, SOL_SOCKET, SO_REUSEADDR, &option, sizeof(option));
+#endif
+
+        sockaddr_in address;
+        std::memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);   // 只接受本机连接
+        address.sin_port = htons(port);
+        if (bind(socket_handle, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+            listen(socket_handle, 8) != 0) {
+            error = "绑定 127.0.0.1:" + std::to_string(port) + " 失败: " + lastSocketError();
+            closeSocket(socket_handle);
+#ifdef _WIN32
+            WSACleanup();
+#endif
+            return false;
+        }
+
+        socklen_t address_length = sizeof(address);
+        getsockname(socket_handle, reinterpret_cast<sockaddr*>(&address), &address_length);
+        bound_port = ntohs(address.sin_port);
+
+        listen_socket = static_cast<intptr_t>(socket_handle);
+        render_function = std::move(render);
+        running.store(true);
+        server_thread = std::thread(&MetricsServer::serveLoop, this);
+        return true;
+    }
+
+    void MetricsServer::stop() {
+        if (!running.exchange(false)) return;
+        if (server_thread.joinable()) {
+            server_thread.join();
+        }
+        closeSocket(static_cast<SocketHandle>(listen_socket));
+        listen_socket = -1;
+#ifdef _WIN32
+        WSACleanup();
+#endif
+    }
+
+    std::string MetricsServer::buildResponse(const std::string& request, const RenderFunction& render) {
+        // 只看请求行："GET /metrics HTTP/1.1"，忽略查询串与请求头
+        const size_t line_end = request.find("\r\n");
+        const std::string request_line = request.substr(0, line_end);
+        const size_t method_end = request_line.find(' ');
+        if (method_end == std::string::npos) {
+            return statusResponse("400 Bad Request", "bad request\n", "text/plain; charset=utf-8");
+        }
+        const std::string method = request_line.substr(0, method_end);
+        const size_t target_end = request_line.find(' ', method_end + 1);
+        std::string target = request_line.substr(method_end + 1, target_end == std::string::npos ? std::string::npos
+                                                                                                  : target_end - method_end - 1);
+        target = target.substr(0, target.find('?'));
+
+        if (method != "GET") {
+            return statusResponse("405 Method Not Allowed", "only GET is supported\n", "text/plain; charset=utf-8");
+        }
+        if (target != "/metrics") {
+            return statusResponse("404 Not Found", "see /metrics\n", "text/plain; charset=utf-8");
+        }
+        return statusResponse("200 OK", render ? render() : std::string(), "text/plain; version=0.0.4; charset=utf-8");
+    }
+
+    void MetricsServer::serveLoop() {
+        const SocketHandle socket_handle = static_cast<SocketHandle>(listen_socket);
+        std::string request;
+        char buffer[1024];
+        while (running.load()) {
+            if (!waitReadable(socket_handle, POLL_INTERVAL_MS)) continue;
+            const SocketHandle client = accept(socket_handle, nullptr, nullptr);
+            if (client == INVALID_HANDLE) continue;
+
+            setReceiveTimeout(client, CLIENT_TIMEOUT_MS);
+            request.clear();
+            while (request.find("\r\n\r\n") == std::string::npos && request.size() < MAX_REQUEST_BYTES) {
+                const int received = static_cast<int>(recv(client, buffer, sizeof(buffer), 0));
+                if (received <= 0) break;
+                request.append(buffer, static_cast<size_t>(received));
+            }
+            if (!request.empty()) {
+                sendAll(client, buildResponse(request, render_function));
+                requests.fetch_add(1);
+            }
+            closeSocket(client);
+        }
+    }
+
+} // namespace SimManage
+} // namespace VFT_SMF
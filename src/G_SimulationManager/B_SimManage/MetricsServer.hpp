@@ -0,0 +1,70 @@
+/**
+ * @file MetricsServer.hpp
+ * @brief 本机指标端点（最小 HTTP 服务）
+ * @details 单个后台线程在 127.0.0.1 上监听，只处理 "GET /metrics"（其他路径返回 404），
+ *          每次请求调用渲染函数生成 Prometheus 文本格式并以 Connection: close 应答。
+ *          请求逐个处理，渲染在后台线程中进行，不影响代理线程与时钟线程。
+ *          不依赖第三方库：Linux 使用 BSD socket，Windows 使用 Winsock（需链接 ws2_32）。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+
+namespace VFT_SMF {
+    namespace SimManage {
+
+        /**
+         * @brief 指标端点
+         */
+        class MetricsServer {
+        public:
+            using RenderFunction = std::function<std::string()>;
+
+            MetricsServer() = default;
+            ~MetricsServer();
+            MetricsServer(const MetricsServer&) = delete;
+            MetricsServer& operator=(const MetricsServer&) = delete;
+
+            /**
+             * @brief 绑定 127.0.0.1:port 并启动后台线程
+             * @param port 端口，0 表示由系统分配（见 getPort()）
+             * @param render 生成指标文本，在后台线程中调用
+             * @param error 失败原因
+             * @return 是否成功（端口被占用等情况下返回 false，仿真照常运行）
+             */
+            bool start(uint16_t port, RenderFunction render, std::string& error);
+
+            /**
+             * @brief 停止后台线程并关闭监听
+             */
+            void stop();
+
+            bool isRunning() const { return running.load(); }
+            uint16_t getPort() const { return bound_port; }
+            uint64_t getRequestCount() const { return requests.load(); }
+
+            /**
+             * @brief 根据请求行生成完整 HTTP 应答
+             */
+            static std::string buildResponse(const std::string& request, const RenderFunction& render);
+
+        private:
+            void serveLoop();
+
+            RenderFunction render_function;
+            std::thread server_thread;
+            std::atomic<bool> running{false};
+            std::atomic<uint64_t> requests{0};
+            intptr_t listen_socket = -1;
+            uint16_t bound_port = 0;
+        };
+
+    } // namespace SimManage
+} // namespace VFT_SMF
@@ -0,0 +1,493 @@
+/**
+ * @file PerfCounterProfiler.cpp
+ * @brief 性能计数器统计实现（Linux: perf_event_open 计数器组）
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include "PerfCounterProfiler.hpp"
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace VFT_SMF {
+namespace SimManage {
+
+    namespace {
+        constexpr int MAX_STEP_PHASES = 8;   ///< 单步内最多记录的命名阶段数，超出的阶段不计
+        constexpr uint64_t RESERVED_SAMPLES_PER_STEP = 4;   ///< 逐步明细每步预留条数：wait、step 与两个命名阶段
+
+        /**
+         * @brief 已打开线程的统计记录（线程结束后保留，供报告使用）
+         */
+        struct ThreadRecord {
+            std::mutex mutex;                 ///< 所属线程结算与 snapshot() 读取互斥
+            ThreadPerfCounterStats stats;
+        };
+
+        /**
+         * @brief 本步尚未结算的命名阶段
+         */
+        struct PendingPhase {
+            const char* name;
+            uint64_t samples;
+            PerfCounterValues values;
+        };
+
+        /**
+         * @brief 线程局部状态
+         */
+        struct ThreadState {
+            ThreadRecord* record = nullptr;
+            int group_fd = -1;
+            int fds[PERF_COUNTER_COUNT] = {-1, -1, -1, -1, -1, -1};
+            int slots[PERF_COUNTER_COUNT] = {-1, -1, -1, -1, -1, -1};   ///< 计数器在组读取结果中的位置
+            int opened = 0;
+            bool multiplexed = false;
+            PerfCounterValues last;          ///< 上一个阶段边界的读数
+            uint64_t step = 0;
+            bool started = false;            ///< 是否已有第一次 beginStep()
+            bool in_step = false;
+            bool has_wait = false;
+            PerfCounterValues wait_values;
+            PendingPhase pending[MAX_STEP_PHASES];
+            int pending_count = 0;
+        };
+
+        thread_local ThreadState thread_state;
+        std::atomic<int> profiler_mode{static_cast<int>(PerfCounterMode::Off)};
+        std::atomic<uint64_t> reserved_steps{0};
+
+        std::mutex& registryMutex() {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        std::vector<std::unique_ptr<ThreadRecord>>& registry() {
+            static std::vector<std::unique_ptr<ThreadRecord>> records;
+            return records;
+        }
+
+        const char* const COUNTER_NAMES[PERF_COUNTER_COUNT] = {
+            "cycles", "instructions", "cache_misses", "branch_misses", "context_switches", "task_clock_ns"
+        };
+
+#if defined(__linux__)
+        struct CounterEvent {
+            uint32_t type;
+            uint64_t config;
+        };
+
+        const CounterEvent COUNTER_EVENTS[PERF_COUNTER_COUNT] = {
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+            {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES},
+            {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK}
+        };
+
+        int openCounter(const CounterEvent& event, int group_fd, bool user_only) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = event.type;
+            attr.config = event.config;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            attr.exclude_kernel = user_only ? 1 : 0;
+            attr.exclude_hv = 1;
+            // pid = 0, cpu = -1：只统计调用线程，随线程在任意 CPU 上计数
+            return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, PERF_FLAG_FD_CLOEXEC));
+        }
+#endif
+
+        /**
+         * @brief 一次读出整组计数器
+         */
+        void readCounters(ThreadState& state, PerfCounterValues& values) {
+#if defined(__linux__)
+            if (state.group_fd < 0) {
+                return;
+            }
+            uint64_t buffer[3 + PERF_COUNTER_COUNT] = {};
+            if (read(state.group_fd, buffer, sizeof(buffer)) < static_cast<ssize_t>((3 + state.opened) * sizeof(uint64_t))) {
+                return;
+            }
+            if (buffer[2] < buffer[1]) {
+                state.multiplexed = true;
+            }
+            for (int counter = 0; counter < PERF_COUNTER_COUNT; ++counter) {
+                if (state.slots[counter] >= 0) {
+                    values.values[counter] = buffer[3 + state.slots[counter]];
+                }
+            }
+#else
+            (void)state;
+            (void)values;
+#endif
+        }
+
+        PerfCounterValues difference(const PerfCounterValues& later, const PerfCounterValues& earlier) {
+            PerfCounterValues delta;
+            for (int counter = 0; counter < PERF_COUNTER_COUNT; ++counter) {
+                delta.values[counter] = later.values[counter] - earlier.values[counter];
+            }
+            return delta;
+        }
+
+        /**
+         * @brief 当前边界到上一边界之间的计数，并把当前读数作为新边界
+         */
+        PerfCounterValues advance(ThreadState& state) {
+            PerfCounterValues now = state.last;
+            readCounters(state, now);
+            const PerfCounterValues delta = difference(now, state.last);
+            state.last = now;
+            return delta;
+        }
+
+        uint32_t phaseIndex(ThreadPerfCounterStats& stats, const char* name) {
+            for (size_t i = 0; i < stats.phases.size(); ++i) {
+                if (stats.phases[i].phase == name) {
+                    return static_cast<uint32_t>(i);
+                }
+            }
+            stats.phases.push_back(PerfPhaseStats{name, 0, PerfCounterValues{}});
+            return static_cast<uint32_t>(stats.phases.size() - 1);
+        }
+
+        void recordPhase(ThreadPerfCounterStats& stats, const char* name, uint64_t step, uint64_t samples,
+                         const PerfCounterValues& values, bool keep_history) {
+            const uint32_t index = phaseIndex(stats, name);
+            stats.phases[index].samples += samples;
+            stats.phases[index].totals.add(values);
+            if (keep_history) {
+                stats.history.push_back(PerfStepSample{step, index, values});
+            }
+        }
+
+        double perSample(uint64_t total, uint64_t samples) {
+            return samples == 0 ? 0.0 : static_cast<double>(total) / static_cast<double>(samples);
+        }
+
+        double perKiloInstruction(uint64_t total, uint64_t instructions) {
+            return instructions == 0 ? 0.0 : static_cast<double>(total) * 1000.0 / static_cast<double>(instructions);
+        }
+
+        /**
+         * @brief 由 "step" 阶段判断线程的主要瓶颈（经验阈值，仅作排查方向）
+         */
+        std::string classify(const ThreadPerfCounterStats& stats) {
+            const PerfPhaseStats* step_phase = nullptr;
+            for (const auto& phase : stats.phases) {
+                if (phase.phase == "step") step_phase = &phase;
+            }
+            if (step_phase == nullptr || step_phase->samples == 0) {
+                return "无步数据";
+            }
+            const PerfCounterValues& totals = step_phase->totals;
+            if (stats.available[PERF_CONTEXT_SWITCHES] &&
+                perSample(totals.values[PERF_CONTEXT_SWITCHES], step_phase->samples) >= 0.5) {
+                return "调度受限（步内平均上下文切换 >= 0.5 次）";
+            }
+            if (!stats.available[PERF_CYCLES] || !stats.available[PERF_INSTRUCTIONS] || totals.values[PERF_CYCLES] == 0) {
+                return "硬件计数器不可用，无法区分计算/访存受限";
+            }
+            const double ipc = static_cast<double>(totals.values[PERF_INSTRUCTIONS]) / static_cast<double>(totals.values[PERF_CYCLES]);
+            const double cache_mpki = perKiloInstruction(totals.values[PERF_CACHE_MISSES], totals.values[PERF_INSTRUCTIONS]);
+            if (stats.available[PERF_CACHE_MISSES] && ipc < 1.0 && cache_mpki >= 5.0) {
+                return "访存受限（IPC < 1 且 cache-misses >= 5/千指令）";
+            }
+            return "计算受限";
+        }
+
+        std::string optionalValue(bool available, double value) {
+            if (!available) {
+                return "-";
+            }
+            std::ostringstream text;
+            text << std::fixed << std::setprecision(2) << value;
+            return text.str();
+        }
+    } // namespace
+
+    void PerfCounterProfiler::setMode(PerfCounterMode mode) {
+        profiler_mode.store(static_cast<int>(mode), std::memory_order_relaxed);
+    }
+
+    PerfCounterMode PerfCounterProfiler::getMode() {
+        return static_cast<PerfCounterMode>(profiler_mode.load(std::memory_order_relaxed));
+    }
+
+    bool PerfCounterProfiler::parseMode(const std::string& name, PerfCounterMode& mode) {
+        if (name == "off") {
+            mode = PerfCounterMode::Off;
+        } else if (name == "summary") {
+            mode = PerfCounterMode::Summary;
+        } else if (name == "steps") {
+            mode = PerfCounterMode::Steps;
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    void PerfCounterProfiler::reserveSteps(uint64_t step_count) {
+        reserved_steps.store(step_count, std::memory_order_relaxed);
+    }
+
+    const char* PerfCounterProfiler::counterName(int counter) {
+        return counter >= 0 && counter < PERF_COUNTER_COUNT ? COUNTER_NAMES[counter] : "";
+    }
+
+    void PerfCounterProfiler::attachCurrentThread(const std::string& thread_name) {
+        ThreadState& state = thread_state;
+        if (getMode() == PerfCounterMode::Off || state.record != nullptr) {
+            return;
+        }
+        ThreadRecord* record = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(registryMutex());
+            registry().push_back(std::make_unique<ThreadRecord>());
+            record = registry().back().get();
+        }
+        record->stats.thread_name = thread_name;
+        // 注册时一次预留（init、wait、step 与命名阶段），步内结算 push_back 不再扩容
+        record->stats.phases.reserve(3 + MAX_STEP_PHASES);
+        if (getMode() == PerfCounterMode::Steps) {
+            record->stats.history.reserve(reserved_steps.load(std::memory_order_relaxed) * RESERVED_SAMPLES_PER_STEP);
+        }
+
+#if defined(__linux__)
+        // 第一个打开成功的计数器作为组长；内核态计数被拒绝时其余计数器改为仅用户态
+        bool user_only = false;
+        for (int counter = 0; counter < PERF_COUNTER_COUNT; ++counter) {
+            int fd = openCounter(COUNTER_EVENTS[counter], state.group_fd, user_only);
+            if (fd < 0 && !user_only && (errno == EACCES || errno == EPERM)) {
+                user_only = true;
+                fd = openCounter(COUNTER_EVENTS[counter], state.group_fd, user_only);
+            }
+            if (fd < 0) {
+                continue;
+            }
+            if (state.group_fd < 0) {
+                state.group_fd = fd;
+            }
+            state.fds[counter] = fd;
+            state.slots[counter] = state.opened++;
+            record->stats.available[counter] = true;
+        }
+        record->stats.user_only = user_only;
+#endif
+
+        state.record = record;
+        state.last = PerfCounterValues{};
+        readCounters(state, state.last);
+        state.started = false;
+        state.in_step = false;
+        state.has_wait = false;
+        state.pending_count = 0;
+        state.multiplexed = false;
+    }
+
+    void PerfCounterProfiler::detachCurrentThread() {
+        ThreadState& state = thread_state;
+        if (state.record == nullptr) {
+            return;
+        }
+        if (state.in_step) {
+            endStep();
+        }
+        {
+            std::lock_guard<std::mutex> lock(state.record->mutex);
+            state.record->stats.multiplexed = state.multiplexed;
+        }
+#if defined(__linux__)
+        for (int counter = 0; counter < PERF_COUNTER_COUNT; ++counter) {
+            if (state.fds[counter] >= 0) {
+                close(state.fds[counter]);
+            }
+            state.fds[counter] = -1;
+            state.slots[counter] = -1;
+        }
+#endif
+        state.group_fd = -1;
+        state.opened = 0;
+        state.record = nullptr;
+    }
+
+    void PerfCounterProfiler::beginStep(uint64_t step) {
+        ThreadState& state = thread_state;
+        if (state.record == nullptr) {
+            return;
+        }
+        if (state.in_step) {
+            // 上一步未调用 endStep()：到此为止都计入上一步
+            endStep();
+        }
+        const PerfCounterValues delta = advance(state);
+        if (!state.started) {
+            std::lock_guard<std::mutex> lock(state.record->mutex);
+            recordPhase(state.record->stats, "init", step, 1, delta, false);
+            state.started = true;
+        } else {
+            state.wait_values = delta;
+            state.has_wait = true;
+        }
+        state.step = step;
+        state.in_step = true;
+        state.pending_count = 0;
+    }
+
+    void PerfCounterProfiler::endStep() {
+        ThreadState& state = thread_state;
+        if (state.record == nullptr || !state.in_step) {
+            return;
+        }
+        const PerfCounterValues delta = advance(state);
+        const bool keep_history = getMode() == PerfCounterMode::Steps;
+        std::lock_guard<std::mutex> lock(state.record->mutex);
+        ThreadPerfCounterStats& stats = state.record->stats;
+        if (state.has_wait) {
+            recordPhase(stats, "wait", state.step, 1, state.wait_values, keep_history);
+        }
+        recordPhase(stats, "step", state.step, 1, delta, keep_history);
+        for (int i = 0; i < state.pending_count; ++i) {
+            recordPhase(stats, state.pending[i].name, state.step, state.pending[i].samples, state.pending[i].values, keep_history);
+        }
+        ++stats.steps;
+        state.in_step = false;
+        state.has_wait = false;
+        state.pending_count = 0;
+    }
+
+    PerfCounterProfiler::PhaseScope::PhaseScope(const char* phase_name)
+        : phase(phase_name), active(thread_state.record != nullptr && thread_state.in_step) {
+        if (active) {
+            readCounters(thread_state, start);
+        }
+    }
+
+    PerfCounterProfiler::PhaseScope::~PhaseScope() {
+        ThreadState& state = thread_state;
+        if (!active || state.record == nullptr || !state.in_step) {
+            return;
+        }
+        PerfCounterValues end = start;
+        readCounters(state, end);
+        const PerfCounterValues delta = difference(end, start);
+        for (int i = 0; i < state.pending_count; ++i) {
+            if (state.pending[i].name == phase || std::strcmp(state.pending[i].name, phase) == 0) {
+                state.pending[i].values.add(delta);
+                ++state.pending[i].samples;
+                return;
+            }
+        }
+        if (state.pending_count < MAX_STEP_PHASES) {
+            state.pending[state.pending_count++] = PendingPhase{phase, 1, delta};
+        }
+    }
+
+    std::vector<ThreadPerfCounterStats> PerfCounterProfiler::snapshot() {
+        std::vector<ThreadPerfCounterStats> result;
+        std::lock_guard<std::mutex> lock(registryMutex());
+        result.reserve(registry().size());
+        for (const auto& record : registry()) {
+            std::lock_guard<std::mutex> record_lock(record->mutex);
+            result.push_back(record->stats);
+        }
+        return result;
+    }
+
+    std::string PerfCounterProfiler::formatSummary() {
+        std::ostringstream summary;
+        summary << std::fixed << std::setprecision(2);
+        for (const auto& stats : snapshot()) {
+            summary << "线程 " << stats.thread_name << ": 步数 " << stats.steps;
+            std::string unavailable;
+            for (int counter = 0; counter < PERF_COUNTER_COUNT; ++counter) {
+                if (!stats.available[counter]) {
+                    unavailable += (unavailable.empty() ? "" : ",") + std::string(COUNTER_NAMES[counter]);
+                }
+            }
+            if (!unavailable.empty()) summary << "，不可用: " << unavailable;
+            if (stats.user_only) summary << "（仅用户态）";
+            if (stats.multiplexed) summary << "（计数器复用，数值偏小）";
+            summary << "\n";
+
+            const bool* available = stats.available;
+            summary << "  " << std::left << std::setw(16) << "阶段" << std::right
+                    << std::setw(10) << "次数"
+                    << std::setw(16) << "cycles/次"
+                    << std::setw(16) << "instr/次"
+                    << std::setw(8) << "IPC"
+                    << std::setw(16) << "cache-miss/KI"
+                    << std::setw(16) << "branch-miss/KI"
+                    << std::setw(12) << "切换/次"
+                    << std::setw(14) << "CPU us/次" << "\n";
+            for (const auto& phase : stats.phases) {
+                const uint64_t* totals = phase.totals.values;
+                const uint64_t instructions = totals[PERF_INSTRUCTIONS];
+                summary << "  " << std::left << std::setw(16) << phase.phase << std::right
+                        << std::setw(10) << phase.samples
+                        << std::setw(16) << optionalValue(available[PERF_CYCLES], perSample(totals[PERF_CYCLES], phase.samples))
+                        << std::setw(16) << optionalValue(available[PERF_INSTRUCTIONS], perSample(instructions, phase.samples))
+                        << std::setw(8) << optionalValue(available[PERF_CYCLES] && available[PERF_INSTRUCTIONS],
+                                                         perSample(instructions, totals[PERF_CYCLES]))
+                        << std::setw(16) << optionalValue(available[PERF_CACHE_MISSES] && available[PERF_INSTRUCTIONS],
+                                                          perKiloInstruction(totals[PERF_CACHE_MISSES], instructions))
+                        << std::setw(16) << optionalValue(available[PERF_BRANCH_MISSES] && available[PERF_INSTRUCTIONS],
+                                                          perKiloInstruction(totals[PERF_BRANCH_MISSES], instructions))
+                        << std::setw(12) << optionalValue(available[PERF_CONTEXT_SWITCHES], perSample(totals[PERF_CONTEXT_SWITCHES], phase.samples))
+                        << std::setw(14) << optionalValue(available[PERF_TASK_CLOCK], perSample(totals[PERF_TASK_CLOCK], phase.samples) / 1000.0)
+                        << "\n";
+            }
+            summary << "  倾向: " << classify(stats) << "\n";
+        }
+        return summary.str();
+    }
+
+    bool PerfCounterProfiler::writeReport(const std::string& summary_path, const std::string& steps_path) {
+        std::ofstream summary(summary_path);
+        if (!summary.is_open()) {
+            return false;
+        }
+        summary << formatSummary();
+
+        if (!steps_path.empty() && getMode() == PerfCounterMode::Steps) {
+            std::ofstream steps(steps_path);
+            if (!steps.is_open()) {
+                return false;
+            }
+            steps << "thread,step,phase";
+            for (int counter = 0; counter < PERF_COUNTER_COUNT; ++counter) {
+                steps << ',' << COUNTER_NAMES[counter];
+            }
+            steps << '\n';
+            for (const auto& stats : snapshot()) {
+                for (const auto& sample : stats.history) {
+                    steps << stats.thread_name << ',' << sample.step << ',' << stats.phases[sample.phase_index].phase;
+                    for (int counter = 0; counter < PERF_COUNTER_COUNT; ++counter) {
+                        steps << ',';
+                        if (stats.available[counter]) steps << sample.values.values[counter];
+                    }
+                    steps << '\n';
+                }
+            }
+        }
+        return true;
+    }
+
+} // namespace SimManage
+} // namespace VFT_SMF
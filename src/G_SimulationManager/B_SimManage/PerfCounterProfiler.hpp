@@ -0,0 +1,173 @@
+/**
+ * @file PerfCounterProfiler.hpp
+ * @brief 按线程、按步、按阶段的硬件性能计数器统计
+ * @details PerfCounterProfiler.cpp 在 Linux 上用 perf_event_open 为每个代理线程打开一组计数器
+ *          （cycles、instructions、cache-misses、branch-misses、上下文切换、线程 CPU 时间），
+ *          一次 read() 读出整组：
+ *          1. 线程在共享数据空间注册时以线程名打开计数器组，注销时关闭；
+ *          2. 代理线程每步开始时调用 beginStep()，完成本步（置 COMPLETED）前调用 endStep()：
+ *             beginStep() 到 endStep() 计入 "step" 阶段，上一步 endStep() 到本步 beginStep()
+ *             （轮询等待时钟）计入 "wait" 阶段，注册到第一次 beginStep() 计入 "init" 阶段；
+ *          3. PhaseScope 标记步内的命名阶段（与 "step" 重叠，不从中扣除），阶段区间内不分配堆内存；
+ *             steps 模式的逐步明细在线程注册时按 reserveSteps() 给出的步数预留，步内结算不再分配。
+ *
+ *          单个计数器打不开（虚拟机无 PMU、perf_event_paranoid 限制等）时只标记该项不可用，
+ *          内核态计数被拒绝时退回仅统计用户态。其他平台上所有计数器均不可用。
+ *          模式由 SimulationConfig.json 的 perf_counters 选择（off / summary / steps），
+ *          默认 off，此时各接口只多一次线程局部读。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace VFT_SMF {
+    namespace SimManage {
+
+        /**
+         * @brief 性能计数器统计模式
+         */
+        enum class PerfCounterMode {
+            Off,       ///< 不统计
+            Summary,   ///< 按线程、阶段汇总
+            Steps      ///< 汇总，并保留逐步逐阶段明细
+        };
+
+        /**
+         * @brief 计数器种类
+         */
+        enum PerfCounterId {
+            PERF_CYCLES = 0,
+            PERF_INSTRUCTIONS,
+            PERF_CACHE_MISSES,
+            PERF_BRANCH_MISSES,
+            PERF_CONTEXT_SWITCHES,
+            PERF_TASK_CLOCK,          ///< 线程 CPU 时间 (ns)
+            PERF_COUNTER_COUNT
+        };
+
+        /**
+         * @brief 一组计数值
+         */
+        struct PerfCounterValues {
+            uint64_t values[PERF_COUNTER_COUNT] = {};
+
+            void add(const PerfCounterValues& other) {
+                for (int i = 0; i < PERF_COUNTER_COUNT; ++i) values[i] += other.values[i];
+            }
+        };
+
+        /**
+         * @brief 单个阶段的累计
+         */
+        struct PerfPhaseStats {
+            std::string phase;
+            uint64_t samples = 0;            ///< 进入次数
+            PerfCounterValues totals;
+        };
+
+        /**
+         * @brief 单步单阶段的计数
+         */
+        struct PerfStepSample {
+            uint64_t step;
+            uint32_t phase_index;            ///< ThreadPerfCounterStats::phases 下标
+            PerfCounterValues values;
+        };
+
+        /**
+         * @brief 单个线程的计数器统计
+         */
+        struct ThreadPerfCounterStats {
+            std::string thread_name;
+            bool available[PERF_COUNTER_COUNT] = {};   ///< 各计数器是否成功打开
+            bool user_only = false;                    ///< 仅统计用户态
+            bool multiplexed = false;                  ///< 计数器组未全程在 PMU 上运行（数值偏小）
+            uint64_t steps = 0;                        ///< 已结算步数
+            std::vector<PerfPhaseStats> phases;        ///< 按首次出现顺序
+            std::vector<PerfStepSample> history;       ///< steps 模式下的逐步明细
+        };
+
+        /**
+         * @brief 性能计数器统计器（全部为静态接口）
+         */
+        class PerfCounterProfiler {
+        public:
+            static void setMode(PerfCounterMode mode);
+            static PerfCounterMode getMode();
+
+            /**
+             * @brief 解析模式名称（off / summary / steps）
+             * @return 名称无法识别时返回 false，mode 不变
+             */
+            static bool parseMode(const std::string& name, PerfCounterMode& mode);
+
+            /**
+             * @brief 设置预计步数：steps 模式下之后注册的线程按此预留逐步明细容量
+             * @details 每步预留 wait、step 与两个命名阶段；超出预留（步数或阶段更多）时明细按需增长
+             */
+            static void reserveSteps(uint64_t step_count);
+
+            /**
+             * @brief 为当前线程打开计数器组，之后的计数归入该线程
+             */
+            static void attachCurrentThread(const std::string& thread_name);
+
+            /**
+             * @brief 结算当前线程并关闭计数器组
+             */
+            static void detachCurrentThread();
+
+            /**
+             * @brief 步开始：结算等待阶段
+             */
+            static void beginStep(uint64_t step);
+
+            /**
+             * @brief 步内计算结束：结算 "step" 阶段与本步的命名阶段
+             */
+            static void endStep();
+
+            /**
+             * @brief 各线程统计快照（在线程结束后调用可得到完整结果）
+             */
+            static std::vector<ThreadPerfCounterStats> snapshot();
+
+            /**
+             * @brief 各线程各阶段的汇总文本（含计算/访存/调度受限倾向）
+             */
+            static std::string formatSummary();
+
+            /**
+             * @brief 写出统计报告
+             * @param summary_path 汇总（文本）
+             * @param steps_path 逐步明细 CSV，为空或非 steps 模式时不写
+             */
+            static bool writeReport(const std::string& summary_path, const std::string& steps_path);
+
+            static const char* counterName(int counter);
+
+            /**
+             * @brief 步内命名阶段（阶段名须具有静态存储期）
+             */
+            class PhaseScope {
+            public:
+                explicit PhaseScope(const char* phase_name);
+                ~PhaseScope();
+                PhaseScope(const PhaseScope&) = delete;
+                PhaseScope& operator=(const PhaseScope&) = delete;
+
+            private:
+                const char* phase;
+                bool active;
+                PerfCounterValues start;
+            };
+        };
+
+    } // namespace SimManage
+} // namespace VFT_SMF
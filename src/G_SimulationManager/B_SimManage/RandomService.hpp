@@ -0,0 +1,201 @@
+/**
+ * @file RandomService.hpp
+ * @brief 基于计数器的可复现随机数服务（Philox4x32-10）
+ * @details 随机数服务负责：
+ *          1. 以 (运行种子, 代理ID, 仿真步号, 流名称, 抽样序号) 为输入，无状态地生成随机数
+ *          2. 任意一次抽样都可以单独重算，与线程交错顺序无关
+ *          3. 为各随机模型提供按代理/用途划分的独立随机流
+ *
+ *          计数器布局：c0 = 本步内抽样序号, c1 = 仿真步号, c2 = 流名称哈希, c3 = 代理ID哈希；
+ *          密钥为64位运行种子。代理线程在每步开始时调用 setCurrentStep()，
+ *          随机流据此把抽样定位到当前步，并在换步时将抽样序号归零。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace VFT_SMF {
+    namespace SimManage {
+
+        /**
+         * @brief Philox4x32-10 计数器型分组生成器（Salmon et al., SC'11）
+         */
+        class Philox4x32 {
+        public:
+            using Counter = std::array<uint32_t, 4>;
+            using Key = std::array<uint32_t, 2>;
+
+            static Counter generate(Counter counter, Key key) {
+                for (int round = 0; round < 10; ++round) {
+                    if (round > 0) {
+                        key[0] += WEYL_0;
+                        key[1] += WEYL_1;
+                    }
+                    const uint64_t product_0 = static_cast<uint64_t>(MULTIPLIER_0) * counter[0];
+                    const uint64_t product_1 = static_cast<uint64_t>(MULTIPLIER_1) * counter[2];
+                    counter = {
+                        static_cast<uint32_t>(product_1 >> 32) ^ counter[1] ^ key[0],
+                        static_cast<uint32_t>(product_1),
+                        static_cast<uint32_t>(product_0 >> 32) ^ counter[3] ^ key[1],
+                        static_cast<uint32_t>(product_0)
+                    };
+                }
+                return counter;
+            }
+
+        private:
+            static constexpr uint32_t MULTIPLIER_0 = 0xD2511F53u;
+            static constexpr uint32_t MULTIPLIER_1 = 0xCD9E8D57u;
+            static constexpr uint32_t WEYL_0 = 0x9E3779B9u;
+            static constexpr uint32_t WEYL_1 = 0xBB67AE85u;
+        };
+
+        /**
+         * @brief 单个代理/用途的随机流
+         * @details 流本身只保存键与抽样游标，uniformAt()/normalAt() 为纯函数，
+         *          可在任意线程中独立重算某一步的某次抽样。
+         */
+        class RandomStream {
+        private:
+            uint64_t seed;
+            uint32_t agent_key;
+            uint32_t stream_key;
+            uint64_t cursor_step;   ///< 游标所在步号
+            uint32_t cursor_draw;   ///< 游标所在步内抽样序号
+
+            Philox4x32::Counter block(uint64_t step, uint32_t draw) const {
+                return Philox4x32::generate(
+                    {draw, static_cast<uint32_t>(step), stream_key, agent_key},
+                    {static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)});
+            }
+
+            // 53位尾数均匀数，取值 (0, 1]，便于Box-Muller取对数
+            static double toUnitInterval(uint32_t high, uint32_t low) {
+                const uint64_t bits = (static_cast<uint64_t>(high) << 21) ^ (low >> 11);
+                return (static_cast<double>(bits & ((1ull << 53) - 1)) + 1.0) * (1.0 / 9007199254740992.0);
+            }
+
+            uint32_t nextDraw();
+
+        public:
+            RandomStream(uint64_t run_seed, uint32_t agent_hash, uint32_t stream_hash)
+                : seed(run_seed), agent_key(agent_hash), stream_key(stream_hash), cursor_step(0), cursor_draw(0) {}
+
+            /**
+             * @brief 指定步号、抽样序号的 (0, 1] 均匀数
+             */
+            double uniformAt(uint64_t step, uint32_t draw) const {
+                const auto words = block(step, draw);
+                return toUnitInterval(words[0], words[1]);
+            }
+
+            /**
+             * @brief 指定步号、抽样序号的标准正态数（Box-Muller）
+             */
+            double normalAt(uint64_t step, uint32_t draw) const {
+                const auto words = block(step, draw);
+                const double u1 = toUnitInterval(words[0], words[1]);
+                const double u2 = toUnitInterval(words[2], words[3]);
+                return std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+            }
+
+            /**
+             * @brief 批量生成同一步的连续均匀数，各元素相互独立，可被编译器向量化
+             */
+            void fillUniform(uint64_t step, uint32_t first_draw, double* out, std::size_t count) const {
+                for (std::size_t i = 0; i < count; ++i) {
+                    out[i] = uniformAt(step, first_draw + static_cast<uint32_t>(i));
+                }
+            }
+
+            /**
+             * @brief 当前步的下一个 [0, 1) 均匀数
+             */
+            double uniform() {
+                return 1.0 - uniformAt(cursor_step, nextDraw());
+            }
+
+            /**
+             * @brief 当前步的下一个 [min_value, max_value) 均匀数
+             */
+            double uniform(double min_value, double max_value) {
+                return min_value + (max_value - min_value) * uniform();
+            }
+
+            /**
+             * @brief 当前步的下一个正态数
+             */
+            double normal(double mean = 0.0, double stddev = 1.0) {
+                return mean + stddev * normalAt(cursor_step, nextDraw());
+            }
+
+            uint64_t getSeed() const { return seed; }
+            uint32_t getAgentKey() const { return agent_key; }
+            uint32_t getStreamKey() const { return stream_key; }
+        };
+
+        /**
+         * @brief 全局随机数服务：运行种子与每线程当前步号
+         */
+        class RandomService {
+        public:
+            static void setRunSeed(uint64_t run_seed) { runSeedStorage().store(run_seed, std::memory_order_relaxed); }
+            static uint64_t getRunSeed() { return runSeedStorage().load(std::memory_order_relaxed); }
+
+            /**
+             * @brief 代理线程在每个仿真步开始时调用，本线程内的随机流随之定位到该步
+             */
+            static void setCurrentStep(uint64_t step) { currentStepStorage() = step; }
+            static uint64_t getCurrentStep() { return currentStepStorage(); }
+
+            /**
+             * @brief 创建随机流，代理ID与流名称决定其在计数器空间中的位置
+             * @note 应在代理构造时创建并保存，不必每步重新创建
+             */
+            static RandomStream stream(const std::string& agent_id, const std::string& stream_name) {
+                return RandomStream(getRunSeed(), hashName(agent_id), hashName(stream_name));
+            }
+
+            /**
+             * @brief FNV-1a 32位哈希（跨平台稳定，不使用 std::hash）
+             */
+            static uint32_t hashName(const std::string& name) {
+                uint32_t hash = 2166136261u;
+                for (unsigned char c : name) {
+                    hash ^= c;
+                    hash *= 16777619u;
+                }
+                return hash;
+            }
+
+        private:
+            static std::atomic<uint64_t>& runSeedStorage() {
+                static std::atomic<uint64_t> run_seed{42};
+                return run_seed;
+            }
+
+            static uint64_t& currentStepStorage() {
+                thread_local uint64_t current_step = 0;
+                return current_step;
+            }
+        };
+
+        inline uint32_t RandomStream::nextDraw() {
+            const uint64_t step = RandomService::getCurrentStep();
+            if (step != cursor_step) {
+                cursor_step = step;
+                cursor_draw = 0;
+            }
+            return cursor_draw++;
+        }
+
+    } // namespace SimManage
+} // namespace VFT_SMF
@@ -0,0 +1,238 @@
+/**
+ * @file SimulationMetrics.cpp
+ * @brief 仿真运行指标采集与 Prometheus 文本格式输出
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include "SimulationMetrics.hpp"
+#include "../A_TimeSYNC/Simulation_Clock.hpp"
+#include "../LogAndData/DataRecorder.hpp"
+#include "../LogAndData/Logger.hpp"
+#include "../../E_GlobalSharedDataSpace/GlobalSharedDataSpace.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#endif
+
+namespace VFT_SMF {
+namespace SimManage {
+
+    uint64_t LatencyHistogram::quantileNanos(double q) const {
+        uint64_t counts[BUCKETS];
+        uint64_t total = 0;
+        for (int i = 0; i < BUCKETS; ++i) {
+            counts[i] = buckets[i].load(std::memory_order_relaxed);
+            total += counts[i];
+        }
+        if (total == 0) return 0;
+
+        const double rank = q * static_cast<double>(total);
+        uint64_t cumulative = 0;
+        for (int i = 0; i < BUCKETS; ++i) {
+            if (counts[i] == 0) continue;
+            if (static_cast<double>(cumulative + counts[i]) >= rank) {
+                const double lower = static_cast<double>(bucketLowerBound(i));
+                const double upper = i + 1 < BUCKETS ? static_cast<double>(bucketLowerBound(i + 1))
+                                                     : static_cast<double>(maxNanos());
+                const double fraction = (rank - static_cast<double>(cumulative)) / static_cast<double>(counts[i]);
+                const double estimate = lower + (upper - lower) * fraction;
+                const double max_seen = static_cast<double>(maxNanos());
+                return static_cast<uint64_t>(estimate < max_seen ? estimate : max_seen);
+            }
+            cumulative += counts[i];
+        }
+        return maxNanos();
+    }
+
+    // ==================== Prometheus 文本格式 ====================
+
+    void PrometheusTextWriter::family(const char* name, const char* type, const char* help) {
+        out += "# HELP ";
+        out += name;
+        out += ' ';
+        out += help;
+        out += "\n# TYPE ";
+        out += name;
+        out += ' ';
+        out += type;
+        out += '\n';
+    }
+
+    void PrometheusTextWriter::sample(const char* name, const std::string& labels, double value) {
+        char buffer[64];
+        std::snprintf(buffer, sizeof(buffer), "%.9g", value);
+        out += name;
+        if (!labels.empty()) {
+            out += '{';
+            out += labels;
+            out += '}';
+        }
+        out += ' ';
+        out += buffer;
+        out += '\n';
+    }
+
+    void PrometheusTextWriter::sample(const char* name, const std::string& labels, uint64_t value) {
+        out += name;
+        if (!labels.empty()) {
+            out += '{';
+            out += labels;
+            out += '}';
+        }
+        out += ' ';
+        out += std::to_string(value);
+        out += '\n';
+    }
+
+    std::string PrometheusTextWriter::escapeLabelValue(const std::string& value) {
+        std::string escaped;
+        escaped.reserve(value.size());
+        for (char c : value) {
+            if (c == '\\') escaped += "\\\\";
+            else if (c == '"') escaped += "\\\"";
+            else if (c == '\n') escaped += "\\n";
+            else escaped += c;
+        }
+        return escaped;
+    }
+
+    // ==================== 指标采集 ====================
+
+    uint64_t SimulationMetrics::nowNanos() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    ProcessMemoryUsage SimulationMetrics::readProcessMemoryUsage() {
+        ProcessMemoryUsage usage;
+#ifdef _WIN32
+        PROCESS_MEMORY_COUNTERS counters;
+        if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+            usage.available = true;
+            usage.resident_bytes = counters.WorkingSetSize;
+            usage.peak_resident_bytes = counters.PeakWorkingSetSize;
+        }
+#else
+        // VmRSS / VmHWM 以 kB 为单位
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line)) {
+            unsigned long long kilobytes = 0;
+            if (std::sscanf(line.c_str(), "VmRSS: %llu kB", &kilobytes) == 1) {
+                usage.resident_bytes = kilobytes * 1024ull;
+                usage.available = true;
+            } else if (std::sscanf(line.c_str(), "VmHWM: %llu kB", &kilobytes) == 1) {
+                usage.peak_resident_bytes = kilobytes * 1024ull;
+            }
+        }
+#endif
+        return usage;
+    }
+
+    std::string SimulationMetrics::render(const VFT_SMF::SimulationClock* clock,
+                                          const VFT_SMF::GlobalShared_DataSpace::GlobalSharedDataSpace* shared_data_space,
+                                          const VFT_SMF::DataRecorder* recorder,
+                                          const VFT_SMF::Logger* logger) {
+        std::string text;
+        text.reserve(8192);
+        PrometheusTextWriter writer(text);
+
+        if (clock) {
+            const SimulationClockMetrics metrics = clock->get_metrics();
+            writer.family("vft_sim_steps_total", "counter", "Simulation steps advanced by the clock.");
+            writer.sample("vft_sim_steps_total", "", metrics.steps);
+            writer.family("vft_sim_time_seconds", "gauge", "Current simulation time.");
+            writer.sample("vft_sim_time_seconds", "", metrics.simulation_time);
+            writer.family("vft_sim_step_wall_seconds_total", "counter", "Wall time spent advancing steps and waiting for agent threads.");
+            writer.sample("vft_sim_step_wall_seconds_total", "", metrics.step_wall_seconds_total);
+            writer.family("vft_sim_last_step_wall_seconds", "gauge", "Wall time of the most recent step.");
+            writer.sample("vft_sim_last_step_wall_seconds", "", metrics.last_step_wall_seconds);
+            writer.family("vft_sim_clock_running", "gauge", "1 while the simulation clock is running.");
+            writer.sample("vft_sim_clock_running", "", static_cast<uint64_t>(metrics.running ? 1 : 0));
+        }
+
+        if (shared_data_space) {
+            int thread_count = 0;
+            const auto* threads = shared_data_space->getThreadStepMetrics(thread_count);
+            static const double QUANTILES[] = {0.5, 0.9, 0.99};
+            static const char* const QUANTILE_LABELS[] = {"0.5", "0.9", "0.99"};
+
+            writer.family("vft_agent_step_latency_seconds", "summary", "Per-agent step latency from RUNNING to COMPLETED.");
+            for (int i = 0; i < thread_count; ++i) {
+                const auto& thread = threads[i];
+                if (!thread.in_use.load(std::memory_order_acquire)) continue;
+                const std::string thread_label = "thread=\"" + PrometheusTextWriter::escapeLabelValue(thread.thread_name) + "\"";
+                for (int q = 0; q < 3; ++q) {
+                    writer.sample("vft_agent_step_latency_seconds",
+                                  thread_label + ",quantile=\"" + QUANTILE_LABELS[q] + "\"",
+                                  static_cast<double>(thread.step_latency.quantileNanos(QUANTILES[q])) * 1e-9);
+                }
+                writer.sample("vft_agent_step_latency_seconds_sum", thread_label,
+                              static_cast<double>(thread.step_latency.sumNanos()) * 1e-9);
+                writer.sample("vft_agent_step_latency_seconds_count", thread_label, thread.step_latency.count());
+            }
+            writer.family("vft_agent_step_latency_max_seconds", "gauge", "Longest per-agent step since start.");
+            for (int i = 0; i < thread_count; ++i) {
+                const auto& thread = threads[i];
+                if (!thread.in_use.load(std::memory_order_acquire)) continue;
+                writer.sample("vft_agent_step_latency_max_seconds",
+                              "thread=\"" + PrometheusTextWriter::escapeLabelValue(thread.thread_name) + "\"",
+                              static_cast<double>(thread.step_latency.maxNanos()) * 1e-9);
+            }
+
+            const auto queue = shared_data_space->getEventQueueCounters();
+            writer.family("vft_event_queue_depth", "gauge", "Events waiting in the global event queue.");
+            writer.sample("vft_event_queue_depth", "", static_cast<uint64_t>(queue.depth));
+            writer.family("vft_event_queue_enqueued_total", "counter", "Events enqueued.");
+            writer.sample("vft_event_queue_enqueued_total", "", queue.enqueued);
+            writer.family("vft_event_queue_dequeued_total", "counter", "Events dequeued.");
+            writer.sample("vft_event_queue_dequeued_total", "", queue.dequeued);
+            writer.family("vft_event_queue_overwritten_total", "counter", "Oldest events overwritten because the queue was full.");
+            writer.sample("vft_event_queue_overwritten_total", "", queue.overwritten);
+        }
+
+        if (recorder) {
+            const DataRecorderCounters counters = recorder->getCounters();
+            writer.family("vft_recorder_records_total", "counter", "Records buffered by the data recorder (all modules).");
+            writer.sample("vft_recorder_records_total", "", counters.records);
+            writer.family("vft_recorder_pending_records", "gauge", "Buffered records not yet written to output files.");
+            writer.sample("vft_recorder_pending_records", "", counters.pending_records);
+            writer.family("vft_recorder_evicted_records_total", "counter", "Oldest records discarded because a module buffer was full.");
+            writer.sample("vft_recorder_evicted_records_total", "", counters.evicted_records);
+            writer.family("vft_recorder_flushes_total", "counter", "Completed flushes to output files.");
+            writer.sample("vft_recorder_flushes_total", "", counters.flushes);
+        }
+
+        if (logger) {
+            const LoggerCounters counters = logger->getCounters();
+            writer.family("vft_log_records_total", "counter", "Log records submitted to the writer thread.");
+            writer.sample("vft_log_records_total", "", counters.submitted);
+            writer.family("vft_log_pending_records", "gauge", "Log records not yet written by the writer thread.");
+            writer.sample("vft_log_pending_records", "", counters.submitted - std::min(counters.written, counters.submitted));
+            writer.family("vft_log_dropped_records_total", "counter", "Log records discarded before the writer thread started.");
+            writer.sample("vft_log_dropped_records_total", "", counters.dropped);
+            writer.family("vft_log_ring_full_waits_total", "counter", "Times a caller waited because the log record ring was full.");
+            writer.sample("vft_log_ring_full_waits_total", "", counters.ring_full_waits);
+        }
+
+        const ProcessMemoryUsage memory = readProcessMemoryUsage();
+        if (memory.available) {
+            writer.family("vft_process_resident_memory_bytes", "gauge", "Resident set size.");
+            writer.sample("vft_process_resident_memory_bytes", "", memory.resident_bytes);
+            writer.family("vft_process_peak_resident_memory_bytes", "gauge", "Peak resident set size.");
+            writer.sample("vft_process_peak_resident_memory_bytes", "", memory.peak_resident_bytes);
+        }
+
+        return text;
+    }
+
+} // namespace SimManage
+} // namespace VFT_SMF
@@ -0,0 +1,141 @@
+/**
+ * @file SimulationMetrics.hpp
+ * @brief 仿真运行指标（Prometheus 文本格式）
+ * @details 运行指标由各模块自身维护，指标端点（MetricsServer）采集时无锁读取：
+ *          - SimulationClock：推进步数、仿真时间、每步墙钟时间（推进 + 等待各线程完成）；
+ *          - ThreadSyncManager：各代理线程每步 RUNNING 到 COMPLETED 的耗时直方图（分位数）；
+ *          - EventQueue：队列深度、入队 / 出队 / 满时覆盖计数；
+ *          - DataRecorder：已记录条数、尚未写出的缓冲记录数（积压）、缓冲区满时丢弃条数；
+ *          - Logger：提交条数、待写条数、丢弃条数、记录环满时调用方等待次数；
+ *          - 进程常驻内存（当前 / 峰值）。
+ *          计数均为单写者或原子累加，采集线程读到的是某一时刻附近的近似一致值。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// 前向声明
+namespace VFT_SMF {
+    class SimulationClock;
+    class DataRecorder;
+    class Logger;
+    namespace GlobalShared_DataSpace {
+        class GlobalSharedDataSpace;
+    }
+}
+
+namespace VFT_SMF {
+    namespace SimManage {
+
+        /**
+         * @brief 单写者耗时直方图（每 2 倍区间细分 4 桶），其他线程可随时无锁读取
+         */
+        class LatencyHistogram {
+        public:
+            static constexpr int BUCKETS = 144;   ///< 覆盖 0 ns 到约 34 s，更长的计入末桶
+
+            /**
+             * @brief 记录一次耗时（仅由写者线程调用）
+             */
+            void record(uint64_t ns) {
+                // 单写者：读-改-写无需原子指令，读者只需看到完整的 64 位值
+                std::atomic<uint64_t>& bucket = buckets[bucketIndex(ns)];
+                bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                sum_ns.store(sum_ns.load(std::memory_order_relaxed) + ns, std::memory_order_relaxed);
+                if (ns > max_ns.load(std::memory_order_relaxed)) max_ns.store(ns, std::memory_order_relaxed);
+                samples.store(samples.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            }
+
+            uint64_t count() const { return samples.load(std::memory_order_acquire); }
+            uint64_t sumNanos() const { return sum_ns.load(std::memory_order_relaxed); }
+            uint64_t maxNanos() const { return max_ns.load(std::memory_order_relaxed); }
+
+            /**
+             * @brief 分位数估计（桶内线性插值），无样本时返回 0
+             * @param q 分位（0~1）
+             */
+            uint64_t quantileNanos(double q) const;
+
+            static int bucketIndex(uint64_t ns) {
+                if (ns < 4) return static_cast<int>(ns);
+                const int msb = 63 - __builtin_clzll(ns);
+                const int index = (msb - 1) * 4 + static_cast<int>((ns >> (msb - 2)) & 3);
+                return index < BUCKETS ? index : BUCKETS - 1;
+            }
+
+            static uint64_t bucketLowerBound(int index) {
+                if (index < 4) return static_cast<uint64_t>(index);
+                const int msb = index / 4 + 1;
+                return static_cast<uint64_t>(4 + index % 4) << (msb - 2);
+            }
+
+        private:
+            std::atomic<uint64_t> buckets[BUCKETS] = {};
+            std::atomic<uint64_t> samples{0};
+            std::atomic<uint64_t> sum_ns{0};
+            std::atomic<uint64_t> max_ns{0};
+        };
+
+        /**
+         * @brief 进程常驻内存
+         */
+        struct ProcessMemoryUsage {
+            bool available = false;
+            uint64_t resident_bytes = 0;
+            uint64_t peak_resident_bytes = 0;
+        };
+
+        /**
+         * @brief Prometheus 文本格式（0.0.4）输出
+         */
+        class PrometheusTextWriter {
+        public:
+            explicit PrometheusTextWriter(std::string& output) : out(output) {}
+
+            /**
+             * @brief 开始一个指标族（写出 HELP 与 TYPE）
+             * @param type "counter" / "gauge" / "summary"
+             */
+            void family(const char* name, const char* type, const char* help);
+
+            /**
+             * @brief 写出一个样本
+             * @param labels 已格式化的标签（如 thread="Pilot_Thread"），为空时不带标签
+             */
+            void sample(const char* name, const std::string& labels, double value);
+            void sample(const char* name, const std::string& labels, uint64_t value);
+
+            /**
+             * @brief 标签值转义（反斜杠、双引号、换行）
+             */
+            static std::string escapeLabelValue(const std::string& value);
+
+        private:
+            std::string& out;
+        };
+
+        /**
+         * @brief 运行指标采集
+         */
+        class SimulationMetrics {
+        public:
+            /**
+             * @brief 以 Prometheus 文本格式输出当前指标（指针为空的模块不输出）
+             */
+            static std::string render(const VFT_SMF::SimulationClock* clock,
+                                      const VFT_SMF::GlobalShared_DataSpace::GlobalSharedDataSpace* shared_data_space,
+                                      const VFT_SMF::DataRecorder* recorder,
+                                      const VFT_SMF::Logger* logger);
+
+            static ProcessMemoryUsage readProcessMemoryUsage();
+
+            static uint64_t nowNanos();
+        };
+
+    } // namespace SimManage
+} // namespace VFT_SMF
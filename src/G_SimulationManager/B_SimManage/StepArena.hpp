@@ -0,0 +1,121 @@
+/**
+ * @file StepArena.hpp
+ * @brief 每线程、每仿真步的单调内存区（std::pmr）
+ * @details 步内临时数据（按步查询得到的事件列表、拼接的临时字符串等）只在本步内有效，
+ *          分配在本线程的步内存区上时只需移动指针，不经过全局 malloc/free，
+ *          避免八个代理线程在分配器上互相争用。
+ *
+ *          使用约定：
+ *          1. 代理线程在每步开始时调用 beginStep()（与 RandomService::setCurrentStep() 相邻），
+ *             上一步从内存区分配的对象在此之前必须全部销毁；
+ *          2. 跨步保存的数据（事件队列、共享数据空间中的状态）不得使用步内存区；
+ *          3. 某一步用量超过初始缓冲时超出部分向上游申请，下一步开始时缓冲扩大到该步用量，
+ *             稳态下每步不再调用全局分配器。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+namespace VFT_SMF {
+    namespace SimManage {
+
+        /**
+         * @brief 步内存区
+         */
+        class StepArena : public std::pmr::memory_resource {
+        public:
+            static constexpr size_t INITIAL_CAPACITY = 64 * 1024;        ///< 初始缓冲字节数
+            static constexpr size_t MAX_CAPACITY = 16 * 1024 * 1024;     ///< 缓冲扩大上限
+
+            StepArena(const StepArena&) = delete;
+            StepArena& operator=(const StepArena&) = delete;
+
+            /**
+             * @brief 当前线程的步内存区
+             */
+            static StepArena& local() {
+                thread_local StepArena arena;
+                return arena;
+            }
+
+            /**
+             * @brief 当前线程步内存区的 memory_resource 指针，用于构造 std::pmr 容器
+             */
+            static std::pmr::memory_resource* resource() { return &local(); }
+
+            /**
+             * @brief 步边界：释放上一步的全部分配
+             */
+            static void beginStep(uint64_t step) { local().reset(step); }
+
+            uint64_t getStep() const { return step; }
+            size_t getCapacity() const { return capacity; }
+            size_t getOverflowBytes() const { return upstream.allocated_bytes; }   ///< 本步向上游申请的字节数
+            uint64_t getGrowCount() const { return grow_count; }
+
+        private:
+            /**
+             * @brief 上游资源：转发到 new/delete 并统计本步申请量
+             */
+            class CountingUpstream : public std::pmr::memory_resource {
+            public:
+                size_t allocated_bytes = 0;
+
+            private:
+                void* do_allocate(size_t bytes, size_t alignment) override {
+                    allocated_bytes += bytes;
+                    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+                }
+                void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+                    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+                }
+                bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+                    return this == &other;
+                }
+            };
+
+            StepArena() : capacity(INITIAL_CAPACITY), buffer(new std::byte[INITIAL_CAPACITY]) {
+                arena.emplace(buffer.get(), capacity, &upstream);
+            }
+
+            void reset(uint64_t new_step) {
+                step = new_step;
+                const size_t overflow = upstream.allocated_bytes;
+                arena.reset();   // 归还上游分配
+                upstream.allocated_bytes = 0;
+                if (overflow > 0 && capacity < MAX_CAPACITY) {
+                    capacity = std::min(MAX_CAPACITY, (capacity + overflow + 4095) / 4096 * 4096);
+                    buffer.reset(new std::byte[capacity]);
+                    ++grow_count;
+                }
+                arena.emplace(buffer.get(), capacity, &upstream);
+            }
+
+            void* do_allocate(size_t bytes, size_t alignment) override {
+                return arena->allocate(bytes, alignment);
+            }
+            void do_deallocate(void*, size_t, size_t) override {
+                // 单调内存区：逐个释放为空操作，统一在 beginStep() 时回收
+            }
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+                return this == &other;
+            }
+
+            uint64_t step = 0;
+            size_t capacity;
+            uint64_t grow_count = 0;
+            std::unique_ptr<std::byte[]> buffer;
+            CountingUpstream upstream;
+            std::optional<std::pmr::monotonic_buffer_resource> arena;
+        };
+
+    } // namespace SimManage
+} // namespace VFT_SMF
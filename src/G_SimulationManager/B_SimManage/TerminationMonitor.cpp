@@ -0,0 +1,259 @@
+/**
+ * @file TerminationMonitor.cpp
+ * @brief 场景提前终止判据实现
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include "TerminationMonitor.hpp"
+#include "../../E_GlobalSharedDataSpace/GlobalSharedDataSpace.hpp"
+#include "../LogAndData/Logger.hpp"
+#include "../../I_ThirdPartyTools/json.hpp"
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <regex>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace VFT_SMF {
+namespace SimManage {
+
+    namespace {
+
+        const double EXCURSION_MAX_HEIGHT_M = 3.0;   ///< 离地高于此值不再判定冲出跑道
+
+        const char* const DERIVED_CHANNELS[] = {"time", "distance", "along_track", "cross_track", "height"};
+
+        bool isDerivedChannel(const std::string& channel) {
+            for (const char* name : DERIVED_CHANNELS) {
+                if (channel == name) return true;
+            }
+            return false;
+        }
+
+        bool unitScale(const std::string& unit, double& scale) {
+            static const std::map<std::string, double> UNITS = {
+                {"", 1.0}, {"m", 1.0}, {"s", 1.0}, {"deg", 1.0}, {"m/s", 1.0}, {"pa", 1.0},
+                {"ft", 0.3048}, {"kt", 0.514444}, {"kts", 0.514444}, {"km/h", 1.0 / 3.6}, {"ft/min", 0.3048 / 60.0},
+            };
+            std::string lower = unit;
+            for (auto& c : lower) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            const auto it = UNITS.find(lower);
+            if (it == UNITS.end()) return false;
+            scale = it->second;
+            return true;
+        }
+
+        bool compare(TerminationPredicate::Op op, double value, double threshold) {
+            switch (op) {
+                case TerminationPredicate::Op::Less:         return value < threshold;
+                case TerminationPredicate::Op::LessEqual:    return value <= threshold;
+                case TerminationPredicate::Op::Greater:      return value > threshold;
+                case TerminationPredicate::Op::GreaterEqual: return value >= threshold;
+            }
+            return false;
+        }
+
+    } // namespace
+
+    bool TerminationMonitor::parsePredicate(const std::string& expression, TerminationPredicate& predicate, std::string& error) {
+        static const std::string NUMBER = R"(([-+]?(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?))";
+        static const std::string SUFFIX = R"((?:\s+for\s+)" + NUMBER + R"(\s*s?)?(?:\s+after\s+t\s*>=?\s*)" + NUMBER + R"(\s*s?)?\s*$)";
+        static const std::regex COMPARISON(R"(^\s*([A-Za-z_][A-Za-z0-9_]*)\s*(<=|>=|<|>)\s*)" + NUMBER +
+                                           R"(\s*([A-Za-z/]*))" + SUFFIX, std::regex::icase);
+        static const std::regex EXCURSION(R"(^\s*runway_excursion)" + SUFFIX, std::regex::icase);
+
+        predicate = TerminationPredicate();
+        predicate.expression = expression;
+        std::smatch match;
+        size_t suffix_group = 0;
+        if (std::regex_match(expression, match, EXCURSION)) {
+            predicate.kind = TerminationPredicate::Kind::RunwayExcursion;
+            predicate.channel = "runway_excursion";
+            suffix_group = 1;
+        } else if (std::regex_match(expression, match, COMPARISON)) {
+            predicate.kind = TerminationPredicate::Kind::Comparison;
+            predicate.channel = match[1].str();
+            const std::string op = match[2].str();
+            predicate.op = op == "<" ? TerminationPredicate::Op::Less
+                         : op == "<=" ? TerminationPredicate::Op::LessEqual
+                         : op == ">" ? TerminationPredicate::Op::Greater
+                         : TerminationPredicate::Op::GreaterEqual;
+            double scale = 1.0;
+            if (!unitScale(match[4].str(), scale)) {
+                error = "未知单位: " + match[4].str();
+                return false;
+            }
+            predicate.threshold = std::stod(match[3].str()) * scale;
+            if (!isDerivedChannel(predicate.channel) && !VFT_SMF::Telemetry::TelemetryPublisher::findChannel(predicate.channel)) {
+                error = "未知通道: " + predicate.channel;
+                return false;
+            }
+            suffix_group = 5;
+        } else {
+            error = "无法解析终止条件: " + expression;
+            return false;
+        }
+
+        if (match[suffix_group].matched) predicate.hold_time = std::stod(match[suffix_group].str());
+        if (match[suffix_group + 1].matched) predicate.after_time = std::stod(match[suffix_group + 1].str());
+        return true;
+    }
+
+    bool TerminationMonitor::addPredicate(const std::string& name, const std::string& expression, std::string& error) {
+        TerminationPredicate predicate;
+        if (!parsePredicate(expression, predicate, error)) return false;
+        predicate.name = name.empty() ? expression : name;
+        getters.push_back(predicate.kind == TerminationPredicate::Kind::Comparison
+                          ? VFT_SMF::Telemetry::TelemetryPublisher::findChannel(predicate.channel) : nullptr);
+        predicates.push_back(predicate);
+        return true;
+    }
+
+    size_t TerminationMonitor::loadFromFlightPlan(const std::string& flight_plan_file) {
+        std::ifstream file(flight_plan_file);
+        if (!file.is_open()) return 0;
+
+        nlohmann::json flight_plan;
+        try {
+            file >> flight_plan;
+        } catch (const std::exception& e) {
+            logBrief(LogLevel::Brief, "终止条件: 飞行计划解析失败 " + std::string(e.what()));
+            return 0;
+        }
+        if (!flight_plan.contains("flight_plan") || !flight_plan["flight_plan"].contains("termination_conditions")) {
+            return 0;
+        }
+
+        size_t loaded = 0;
+        for (const auto& item : flight_plan["flight_plan"]["termination_conditions"]) {
+            std::string name, expression, error;
+            if (item.is_string()) {
+                expression = item.get<std::string>();
+            } else if (item.is_object()) {
+                name = item.value("name", std::string());
+                expression = item.value("condition", std::string());
+            }
+            if (addPredicate(name, expression, error)) {
+                ++loaded;
+                logBrief(LogLevel::Brief, "终止条件已加载: " + predicates.back().name + " (" + expression + ")");
+            } else {
+                logBrief(LogLevel::Brief, "终止条件已跳过: " + error);
+            }
+        }
+        return loaded;
+    }
+
+    VFT_SMF::FlightDynamics::NedPosition TerminationMonitor::referencePlanePosition(const VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& published,
+                                                                                    const VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& state) const {
+        // 切平面积分且锚点未变时直接取发布的切平面位置；重新锚定后或按经纬度积分时投影换算后的经纬度
+        const auto& anchor = reference_frame.getAnchor();
+        if (published.geodetic_stale && published.anchor_latitude == anchor.latitude &&
+            published.anchor_longitude == anchor.longitude && published.anchor_altitude == anchor.altitude) {
+            return VFT_SMF::FlightDynamics::NedPosition(published.local_north, published.local_east, 0.0);
+        }
+        return reference_frame.toNed(VFT_SMF::FlightDynamics::GeodeticPosition(state.latitude, state.longitude, anchor.altitude));
+    }
+
+    void TerminationMonitor::updateDerivedChannels(const VFT_SMF::GlobalShared_DataSpace::GlobalSharedDataSpace& shared_data_space) {
+        const auto& published = shared_data_space.getAircraftFlightState();
+        const auto state = geodetic_resolver.resolved(published);
+        if (!has_reference) {
+            has_reference = true;
+            reference_frame.setAnchor(published.geodetic_stale
+                ? VFT_SMF::FlightDynamics::GeodeticPosition(published.anchor_latitude, published.anchor_longitude, published.anchor_altitude)
+                : VFT_SMF::FlightDynamics::GeodeticPosition(state.latitude, state.longitude, state.altitude));
+            reference_position = referencePlanePosition(published, state);
+            reference_heading = state.heading * M_PI / 180.0;
+            reference_altitude = state.altitude;
+        }
+
+        ground_distance.add(state.latitude, state.longitude);
+
+        // 跑道坐标：参考点处沿初始航向为 along_track，右侧为正的 cross_track
+        const auto position = referencePlanePosition(published, state);
+        const double north = position.north - reference_position.north;
+        const double east = position.east - reference_position.east;
+        along_track = north * std::cos(reference_heading) + east * std::sin(reference_heading);
+        cross_track = east * std::cos(reference_heading) - north * std::sin(reference_heading);
+
+        // 离地高度：环境已发布跑道数据时相对跑道标高，否则相对首次求值时的高度
+        const auto& environment = shared_data_space.getEnvironmentState();
+        const bool has_runway = environment.runway_length > 0.0 && environment.runway_width > 0.0;
+        height = state.altitude - (has_runway ? environment.runway_elevation : reference_altitude);
+    }
+
+    bool TerminationMonitor::isRunwayExcursion(const VFT_SMF::GlobalShared_DataSpace::GlobalSharedDataSpace& shared_data_space) const {
+        const auto& environment = shared_data_space.getEnvironmentState();
+        if (environment.runway_length <= 0.0 || environment.runway_width <= 0.0) return false;   // 环境尚未发布跑道数据
+        if (height > EXCURSION_MAX_HEIGHT_M) return false;
+        return std::abs(cross_track) > 0.5 * environment.runway_width ||
+               along_track > environment.runway_length || along_track < 0.0;
+    }
+
+    double TerminationMonitor::derivedValue(const std::string& channel, double simulation_time) const {
+        if (channel == "time") return simulation_time;
+        if (channel == "distance") return ground_distance.getTotal();
+        if (channel == "along_track") return along_track;
+        if (channel == "height") return height;
+        return cross_track;
+    }
+
+    bool TerminationMonitor::evaluate(double simulation_time, const VFT_SMF::GlobalShared_DataSpace::GlobalSharedDataSpace& shared_data_space) {
+        if (result.terminated) return true;
+        if (predicates.empty()) return false;
+
+        updateDerivedChannels(shared_data_space);
+
+        for (size_t i = 0; i < predicates.size(); ++i) {
+            auto& predicate = predicates[i];
+            if (!(simulation_time > predicate.after_time)) {
+                predicate.satisfied_since = -1.0;
+                continue;
+            }
+
+            bool satisfied = false;
+            if (predicate.kind == TerminationPredicate::Kind::RunwayExcursion) {
+                satisfied = isRunwayExcursion(shared_data_space);
+            } else {
+                const double value = getters[i] ? getters[i](shared_data_space)
+                                                : derivedValue(predicate.channel, simulation_time);
+                satisfied = compare(predicate.op, value, predicate.threshold);
+            }
+
+            if (!satisfied) {
+                predicate.satisfied_since = -1.0;
+                continue;
+            }
+            if (predicate.satisfied_since < 0.0) predicate.satisfied_since = simulation_time;
+            if (simulation_time - predicate.satisfied_since + 1e-9 >= predicate.hold_time) {
+                result.terminated = true;
+                result.name = predicate.name;
+                result.expression = predicate.expression;
+                result.time = simulation_time;
+                logBrief(LogLevel::Brief, "终止条件成立: " + predicate.name + "，仿真时间: " + std::to_string(simulation_time));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool TerminationMonitor::writeReport(const std::string& file_path, double end_time, double max_simulation_time) const {
+        std::ofstream file(file_path);
+        if (!file.is_open()) return false;
+        file << std::fixed << std::setprecision(3);
+        file << "terminated_early=" << (result.terminated ? 1 : 0) << "\n";
+        file << "reason=" << (result.terminated ? result.name : std::string("max_simulation_time")) << "\n";
+        file << "condition=" << result.expression << "\n";
+        file << "end_time=" << end_time << "\n";
+        file << "max_simulation_time=" << max_simulation_time << "\n";
+        file << "distance_m=" << ground_distance.getTotal() << "\n";
+        return file.good();
+    }
+
+} // namespace SimManage
+} // namespace VFT_SMF
@@ -0,0 +1,137 @@
+/**
+ * @file TerminationMonitor.hpp
+ * @brief 场景提前终止判据
+ * @details 在飞行计划中以声明式表达式定义结束条件（flight_plan.termination_conditions），
+ *          主循环每步发布数据后对全局共享数据空间求值，任一条件成立即结束仿真，
+ *          走正常的停钟、等待线程、刷新记录器流程，并输出结束原因。
+ *
+ *          表达式语法：
+ *            <通道> <比较符> <数值>[单位] [for <持续时间>s] [after t > <起始时间>s]
+ *            runway_excursion [for <持续时间>s] [after t > <起始时间>s]
+ *          通道为遥测通道名（见 TelemetryPublisher::availableChannels()），另有派生通道
+ *          time、distance（累计地面距离）、along_track / cross_track（相对初始位置与航向的跑道坐标）、
+ *          height（离地高度：altitude 减跑道标高，环境未发布跑道时减初始高度）。
+ *          altitude 为海拔高度，起飞/着陆判据应使用 height。
+ *          单位支持 m、ft、m/s、kt、km/h、s、deg，换算到共享数据空间使用的国际单位。
+ *          示例："groundspeed < 0.1 for 2s after t>10"、"height > 35ft"、"runway_excursion"
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#pragma once
+
+#include "../LogAndData/TelemetryPublisher.hpp"
+#include "../../E_FlightDynamics/LocalTangentFrame.hpp"
+#include <limits>
+#include <string>
+#include <vector>
+
+// 前向声明
+namespace VFT_SMF {
+    namespace GlobalShared_DataSpace {
+        class GlobalSharedDataSpace;
+    }
+}
+
+namespace VFT_SMF {
+namespace SimManage {
+
+    /**
+     * @brief 单个终止判据
+     */
+    struct TerminationPredicate {
+        enum class Kind { Comparison, RunwayExcursion };
+        enum class Op { Less, LessEqual, Greater, GreaterEqual };
+
+        std::string name;
+        std::string expression;
+        Kind kind = Kind::Comparison;
+        std::string channel;
+        Op op = Op::Less;
+        double threshold = 0.0;                   ///< 已换算为国际单位
+        double hold_time = 0.0;                   ///< 条件需持续成立的时间 [s]
+        double after_time = -std::numeric_limits<double>::infinity();   ///< 仅在 t > after_time 后求值
+
+        // 运行状态
+        double satisfied_since = -1.0;            ///< 条件开始连续成立的时刻，<0 表示当前不成立
+    };
+
+    /**
+     * @brief 终止结果
+     */
+    struct TerminationResult {
+        bool terminated = false;
+        std::string name;                         ///< 触发的判据名称
+        std::string expression;
+        double time = 0.0;                        ///< 触发时刻 [s]
+    };
+
+    /**
+     * @brief 终止判据监测器（仅由主线程调用）
+     */
+    class TerminationMonitor {
+    public:
+        /**
+         * @brief 解析表达式
+         * @param expression 表达式文本
+         * @param predicate 输出判据
+         * @param error 解析失败原因
+         */
+        static bool parsePredicate(const std::string& expression, TerminationPredicate& predicate, std::string& error);
+
+        /**
+         * @brief 添加判据，名称为空时使用表达式文本
+         */
+        bool addPredicate(const std::string& name, const std::string& expression, std::string& error);
+
+        /**
+         * @brief 从飞行计划文件读取 flight_plan.termination_conditions
+         * @details 数组元素可以是表达式字符串，或 {"name": ..., "condition": ...} 对象；无法解析的条目记录日志后跳过
+         * @return 成功加载的判据数
+         */
+        size_t loadFromFlightPlan(const std::string& flight_plan_file);
+
+        /**
+         * @brief 对本步状态求值
+         * @return 已终止（首次成立后保持为true）
+         */
+        bool evaluate(double simulation_time, const VFT_SMF::GlobalShared_DataSpace::GlobalSharedDataSpace& shared_data_space);
+
+        /**
+         * @brief 写出结束报告（key=value 文本）
+         * @param file_path 报告文件路径
+         * @param end_time 实际结束的仿真时间
+         * @param max_simulation_time 配置的最大仿真时间
+         */
+        bool writeReport(const std::string& file_path, double end_time, double max_simulation_time) const;
+
+        const TerminationResult& getResult() const { return result; }
+        size_t getPredicateCount() const { return predicates.size(); }
+        double getDistance() const { return ground_distance.getTotal(); }
+
+    private:
+        std::vector<TerminationPredicate> predicates;
+        std::vector<VFT_SMF::Telemetry::TelemetryPublisher::ChannelGetter> getters;
+        TerminationResult result;
+
+        // 派生通道状态：以首次求值时的位置、航向、高度为跑道参考
+        bool has_reference = false;
+        VFT_SMF::FlightDynamics::LocalTangentFrame reference_frame;   ///< 锚点取首次求值时发布的切平面锚点
+        VFT_SMF::FlightDynamics::NedPosition reference_position;      ///< 参考点在 reference_frame 中的位置
+        double reference_heading = 0.0;                                 ///< 初始航向 (rad)
+        double reference_altitude = 0.0;
+        VFT_SMF::FlightDynamics::GroundDistance ground_distance;        ///< 与数据记录器 distance_m 同一累计方式
+        double along_track = 0.0;
+        double cross_track = 0.0;
+        double height = 0.0;
+        VFT_SMF::FlightDynamics::GeodeticResolver geodetic_resolver;
+
+        VFT_SMF::FlightDynamics::NedPosition referencePlanePosition(const VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& published,
+                                                                    const VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& state) const;
+        void updateDerivedChannels(const VFT_SMF::GlobalShared_DataSpace::GlobalSharedDataSpace& shared_data_space);
+        bool isRunwayExcursion(const VFT_SMF::GlobalShared_DataSpace::GlobalSharedDataSpace& shared_data_space) const;
+        double derivedValue(const std::string& channel, double simulation_time) const;
+    };
+
+} // namespace SimManage
+} // namespace VFT_SMF
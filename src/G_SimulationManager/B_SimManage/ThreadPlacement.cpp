@@ -0,0 +1,414 @@
+/**
+ * @file ThreadPlacement.cpp
+ * @brief 线程放置实现（Linux: pthread_setaffinity_np / SCHED_FIFO / set_mempolicy；Windows: 亲和掩码与线程优先级）
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include "ThreadPlacement.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <filesystem>
+#include <sys/syscall.h>
+#endif
+#endif
+
+namespace VFT_SMF {
+namespace SimManage {
+
+    namespace {
+        std::mutex placement_mutex;
+        std::map<std::string, ThreadPlacementSpec> placement_specs;
+        std::vector<ThreadPlacementResult> placement_results;
+
+        std::string trim(const std::string& text) {
+            const size_t begin = text.find_first_not_of(" \t");
+            if (begin == std::string::npos) {
+                return "";
+            }
+            const size_t end = text.find_last_not_of(" \t");
+            return text.substr(begin, end - begin + 1);
+        }
+
+        bool parseInteger(const std::string& text, int& value) {
+            const std::string trimmed = trim(text);
+            if (trimmed.empty() || trimmed.find_first_not_of("0123456789") != std::string::npos || trimmed.size() > 6) {
+                return false;
+            }
+            value = std::stoi(trimmed);
+            return true;
+        }
+
+        bool parseCpuList(const std::string& text, std::vector<int>& cpus) {
+            std::vector<int> parsed;
+            std::stringstream stream(text);
+            std::string item;
+            while (std::getline(stream, item, ',')) {
+                const size_t dash = item.find('-');
+                int first = 0;
+                int last = 0;
+                if (dash == std::string::npos) {
+                    if (!parseInteger(item, first)) return false;
+                    last = first;
+                } else if (!parseInteger(item.substr(0, dash), first) || !parseInteger(item.substr(dash + 1), last) || last < first) {
+                    return false;
+                }
+                for (int cpu = first; cpu <= last; ++cpu) {
+                    parsed.push_back(cpu);
+                }
+            }
+            if (parsed.empty()) {
+                return false;
+            }
+            std::sort(parsed.begin(), parsed.end());
+            parsed.erase(std::unique(parsed.begin(), parsed.end()), parsed.end());
+            cpus = parsed;
+            return true;
+        }
+
+        std::string formatSpec(const ThreadPlacementSpec& spec) {
+            std::ostringstream text;
+            text << "cpus=" << (spec.cpus.empty() ? std::string("-") : ThreadPlacement::formatCpuList(spec.cpus))
+                 << " priority=" << spec.realtime_priority
+                 << " numa=" << spec.numa_node;
+            return text.str();
+        }
+
+#if !defined(_WIN32)
+        std::string describeError(const char* call, int error) {
+            std::string text = std::string(call) + ": " + std::strerror(error);
+            if (error == EPERM) {
+                text += "（无相应权限）";
+            }
+            return text;
+        }
+#endif
+
+#if defined(__linux__)
+        constexpr int MEMORY_POLICY_DEFAULT = 0;     // MPOL_DEFAULT
+        constexpr int MEMORY_POLICY_PREFERRED = 1;   // MPOL_PREFERRED
+        constexpr size_t NODE_MASK_WORDS = 16;       // 1024 个节点
+        constexpr size_t BITS_PER_WORD = sizeof(unsigned long) * 8;
+
+        int readPreferredNode() {
+            int mode = MEMORY_POLICY_DEFAULT;
+            unsigned long mask[NODE_MASK_WORDS] = {};
+            if (syscall(SYS_get_mempolicy, &mode, mask, NODE_MASK_WORDS * BITS_PER_WORD, nullptr, 0) != 0 ||
+                mode != MEMORY_POLICY_PREFERRED) {
+                return -1;
+            }
+            for (size_t node = 0; node < NODE_MASK_WORDS * BITS_PER_WORD; ++node) {
+                if (mask[node / BITS_PER_WORD] & (1UL << (node % BITS_PER_WORD))) {
+                    return static_cast<int>(node);
+                }
+            }
+            return -1;
+        }
+#endif
+    } // namespace
+
+    bool ThreadPlacement::parseSpec(const std::string& text, ThreadPlacementSpec& spec, std::string& error) {
+        ThreadPlacementSpec parsed;
+        std::stringstream stream(text);
+        std::string field;
+        while (std::getline(stream, field, ';')) {
+            field = trim(field);
+            if (field.empty()) {
+                continue;
+            }
+            const size_t equals = field.find('=');
+            if (equals == std::string::npos) {
+                error = "缺少 '=': " + field;
+                return false;
+            }
+            const std::string key = trim(field.substr(0, equals));
+            const std::string value = trim(field.substr(equals + 1));
+            if (key == "cpus") {
+                if (!parseCpuList(value, parsed.cpus)) {
+                    error = "无效的 CPU 列表: " + value;
+                    return false;
+                }
+            } else if (key == "priority") {
+                if (!parseInteger(value, parsed.realtime_priority)) {
+                    error = "无效的优先级: " + value;
+                    return false;
+                }
+            } else if (key == "numa") {
+                if (!parseInteger(value, parsed.numa_node)) {
+                    error = "无效的 NUMA 节点: " + value;
+                    return false;
+                }
+            } else {
+                error = "未知的放置项: " + key;
+                return false;
+            }
+        }
+        spec = parsed;
+        return true;
+    }
+
+    void ThreadPlacement::configure(const std::map<std::string, ThreadPlacementSpec>& specs) {
+        std::lock_guard<std::mutex> lock(placement_mutex);
+        placement_specs.clear();
+        for (const auto& entry : specs) {
+            if (!entry.second.empty()) {
+                placement_specs.insert(entry);
+            }
+        }
+        placement_results.clear();
+    }
+
+    bool ThreadPlacement::hasSpec(const std::string& thread_name) {
+        std::lock_guard<std::mutex> lock(placement_mutex);
+        return placement_specs.count(thread_name) > 0;
+    }
+
+    bool ThreadPlacement::applyToCurrentThread(const std::string& thread_name) {
+        ThreadPlacementResult result;
+        {
+            std::lock_guard<std::mutex> lock(placement_mutex);
+            const auto it = placement_specs.find(thread_name);
+            if (it == placement_specs.end()) {
+                return false;
+            }
+            result.thread_name = thread_name;
+            result.requested = it->second;
+        }
+
+        // 先设内存策略与调度策略，最后设 CPU 集：迁移到目标 CPU 后的分配已按新策略进行
+        applyNumaNode(result);
+        applyRealtime(result);
+        applyAffinity(result);
+#ifdef _WIN32
+        result.current_cpu = static_cast<int>(GetCurrentProcessorNumber());
+#elif defined(__linux__)
+        result.current_cpu = sched_getcpu();
+#endif
+
+        std::lock_guard<std::mutex> lock(placement_mutex);
+        placement_results.push_back(result);
+        return true;
+    }
+
+#ifdef _WIN32
+    void ThreadPlacement::applyAffinity(ThreadPlacementResult& result) {
+        const std::vector<int>& cpus = result.requested.cpus;
+        if (cpus.empty()) {
+            return;
+        }
+        DWORD_PTR mask = 0;
+        for (int cpu : cpus) {
+            if (cpu < static_cast<int>(sizeof(DWORD_PTR) * 8)) {
+                mask |= static_cast<DWORD_PTR>(1) << cpu;
+            }
+        }
+        if (mask == 0) {
+            result.affinity_note = "请求的 CPU 超出亲和掩码范围";
+            return;
+        }
+        const DWORD_PTR previous = SetThreadAffinityMask(GetCurrentThread(), mask);
+        if (previous == 0) {
+            result.affinity_note = "SetThreadAffinityMask 失败，错误码 " + std::to_string(GetLastError());
+            return;
+        }
+        result.affinity_applied = true;
+        for (size_t cpu = 0; cpu < sizeof(DWORD_PTR) * 8; ++cpu) {
+            if (mask & (static_cast<DWORD_PTR>(1) << cpu)) {
+                result.achieved_cpus.push_back(static_cast<int>(cpu));
+            }
+        }
+        if (result.achieved_cpus != cpus) {
+            result.affinity_note = "部分 CPU 超出亲和掩码范围";
+        }
+    }
+
+    void ThreadPlacement::applyRealtime(ThreadPlacementResult& result) {
+        if (result.requested.realtime_priority > 0) {
+            if (SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL)) {
+                result.realtime_applied = true;
+                result.realtime_note = "Windows 无 SCHED_FIFO，使用 THREAD_PRIORITY_TIME_CRITICAL";
+            } else {
+                result.realtime_note = "SetThreadPriority 失败，错误码 " + std::to_string(GetLastError());
+            }
+        }
+        result.achieved_priority = GetThreadPriority(GetCurrentThread());
+        result.achieved_policy = result.achieved_priority == THREAD_PRIORITY_TIME_CRITICAL ? "TIME_CRITICAL" : "NORMAL";
+    }
+
+    void ThreadPlacement::applyNumaNode(ThreadPlacementResult& result) {
+        if (result.requested.numa_node >= 0) {
+            result.numa_note = "Windows 下不支持设置 NUMA 内存节点";
+        }
+    }
+#else
+    void ThreadPlacement::applyAffinity(ThreadPlacementResult& result) {
+        const std::vector<int>& cpus = result.requested.cpus;
+#if defined(__linux__)
+        if (!cpus.empty()) {
+            cpu_set_t requested;
+            CPU_ZERO(&requested);
+            for (int cpu : cpus) {
+                if (cpu < CPU_SETSIZE) {
+                    CPU_SET(cpu, &requested);
+                }
+            }
+            // 内核把请求与进程可用 CPU（cgroup cpuset）取交集，交集为空时返回 EINVAL
+            const int status = pthread_setaffinity_np(pthread_self(), sizeof(requested), &requested);
+            if (status == 0) {
+                result.affinity_applied = true;
+            } else {
+                result.affinity_note = describeError("pthread_setaffinity_np", status);
+                if (status == EINVAL) {
+                    result.affinity_note += "，请求的 CPU 均不可用，保持原 CPU 集";
+                }
+            }
+        }
+        cpu_set_t achieved;
+        CPU_ZERO(&achieved);
+        if (pthread_getaffinity_np(pthread_self(), sizeof(achieved), &achieved) == 0) {
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                if (CPU_ISSET(cpu, &achieved)) {
+                    result.achieved_cpus.push_back(cpu);
+                }
+            }
+        }
+        if (result.affinity_applied && result.achieved_cpus != cpus) {
+            result.affinity_note = "部分 CPU 不可用";
+        }
+#else
+        if (!cpus.empty()) {
+            result.affinity_note = "当前平台不支持设置线程 CPU 集";
+        }
+#endif
+    }
+
+    void ThreadPlacement::applyRealtime(ThreadPlacementResult& result) {
+        if (result.requested.realtime_priority > 0) {
+            const int min_priority = sched_get_priority_min(SCHED_FIFO);
+            const int max_priority = sched_get_priority_max(SCHED_FIFO);
+            sched_param param{};
+            param.sched_priority = std::min(std::max(result.requested.realtime_priority, min_priority), max_priority);
+            const int status = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+            if (status == 0) {
+                result.realtime_applied = true;
+                if (param.sched_priority != result.requested.realtime_priority) {
+                    result.realtime_note = "优先级截断到 " + std::to_string(param.sched_priority);
+                }
+            } else {
+                result.realtime_note = describeError("pthread_setschedparam", status) + "，保持普通调度";
+            }
+        }
+        int policy = SCHED_OTHER;
+        sched_param param{};
+        if (pthread_getschedparam(pthread_self(), &policy, &param) == 0) {
+            result.achieved_priority = param.sched_priority;
+        }
+        switch (policy) {
+            case SCHED_FIFO: result.achieved_policy = "SCHED_FIFO"; break;
+            case SCHED_RR: result.achieved_policy = "SCHED_RR"; break;
+            case SCHED_OTHER: result.achieved_policy = "SCHED_OTHER"; break;
+            default: result.achieved_policy = "policy " + std::to_string(policy); break;
+        }
+    }
+
+    void ThreadPlacement::applyNumaNode(ThreadPlacementResult& result) {
+        const int node = result.requested.numa_node;
+#if defined(__linux__)
+        if (node >= 0) {
+            if (static_cast<size_t>(node) >= NODE_MASK_WORDS * BITS_PER_WORD ||
+                !std::filesystem::exists("/sys/devices/system/node/node" + std::to_string(node))) {
+                result.numa_note = "NUMA 节点 " + std::to_string(node) + " 不存在，保持默认内存策略";
+            } else {
+                unsigned long mask[NODE_MASK_WORDS] = {};
+                mask[node / BITS_PER_WORD] |= 1UL << (node % BITS_PER_WORD);
+                if (syscall(SYS_set_mempolicy, MEMORY_POLICY_PREFERRED, mask, NODE_MASK_WORDS * BITS_PER_WORD + 1) == 0) {
+                    result.numa_applied = true;
+                } else {
+                    result.numa_note = describeError("set_mempolicy", errno) + "，保持默认内存策略";
+                }
+            }
+        }
+        result.achieved_numa_node = readPreferredNode();
+#else
+        if (node >= 0) {
+            result.numa_note = "当前平台不支持设置 NUMA 内存节点";
+        }
+#endif
+    }
+#endif
+
+    std::vector<ThreadPlacementResult> ThreadPlacement::snapshot() {
+        std::lock_guard<std::mutex> lock(placement_mutex);
+        return placement_results;
+    }
+
+    std::string ThreadPlacement::formatReport() {
+        std::ostringstream report;
+        const auto results = snapshot();
+        report << "线程放置: " << results.size() << " 个线程\n";
+        for (const auto& result : results) {
+            const ThreadPlacementSpec& requested = result.requested;
+            report << result.thread_name << "\n";
+            report << "  要求: " << formatSpec(requested) << "\n";
+            report << "  CPU 集: " << (result.achieved_cpus.empty() ? std::string("未知") : formatCpuList(result.achieved_cpus));
+            if (!requested.cpus.empty()) {
+                report << (result.affinity_applied ? " (已应用)" : " (未应用)");
+            }
+            report << (result.affinity_note.empty() ? "" : " " + result.affinity_note) << "\n";
+            report << "  调度: " << result.achieved_policy << " 优先级 " << result.achieved_priority;
+            if (requested.realtime_priority > 0) {
+                report << (result.realtime_applied ? " (已应用)" : " (未应用)");
+            }
+            report << (result.realtime_note.empty() ? "" : " " + result.realtime_note) << "\n";
+            report << "  内存节点: " << (result.achieved_numa_node < 0 ? std::string("默认") : std::to_string(result.achieved_numa_node));
+            if (requested.numa_node >= 0) {
+                report << (result.numa_applied ? " (已应用)" : " (未应用)");
+            }
+            report << (result.numa_note.empty() ? "" : " " + result.numa_note) << "\n";
+            report << "  应用后所在 CPU: " << result.current_cpu << "\n";
+        }
+        return report.str();
+    }
+
+    bool ThreadPlacement::writeReport(const std::string& path) {
+        std::ofstream file(path);
+        if (!file.is_open()) {
+            return false;
+        }
+        file << formatReport();
+        return true;
+    }
+
+    std::string ThreadPlacement::formatCpuList(const std::vector<int>& cpus) {
+        std::ostringstream text;
+        for (size_t i = 0; i < cpus.size();) {
+            size_t j = i;
+            while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1) {
+                ++j;
+            }
+            if (i > 0) {
+                text << ',';
+            }
+            text << cpus[i];
+            if (j > i) {
+                text << '-' << cpus[j];
+            }
+            i = j + 1;
+        }
+        return text.str();
+    }
+
+} // namespace SimManage
+} // namespace VFT_SMF
@@ -0,0 +1,115 @@
+/**
+ * @file ThreadPlacement.hpp
+ * @brief 线程放置：CPU 亲和性、实时调度优先级与 NUMA 内存节点
+ * @details 各代理线程与主线程（仿真时钟）默认由操作系统自由迁移，迁移与缓存失效表现为步长抖动。
+ *          SimulationConfig.json 的 thread_placement_config 按线程名给出放置描述，例如
+ *              "cpus=2-3,6;priority=80;numa=0"
+ *          - cpus：允许运行的 CPU 列表（逗号分隔，可用 a-b 表示区间）；
+ *          - priority：SCHED_FIFO 优先级（1-99，超出范围时截断），0 或省略表示保持普通调度；
+ *          - numa：内存优先分配的 NUMA 节点（MPOL_PREFERRED，节点内存不足时仍可从其他节点分配）。
+ *
+ *          代理线程在共享数据空间注册时（线程函数开始处）应用自身的放置，主线程在所有代理线程
+ *          启动后应用（避免代理线程继承主线程的 CPU 集与调度策略）。
+ *          每一项单独应用，失败（如无 CAP_SYS_NICE 时设置 SCHED_FIFO 返回 EPERM）只记录原因，
+ *          不影响其余各项与仿真运行；应用后回读线程实际的 CPU 集、调度策略与内存策略，写入报告。
+ *          Windows 下 CPU 集使用 SetThreadAffinityMask（前 64 个 CPU），实时优先级对应
+ *          THREAD_PRIORITY_TIME_CRITICAL，不支持 numa。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace VFT_SMF {
+    namespace SimManage {
+
+        /**
+         * @brief 单个线程的放置要求
+         */
+        struct ThreadPlacementSpec {
+            std::vector<int> cpus;           ///< 允许运行的 CPU，空表示不限制
+            int realtime_priority = 0;       ///< SCHED_FIFO 优先级，0 表示不使用实时调度
+            int numa_node = -1;              ///< 内存优先节点，-1 表示不设置
+
+            bool empty() const { return cpus.empty() && realtime_priority <= 0 && numa_node < 0; }
+        };
+
+        /**
+         * @brief 单个线程实际达到的放置
+         */
+        struct ThreadPlacementResult {
+            std::string thread_name;
+            ThreadPlacementSpec requested;
+
+            bool affinity_applied = false;
+            std::vector<int> achieved_cpus;          ///< 回读的 CPU 集
+            std::string affinity_note;               ///< 未应用或部分应用的原因
+
+            bool realtime_applied = false;
+            std::string achieved_policy;             ///< 回读的调度策略（SCHED_FIFO / SCHED_OTHER 等）
+            int achieved_priority = 0;
+            std::string realtime_note;
+
+            bool numa_applied = false;
+            int achieved_numa_node = -1;             ///< 回读的内存优先节点，-1 表示默认策略
+            std::string numa_note;
+
+            int current_cpu = -1;                    ///< 应用后线程所在的 CPU
+        };
+
+        /**
+         * @brief 线程放置（全部为静态接口）
+         */
+        class ThreadPlacement {
+        public:
+            /**
+             * @brief 解析放置描述（"cpus=2-3,6;priority=80;numa=0"，各项均可省略）
+             * @return 格式错误时返回 false 并给出原因，spec 不变
+             */
+            static bool parseSpec(const std::string& text, ThreadPlacementSpec& spec, std::string& error);
+
+            /**
+             * @brief 设置各线程的放置要求（线程名 -> 要求），并清空此前的结果
+             */
+            static void configure(const std::map<std::string, ThreadPlacementSpec>& specs);
+
+            /**
+             * @brief 是否为该线程配置了放置要求
+             */
+            static bool hasSpec(const std::string& thread_name);
+
+            /**
+             * @brief 对当前线程应用其放置要求并记录实际结果；未配置时不做任何事
+             * @return 是否配置了该线程
+             */
+            static bool applyToCurrentThread(const std::string& thread_name);
+
+            /**
+             * @brief 已应用线程的结果（按应用顺序）
+             */
+            static std::vector<ThreadPlacementResult> snapshot();
+
+            /**
+             * @brief 各线程要求与实际放置的对照文本
+             */
+            static std::string formatReport();
+
+            static bool writeReport(const std::string& path);
+
+            /**
+             * @brief CPU 列表的紧凑写法（如 "2-3,6"）
+             */
+            static std::string formatCpuList(const std::vector<int>& cpus);
+
+        private:
+            static void applyAffinity(ThreadPlacementResult& result);
+            static void applyRealtime(ThreadPlacementResult& result);
+            static void applyNumaNode(ThreadPlacementResult& result);
+        };
+
+    } // namespace SimManage
+} // namespace VFT_SMF
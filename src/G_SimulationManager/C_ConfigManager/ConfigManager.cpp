@@ -16,6 +16,22 @@
 namespace VFT_SMF {
 namespace Config {
 
+    namespace {
+        /**
+         * @brief 线程放置配置项与线程名（线程名与共享数据空间中注册的名称一致）
+         */
+        const std::pair<const char*, const char*> THREAD_PLACEMENT_KEYS[] = {
+            {"main_thread_placement", "Main_Thread"},
+            {"environment_thread_placement", "Environment_Thread"},
+            {"aircraft_system_thread_placement", "Aircraft_System_Thread"},
+            {"flight_dynamics_thread_placement", "Flight_Dynamics_Thread"},
+            {"pilot_thread_placement", "Pilot_Thread"},
+            {"atc_thread_placement", "ATC_Thread"},
+            {"event_monitor_thread_placement", "Event_Monitor_Thread"},
+            {"event_dispatcher_thread_placement", "Event_Dispatcher_Thread"}
+        };
+    }
+
     ConfigManager::ConfigManager(const std::string& config_path)
         : config_file_path(config_path), config_loaded(false) {
     }
@@ -77,6 +93,22 @@ namespace Config {
         return config.data_recorder_config;
     }
 
+    const TelemetryConfig& ConfigManager::getTelemetryConfig() const {
+        return config.telemetry_config;
+    }
+
+    const MonteCarloConfig& ConfigManager::getMonteCarloConfig() const {
+        return config.monte_carlo_config;
+    }
+
+    const ThreadPlacementConfig& ConfigManager::getThreadPlacementConfig() const {
+        return config.thread_placement_config;
+    }
+
+    const AgentTransportConfig& ConfigManager::getAgentTransportConfig() const {
+        return config.agent_transport_config;
+    }
+
     const SimulationParams& ConfigManager::getSimulationParams() const {
         return config.simulation_params;
     }
@@ -105,13 +137,56 @@ namespace Config {
         },
         "data_recorder_config": {
             "output_directory": "output/B737_Taxi",
-            "buffer_size": 1000
+            "buffer_size": 1000,
+            "record_format": "csv",
+            "csv_precision": ""
+        },
+        "telemetry_config": {
+            "enable_telemetry": false,
+            "shm_name": "vft_smf_telemetry",
+            "ring_capacity": 4096,
+            "telemetry_channels": "latitude,longitude,altitude,heading,groundspeed,current_throttle_position,current_brake_pressure",
+            "enable_metrics_endpoint": false,
+            "metrics_port": 9464
+        },
+        "monte_carlo_config": {
+            "enable_aggregation": false,
+            "montecarlo_run_id": -1,
+            "montecarlo_channels": "latitude,longitude,groundspeed,heading,current_brake_pressure,longitudinal_accel",
+            "montecarlo_sample_interval": 0.1,
+            "montecarlo_state_file": "montecarlo/aggregator_state.bin",
+            "montecarlo_summary_directory": "montecarlo",
+            "keep_run_outputs": true
+        },
+        "thread_placement_config": {
+            "enable_thread_placement": false,
+            "main_thread_placement": "",
+            "environment_thread_placement": "",
+            "aircraft_system_thread_placement": "",
+            "flight_dynamics_thread_placement": "",
+            "pilot_thread_placement": "",
+            "atc_thread_placement": "",
+            "event_monitor_thread_placement": "",
+            "event_dispatcher_thread_placement": ""
+        },
+        "agent_transport_config": {
+            "agent_transport": "in_process",
+            "agent_transport_segment": "vft_smf_agents",
+            "remote_agents": "",
+            "remote_step_timeout_ms": 1000,
+            "remote_attach_timeout_ms": 10000
         },
         "simulation_params": {
             "time_scale": 1.0,
             "time_step": 0.01,
             "max_simulation_time": 300.0,
-            "sync_tolerance": 0.001
+            "sync_tolerance": 0.001,
+            "random_seed": 42,
+            "position_integration": "local_ned",
+            "frame_reanchor_distance": 20000.0,
+            "data_pack_directory": "",
+            "allocation_tracking": "off",
+            "perf_counters": "off"
         }
     }
 })";
@@ -146,6 +221,18 @@ namespace Config {
             // 解析数据记录器配置
             parseDataRecorderConfig(json_str);
 
+            // 解析实时遥测配置
+            parseTelemetryConfig(json_str);
+
+            // 解析蒙特卡洛汇总配置
+            parseMonteCarloConfig(json_str);
+
+            // 解析线程放置配置
+            parseThreadPlacementConfig(json_str);
+
+            // 解析代理状态传输配置
+            parseAgentTransportConfig(json_str);
+
             // 解析仿真参数
             parseSimulationParams(json_str);
         } catch (const std::exception& e) {
@@ -164,6 +251,49 @@ namespace Config {
     void ConfigManager::parseDataRecorderConfig(const std::string& json_str) {
         config.data_recorder_config.output_directory = extractStringValue(json_str, "output_directory", "output/B737_Taxi");
         config.data_recorder_config.buffer_size = extractIntValue(json_str, "buffer_size", 1000);
+        config.data_recorder_config.record_format = extractStringValue(json_str, "record_format", "csv");
+        config.data_recorder_config.csv_precision = extractStringValue(json_str, "csv_precision", "");
+    }
+
+    void ConfigManager::parseTelemetryConfig(const std::string& json_str) {
+        const TelemetryConfig defaults;
+        config.telemetry_config.enable_telemetry = extractBoolValue(json_str, "enable_telemetry", false);
+        config.telemetry_config.shm_name = extractStringValue(json_str, "shm_name", defaults.shm_name);
+        config.telemetry_config.ring_capacity = extractIntValue(json_str, "ring_capacity", defaults.ring_capacity);
+        config.telemetry_config.channels = extractStringValue(json_str, "telemetry_channels", defaults.channels);
+        config.telemetry_config.enable_metrics_endpoint = extractBoolValue(json_str, "enable_metrics_endpoint", false);
+        config.telemetry_config.metrics_port = extractIntValue(json_str, "metrics_port", defaults.metrics_port);
+    }
+
+    void ConfigManager::parseMonteCarloConfig(const std::string& json_str) {
+        const MonteCarloConfig defaults;
+        config.monte_carlo_config.enable_aggregation = extractBoolValue(json_str, "enable_aggregation", false);
+        config.monte_carlo_config.run_id = extractIntValue(json_str, "montecarlo_run_id", defaults.run_id);
+        config.monte_carlo_config.channels = extractStringValue(json_str, "montecarlo_channels", defaults.channels);
+        config.monte_carlo_config.sample_interval = extractDoubleValue(json_str, "montecarlo_sample_interval", defaults.sample_interval);
+        config.monte_carlo_config.state_file = extractStringValue(json_str, "montecarlo_state_file", defaults.state_file);
+        config.monte_carlo_config.summary_directory = extractStringValue(json_str, "montecarlo_summary_directory", defaults.summary_directory);
+        config.monte_carlo_config.keep_run_outputs = extractBoolValue(json_str, "keep_run_outputs", defaults.keep_run_outputs);
+    }
+
+    void ConfigManager::parseThreadPlacementConfig(const std::string& json_str) {
+        config.thread_placement_config.enable_thread_placement = extractBoolValue(json_str, "enable_thread_placement", false);
+        config.thread_placement_config.thread_specs.clear();
+        for (const auto& key : THREAD_PLACEMENT_KEYS) {
+            const std::string spec = extractStringValue(json_str, key.first, "");
+            if (!spec.empty()) {
+                config.thread_placement_config.thread_specs[key.second] = spec;
+            }
+        }
+    }
+
+    void ConfigManager::parseAgentTransportConfig(const std::string& json_str) {
+        const AgentTransportConfig defaults;
+        config.agent_transport_config.transport = extractStringValue(json_str, "agent_transport", defaults.transport);
+        config.agent_transport_config.segment_name = extractStringValue(json_str, "agent_transport_segment", defaults.segment_name);
+        config.agent_transport_config.remote_agents = extractStringValue(json_str, "remote_agents", defaults.remote_agents);
+        config.agent_transport_config.step_timeout_ms = extractIntValue(json_str, "remote_step_timeout_ms", defaults.step_timeout_ms);
+        config.agent_transport_config.attach_timeout_ms = extractIntValue(json_str, "remote_attach_timeout_ms", defaults.attach_timeout_ms);
     }
 
     void ConfigManager::parseSimulationParams(const std::string& json_str) {
@@ -171,6 +301,12 @@ namespace Config {
         config.simulation_params.time_step = extractDoubleValue(json_str, "time_step", 0.01);
         config.simulation_params.max_simulation_time = extractDoubleValue(json_str, "max_simulation_time", 300.0);
         config.simulation_params.sync_tolerance = extractDoubleValue(json_str, "sync_tolerance", 0.001);
+        config.simulation_params.random_seed = extractIntValue(json_str, "random_seed", 42);
+        config.simulation_params.position_integration = extractStringValue(json_str, "position_integration", "local_ned");
+        config.simulation_params.frame_reanchor_distance = extractDoubleValue(json_str, "frame_reanchor_distance", 20000.0);
+        config.simulation_params.data_pack_directory = extractStringValue(json_str, "data_pack_directory", "");
+        config.simulation_params.allocation_tracking = extractStringValue(json_str, "allocation_tracking", "off");
+        config.simulation_params.perf_counters = extractStringValue(json_str, "perf_counters", "off");
     }
 
     std::string ConfigManager::extractStringValue(const std::string& json_str, const std::string& key, const std::string& default_value) {
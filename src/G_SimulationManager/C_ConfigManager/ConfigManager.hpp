@@ -15,6 +15,7 @@
 #include <iostream>
 #include <sstream>
 #include <regex>
+#include <map>
 
 namespace VFT_SMF {
 namespace Config {
@@ -40,8 +41,68 @@ namespace Config {
     struct DataRecorderConfig {
         std::string output_directory;
         int buffer_size;
+        std::string record_format; // 输出格式: "csv" / "compressed" / "both"
+        std::string csv_precision; // CSV数值列精度，如 "default=2;latitude=8"，空为全部2位小数
         
-        DataRecorderConfig() : output_directory("output/simulation"), buffer_size(1000) {}
+        DataRecorderConfig() : output_directory("output/simulation"), buffer_size(1000), record_format("csv"), csv_precision("") {}
+    };
+
+    /**
+     * @brief 实时遥测配置结构体
+     */
+    struct TelemetryConfig {
+        bool enable_telemetry;     // 是否将选定通道镜像到共享内存遥测环
+        std::string shm_name;      // 共享内存名称
+        int ring_capacity;         // 环容量（样本数）
+        std::string channels;      // 逗号分隔的通道名列表
+        bool enable_metrics_endpoint;   // 是否在 127.0.0.1 上提供 Prometheus 指标端点 (/metrics)
+        int metrics_port;               // 指标端点端口
+        
+        TelemetryConfig() : enable_telemetry(false), shm_name("vft_smf_telemetry"), ring_capacity(4096),
+                            channels("latitude,longitude,altitude,heading,groundspeed,current_throttle_position,current_brake_pressure"),
+                            enable_metrics_endpoint(false), metrics_port(9464) {}
+    };
+
+    /**
+     * @brief 蒙特卡洛汇总配置结构体
+     */
+    struct MonteCarloConfig {
+        bool enable_aggregation;   // 是否启用跨运行统计汇总
+        int run_id;                // 本次运行ID，<0 时按已累计运行次数自动编号
+        std::string channels;      // 逗号分隔的汇总通道名列表
+        double sample_interval;    // 逐时间点汇总的采样间隔 [s]
+        std::string state_file;    // 汇总器状态文件（跨进程累计）
+        std::string summary_directory; // 汇总CSV输出目录
+        bool keep_run_outputs;     // 是否仍输出本次运行的完整记录文件
+        
+        MonteCarloConfig() : enable_aggregation(false), run_id(-1),
+                             channels("latitude,longitude,groundspeed,heading,current_brake_pressure,longitudinal_accel"),
+                             sample_interval(0.1), state_file("montecarlo/aggregator_state.bin"),
+                             summary_directory("montecarlo"), keep_run_outputs(true) {}
+    };
+
+    /**
+     * @brief 线程放置配置结构体
+     */
+    struct ThreadPlacementConfig {
+        bool enable_thread_placement;                     // 是否应用线程放置
+        std::map<std::string, std::string> thread_specs;  // 线程名 -> 放置描述（"cpus=2-3;priority=80;numa=0"），空表示不设置
+        
+        ThreadPlacementConfig() : enable_thread_placement(false) {}
+    };
+
+    /**
+     * @brief 代理状态传输配置结构体
+     */
+    struct AgentTransportConfig {
+        std::string transport;          // 传输方式: "in_process"（默认，代理均为本进程线程）/ "shared_memory"
+        std::string segment_name;       // 共享内存传输段名称
+        std::string remote_agents;      // 逗号分隔的远程代理名（目前支持 environment），由 remote_agent 工具以独立进程运行
+        int step_timeout_ms;            // 等待远程代理完成一步的上限，超时的代理被剔除
+        int attach_timeout_ms;          // 启动时等待远程代理附加的上限，超时则改在本进程内运行该代理
+        
+        AgentTransportConfig() : transport("in_process"), segment_name("vft_smf_agents"), remote_agents(""),
+                                 step_timeout_ms(1000), attach_timeout_ms(10000) {}
     };
 
     /**
@@ -52,8 +113,16 @@ namespace Config {
         double time_step;
         double max_simulation_time;
         double sync_tolerance;
+        int random_seed;           // 运行种子：相同种子的两次运行逐位一致
+        std::string position_integration;   // 水平位置积分方式：local_ned（锚定切平面）/ spherical
+        double frame_reanchor_distance;     // 切平面重新锚定距离 (m)
+        std::string data_pack_directory;    // 静态数据包缓存目录，空表示系统临时目录
+        std::string allocation_tracking;    // 堆分配统计：off / count（逐线程逐步计数）/ strict（稳态区域分配即中止）
+        std::string perf_counters;          // 性能计数器统计：off / summary（按线程、阶段汇总）/ steps（另写逐步明细）
         
-        SimulationParams() : time_scale(1.0), time_step(0.01), max_simulation_time(300.0), sync_tolerance(0.001) {}
+        SimulationParams() : time_scale(1.0), time_step(0.01), max_simulation_time(300.0), sync_tolerance(0.001), random_seed(42),
+                             position_integration("local_ned"), frame_reanchor_distance(20000.0), data_pack_directory(""),
+                             allocation_tracking("off"), perf_counters("off") {}
     };
 
     /**
@@ -63,6 +132,10 @@ namespace Config {
         std::string flight_plan_file;
         LogConfig log_config;
         DataRecorderConfig data_recorder_config;
+        TelemetryConfig telemetry_config;
+        MonteCarloConfig monte_carlo_config;
+        ThreadPlacementConfig thread_placement_config;
+        AgentTransportConfig agent_transport_config;
         SimulationParams simulation_params;
         
         SimulationConfig() : flight_plan_file("input/FlightPlan.json") {}
@@ -119,6 +192,30 @@ namespace Config {
          */
         const DataRecorderConfig& getDataRecorderConfig() const;
         
+        /**
+         * @brief 获取实时遥测配置
+         * @return 遥测配置引用
+         */
+        const TelemetryConfig& getTelemetryConfig() const;
+        
+        /**
+         * @brief 获取蒙特卡洛汇总配置
+         * @return 蒙特卡洛汇总配置引用
+         */
+        const MonteCarloConfig& getMonteCarloConfig() const;
+        
+        /**
+         * @brief 获取线程放置配置
+         * @return 线程放置配置引用
+         */
+        const ThreadPlacementConfig& getThreadPlacementConfig() const;
+        
+        /**
+         * @brief 获取代理状态传输配置
+         * @return 代理状态传输配置引用
+         */
+        const AgentTransportConfig& getAgentTransportConfig() const;
+        
         /**
          * @brief 获取仿真参数
          * @return 仿真参数引用
@@ -156,6 +253,30 @@ namespace Config {
          */
         void parseDataRecorderConfig(const std::string& json_str);
         
+        /**
+         * @brief 解析实时遥测配置
+         * @param json_str JSON字符串
+         */
+        void parseTelemetryConfig(const std::string& json_str);
+        
+        /**
+         * @brief 解析蒙特卡洛汇总配置
+         * @param json_str JSON字符串
+         */
+        void parseMonteCarloConfig(const std::string& json_str);
+        
+        /**
+         * @brief 解析线程放置配置
+         * @param json_str JSON字符串
+         */
+        void parseThreadPlacementConfig(const std::string& json_str);
+        
+        /**
+         * @brief 解析代理状态传输配置
+         * @param json_str JSON字符串
+         */
+        void parseAgentTransportConfig(const std::string& json_str);
+        
         /**
          * @brief 解析仿真参数
          * @param json_str JSON字符串
@@ -12,6 +12,10 @@
 #include "../../A_PilotAgentModel/Pilot_001/ServiceTwin/PilotManualControlHandler.hpp"
 #include "../../F_ScenarioModelling/A_FlightPlanParser/FlightPlanParser.hpp"
 #include "../../G_SimulationManager/B_SimManage/EventMonitor.hpp"
+#include "../../G_SimulationManager/B_SimManage/RandomService.hpp"
+#include "../../G_SimulationManager/B_SimManage/StepArena.hpp"
+#include "../../G_SimulationManager/B_SimManage/AllocationTracker.hpp"
+#include "../../G_SimulationManager/B_SimManage/PerfCounterProfiler.hpp"
 #include "../../D_ATCAgentModel/A_StandardBase/ATCAgent.hpp"
 #include <algorithm>
 #include <unordered_set>
@@ -40,63 +44,86 @@ void wait_for_environment_thread_ready() {
     while (!environment_thread_ready) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
-    logBrief(LogLevel::Brief, "环境线程已就绪");
+    VFT_LOG_BRIEF("环境线程已就绪");
 }
 
 void wait_for_data_space_thread_ready() {
     while (!data_space_thread_ready) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
-    logBrief(LogLevel::Brief, "数据共享空间线程已就绪");
+    VFT_LOG_BRIEF("数据共享空间线程已就绪");
 }
 
 void wait_for_flight_dynamics_thread_ready() {
     while (!flight_dynamics_thread_ready) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
-    logBrief(LogLevel::Brief, "飞行动力学线程已就绪");
+    VFT_LOG_BRIEF("飞行动力学线程已就绪");
 }
 
 void wait_for_aircraft_system_thread_ready() {
     while (!aircraft_system_thread_ready) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
-    logBrief(LogLevel::Brief, "飞行器系统线程已就绪");
+    VFT_LOG_BRIEF("飞行器系统线程已就绪");
 }
 
 void wait_for_event_monitor_thread_ready() {
     while (!event_monitor_thread_ready) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
-    logBrief(LogLevel::Brief, "事件监测线程已就绪");
+    VFT_LOG_BRIEF("事件监测线程已就绪");
 }
 
 void wait_for_event_dispatcher_thread_ready() {
     while (!event_dispatcher_thread_ready) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
-    logBrief(LogLevel::Brief, "事件分发线程已就绪");
+    VFT_LOG_BRIEF("事件分发线程已就绪");
 }
 
 void wait_for_pilot_thread_ready() {
     while (!pilot_thread_ready) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
-    logBrief(LogLevel::Brief, "飞行员线程已就绪");
+    VFT_LOG_BRIEF("飞行员线程已就绪");
 }
 
 void wait_for_atc_thread_ready() {
     while (!atc_thread_ready) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
-    logBrief(LogLevel::Brief, "ATC线程已就绪");
+    VFT_LOG_BRIEF("ATC线程已就绪");
+}
+
+bool wait_for_remote_agent_ready(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDataSpace> shared_data_space,
+                                 const std::string& participant_name, std::chrono::milliseconds timeout) {
+    const auto transport = shared_data_space->getStateTransport();
+    if (!transport) return false;
+
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    bool attached = false;
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (!attached) {
+            const auto participants = transport->getAttachedParticipants();
+            attached = std::find(participants.begin(), participants.end(), participant_name) != participants.end();
+        }
+        // 远程代理启动时即发布初始状态，导入后本进程的其他代理才能读到
+        if (attached && shared_data_space->importTransportStates() > 0) {
+            VFT_LOG_BRIEF("远程代理 {} 已就绪", participant_name);
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    VFT_LOG_BRIEF("等待远程代理 {} 超时", participant_name);
+    return false;
 }
 
 // ==================== 线程函数实现 ====================
 // 1. 环境线程函数
 void environment_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDataSpace> shared_data_space) {
     
-    logBrief(LogLevel::Brief, "环境线程启动");
+    VFT_LOG_BRIEF("环境线程启动");
     
     // 环境线程自己实现注册到时钟的功能
     const std::string thread_id = "ENV_THREAD_001";
@@ -104,16 +131,17 @@ void environment_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalS
     const std::string thread_type = "Environment";
     
     if (!shared_data_space->registerThread(thread_id, thread_name, thread_type)) {
-        logBrief(LogLevel::Brief, "环境线程注册失败");
+        VFT_LOG_BRIEF("环境线程注册失败");
         return;
     }
     
-    logBrief(LogLevel::Brief, "环境线程注册成功");
+    VFT_LOG_BRIEF("环境线程注册成功");
     
     // 从配置文件读取环境模型名称
     std::string environment_name = "PEK_Runway_02"; // 默认值
+    std::string environment_config_directory;       // 为空时使用环境代理默认目录
     
-    logBrief(LogLevel::Brief, "环境线程: 开始读取配置文件");
+    VFT_LOG_BRIEF("环境线程: 开始读取配置文件");
     
     // 从配置文件读取环境模型名称
     try {
@@ -127,15 +155,22 @@ void environment_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalS
                 flight_plan["flight_plan"].contains("scenario_config") &&
                 flight_plan["flight_plan"]["scenario_config"].contains("Environment_Name")) {
                 environment_name = flight_plan["flight_plan"]["scenario_config"]["Environment_Name"];
-                logBrief(LogLevel::Brief, "从配置文件读取环境模型名称: " + environment_name);
+                VFT_LOG_BRIEF("从配置文件读取环境模型名称: {}", environment_name);
             } else {
-                logBrief(LogLevel::Brief, "配置文件中未找到Environment_Name字段，使用默认值: " + environment_name);
+                VFT_LOG_BRIEF("配置文件中未找到Environment_Name字段，使用默认值: {}", environment_name);
+            }
+            // 可选：环境模型配置根目录（参数扫描等场景下每次运行使用独立的环境配置副本）
+            if (flight_plan.contains("flight_plan") &&
+                flight_plan["flight_plan"].contains("scenario_config") &&
+                flight_plan["flight_plan"]["scenario_config"].contains("Environment_Config_Directory")) {
+                environment_config_directory = flight_plan["flight_plan"]["scenario_config"]["Environment_Config_Directory"];
+                VFT_LOG_BRIEF("从配置文件读取环境配置目录: {}", environment_config_directory);
             }
         } else {
-            logBrief(LogLevel::Brief, "无法打开配置文件，使用默认值: " + environment_name);
+            VFT_LOG_BRIEF("无法打开配置文件，使用默认值: {}", environment_name);
         }
     } catch (const std::exception& e) {
-        logBrief(LogLevel::Brief, "读取环境模型配置失败，使用默认值: " + environment_name + "，错误: " + e.what());
+        VFT_LOG_BRIEF("读取环境模型配置失败，使用默认值: {}，错误: {}", environment_name, e.what());
     }
     
     // 创建环境代理
@@ -144,6 +179,9 @@ void environment_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalS
     env_config.airport_code = "PEK";
     env_config.runway_code = "02";
     env_config.weather_code = "CAVOK";
+    if (!environment_config_directory.empty()) {
+        env_config.config_directory = environment_config_directory;
+    }
     
     VFT_SMF::EnvironmentAgent environment_agent("ENV_001", "Environment_Agent_001", env_config, VFT_SMF::EnvironmentType::AIRPORT_RUNWAY);
     
@@ -159,16 +197,16 @@ void environment_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalS
     // 环境代理初始化后立即运行一次更新，计算出基于初始状态的动态数据并覆盖共享数据空间
     environment_agent.update(0.0); // 运行一次初始更新
     
-    logBrief(LogLevel::Brief, "环境代理创建完成并已启动，初始状态已计算并更新到共享数据空间");
+    VFT_LOG_BRIEF("环境代理创建完成并已启动，初始状态已计算并更新到共享数据空间");
     
     // 设置线程就绪状态
     environment_thread_ready = true;
-    logBrief(LogLevel::Brief, "环境代理已创建并启动");
+    VFT_LOG_BRIEF("环境代理已创建并启动");
     
     double last_update_time = 0.0; // 记录上次更新时间
     
     // 环境线程主循环 - 订阅时钟通知
-    logBrief(LogLevel::Brief, "环境线程进入主循环");
+    VFT_LOG_BRIEF("环境线程进入主循环");
     static uint64_t env_last_step = std::numeric_limits<uint64_t>::max();
     while (!shared_data_space->isSimulationOver()) {
         // 设置状态为等待时钟信号（降噪：不再逐步输出Brief）
@@ -178,7 +216,7 @@ void environment_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalS
         auto sync_signal = shared_data_space->getCurrentSyncSignal();
         while (!(sync_signal.step_ready && sync_signal.current_step != env_last_step)) {
             if (shared_data_space->isSimulationOver()) {
-                logBrief(LogLevel::Brief, "环境线程检测到仿真结束标志，退出等待");
+                VFT_LOG_BRIEF("环境线程检测到仿真结束标志，退出等待");
                 goto env_thread_exit;
             }
             std::this_thread::sleep_for(std::chrono::microseconds(150));
@@ -191,6 +229,10 @@ void environment_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalS
         // 获取当前步与时间（基于步号计算时间，避免浮点累计误差）
         const uint64_t step = sync_signal.current_step;
         env_last_step = step;
+        VFT_SMF::SimManage::RandomService::setCurrentStep(step);
+        VFT_SMF::SimManage::StepArena::beginStep(step);
+        VFT_SMF::SimManage::AllocationTracker::beginStep(step);
+        VFT_SMF::SimManage::PerfCounterProfiler::beginStep(step);
         const double current_time = static_cast<double>(step) * 0.01;
             
         // 环境线程更新
@@ -201,10 +243,11 @@ void environment_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalS
         static int env_log_counter = 0;
         env_log_counter++;
         if (env_log_counter % 50 == 0) {
-            logBrief(LogLevel::Brief, "环境线程更新 - 仿真时间: " + std::to_string(current_time) + "s, 步骤: " + std::to_string(step));
+            VFT_LOG_BRIEF("环境线程更新 - 仿真时间: {}s, 步骤: {}", current_time, step);
         }
         
         // 完成当前步骤的工作，设置状态为已完成（降噪：不再逐步输出Brief）
+        VFT_SMF::SimManage::PerfCounterProfiler::endStep();
         shared_data_space->updateThreadState(thread_id, VFT_SMF::GlobalSharedDataStruct::ThreadSyncState::COMPLETED);
         // 等待时钟重置，避免同一步再次进入
         auto post_sync = shared_data_space->getCurrentSyncSignal();
@@ -220,13 +263,13 @@ void environment_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalS
 env_thread_exit:
     // 注销线程
     shared_data_space->unregisterThread(thread_id);
-    logBrief(LogLevel::Brief, "环境线程结束");
+    VFT_LOG_BRIEF("环境线程结束");
 }
 
 // 2. 数据共享空间线程函数
 void data_space_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDataSpace> shared_data_space) {
     
-    logBrief(LogLevel::Brief, "数据共享空间线程启动");
+    VFT_LOG_BRIEF("数据共享空间线程启动");
     
     // 数据空间线程注册到时钟同步机制
     const std::string thread_id = "DATA_THREAD_001";
@@ -234,15 +277,15 @@ void data_space_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSh
     const std::string thread_type = "DataSpace";
     
     if (!shared_data_space->registerThread(thread_id, thread_name, thread_type)) {
-        logBrief(LogLevel::Brief, "数据共享空间线程注册失败");
+        VFT_LOG_BRIEF("数据共享空间线程注册失败");
         return;
     }
     
-    logBrief(LogLevel::Brief, "数据共享空间线程注册成功");
+    VFT_LOG_BRIEF("数据共享空间线程注册成功");
     
     // 设置线程就绪状态
     data_space_thread_ready = true;
-    logBrief(LogLevel::Brief, "数据共享空间线程已就绪");
+    VFT_LOG_BRIEF("数据共享空间线程已就绪");
 
     
     // 数据共享空间线程主循环 - 强制每步都工作（沿触发 + reset 等待）
@@ -255,7 +298,7 @@ void data_space_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSh
         auto sync_signal = shared_data_space->getCurrentSyncSignal();
         while (!(sync_signal.step_ready && sync_signal.current_step != last_processed_step)) {
             if (shared_data_space->isSimulationOver()) {
-                logBrief(LogLevel::Brief, "数据共享空间线程检测到仿真结束标志，退出等待");
+                VFT_LOG_BRIEF("数据共享空间线程检测到仿真结束标志，退出等待");
                 goto data_thread_exit;
             }
             std::this_thread::sleep_for(std::chrono::microseconds(150));
@@ -268,12 +311,15 @@ void data_space_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSh
         // 使用步号计算时间，避免浮点累计误差
         const uint64_t current_step = sync_signal.current_step;
         last_processed_step = current_step;
+        VFT_SMF::SimManage::StepArena::beginStep(current_step);
+        VFT_SMF::SimManage::AllocationTracker::beginStep(current_step);
+        VFT_SMF::SimManage::PerfCounterProfiler::beginStep(current_step);
         const double record_time = static_cast<double>(current_step) * 0.01; // 与时钟time_step一致
         
         // 记录每个时间步的数据发布
         static int data_log_counter = 0;
         data_log_counter++;
-        logBrief(LogLevel::Brief, "数据共享空间线程 - 数据已发布到记录器，仿真时间: " + std::to_string(record_time) + "s, 步号: " + std::to_string(current_step) + ", 总步数: " + std::to_string(data_log_counter));
+        VFT_LOG_BRIEF("数据共享空间线程 - 数据已发布到记录器，仿真时间: {}s, 步号: {}, 总步数: {}", record_time, current_step, data_log_counter);
         
         // 调用数据发布到数据记录器的函数（每步都调用）
         shared_data_space->publishToDataRecorder(record_time);
@@ -283,13 +329,11 @@ void data_space_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSh
         state_log_counter++;        
         if (state_log_counter % 200 == 0) {
             auto env_state = shared_data_space->getEnvironmentState();
-            logBrief(LogLevel::Brief, 
-                "数据共享空间状态 - 仿真时间: " + std::to_string(record_time) + 
-                "s, 风速: " + std::to_string(env_state.wind_speed) + 
-                " m/s, 空气密度: " + std::to_string(env_state.air_density) + " kg/m³");
+            VFT_LOG_BRIEF("数据共享空间状态 - 仿真时间: {}s, 风速: {} m/s, 空气密度: {} kg/m³", record_time, env_state.wind_speed, env_state.air_density);
         }
         
         // 完成当前步骤的工作，设置状态为已完成
+        VFT_SMF::SimManage::PerfCounterProfiler::endStep();
         shared_data_space->updateThreadState(thread_id, VFT_SMF::GlobalSharedDataStruct::ThreadSyncState::COMPLETED);
         
         // 等待时钟重置，避免同一步再次进入
@@ -308,23 +352,23 @@ data_thread_exit:
     
     // 注销线程
     shared_data_space->unregisterThread(thread_id);
-    logBrief(LogLevel::Brief, "数据共享空间线程结束");
+    VFT_LOG_BRIEF("数据共享空间线程结束");
 }
 
 // 3. 飞行动力学线程函数
 void flight_dynamics_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDataSpace> shared_data_space) {
-    logBrief(LogLevel::Brief, "飞行动力学线程启动");
+    VFT_LOG_BRIEF("飞行动力学线程启动");
     
     const std::string thread_id = "FD_THREAD_001";
     const std::string thread_name = "Flight_Dynamics_Thread";
     const std::string thread_type = "FlightDynamics";
     
     if (!shared_data_space->registerThread(thread_id, thread_name, thread_type)) {
-        logBrief(LogLevel::Brief, "飞行动力学线程注册失败");
+        VFT_LOG_BRIEF("飞行动力学线程注册失败");
         return;
     }
     
-    logBrief(LogLevel::Brief, "飞行动力学线程注册成功");
+    VFT_LOG_BRIEF("飞行动力学线程注册成功");
     
     // 创建并初始化飞行动力学代理
     VFT_SMF::FlightDynamics::FlightDynamicsAgent fd_agent("B737");
@@ -355,7 +399,7 @@ void flight_dynamics_thread_function(std::shared_ptr<GlobalShared_DataSpace::Glo
     net_force.timestamp = VFT_SMF::SimulationTimePoint{};
     shared_data_space->setAircraftNetForce(net_force, "flight_dynamics_initial");
     
-    logBrief(LogLevel::Brief, "飞行动力学代理初始状态计算完成并已更新到共享数据空间");
+    VFT_LOG_BRIEF("飞行动力学代理初始状态计算完成并已更新到共享数据空间");
     
     // 设置线程就绪状态
     flight_dynamics_thread_ready = true;
@@ -367,6 +411,8 @@ void flight_dynamics_thread_function(std::shared_ptr<GlobalShared_DataSpace::Glo
     fd_timing_records.reserve(200000);
     std::unordered_set<uint64_t> fd_recorded_steps;
 #endif
+    // 数据来源在循环外登记一次，步内按ID发布，不再每步查表
+    const auto fd_source = VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::intern("flight_dynamics");
     uint64_t last_processed_step = std::numeric_limits<uint64_t>::max();
     while (!shared_data_space->isSimulationOver()) {
         shared_data_space->updateThreadState(thread_id, VFT_SMF::GlobalSharedDataStruct::ThreadSyncState::WAITING_FOR_CLOCK);
@@ -385,6 +431,10 @@ void flight_dynamics_thread_function(std::shared_ptr<GlobalShared_DataSpace::Glo
         
         // 锁定本步步号
         const uint64_t fd_step = sync_signal.current_step;
+        VFT_SMF::SimManage::RandomService::setCurrentStep(fd_step);
+        VFT_SMF::SimManage::StepArena::beginStep(fd_step);
+        VFT_SMF::SimManage::AllocationTracker::beginStep(fd_step);
+        VFT_SMF::SimManage::PerfCounterProfiler::beginStep(fd_step);
         last_processed_step = fd_step;
         
         auto step_start_tp = std::chrono::steady_clock::now();
@@ -392,38 +442,48 @@ void flight_dynamics_thread_function(std::shared_ptr<GlobalShared_DataSpace::Glo
         const double current_time = static_cast<double>(fd_step) * 0.01;
         const double dt = 0.01; // 固定时间步长（恢复）
         
-        // 从共享空间获取输入
-        const auto system_state = shared_data_space->getAircraftSystemState();
-        const auto env_state = shared_data_space->getEnvironmentState();
-        
-        // 更新飞行动力学
-        auto new_state = fd_agent.updateFromGlobalState(dt, system_state, env_state);
-        
-        // 发布飞行状态
-        shared_data_space->setAircraftFlightState(new_state, "flight_dynamics");
-
-        // 计算并发布六分量合外力（含推/阻/升/重等分解），供数据记录器输出
         {
-            auto forces = fd_agent.getCurrentForces();
-            VFT_SMF::GlobalSharedDataStruct::AircraftNetForce net_force;
-            net_force.longitudinal_force = forces.force_x;
-            net_force.lateral_force = forces.force_y;
-            net_force.vertical_force = forces.force_z;
-            net_force.roll_moment = forces.moment_x;
-            net_force.pitch_moment = forces.moment_y;
-            net_force.yaw_moment = forces.moment_z;
-            // 分解：推力/阻力/升力/重力/侧力
-            net_force.thrust_force = (forces.force_x > 0.0) ? forces.force_x : 0.0;
-            net_force.drag_force = (forces.force_x < 0.0) ? -forces.force_x : 0.0;
-            net_force.lift_force = (forces.force_z > 0.0) ? forces.force_z : 0.0;
-            // 使用系统状态中的质量推导重量（向下为负号）
-            auto system_state_snapshot = shared_data_space->getAircraftSystemState();
-            net_force.weight_force = -system_state_snapshot.current_mass * 9.81;
-            net_force.side_force = forces.force_y;
-            net_force.timestamp = VFT_SMF::SimulationTimePoint{};
-            shared_data_space->setAircraftNetForce(net_force, "flight_dynamics");
+            // 稳态区域：推进与发布不应有堆分配（allocation_tracking 为 strict 时区域内分配即中止）
+            VFT_SMF::SimManage::AllocationTracker::SteadyStateScope steady_state("flight_dynamics_step");
+            
+            // 从共享空间获取输入
+            const auto system_state = shared_data_space->getAircraftSystemState();
+            const auto env_state = shared_data_space->getEnvironmentState();
+            
+            // 更新飞行动力学
+            VFT_SMF::GlobalSharedDataStruct::AircraftFlightState new_state;
+            {
+                VFT_SMF::SimManage::PerfCounterProfiler::PhaseScope phase("fd_propagate");
+                new_state = fd_agent.updateFromGlobalState(dt, system_state, env_state);
+            }
+            
+            VFT_SMF::SimManage::PerfCounterProfiler::PhaseScope publish_phase("fd_publish");
+            // 发布飞行状态
+            shared_data_space->setAircraftFlightState(new_state, fd_source);
+
+            // 计算并发布六分量合外力（含推/阻/升/重等分解），供数据记录器输出
+            {
+                auto forces = fd_agent.getCurrentForces();
+                VFT_SMF::GlobalSharedDataStruct::AircraftNetForce net_force;
+                net_force.longitudinal_force = forces.force_x;
+                net_force.lateral_force = forces.force_y;
+                net_force.vertical_force = forces.force_z;
+                net_force.roll_moment = forces.moment_x;
+                net_force.pitch_moment = forces.moment_y;
+                net_force.yaw_moment = forces.moment_z;
+                // 分解：推力/阻力/升力/重力/侧力
+                net_force.thrust_force = (forces.force_x > 0.0) ? forces.force_x : 0.0;
+                net_force.drag_force = (forces.force_x < 0.0) ? -forces.force_x : 0.0;
+                net_force.lift_force = (forces.force_z > 0.0) ? forces.force_z : 0.0;
+                // 使用系统状态中的质量推导重量（向下为负号）
+                auto system_state_snapshot = shared_data_space->getAircraftSystemState();
+                net_force.weight_force = -system_state_snapshot.current_mass * 9.81;
+                net_force.side_force = forces.force_y;
+                net_force.timestamp = VFT_SMF::SimulationTimePoint{};
+                shared_data_space->setAircraftNetForce(net_force, fd_source);
+            }
         }
-        
+            
         // 记录本步FD耗时（纳秒），从 step 1 开始记录（跳过 step 0）
 #if VFT_ENABLE_FD_TIMING
         auto step_end_tp = std::chrono::steady_clock::now();
@@ -438,9 +498,10 @@ void flight_dynamics_thread_function(std::shared_ptr<GlobalShared_DataSpace::Glo
         static int fd_log_counter = 0;
         fd_log_counter++;
         if (fd_log_counter % 100 == 0) {
-            logBrief(LogLevel::Brief, "飞行动力学更新 - 仿真时间: " + std::to_string(current_time) + "s");
+            VFT_LOG_BRIEF("飞行动力学更新 - 仿真时间: {}s", current_time);
         }
         
+        VFT_SMF::SimManage::PerfCounterProfiler::endStep();
         shared_data_space->updateThreadState(thread_id, VFT_SMF::GlobalSharedDataStruct::ThreadSyncState::COMPLETED);
         // 等待时钟重置，避免同一步再次进入
         auto post_sync = shared_data_space->getCurrentSyncSignal();
@@ -483,9 +544,9 @@ fd_thread_exit:
                     msg += std::to_string(missing_steps[i]);
                     if (i + 1 < missing_steps.size()) msg += ",";
                 }
-                logBrief(LogLevel::Brief, msg);
+                VFT_LOG_BRIEF("{}", msg);
             } else {
-                logBrief(LogLevel::Brief, "FD计时完整覆盖 [1.." + std::to_string(last_processed_step) + "]");
+                VFT_LOG_BRIEF("FD计时完整覆盖 [1..{}]", last_processed_step);
             }
         }
     } catch (...) {
@@ -493,33 +554,33 @@ fd_thread_exit:
     }
 #endif
     shared_data_space->unregisterThread(thread_id);
-    logBrief(LogLevel::Brief, "飞行动力学线程结束");
+    VFT_LOG_BRIEF("飞行动力学线程结束");
 }
 
 // 4. 飞行器系统线程函数
 void aircraft_system_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDataSpace> shared_data_space) {
 
-    logBrief(LogLevel::Brief, "飞行器系统线程启动");
+    VFT_LOG_BRIEF("飞行器系统线程启动");
     
     const std::string thread_id = "AC_THREAD_001";
     const std::string thread_name = "Aircraft_System_Thread";
     const std::string thread_type = "AircraftSystem";
     
     if (!shared_data_space->registerThread(thread_id, thread_name, thread_type)) {
-        logBrief(LogLevel::Brief, "飞行器系统线程注册失败");
+        VFT_LOG_BRIEF("飞行器系统线程注册失败");
         return;
     }
     
-    logBrief(LogLevel::Brief, "飞行器系统线程注册成功");
+    VFT_LOG_BRIEF("飞行器系统线程注册成功");
 
     // 从飞行计划数据中获取配置的Aircraft_ID
     auto flight_plan_data = shared_data_space->getFlightPlanData();
     std::string aircraft_id = flight_plan_data.scenario_config.Aircraft_ID;
     if (aircraft_id.empty()) {
         aircraft_id = "Aircraft_001"; // 默认值
-        logBrief(LogLevel::Brief, "警告: 未找到配置的Aircraft_ID，使用默认值: " + aircraft_id);
+        VFT_LOG_BRIEF("警告: 未找到配置的Aircraft_ID，使用默认值: {}", aircraft_id);
     } else {
-        logBrief(LogLevel::Brief, "使用配置的Aircraft_ID: " + aircraft_id);
+        VFT_LOG_BRIEF("使用配置的Aircraft_ID: {}", aircraft_id);
     }
     
     // 创建并初始化飞机系统代理
@@ -538,14 +599,14 @@ void aircraft_system_thread_function(std::shared_ptr<GlobalShared_DataSpace::Glo
     auto initial_system_state = ACSystem_agent.getAircraftSystemState();
     shared_data_space->setAircraftSystemState(initial_system_state, "aircraft_system_initial");
     
-    logBrief(LogLevel::Brief, "飞机系统代理初始状态计算完成并已更新到共享数据空间");
+    VFT_LOG_BRIEF("飞机系统代理初始状态计算完成并已更新到共享数据空间");
     
     // 设置线程就绪状态
     aircraft_system_thread_ready = true;
-    logBrief(LogLevel::Brief, "飞行器系统代理已创建并启动");
+    VFT_LOG_BRIEF("飞行器系统代理已创建并启动");
     
     // 飞行器系统线程主循环 - 订阅时钟通知
-    logBrief(LogLevel::Brief, "飞行器系统线程进入主循环");
+    VFT_LOG_BRIEF("飞行器系统线程进入主循环");
     static uint64_t ac_last_step = std::numeric_limits<uint64_t>::max();
     while (!shared_data_space->isSimulationOver()) {
         // 设置状态为等待时钟信号
@@ -555,7 +616,7 @@ void aircraft_system_thread_function(std::shared_ptr<GlobalShared_DataSpace::Glo
         auto sync_signal = shared_data_space->getCurrentSyncSignal();
         while (!(sync_signal.step_ready && sync_signal.current_step != ac_last_step)) {
             if (shared_data_space->isSimulationOver()) {
-                logBrief(LogLevel::Brief, "飞行器系统线程检测到仿真结束标志，退出等待");
+                VFT_LOG_BRIEF("飞行器系统线程检测到仿真结束标志，退出等待");
                 goto ac_thread_exit;
             }
             std::this_thread::sleep_for(std::chrono::microseconds(150));
@@ -568,6 +629,10 @@ void aircraft_system_thread_function(std::shared_ptr<GlobalShared_DataSpace::Glo
         // 获取当前步与时间
         const uint64_t step = sync_signal.current_step;
         ac_last_step = step;
+        VFT_SMF::SimManage::RandomService::setCurrentStep(step);
+        VFT_SMF::SimManage::StepArena::beginStep(step);
+        VFT_SMF::SimManage::AllocationTracker::beginStep(step);
+        VFT_SMF::SimManage::PerfCounterProfiler::beginStep(step);
         const double current_time = static_cast<double>(step) * 0.01;
             
         // 飞行器系统线程更新
@@ -586,16 +651,19 @@ void aircraft_system_thread_function(std::shared_ptr<GlobalShared_DataSpace::Glo
             updated_system_state.current_aileron_deflection = final_control_command.aileron_command * 50.0;
             updated_system_state.current_rudder_deflection = final_control_command.rudder_command * 50.0;
             updated_system_state.current_brake_pressure = final_control_command.brake_command * 1e6; // 转换为Pa
-            updated_system_state.datasource = "aircraft_system_with_priority_control";
+            static const auto priority_control_source =
+                VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::intern("aircraft_system_with_priority_control");
+            updated_system_state.datasource = priority_control_source;
             
-            logBrief(LogLevel::Brief, "飞机系统线程: 应用优先级控制指令 - 源: " + final_control_command.source +
-                    ", 油门: " + std::to_string(final_control_command.throttle_command) +
-                    ", 刹车: " + std::to_string(final_control_command.brake_command));
+            VFT_LOG_BRIEF("飞机系统线程: 应用优先级控制指令 - 源: {}, 油门: {}, 刹车: {}",
+                          final_control_command.source, final_control_command.throttle_command, final_control_command.brake_command);
         } else {
             // 如果没有激活的控制指令，保留原有逻辑
             auto existing_system_state = shared_data_space->getAircraftSystemState();
             updated_system_state.current_throttle_position = existing_system_state.current_throttle_position;
-            updated_system_state.datasource = "aircraft_system";
+            static const auto aircraft_system_source =
+                VFT_SMF::GlobalSharedDataStruct::DataSourceRegistry::intern("aircraft_system");
+            updated_system_state.datasource = aircraft_system_source;
         }
         
         shared_data_space->setAircraftSystemState(updated_system_state, updated_system_state.datasource);
@@ -604,10 +672,11 @@ void aircraft_system_thread_function(std::shared_ptr<GlobalShared_DataSpace::Glo
         static int ac_log_counter = 0;
         ac_log_counter++;
         if (ac_log_counter % 50 == 0) {
-            logBrief(LogLevel::Brief, "飞行器系统线程更新 - 仿真时间: " + std::to_string(current_time) + "s, 步骤: " + std::to_string(step));
+            VFT_LOG_BRIEF("飞行器系统线程更新 - 仿真时间: {}s, 步骤: {}", current_time, step);
         }
         
         // 完成当前步骤的工作，设置状态为已完成
+        VFT_SMF::SimManage::PerfCounterProfiler::endStep();
         shared_data_space->updateThreadState(thread_id, VFT_SMF::GlobalSharedDataStruct::ThreadSyncState::COMPLETED);
         // 等待时钟重置，避免同一步再次进入
         auto post_sync = shared_data_space->getCurrentSyncSignal();
@@ -623,24 +692,24 @@ void aircraft_system_thread_function(std::shared_ptr<GlobalShared_DataSpace::Glo
 ac_thread_exit:
     // 注销线程
     shared_data_space->unregisterThread(thread_id);
-    logBrief(LogLevel::Brief, "飞行器系统线程结束");
+    VFT_LOG_BRIEF("飞行器系统线程结束");
 }
 
 // 5. 事件监测线程函数
 void event_monitor_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDataSpace> shared_data_space) {
    
-    logBrief(LogLevel::Brief, "事件监测线程启动");
+    VFT_LOG_BRIEF("事件监测线程启动");
     
     const std::string thread_id = "EM_THREAD_001";
     const std::string thread_name = "Event_Monitor_Thread";
     const std::string thread_type = "EventMonitor";
     
     if (!shared_data_space->registerThread(thread_id, thread_name, thread_type)) {
-        logBrief(LogLevel::Brief, "事件监测线程注册失败");
+        VFT_LOG_BRIEF("事件监测线程注册失败");
         return;
     }
     
-    logBrief(LogLevel::Brief, "事件监测线程注册成功");
+    VFT_LOG_BRIEF("事件监测线程注册成功");
 
     // 创建事件监测器
     std::unique_ptr<VFT_SMF::EventMonitor> event_monitor = 
@@ -651,10 +720,10 @@ void event_monitor_thread_function(std::shared_ptr<GlobalShared_DataSpace::Globa
     
     // 设置线程就绪状态
     event_monitor_thread_ready = true;
-    logBrief(LogLevel::Brief, "事件监测器已创建并初始化");
+    VFT_LOG_BRIEF("事件监测器已创建并初始化");
     
     // 事件监测线程主循环 - 订阅时钟通知
-    logBrief(LogLevel::Brief, "事件监测线程进入主循环");
+    VFT_LOG_BRIEF("事件监测线程进入主循环");
     static uint64_t em_last_step = std::numeric_limits<uint64_t>::max();
     while (!shared_data_space->isSimulationOver()) {
         // 设置状态为等待时钟信号
@@ -664,7 +733,7 @@ void event_monitor_thread_function(std::shared_ptr<GlobalShared_DataSpace::Globa
         auto sync_signal = shared_data_space->getCurrentSyncSignal();
         while (!(sync_signal.step_ready && sync_signal.current_step != em_last_step)) {
             if (shared_data_space->isSimulationOver()) {
-                logBrief(LogLevel::Brief, "事件监测线程检测到仿真结束标志，退出等待");
+                VFT_LOG_BRIEF("事件监测线程检测到仿真结束标志，退出等待");
                 goto em_thread_exit;
             }
             std::this_thread::sleep_for(std::chrono::microseconds(150));
@@ -677,6 +746,10 @@ void event_monitor_thread_function(std::shared_ptr<GlobalShared_DataSpace::Globa
         // 获取当前步与时间
         const uint64_t step = sync_signal.current_step;
         em_last_step = step;
+        VFT_SMF::SimManage::RandomService::setCurrentStep(step);
+        VFT_SMF::SimManage::StepArena::beginStep(step);
+        VFT_SMF::SimManage::AllocationTracker::beginStep(step);
+        VFT_SMF::SimManage::PerfCounterProfiler::beginStep(step);
         const double current_time = static_cast<double>(step) * 0.01;
             
         // 事件监测更新
@@ -690,22 +763,23 @@ void event_monitor_thread_function(std::shared_ptr<GlobalShared_DataSpace::Globa
             // 仍保留按时间步记录，供触发事件CSV输出（库内已去重）
             shared_data_space->addEventToStep(current_time, event);
             
-            logBrief(LogLevel::Brief, "事件触发并入队: " + event.event_name + " (ID: " + event.getEventIdString() + ") - 时间: " + std::to_string(current_time) + "s");
+            VFT_LOG_BRIEF("事件触发并入队: {} (ID: {}) - 时间: {}s", event.event_name, event.getEventIdString(), current_time);
         }
         
         // 减少日志输出频率，只在每100步输出一次
         static int em_log_counter = 0;
         em_log_counter++;
         if (em_log_counter % 100 == 0) {
-            logBrief(LogLevel::Brief, "事件监测线程更新 - 仿真时间: " + std::to_string(current_time) + "s, 步骤: " + std::to_string(step));
+            VFT_LOG_BRIEF("事件监测线程更新 - 仿真时间: {}s, 步骤: {}", current_time, step);
         }
         
         // 如果有事件被触发，输出日志
         if (!newly_triggered_events.empty()) {
-            logBrief(LogLevel::Brief, "事件监测线程在时间 " + std::to_string(current_time) + "s 检测到 " + std::to_string(newly_triggered_events.size()) + " 个新事件");
+            VFT_LOG_BRIEF("事件监测线程在时间 {}s 检测到 {} 个新事件", current_time, newly_triggered_events.size());
         }
         
         // 完成当前步骤的工作，设置状态为已完成
+        VFT_SMF::SimManage::PerfCounterProfiler::endStep();
         shared_data_space->updateThreadState(thread_id, VFT_SMF::GlobalSharedDataStruct::ThreadSyncState::COMPLETED);
         // 等待时钟重置，避免同一步再次进入
         auto post_sync = shared_data_space->getCurrentSyncSignal();
@@ -721,18 +795,18 @@ void event_monitor_thread_function(std::shared_ptr<GlobalShared_DataSpace::Globa
 em_thread_exit:
     // 生成事件监测报告
     std::string event_report = event_monitor->generateReport();
-    logBrief(LogLevel::Brief, "事件监测报告:\n" + event_report);
+    VFT_LOG_BRIEF("事件监测报告:\n{}", event_report);
     
     // 注销线程
     shared_data_space->unregisterThread(thread_id);
-    logBrief(LogLevel::Brief, "事件监测线程结束");
+    VFT_LOG_BRIEF("事件监测线程结束");
 }
 
 // 6. 事件分发线程
 
 void event_dispatcher_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDataSpace> shared_data_space) {
     
-    logBrief(LogLevel::Brief, "事件分发线程启动");
+    VFT_LOG_BRIEF("事件分发线程启动");
     
     // 事件分发线程自己实现注册到时钟的功能
     const std::string thread_id = "ED_THREAD_001";
@@ -740,11 +814,11 @@ void event_dispatcher_thread_function(std::shared_ptr<GlobalShared_DataSpace::Gl
     const std::string thread_type = "EventDispatcher";
     
     if (!shared_data_space->registerThread(thread_id, thread_name, thread_type)) {
-        logBrief(LogLevel::Brief, "事件分发线程注册失败");
+        VFT_LOG_BRIEF("事件分发线程注册失败");
         return;
     }
     
-    logBrief(LogLevel::Brief, "事件分发线程注册成功");
+    VFT_LOG_BRIEF("事件分发线程注册成功");
 
     // 创建事件分发器
     std::unique_ptr<EventDispatcher> event_dispatcher = 
@@ -752,10 +826,10 @@ void event_dispatcher_thread_function(std::shared_ptr<GlobalShared_DataSpace::Gl
     
     // 设置线程就绪状态
     event_dispatcher_thread_ready = true;
-    logBrief(LogLevel::Brief, "EventDispatcher 已创建并初始化");
+    VFT_LOG_BRIEF("EventDispatcher 已创建并初始化");
     
     // 控制器管理线程主循环 - 订阅时钟通知
-    logBrief(LogLevel::Brief, "事件分发线程进入主循环");
+    VFT_LOG_BRIEF("事件分发线程进入主循环");
     static uint64_t cm_last_step = std::numeric_limits<uint64_t>::max();
     while (!shared_data_space->isSimulationOver()) {
         // 设置状态为等待时钟信号
@@ -778,6 +852,10 @@ void event_dispatcher_thread_function(std::shared_ptr<GlobalShared_DataSpace::Gl
         // 获取当前步与时间
         const uint64_t step = sync_signal.current_step;
         cm_last_step = step;
+        VFT_SMF::SimManage::RandomService::setCurrentStep(step);
+        VFT_SMF::SimManage::StepArena::beginStep(step);
+        VFT_SMF::SimManage::AllocationTracker::beginStep(step);
+        VFT_SMF::SimManage::PerfCounterProfiler::beginStep(step);
         const double current_time = static_cast<double>(step) * 0.01;
             
         // 使用新的方法处理已触发事件列表
@@ -787,10 +865,11 @@ void event_dispatcher_thread_function(std::shared_ptr<GlobalShared_DataSpace::Gl
         static int cm_log_counter = 0;
         cm_log_counter++;
         if (cm_log_counter % 100 == 0) {
-            logBrief(LogLevel::Brief, "事件分发线程更新 - 仿真时间: " + std::to_string(current_time) + "s, 步骤: " + std::to_string(step));
+            VFT_LOG_BRIEF("事件分发线程更新 - 仿真时间: {}s, 步骤: {}", current_time, step);
         }
         
         // 完成当前步骤的工作，设置状态为已完成
+        VFT_SMF::SimManage::PerfCounterProfiler::endStep();
         shared_data_space->updateThreadState(thread_id, VFT_SMF::GlobalSharedDataStruct::ThreadSyncState::COMPLETED);
         // 等待时钟重置，避免同一步再次进入
         auto post_sync = shared_data_space->getCurrentSyncSignal();
@@ -808,13 +887,13 @@ cm_thread_exit:
     // 注销线程
     std::cout << "事件分发线程退出清理" << std::endl;
     shared_data_space->unregisterThread(thread_id);
-    logBrief(LogLevel::Brief, "事件分发线程结束");
+    VFT_LOG_BRIEF("事件分发线程结束");
 }
 
 // 7. 飞行员线程函数
 void pilot_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDataSpace> shared_data_space) {
     
-    logBrief(LogLevel::Brief, "飞行员线程启动");
+    VFT_LOG_BRIEF("飞行员线程启动");
     
     // 飞行员线程自己实现注册到时钟的功能
     const std::string thread_id = "PILOT_THREAD_001";
@@ -822,20 +901,20 @@ void pilot_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedD
     const std::string thread_type = "Pilot";
     
     if (!shared_data_space->registerThread(thread_id, thread_name, thread_type)) {
-        logBrief(LogLevel::Brief, "飞行员线程注册失败");
+        VFT_LOG_BRIEF("飞行员线程注册失败");
         return;
     }
     
-    logBrief(LogLevel::Brief, "飞行员线程注册成功");
+    VFT_LOG_BRIEF("飞行员线程注册成功");
 
     // 从飞行计划数据中获取配置的Pilot_ID
     auto flight_plan_data = shared_data_space->getFlightPlanData();
     std::string pilot_id = flight_plan_data.scenario_config.Pilot_ID;
     if (pilot_id.empty()) {
         pilot_id = "Pilot_001"; // 默认值
-        logBrief(LogLevel::Brief, "警告: 未找到配置的Pilot_ID，使用默认值: " + pilot_id);
+        VFT_LOG_BRIEF("警告: 未找到配置的Pilot_ID，使用默认值: {}", pilot_id);
     } else {
-        logBrief(LogLevel::Brief, "使用配置的Pilot_ID: " + pilot_id);
+        VFT_LOG_BRIEF("使用配置的Pilot_ID: {}", pilot_id);
     }
     
     // 创建并初始化飞行员代理
@@ -854,14 +933,14 @@ void pilot_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedD
     // 飞行员代理初始化后立即运行一次更新，计算出基于初始状态的动态数据并覆盖共享数据空间
     pilot_agent.update(0.0); // 运行一次初始更新
     
-    logBrief(LogLevel::Brief, "飞行员代理初始状态计算完成并已更新到共享数据空间");
+    VFT_LOG_BRIEF("飞行员代理初始状态计算完成并已更新到共享数据空间");
     
     // 设置线程就绪状态
     pilot_thread_ready = true;
-    logBrief(LogLevel::Brief, "飞行员代理已创建并启动");
+    VFT_LOG_BRIEF("飞行员代理已创建并启动");
     
     // 飞行员线程主循环 - 订阅时钟通知
-    logBrief(LogLevel::Brief, "飞行员线程进入主循环");
+    VFT_LOG_BRIEF("飞行员线程进入主循环");
     static uint64_t pilot_last_step = std::numeric_limits<uint64_t>::max();
     while (!shared_data_space->isSimulationOver()) {
         // 设置状态为等待时钟信号
@@ -871,7 +950,7 @@ void pilot_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedD
         auto sync_signal = shared_data_space->getCurrentSyncSignal();
         while (!(sync_signal.step_ready && sync_signal.current_step != pilot_last_step)) {
             if (shared_data_space->isSimulationOver()) {
-                logBrief(LogLevel::Brief, "飞行员线程检测到仿真结束标志，退出等待");
+                VFT_LOG_BRIEF("飞行员线程检测到仿真结束标志，退出等待");
                 goto pilot_thread_exit;
             }
             std::this_thread::sleep_for(std::chrono::microseconds(150));
@@ -884,18 +963,23 @@ void pilot_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedD
         // 获取当前步与时间
         const uint64_t step = sync_signal.current_step;
         pilot_last_step = step;
+        VFT_SMF::SimManage::RandomService::setCurrentStep(step);
+        VFT_SMF::SimManage::StepArena::beginStep(step);
+        VFT_SMF::SimManage::AllocationTracker::beginStep(step);
+        VFT_SMF::SimManage::PerfCounterProfiler::beginStep(step);
         const double current_time = static_cast<double>(step) * 0.01;
             
         // 飞行员代理更新
         pilot_agent.update(0.01); // 固定时间步长
         
-        // 检查是否有需要飞行员处理的事件（检查当前时间步及之前未处理的事件）
-        auto triggered_events = shared_data_space->getTriggeredEventLibrary().getEventsAtStep(current_time);
+        // 检查是否有需要飞行员处理的事件（检查当前时间步及之前未处理的事件），列表分配在步内存区
+        std::pmr::memory_resource* step_resource = VFT_SMF::SimManage::StepArena::resource();
+        auto triggered_events = shared_data_space->getTriggeredEventLibrary().getEventsAtStep(current_time, step_resource);
         // 如果当前时间步没有事件，检查是否有在非整数秒触发的事件（时间匹配容差）
         if (triggered_events.empty()) {
             // 检查时间范围内的所有事件，容差为±0.1秒
             for (double check_time = current_time - 0.1; check_time <= current_time + 0.1; check_time += 0.01) {
-                auto events_at_time = shared_data_space->getTriggeredEventLibrary().getEventsAtStep(check_time);
+                auto events_at_time = shared_data_space->getTriggeredEventLibrary().getEventsAtStep(check_time, step_resource);
                 for (const auto& event : events_at_time) {
                     if (event.is_triggered) {
                         triggered_events.push_back(event);
@@ -907,26 +991,22 @@ void pilot_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedD
             if (event.is_triggered) {
                 // 1) ATC 指令类 -> 交给飞行员ATC处理器
                 if (event.driven_process.controller_type == "ATC_command") {
-                    logBrief(LogLevel::Brief, "飞行员线程处理ATC指令: " + event.event_name + 
-                            " (控制器: " + event.driven_process.controller_name + ") - 时间: " + std::to_string(current_time) + "s");
+                    VFT_LOG_BRIEF("飞行员线程处理ATC指令: {} (控制器: {}) - 时间: {}s", event.event_name, event.driven_process.controller_name, current_time);
                     
                     // 使用飞行员ATC指令处理器处理指令
                     pilot_atc_command_handler->handlePilotATCCommand(event, current_time);
                 // 2) 飞行员手动控制类 -> 交给飞行员手动控制处理器
                 } else if (event.driven_process.controller_type == "Pilot_Manual_Control") {
-                    logBrief(LogLevel::Brief, "飞行员线程处理手动控制: " + event.event_name +
-                            " (控制器: " + event.driven_process.controller_name + ") - 时间: " + std::to_string(current_time) + "s");
+                    VFT_LOG_BRIEF("飞行员线程处理手动控制: {} (控制器: {}) - 时间: {}s", event.event_name, event.driven_process.controller_name, current_time);
                     pilot_manual_control_handler->handleManualControl(event, current_time);
                 // 3) Pilot 飞行任务控制（例如 MaintainSPDRunway），也由飞行员线程处理
                 } else if (event.driven_process.controller_type == "Pilot_Flight_Task_Control") {
-                    logBrief(LogLevel::Brief, "飞行员线程处理飞行任务控制: " + event.event_name +
-                            " (控制器: " + event.driven_process.controller_name + ") - 时间: " + std::to_string(current_time) + "s");
+                    VFT_LOG_BRIEF("飞行员线程处理飞行任务控制: {} (控制器: {}) - 时间: {}s", event.event_name, event.driven_process.controller_name, current_time);
                     pilot_manual_control_handler->handleManualControl(event, current_time);
                 // 4) 将 MaintainSPDRunway 视作飞行员的手动控制器，由飞行员线程处理（兼容旧映射: Aircraft_AutoPilot）
                 } else if (event.driven_process.controller_type == "Aircraft_AutoPilot"
                            && event.driven_process.controller_name == "MaintainSPDRunway") {
-                    logBrief(LogLevel::Brief, "飞行员线程处理速度保持: " + event.event_name +
-                            " (控制器: MaintainSPDRunway) - 时间: " + std::to_string(current_time) + "s");
+                    VFT_LOG_BRIEF("飞行员线程处理速度保持: {} (控制器: MaintainSPDRunway) - 时间: {}s", event.event_name, current_time);
                     pilot_manual_control_handler->handleManualControl(event, current_time);
                 }
             }
@@ -945,8 +1025,7 @@ void pilot_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedD
                 synth_event.driven_process.controller_type = "Pilot_Manual_Control";
                 synth_event.driven_process.controller_name = "throttle_push2max";
                 synth_event.driven_process.description = "推油门控制";
-                logBrief(LogLevel::Brief, "飞行员线程兜底触发手动控制: " + synth_event.event_name +
-                        " -> " + synth_event.driven_process.controller_name + " - 时间: " + std::to_string(current_time) + "s");
+                VFT_LOG_BRIEF("飞行员线程兜底触发手动控制: {} -> {} - 时间: {}s", synth_event.event_name, synth_event.driven_process.controller_name, current_time);
                 pilot_manual_control_handler->handleManualControl(synth_event, current_time);
                 throttle_applied_after_clearance = true;
             }
@@ -961,10 +1040,11 @@ void pilot_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedD
         static int pilot_log_counter = 0;
         pilot_log_counter++;
         if (pilot_log_counter % 100 == 0) {
-            logBrief(LogLevel::Brief, "飞行员线程更新 - 仿真时间: " + std::to_string(current_time) + "s, 步骤: " + std::to_string(step));
+            VFT_LOG_BRIEF("飞行员线程更新 - 仿真时间: {}s, 步骤: {}", current_time, step);
         }
         
         // 完成当前步骤的工作，设置状态为已完成
+        VFT_SMF::SimManage::PerfCounterProfiler::endStep();
         shared_data_space->updateThreadState(thread_id, VFT_SMF::GlobalSharedDataStruct::ThreadSyncState::COMPLETED);
         // 等待时钟重置，避免同一步再次进入
         auto post_sync = shared_data_space->getCurrentSyncSignal();
@@ -983,7 +1063,7 @@ pilot_thread_exit:
     
     // 注销线程
     shared_data_space->unregisterThread(thread_id);
-    logBrief(LogLevel::Brief, "飞行员线程结束");
+    VFT_LOG_BRIEF("飞行员线程结束");
 }
 
 
@@ -991,7 +1071,7 @@ pilot_thread_exit:
 
 void atc_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDataSpace> shared_data_space) {
     
-    logBrief(LogLevel::Brief, "ATC线程启动");
+    VFT_LOG_BRIEF("ATC线程启动");
     
     // ATC线程自己实现注册到时钟的功能
     const std::string thread_id = "ATC_THREAD_001";
@@ -999,20 +1079,20 @@ void atc_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDat
     const std::string thread_type = "ATC";
     
     if (!shared_data_space->registerThread(thread_id, thread_name, thread_type)) {
-        logBrief(LogLevel::Brief, "ATC线程注册失败");
+        VFT_LOG_BRIEF("ATC线程注册失败");
         return;
     }
     
-    logBrief(LogLevel::Brief, "ATC线程注册成功");
+    VFT_LOG_BRIEF("ATC线程注册成功");
 
     // 从飞行计划数据中获取配置的ATC_ID
     auto flight_plan_data = shared_data_space->getFlightPlanData();
     std::string atc_id = flight_plan_data.scenario_config.ATC_ID;
     if (atc_id.empty()) {
         atc_id = "ATC_001"; // 默认值
-        logBrief(LogLevel::Brief, "警告: 未找到配置的ATC_ID，使用默认值: " + atc_id);
+        VFT_LOG_BRIEF("警告: 未找到配置的ATC_ID，使用默认值: {}", atc_id);
     } else {
-        logBrief(LogLevel::Brief, "使用配置的ATC_ID: " + atc_id);
+        VFT_LOG_BRIEF("使用配置的ATC_ID: {}", atc_id);
     }
     
     // 创建并初始化ATC代理
@@ -1026,7 +1106,7 @@ void atc_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDat
     
     // 根据配置的ATC_ID初始化对应的策略
     atc_agent.initializeATCStrategy(atc_id);
-    logBrief(LogLevel::Brief, "ATC代理已初始化策略: " + atc_id);
+    VFT_LOG_BRIEF("ATC代理已初始化策略: {}", atc_id);
     
     atc_agent.initialize();
     atc_agent.start();
@@ -1034,14 +1114,14 @@ void atc_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDat
     // ATC代理初始化后立即运行一次更新，计算出基于初始状态的动态数据并覆盖共享数据空间
     atc_agent.update(0.0); // 运行一次初始更新
     
-    logBrief(LogLevel::Brief, "ATC代理初始状态计算完成并已更新到共享数据空间");
+    VFT_LOG_BRIEF("ATC代理初始状态计算完成并已更新到共享数据空间");
     
     // 设置线程就绪状态
     atc_thread_ready = true;
-    logBrief(LogLevel::Brief, "ATC代理已创建并启动");
+    VFT_LOG_BRIEF("ATC代理已创建并启动");
     
     // ATC线程主循环 - 订阅时钟通知
-    logBrief(LogLevel::Brief, "ATC线程进入主循环");
+    VFT_LOG_BRIEF("ATC线程进入主循环");
     static uint64_t atc_last_step = std::numeric_limits<uint64_t>::max(); //确保每个仿真步的事件只被ATC线程处理一次,避免在同一时间步内多次更新ATC指令状态;使用最大值作为初始值，确保第一次调用时能正常处理,因为任何实际的仿真步号都会小于这个最大值
     while (!shared_data_space->isSimulationOver()) {
         // 设置状态为等待时钟信号
@@ -1051,7 +1131,7 @@ void atc_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDat
         auto sync_signal = shared_data_space->getCurrentSyncSignal();
         while (!(sync_signal.step_ready && sync_signal.current_step != atc_last_step)) {
             if (shared_data_space->isSimulationOver()) {
-                logBrief(LogLevel::Brief, "ATC线程检测到仿真结束标志，退出等待");
+                VFT_LOG_BRIEF("ATC线程检测到仿真结束标志，退出等待");
                 goto atc_thread_exit;
             }
             std::this_thread::sleep_for(std::chrono::microseconds(150));
@@ -1064,17 +1144,21 @@ void atc_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDat
         // 获取当前步与时间
         const uint64_t step = sync_signal.current_step;
         atc_last_step = step;
+        VFT_SMF::SimManage::RandomService::setCurrentStep(step);
+        VFT_SMF::SimManage::StepArena::beginStep(step);
+        VFT_SMF::SimManage::AllocationTracker::beginStep(step);
+        VFT_SMF::SimManage::PerfCounterProfiler::beginStep(step);
         const double current_time = static_cast<double>(step) * 0.01;
             
         // 检查是否有需要处理的ATC相关事件
-        // 使用仿真时间获取事件（时间为键），避免类型不匹配导致查不到
-        auto triggered_events = shared_data_space->getTriggeredEventLibrary().getEventsAtStep(current_time);
+        // 使用仿真时间获取事件（时间为键），避免类型不匹配导致查不到；列表分配在步内存区
+        auto triggered_events = shared_data_space->getTriggeredEventLibrary().getEventsAtStep(current_time, VFT_SMF::SimManage::StepArena::resource());
         
         // 减少日志输出频率，只在有事件或每100步输出一次
         static int atc_event_log_counter = 0;
         atc_event_log_counter++;
         if (!triggered_events.empty() || atc_event_log_counter % 100 == 0) {
-            logBrief(LogLevel::Brief, "ATC线程检查时间 " + std::to_string(current_time) + "s 的事件，找到 " + std::to_string(triggered_events.size()) + " 个事件");
+            VFT_LOG_BRIEF("ATC线程检查时间 {}s 的事件，找到 {} 个事件", current_time, triggered_events.size());
         }
         
         // 处理当前步的事件
@@ -1082,8 +1166,7 @@ void atc_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDat
             if (event.is_triggered) {
                 // 检查是否是ATC指令类型的事件
                 if (event.driven_process.controller_type == "ATC_command") {
-                    logBrief(LogLevel::Brief, "ATC线程处理事件: " + event.event_name + 
-                            " (控制器: " + event.driven_process.controller_name + ") - 时间: " + std::to_string(current_time) + "s");
+                    VFT_LOG_BRIEF("ATC线程处理事件: {} (控制器: {}) - 时间: {}s", event.event_name, event.driven_process.controller_name, current_time);
                     
                     // 使用ATC代理的控制器接口处理事件
                     atc_agent.executeController(event.driven_process.controller_name, 
@@ -1099,10 +1182,11 @@ void atc_thread_function(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDat
         static int atc_log_counter = 0;
         atc_log_counter++;
         if (atc_log_counter % 100 == 0) {
-            logBrief(LogLevel::Brief, "ATC线程更新 - 仿真时间: " + std::to_string(current_time) + "s, 步骤: " + std::to_string(step));
+            VFT_LOG_BRIEF("ATC线程更新 - 仿真时间: {}s, 步骤: {}", current_time, step);
         }
         
         // 完成当前步骤的工作，设置状态为已完成
+        VFT_SMF::SimManage::PerfCounterProfiler::endStep();
         shared_data_space->updateThreadState(thread_id, VFT_SMF::GlobalSharedDataStruct::ThreadSyncState::COMPLETED);
         // 等待时钟重置，避免同一步再次进入
         auto post_sync = shared_data_space->getCurrentSyncSignal();
@@ -1121,7 +1205,7 @@ atc_thread_exit:
     
     // 注销线程
     shared_data_space->unregisterThread(thread_id);
-    logBrief(LogLevel::Brief, "ATC线程结束");
+    VFT_LOG_BRIEF("ATC线程结束");
 }
 
 } // namespace VFT_SMF
@@ -53,6 +53,14 @@ void wait_for_event_monitor_thread_ready();
 void wait_for_event_dispatcher_thread_ready();
 void wait_for_pilot_thread_ready();
 void wait_for_atc_thread_ready();
+/**
+ * @brief 等待独立进程中的代理附加到状态传输层并发布首个状态
+ * @param participant_name 参与端名称（如 "environment"）
+ * @param timeout 等待上限
+ * @return 超时或未附加传输层时返回 false，调用方应改在本进程内运行该代理
+ */
+bool wait_for_remote_agent_ready(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDataSpace> shared_data_space,
+                                 const std::string& participant_name, std::chrono::milliseconds timeout);
 
 // ==================== 线程函数声明 ====================
 
@@ -10,7 +10,7 @@ namespace VFT_SMF {
 
     EventDispatcher::EventDispatcher(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDataSpace> data_space)
         : shared_data_space(data_space) {
-        logBrief(LogLevel::Brief, "EventDispatcher 创建完成");
+        VFT_LOG_BRIEF("EventDispatcher 创建完成");
         
         // 初始化控制器到代理的映射关系
         initializeControllerMapping();
@@ -21,13 +21,12 @@ namespace VFT_SMF {
         int processed_count = 0;
         while (shared_data_space->dequeueEvent(queue_item)) {
             const auto& event = queue_item.event;
-            logBrief(LogLevel::Brief, "EventDispatcher: 从队列取出事件 " + event.event_name +
-                    " (ID: " + event.getEventIdString() + ") 于 " + std::to_string(queue_item.trigger_time) + "s");
+            VFT_LOG_BRIEF("EventDispatcher: 从队列取出事件 {} (ID: {}) 于 {}s", event.event_name, event.getEventIdString(), queue_item.trigger_time);
             executeEventController(event, current_time);
             processed_count++;
         }
         if (processed_count > 0) {
-            logBrief(LogLevel::Brief, "EventDispatcher: 本步处理事件数量: " + std::to_string(processed_count));
+            VFT_LOG_BRIEF("EventDispatcher: 本步处理事件数量: {}", processed_count);
         }
     }
 
@@ -48,15 +47,13 @@ namespace VFT_SMF {
         const std::string& controller_type = driven_process.controller_type;
         const std::string& controller_name = driven_process.controller_name;
         
-        logBrief(LogLevel::Brief, "EventDispatcher: 分发事件 " + event.event_name + 
-                " (控制器: " + controller_type + "::" + controller_name + ")");
+        VFT_LOG_BRIEF("EventDispatcher: 分发事件 {} (控制器: {}::{})", event.event_name, controller_type, controller_name);
         
         std::string agent_id = getAgentIdForController(controller_type);
         if (!agent_id.empty()) {
             routeEventToAgent(agent_id, event, current_time);
         } else {
-            logBrief(LogLevel::Brief, "EventDispatcher: 未知的控制器类型: " + controller_type + 
-                    "，无法分发事件");
+            VFT_LOG_BRIEF("EventDispatcher: 未知的控制器类型: {}，无法分发事件", controller_type);
         }
     }
 
@@ -71,8 +68,7 @@ namespace VFT_SMF {
         shared_data_space->enqueueAgentEvent(agent_id, event, current_time, 
                                            controller_type, controller_name);
         
-        logBrief(LogLevel::Brief, "EventDispatcher: 事件已路由到代理 " + agent_id + 
-                " (事件: " + event.event_name + ", 控制器: " + controller_type + "::" + controller_name + ")");
+        VFT_LOG_BRIEF("EventDispatcher: 事件已路由到代理 {} (事件: {}, 控制器: {}::{})", agent_id, event.event_name, controller_type, controller_name);
     }
 
     void EventDispatcher::initializeControllerMapping() {
@@ -83,25 +79,25 @@ namespace VFT_SMF {
         std::string atc_id = flight_plan_data.scenario_config.ATC_ID;
         if (atc_id.empty()) {
             atc_id = "ATC_001";
-            logBrief(LogLevel::Brief, "EventDispatcher: 未找到配置的ATC_ID，使用默认值: " + atc_id);
+            VFT_LOG_BRIEF("EventDispatcher: 未找到配置的ATC_ID，使用默认值: {}", atc_id);
         } else {
-            logBrief(LogLevel::Brief, "EventDispatcher: 使用配置的ATC_ID: " + atc_id);
+            VFT_LOG_BRIEF("EventDispatcher: 使用配置的ATC_ID: {}", atc_id);
         }
         
         std::string pilot_id = flight_plan_data.scenario_config.Pilot_ID;
         if (pilot_id.empty()) {
             pilot_id = "Pilot_001";
-            logBrief(LogLevel::Brief, "EventDispatcher: 未找到配置的Pilot_ID，使用默认值: " + pilot_id);
+            VFT_LOG_BRIEF("EventDispatcher: 未找到配置的Pilot_ID，使用默认值: {}", pilot_id);
         } else {
-            logBrief(LogLevel::Brief, "EventDispatcher: 使用配置的Pilot_ID: " + pilot_id);
+            VFT_LOG_BRIEF("EventDispatcher: 使用配置的Pilot_ID: {}", pilot_id);
         }
         
         std::string aircraft_id = flight_plan_data.scenario_config.Aircraft_ID;
         if (aircraft_id.empty()) {
             aircraft_id = "Aircraft_001";
-            logBrief(LogLevel::Brief, "EventDispatcher: 未找到配置的Aircraft_ID，使用默认值: " + aircraft_id);
+            VFT_LOG_BRIEF("EventDispatcher: 未找到配置的Aircraft_ID，使用默认值: {}", aircraft_id);
         } else {
-            logBrief(LogLevel::Brief, "EventDispatcher: 使用配置的Aircraft_ID: " + aircraft_id);
+            VFT_LOG_BRIEF("EventDispatcher: 使用配置的Aircraft_ID: {}", aircraft_id);
         }
         
         // 设置控制器到代理的映射关系
@@ -112,10 +108,10 @@ namespace VFT_SMF {
         controller_to_agent_mapping["Aircraft_Sysytem_State_Shift"] = aircraft_id;
         controller_to_agent_mapping["Environment_State_Shift"] = "Environment_001";
         
-        logBrief(LogLevel::Brief, "EventDispatcher: 控制器到代理映射关系初始化完成");
-        logBrief(LogLevel::Brief, "EventDispatcher: ATC_command -> " + atc_id);
-        logBrief(LogLevel::Brief, "EventDispatcher: Pilot_Manual_Control -> " + pilot_id);
-        logBrief(LogLevel::Brief, "EventDispatcher: Aircraft_AutoPilot -> " + aircraft_id);
+        VFT_LOG_BRIEF("EventDispatcher: 控制器到代理映射关系初始化完成");
+        VFT_LOG_BRIEF("EventDispatcher: ATC_command -> {}", atc_id);
+        VFT_LOG_BRIEF("EventDispatcher: Pilot_Manual_Control -> {}", pilot_id);
+        VFT_LOG_BRIEF("EventDispatcher: Aircraft_AutoPilot -> {}", aircraft_id);
     }
 
     std::string EventDispatcher::getAgentIdForController(const std::string& controller_type) {
@@ -16,6 +16,9 @@
 #include <condition_variable>
 #include <mutex>
 #include <queue>
+#include <algorithm>
+#include <vector>
+#include <filesystem>
 
 // 包含VFT_SMF仿真系统头文件
 #include "AgentThreadFunctions.hpp"
@@ -24,14 +27,29 @@
 #include "../../B_AircraftAgentModel/AircraftAgent.hpp"
 #include "../../A_PilotAgentModel/PilotAgent.hpp"
 #include "../../G_SimulationManager/LogAndData/DataRecorder.hpp"
+#include "../../G_SimulationManager/LogAndData/TelemetryPublisher.hpp"
+#include "../../G_SimulationManager/LogAndData/MonteCarloAggregator.hpp"
+#include "../../G_SimulationManager/B_SimManage/RandomService.hpp"
+#include "../../G_SimulationManager/B_SimManage/DataPack.hpp"
+#include "../../G_SimulationManager/B_SimManage/AllocationTracker.hpp"
+#include "../../G_SimulationManager/B_SimManage/ThreadPlacement.hpp"
+#include "../../G_SimulationManager/B_SimManage/PerfCounterProfiler.hpp"
+#include "../../G_SimulationManager/B_SimManage/InstrumentedMutex.hpp"
+#include "../../G_SimulationManager/B_SimManage/MetricsServer.hpp"
+#include "../../G_SimulationManager/B_SimManage/SimulationMetrics.hpp"
+#include "../../E_GlobalSharedDataSpace/StateTransport.hpp"
+#include "../../E_FlightDynamics/FlightDynamicsAgent.hpp"
+#include "../../G_SimulationManager/B_SimManage/TerminationMonitor.hpp"
 #include "../../G_SimulationManager/A_TimeSYNC/Simulation_Clock.hpp"
 #include "../../G_SimulationManager/C_ConfigManager/ConfigManager.hpp"
 #include "../../G_SimulationManager/B_SimManage/Sim_Performance.hpp"
 
 int main() {
     // 设置控制台代码页为UTF-8，用于支持中文显示
+#ifdef _WIN32
     SetConsoleOutputCP(CP_UTF8);
     SetConsoleCP(CP_UTF8);
+#endif
     
     // 创建仿真性能统计组件，开始监控仿真性能
     VFT_SMF::SimManage::SimPerformance performance_stats;
@@ -53,7 +71,11 @@ int main() {
         const auto& simulation_config = config_manager.getSimulationConfig();
         const auto& log_config = config_manager.getLogConfig();
         const auto& data_recorder_config = config_manager.getDataRecorderConfig();
+        const auto& telemetry_config = config_manager.getTelemetryConfig();
+        const auto& monte_carlo_config = config_manager.getMonteCarloConfig();
         const auto& simulation_params = config_manager.getSimulationParams();
+        const auto& thread_placement_config = config_manager.getThreadPlacementConfig();
+        const auto& agent_transport_config = config_manager.getAgentTransportConfig();
         
         std::cout << "\n主函数步骤1: 仿真配置加载完成" << std::endl;
         
@@ -86,12 +108,62 @@ int main() {
             return -1;
         }
         else  std::cout << "\n主函数步骤4.1: 计划控制器库初始化完成" << std::endl;
+
+        // 可选：场景提前终止条件（flight_plan.termination_conditions）
+        VFT_SMF::SimManage::TerminationMonitor termination_monitor;
+        if (termination_monitor.loadFromFlightPlan(flight_plan_file) > 0) {
+            std::cout << "\n主函数步骤4.2: 已加载终止条件 " << termination_monitor.getPredicateCount() << " 条" << std::endl;
+        }
         
         // ==================== 步骤5: 创建数据记录器，用于记录仿真数据 ====================
         std::cout << "调试: 数据记录器配置 - output_directory: " << data_recorder_config.output_directory << ", buffer_size: " << std::to_string(data_recorder_config.buffer_size) << std::endl;
-        VFT_SMF::initializeGlobalDataRecorder(data_recorder_config.output_directory, data_recorder_config.buffer_size);
+        VFT_SMF::initializeGlobalDataRecorder(data_recorder_config.output_directory, data_recorder_config.buffer_size,
+                                              VFT_SMF::parseRecordFormat(data_recorder_config.record_format));
+        if (!data_recorder_config.csv_precision.empty()) {
+            VFT_SMF::CsvExport::ColumnPrecision csv_precision;
+            std::string precision_error;
+            if (VFT_SMF::CsvExport::ColumnPrecision::parse(data_recorder_config.csv_precision, csv_precision, precision_error)) {
+                VFT_SMF::globalDataRecorder->setCsvPrecision(csv_precision);
+            } else {
+                std::cout << "警告: csv_precision 配置无效（" << precision_error << "），CSV数值列使用默认2位小数（经纬度8位）" << std::endl;
+            }
+        }
         std::cout << "\n主函数步骤5: 数据记录器初始化完成" << std::endl;
 
+        // 可选：实时遥测（共享内存环，供外部监视工具附加）
+        if (telemetry_config.enable_telemetry) {
+            if (VFT_SMF::Telemetry::initializeGlobalTelemetry(telemetry_config.shm_name, telemetry_config.channels,
+                                                              static_cast<uint32_t>(telemetry_config.ring_capacity))) {
+                std::cout << "\n主函数步骤5.1: 实时遥测已启用，共享内存: " << telemetry_config.shm_name << std::endl;
+            } else {
+                std::cout << "\n主函数步骤5.1: 实时遥测初始化失败，已禁用" << std::endl;
+            }
+        }
+
+        // 可选：蒙特卡洛汇总（本次运行单独累计，结束时持锁并入状态文件，并行运行的进程可共用同一状态文件）
+        if (monte_carlo_config.enable_aggregation) {
+            auto aggregator = std::make_unique<VFT_SMF::MonteCarlo::MonteCarloAggregator>();
+            if (aggregator->initialize(monte_carlo_config.channels, monte_carlo_config.sample_interval)) {
+                // 状态文件存在却载入失败（通道/采样间隔不符或文件损坏）时中止，避免跑完整次运行后才发现无法并入
+                VFT_SMF::MonteCarlo::MonteCarloAggregator stored;
+                stored.initialize(monte_carlo_config.channels, monte_carlo_config.sample_interval);
+                if (std::filesystem::exists(monte_carlo_config.state_file) && !stored.loadState(monte_carlo_config.state_file)) {
+                    std::cout << "\n主函数步骤5.2: 蒙特卡洛状态文件无法载入（与当前配置不一致或已损坏），为保护已累计结果中止本次运行: "
+                              << monte_carlo_config.state_file << std::endl;
+                    return -1;
+                }
+                // 自动编号取启动时已累计的运行次数；并行运行的进程应在配置中显式给出各自的 run_id
+                const uint32_t run_id = monte_carlo_config.run_id >= 0
+                    ? static_cast<uint32_t>(monte_carlo_config.run_id)
+                    : static_cast<uint32_t>(stored.getCompletedRuns());
+                aggregator->beginRun(run_id);
+                VFT_SMF::MonteCarlo::globalMonteCarloAggregator = std::move(aggregator);
+                std::cout << "\n主函数步骤5.2: 蒙特卡洛汇总已启用，运行ID: " << run_id << std::endl;
+            } else {
+                std::cout << "\n主函数步骤5.2: 蒙特卡洛汇总未配置有效通道，已禁用" << std::endl;
+            }
+        }
+
         // ==================== 步骤6: 创建时钟系统，用于同步各线程 ====================    
         // 从配置文件创建仿真配置
         VFT_SMF::SimulationConfig config;
@@ -109,12 +181,115 @@ int main() {
         auto simulation_clock = std::make_unique<VFT_SMF::SimulationClock>(config);
         
         std::cout << "\n主函数步骤6: Simulation_Clock创建完成" << std::endl;
+
+        // 随机流在代理构造时绑定运行种子，必须先于步骤7设置
+        VFT_SMF::SimManage::RandomService::setRunSeed(static_cast<uint64_t>(simulation_params.random_seed));
+        std::cout << "\n主函数步骤6.1: 随机数服务运行种子: " << simulation_params.random_seed << std::endl;
+        
+        // 飞行动力学代理的水平位置积分方式同样在代理构造前设置
+        VFT_SMF::FlightDynamics::PositionIntegration position_integration = VFT_SMF::FlightDynamics::PositionIntegration::LocalTangent;
+        if (!VFT_SMF::FlightDynamics::FlightDynamicsAgent::parsePositionIntegration(simulation_params.position_integration, position_integration)) {
+            std::cout << "未知的位置积分方式: " << simulation_params.position_integration << "，使用 local_ned" << std::endl;
+        }
+        VFT_SMF::FlightDynamics::FlightDynamicsAgent::setDefaultPositionIntegration(position_integration, simulation_params.frame_reanchor_distance);
+        
+        // 环境代理加载静态数据时使用的数据包缓存目录
+        if (!simulation_params.data_pack_directory.empty()) {
+            VFT_SMF::SimManage::DataPack::setCacheDirectory(simulation_params.data_pack_directory);
+        }
+        std::cout << "\n主函数步骤6.2: 数据包缓存目录: " << VFT_SMF::SimManage::DataPack::getCacheDirectory() << std::endl;
+        
+        // 堆分配统计须在代理线程注册前开启
+        VFT_SMF::SimManage::AllocationTrackingMode allocation_mode = VFT_SMF::SimManage::AllocationTrackingMode::Off;
+        if (!VFT_SMF::SimManage::AllocationTracker::parseMode(simulation_params.allocation_tracking, allocation_mode)) {
+            std::cout << "未知的堆分配统计模式: " << simulation_params.allocation_tracking << "，使用 off" << std::endl;
+        }
+        VFT_SMF::SimManage::AllocationTracker::setMode(allocation_mode);
+        
+        // 性能计数器同样在代理线程注册时打开
+        VFT_SMF::SimManage::PerfCounterMode perf_counter_mode = VFT_SMF::SimManage::PerfCounterMode::Off;
+        if (!VFT_SMF::SimManage::PerfCounterProfiler::parseMode(simulation_params.perf_counters, perf_counter_mode)) {
+            std::cout << "未知的性能计数器统计模式: " << simulation_params.perf_counters << "，使用 off" << std::endl;
+        }
+        VFT_SMF::SimManage::PerfCounterProfiler::setMode(perf_counter_mode);
+        if (simulation_params.time_step > 0.0) {
+            VFT_SMF::SimManage::PerfCounterProfiler::reserveSteps(
+                static_cast<uint64_t>(simulation_params.max_simulation_time / simulation_params.time_step) + 1);
+        }
+        
+        // 锁统计（编译期开关 VFT_ENABLE_LOCK_STATS）：主线程的加锁计入 Main_Thread
+        if (VFT_SMF::SimManage::LockStats::compiledIn()) {
+            VFT_SMF::SimManage::LockStats::tagCurrentThread("Main_Thread");
+        }
+        
+        // 线程放置同样须在代理线程注册前配置（代理线程注册时应用自身的放置）
+        if (thread_placement_config.enable_thread_placement) {
+            std::map<std::string, VFT_SMF::SimManage::ThreadPlacementSpec> placement_specs;
+            for (const auto& entry : thread_placement_config.thread_specs) {
+                std::string error;
+                if (!VFT_SMF::SimManage::ThreadPlacement::parseSpec(entry.second, placement_specs[entry.first], error)) {
+                    std::cout << "线程 " << entry.first << " 的放置描述无效（" << error << "），不设置" << std::endl;
+                    placement_specs.erase(entry.first);
+                }
+            }
+            VFT_SMF::SimManage::ThreadPlacement::configure(placement_specs);
+            std::cout << "\n主函数步骤6.3: 线程放置已配置，线程数: " << placement_specs.size() << std::endl;
+        }
+        
+        // 可选：本机指标端点（单个后台线程，在代理线程之前创建，不继承代理线程的放置）
+        VFT_SMF::SimManage::MetricsServer metrics_server;
+        if (telemetry_config.enable_metrics_endpoint) {
+            const VFT_SMF::SimulationClock* clock_ptr = simulation_clock.get();
+            const VFT_SMF::GlobalShared_DataSpace::GlobalSharedDataSpace* space_ptr = shared_data_space_ptr.get();
+            std::string error;
+            if (metrics_server.start(static_cast<uint16_t>(telemetry_config.metrics_port), [clock_ptr, space_ptr]() {
+                    return VFT_SMF::SimManage::SimulationMetrics::render(clock_ptr, space_ptr,
+                                                                        VFT_SMF::globalDataRecorder.get(),
+                                                                        VFT_SMF::globalLogger.get());
+                }, error)) {
+                std::cout << "\n主函数步骤6.4: 指标端点已启动: http://127.0.0.1:" << metrics_server.getPort() << "/metrics" << std::endl;
+            } else {
+                std::cout << "\n主函数步骤6.4: 指标端点启动失败（" << error << "），已禁用" << std::endl;
+            }
+        }
+        
+        // 可选：共享内存状态传输，远程代理（remote_agent 工具）以独立进程附加
+        std::vector<std::string> remote_agents;
+        if (agent_transport_config.transport == "shared_memory") {
+            auto transport = std::make_shared<VFT_SMF::GlobalShared_DataSpace::SharedMemoryTransport>();
+            if (transport->create(agent_transport_config.segment_name)) {
+                shared_data_space_ptr->attachStateTransport(transport, std::chrono::milliseconds(agent_transport_config.step_timeout_ms));
+                std::stringstream agent_list(agent_transport_config.remote_agents);
+                std::string agent_name;
+                while (std::getline(agent_list, agent_name, ',')) {
+                    agent_name.erase(0, agent_name.find_first_not_of(" \t"));
+                    agent_name.erase(agent_name.find_last_not_of(" \t") + 1);
+                    if (!agent_name.empty()) remote_agents.push_back(agent_name);
+                }
+                std::cout << "\n主函数步骤6.5: 共享内存状态传输已创建: " << agent_transport_config.segment_name
+                          << "，远程代理数: " << remote_agents.size() << std::endl;
+            } else {
+                std::cout << "\n主函数步骤6.5: 共享内存状态传输创建失败，所有代理在本进程内运行" << std::endl;
+            }
+        } else if (agent_transport_config.transport != "in_process") {
+            std::cout << "未知的代理状态传输方式: " << agent_transport_config.transport << "，使用 in_process" << std::endl;
+        }
+        const auto is_remote_agent = [&remote_agents](const std::string& agent_name) {
+            return std::find(remote_agents.begin(), remote_agents.end(), agent_name) != remote_agents.end();
+        };
         
         // ==================== 步骤7: 按依赖关系逐个创建代理并等待就绪 ====================
-        // 第一层：环境代理（无依赖）
-        std::thread environment_thread        (VFT_SMF::environment_thread_function,        shared_data_space_ptr);    // 代理模型：环（环境），未来可以升级为分布式仿真系统中的环境系统
-        VFT_SMF::wait_for_environment_thread_ready();
-        std::cout << "\n主函数步骤7.1: 环境代理初始化完成" << std::endl;
+        // 第一层：环境代理（无依赖）；配置为远程代理且按时附加时由独立进程运行
+        std::thread environment_thread;
+        if (is_remote_agent("environment") &&
+            VFT_SMF::wait_for_remote_agent_ready(shared_data_space_ptr, "environment",
+                                                 std::chrono::milliseconds(agent_transport_config.attach_timeout_ms))) {
+            std::cout << "\n主函数步骤7.1: 环境代理以独立进程运行" << std::endl;
+        } else {
+            environment_thread = std::thread(VFT_SMF::environment_thread_function, shared_data_space_ptr);    // 代理模型：环（环境），未来可以升级为分布式仿真系统中的环境系统
+            VFT_SMF::wait_for_environment_thread_ready();
+            std::cout << "\n主函数步骤7.1: 环境代理初始化完成" << std::endl;
+        }
         
         // 第二层：飞机系统代理（依赖环境）
         std::thread aircraft_system_thread    (VFT_SMF::aircraft_system_thread_function,    shared_data_space_ptr);    // 代理模型：机（飞机系统），未来可以升级为分布式仿真系统中的飞机系统
@@ -146,6 +321,11 @@ int main() {
         std::cout << "\n主函数步骤7.7: 事件分发单元初始化完成" << std::endl;
         
         std::cout << "\n主函数步骤7: 所有代理线程创建并初始化完成" << std::endl;
+        
+        // 主线程（仿真时钟）在代理线程全部启动后再放置，代理线程不继承其 CPU 集与调度策略
+        if (VFT_SMF::SimManage::ThreadPlacement::applyToCurrentThread("Main_Thread")) {
+            std::cout << "\n主函数步骤7.8: 主线程放置已应用" << std::endl;
+        }
                
         // ==================== 步骤8: 所有代理已就绪，准备开始仿真 ====================
 
@@ -163,13 +343,15 @@ int main() {
         std::cout << "\n主函数步骤10: 仿真时钟已启动，开始仿真" << std::endl;
         
         // ==================== 步骤11: 运行仿真主循环 ====================
+        // 控制器执行状态跨步复用：控制器集合不变，每步只就地改写运行标志，不重建映射
+        VFT_SMF::GlobalSharedDataStruct::ControllerExecutionStatus controller_status;
+        controller_status.datasource = "main_thread";
+        
         while (simulation_clock->get_current_simulation_time() < simulation_params.max_simulation_time - 0.001) {
             // 推进仿真（用时钟推进，带各工作线程的同步）
             simulation_clock->update(simulation_params.time_step, shared_data_space_ptr);
             
             // 更新控制器执行状态
-            VFT_SMF::GlobalSharedDataStruct::ControllerExecutionStatus controller_status;
-            controller_status.datasource = "main_thread";
             controller_status.timestamp = VFT_SMF::SimulationTimePoint{};
             
             // 获取计划控制器列表
@@ -181,18 +363,10 @@ int main() {
             const auto& triggered_events = shared_data_space_ptr->getTriggeredEventLibrary();
             
             for (const auto& controller : controllers) {
-                bool is_running = false;
-                
                 // 检查控制器是否应该运行
                 // 这里可以根据实际需求实现更复杂的逻辑
                 // 目前简单实现：如果控制器对应的事件已触发，则标记为运行中
-                auto events = triggered_events.getTriggeredEvents();
-                for (const auto& event : events) {
-                    if (event.event_name == controller.event_name) {
-                        is_running = true;
-                        break;
-                    }
-                }
+                const bool is_running = triggered_events.isEventTriggered(controller.event_name);
                 
                 controller_status.setControllerStatus(controller.controller_name, is_running);
             }
@@ -204,19 +378,30 @@ int main() {
             const uint64_t step = simulation_clock->get_current_step();
             const double record_time = static_cast<double>(step) * config.time_step;
             shared_data_space_ptr->publishToDataRecorder(record_time);
+
+            // 终止条件成立：结果已确定，跳出主循环走正常的停钟与记录流程
+            if (termination_monitor.evaluate(record_time, *shared_data_space_ptr)) {
+                break;
+            }
             
             // 降低CPU占用，避免仿真时钟过快
             std::cout << "虚拟试飞正在运行，仿真时间: " << simulation_clock->get_current_simulation_time() << "s" << std::endl;
             std::this_thread::sleep_for(std::chrono::microseconds(100));
         }
         std::cout << "\n主函数步骤11: 仿真主循环结束" << std::endl;
+        const double end_time = simulation_clock->get_current_simulation_time();
+        if (termination_monitor.getResult().terminated) {
+            const auto& termination = termination_monitor.getResult();
+            std::cout << "\n主函数步骤11.1: 终止条件成立，提前结束仿真: " << termination.name
+                      << " (" << termination.expression << ")，仿真时间: " << termination.time << "s" << std::endl;
+        }
         
         // ==================== 步骤12: 停止仿真时钟并等待各线程结束 ====================      
         simulation_clock->stop(shared_data_space_ptr); // 停止仿真时钟并同步运行状态到共享数据空间
         std::cout << "\n主函数步骤12: 仿真时钟已停止，等待各线程结束" << std::endl;
 
         // 等待所有线程结束
-        environment_thread.join();
+        if (environment_thread.joinable()) environment_thread.join();
         flight_dynamics_thread.join();
         aircraft_system_thread.join();
         event_monitor_thread.join();
@@ -225,8 +410,46 @@ int main() {
         atc_thread.join();
         
         // ==================== 步骤13: 数据记录器输出数据 ====================
-        VFT_SMF::globalDataRecorder->flushAllBuffers();
-        std::cout << "\n主函数步骤13: 仿真数据记录完成" << std::endl;
+        if (monte_carlo_config.enable_aggregation && !monte_carlo_config.keep_run_outputs) {
+            VFT_SMF::globalDataRecorder->clearAllBuffers();
+            std::cout << "\n主函数步骤13: 蒙特卡洛模式，未输出单次运行记录" << std::endl;
+        } else {
+            VFT_SMF::globalDataRecorder->flushAllBuffers();
+            std::cout << "\n主函数步骤13: 仿真数据记录完成" << std::endl;
+        }
+        termination_monitor.writeReport(data_recorder_config.output_directory + "/simulation_termination.txt",
+                                        end_time, simulation_params.max_simulation_time);
+        if (allocation_mode != VFT_SMF::SimManage::AllocationTrackingMode::Off) {
+            VFT_SMF::SimManage::AllocationTracker::writeReport(data_recorder_config.output_directory + "/allocation_summary.txt",
+                                                              data_recorder_config.output_directory + "/allocation_steps.csv");
+            std::cout << "\n主函数步骤13.2: 堆分配统计\n" << VFT_SMF::SimManage::AllocationTracker::formatSummary() << std::endl;
+        }
+        if (thread_placement_config.enable_thread_placement) {
+            VFT_SMF::SimManage::ThreadPlacement::writeReport(data_recorder_config.output_directory + "/thread_placement.txt");
+            std::cout << "\n主函数步骤13.3: 线程实际放置\n" << VFT_SMF::SimManage::ThreadPlacement::formatReport() << std::endl;
+        }
+        if (perf_counter_mode != VFT_SMF::SimManage::PerfCounterMode::Off) {
+            VFT_SMF::SimManage::PerfCounterProfiler::writeReport(data_recorder_config.output_directory + "/perf_counters_summary.txt",
+                                                                data_recorder_config.output_directory + "/perf_counters_steps.csv");
+            std::cout << "\n主函数步骤13.4: 性能计数器统计\n" << VFT_SMF::SimManage::PerfCounterProfiler::formatSummary() << std::endl;
+        }
+        if (VFT_SMF::SimManage::LockStats::compiledIn()) {
+            VFT_SMF::SimManage::LockStats::writeReport(data_recorder_config.output_directory + "/lock_stats.txt",
+                                                      data_recorder_config.output_directory + "/lock_histograms.csv");
+            std::cout << "\n主函数步骤13.5: 锁竞争统计\n" << VFT_SMF::SimManage::LockStats::formatSummary() << std::endl;
+        }
+        if (VFT_SMF::MonteCarlo::globalMonteCarloAggregator) {
+            auto& aggregator = *VFT_SMF::MonteCarlo::globalMonteCarloAggregator;
+            aggregator.recordKpi("end_time", end_time);
+            aggregator.endRun();
+            if (aggregator.mergeIntoState(monte_carlo_config.state_file, monte_carlo_config.summary_directory)) {
+                std::cout << "\n主函数步骤13.1: 蒙特卡洛汇总已更新，累计运行次数: " << aggregator.getCompletedRuns() << std::endl;
+            } else {
+                std::cout << "\n主函数步骤13.1: 蒙特卡洛状态文件并入失败，本次运行未计入: " << monte_carlo_config.state_file << std::endl;
+            }
+        }
+        metrics_server.stop();
+        
         // ==================== 步骤14: 性能统计和总结 ====================
         // 结束性能统计并输出结果
         performance_stats.finish();
@@ -0,0 +1,199 @@
+/**
+ * @file CsvExport.cpp
+ * @brief 定宽文本CSV的快速写出实现
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include "CsvExport.hpp"
+
+#include <charconv>
+#include <exception>
+#include <thread>
+
+namespace VFT_SMF {
+namespace CsvExport {
+
+    namespace {
+        constexpr size_t NUMBER_BUFFER_SIZE = 400;   ///< 定点格式下 1e308 量级的数值也放得下
+
+        std::string trim(const std::string& text) {
+            const size_t first = text.find_first_not_of(" \t");
+            if (first == std::string::npos) return std::string();
+            const size_t last = text.find_last_not_of(" \t");
+            return text.substr(first, last - first + 1);
+        }
+
+        bool parseDigits(const std::string& value, int& digits) {
+            if (value == "shortest") {
+                digits = SHORTEST;
+                return true;
+            }
+            int parsed = 0;
+            const auto result = std::from_chars(value.data(), value.data() + value.size(), parsed);
+            if (result.ec != std::errc() || result.ptr != value.data() + value.size()) return false;
+            if (parsed < 0 || parsed > MAX_PRECISION) return false;
+            digits = parsed;
+            return true;
+        }
+
+        size_t formatInto(char* buffer, double value, int digits) {
+            const auto result = digits == SHORTEST
+                ? std::to_chars(buffer, buffer + NUMBER_BUFFER_SIZE, value)
+                : std::to_chars(buffer, buffer + NUMBER_BUFFER_SIZE, value, std::chars_format::fixed, digits);
+            return static_cast<size_t>(result.ptr - buffer);
+        }
+    }
+
+    // ==================== ColumnPrecision ====================
+
+    bool ColumnPrecision::parse(const std::string& text, ColumnPrecision& precision, std::string& error) {
+        ColumnPrecision parsed;
+        size_t start = 0;
+        while (start <= text.size()) {
+            size_t end = text.find(';', start);
+            if (end == std::string::npos) end = text.size();
+            const std::string item = trim(text.substr(start, end - start));
+            start = end + 1;
+            if (item.empty()) continue;
+
+            const size_t equals = item.find('=');
+            if (equals == std::string::npos) {
+                error = "缺少 '=': " + item;
+                return false;
+            }
+            const std::string key = trim(item.substr(0, equals));
+            const std::string value = trim(item.substr(equals + 1));
+            int digits = DEFAULT_PRECISION;
+            if (key.empty() || !parseDigits(value, digits)) {
+                error = "无效的精度项: " + item + "（值应为 0-" + std::to_string(MAX_PRECISION) + " 或 shortest）";
+                return false;
+            }
+            if (key == "default") {
+                parsed.setDefault(digits);
+            } else {
+                parsed.set(key, digits);
+            }
+        }
+        precision = std::move(parsed);
+        return true;
+    }
+
+    int ColumnPrecision::get(const std::string& module, const std::string& column) const {
+        if (overrides.empty()) return default_digits;
+        auto it = overrides.find(module + "." + column);
+        if (it != overrides.end()) return it->second;
+        it = overrides.find(column);
+        if (it != overrides.end()) return it->second;
+        return default_digits;
+    }
+
+    // ==================== CsvFileWriter ====================
+
+    CsvFileWriter::CsvFileWriter(const std::string& path) {
+        // 二进制模式：时间索引的字节偏移与文件内容一一对应（Windows 下不做换行转换）
+        file = std::fopen(path.c_str(), "wb");
+        buffer.reserve(FLUSH_THRESHOLD + 4096);
+    }
+
+    CsvFileWriter::~CsvFileWriter() {
+        close();
+    }
+
+    void CsvFileWriter::field(const char* begin, size_t length, int width) {
+        const size_t field_width = width > 0 ? static_cast<size_t>(width) : 0;
+        if (align_left) {
+            buffer.append(begin, length);
+            if (length < field_width) pad(field_width - length);
+        } else {
+            if (length < field_width) {
+                pad(field_width - length);
+            } else if (field_width > 0 && !buffer.empty() && buffer.back() != ' ' && buffer.back() != '\n') {
+                pad(1);   // 右对齐列没有分隔符，填满时补一个空格
+            }
+            buffer.append(begin, length);
+        }
+    }
+
+    CsvFileWriter& CsvFileWriter::text(std::string_view value, int width) {
+        field(value.data(), value.size(), width);
+        return *this;
+    }
+
+    CsvFileWriter& CsvFileWriter::number(double value, int digits, int width) {
+        char formatted[NUMBER_BUFFER_SIZE];
+        field(formatted, formatInto(formatted, value, digits), width);
+        return *this;
+    }
+
+    CsvFileWriter& CsvFileWriter::integer(int64_t value, int width) {
+        char formatted[24];
+        const auto result = std::to_chars(formatted, formatted + sizeof(formatted), value);
+        field(formatted, static_cast<size_t>(result.ptr - formatted), width);
+        return *this;
+    }
+
+    CsvFileWriter& CsvFileWriter::raw(std::string_view value) {
+        buffer.append(value.data(), value.size());
+        flushIfFull();
+        return *this;
+    }
+
+    CsvFileWriter& CsvFileWriter::raw(char value) {
+        buffer.push_back(value);
+        if (value == '\n') flushIfFull();
+        return *this;
+    }
+
+    void CsvFileWriter::flushBuffer() {
+        if (buffer.empty()) return;
+        if (file && std::fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size()) {
+            write_failed = true;
+        }
+        flushed_bytes += buffer.size();
+        buffer.clear();
+    }
+
+    bool CsvFileWriter::close() {
+        if (!file) return false;
+        flushBuffer();
+        const bool closed = std::fclose(file) == 0;
+        file = nullptr;
+        return closed && !write_failed;
+    }
+
+    // ==================== 辅助函数 ====================
+
+    std::string formatNumber(double value, int digits) {
+        char formatted[NUMBER_BUFFER_SIZE];
+        return std::string(formatted, formatInto(formatted, value, digits));
+    }
+
+    std::vector<std::string> runParallel(const std::vector<std::function<void()>>& tasks) {
+        std::vector<std::string> task_errors(tasks.size());
+        std::vector<std::thread> workers;
+        workers.reserve(tasks.size());
+        for (size_t i = 0; i < tasks.size(); ++i) {
+            workers.emplace_back([&tasks, &task_errors, i]() {
+                try {
+                    tasks[i]();
+                } catch (const std::exception& e) {
+                    task_errors[i] = e.what();
+                } catch (...) {
+                    task_errors[i] = "未知异常";
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        std::vector<std::string> errors;
+        for (auto& error : task_errors) {
+            if (!error.empty()) errors.push_back(std::move(error));
+        }
+        return errors;
+    }
+
+} // namespace CsvExport
+} // namespace VFT_SMF
@@ -0,0 +1,121 @@
+/**
+ * @file CsvExport.hpp
+ * @brief 定宽文本CSV的快速写出
+ * @details 记录器写出CSV时不经过iostream：数值以 std::to_chars 直接格式化进大块缓冲区
+ *          （定点小数或最短往返表示），缓冲区满 1 MiB 才写入文件；各模块文件由独立线程写出。
+ *          列宽与对齐语义与 std::setw 相同（不截断），默认精度下输出与原 iostream 版本逐字节一致；
+ *          区别是右对齐列被填满时补一个空格，避免与前一列粘连，且经纬度列默认 8 位小数（约 1 mm）。
+ *          精度描述（data_recorder_config.csv_precision）示例：
+ *              "default=2;latitude=8;longitude=8;aircraft_net_force.pitch_moment=shortest"
+ *          键为 default、列名或 "模块名.列名"（模块名即不含扩展名的文件名），后者优先；
+ *          值为 0-17 的小数位数，或 shortest（可精确还原 double 的最短表示）。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace VFT_SMF {
+namespace CsvExport {
+
+    constexpr int SHORTEST = -1;                  ///< 最短往返表示
+    constexpr int DEFAULT_PRECISION = 2;          ///< 与原输出一致的默认小数位数
+    constexpr int GEODETIC_PRECISION = 8;         ///< latitude/longitude 列的默认小数位数（约 1 mm）
+    constexpr int MAX_PRECISION = 17;
+    constexpr size_t FLUSH_THRESHOLD = 1 << 20;   ///< 缓冲区写出阈值
+
+    /**
+     * @brief 各列的数值精度
+     */
+    class ColumnPrecision {
+    public:
+        /**
+         * @brief 解析精度描述，各项以 ';' 分隔
+         * @return 格式错误时返回 false 并给出原因，precision 不变
+         */
+        static bool parse(const std::string& text, ColumnPrecision& precision, std::string& error);
+
+        void setDefault(int digits) { default_digits = digits; }
+        /// column 为列名或 "模块名.列名"
+        void set(const std::string& column, int digits) { overrides[column] = digits; }
+
+        /**
+         * @brief 查询精度："模块名.列名" > 列名 > default
+         * @details 写出前每列查询一次，不在逐行路径上
+         */
+        int get(const std::string& module, const std::string& column) const;
+
+    private:
+        int default_digits = DEFAULT_PRECISION;
+        std::unordered_map<std::string, int> overrides {{"latitude", GEODETIC_PRECISION}, {"longitude", GEODETIC_PRECISION}};
+    };
+
+    /**
+     * @brief 定宽文本文件写出器
+     * @details 与 iostream 一样带"当前对齐"状态，left()/right() 对之后的字段生效
+     */
+    class CsvFileWriter {
+    public:
+        explicit CsvFileWriter(const std::string& path);
+        ~CsvFileWriter();
+        CsvFileWriter(const CsvFileWriter&) = delete;
+        CsvFileWriter& operator=(const CsvFileWriter&) = delete;
+
+        bool isOpen() const { return file != nullptr; }
+
+        CsvFileWriter& left() { align_left = true; return *this; }
+        CsvFileWriter& right() { align_left = false; return *this; }
+
+        /// 文本字段，width 为 0 时不填充
+        CsvFileWriter& text(std::string_view value, int width = 0);
+        /// 数值字段，digits 为小数位数或 SHORTEST
+        CsvFileWriter& number(double value, int digits, int width = 0);
+        CsvFileWriter& integer(int64_t value, int width = 0);
+        CsvFileWriter& boolean(bool value, int width = 0) { return text(value ? "true" : "false", width); }
+        /// 原样追加（分隔符、换行）
+        CsvFileWriter& raw(std::string_view value);
+        CsvFileWriter& raw(char value);
+
+        /// 已写出的字节数（含缓冲区中尚未写入文件的部分），供时间索引使用
+        uint64_t offset() const { return flushed_bytes + buffer.size(); }
+
+        /**
+         * @brief 写出剩余缓冲并关闭文件
+         * @return 打开或任一次写入失败时返回 false
+         */
+        bool close();
+
+    private:
+        void pad(size_t count) { buffer.append(count, ' '); }
+        void field(const char* begin, size_t length, int width);
+        void flushIfFull() { if (buffer.size() >= FLUSH_THRESHOLD) flushBuffer(); }
+        void flushBuffer();
+
+        std::FILE* file = nullptr;
+        std::string buffer;
+        uint64_t flushed_bytes = 0;
+        bool align_left = true;
+        bool write_failed = false;
+    };
+
+    /**
+     * @brief 数值格式化为字符串（与 CsvFileWriter::number 相同的格式，不填充）
+     */
+    std::string formatNumber(double value, int digits);
+
+    /**
+     * @brief 并行执行各文件的写出任务
+     * @details 每个任务一个线程；任务抛出的异常在线程内捕获，错误信息汇总返回（为空表示全部成功）
+     */
+    std::vector<std::string> runParallel(const std::vector<std::function<void()>>& tasks);
+
+} // namespace CsvExport
+} // namespace VFT_SMF
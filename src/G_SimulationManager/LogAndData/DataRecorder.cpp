@@ -6,18 +6,21 @@
  */
 
 #include "DataRecorder.hpp"
+#include "TimeSeriesCodec.hpp"
+#include "TimeIndex.hpp"
 #include "../../E_GlobalSharedDataSpace/GlobalSharedDataSpace.hpp"
 #include <iostream>
 #include <fstream>
-#include <sstream>
-#include <iomanip>
 #include <filesystem>
 #include <cmath>
+#include <functional>
+#include <map>
+#include <stdexcept>
 
 namespace VFT_SMF {
 
 DataRecorder::DataRecorder(const std::string& output_dir, int buf_size)
-    : output_directory(output_dir), buffer_size(buf_size), is_initialized(false) {
+    : output_directory(output_dir), buffer_size(buf_size), is_initialized(false), record_format(RecordFormat::CSV) {
 }
 
 DataRecorder::~DataRecorder() {
@@ -51,10 +54,10 @@ bool DataRecorder::initialize() {
         controller_execution_status_buffer.resize(0);
         event_queue_buffer.resize(0);
 
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "数据记录器初始化成功，输出目录: " + output_directory);
+        VFT_LOG_BRIEF("数据记录器初始化成功，输出目录: {}", output_directory);
         return true;
     } catch (const std::exception& e) {
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "数据记录器初始化失败: " + std::string(e.what()));
+        VFT_LOG_BRIEF("数据记录器初始化失败: {}", e.what());
         return false;
     }
 }
@@ -68,141 +71,158 @@ void DataRecorder::setOutputDirectory(const std::string& dir) {
 }
 
 void DataRecorder::recordFlightPlanData(double simulation_time, const VFT_SMF::GlobalSharedDataStruct::FlightPlanData& data) {
-    std::lock_guard<std::mutex> lock(buffer_mutex);
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(buffer_mutex);
     flight_plan_buffer.push_back({simulation_time, data});
+    noteRecord(flight_plan_buffer.size() > static_cast<size_t>(buffer_size));
     if (flight_plan_buffer.size() > buffer_size) {
         flight_plan_buffer.pop_front();
     }
 }
 
 void DataRecorder::recordAircraftFlightState(double simulation_time, const VFT_SMF::GlobalSharedDataStruct::AircraftFlightState& data) {
-    std::lock_guard<std::mutex> lock(buffer_mutex);
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(buffer_mutex);
     aircraft_flight_state_buffer.push_back({simulation_time, data});
+    // 飞行动力学步内只发布切平面位置，经纬度在采样时换算
+    geodetic_resolver.resolve(aircraft_flight_state_buffer.back().second);
+    noteRecord(aircraft_flight_state_buffer.size() > static_cast<size_t>(buffer_size));
     
     // 只有在缓冲区真正满了才删除最旧的记录
     if (aircraft_flight_state_buffer.size() > buffer_size) {
         aircraft_flight_state_buffer.pop_front();
-        if (VFT_SMF::globalLogger) {
-            VFT_SMF::globalLogger->warning("飞行状态缓冲区已满，删除最旧记录，当前大小: " + std::to_string(aircraft_flight_state_buffer.size()));
-        }
+        VFT_LOG_BRIEF("飞行状态缓冲区已满，删除最旧记录，当前大小: {}", aircraft_flight_state_buffer.size());
     }
 }
 
 void DataRecorder::recordAircraftSystemState(double simulation_time, const VFT_SMF::GlobalSharedDataStruct::AircraftSystemState& data) {
-    std::lock_guard<std::mutex> lock(buffer_mutex);
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(buffer_mutex);
     aircraft_system_state_buffer.push_back({simulation_time, data});
+    noteRecord(aircraft_system_state_buffer.size() > static_cast<size_t>(buffer_size));
     if (aircraft_system_state_buffer.size() > buffer_size) {
         aircraft_system_state_buffer.pop_front();
     }
 }
 
 void DataRecorder::recordPilotState(double simulation_time, const VFT_SMF::GlobalSharedDataStruct::PilotGlobalState& data) {
-    std::lock_guard<std::mutex> lock(buffer_mutex);
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(buffer_mutex);
     pilot_state_buffer.push_back({simulation_time, data});
+    noteRecord(pilot_state_buffer.size() > static_cast<size_t>(buffer_size));
     if (pilot_state_buffer.size() > buffer_size) {
         pilot_state_buffer.pop_front();
     }
 }
 
 void DataRecorder::recordEnvironmentState(double simulation_time, const VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalState& data) {
-    std::lock_guard<std::mutex> lock(buffer_mutex);
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(buffer_mutex);
     environment_state_buffer.push_back({simulation_time, data});
+    noteRecord(environment_state_buffer.size() > static_cast<size_t>(buffer_size));
     if (environment_state_buffer.size() > buffer_size) {
         environment_state_buffer.pop_front();
     }
 }
 
 void DataRecorder::recordATCState(double simulation_time, const VFT_SMF::GlobalSharedDataStruct::ATCGlobalState& data) {
-    std::lock_guard<std::mutex> lock(buffer_mutex);
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(buffer_mutex);
     atc_state_buffer.push_back({simulation_time, data});
+    noteRecord(atc_state_buffer.size() > static_cast<size_t>(buffer_size));
     if (atc_state_buffer.size() > buffer_size) {
         atc_state_buffer.pop_front();
     }
 }
 
 void DataRecorder::recordAircraftNetForce(double simulation_time, const VFT_SMF::GlobalSharedDataStruct::AircraftNetForce& data) {
-    std::lock_guard<std::mutex> lock(buffer_mutex);
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(buffer_mutex);
     aircraft_net_force_buffer.push_back({simulation_time, data});
+    noteRecord(aircraft_net_force_buffer.size() > static_cast<size_t>(buffer_size));
     if (aircraft_net_force_buffer.size() > buffer_size) {
         aircraft_net_force_buffer.pop_front();
     }
 }
 
 void DataRecorder::recordAircraftLogic(double simulation_time, const VFT_SMF::GlobalSharedDataStruct::AircraftGlobalLogic& data) {
-    std::lock_guard<std::mutex> lock(buffer_mutex);
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(buffer_mutex);
     aircraft_logic_buffer.push_back({simulation_time, data});
+    noteRecord(aircraft_logic_buffer.size() > static_cast<size_t>(buffer_size));
     if (aircraft_logic_buffer.size() > buffer_size) {
         aircraft_logic_buffer.pop_front();
     }
 }
 
 void DataRecorder::recordPilotLogic(double simulation_time, const VFT_SMF::GlobalSharedDataStruct::PilotGlobalLogic& data) {
-    std::lock_guard<std::mutex> lock(buffer_mutex);
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(buffer_mutex);
     pilot_logic_buffer.push_back({simulation_time, data});
+    noteRecord(pilot_logic_buffer.size() > static_cast<size_t>(buffer_size));
     if (pilot_logic_buffer.size() > buffer_size) {
         pilot_logic_buffer.pop_front();
     }
 }
 
 void DataRecorder::recordEnvironmentLogic(double simulation_time, const VFT_SMF::GlobalSharedDataStruct::EnvironmentGlobalLogic& data) {
-    std::lock_guard<std::mutex> lock(buffer_mutex);
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(buffer_mutex);
     environment_logic_buffer.push_back({simulation_time, data});
+    noteRecord(environment_logic_buffer.size() > static_cast<size_t>(buffer_size));
     if (environment_logic_buffer.size() > buffer_size) {
         environment_logic_buffer.pop_front();
     }
 }
 
 void DataRecorder::recordATCLogic(double simulation_time, const VFT_SMF::GlobalSharedDataStruct::ATCGlobalLogic& data) {
-    std::lock_guard<std::mutex> lock(buffer_mutex);
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(buffer_mutex);
     atc_logic_buffer.push_back({simulation_time, data});
+    noteRecord(atc_logic_buffer.size() > static_cast<size_t>(buffer_size));
     if (atc_logic_buffer.size() > buffer_size) {
         atc_logic_buffer.pop_front();
     }
 }
 
 void DataRecorder::recordPlannedEvents(double simulation_time, const VFT_SMF::GlobalSharedDataStruct::PlannedEventLibrary& data) {
-    std::lock_guard<std::mutex> lock(buffer_mutex);
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(buffer_mutex);
     planned_event_buffer.push_back({simulation_time, data});
+    noteRecord(planned_event_buffer.size() > static_cast<size_t>(buffer_size));
     if (planned_event_buffer.size() > buffer_size) {
         planned_event_buffer.pop_front();
     }
 }
 
 void DataRecorder::recordTriggeredEvents(double simulation_time, const VFT_SMF::GlobalSharedDataStruct::TriggeredEventLibrary& data) {
-    std::lock_guard<std::mutex> lock(buffer_mutex);
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(buffer_mutex);
     triggered_event_buffer.push_back({simulation_time, data});
+    noteRecord(triggered_event_buffer.size() > static_cast<size_t>(buffer_size));
     if (triggered_event_buffer.size() > buffer_size) {
         triggered_event_buffer.pop_front();
     }
 }
 
 void DataRecorder::recordATCCommand(double simulation_time, const VFT_SMF::GlobalSharedDataStruct::ATC_Command& data) {
-    std::lock_guard<std::mutex> lock(buffer_mutex);
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(buffer_mutex);
     atc_command_buffer.push_back({simulation_time, data});
+    noteRecord(atc_command_buffer.size() > static_cast<size_t>(buffer_size));
     if (atc_command_buffer.size() > buffer_size) {
         atc_command_buffer.pop_front();
     }
 }
 
 void DataRecorder::recordPlanedControllers(double simulation_time, const VFT_SMF::GlobalSharedDataStruct::PlanedControllersLibrary& data) {
-    std::lock_guard<std::mutex> lock(buffer_mutex);
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(buffer_mutex);
     planed_controllers_buffer.push_back({simulation_time, data});
+    noteRecord(planed_controllers_buffer.size() > static_cast<size_t>(buffer_size));
     if (planed_controllers_buffer.size() > buffer_size) {
         planed_controllers_buffer.pop_front();
     }
 }
 
 void DataRecorder::recordControllerExecutionStatus(double simulation_time, const VFT_SMF::GlobalSharedDataStruct::ControllerExecutionStatus& data) {
-    std::lock_guard<std::mutex> lock(buffer_mutex);
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(buffer_mutex);
     controller_execution_status_buffer.push_back({simulation_time, data});
+    noteRecord(controller_execution_status_buffer.size() > static_cast<size_t>(buffer_size));
     if (controller_execution_status_buffer.size() > buffer_size) {
         controller_execution_status_buffer.pop_front();
     }
 }
 
 void DataRecorder::recordEventQueue(double simulation_time, const VFT_SMF::GlobalSharedDataStruct::EventQueue& data) {
-    std::lock_guard<std::mutex> lock(buffer_mutex);
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(buffer_mutex);
     event_queue_buffer.push_back({simulation_time, data});
+    noteRecord(event_queue_buffer.size() > static_cast<size_t>(buffer_size));
     if (event_queue_buffer.size() > buffer_size) {
         event_queue_buffer.pop_front();
     }
@@ -230,569 +250,875 @@ void DataRecorder::recordAllData(double simulation_time, VFT_SMF::GlobalShared_D
     recordEventQueue(simulation_time, shared_data_space->getEventQueue());
 }
 
-void DataRecorder::flushAllBuffers() {
-    std::lock_guard<std::mutex> lock(buffer_mutex);
-    
-    try {
-        // 输出16个CSV文件
-        std::ofstream flight_plan_file(output_directory + "/flight_plan.csv");
-        flight_plan_file << std::left << std::setw(15) << "SimulationTime" << " "
-                       << std::setw(15) << "datasource" << " "
-                       << std::setw(15) << "ScenarioName" << " "
-                       << std::setw(15) << "Description" << " "
-                       << std::setw(15) << "Author" << " "
-                       << std::setw(15) << "CreationDate" << " "
-                       << std::setw(15) << "ScenarioType" << " "
-                       << std::setw(10) << "Pilot_ID" << " "
-                       << std::setw(10) << "Aircraft_ID" << " "
-                       << std::setw(10) << "ATC_ID" << " "
-                       << std::setw(15) << "Environment_Name" << " "
-               
-                       << std::setw(10) << "is_parsed" << "\n";
-        for (const auto& record : flight_plan_buffer) {
-            flight_plan_file << std::left << std::setw(15) << std::fixed << std::setprecision(2) << record.first << " "
-                           << std::setw(15) << record.second.datasource << " "
-                           << std::setw(15) << record.second.scenario_config.ScenarioName << " "
-                           << std::setw(15) << record.second.scenario_config.Description << " "
-                           << std::setw(15) << record.second.scenario_config.Author << " "
-                           << std::setw(15) << record.second.scenario_config.CreationDate << " "
-                           << std::setw(15) << record.second.scenario_config.ScenarioType << " "
-                           << std::setw(10) << record.second.scenario_config.Pilot_ID << " "
-                           << std::setw(10) << record.second.scenario_config.Aircraft_ID << " "
-                           << std::setw(10) << record.second.scenario_config.ATC_ID << " "
-                           << std::setw(15) << record.second.scenario_config.Environment_Name << " "
-                   
-                           << std::setw(10) << (record.second.is_parsed ? "true" : "false") << "\n";
+namespace {
+    /**
+     * @brief 表头列（名称与列宽）
+     */
+    struct CsvColumn {
+        const char* name;
+        int width;
+    };
+
+    /**
+     * @brief 写出表头：separator 为列间分隔符（右对齐的定宽文件不加分隔符）
+     */
+    void writeHeader(CsvExport::CsvFileWriter& out, std::initializer_list<CsvColumn> columns, const char* separator = " ") {
+        bool first = true;
+        for (const auto& column : columns) {
+            if (!first) out.raw(separator);
+            out.text(column.name, column.width);
+            first = false;
         }
-        flight_plan_file.close();
-
-        std::ofstream aircraft_flight_file(output_directory + "/aircraft_flight_state.csv");
-        aircraft_flight_file << std::right << std::setw(15) << "SimulationTime"
-                           << std::setw(20) << "datasource"
-                           << std::setw(15) << "latitude"
-                           << std::setw(15) << "longitude"
-                           << std::setw(10) << "altitude"
-                           << std::setw(10) << "heading"
-                           << std::setw(10) << "pitch"
-                           << std::setw(10) << "roll"
-                           << std::setw(15) << "airspeed"
-                           << std::setw(15) << "groundspeed"
-                           << std::setw(15) << "vertical_speed"
-                           << std::setw(15) << "distance_m" << "\n";
-        {
-            const double EARTH_RADIUS_M = 6371000.0;
-            auto deg2rad = [](double deg) { return deg * (3.14159265358979323846 / 180.0); };
-            bool has_prev = false;
-            double prev_lat_deg = 0.0;
-            double prev_lon_deg = 0.0;
-            double cumulative_distance_m = 0.0;
-
-            for (const auto& record : aircraft_flight_state_buffer) {
-                double lat_deg = record.second.latitude;
-                double lon_deg = record.second.longitude;
-
-                double distance_increment = 0.0;
-                if (has_prev) {
-                    // equirectangular approximation for small distances
-                    double lat1 = deg2rad(prev_lat_deg);
-                    double lat2 = deg2rad(lat_deg);
-                    double dlat = lat2 - lat1;
-                    double dlon = deg2rad(lon_deg - prev_lon_deg);
-                    double x = dlon * std::cos((lat1 + lat2) * 0.5);
-                    double y = dlat;
-                    distance_increment = std::sqrt(x * x + y * y) * EARTH_RADIUS_M;
-                    if (!std::isfinite(distance_increment) || distance_increment < 0) {
-                        distance_increment = 0.0;
-                    }
-                } else {
-                    has_prev = true;
-                }
-
-                cumulative_distance_m += distance_increment;
-                prev_lat_deg = lat_deg;
-                prev_lon_deg = lon_deg;
-
-                aircraft_flight_file << std::right << std::setw(15) << std::fixed << std::setprecision(2) << record.first
-                                   << std::setw(20) << record.second.datasource
-                                   << std::setw(15) << std::fixed << std::setprecision(2) << record.second.latitude
-                                   << std::setw(15) << std::fixed << std::setprecision(2) << record.second.longitude
-                                   << std::setw(10) << std::fixed << std::setprecision(2) << record.second.altitude
-                                   << std::setw(10) << std::fixed << std::setprecision(2) << record.second.heading
-                                   << std::setw(10) << std::fixed << std::setprecision(2) << record.second.pitch
-                                   << std::setw(10) << std::fixed << std::setprecision(2) << record.second.roll
-                                   << std::setw(15) << std::fixed << std::setprecision(2) << record.second.airspeed
-                                   << std::setw(15) << std::fixed << std::setprecision(2) << record.second.groundspeed
-                                   << std::setw(15) << std::fixed << std::setprecision(2) << record.second.vertical_speed
-                                   << std::setw(15) << std::fixed << std::setprecision(2) << cumulative_distance_m << "\n";
+        out.raw('\n');
+    }
+
+    /**
+     * @brief 来源名称缓存：相邻记录的来源ID通常相同，避免逐行查驻留表（并行写出时各线程各持一份）
+     */
+    class DataSourceNameCache {
+    public:
+        const std::string& operator()(GlobalSharedDataStruct::DataSourceId id) {
+            if (!cached_name || id != cached_id) {
+                cached_id = id;
+                cached_name = &GlobalSharedDataStruct::DataSourceRegistry::name(id);
             }
+            return *cached_name;
         }
-        aircraft_flight_file.close();
-
-        std::ofstream aircraft_system_file(output_directory + "/aircraft_system_state.csv");
-        aircraft_system_file << std::left << std::setw(15) << "SimulationTime" << " "
-                           << std::setw(20) << "datasource" << " "
-                           << std::setw(15) << "current_mass" << " "
-                           << std::setw(15) << "current_fuel" << " "
-                           << std::setw(30) << "current_center_of_gravity" << " "
-                           << std::setw(30) << "current_brake_pressure" << " "
-                           << std::setw(30) << "current_landing_gear_deployed" << " "
-                           << std::setw(30) << "current_flaps_deployed" << " "
-                           << std::setw(30) << "current_spoilers_deployed" << " "
-                           << std::setw(30) << "current_throttle_position" << " "
-                           << std::setw(20) << "current_engine_rpm" << " "
-                           << std::setw(20) << "left_engine_failed" << " "
-                           << std::setw(20) << "left_engine_rpm" << " "
-                           << std::setw(20) << "right_engine_failed" << " "
-                           << std::setw(20) << "right_engine_rpm" << " "
-                           << std::setw(20) << "brake_efficiency" << "\n";
-        for (const auto& record : aircraft_system_state_buffer) {
-            aircraft_system_file << std::left << std::setw(15) << std::fixed << std::setprecision(2) << record.first << " "
-                               << std::setw(20) << record.second.datasource << " "
-                               << std::setw(15) << std::fixed << std::setprecision(2) << record.second.current_mass << " "
-                               << std::setw(15) << std::fixed << std::setprecision(2) << record.second.current_fuel << " "
-                               << std::setw(30) << std::fixed << std::setprecision(2) << record.second.current_center_of_gravity << " "
-                               << std::setw(30) << std::fixed << std::setprecision(2) << record.second.current_brake_pressure << " "
-                               << std::setw(30) << std::fixed << std::setprecision(2) << record.second.current_landing_gear_deployed << " "
-                               << std::setw(30) << std::fixed << std::setprecision(2) << record.second.current_flaps_deployed << " "
-                               << std::setw(30) << std::fixed << std::setprecision(2) << record.second.current_spoilers_deployed << " "
-                               << std::setw(30) << std::fixed << std::setprecision(2) << record.second.current_throttle_position << " "
-                               << std::setw(20) << std::fixed << std::setprecision(2) << record.second.current_engine_rpm << " "
-                               << std::setw(20) << (record.second.left_engine_failed ? "true" : "false") << " "
-                               << std::setw(20) << std::fixed << std::setprecision(2) << record.second.left_engine_rpm << " "
-                               << std::setw(20) << (record.second.right_engine_failed ? "true" : "false") << " "
-                               << std::setw(20) << std::fixed << std::setprecision(2) << record.second.right_engine_rpm << " "
-                               << std::setw(20) << std::fixed << std::setprecision(2) << record.second.brake_efficiency << "\n";
-        }
-        aircraft_system_file.close();
 
-        std::ofstream pilot_state_file(output_directory + "/pilot_state.csv");
-        pilot_state_file << std::left << std::setw(15) << "SimulationTime" << " "
-                       << std::setw(15) << "datasource" << " "
-                       << std::setw(15) << "attention_level" << " "
-                       << std::setw(15) << "skill_level" << "\n";
-        for (const auto& record : pilot_state_buffer) {
-            pilot_state_file << std::left << std::setw(15) << std::fixed << std::setprecision(2) << record.first << " "
-                           << std::setw(15) << record.second.datasource << " "
-                           << std::setw(15) << std::fixed << std::setprecision(2) << record.second.attention_level << " "
-                           << std::setw(15) << std::fixed << std::setprecision(2) << record.second.skill_level << "\n";
+    private:
+        GlobalSharedDataStruct::DataSourceId cached_id = 0;
+        const std::string* cached_name = nullptr;
+    };
+
+    /**
+     * @brief 打开CSV写出器，失败时抛出异常（由并行写出汇总记录）
+     */
+    void requireOpen(const CsvExport::CsvFileWriter& out, const std::string& path) {
+        if (!out.isOpen()) {
+            throw std::runtime_error("无法创建文件: " + path);
         }
-        pilot_state_file.close();
-
-        std::ofstream environment_state_file(output_directory + "/environment_state.csv");
-        environment_state_file << std::left << std::setw(15) << "SimulationTime" << " "
-                             << std::setw(20) << "datasource" << " "
-                             << std::setw(15) << "runway_length" << " "
-                             << std::setw(15) << "runway_width" << " "
-                             << std::setw(20) << "friction_coefficient" << " "
-                             << std::setw(15) << "air_density" << " "
-                             << std::setw(15) << "wind_speed" << " "
-                             << std::setw(15) << "wind_direction" << "\n";
-        for (const auto& record : environment_state_buffer) {
-            environment_state_file << std::left << std::setw(15) << std::fixed << std::setprecision(2) << record.first << " "
-                                   << std::setw(20) << record.second.datasource << " "
-                                   << std::setw(15) << std::fixed << std::setprecision(2) << record.second.runway_length << " "
-                                   << std::setw(15) << std::fixed << std::setprecision(2) << record.second.runway_width << " "
-                                   << std::setw(20) << std::fixed << std::setprecision(2) << record.second.friction_coefficient << " "
-                                   << std::setw(15) << std::fixed << std::setprecision(2) << record.second.air_density << " "
-                                   << std::setw(15) << std::fixed << std::setprecision(2) << record.second.wind_speed << " "
-                                   << std::setw(15) << std::fixed << std::setprecision(2) << record.second.wind_direction << "\n";
+    }
+
+    void finishFile(CsvExport::CsvFileWriter& out, const std::string& path) {
+        if (!out.close()) {
+            throw std::runtime_error("写入文件失败: " + path);
         }
-        environment_state_file.close();
-
-        std::ofstream atc_state_file(output_directory + "/atc_state.csv");
-        atc_state_file << std::left << std::setw(15) << "SimulationTime" << " "
-                      << std::setw(20) << "datasource" << " "
-                      << std::setw(20) << "controller_workload" << " "
-                      << std::setw(20) << "controller_attention" << " "
-                      << std::setw(20) << "active_aircraft_count" << " "
-                      << std::setw(20) << "pending_commands" << " "
-                      << std::setw(20) << "airspace_congestion" << " "
-                      << std::setw(15) << "conflict_count" << " "
-                      << std::setw(20) << "separation_violations" << " "
-                      << std::setw(20) << "communication_load" << " "
-                      << std::setw(20) << "active_frequencies" << " "
-                      << std::setw(15) << "response_time" << " "
-                      << std::setw(20) << "radar_operational" << " "
-                      << std::setw(25) << "communication_system_operational" << " "
-                      << std::setw(15) << "current_phase" << "\n";
-        for (const auto& record : atc_state_buffer) {
-            atc_state_file << std::left << std::setw(15) << std::fixed << std::setprecision(2) << record.first << " "
-                          << std::setw(20) << record.second.datasource << " "
-                          << std::setw(20) << std::fixed << std::setprecision(2) << record.second.controller_workload << " "
-                          << std::setw(20) << std::fixed << std::setprecision(2) << record.second.controller_attention << " "
-                          << std::setw(20) << std::fixed << std::setprecision(2) << record.second.active_aircraft_count << " "
-                          << std::setw(20) << std::fixed << std::setprecision(2) << record.second.pending_commands << " "
-                          << std::setw(20) << std::fixed << std::setprecision(2) << record.second.airspace_congestion << " "
-                          << std::setw(15) << std::fixed << std::setprecision(2) << record.second.conflict_count << " "
-                          << std::setw(20) << std::fixed << std::setprecision(2) << record.second.separation_violations << " "
-                          << std::setw(20) << std::fixed << std::setprecision(2) << record.second.communication_load << " "
-                          << std::setw(20) << std::fixed << std::setprecision(2) << record.second.active_frequencies << " "
-                          << std::setw(15) << std::fixed << std::setprecision(2) << record.second.response_time << " "
-                          << std::setw(20) << (record.second.radar_operational ? "true" : "false") << " "
-                          << std::setw(25) << (record.second.communication_system_operational ? "true" : "false") << " "
-                          << std::setw(15) << record.second.current_phase << "\n";
+    }
+
+    /**
+     * @brief 检查压缩通道文件已打开，失败时按CSV写出的格式记录错误（不抛出，其余通道照常写出）
+     */
+    bool checkOpen(const TimeSeriesCodec::CompressedChannelWriter& writer, const std::string& path) {
+        if (writer.isOpen()) {
+            return true;
         }
-        atc_state_file.close();
-
-        // 输出六分量合外力数据
-        std::ofstream aircraft_net_force_file(output_directory + "/aircraft_net_force.csv");
-        aircraft_net_force_file << std::left << std::setw(15) << "SimulationTime" << " "
-                               << std::setw(20) << "datasource" << " "
-                               << std::setw(20) << "longitudinal_force" << " "
-                               << std::setw(15) << "lateral_force" << " "
-                               << std::setw(15) << "vertical_force" << " "
-                               << std::setw(15) << "roll_moment" << " "
-                               << std::setw(15) << "pitch_moment" << " "
-                               << std::setw(15) << "yaw_moment" << " "
-                               << std::setw(15) << "thrust_force" << " "
-                               << std::setw(15) << "drag_force" << " "
-                               << std::setw(15) << "lift_force" << " "
-                               << std::setw(15) << "weight_force" << " "
-                               << std::setw(15) << "side_force" << "\n";
-        for (const auto& record : aircraft_net_force_buffer) {
-            aircraft_net_force_file << std::left << std::setw(15) << std::fixed << std::setprecision(2) << record.first << " "
-                                   << std::setw(20) << record.second.datasource << " "
-                                   << std::setw(20) << std::fixed << std::setprecision(2) << record.second.longitudinal_force << " "
-                                   << std::setw(15) << std::fixed << std::setprecision(2) << record.second.lateral_force << " "
-                                   << std::setw(15) << std::fixed << std::setprecision(2) << record.second.vertical_force << " "
-                                   << std::setw(15) << std::fixed << std::setprecision(2) << record.second.roll_moment << " "
-                                   << std::setw(15) << std::fixed << std::setprecision(2) << record.second.pitch_moment << " "
-                                   << std::setw(15) << std::fixed << std::setprecision(2) << record.second.yaw_moment << " "
-                                   << std::setw(15) << std::fixed << std::setprecision(2) << record.second.thrust_force << " "
-                                   << std::setw(15) << std::fixed << std::setprecision(2) << record.second.drag_force << " "
-                                   << std::setw(15) << std::fixed << std::setprecision(2) << record.second.lift_force << " "
-                                   << std::setw(15) << std::fixed << std::setprecision(2) << record.second.weight_force << " "
-                                   << std::setw(15) << std::fixed << std::setprecision(2) << record.second.side_force << "\n";
+        VFT_LOG_BRIEF("数据记录器输出文件失败: 无法创建文件: {}", path);
+        return false;
+    }
+}
+
+std::string DataRecorder::csvPath(const char* module) const {
+    return output_directory + "/" + module + ".csv";
+}
+
+void DataRecorder::writeFlightPlanCsv() const {
+    const std::string path = csvPath("flight_plan");
+    CsvExport::CsvFileWriter out(path);
+    requireOpen(out, path);
+    TimeIndex::TimeIndexBuilder index;
+    const int time_digits = csv_precision.get("flight_plan", "SimulationTime");
+
+    out.left();
+    writeHeader(out, {{"SimulationTime", 15}, {"datasource", 15}, {"ScenarioName", 15}, {"Description", 15},
+                      {"Author", 15}, {"CreationDate", 15}, {"ScenarioType", 15}, {"Pilot_ID", 10},
+                      {"Aircraft_ID", 10}, {"ATC_ID", 10}, {"Environment_Name", 15}, {"is_parsed", 10}});
+    for (const auto& record : flight_plan_buffer) {
+        index.onRow(record.first, out.offset());
+        const auto& scenario = record.second.scenario_config;
+        out.number(record.first, time_digits, 15).raw(' ')
+           .text(record.second.datasource, 15).raw(' ')
+           .text(scenario.ScenarioName, 15).raw(' ')
+           .text(scenario.Description, 15).raw(' ')
+           .text(scenario.Author, 15).raw(' ')
+           .text(scenario.CreationDate, 15).raw(' ')
+           .text(scenario.ScenarioType, 15).raw(' ')
+           .text(scenario.Pilot_ID, 10).raw(' ')
+           .text(scenario.Aircraft_ID, 10).raw(' ')
+           .text(scenario.ATC_ID, 10).raw(' ')
+           .text(scenario.Environment_Name, 15).raw(' ')
+           .boolean(record.second.is_parsed, 10).raw('\n');
+    }
+    finishFile(out, path);
+    index.write(TimeIndex::indexPathFor(path));
+}
+
+void DataRecorder::writeAircraftFlightStateCsv() const {
+    const std::string path = csvPath("aircraft_flight_state");
+    CsvExport::CsvFileWriter out(path);
+    requireOpen(out, path);
+    TimeIndex::TimeIndexBuilder index;
+    const auto digits = [this](const char* column) { return csv_precision.get("aircraft_flight_state", column); };
+    const int time_digits = digits("SimulationTime");
+    const int latitude_digits = digits("latitude");
+    const int longitude_digits = digits("longitude");
+    const int altitude_digits = digits("altitude");
+    const int heading_digits = digits("heading");
+    const int pitch_digits = digits("pitch");
+    const int roll_digits = digits("roll");
+    const int airspeed_digits = digits("airspeed");
+    const int groundspeed_digits = digits("groundspeed");
+    const int vertical_speed_digits = digits("vertical_speed");
+    const int distance_digits = digits("distance_m");
+
+    out.right();
+    writeHeader(out, {{"SimulationTime", 15}, {"datasource", 20}, {"latitude", 15}, {"longitude", 15},
+                      {"altitude", 10}, {"heading", 10}, {"pitch", 10}, {"roll", 10}, {"airspeed", 15},
+                      {"groundspeed", 15}, {"vertical_speed", 15}, {"distance_m", 15}}, "");
+
+    FlightDynamics::GroundDistance distance;
+    DataSourceNameCache source_name;
+
+    for (const auto& record : aircraft_flight_state_buffer) {
+        index.onRow(record.first, out.offset());
+        const double cumulative_distance_m = distance.add(record.second.latitude, record.second.longitude);
+
+        out.number(record.first, time_digits, 15)
+           .text(source_name(record.second.datasource), 20)
+           .number(record.second.latitude, latitude_digits, 15)
+           .number(record.second.longitude, longitude_digits, 15)
+           .number(record.second.altitude, altitude_digits, 10)
+           .number(record.second.heading, heading_digits, 10)
+           .number(record.second.pitch, pitch_digits, 10)
+           .number(record.second.roll, roll_digits, 10)
+           .number(record.second.airspeed, airspeed_digits, 15)
+           .number(record.second.groundspeed, groundspeed_digits, 15)
+           .number(record.second.vertical_speed, vertical_speed_digits, 15)
+           .number(cumulative_distance_m, distance_digits, 15).raw('\n');
+    }
+    finishFile(out, path);
+    index.write(TimeIndex::indexPathFor(path));
+}
+
+void DataRecorder::writeAircraftSystemStateCsv() const {
+    const std::string path = csvPath("aircraft_system_state");
+    CsvExport::CsvFileWriter out(path);
+    requireOpen(out, path);
+    TimeIndex::TimeIndexBuilder index;
+    const auto digits = [this](const char* column) { return csv_precision.get("aircraft_system_state", column); };
+    const int time_digits = digits("SimulationTime");
+    const int mass_digits = digits("current_mass");
+    const int fuel_digits = digits("current_fuel");
+    const int cg_digits = digits("current_center_of_gravity");
+    const int brake_pressure_digits = digits("current_brake_pressure");
+    const int gear_digits = digits("current_landing_gear_deployed");
+    const int flaps_digits = digits("current_flaps_deployed");
+    const int spoilers_digits = digits("current_spoilers_deployed");
+    const int throttle_digits = digits("current_throttle_position");
+    const int engine_rpm_digits = digits("current_engine_rpm");
+    const int left_rpm_digits = digits("left_engine_rpm");
+    const int right_rpm_digits = digits("right_engine_rpm");
+    const int brake_efficiency_digits = digits("brake_efficiency");
+    DataSourceNameCache source_name;
+
+    out.left();
+    writeHeader(out, {{"SimulationTime", 15}, {"datasource", 20}, {"current_mass", 15}, {"current_fuel", 15},
+                      {"current_center_of_gravity", 30}, {"current_brake_pressure", 30},
+                      {"current_landing_gear_deployed", 30}, {"current_flaps_deployed", 30},
+                      {"current_spoilers_deployed", 30}, {"current_throttle_position", 30},
+                      {"current_engine_rpm", 20}, {"left_engine_failed", 20}, {"left_engine_rpm", 20},
+                      {"right_engine_failed", 20}, {"right_engine_rpm", 20}, {"brake_efficiency", 20}});
+    for (const auto& record : aircraft_system_state_buffer) {
+        index.onRow(record.first, out.offset());
+        const auto& s = record.second;
+        out.number(record.first, time_digits, 15).raw(' ')
+           .text(source_name(s.datasource), 20).raw(' ')
+           .number(s.current_mass, mass_digits, 15).raw(' ')
+           .number(s.current_fuel, fuel_digits, 15).raw(' ')
+           .number(s.current_center_of_gravity, cg_digits, 30).raw(' ')
+           .number(s.current_brake_pressure, brake_pressure_digits, 30).raw(' ')
+           .number(s.current_landing_gear_deployed, gear_digits, 30).raw(' ')
+           .number(s.current_flaps_deployed, flaps_digits, 30).raw(' ')
+           .number(s.current_spoilers_deployed, spoilers_digits, 30).raw(' ')
+           .number(s.current_throttle_position, throttle_digits, 30).raw(' ')
+           .number(s.current_engine_rpm, engine_rpm_digits, 20).raw(' ')
+           .boolean(s.left_engine_failed, 20).raw(' ')
+           .number(s.left_engine_rpm, left_rpm_digits, 20).raw(' ')
+           .boolean(s.right_engine_failed, 20).raw(' ')
+           .number(s.right_engine_rpm, right_rpm_digits, 20).raw(' ')
+           .number(s.brake_efficiency, brake_efficiency_digits, 20).raw('\n');
+    }
+    finishFile(out, path);
+    index.write(TimeIndex::indexPathFor(path));
+}
+
+void DataRecorder::writePilotStateCsv() const {
+    const std::string path = csvPath("pilot_state");
+    CsvExport::CsvFileWriter out(path);
+    requireOpen(out, path);
+    TimeIndex::TimeIndexBuilder index;
+    const int time_digits = csv_precision.get("pilot_state", "SimulationTime");
+    const int attention_digits = csv_precision.get("pilot_state", "attention_level");
+    const int skill_digits = csv_precision.get("pilot_state", "skill_level");
+    DataSourceNameCache source_name;
+
+    out.left();
+    writeHeader(out, {{"SimulationTime", 15}, {"datasource", 15}, {"attention_level", 15}, {"skill_level", 15}});
+    for (const auto& record : pilot_state_buffer) {
+        index.onRow(record.first, out.offset());
+        out.number(record.first, time_digits, 15).raw(' ')
+           .text(source_name(record.second.datasource), 15).raw(' ')
+           .number(record.second.attention_level, attention_digits, 15).raw(' ')
+           .number(record.second.skill_level, skill_digits, 15).raw('\n');
+    }
+    finishFile(out, path);
+    index.write(TimeIndex::indexPathFor(path));
+}
+
+void DataRecorder::writeEnvironmentStateCsv() const {
+    const std::string path = csvPath("environment_state");
+    CsvExport::CsvFileWriter out(path);
+    requireOpen(out, path);
+    TimeIndex::TimeIndexBuilder index;
+    const auto digits = [this](const char* column) { return csv_precision.get("environment_state", column); };
+    const int time_digits = digits("SimulationTime");
+    const int length_digits = digits("runway_length");
+    const int width_digits = digits("runway_width");
+    const int friction_digits = digits("friction_coefficient");
+    const int density_digits = digits("air_density");
+    const int wind_speed_digits = digits("wind_speed");
+    const int wind_direction_digits = digits("wind_direction");
+    const int elevation_digits = digits("runway_elevation");
+    DataSourceNameCache source_name;
+
+    out.left();
+    writeHeader(out, {{"SimulationTime", 15}, {"datasource", 20}, {"runway_length", 15}, {"runway_width", 15},
+                      {"friction_coefficient", 20}, {"air_density", 15}, {"wind_speed", 15},
+                      {"wind_direction", 15}, {"runway_elevation", 15}});
+    for (const auto& record : environment_state_buffer) {
+        index.onRow(record.first, out.offset());
+        const auto& s = record.second;
+        out.number(record.first, time_digits, 15).raw(' ')
+           .text(source_name(s.datasource), 20).raw(' ')
+           .number(s.runway_length, length_digits, 15).raw(' ')
+           .number(s.runway_width, width_digits, 15).raw(' ')
+           .number(s.friction_coefficient, friction_digits, 20).raw(' ')
+           .number(s.air_density, density_digits, 15).raw(' ')
+           .number(s.wind_speed, wind_speed_digits, 15).raw(' ')
+           .number(s.wind_direction, wind_direction_digits, 15).raw(' ')
+           .number(s.runway_elevation, elevation_digits, 15).raw('\n');
+    }
+    finishFile(out, path);
+    index.write(TimeIndex::indexPathFor(path));
+}
+
+void DataRecorder::writeATCStateCsv() const {
+    const std::string path = csvPath("atc_state");
+    CsvExport::CsvFileWriter out(path);
+    requireOpen(out, path);
+    TimeIndex::TimeIndexBuilder index;
+    const auto digits = [this](const char* column) { return csv_precision.get("atc_state", column); };
+    const int time_digits = digits("SimulationTime");
+    const int workload_digits = digits("controller_workload");
+    const int attention_digits = digits("controller_attention");
+    const int congestion_digits = digits("airspace_congestion");
+    const int violations_digits = digits("separation_violations");
+    const int load_digits = digits("communication_load");
+    const int response_digits = digits("response_time");
+    DataSourceNameCache source_name;
+
+    out.left();
+    writeHeader(out, {{"SimulationTime", 15}, {"datasource", 20}, {"controller_workload", 20},
+                      {"controller_attention", 20}, {"active_aircraft_count", 20}, {"pending_commands", 20},
+                      {"airspace_congestion", 20}, {"conflict_count", 15}, {"separation_violations", 20},
+                      {"communication_load", 20}, {"active_frequencies", 20}, {"response_time", 15},
+                      {"radar_operational", 20}, {"communication_system_operational", 25}, {"current_phase", 15}});
+    for (const auto& record : atc_state_buffer) {
+        index.onRow(record.first, out.offset());
+        const auto& s = record.second;
+        out.number(record.first, time_digits, 15).raw(' ')
+           .text(source_name(s.datasource), 20).raw(' ')
+           .number(s.controller_workload, workload_digits, 20).raw(' ')
+           .number(s.controller_attention, attention_digits, 20).raw(' ')
+           .integer(s.active_aircraft_count, 20).raw(' ')
+           .integer(s.pending_commands, 20).raw(' ')
+           .number(s.airspace_congestion, congestion_digits, 20).raw(' ')
+           .integer(s.conflict_count, 15).raw(' ')
+           .number(s.separation_violations, violations_digits, 20).raw(' ')
+           .number(s.communication_load, load_digits, 20).raw(' ')
+           .integer(s.active_frequencies, 20).raw(' ')
+           .number(s.response_time, response_digits, 15).raw(' ')
+           .boolean(s.radar_operational, 20).raw(' ')
+           .boolean(s.communication_system_operational, 25).raw(' ')
+           .text(s.current_phase, 15).raw('\n');
+    }
+    finishFile(out, path);
+    index.write(TimeIndex::indexPathFor(path));
+}
+
+void DataRecorder::writeAircraftNetForceCsv() const {
+    const std::string path = csvPath("aircraft_net_force");
+    CsvExport::CsvFileWriter out(path);
+    requireOpen(out, path);
+    TimeIndex::TimeIndexBuilder index;
+    const auto digits = [this](const char* column) { return csv_precision.get("aircraft_net_force", column); };
+    const int time_digits = digits("SimulationTime");
+    const int longitudinal_digits = digits("longitudinal_force");
+    const int lateral_digits = digits("lateral_force");
+    const int vertical_digits = digits("vertical_force");
+    const int roll_digits = digits("roll_moment");
+    const int pitch_digits = digits("pitch_moment");
+    const int yaw_digits = digits("yaw_moment");
+    const int thrust_digits = digits("thrust_force");
+    const int drag_digits = digits("drag_force");
+    const int lift_digits = digits("lift_force");
+    const int weight_digits = digits("weight_force");
+    const int side_digits = digits("side_force");
+    DataSourceNameCache source_name;
+
+    out.left();
+    writeHeader(out, {{"SimulationTime", 15}, {"datasource", 20}, {"longitudinal_force", 20}, {"lateral_force", 15},
+                      {"vertical_force", 15}, {"roll_moment", 15}, {"pitch_moment", 15}, {"yaw_moment", 15},
+                      {"thrust_force", 15}, {"drag_force", 15}, {"lift_force", 15}, {"weight_force", 15},
+                      {"side_force", 15}});
+    for (const auto& record : aircraft_net_force_buffer) {
+        index.onRow(record.first, out.offset());
+        const auto& s = record.second;
+        out.number(record.first, time_digits, 15).raw(' ')
+           .text(source_name(s.datasource), 20).raw(' ')
+           .number(s.longitudinal_force, longitudinal_digits, 20).raw(' ')
+           .number(s.lateral_force, lateral_digits, 15).raw(' ')
+           .number(s.vertical_force, vertical_digits, 15).raw(' ')
+           .number(s.roll_moment, roll_digits, 15).raw(' ')
+           .number(s.pitch_moment, pitch_digits, 15).raw(' ')
+           .number(s.yaw_moment, yaw_digits, 15).raw(' ')
+           .number(s.thrust_force, thrust_digits, 15).raw(' ')
+           .number(s.drag_force, drag_digits, 15).raw(' ')
+           .number(s.lift_force, lift_digits, 15).raw(' ')
+           .number(s.weight_force, weight_digits, 15).raw(' ')
+           .number(s.side_force, side_digits, 15).raw('\n');
+    }
+    finishFile(out, path);
+    index.write(TimeIndex::indexPathFor(path));
+}
+
+void DataRecorder::writeAircraftLogicCsv() const {
+    const std::string path = csvPath("aircraft_logic");
+    CsvExport::CsvFileWriter out(path);
+    requireOpen(out, path);
+    TimeIndex::TimeIndexBuilder index;
+    const auto digits = [this](const char* column) { return csv_precision.get("aircraft_logic", column); };
+    const int time_digits = digits("SimulationTime");
+    const int altitude_digits = digits("planned_altitude");
+    const int speed_digits = digits("planned_speed");
+    const int progress_digits = digits("phase_progress");
+    const int performance_digits = digits("performance_index");
+    const int efficiency_digits = digits("fuel_efficiency");
+    const int optimal_speed_digits = digits("optimal_speed");
+    const int optimal_altitude_digits = digits("optimal_altitude");
+
+    out.left();
+    writeHeader(out, {{"SimulationTime", 15}, {"datasource", 20}, {"flight_plan_id", 15}, {"departure_airport", 20},
+                      {"arrival_airport", 20}, {"planned_altitude", 20}, {"planned_speed", 15},
+                      {"current_phase", 15}, {"next_phase", 15}, {"phase_progress", 15},
+                      {"autopilot_engaged", 20}, {"autopilot_mode", 15}, {"auto_throttle_engaged", 20},
+                      {"navigation_mode", 15}, {"performance_index", 15}, {"fuel_efficiency", 15},
+                      {"optimal_speed", 15}, {"optimal_altitude", 15}});
+    for (const auto& record : aircraft_logic_buffer) {
+        index.onRow(record.first, out.offset());
+        const auto& s = record.second;
+        out.number(record.first, time_digits, 15).raw(' ')
+           .text(s.datasource, 20).raw(' ')
+           .text(s.flight_plan_id, 15).raw(' ')
+           .text(s.departure_airport, 20).raw(' ')
+           .text(s.arrival_airport, 20).raw(' ')
+           .number(s.planned_altitude, altitude_digits, 20).raw(' ')
+           .number(s.planned_speed, speed_digits, 15).raw(' ')
+           .text(s.current_phase, 15).raw(' ')
+           .text(s.next_phase, 15).raw(' ')
+           .number(s.phase_progress, progress_digits, 15).raw(' ')
+           .boolean(s.autopilot_engaged, 20).raw(' ')
+           .text(s.autopilot_mode, 15).raw(' ')
+           .boolean(s.auto_throttle_engaged, 20).raw(' ')
+           .text(s.navigation_mode, 15).raw(' ')
+           .number(s.performance_index, performance_digits, 15).raw(' ')
+           .number(s.fuel_efficiency, efficiency_digits, 15).raw(' ')
+           .number(s.optimal_speed, optimal_speed_digits, 15).raw(' ')
+           .number(s.optimal_altitude, optimal_altitude_digits, 15).raw('\n');
+    }
+    finishFile(out, path);
+    index.write(TimeIndex::indexPathFor(path));
+}
+
+void DataRecorder::writePilotLogicCsv() const {
+    const std::string path = csvPath("pilot_logic");
+    CsvExport::CsvFileWriter out(path);
+    requireOpen(out, path);
+    TimeIndex::TimeIndexBuilder index;
+    const auto digits = [this](const char* column) { return csv_precision.get("pilot_logic", column); };
+    const int time_digits = digits("SimulationTime");
+    const int risk_digits = digits("risk_tolerance");
+    const int awareness_digits = digits("situation_awareness");
+    const int adaptability_digits = digits("adaptability");
+    const int learning_digits = digits("learning_rate");
+    const int improvement_digits = digits("performance_improvement");
+
+    out.left();
+    writeHeader(out, {{"SimulationTime", 15}, {"datasource", 20}, {"decision_strategy", 20}, {"risk_tolerance", 15},
+                      {"priority_task", 15}, {"attention_focus", 15}, {"mental_model", 15},
+                      {"situation_awareness", 20}, {"behavior_pattern", 15}, {"adaptability", 15},
+                      {"communication_style", 20}, {"learning_rate", 15}, {"performance_improvement", 20}});
+    for (const auto& record : pilot_logic_buffer) {
+        index.onRow(record.first, out.offset());
+        const auto& s = record.second;
+        out.number(record.first, time_digits, 15).raw(' ')
+           .text(s.datasource, 20).raw(' ')
+           .text(s.decision_strategy, 20).raw(' ')
+           .number(s.risk_tolerance, risk_digits, 15).raw(' ')
+           .text(s.priority_task, 15).raw(' ')
+           .text(s.attention_focus, 15).raw(' ')
+           .text(s.mental_model, 15).raw(' ')
+           .number(s.situation_awareness, awareness_digits, 20).raw(' ')
+           .text(s.behavior_pattern, 15).raw(' ')
+           .number(s.adaptability, adaptability_digits, 15).raw(' ')
+           .text(s.communication_style, 20).raw(' ')
+           .number(s.learning_rate, learning_digits, 15).raw(' ')
+           .number(s.performance_improvement, improvement_digits, 20).raw('\n');
+    }
+    finishFile(out, path);
+    index.write(TimeIndex::indexPathFor(path));
+}
+
+void DataRecorder::writeEnvironmentLogicCsv() const {
+    const std::string path = csvPath("environment_logic");
+    CsvExport::CsvFileWriter out(path);
+    requireOpen(out, path);
+    TimeIndex::TimeIndexBuilder index;
+    const auto digits = [this](const char* column) { return csv_precision.get("environment_logic", column); };
+    const int time_digits = digits("SimulationTime");
+    const int severity_digits = digits("weather_severity");
+    const int terrain_risk_digits = digits("terrain_risk_level");
+    const int restrictions_digits = digits("airspace_restrictions");
+    const int daylight_digits = digits("daylight_availability");
+
+    out.left();
+    writeHeader(out, {{"SimulationTime", 15}, {"datasource", 20}, {"weather_pattern", 15}, {"weather_severity", 15},
+                      {"weather_trend", 15}, {"terrain_complexity", 20}, {"terrain_risk_level", 15},
+                      {"airspace_class", 15}, {"airspace_restrictions", 20}, {"time_of_day", 15},
+                      {"season", 15}, {"daylight_availability", 20}});
+    for (const auto& record : environment_logic_buffer) {
+        index.onRow(record.first, out.offset());
+        const auto& s = record.second;
+        out.number(record.first, time_digits, 15).raw(' ')
+           .text(s.datasource, 20).raw(' ')
+           .text(s.weather_pattern, 15).raw(' ')
+           .number(s.weather_severity, severity_digits, 15).raw(' ')
+           .text(s.weather_trend, 15).raw(' ')
+           .text(s.terrain_complexity, 20).raw(' ')
+           .number(s.terrain_risk_level, terrain_risk_digits, 15).raw(' ')
+           .text(s.airspace_class, 15).raw(' ')
+           .number(s.airspace_restrictions, restrictions_digits, 20).raw(' ')
+           .text(s.time_of_day, 15).raw(' ')
+           .text(s.season, 15).raw(' ')
+           .number(s.daylight_availability, daylight_digits, 20).raw('\n');
+    }
+    finishFile(out, path);
+    index.write(TimeIndex::indexPathFor(path));
+}
+
+void DataRecorder::writeATCLogicCsv() const {
+    const std::string path = csvPath("atc_logic");
+    CsvExport::CsvFileWriter out(path);
+    requireOpen(out, path);
+    TimeIndex::TimeIndexBuilder index;
+    const auto digits = [this](const char* column) { return csv_precision.get("atc_logic", column); };
+    const int time_digits = digits("SimulationTime");
+    const int separation_digits = digits("separation_standards");
+    const int threshold_digits = digits("conflict_detection_threshold");
+    const int priority_digits = digits("communication_priority");
+    const int automation_digits = digits("automation_level");
+
+    out.left();
+    writeHeader(out, {{"SimulationTime", 15}, {"datasource", 20}, {"control_strategy", 20},
+                      {"separation_standards", 20}, {"traffic_flow_management", 25},
+                      {"conflict_resolution_strategy", 25}, {"conflict_detection_threshold", 25},
+                      {"communication_protocol", 20}, {"communication_priority", 20}, {"system_mode", 15},
+                      {"automation_level", 15}});
+    for (const auto& record : atc_logic_buffer) {
+        index.onRow(record.first, out.offset());
+        const auto& s = record.second;
+        out.number(record.first, time_digits, 15).raw(' ')
+           .text(s.datasource, 20).raw(' ')
+           .text(s.control_strategy, 20).raw(' ')
+           .number(s.separation_standards, separation_digits, 20).raw(' ')
+           .text(s.traffic_flow_management, 25).raw(' ')
+           .text(s.conflict_resolution_strategy, 25).raw(' ')
+           .number(s.conflict_detection_threshold, threshold_digits, 25).raw(' ')
+           .text(s.communication_protocol, 20).raw(' ')
+           .number(s.communication_priority, priority_digits, 20).raw(' ')
+           .text(s.system_mode, 15).raw(' ')
+           .number(s.automation_level, automation_digits, 15).raw('\n');
+    }
+    finishFile(out, path);
+    index.write(TimeIndex::indexPathFor(path));
+}
+
+void DataRecorder::writePlannedEventsCsv() const {
+    const std::string path = csvPath("planned_events");
+    CsvExport::CsvFileWriter out(path);
+    requireOpen(out, path);
+
+    out.left();
+    writeHeader(out, {{"datasource", 20}, {"event_id", 20}, {"event_name", 35}, {"description", 50},
+                      {"source_agent", 20}, {"is_triggered", 20}});
+    // 计划事件库是静态的，只需要输出一次（取第一条记录）
+    if (!planned_event_buffer.empty()) {
+        const auto& library = planned_event_buffer.begin()->second;
+        for (const auto& event : library.getPlannedEvents()) {
+            out.text(library.datasource, 20).raw(' ')
+               .integer(event.event_id, 20).raw(' ')
+               .text(event.event_name, 35).raw(' ')
+               .text(event.description, 50).raw(' ')
+               .text(event.source_agent, 20).raw(' ')
+               .boolean(event.is_triggered, 20).raw('\n');
         }
-        aircraft_net_force_file.close();
-
-        std::ofstream aircraft_logic_file(output_directory + "/aircraft_logic.csv");
-        aircraft_logic_file << std::left << std::setw(15) << "SimulationTime" << " "
-                          << std::setw(20) << "datasource" << " "
-                          << std::setw(15) << "flight_plan_id" << " "
-                          << std::setw(20) << "departure_airport" << " "
-                          << std::setw(20) << "arrival_airport" << " "
-                          << std::setw(20) << "planned_altitude" << " "
-                          << std::setw(15) << "planned_speed" << " "
-                          << std::setw(15) << "current_phase" << " "
-                          << std::setw(15) << "next_phase" << " "
-                          << std::setw(15) << "phase_progress" << " "
-                          << std::setw(20) << "autopilot_engaged" << " "
-                          << std::setw(15) << "autopilot_mode" << " "
-                          << std::setw(20) << "auto_throttle_engaged" << " "
-                          << std::setw(15) << "navigation_mode" << " "
-                          << std::setw(15) << "performance_index" << " "
-                          << std::setw(15) << "fuel_efficiency" << " "
-                          << std::setw(15) << "optimal_speed" << " "
-                          << std::setw(15) << "optimal_altitude" << "\n";
-        for (const auto& record : aircraft_logic_buffer) {
-            aircraft_logic_file << std::left << std::setw(15) << std::fixed << std::setprecision(2) << record.first << " "
-                              << std::setw(20) << record.second.datasource << " "
-                              << std::setw(15) << record.second.flight_plan_id << " "
-                              << std::setw(20) << record.second.departure_airport << " "
-                              << std::setw(20) << record.second.arrival_airport << " "
-                              << std::setw(20) << std::fixed << std::setprecision(2) << record.second.planned_altitude << " "
-                              << std::setw(15) << std::fixed << std::setprecision(2) << record.second.planned_speed << " "
-                              << std::setw(15) << record.second.current_phase << " "
-                              << std::setw(15) << record.second.next_phase << " "
-                              << std::setw(15) << std::fixed << std::setprecision(2) << record.second.phase_progress << " "
-                              << std::setw(20) << (record.second.autopilot_engaged ? "true" : "false") << " "
-                              << std::setw(15) << record.second.autopilot_mode << " "
-                              << std::setw(20) << (record.second.auto_throttle_engaged ? "true" : "false") << " "
-                              << std::setw(15) << record.second.navigation_mode << " "
-                              << std::setw(15) << std::fixed << std::setprecision(2) << record.second.performance_index << " "
-                              << std::setw(15) << std::fixed << std::setprecision(2) << record.second.fuel_efficiency << " "
-                              << std::setw(15) << std::fixed << std::setprecision(2) << record.second.optimal_speed << " "
-                              << std::setw(15) << std::fixed << std::setprecision(2) << record.second.optimal_altitude << "\n";
+    }
+    finishFile(out, path);
+}
+
+void DataRecorder::writeTriggeredEventsCsv() const {
+    const std::string path = csvPath("triggered_events");
+    CsvExport::CsvFileWriter out(path);
+    requireOpen(out, path);
+    TimeIndex::TimeIndexBuilder index;
+    const int time_digits = csv_precision.get("triggered_events", "SimulationTime");
+
+    out.left();
+    writeHeader(out, {{"SimulationTime", 15}, {"StepNumber", 15}, {"EventCount", 15}, {"EventList", 200}});
+
+    // 添加强制调试日志
+    VFT_LOG_BRIEF("DataRecorder: 开始处理triggered_events.csv, triggered_event_buffer大小: {}", triggered_event_buffer.size());
+
+    // 获取所有时间步的事件映射
+    std::map<double, std::vector<VFT_SMF::GlobalSharedDataStruct::StandardEvent>> all_step_events;
+    if (!triggered_event_buffer.empty()) {
+        // 使用最后一条记录的事件库来获取所有时间步的事件
+        all_step_events = triggered_event_buffer.back().second.getStepEventsMap();
+
+        // 添加调试日志
+        VFT_LOG_BRIEF("DataRecorder获取到的step_events_map大小: {}, triggered_event_buffer大小: {}", all_step_events.size(), triggered_event_buffer.size());
+
+        for (const auto& [time, events] : all_step_events) {
+            VFT_LOG_BRIEF("时间步 {}s 有 {} 个事件", time, events.size());
         }
-        aircraft_logic_file.close();
-
-        std::ofstream pilot_logic_file(output_directory + "/pilot_logic.csv");
-        pilot_logic_file << std::left << std::setw(15) << "SimulationTime" << " "
-                       << std::setw(20) << "datasource" << " "
-                       << std::setw(20) << "decision_strategy" << " "
-                       << std::setw(15) << "risk_tolerance" << " "
-                       << std::setw(15) << "priority_task" << " "
-                       << std::setw(15) << "attention_focus" << " "
-                       << std::setw(15) << "mental_model" << " "
-                       << std::setw(20) << "situation_awareness" << " "
-                       << std::setw(15) << "behavior_pattern" << " "
-                       << std::setw(15) << "adaptability" << " "
-                       << std::setw(20) << "communication_style" << " "
-                       << std::setw(15) << "learning_rate" << " "
-                       << std::setw(20) << "performance_improvement" << "\n";
-        for (const auto& record : pilot_logic_buffer) {
-            pilot_logic_file << std::left << std::setw(15) << std::fixed << std::setprecision(2) << record.first << " "
-                           << std::setw(20) << record.second.datasource << " "
-                           << std::setw(20) << record.second.decision_strategy << " "
-                           << std::setw(15) << std::fixed << std::setprecision(2) << record.second.risk_tolerance << " "
-                           << std::setw(15) << record.second.priority_task << " "
-                           << std::setw(15) << record.second.attention_focus << " "
-                           << std::setw(15) << record.second.mental_model << " "
-                           << std::setw(20) << std::fixed << std::setprecision(2) << record.second.situation_awareness << " "
-                           << std::setw(15) << record.second.behavior_pattern << " "
-                           << std::setw(15) << std::fixed << std::setprecision(2) << record.second.adaptability << " "
-                           << std::setw(20) << record.second.communication_style << " "
-                           << std::setw(15) << std::fixed << std::setprecision(2) << record.second.learning_rate << " "
-                           << std::setw(20) << std::fixed << std::setprecision(2) << record.second.performance_improvement << "\n";
+    } else {
+        VFT_LOG_BRIEF("triggered_event_buffer为空！");
+    }
+
+    // 为每个时间步输出事件数据
+    // 计算需要输出的总步数：根据仿真时间和时间步长
+    uint64_t total_steps = 0;
+    if (!triggered_event_buffer.empty()) {
+        // 从最后一条记录的时间计算总步数
+        double max_time = triggered_event_buffer.back().first;
+        total_steps = static_cast<uint64_t>(max_time / 0.01) + 1;  // 向上取整
+    } else {
+        // 如果没有记录，使用默认值
+        total_steps = 1000;
+    }
+
+    for (uint64_t step = 0; step <= total_steps; step++) {
+        double time = static_cast<double>(step) * 0.01;  // 使用与事件监测线程相同的时间计算方法
+        uint64_t step_number = step + 1;
+
+        // 使用精确的时间匹配，避免浮点精度问题
+        auto it = all_step_events.find(time);
+        size_t event_count = 0;
+        std::string event_list = "[]";
+
+        if (it != all_step_events.end()) {
+            event_count = it->second.size();
+            event_list = triggered_event_buffer.back().second.generateEventListString(time);
+        } else {
+            // 不使用容差匹配，严格按精确时间输出，避免重复
         }
-        pilot_logic_file.close();
-
-        std::ofstream environment_logic_file(output_directory + "/environment_logic.csv");
-        environment_logic_file << std::left << std::setw(15) << "SimulationTime" << " "
-                             << std::setw(20) << "datasource" << " "
-                             << std::setw(15) << "weather_pattern" << " "
-                             << std::setw(15) << "weather_severity" << " "
-                             << std::setw(15) << "weather_trend" << " "
-                             << std::setw(20) << "terrain_complexity" << " "
-                             << std::setw(15) << "terrain_risk_level" << " "
-                             << std::setw(15) << "airspace_class" << " "
-                             << std::setw(20) << "airspace_restrictions" << " "
-                             << std::setw(15) << "time_of_day" << " "
-                             << std::setw(15) << "season" << " "
-                             << std::setw(20) << "daylight_availability" << "\n";
-        for (const auto& record : environment_logic_buffer) {
-            environment_logic_file << std::left << std::setw(15) << std::fixed << std::setprecision(2) << record.first << " "
-                                 << std::setw(20) << record.second.datasource << " "
-                                 << std::setw(15) << record.second.weather_pattern << " "
-                                 << std::setw(15) << std::fixed << std::setprecision(2) << record.second.weather_severity << " "
-                                 << std::setw(15) << record.second.weather_trend << " "
-                                 << std::setw(20) << std::fixed << std::setprecision(2) << record.second.terrain_complexity << " "
-                                 << std::setw(15) << std::fixed << std::setprecision(2) << record.second.terrain_risk_level << " "
-                                 << std::setw(15) << record.second.airspace_class << " "
-                                 << std::setw(20) << record.second.airspace_restrictions << " "
-                                 << std::setw(15) << record.second.time_of_day << " "
-                                 << std::setw(15) << record.second.season << " "
-                                 << std::setw(20) << record.second.daylight_availability << "\n";
+
+        index.onRow(time, out.offset());
+        out.number(time, time_digits, 15).raw(' ')
+           .integer(static_cast<int64_t>(step_number), 15).raw(' ')
+           .integer(static_cast<int64_t>(event_count), 15).raw(' ')
+           .text(event_list, 200).raw('\n');
+    }
+    finishFile(out, path);
+    index.write(TimeIndex::indexPathFor(path));
+}
+
+void DataRecorder::writeATCCommandCsv() const {
+    const std::string path = csvPath("atc_command");
+    CsvExport::CsvFileWriter out(path);
+    requireOpen(out, path);
+    TimeIndex::TimeIndexBuilder index;
+    const int time_digits = csv_precision.get("atc_command", "SimulationTime");
+
+    out.left();
+    writeHeader(out, {{"SimulationTime", 15}, {"datasource", 25}, {"clearance_granted", 20}, {"emergency_brake", 20}});
+    for (const auto& record : atc_command_buffer) {
+        index.onRow(record.first, out.offset());
+        out.number(record.first, time_digits, 15).raw(' ')
+           .text(record.second.datasource, 25).raw(' ')
+           .boolean(record.second.clearance_granted, 20).raw(' ')
+           .boolean(record.second.emergency_brake, 20).raw('\n');
+    }
+    finishFile(out, path);
+    index.write(TimeIndex::indexPathFor(path));
+}
+
+void DataRecorder::writePlanedControllersCsv() const {
+    const std::string path = csvPath("planed_controllers");
+    CsvExport::CsvFileWriter out(path);
+    requireOpen(out, path);
+    const int time_digits = csv_precision.get("planed_controllers", "SimulationTime");
+
+    out.left();
+    writeHeader(out, {{"SimulationTime", 15}, {"datasource", 20}, {"controller_name", 40}, {"TriggerEvent_name", 40},
+                      {"controller_type", 30}, {"description", 50}, {"termination_condition", 25}});
+    // 计划控制器库是静态的，只需要输出一次（取第一条记录）
+    if (!planed_controllers_buffer.empty()) {
+        const auto& [time, library] = *planed_controllers_buffer.begin();
+        for (const auto& controller : library.getAllControllers()) {
+            out.number(time, time_digits, 15).raw(' ')
+               .text(library.datasource, 20).raw(' ')
+               .text(controller.controller_name, 40).raw(' ')
+               .text(controller.event_name, 40).raw(' ')
+               .text(controller.controller_type, 30).raw(' ')
+               .text(controller.description, 50).raw(' ')
+               .text(controller.termination_condition, 25).raw('\n');
         }
-        environment_logic_file.close();
-
-        std::ofstream atc_logic_file(output_directory + "/atc_logic.csv");
-        atc_logic_file << std::left << std::setw(15) << "SimulationTime" << " "
-                      << std::setw(20) << "datasource" << " "
-                      << std::setw(20) << "control_strategy" << " "
-                      << std::setw(20) << "separation_standards" << " "
-                      << std::setw(25) << "traffic_flow_management" << " "
-                      << std::setw(25) << "conflict_resolution_strategy" << " "
-                      << std::setw(25) << "conflict_detection_threshold" << " "
-                      << std::setw(20) << "communication_protocol" << " "
-                      << std::setw(20) << "communication_priority" << " "
-                      << std::setw(15) << "system_mode" << " "
-                      << std::setw(15) << "automation_level" << "\n";
-        for (const auto& record : atc_logic_buffer) {
-            atc_logic_file << std::left << std::setw(15) << std::fixed << std::setprecision(2) << record.first << " "
-                          << std::setw(20) << record.second.datasource << " "
-                          << std::setw(20) << record.second.control_strategy << " "
-                          << std::setw(20) << record.second.separation_standards << " "
-                          << std::setw(25) << record.second.traffic_flow_management << " "
-                          << std::setw(25) << record.second.conflict_resolution_strategy << " "
-                          << std::setw(25) << std::fixed << std::setprecision(2) << record.second.conflict_detection_threshold << " "
-                          << std::setw(20) << record.second.communication_protocol << " "
-                          << std::setw(20) << record.second.communication_priority << " "
-                          << std::setw(15) << record.second.system_mode << " "
-                          << std::setw(15) << std::fixed << std::setprecision(2) << record.second.automation_level << "\n";
+    }
+    finishFile(out, path);
+}
+
+void DataRecorder::writeControllerExecutionStatusCsv() const {
+    const std::string path = csvPath("controller_execution_status");
+    CsvExport::CsvFileWriter out(path);
+    requireOpen(out, path);
+    TimeIndex::TimeIndexBuilder index;
+    const int time_digits = csv_precision.get("controller_execution_status", "SimulationTime");
+
+    // 获取所有控制器名称（从计划控制器库中）
+    std::vector<std::string> all_controller_names;
+    if (!planed_controllers_buffer.empty()) {
+        for (const auto& controller : planed_controllers_buffer.begin()->second.getAllControllers()) {
+            all_controller_names.push_back(controller.controller_name);
         }
-        atc_logic_file.close();
-
-        std::ofstream planned_event_file(output_directory + "/planned_events.csv");
-        planned_event_file << std::left 
-                        << std::setw(20) << "datasource" << " "
-                         << std::setw(20) << "event_id" << " "
-                         << std::setw(35) << "event_name" << " "
-                         << std::setw(50) << "description" << " "
-                         << std::setw(20) << "source_agent" << " "
-                         << std::setw(20) << "is_triggered" << "\n";
-        // 计划事件库是静态的，只需要输出一次（取第一条记录）
-        if (!planned_event_buffer.empty()) {
-            auto events = planned_event_buffer.begin()->second.getPlannedEvents();
-            for (const auto& event : events) {
-                planned_event_file << std::left << std::setw(20) << planned_event_buffer.begin()->second.datasource << " "
-                                 << std::setw(20) << event.event_id << " "
-                                 << std::setw(35) << event.event_name << " "
-                                 << std::setw(50) << event.description << " "
-                                 << std::setw(20) << event.source_agent << " "
-                                 << std::setw(20) << (event.is_triggered ? "true" : "false") << "\n";
-            }
+    }
+
+    // 写入表头 - 使用固定宽度，左对齐
+    out.left();
+    out.text("SimulationTime", 15);
+    for (const auto& controller_name : all_controller_names) {
+        out.raw(' ').text(controller_name, 25);
+    }
+    out.raw('\n');
+
+    // 写入数据 - 使用固定宽度，左对齐
+    for (const auto& record : controller_execution_status_buffer) {
+        index.onRow(record.first, out.offset());
+        out.number(record.first, time_digits, 15);
+        for (const auto& controller_name : all_controller_names) {
+            out.raw(' ').text(record.second.getControllerStatus(controller_name) ? "1" : "0", 25);
         }
-        planned_event_file.close();
+        out.raw('\n');
+    }
+    finishFile(out, path);
+    index.write(TimeIndex::indexPathFor(path));
+}
 
-        std::ofstream triggered_event_file(output_directory + "/triggered_events.csv");
-        triggered_event_file << std::left << std::setw(15) << "SimulationTime" << " "
-                           << std::setw(15) << "StepNumber" << " "
-                           << std::setw(15) << "EventCount" << " "
-                           << std::setw(200) << "EventList" << "\n";
-        
-        // 添加强制调试日志
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-            "DataRecorder: 开始处理triggered_events.csv, triggered_event_buffer大小: " + 
-            std::to_string(triggered_event_buffer.size()));
-        
-        // 获取所有时间步的事件映射
-        std::map<double, std::vector<VFT_SMF::GlobalSharedDataStruct::StandardEvent>> all_step_events;
-        if (!triggered_event_buffer.empty()) {
-            // 使用最后一条记录的事件库来获取所有时间步的事件
-            all_step_events = triggered_event_buffer.back().second.getStepEventsMap();
-            
-            // 添加调试日志
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                "DataRecorder获取到的step_events_map大小: " + std::to_string(all_step_events.size()) + 
-                ", triggered_event_buffer大小: " + std::to_string(triggered_event_buffer.size()));
-            
-            for (const auto& [time, events] : all_step_events) {
-                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, 
-                    "时间步 " + std::to_string(time) + "s 有 " + std::to_string(events.size()) + " 个事件");
-            }
-        } else {
-            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "triggered_event_buffer为空！");
+void DataRecorder::writeEventQueueCsv() const {
+    const std::string path = csvPath("event_queue");
+    CsvExport::CsvFileWriter out(path);
+    requireOpen(out, path);
+    const int time_digits = csv_precision.get("event_queue", "SimulationTime");
+    const int trigger_time_digits = csv_precision.get("event_queue", "trigger_time");
+
+    out.left();
+    writeHeader(out, {{"SimulationTime", 15}, {"datasource", 20}, {"queue_size", 15}, {"processed_count", 15},
+                      {"pending_events", 50}});
+
+    if (!event_queue_buffer.empty()) {
+        const auto& [time, queue] = event_queue_buffer.back();
+        // 展平待处理事件用于可读性输出（仅输出前N个以避免超长）
+        const size_t max_list = 10;
+        auto pending_list = queue.getPendingEvents();
+        std::string pending_events = "[";
+        for (size_t i = 0; i < pending_list.size() && i < max_list; ++i) {
+            if (i > 0) pending_events += ",";
+            pending_events += pending_list[i].event.event_name;
+            pending_events += "@";
+            pending_events += CsvExport::formatNumber(pending_list[i].trigger_time, trigger_time_digits);
         }
-        
-        // 为每个时间步输出事件数据
-        // 计算需要输出的总步数：根据仿真时间和时间步长
-        uint64_t total_steps = 0;
-        if (!triggered_event_buffer.empty()) {
-            // 从最后一条记录的时间计算总步数
-            double max_time = triggered_event_buffer.back().first;
-            total_steps = static_cast<uint64_t>(max_time / 0.01) + 1;  // 向上取整
-        } else {
-            // 如果没有记录，使用默认值
-            total_steps = 1000;
+        if (pending_list.size() > max_list) {
+            pending_events += ",...";
         }
-        
-        for (uint64_t step = 0; step <= total_steps; step++) {
-            double time = static_cast<double>(step) * 0.01;  // 使用与事件监测线程相同的时间计算方法
-            uint64_t step_number = step + 1;
-            
-            // 使用精确的时间匹配，避免浮点精度问题
-            auto it = all_step_events.find(time);
-            size_t event_count = 0;
-            std::string event_list = "[]";
-            
-            if (it != all_step_events.end()) {
-                event_count = it->second.size();
-                event_list = triggered_event_buffer.back().second.generateEventListString(time);
-            } else {
-                // 不使用容差匹配，严格按精确时间输出，避免重复
-            }
-            
-            triggered_event_file << std::left << std::setw(15) << std::fixed << std::setprecision(2) << time << " "
-                               << std::setw(15) << step_number << " "
-                               << std::setw(15) << event_count << " "
-                               << std::setw(200) << event_list << "\n";
+        pending_events += "]";
+
+        out.number(time, time_digits, 15).raw(' ')
+           .text(queue.datasource, 20).raw(' ')
+           .integer(static_cast<int64_t>(queue.getQueueSize()), 15).raw(' ')
+           .integer(static_cast<int64_t>(queue.getProcessedCount()), 15).raw(' ')
+           .text(pending_events, 50).raw('\n');
+    }
+    finishFile(out, path);
+}
+
+void DataRecorder::flushAllBuffers() {
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(buffer_mutex);
+    
+    try {
+        // 各模块文件相互独立，持锁期间缓冲区只读，每个文件由一个线程写出
+        std::vector<std::function<void()>> tasks = {
+            [this]() { writeFlightPlanCsv(); },
+            [this]() { writeATCStateCsv(); },
+            [this]() { writeAircraftLogicCsv(); },
+            [this]() { writePilotLogicCsv(); },
+            [this]() { writeEnvironmentLogicCsv(); },
+            [this]() { writeATCLogicCsv(); },
+            [this]() { writePlannedEventsCsv(); },
+            [this]() { writeTriggeredEventsCsv(); },
+            [this]() { writeATCCommandCsv(); },
+            [this]() { writePlanedControllersCsv(); },
+            [this]() { writeControllerExecutionStatusCsv(); },
+            [this]() { writeEventQueueCsv(); },
+        };
+        if (writesCsv()) {
+            tasks.push_back([this]() { writeAircraftFlightStateCsv(); });
+            tasks.push_back([this]() { writeAircraftSystemStateCsv(); });
+            tasks.push_back([this]() { writePilotStateCsv(); });
+            tasks.push_back([this]() { writeEnvironmentStateCsv(); });
+            tasks.push_back([this]() { writeAircraftNetForceCsv(); });
         }
-        triggered_event_file.close();
-
-        std::ofstream atc_command_file(output_directory + "/atc_command.csv");
-        atc_command_file << std::left << std::setw(15) << "SimulationTime" << " "
-                       << std::setw(25) << "datasource" << " "
-                       << std::setw(20) << "clearance_granted" << " "
-                       << std::setw(20) << "emergency_brake" << "\n";
-        for (const auto& record : atc_command_buffer) {
-            atc_command_file << std::left << std::setw(15) << std::fixed << std::setprecision(2) << record.first << " "
-                           << std::setw(25) << record.second.datasource << " "
-                           << std::setw(20) << (record.second.clearance_granted ? "true" : "false") << " "
-                           << std::setw(20) << (record.second.emergency_brake ? "true" : "false") << "\n";
+        if (writesCompressed()) {
+            tasks.push_back([this]() { writeCompressedChannels(); });
         }
-        atc_command_file.close();
-
-        // 输出计划控制器数据
-        std::ofstream planed_controllers_file(output_directory + "/planed_controllers.csv");
-        planed_controllers_file << std::left << std::setw(15) << "SimulationTime" << " "
-                              << std::setw(20) << "datasource" << " "
-                              << std::setw(40) << "controller_name" << " "
-                              << std::setw(40) << "TriggerEvent_name" << " "
-                              << std::setw(30) << "controller_type" << " "
-                              << std::setw(50) << "description" << " "
-                              << std::setw(25) << "termination_condition" << "\n";
-        
-        // 计划控制器库是静态的，只需要输出一次（取第一条记录）
-        if (!planed_controllers_buffer.empty()) {
-            const auto& controllers = planed_controllers_buffer.begin()->second.getAllControllers();
-            for (const auto& controller : controllers) {
-                planed_controllers_file << std::left << std::setw(15) << std::fixed << std::setprecision(2) << planed_controllers_buffer.begin()->first << " "
-                                      << std::setw(20) << planed_controllers_buffer.begin()->second.datasource << " "
-                                      << std::setw(40) << controller.controller_name << " "
-                                      << std::setw(40) << controller.event_name << " "
-                                      << std::setw(30) << controller.controller_type << " "
-                                      << std::setw(50) << controller.description << " "
-                                      << std::setw(25) << controller.termination_condition << "\n";
-            }
+
+        const auto errors = CsvExport::runParallel(tasks);
+        for (const auto& error : errors) {
+            VFT_LOG_BRIEF("数据记录器输出文件失败: {}", error);
         }
-        planed_controllers_file.close();
 
-        // 输出控制器执行状态跟踪数据
-        std::ofstream controller_execution_status_file(output_directory + "/controller_execution_status.csv");
+        pending_records.store(0, std::memory_order_relaxed);
+        flush_count.fetch_add(1, std::memory_order_relaxed);
+        VFT_LOG_BRIEF("数据记录器已将所有17个数据模块输出到文件，输出目录: {}", output_directory);
         
-        // 获取所有控制器名称（从计划控制器库中）
-        std::vector<std::string> all_controller_names;
-        if (!planed_controllers_buffer.empty()) {
-            const auto& controllers = planed_controllers_buffer.begin()->second.getAllControllers();
-            for (const auto& controller : controllers) {
-                all_controller_names.push_back(controller.controller_name);
-            }
+    } catch (const std::exception& e) {
+        VFT_LOG_BRIEF("数据记录器输出文件失败: {}", e.what());
+    }
+}
+
+void DataRecorder::writeCompressedChannels() {
+    using VFT_SMF::TimeSeriesCodec::CompressedChannelWriter;
+    bool all_open = true;
+
+    // 飞行状态：全部数值字段（布尔量记为0/1）+ 累计滑行距离
+    {
+        const std::string path = output_directory + "/aircraft_flight_state.vts";
+        CompressedChannelWriter writer(path, {
+            "latitude", "longitude", "altitude", "heading", "pitch", "roll",
+            "airspeed", "groundspeed", "vertical_speed",
+            "pitch_rate", "roll_rate", "yaw_rate",
+            "longitudinal_accel", "lateral_accel", "vertical_accel",
+            "landing_gear_deployed", "flaps_deployed", "spoilers_deployed", "brake_pressure",
+            "center_of_gravity", "wing_loading", "distance_m"});
+        all_open = checkOpen(writer, path) && all_open;
+        FlightDynamics::GroundDistance distance;
+        std::vector<double> row;
+        for (const auto& record : aircraft_flight_state_buffer) {
+            const auto& s = record.second;
+            const double cumulative_distance_m = distance.add(s.latitude, s.longitude);
+            row = {s.latitude, s.longitude, s.altitude, s.heading, s.pitch, s.roll,
+                   s.airspeed, s.groundspeed, s.vertical_speed,
+                   s.pitch_rate, s.roll_rate, s.yaw_rate,
+                   s.longitudinal_accel, s.lateral_accel, s.vertical_accel,
+                   s.landing_gear_deployed ? 1.0 : 0.0, s.flaps_deployed ? 1.0 : 0.0,
+                   s.spoilers_deployed ? 1.0 : 0.0, s.brake_pressure,
+                   s.center_of_gravity, s.wing_loading, cumulative_distance_m};
+            writer.append(record.first, row);
         }
-        
-        // 写入表头 - 使用固定宽度，左对齐
-        controller_execution_status_file << std::left << std::setw(15) << "SimulationTime";
-        for (const auto& controller_name : all_controller_names) {
-            controller_execution_status_file << " " << std::setw(25) << controller_name;
+    }
+
+    {
+        const std::string path = output_directory + "/aircraft_system_state.vts";
+        CompressedChannelWriter writer(path, {
+            "current_mass", "current_fuel", "current_center_of_gravity", "current_brake_pressure",
+            "current_landing_gear_deployed", "current_flaps_deployed", "current_spoilers_deployed",
+            "current_aileron_deflection", "current_elevator_deflection", "current_rudder_deflection",
+            "current_throttle_position", "current_engine_rpm",
+            "left_engine_failed", "left_engine_rpm", "right_engine_failed", "right_engine_rpm",
+            "brake_efficiency"});
+        all_open = checkOpen(writer, path) && all_open;
+        std::vector<double> row;
+        for (const auto& record : aircraft_system_state_buffer) {
+            const auto& s = record.second;
+            row = {s.current_mass, s.current_fuel, s.current_center_of_gravity, s.current_brake_pressure,
+                   s.current_landing_gear_deployed, s.current_flaps_deployed, s.current_spoilers_deployed,
+                   s.current_aileron_deflection, s.current_elevator_deflection, s.current_rudder_deflection,
+                   s.current_throttle_position, s.current_engine_rpm,
+                   s.left_engine_failed ? 1.0 : 0.0, s.left_engine_rpm,
+                   s.right_engine_failed ? 1.0 : 0.0, s.right_engine_rpm,
+                   s.brake_efficiency};
+            writer.append(record.first, row);
         }
-        controller_execution_status_file << "\n";
-        
-        // 写入数据 - 使用固定宽度，左对齐
-        for (const auto& record : controller_execution_status_buffer) {
-            controller_execution_status_file << std::left << std::setw(15) << std::fixed << std::setprecision(2) << record.first;
-            for (const auto& controller_name : all_controller_names) {
-                bool is_running = record.second.getControllerStatus(controller_name);
-                controller_execution_status_file << " " << std::setw(25) << (is_running ? "1" : "0");
-            }
-            controller_execution_status_file << "\n";
+    }
+
+    {
+        const std::string path = output_directory + "/pilot_state.vts";
+        CompressedChannelWriter writer(path, {"attention_level", "skill_level"});
+        all_open = checkOpen(writer, path) && all_open;
+        std::vector<double> row;
+        for (const auto& record : pilot_state_buffer) {
+            row = {record.second.attention_level, record.second.skill_level};
+            writer.append(record.first, row);
         }
-        controller_execution_status_file.close();
-
-        // 输出事件队列event_queue.csv
-        {
-            std::ofstream event_queue_file(output_directory + "/event_queue.csv");
-            event_queue_file << std::left << std::setw(15) << "SimulationTime" << " "
-                              << std::setw(20) << "datasource" << " "
-                              << std::setw(15) << "queue_size" << " "
-                              << std::setw(15) << "processed_count" << " "
-                              << std::setw(50) << "pending_events" << "\n";
-
-            if (!event_queue_buffer.empty()) {
-                const auto& [time, queue] = event_queue_buffer.back();
-                // 展平待处理事件用于可读性输出（仅输出前N个以避免超长）
-                const size_t max_list = 10;
-                auto pending_list = queue.getPendingEvents();
-                std::stringstream ss;
-                ss << "[";
-                for (size_t i = 0; i < pending_list.size() && i < max_list; ++i) {
-                    if (i > 0) ss << ",";
-                    ss << pending_list[i].event.event_name << "@" << std::fixed << std::setprecision(2) << pending_list[i].trigger_time;
-                }
-                if (pending_list.size() > max_list) {
-                    ss << ",...";
-                }
-                ss << "]";
-
-                event_queue_file << std::left << std::setw(15) << std::fixed << std::setprecision(2) << time << " "
-                                  << std::setw(20) << queue.datasource << " "
-                                  << std::setw(15) << queue.getQueueSize() << " "
-                                  << std::setw(15) << queue.getProcessedCount() << " "
-                                  << std::setw(50) << ss.str() << "\n";
-            }
+    }
 
-            event_queue_file.close();
+    {
+        const std::string path = output_directory + "/environment_state.vts";
+        CompressedChannelWriter writer(path, {
+            "runway_length", "runway_width", "friction_coefficient", "air_density",
+            "wind_speed", "wind_direction", "runway_elevation"});
+        all_open = checkOpen(writer, path) && all_open;
+        std::vector<double> row;
+        for (const auto& record : environment_state_buffer) {
+            const auto& s = record.second;
+            row = {s.runway_length, s.runway_width, s.friction_coefficient, s.air_density,
+                   s.wind_speed, s.wind_direction, s.runway_elevation};
+            writer.append(record.first, row);
         }
+    }
 
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "数据记录器已将所有17个数据模块输出到文件，输出目录: " + output_directory);
-        
-    } catch (const std::exception& e) {
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "数据记录器输出文件失败: " + std::string(e.what()));
+    {
+        const std::string path = output_directory + "/aircraft_net_force.vts";
+        CompressedChannelWriter writer(path, {
+            "longitudinal_force", "lateral_force", "vertical_force",
+            "roll_moment", "pitch_moment", "yaw_moment",
+            "thrust_force", "drag_force", "lift_force", "weight_force", "side_force"});
+        all_open = checkOpen(writer, path) && all_open;
+        std::vector<double> row;
+        for (const auto& record : aircraft_net_force_buffer) {
+            const auto& s = record.second;
+            row = {s.longitudinal_force, s.lateral_force, s.vertical_force,
+                   s.roll_moment, s.pitch_moment, s.yaw_moment,
+                   s.thrust_force, s.drag_force, s.lift_force, s.weight_force, s.side_force};
+            writer.append(record.first, row);
+        }
+    }
+
+    if (all_open) {
+        VFT_LOG_BRIEF("数据记录器已输出压缩通道文件(.vts)，输出目录: {}", output_directory);
     }
 }
 
 void DataRecorder::clearAllBuffers() {
-    std::lock_guard<std::mutex> lock(buffer_mutex);
+    std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(buffer_mutex);
     
     flight_plan_buffer.clear();
     aircraft_flight_state_buffer.clear();
@@ -809,8 +1135,9 @@ void DataRecorder::clearAllBuffers() {
     atc_command_buffer.clear();
     planed_controllers_buffer.clear();
     event_queue_buffer.clear();
+    pending_records.store(0, std::memory_order_relaxed);
     
-    VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "数据记录器缓冲区已清空");
+    VFT_LOG_BRIEF("数据记录器缓冲区已清空");
 }
 
 void DataRecorder::clearOutputFiles() {
@@ -833,7 +1160,13 @@ void DataRecorder::clearOutputFiles() {
             "atc_command.csv",
             "planed_controllers.csv",
             "controller_execution_status.csv",
-            "event_queue.csv"
+            "event_queue.csv",
+            // 压缩通道文件
+            "aircraft_flight_state.vts",
+            "aircraft_system_state.vts",
+            "pilot_state.vts",
+            "environment_state.vts",
+            "aircraft_net_force.vts"
         };
         
         for (const auto& file : csv_files) {
@@ -841,6 +1174,11 @@ void DataRecorder::clearOutputFiles() {
             if (std::filesystem::exists(file_path)) {
                 std::filesystem::remove(file_path);
             }
+            // 对应的稀疏时间索引文件
+            std::string index_path = TimeIndex::indexPathFor(file_path);
+            if (std::filesystem::exists(index_path)) {
+                std::filesystem::remove(index_path);
+            }
         }
         
         // 清理日志文件
@@ -856,9 +1194,9 @@ void DataRecorder::clearOutputFiles() {
             }
         }
         
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "已清理输出目录中的旧文件: " + output_directory);
+        VFT_LOG_BRIEF("已清理输出目录中的旧文件: {}", output_directory);
     } catch (const std::exception& e) {
-        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "清理输出文件时出错: " + std::string(e.what()));
+        VFT_LOG_BRIEF("清理输出文件时出错: {}", e.what());
     }
 }
 
@@ -8,7 +8,9 @@
 #pragma once
 
 #include "../../E_GlobalSharedDataSpace/GlobalSharedDataStruct.hpp"
+#include "../../E_FlightDynamics/LocalTangentFrame.hpp"
 #include "../LogAndData/Logger.hpp"
+#include "CsvExport.hpp"
 
 // 前向声明
 namespace VFT_SMF {
@@ -21,10 +23,39 @@ namespace VFT_SMF {
 #include <string>
 #include <fstream>
 #include <mutex>
+#include <atomic>
 #include <memory>
 
 namespace VFT_SMF {
 
+/**
+ * @brief 数据记录输出格式
+ */
+enum class RecordFormat {
+    CSV,         ///< 仅输出定宽文本CSV（默认）
+    Compressed,  ///< 数值型状态模块输出为无损压缩通道文件(.vts)，其余模块仍为CSV
+    Both         ///< CSV与压缩通道文件同时输出
+};
+
+/**
+ * @brief 从配置字符串解析输出格式（"csv" / "compressed" / "both"），未知值回退为CSV
+ */
+inline RecordFormat parseRecordFormat(const std::string& format) {
+    if (format == "compressed") return RecordFormat::Compressed;
+    if (format == "both") return RecordFormat::Both;
+    return RecordFormat::CSV;
+}
+
+/**
+ * @brief 数据记录器运行计数快照
+ */
+struct DataRecorderCounters {
+    uint64_t records = 0;           ///< 已记录条数（各模块合计）
+    uint64_t pending_records = 0;   ///< 缓冲区中尚未写出的条数（积压）
+    uint64_t evicted_records = 0;   ///< 缓冲区满时丢弃的最旧记录条数
+    uint64_t flushes = 0;           ///< 已完成的写出次数
+};
+
 class DataRecorder {
 private:
     // 数据缓冲区 - 对应17个数据模块
@@ -49,7 +80,50 @@ private:
     std::string output_directory;
     int buffer_size;
     bool is_initialized;
-    mutable std::mutex buffer_mutex;
+    RecordFormat record_format;
+    CsvExport::ColumnPrecision csv_precision;
+    mutable VFT_SMF::SimManage::InstrumentedMutex buffer_mutex{"DataRecorder.buffer"};
+    VFT_SMF::FlightDynamics::GeodeticResolver geodetic_resolver;   ///< 采样时换算飞行状态经纬度（在 buffer_mutex 内使用）
+
+    // 运行计数（在 buffer_mutex 内更新，指标端点无锁读取）
+    std::atomic<uint64_t> records_total{0};
+    std::atomic<uint64_t> pending_records{0};
+    std::atomic<uint64_t> evicted_records{0};
+    std::atomic<uint64_t> flush_count{0};
+
+    void noteRecord(bool evicted) {
+        records_total.fetch_add(1, std::memory_order_relaxed);
+        if (evicted) {
+            evicted_records.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            pending_records.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // 将数值型状态模块写为压缩通道文件（调用方需持有buffer_mutex）
+    void writeCompressedChannels();
+    bool writesCsv() const { return record_format != RecordFormat::Compressed; }
+    bool writesCompressed() const { return record_format != RecordFormat::CSV; }
+
+    // 各模块CSV写出（调用方需持有buffer_mutex；只读缓冲区，可在不同线程中并行执行，失败时抛出异常）
+    std::string csvPath(const char* module) const;
+    void writeFlightPlanCsv() const;
+    void writeAircraftFlightStateCsv() const;
+    void writeAircraftSystemStateCsv() const;
+    void writePilotStateCsv() const;
+    void writeEnvironmentStateCsv() const;
+    void writeATCStateCsv() const;
+    void writeAircraftNetForceCsv() const;
+    void writeAircraftLogicCsv() const;
+    void writePilotLogicCsv() const;
+    void writeEnvironmentLogicCsv() const;
+    void writeATCLogicCsv() const;
+    void writePlannedEventsCsv() const;
+    void writeTriggeredEventsCsv() const;
+    void writeATCCommandCsv() const;
+    void writePlanedControllersCsv() const;
+    void writeControllerExecutionStatusCsv() const;
+    void writeEventQueueCsv() const;
 
 public:
     DataRecorder(const std::string& output_dir = "output/simulation", int buf_size = 1000);
@@ -58,6 +132,9 @@ public:
     bool initialize();
     void setBufferSize(int size);
     void setOutputDirectory(const std::string& dir);
+    void setRecordFormat(RecordFormat format) { record_format = format; }
+    /// CSV数值列精度（默认全部2位小数）
+    void setCsvPrecision(const CsvExport::ColumnPrecision& precision) { csv_precision = precision; }
     
     // 记录17个数据模块的方法
     void recordFlightPlanData(double simulation_time, const VFT_SMF::GlobalSharedDataStruct::FlightPlanData& data);
@@ -86,14 +163,29 @@ public:
     bool isInitialized() const { return is_initialized; }
     int getBufferSize() const { return buffer_size; }
     std::string getOutputDirectory() const { return output_directory; }
+    RecordFormat getRecordFormat() const { return record_format; }
+
+    /**
+     * @brief 获取运行计数（不加锁，供指标端点采集）
+     */
+    DataRecorderCounters getCounters() const {
+        DataRecorderCounters counters;
+        counters.records = records_total.load(std::memory_order_relaxed);
+        counters.pending_records = pending_records.load(std::memory_order_relaxed);
+        counters.evicted_records = evicted_records.load(std::memory_order_relaxed);
+        counters.flushes = flush_count.load(std::memory_order_relaxed);
+        return counters;
+    }
 };
 
 // 全局数据记录器实例
 inline std::unique_ptr<DataRecorder> globalDataRecorder = nullptr;
 
 // 初始化全局数据记录器
-inline void initializeGlobalDataRecorder(const std::string& output_directory = "output/simulation", int buffer_size = 1000) {
+inline void initializeGlobalDataRecorder(const std::string& output_directory = "output/simulation", int buffer_size = 1000,
+                                         RecordFormat record_format = RecordFormat::CSV) {
     globalDataRecorder = std::make_unique<DataRecorder>(output_directory, buffer_size);
+    globalDataRecorder->setRecordFormat(record_format);
     if (!globalDataRecorder->initialize()) {
         throw std::runtime_error("Failed to initialize global data recorder");
     }
@@ -0,0 +1,220 @@
+#ifndef LOG_RECORD_HPP
+#define LOG_RECORD_HPP
+
+/**
+ * @file LogRecord.hpp
+ * @brief 延迟格式化日志记录
+ * @details 调用方只把格式串指针与参数的二进制值写入定长记录（无格式化、通常无堆分配），
+ *          由 Logger 的写线程按 "{}" 占位符依次替换参数后输出。
+ *          - 数值、bool、枚举：按值拷贝，格式与 std::to_string 一致；
+ *          - 字符串（std::string / std::string_view / const char*）：拷贝字节；
+ *            全部参数放不进记录时字符串改为堆上副本，由写线程释放。
+ *          格式串必须具有静态存储期（字符串字面量）。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace VFT_SMF {
+
+enum class LogLevel {
+    Brief,
+    Detail
+};
+
+namespace LogFormat {
+
+    constexpr size_t RECORD_PAYLOAD_SIZE = 224;   ///< 单条记录的参数区字节数
+
+    /**
+     * @brief 数值类参数（算术类型与枚举）
+     */
+    template<typename T>
+    struct ArgCodec {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                      "延迟日志参数只支持数值、枚举与字符串");
+
+        static constexpr size_t MAX_ENCODED_SIZE = sizeof(T);
+
+        static size_t inlineSize(const T&) { return sizeof(T); }
+
+        static unsigned char* encode(unsigned char* out, const T& value, bool) {
+            std::memcpy(out, &value, sizeof(T));
+            return out + sizeof(T);
+        }
+
+        static const unsigned char* decode(const unsigned char* in, std::string& out) {
+            T value;
+            std::memcpy(&value, in, sizeof(T));
+            append(value, out);
+            return in + sizeof(T);
+        }
+
+    private:
+        static void append(T value, std::string& out) {
+            if constexpr (std::is_enum<T>::value) {
+                out += std::to_string(static_cast<std::underlying_type_t<T>>(value));
+            } else if constexpr (std::is_same<T, bool>::value) {
+                out += value ? '1' : '0';
+            } else if constexpr (std::is_same<T, char>::value) {
+                out += value;
+            } else if constexpr (std::is_floating_point<T>::value) {
+                char buffer[64];
+                const int length = std::snprintf(buffer, sizeof(buffer), "%f", static_cast<double>(value));
+                if (length > 0) out.append(buffer, static_cast<size_t>(length) < sizeof(buffer) ? static_cast<size_t>(length) : sizeof(buffer) - 1);
+            } else {
+                out += std::to_string(value);
+            }
+        }
+    };
+
+    /**
+     * @brief 字符串类参数：[uint32 长度][uint8 是否堆上副本][字节 或 std::string*]
+     */
+    struct StringCodec {
+        static constexpr size_t HEADER_SIZE = sizeof(uint32_t) + 1;
+        static constexpr size_t MAX_ENCODED_SIZE = HEADER_SIZE + sizeof(std::string*);
+
+        static size_t inlineSize(std::string_view text) { return HEADER_SIZE + text.size(); }
+
+        static unsigned char* encode(unsigned char* out, std::string_view text, bool inline_strings) {
+            const uint32_t length = static_cast<uint32_t>(text.size());
+            std::memcpy(out, &length, sizeof(length));
+            out += sizeof(length);
+            *out++ = inline_strings ? 0 : 1;
+            if (inline_strings) {
+                std::memcpy(out, text.data(), text.size());
+                return out + text.size();
+            }
+            std::string* copy = new std::string(text);
+            std::memcpy(out, &copy, sizeof(copy));
+            return out + sizeof(copy);
+        }
+
+        static const unsigned char* decode(const unsigned char* in, std::string& out) {
+            uint32_t length = 0;
+            std::memcpy(&length, in, sizeof(length));
+            in += sizeof(length);
+            const bool on_heap = *in++ != 0;
+            if (!on_heap) {
+                out.append(reinterpret_cast<const char*>(in), length);
+                return in + length;
+            }
+            std::string* copy = nullptr;
+            std::memcpy(&copy, in, sizeof(copy));
+            out += *copy;
+            delete copy;
+            return in + sizeof(copy);
+        }
+    };
+
+    template<>
+    struct ArgCodec<std::string> : StringCodec {};
+
+    template<>
+    struct ArgCodec<std::string_view> : StringCodec {};
+
+    template<>
+    struct ArgCodec<const char*> : StringCodec {
+        static size_t inlineSize(const char* text) { return StringCodec::inlineSize(view(text)); }
+        static unsigned char* encode(unsigned char* out, const char* text, bool inline_strings) {
+            return StringCodec::encode(out, view(text), inline_strings);
+        }
+    private:
+        static std::string_view view(const char* text) { return text ? std::string_view(text) : std::string_view("(null)"); }
+    };
+
+    template<>
+    struct ArgCodec<char*> : ArgCodec<const char*> {};
+
+    /**
+     * @brief 参数在记录中的存储类型（字符数组按 const char* 处理）
+     */
+    template<typename T>
+    using StoredType = std::conditional_t<std::is_array<std::remove_reference_t<T>>::value,
+                                          const std::remove_extent_t<std::remove_reference_t<T>>*,
+                                          std::decay_t<T>>;
+
+    /**
+     * @brief 一条待写出的日志
+     */
+    struct LogRecord {
+        using FormatFunction = void (*)(const char* format, const unsigned char* payload, std::string& out);
+
+        LogLevel level = LogLevel::Brief;       ///< 输出时标注的级别
+        bool brief_route = true;                ///< true: brief + detail + 控制台；false: 仅 detail
+        uint16_t payload_size = 0;
+        uint64_t thread_id = 0;
+        int64_t timestamp_us = 0;               ///< system_clock 微秒
+        const char* format = nullptr;
+        FormatFunction format_function = nullptr;
+        unsigned char payload[RECORD_PAYLOAD_SIZE];
+    };
+
+    template<typename T>
+    const unsigned char* formatNext(const char*& cursor, const unsigned char* payload, std::string& out) {
+        const char* placeholder = std::strstr(cursor, "{}");
+        if (placeholder == nullptr) {
+            // 占位符少于参数：多余参数以空格分隔追加在末尾
+            out += cursor;
+            cursor += std::strlen(cursor);
+            out += ' ';
+        } else {
+            out.append(cursor, static_cast<size_t>(placeholder - cursor));
+            cursor = placeholder + 2;
+        }
+        return ArgCodec<T>::decode(payload, out);
+    }
+
+    /**
+     * @brief 写线程一侧：按格式串展开参数（释放堆上的字符串副本）
+     */
+    template<typename... Args>
+    void formatRecord(const char* format, const unsigned char* payload, std::string& out) {
+        const char* cursor = format;
+        ((payload = formatNext<Args>(cursor, payload, out)), ...);
+        (void)payload;
+        out += cursor;
+    }
+
+    /**
+     * @brief 调用方一侧：把参数写入记录（Args 为退化后的参数类型）
+     */
+    template<typename... Args>
+    void captureRecord(LogRecord& record, const char* format, const Args&... args) {
+        static_assert((ArgCodec<Args>::MAX_ENCODED_SIZE + ... + size_t(0)) <= RECORD_PAYLOAD_SIZE,
+                      "延迟日志参数过多");
+        const size_t inline_size = (ArgCodec<Args>::inlineSize(args) + ... + size_t(0));
+        const bool inline_strings = inline_size <= RECORD_PAYLOAD_SIZE;
+        unsigned char* out = record.payload;
+        ((out = ArgCodec<Args>::encode(out, args, inline_strings)), ...);
+        (void)inline_strings;
+        record.payload_size = static_cast<uint16_t>(out - record.payload);
+        record.format = format;
+        record.format_function = &formatRecord<Args...>;
+    }
+
+    /**
+     * @brief 展开记录中的消息文本
+     */
+    inline void formatMessage(const LogRecord& record, std::string& out) {
+        record.format_function(record.format, record.payload, out);
+    }
+
+    inline int64_t currentTimestampMicros() {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+} // namespace LogFormat
+} // namespace VFT_SMF
+
+#endif // LOG_RECORD_HPP
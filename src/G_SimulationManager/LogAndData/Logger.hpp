@@ -5,47 +5,112 @@
 #include <fstream>
 #include <string>
 #include <chrono>
+#include <ctime>
 #include <iomanip>
 #include <sstream>
 #include <mutex>
+#include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <thread>
+#include <type_traits>
+#include <vector>
+#ifdef _WIN32
 #include <windows.h>
+#endif
 #include <filesystem>
 
+#include "LogRecord.hpp"
+#include "../B_SimManage/InstrumentedMutex.hpp"
+
+// 编译期日志级别门限：低于门限的 VFT_LOG_* 调用连同参数求值一起被去除
+// 级别序号：Detail = 0，Brief = 1；定义为 1 去除 Detail，定义为 2 去除全部
+#ifndef VFT_LOG_MIN_LEVEL
+#define VFT_LOG_MIN_LEVEL 0
+#endif
+
+#define VFT_LOG_AT(level, severity, ...) \
+    do { \
+        if constexpr ((severity) >= VFT_LOG_MIN_LEVEL) { \
+            if (::VFT_SMF::logEnabled(::VFT_SMF::LogLevel::level)) { \
+                ::VFT_SMF::logDeferred(::VFT_SMF::LogLevel::level, __VA_ARGS__); \
+            } \
+        } \
+    } while (0)
+
+// 格式串日志：VFT_LOG_BRIEF("飞行员线程更新 - 仿真时间: {}s, 步骤: {}", time, step)
+// 级别未启用时参数不求值；启用时只拷贝参数，格式化在写线程中进行
+#define VFT_LOG_BRIEF(...) VFT_LOG_AT(Brief, 1, __VA_ARGS__)
+#define VFT_LOG_DETAIL(...) VFT_LOG_AT(Detail, 0, __VA_ARGS__)
+
 namespace VFT_SMF {
 
-enum class LogLevel {
-    Brief,
-    Detail
+/**
+ * @brief 日志运行计数快照
+ */
+struct LoggerCounters {
+    uint64_t submitted = 0;         ///< 进入记录环的条数
+    uint64_t written = 0;           ///< 写线程已写出的条数
+    uint64_t dropped = 0;           ///< 写线程未启动时丢弃的条数
+    uint64_t ring_full_waits = 0;   ///< 记录环满、调用方等待写线程的次数
 };
 
 class Logger {
 private:
+    static constexpr size_t RING_CAPACITY = 4096;   ///< 待写记录槽位数，满时调用方等待写线程
+
     std::ofstream log_brief_file;
     std::ofstream log_detail_file;
-    std::mutex brief_mutex;
-    std::mutex detail_mutex;
     bool console_output;
-    
-    std::string getCurrentTimestamp() {
-        auto now = std::chrono::system_clock::now();
-        auto time_t = std::chrono::system_clock::to_time_t(now);
-        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-            now.time_since_epoch()) % 1000;
-        
-        std::stringstream ss;
-        ss << std::put_time(std::localtime(&time_t), "%Y-%m-%d %H:%M:%S");
-        ss << '.' << std::setfill('0') << std::setw(3) << ms.count();
-        return ss.str();
-    }
-    
-    std::string getThreadName() {
+    std::atomic<bool> detail_enabled;
+
+    // 记录环：[write_head, write_tail) 由写线程处理，其余槽位可由调用方填写
+    std::vector<LogFormat::LogRecord> ring;
+    VFT_SMF::SimManage::InstrumentedMutex ring_mutex{"Logger.ring"};
+    VFT_SMF::SimManage::InstrumentedConditionVariable ring_not_empty;
+    VFT_SMF::SimManage::InstrumentedConditionVariable ring_not_full;
+    uint64_t write_head = 0;
+    uint64_t write_tail = 0;
+    bool stopping = false;
+    std::thread writer_thread;
+
+    // 运行计数（指标端点无锁读取）
+    std::atomic<uint64_t> records_submitted{0};
+    std::atomic<uint64_t> records_written{0};
+    std::atomic<uint64_t> records_dropped{0};
+    std::atomic<uint64_t> ring_full_waits{0};
+
+    // 写线程缓存：同一秒内的时间戳前缀只格式化一次
+    int64_t cached_second = -1;
+    std::string cached_second_text;
+
+    static uint64_t currentThreadId() {
         // 获取当前线程名称，如果没有设置则返回线程ID
-        DWORD threadId = GetCurrentThreadId();
-        return "Thread-" + std::to_string(threadId);
+#ifdef _WIN32
+        thread_local const uint64_t thread_id = GetCurrentThreadId();
+#else
+        thread_local const uint64_t thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
+#endif
+        return thread_id;
+    }
+
+    void appendTimestamp(int64_t timestamp_us, std::string& line) {
+        const int64_t second = timestamp_us / 1000000;
+        if (second != cached_second) {
+            const std::time_t time_t = static_cast<std::time_t>(second);
+            std::stringstream ss;
+            ss << std::put_time(std::localtime(&time_t), "%Y-%m-%d %H:%M:%S");
+            cached_second = second;
+            cached_second_text = ss.str();
+        }
+        const int ms = static_cast<int>((timestamp_us / 1000) % 1000);
+        line += cached_second_text;
+        line += '.';
+        line += static_cast<char>('0' + ms / 100);
+        line += static_cast<char>('0' + ms / 10 % 10);
+        line += static_cast<char>('0' + ms % 10);
     }
-    
+
     std::string levelToString(LogLevel level) {
         switch (level) {
             case LogLevel::Brief: return "Brief";
@@ -53,33 +118,115 @@ private:
             default: return "UNKNOWN";
         }
     }
-    
-    void writeToFile(std::ofstream& file, std::mutex& mutex, 
-                    LogLevel level, const std::string& message) {
-        std::lock_guard<std::mutex> lock(mutex);
-        if (file.is_open()) {
-            file << "[" << getCurrentTimestamp() << "] "
-                 << "[" << getThreadName() << "] "
-                 << "[" << levelToString(level) << "] "
-                 << message << std::endl;
-            file.flush();
+
+    void formatLine(const LogFormat::LogRecord& record, std::string& line) {
+        line += '[';
+        appendTimestamp(record.timestamp_us, line);
+        line += "] [Thread-";
+        line += std::to_string(record.thread_id);
+        line += "] [";
+        line += levelToString(record.level);
+        line += "] ";
+        LogFormat::formatMessage(record, line);
+        line += '\n';
+    }
+
+    void writeRecord(const LogFormat::LogRecord& record, std::string& line) {
+        line.clear();
+        formatLine(record, line);
+        if (record.brief_route) {
+            if (log_brief_file.is_open()) log_brief_file << line;
+            if (log_detail_file.is_open()) log_detail_file << line;   // 同时写入detail log
+            if (console_output) std::cout << line;
+        } else if (log_detail_file.is_open()) {
+            log_detail_file << line;
+        }
+    }
+
+    void flushOutputs() {
+        if (log_brief_file.is_open()) log_brief_file.flush();
+        if (log_detail_file.is_open()) log_detail_file.flush();
+        if (console_output) std::cout.flush();
+    }
+
+    // 写线程：成批取出记录，格式化并写出，整批写完后刷新一次
+    void writerLoop() {
+        if constexpr (VFT_SMF::SimManage::LockStats::compiledIn()) {
+            VFT_SMF::SimManage::LockStats::tagCurrentThread("Logger_Writer");
+        }
+        std::string line;
+        VFT_SMF::SimManage::InstrumentedUniqueLock lock(ring_mutex);
+        while (true) {
+            ring_not_empty.wait(lock, [this]() { return write_head != write_tail || stopping; });
+            if (write_head == write_tail) break;
+            const uint64_t batch_end = write_tail;
+            lock.unlock();
+            for (uint64_t i = write_head; i != batch_end; ++i) {
+                writeRecord(ring[i % RING_CAPACITY], line);
+            }
+            flushOutputs();
+            records_written.fetch_add(batch_end - write_head, std::memory_order_relaxed);
+            lock.lock();
+            write_head = batch_end;
+            ring_not_full.notify_all();
         }
     }
-    
-    void writeToConsole(LogLevel level, const std::string& message) {
-        if (console_output) {
-            std::lock_guard<std::mutex> lock(brief_mutex);
-            std::cout << "[" << getCurrentTimestamp() << "] "
-                     << "[" << getThreadName() << "] "
-                     << "[" << levelToString(level) << "] "
-                     << message << std::endl;
+
+    void stopWriter() {
+        if (!writer_thread.joinable()) return;
+        {
+            std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(ring_mutex);
+            stopping = true;
+        }
+        ring_not_empty.notify_one();
+        writer_thread.join();
+    }
+
+    template<typename Fill>
+    void submit(LogLevel level, bool brief_route, Fill&& fill) {
+        if (!writer_thread.joinable()) {
+            // 未初始化：在调用线程中直接格式化（仅控制台）
+            if (brief_route && console_output) {
+                LogFormat::LogRecord record;
+                fill(record);
+                record.level = level;
+                record.brief_route = brief_route;
+                record.thread_id = currentThreadId();
+                record.timestamp_us = LogFormat::currentTimestampMicros();
+                std::string line;
+                std::lock_guard<VFT_SMF::SimManage::InstrumentedMutex> lock(ring_mutex);
+                formatLine(record, line);
+                std::cout << line << std::flush;
+            } else {
+                records_dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+            return;
+        }
+        const uint64_t thread_id = currentThreadId();
+        const int64_t timestamp_us = LogFormat::currentTimestampMicros();
+        {
+            VFT_SMF::SimManage::InstrumentedUniqueLock lock(ring_mutex);
+            if (write_tail - write_head >= RING_CAPACITY) {
+                ring_full_waits.fetch_add(1, std::memory_order_relaxed);
+            }
+            ring_not_full.wait(lock, [this]() { return write_tail - write_head < RING_CAPACITY; });
+            LogFormat::LogRecord& record = ring[write_tail % RING_CAPACITY];
+            record.level = level;
+            record.brief_route = brief_route;
+            record.thread_id = thread_id;
+            record.timestamp_us = timestamp_us;
+            fill(record);
+            ++write_tail;
         }
+        records_submitted.fetch_add(1, std::memory_order_relaxed);
+        ring_not_empty.notify_one();
     }
 
 public:
-    Logger() : console_output(true) {}
-    
+    Logger() : console_output(true), detail_enabled(true) {}
+
     ~Logger() {
+        stopWriter();
         if (log_brief_file.is_open()) {
             log_brief_file.close();
         }
@@ -87,22 +234,22 @@ public:
             log_detail_file.close();
         }
     }
-    
+
     bool initialize(const std::string& brief_filename = "log_brief.txt",
                    const std::string& detail_filename = "log_detail.txt",
                    bool enable_console = true) {
         console_output = enable_console;
-        
+
         // 清理之前的日志文件
         clearLogFiles(brief_filename, detail_filename);
-        
+
         // 打开brief日志文件
         log_brief_file.open(brief_filename, std::ios::app);
         if (!log_brief_file.is_open()) {
             std::cerr << "Failed to open brief log file: " << brief_filename << std::endl;
             return false;
         }
-        
+
         // 打开detail日志文件
         log_detail_file.open(detail_filename, std::ios::app);
         if (!log_detail_file.is_open()) {
@@ -110,28 +257,82 @@ public:
             log_brief_file.close();
             return false;
         }
-        
+
+        // 启动写线程
+        if (!writer_thread.joinable()) {
+            ring.resize(RING_CAPACITY);
+            stopping = false;
+            writer_thread = std::thread(&Logger::writerLoop, this);
+        }
+
         // 写入初始化日志
         logBrief(LogLevel::Brief, "Logger system initialized successfully");
-        logDetail(LogLevel::Detail, "Logger system initialized with brief file: " + brief_filename + 
+        logDetail(LogLevel::Detail, "Logger system initialized with brief file: " + brief_filename +
                                  ", detail file: " + detail_filename);
-        
+
         return true;
     }
-    
+
     // 写入brief日志（事件触发器、控制器驱动日志、高级流程、状态更新）
     // brief level的日志既输出到brief log又输出到detail log
     void logBrief(LogLevel level, const std::string& message) {
-        writeToFile(log_brief_file, brief_mutex, level, message);
-        writeToFile(log_detail_file, detail_mutex, level, message);  // 同时写入detail log
-        writeToConsole(level, message);
+        submit(level, true, [&](LogFormat::LogRecord& record) {
+            LogFormat::captureRecord<std::string>(record, "{}", message);
+        });
     }
-    
+
     // 写入detail日志（其他所有日志）
     void logDetail(LogLevel level, const std::string& message) {
-        writeToFile(log_detail_file, detail_mutex, level, message);
+        if (!detail_enabled.load(std::memory_order_relaxed)) return;
+        submit(level, false, [&](LogFormat::LogRecord& record) {
+            LogFormat::captureRecord<std::string>(record, "{}", message);
+        });
+    }
+
+    /**
+     * @brief 格式串日志（一般经 VFT_LOG_BRIEF / VFT_LOG_DETAIL 调用）
+     * @details Brief 级别按 logBrief 路由，Detail 级别按 logDetail 路由；
+     *          调用线程只拷贝参数，"{}" 占位符在写线程中展开
+     */
+    template<size_t N, typename... Args>
+    void logDeferred(LogLevel level, const char (&format)[N], const Args&... args) {
+        submit(level, level == LogLevel::Brief, [&](LogFormat::LogRecord& record) {
+            LogFormat::captureRecord<LogFormat::StoredType<Args>...>(record, format, args...);
+        });
+    }
+
+    /**
+     * @brief 运行期级别过滤（在参数求值与拷贝之前检查）
+     */
+    bool isEnabled(LogLevel level) const {
+        return level == LogLevel::Brief || detail_enabled.load(std::memory_order_relaxed);
     }
-    
+
+    void setDetailEnabled(bool enable) {
+        detail_enabled.store(enable, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 等待已提交的记录全部写出
+     */
+    void flush() {
+        if (!writer_thread.joinable()) return;
+        VFT_SMF::SimManage::InstrumentedUniqueLock lock(ring_mutex);
+        ring_not_full.wait(lock, [this]() { return write_head == write_tail; });
+    }
+
+    /**
+     * @brief 获取运行计数（不加锁，供指标端点采集）
+     */
+    LoggerCounters getCounters() const {
+        LoggerCounters counters;
+        counters.submitted = records_submitted.load(std::memory_order_relaxed);
+        counters.written = records_written.load(std::memory_order_relaxed);
+        counters.dropped = records_dropped.load(std::memory_order_relaxed);
+        counters.ring_full_waits = ring_full_waits.load(std::memory_order_relaxed);
+        return counters;
+    }
+
     // 便捷方法
     void debug(const std::string& message) { logDetail(LogLevel::Detail, message); }
     void info(const std::string& message) { logBrief(LogLevel::Brief, message); }
@@ -139,17 +340,17 @@ public:
     void errorBrief(const std::string& message) { logBrief(LogLevel::Brief, message); }
     void errorDetail(const std::string& message) { logDetail(LogLevel::Detail, message); }
     void critical(const std::string& message) { logBrief(LogLevel::Brief, message); }
-    
+
     // 设置控制台输出
     void setConsoleOutput(bool enable) {
         console_output = enable;
     }
-    
+
     // 检查日志文件是否打开
     bool isInitialized() const {
         return log_brief_file.is_open() && log_detail_file.is_open();
     }
-    
+
     // 清理日志文件
     void clearLogFiles(const std::string& brief_filename, const std::string& detail_filename) {
         try {
@@ -191,6 +392,16 @@ inline void logDetail(LogLevel level, const std::string& message) {
     }
 }
 
+// VFT_LOG_* 的运行期检查：日志系统未启用时只有一次指针判断
+inline bool logEnabled(LogLevel level) {
+    return globalLogger && globalLogger->isEnabled(level);
+}
+
+template<size_t N, typename... Args>
+inline void logDeferred(LogLevel level, const char (&format)[N], const Args&... args) {
+    globalLogger->logDeferred(level, format, args...);
+}
+
 } // namespace VFT_SMF
 
 #endif // LOGGER_HPP
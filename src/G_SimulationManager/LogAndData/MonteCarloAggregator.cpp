@@ -0,0 +1,459 @@
+/**
+ * @file MonteCarloAggregator.cpp
+ * @brief 蒙特卡洛批量运行统计汇总器实现
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include "MonteCarloAggregator.hpp"
+#include "Logger.hpp"
+#include "../../E_GlobalSharedDataSpace/GlobalSharedDataSpace.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+namespace VFT_SMF {
+namespace MonteCarlo {
+
+    namespace {
+
+        constexpr char STATE_MAGIC[8] = {'V', 'F', 'T', 'M', 'C', 'A', 'G', '1'};
+
+        std::string trim(const std::string& text) {
+            const auto first = text.find_first_not_of(" \t");
+            if (first == std::string::npos) return "";
+            const auto last = text.find_last_not_of(" \t");
+            return text.substr(first, last - first + 1);
+        }
+
+        template <typename T>
+        void writeValue(std::ostream& out, const T& value) {
+            out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template <typename T>
+        bool readValue(std::istream& in, T& value) {
+            return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+        }
+
+        void writeString(std::ostream& out, const std::string& text) {
+            const uint32_t size = static_cast<uint32_t>(text.size());
+            writeValue(out, size);
+            out.write(text.data(), size);
+        }
+
+        /// 流中剩余的字节数（载入时据此校验文件中的计数，防止损坏的文件触发超大分配）
+        uint64_t remainingBytes(std::istream& in) {
+            const std::streampos position = in.tellg();
+            if (position < 0) return 0;
+            in.seekg(0, std::ios::end);
+            const std::streampos end = in.tellg();
+            in.seekg(position);
+            return end > position ? static_cast<uint64_t>(end - position) : 0;
+        }
+
+        bool readString(std::istream& in, std::string& text) {
+            uint32_t size = 0;
+            if (!readValue(in, size) || size > remainingBytes(in)) return false;
+            text.resize(size);
+            return size == 0 || static_cast<bool>(in.read(&text[0], size));
+        }
+
+        void writeSummaryRow(std::ostream& out, const Summary& summary) {
+            const auto& s = summary.statistics;
+            out << s.count << ',' << s.mean << ',' << s.stddev() << ','
+                << s.min << ',' << s.min_run << ',' << s.max << ',' << s.max_run << ','
+                << summary.digest.quantile(0.05) << ',' << summary.digest.quantile(0.50) << ','
+                << summary.digest.quantile(0.95) << '\n';
+        }
+
+        const char* const SUMMARY_COLUMNS = "count,mean,stddev,min,min_run,max,max_run,p05,p50,p95";
+
+        /**
+         * @brief 状态文件的进程间排他锁（建议锁，锁在旁路文件 <状态文件>.lock 上）
+         * @details 状态文件本身经临时文件改名替换，不能直接加锁；同一状态文件的所有读改写都先取得此锁。
+         *          Linux 使用 flock，Windows 使用 LockFileEx；进程退出时系统自动释放。
+         */
+        class StateFileLock {
+        public:
+            explicit StateFileLock(const std::string& state_file) {
+                const std::string lock_path = state_file + ".lock";
+#ifdef _WIN32
+                handle = CreateFileA(lock_path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                                     nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+                if (handle == INVALID_HANDLE_VALUE) return;
+                OVERLAPPED overlapped = {};
+                locked = LockFileEx(handle, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped) != 0;
+#else
+                fd = ::open(lock_path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+                if (fd < 0) return;
+                while (!(locked = ::flock(fd, LOCK_EX) == 0) && errno == EINTR) {}
+#endif
+            }
+
+            ~StateFileLock() {
+#ifdef _WIN32
+                if (handle == INVALID_HANDLE_VALUE) return;
+                if (locked) {
+                    OVERLAPPED overlapped = {};
+                    UnlockFileEx(handle, 0, MAXDWORD, MAXDWORD, &overlapped);
+                }
+                CloseHandle(handle);
+#else
+                if (fd < 0) return;
+                if (locked) ::flock(fd, LOCK_UN);
+                ::close(fd);
+#endif
+            }
+
+            StateFileLock(const StateFileLock&) = delete;
+            StateFileLock& operator=(const StateFileLock&) = delete;
+
+            bool isLocked() const { return locked; }
+
+        private:
+#ifdef _WIN32
+            HANDLE handle = INVALID_HANDLE_VALUE;
+#else
+            int fd = -1;
+#endif
+            bool locked = false;
+        };
+
+    } // namespace
+
+    MonteCarloAggregator::MonteCarloAggregator()
+        : sample_interval(0.1),
+          timestep_compression(50.0),
+          kpi_compression(100.0),
+          completed_runs(0),
+          run_active(false),
+          current_run(0),
+          last_bin(-1) {}
+
+    bool MonteCarloAggregator::initialize(const std::string& channels, double interval,
+                                          double timestep_digest_compression, double kpi_digest_compression) {
+        channel_names.clear();
+        getters.clear();
+        sample_interval = interval > 0.0 ? interval : 0.1;
+        timestep_compression = timestep_digest_compression;
+        kpi_compression = kpi_digest_compression;
+
+        std::stringstream ss(channels);
+        std::string token;
+        while (std::getline(ss, token, ',')) {
+            const std::string name = trim(token);
+            if (name.empty()) continue;
+            const ChannelGetter getter = VFT_SMF::Telemetry::TelemetryPublisher::findChannel(name);
+            if (getter) {
+                channel_names.push_back(name);
+                getters.push_back(getter);
+            } else {
+                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "蒙特卡洛汇总通道不存在，已忽略: " + name);
+            }
+        }
+
+        timestep_summaries.assign(channel_names.size(), {});
+        kpi_summaries.clear();
+        completed_runs = 0;
+        run_active = false;
+        return !channel_names.empty();
+    }
+
+    Summary& MonteCarloAggregator::timestepSummary(size_t channel, size_t bin) {
+        auto& series = timestep_summaries[channel];
+        while (series.size() <= bin) {
+            series.emplace_back(timestep_compression);
+        }
+        return series[bin];
+    }
+
+    void MonteCarloAggregator::beginRun(uint32_t run_id) {
+        current_run = run_id;
+        run_active = true;
+        last_bin = -1;
+        run_final.assign(channel_names.size(), std::numeric_limits<double>::quiet_NaN());
+        run_min.assign(channel_names.size(), std::numeric_limits<double>::infinity());
+        run_max.assign(channel_names.size(), -std::numeric_limits<double>::infinity());
+        run_kpis.clear();
+    }
+
+    void MonteCarloAggregator::observe(double simulation_time,
+                                       const VFT_SMF::GlobalShared_DataSpace::GlobalSharedDataSpace& shared_data_space) {
+        if (!run_active) return;
+        // 时间点边界处取样，1e-9 吸收步长累加的舍入误差
+        const int64_t bin = static_cast<int64_t>(std::floor(simulation_time / sample_interval + 1e-9));
+        if (bin <= last_bin || bin < 0) return;
+        last_bin = bin;
+        for (size_t i = 0; i < getters.size(); ++i) {
+            recordSample(i, simulation_time, getters[i](shared_data_space));
+        }
+    }
+
+    void MonteCarloAggregator::recordSample(size_t channel, double simulation_time, double value) {
+        if (!run_active || channel >= channel_names.size() || std::isnan(value)) return;
+        const int64_t bin = static_cast<int64_t>(std::floor(simulation_time / sample_interval + 1e-9));
+        if (bin < 0) return;
+        timestepSummary(channel, static_cast<size_t>(bin)).add(value, current_run);
+        run_final[channel] = value;
+        run_min[channel] = std::min(run_min[channel], value);
+        run_max[channel] = std::max(run_max[channel], value);
+    }
+
+    void MonteCarloAggregator::recordKpi(const std::string& name, double value) {
+        if (!run_active) return;
+        run_kpis[name] = value;
+    }
+
+    void MonteCarloAggregator::endRun() {
+        if (!run_active) return;
+        auto add_kpi = [&](const std::string& name, double value) {
+            if (std::isnan(value) || std::isinf(value)) return;
+            auto it = kpi_summaries.find(name);
+            if (it == kpi_summaries.end()) {
+                it = kpi_summaries.emplace(name, Summary(kpi_compression)).first;
+            }
+            it->second.add(value, current_run);
+        };
+        for (size_t i = 0; i < channel_names.size(); ++i) {
+            add_kpi(channel_names[i] + ".final", run_final[i]);
+            add_kpi(channel_names[i] + ".min", run_min[i]);
+            add_kpi(channel_names[i] + ".max", run_max[i]);
+        }
+        for (const auto& kpi : run_kpis) {
+            add_kpi(kpi.first, kpi.second);
+        }
+        for (auto& series : timestep_summaries) {
+            for (auto& summary : series) summary.digest.compress();
+        }
+        ++completed_runs;
+        run_active = false;
+    }
+
+    bool MonteCarloAggregator::merge(const MonteCarloAggregator& other) {
+        if (other.channel_names != channel_names || other.sample_interval != sample_interval) {
+            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "蒙特卡洛汇总器合并失败：通道或采样间隔不一致");
+            return false;
+        }
+        for (size_t channel = 0; channel < channel_names.size(); ++channel) {
+            const auto& series = other.timestep_summaries[channel];
+            for (size_t bin = 0; bin < series.size(); ++bin) {
+                timestepSummary(channel, bin).merge(series[bin]);
+            }
+        }
+        for (const auto& kpi : other.kpi_summaries) {
+            auto it = kpi_summaries.find(kpi.first);
+            if (it == kpi_summaries.end()) {
+                kpi_summaries.emplace(kpi.first, kpi.second);
+            } else {
+                it->second.merge(kpi.second);
+            }
+        }
+        completed_runs += other.completed_runs;
+        return true;
+    }
+
+    bool MonteCarloAggregator::saveState(const std::string& file_path) const {
+        const std::filesystem::path path(file_path);
+        if (path.has_parent_path()) {
+            std::filesystem::create_directories(path.parent_path());
+        }
+        // 先写临时文件再替换，避免中断时损坏已累计的状态
+        const std::string temporary = file_path + ".tmp";
+        {
+            std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+            if (!out.is_open()) return false;
+            out.write(STATE_MAGIC, sizeof(STATE_MAGIC));
+            writeValue(out, completed_runs);
+            writeValue(out, sample_interval);
+            writeValue(out, timestep_compression);
+            writeValue(out, kpi_compression);
+            writeValue(out, static_cast<uint32_t>(channel_names.size()));
+            for (size_t channel = 0; channel < channel_names.size(); ++channel) {
+                writeString(out, channel_names[channel]);
+                writeValue(out, static_cast<uint32_t>(timestep_summaries[channel].size()));
+                for (const auto& summary : timestep_summaries[channel]) {
+                    summary.statistics.write(out);
+                    summary.digest.write(out);
+                }
+            }
+            writeValue(out, static_cast<uint32_t>(kpi_summaries.size()));
+            for (const auto& kpi : kpi_summaries) {
+                writeString(out, kpi.first);
+                kpi.second.statistics.write(out);
+                kpi.second.digest.write(out);
+            }
+            if (!out.good()) return false;
+        }
+        std::error_code error;
+        std::filesystem::rename(temporary, file_path, error);
+        return !error;
+    }
+
+    bool MonteCarloAggregator::mergeIntoState(const std::string& file_path, const std::string& summary_directory) {
+        const std::filesystem::path path(file_path);
+        if (path.has_parent_path()) {
+            std::error_code error;
+            std::filesystem::create_directories(path.parent_path(), error);
+        }
+        StateFileLock lock(file_path);
+        if (!lock.isLocked()) {
+            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "蒙特卡洛状态文件加锁失败: " + file_path + ".lock");
+            return false;
+        }
+
+        // 持锁期间重新载入：其他进程在本次运行期间写回的结果一并保留
+        MonteCarloAggregator stored;
+        stored.channel_names = channel_names;
+        stored.sample_interval = sample_interval;
+        stored.timestep_compression = timestep_compression;
+        stored.kpi_compression = kpi_compression;
+        stored.timestep_summaries.assign(channel_names.size(), {});
+        std::error_code error;
+        if (std::filesystem::exists(path, error) && !stored.loadState(file_path)) {
+            return false;   // 不一致或已损坏的状态文件不覆盖
+        }
+        if (!stored.merge(*this) || !stored.saveState(file_path)) {
+            return false;
+        }
+        timestep_summaries = std::move(stored.timestep_summaries);
+        kpi_summaries = std::move(stored.kpi_summaries);
+        completed_runs = stored.completed_runs;
+        return summary_directory.empty() || writeSummary(summary_directory);
+    }
+
+    bool MonteCarloAggregator::loadState(const std::string& file_path) {
+        std::ifstream in(file_path, std::ios::binary);
+        if (!in.is_open()) return false;
+
+        char magic[sizeof(STATE_MAGIC)];
+        if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, STATE_MAGIC, sizeof(magic)) != 0) {
+            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "蒙特卡洛状态文件格式无效: " + file_path);
+            return false;
+        }
+
+        MonteCarloAggregator loaded;
+        uint32_t channel_count = 0;
+        if (!(readValue(in, loaded.completed_runs) && readValue(in, loaded.sample_interval) &&
+              readValue(in, loaded.timestep_compression) && readValue(in, loaded.kpi_compression) &&
+              readValue(in, channel_count))) {
+            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "蒙特卡洛状态文件不完整: " + file_path);
+            return false;
+        }
+
+        // 文件中的计数按剩余字节数校验：每个通道至少有名称长度与时间点数，每个时间点至少一份空汇总
+        std::ostringstream probe;
+        const Summary empty_summary(loaded.timestep_compression);
+        empty_summary.statistics.write(probe);
+        empty_summary.digest.write(probe);
+        const uint64_t min_summary_bytes = static_cast<uint64_t>(probe.tellp());
+        if (channel_count > remainingBytes(in) / (2 * sizeof(uint32_t))) {
+            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "蒙特卡洛状态文件已损坏（通道数超出文件大小）: " + file_path);
+            return false;
+        }
+        loaded.channel_names.resize(channel_count);
+        loaded.timestep_summaries.resize(channel_count);
+        for (uint32_t channel = 0; channel < channel_count; ++channel) {
+            uint32_t bin_count = 0;
+            if (!readString(in, loaded.channel_names[channel]) || !readValue(in, bin_count) ||
+                bin_count > remainingBytes(in) / min_summary_bytes) {
+                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "蒙特卡洛状态文件已损坏或不完整: " + file_path);
+                return false;
+            }
+            auto& series = loaded.timestep_summaries[channel];
+            series.assign(bin_count, Summary(loaded.timestep_compression));
+            for (auto& summary : series) {
+                if (!summary.statistics.read(in) || !summary.digest.read(in)) {
+                    VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "蒙特卡洛状态文件已损坏或不完整: " + file_path);
+                    return false;
+                }
+            }
+        }
+        uint32_t kpi_count = 0;
+        if (!readValue(in, kpi_count) || kpi_count > remainingBytes(in) / (sizeof(uint32_t) + min_summary_bytes)) {
+            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "蒙特卡洛状态文件已损坏或不完整: " + file_path);
+            return false;
+        }
+        for (uint32_t i = 0; i < kpi_count; ++i) {
+            std::string name;
+            Summary summary(loaded.kpi_compression);
+            if (!readString(in, name) || !summary.statistics.read(in) || !summary.digest.read(in)) {
+                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "蒙特卡洛状态文件已损坏或不完整: " + file_path);
+                return false;
+            }
+            loaded.kpi_summaries.emplace(name, std::move(summary));
+        }
+
+        if (loaded.channel_names != channel_names || loaded.sample_interval != sample_interval) {
+            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "蒙特卡洛状态文件的通道或采样间隔与当前配置不一致，已忽略: " + file_path);
+            return false;
+        }
+        timestep_summaries = std::move(loaded.timestep_summaries);
+        kpi_summaries = std::move(loaded.kpi_summaries);
+        completed_runs = loaded.completed_runs;
+        return true;
+    }
+
+    bool MonteCarloAggregator::writeSummary(const std::string& directory) const {
+        std::filesystem::create_directories(directory);
+
+        std::ofstream timestep_file(directory + "/montecarlo_timestep_summary.csv");
+        if (!timestep_file.is_open()) return false;
+        timestep_file << std::setprecision(10);
+        timestep_file << "time,channel," << SUMMARY_COLUMNS << '\n';
+        for (size_t channel = 0; channel < channel_names.size(); ++channel) {
+            const auto& series = timestep_summaries[channel];
+            for (size_t bin = 0; bin < series.size(); ++bin) {
+                if (series[bin].statistics.count == 0) continue;
+                timestep_file << static_cast<double>(bin) * sample_interval << ',' << channel_names[channel] << ',';
+                writeSummaryRow(timestep_file, series[bin]);
+            }
+        }
+
+        std::ofstream kpi_file(directory + "/montecarlo_kpi_summary.csv");
+        if (!kpi_file.is_open()) return false;
+        kpi_file << std::setprecision(10);
+        kpi_file << "kpi," << SUMMARY_COLUMNS << '\n';
+        for (const auto& kpi : kpi_summaries) {
+            kpi_file << kpi.first << ',';
+            writeSummaryRow(kpi_file, kpi.second);
+        }
+
+        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "蒙特卡洛汇总已输出: " + directory + "，累计运行次数: " +
+                          std::to_string(completed_runs));
+        return timestep_file.good() && kpi_file.good();
+    }
+
+    size_t MonteCarloAggregator::getTimestepCount(size_t channel) const {
+        return channel < timestep_summaries.size() ? timestep_summaries[channel].size() : 0;
+    }
+
+    const Summary* MonteCarloAggregator::getTimestepSummary(size_t channel, size_t bin) const {
+        if (channel >= timestep_summaries.size() || bin >= timestep_summaries[channel].size()) return nullptr;
+        return &timestep_summaries[channel][bin];
+    }
+
+    const Summary* MonteCarloAggregator::getKpiSummary(const std::string& name) const {
+        auto it = kpi_summaries.find(name);
+        return it == kpi_summaries.end() ? nullptr : &it->second;
+    }
+
+} // namespace MonteCarlo
+} // namespace VFT_SMF
@@ -0,0 +1,158 @@
+/**
+ * @file MonteCarloAggregator.hpp
+ * @brief 蒙特卡洛批量运行统计汇总器
+ * @details 在发布路径上按固定时间间隔采样选定通道，逐时间点、逐KPI累计可合并的汇总量
+ *          （Welford均值/方差、t-digest分位数、带运行ID的极值），不保存任何单次运行的时序数据。
+ *          汇总器状态可序列化：每个仿真进程结束时持锁载入已累计的状态、并入本次运行后写回（mergeIntoState），
+ *          因此上万次运行的批量仿真内存恒定，并行运行的进程可共用同一状态文件，最终只输出紧凑的汇总文件。
+ *          同进程内并行运行时，每个工作线程持有独立汇总器，结束后 merge() 合并。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#pragma once
+
+#include "StreamingStatistics.hpp"
+#include "TelemetryPublisher.hpp"
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// 前向声明
+namespace VFT_SMF {
+    namespace GlobalShared_DataSpace {
+        class GlobalSharedDataSpace;
+    }
+}
+
+namespace VFT_SMF {
+namespace MonteCarlo {
+
+    /**
+     * @brief 单个统计对象的汇总量（某通道某时间点，或某KPI）
+     */
+    struct Summary {
+        RunningStatistics statistics;
+        TDigest digest;
+
+        explicit Summary(double compression = 100.0) : digest(compression) {}
+
+        void add(double value, uint32_t run_id) {
+            statistics.add(value, run_id);
+            digest.add(value);
+        }
+
+        void merge(const Summary& other) {
+            statistics.merge(other.statistics);
+            digest.merge(other.digest);
+        }
+    };
+
+    /**
+     * @brief 蒙特卡洛统计汇总器
+     */
+    class MonteCarloAggregator {
+    public:
+        using ChannelGetter = VFT_SMF::Telemetry::TelemetryPublisher::ChannelGetter;
+
+    private:
+        std::vector<std::string> channel_names;
+        std::vector<ChannelGetter> getters;
+        double sample_interval;                         ///< 时间点采样间隔 [s]
+        double timestep_compression;                    ///< 逐时间点t-digest压缩参数
+        double kpi_compression;                         ///< KPI t-digest压缩参数
+
+        std::vector<std::vector<Summary>> timestep_summaries;  ///< [通道][时间点]
+        std::map<std::string, Summary> kpi_summaries;
+        uint64_t completed_runs;
+
+        // 当前运行
+        bool run_active;
+        uint32_t current_run;
+        int64_t last_bin;                               ///< 已采样的最后一个时间点
+        std::vector<double> run_final;                  ///< 各通道本次运行最终值
+        std::vector<double> run_min;
+        std::vector<double> run_max;
+        std::map<std::string, double> run_kpis;         ///< 本次运行的自定义KPI
+
+        Summary& timestepSummary(size_t channel, size_t bin);
+
+    public:
+        MonteCarloAggregator();
+
+        /**
+         * @brief 初始化汇总器
+         * @param channels 逗号分隔的通道名（与遥测/CSV列名一致）
+         * @param interval 时间点采样间隔 [s]
+         * @param timestep_digest_compression 逐时间点t-digest压缩参数
+         * @param kpi_digest_compression KPI t-digest压缩参数
+         * @return 至少有一个有效通道时返回true
+         */
+        bool initialize(const std::string& channels, double interval = 0.1,
+                        double timestep_digest_compression = 50.0, double kpi_digest_compression = 100.0);
+
+        /**
+         * @brief 开始一次运行
+         */
+        void beginRun(uint32_t run_id);
+
+        /**
+         * @brief 从共享数据空间采样本步数据（每个时间点只取第一次到达的样本）
+         */
+        void observe(double simulation_time, const VFT_SMF::GlobalShared_DataSpace::GlobalSharedDataSpace& shared_data_space);
+
+        /**
+         * @brief 直接记录某通道某时刻的值（不经共享数据空间）
+         */
+        void recordSample(size_t channel, double simulation_time, double value);
+
+        /**
+         * @brief 记录本次运行的自定义KPI（如起飞滑跑距离），同名多次记录取最后一次
+         */
+        void recordKpi(const std::string& name, double value);
+
+        /**
+         * @brief 结束本次运行：并入各通道的 final/min/max 及自定义KPI
+         */
+        void endRun();
+
+        /**
+         * @brief 合并另一汇总器（通道与采样间隔必须一致）
+         */
+        bool merge(const MonteCarloAggregator& other);
+
+        /**
+         * @brief 保存/载入汇总器状态（二进制，跨进程累计用）
+         */
+        bool saveState(const std::string& file_path) const;
+        bool loadState(const std::string& file_path);
+
+        /**
+         * @brief 把本汇总器并入状态文件（跨进程并发安全）
+         * @details 持状态文件的进程间排他锁重新载入文件、并入本汇总器、写回，之后本汇总器即为合并结果。
+         *          同一状态文件可由多个并行运行的进程共用；本汇总器应只含本进程的运行，不要先 loadState()。
+         *          状态文件与当前配置不一致或已损坏时不写回并返回 false。
+         * @param summary_directory 非空时在持锁期间同时输出汇总文件（避免并行进程交错写同一汇总文件）
+         */
+        bool mergeIntoState(const std::string& file_path, const std::string& summary_directory = "");
+
+        /**
+         * @brief 输出汇总文件：montecarlo_timestep_summary.csv 与 montecarlo_kpi_summary.csv
+         */
+        bool writeSummary(const std::string& directory) const;
+
+        uint64_t getCompletedRuns() const { return completed_runs; }
+        bool isRunActive() const { return run_active; }
+        double getSampleInterval() const { return sample_interval; }
+        const std::vector<std::string>& getChannelNames() const { return channel_names; }
+        size_t getTimestepCount(size_t channel) const;
+        const Summary* getTimestepSummary(size_t channel, size_t bin) const;
+        const Summary* getKpiSummary(const std::string& name) const;
+    };
+
+    // 全局蒙特卡洛汇总器实例（未启用时为空）
+    inline std::unique_ptr<MonteCarloAggregator> globalMonteCarloAggregator = nullptr;
+
+} // namespace MonteCarlo
+} // namespace VFT_SMF
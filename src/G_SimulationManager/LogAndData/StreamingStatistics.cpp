@@ -0,0 +1,227 @@
+/**
+ * @file StreamingStatistics.cpp
+ * @brief 可合并的流式统计量实现
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include "StreamingStatistics.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+
+namespace VFT_SMF {
+namespace MonteCarlo {
+
+    namespace {
+
+        const double PI = 3.14159265358979323846;
+
+        template <typename T>
+        void writeValue(std::ostream& out, const T& value) {
+            out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template <typename T>
+        bool readValue(std::istream& in, T& value) {
+            return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+        }
+
+        /// 流中剩余的字节数；不支持定位的流返回上限（不做校验）
+        uint64_t remainingBytes(std::istream& in) {
+            const std::streampos position = in.tellg();
+            if (position < 0) return UINT64_MAX;
+            in.seekg(0, std::ios::end);
+            const std::streampos end = in.tellg();
+            in.seekg(position);
+            return end > position ? static_cast<uint64_t>(end - position) : 0;
+        }
+
+    } // namespace
+
+    // ==================== RunningStatistics ====================
+
+    void RunningStatistics::add(double value, uint32_t run_id) {
+        ++count;
+        const double delta = value - mean;
+        mean += delta / static_cast<double>(count);
+        m2 += delta * (value - mean);
+        if (value < min) { min = value; min_run = run_id; }
+        if (value > max) { max = value; max_run = run_id; }
+    }
+
+    void RunningStatistics::merge(const RunningStatistics& other) {
+        if (other.count == 0) return;
+        if (count == 0) { *this = other; return; }
+        const double total = static_cast<double>(count + other.count);
+        const double delta = other.mean - mean;
+        mean += delta * static_cast<double>(other.count) / total;
+        m2 += other.m2 + delta * delta * static_cast<double>(count) * static_cast<double>(other.count) / total;
+        count += other.count;
+        if (other.min < min) { min = other.min; min_run = other.min_run; }
+        if (other.max > max) { max = other.max; max_run = other.max_run; }
+    }
+
+    double RunningStatistics::stddev() const {
+        return std::sqrt(variance());
+    }
+
+    void RunningStatistics::write(std::ostream& out) const {
+        writeValue(out, count);
+        writeValue(out, mean);
+        writeValue(out, m2);
+        writeValue(out, min);
+        writeValue(out, max);
+        writeValue(out, min_run);
+        writeValue(out, max_run);
+    }
+
+    bool RunningStatistics::read(std::istream& in) {
+        return readValue(in, count) && readValue(in, mean) && readValue(in, m2) &&
+               readValue(in, min) && readValue(in, max) && readValue(in, min_run) && readValue(in, max_run);
+    }
+
+    // ==================== TDigest ====================
+
+    TDigest::TDigest(double compression_parameter)
+        : compression(std::max(compression_parameter, 10.0)),
+          merged_weight(0.0),
+          min_value(std::numeric_limits<double>::infinity()),
+          max_value(-std::numeric_limits<double>::infinity()) {}
+
+    void TDigest::add(double value, double weight) {
+        if (std::isnan(value) || weight <= 0.0) return;
+        buffer.push_back({value, weight});
+        min_value = std::min(min_value, value);
+        max_value = std::max(max_value, value);
+        if (buffer.size() >= bufferLimit()) {
+            compress();
+        }
+    }
+
+    void TDigest::merge(const TDigest& other) {
+        if (other.totalWeight() <= 0.0) return;
+        buffer.insert(buffer.end(), other.centroids.begin(), other.centroids.end());
+        buffer.insert(buffer.end(), other.buffer.begin(), other.buffer.end());
+        min_value = std::min(min_value, other.min_value);
+        max_value = std::max(max_value, other.max_value);
+        compress();
+    }
+
+    void TDigest::compress() {
+        if (buffer.empty()) return;
+
+        std::vector<Centroid> all;
+        all.reserve(centroids.size() + buffer.size());
+        all.insert(all.end(), centroids.begin(), centroids.end());
+        all.insert(all.end(), buffer.begin(), buffer.end());
+        buffer.clear();
+        std::sort(all.begin(), all.end(), [](const Centroid& a, const Centroid& b) { return a.mean < b.mean; });
+
+        double total = 0.0;
+        for (const auto& c : all) total += c.weight;
+
+        // k1尺度函数：k(q) = δ/(2π)·asin(2q-1)，每个质心覆盖的k跨度不超过1
+        const double normalizer = compression / (2.0 * PI);
+        auto k_to_q = [&](double k) { return (std::sin(std::min(k / normalizer, PI / 2.0)) + 1.0) / 2.0; };
+        auto q_to_k = [&](double q) { return normalizer * std::asin(std::clamp(2.0 * q - 1.0, -1.0, 1.0)); };
+
+        std::vector<Centroid> merged;
+        merged.reserve(static_cast<size_t>(compression) + 1);
+        Centroid current = all.front();
+        double q_left = 0.0;
+        double q_limit = k_to_q(q_to_k(q_left) + 1.0);
+        for (size_t i = 1; i < all.size(); ++i) {
+            const double proposed = current.weight + all[i].weight;
+            if (q_left + proposed / total <= q_limit) {
+                current.mean += (all[i].mean - current.mean) * all[i].weight / proposed;
+                current.weight = proposed;
+            } else {
+                merged.push_back(current);
+                q_left += current.weight / total;
+                q_limit = k_to_q(q_to_k(q_left) + 1.0);
+                current = all[i];
+            }
+        }
+        merged.push_back(current);
+
+        centroids.swap(merged);
+        merged_weight = total;
+    }
+
+    double TDigest::quantile(double q) const {
+        if (!buffer.empty()) {
+            TDigest compressed(*this);
+            compressed.compress();
+            return compressed.quantile(q);
+        }
+        if (centroids.empty()) return std::numeric_limits<double>::quiet_NaN();
+        if (centroids.size() == 1) return centroids.front().mean;
+
+        q = std::clamp(q, 0.0, 1.0);
+        const double index = q * merged_weight;
+
+        // 首质心中心左侧：在最小值与首质心之间插值
+        const Centroid& first = centroids.front();
+        if (index < first.weight / 2.0) {
+            return min_value + (first.mean - min_value) * index / (first.weight / 2.0);
+        }
+
+        double cumulative = 0.0;
+        for (size_t i = 0; i + 1 < centroids.size(); ++i) {
+            const double left_center = cumulative + centroids[i].weight / 2.0;
+            const double right_center = cumulative + centroids[i].weight + centroids[i + 1].weight / 2.0;
+            if (index < right_center) {
+                const double fraction = (index - left_center) / (right_center - left_center);
+                return centroids[i].mean + (centroids[i + 1].mean - centroids[i].mean) * fraction;
+            }
+            cumulative += centroids[i].weight;
+        }
+
+        // 末质心中心右侧：在末质心与最大值之间插值
+        const Centroid& last = centroids.back();
+        const double last_center = merged_weight - last.weight / 2.0;
+        const double fraction = (index - last_center) / (last.weight / 2.0);
+        return last.mean + (max_value - last.mean) * std::min(fraction, 1.0);
+    }
+
+    double TDigest::totalWeight() const {
+        double total = merged_weight;
+        for (const auto& c : buffer) total += c.weight;
+        return total;
+    }
+
+    void TDigest::write(std::ostream& out) const {
+        TDigest compressed(*this);
+        compressed.compress();
+        writeValue(out, compressed.compression);
+        writeValue(out, compressed.min_value);
+        writeValue(out, compressed.max_value);
+        const uint32_t size = static_cast<uint32_t>(compressed.centroids.size());
+        writeValue(out, size);
+        for (const auto& c : compressed.centroids) {
+            writeValue(out, c.mean);
+            writeValue(out, c.weight);
+        }
+    }
+
+    bool TDigest::read(std::istream& in) {
+        uint32_t size = 0;
+        if (!(readValue(in, compression) && readValue(in, min_value) && readValue(in, max_value) && readValue(in, size))) {
+            return false;
+        }
+        if (size > remainingBytes(in) / (2 * sizeof(double))) return false;   // 质心数超出剩余数据，文件已损坏
+        centroids.resize(size);
+        buffer.clear();
+        merged_weight = 0.0;
+        for (auto& c : centroids) {
+            if (!(readValue(in, c.mean) && readValue(in, c.weight))) return false;
+            merged_weight += c.weight;
+        }
+        return true;
+    }
+
+} // namespace MonteCarlo
+} // namespace VFT_SMF
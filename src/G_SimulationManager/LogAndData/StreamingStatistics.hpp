@@ -0,0 +1,91 @@
+/**
+ * @file StreamingStatistics.hpp
+ * @brief 可合并的流式统计量
+ * @details RunningStatistics 以Welford算法在线累计均值/方差，并记录极值及其所属运行ID；
+ *          TDigest 为合并式t-digest（k1尺度函数），以固定数量的质心近似分位数。
+ *          两者内存占用与样本数无关，且均可跨线程/跨进程合并。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <vector>
+
+namespace VFT_SMF {
+namespace MonteCarlo {
+
+    /**
+     * @brief 均值/方差/极值在线统计（Welford，Chan合并公式）
+     */
+    struct RunningStatistics {
+        uint64_t count = 0;
+        double mean = 0.0;
+        double m2 = 0.0;                                          ///< 离差平方和
+        double min = std::numeric_limits<double>::infinity();
+        double max = -std::numeric_limits<double>::infinity();
+        uint32_t min_run = 0;                                     ///< 取得最小值的运行ID
+        uint32_t max_run = 0;                                     ///< 取得最大值的运行ID
+
+        void add(double value, uint32_t run_id);
+        void merge(const RunningStatistics& other);
+
+        /**
+         * @brief 样本方差（n-1），样本数不足2时为0
+         */
+        double variance() const { return count > 1 ? m2 / static_cast<double>(count - 1) : 0.0; }
+        double stddev() const;
+
+        void write(std::ostream& out) const;
+        bool read(std::istream& in);
+    };
+
+    /**
+     * @brief 合并式t-digest分位数估计
+     */
+    class TDigest {
+    public:
+        struct Centroid {
+            double mean;
+            double weight;
+        };
+
+    private:
+        double compression;                 ///< 压缩参数δ，质心数约为δ/2量级
+        std::vector<Centroid> centroids;    ///< 已合并质心（按均值升序）
+        std::vector<Centroid> buffer;       ///< 未合并的新样本
+        double merged_weight;
+        double min_value;
+        double max_value;
+
+        size_t bufferLimit() const { return static_cast<size_t>(compression) * 4 + 16; }
+
+    public:
+        explicit TDigest(double compression_parameter = 100.0);
+
+        void add(double value, double weight = 1.0);
+        void merge(const TDigest& other);
+
+        /**
+         * @brief 将缓冲样本合并入质心（分位数查询与序列化前调用）
+         */
+        void compress();
+
+        /**
+         * @brief 分位数估计，q ∈ [0, 1]；无样本时返回NaN
+         */
+        double quantile(double q) const;
+
+        double totalWeight() const;
+        size_t centroidCount() const { return centroids.size(); }
+        double getCompression() const { return compression; }
+
+        void write(std::ostream& out) const;
+        bool read(std::istream& in);
+    };
+
+} // namespace MonteCarlo
+} // namespace VFT_SMF
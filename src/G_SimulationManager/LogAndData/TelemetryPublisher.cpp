@@ -0,0 +1,157 @@
+/**
+ * @file TelemetryPublisher.cpp
+ * @brief 实时遥测发布器实现
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include "TelemetryPublisher.hpp"
+#include "Logger.hpp"
+#include "../../E_GlobalSharedDataSpace/GlobalSharedDataSpace.hpp"
+#include "../../E_FlightDynamics/LocalTangentFrame.hpp"
+#include <sstream>
+
+namespace VFT_SMF {
+namespace Telemetry {
+
+    namespace {
+
+        using Space = VFT_SMF::GlobalShared_DataSpace::GlobalSharedDataSpace;
+
+        // 飞行动力学步内只发布切平面位置，经纬度在读取时换算
+        VFT_SMF::GlobalSharedDataStruct::AircraftFlightState resolvedFlightState(const Space& s) {
+            thread_local VFT_SMF::FlightDynamics::GeodeticResolver resolver;
+            return resolver.resolved(s.getAircraftFlightState());
+        }
+
+        struct ChannelDefinition {
+            const char* name;
+            TelemetryPublisher::ChannelGetter getter;
+        };
+
+        // 可镜像的通道表：名称与数据记录器CSV列名保持一致
+        const ChannelDefinition CHANNEL_TABLE[] = {
+            // 飞行状态
+            {"latitude",           [](const Space& s) { return resolvedFlightState(s).latitude; }},
+            {"longitude",          [](const Space& s) { return resolvedFlightState(s).longitude; }},
+            {"altitude",           [](const Space& s) { return s.getAircraftFlightState().altitude; }},
+            {"heading",            [](const Space& s) { return s.getAircraftFlightState().heading; }},
+            {"pitch",              [](const Space& s) { return s.getAircraftFlightState().pitch; }},
+            {"roll",               [](const Space& s) { return s.getAircraftFlightState().roll; }},
+            {"airspeed",           [](const Space& s) { return s.getAircraftFlightState().airspeed; }},
+            {"groundspeed",        [](const Space& s) { return s.getAircraftFlightState().groundspeed; }},
+            {"vertical_speed",     [](const Space& s) { return s.getAircraftFlightState().vertical_speed; }},
+            {"pitch_rate",         [](const Space& s) { return s.getAircraftFlightState().pitch_rate; }},
+            {"roll_rate",          [](const Space& s) { return s.getAircraftFlightState().roll_rate; }},
+            {"yaw_rate",           [](const Space& s) { return s.getAircraftFlightState().yaw_rate; }},
+            {"longitudinal_accel", [](const Space& s) { return s.getAircraftFlightState().longitudinal_accel; }},
+            {"lateral_accel",      [](const Space& s) { return s.getAircraftFlightState().lateral_accel; }},
+            {"vertical_accel",     [](const Space& s) { return s.getAircraftFlightState().vertical_accel; }},
+            {"brake_pressure",     [](const Space& s) { return s.getAircraftFlightState().brake_pressure; }},
+            // 飞机系统状态
+            {"current_mass",                [](const Space& s) { return s.getAircraftSystemState().current_mass; }},
+            {"current_fuel",                [](const Space& s) { return s.getAircraftSystemState().current_fuel; }},
+            {"current_brake_pressure",      [](const Space& s) { return s.getAircraftSystemState().current_brake_pressure; }},
+            {"current_flaps_deployed",      [](const Space& s) { return s.getAircraftSystemState().current_flaps_deployed; }},
+            {"current_aileron_deflection",  [](const Space& s) { return s.getAircraftSystemState().current_aileron_deflection; }},
+            {"current_elevator_deflection", [](const Space& s) { return s.getAircraftSystemState().current_elevator_deflection; }},
+            {"current_rudder_deflection",   [](const Space& s) { return s.getAircraftSystemState().current_rudder_deflection; }},
+            {"current_throttle_position",   [](const Space& s) { return s.getAircraftSystemState().current_throttle_position; }},
+            {"current_engine_rpm",          [](const Space& s) { return s.getAircraftSystemState().current_engine_rpm; }},
+            // 六分量合外力
+            {"longitudinal_force", [](const Space& s) { return s.getAircraftNetForce().longitudinal_force; }},
+            {"lateral_force",      [](const Space& s) { return s.getAircraftNetForce().lateral_force; }},
+            {"vertical_force",     [](const Space& s) { return s.getAircraftNetForce().vertical_force; }},
+            {"roll_moment",        [](const Space& s) { return s.getAircraftNetForce().roll_moment; }},
+            {"pitch_moment",       [](const Space& s) { return s.getAircraftNetForce().pitch_moment; }},
+            {"yaw_moment",         [](const Space& s) { return s.getAircraftNetForce().yaw_moment; }},
+            {"thrust_force",       [](const Space& s) { return s.getAircraftNetForce().thrust_force; }},
+            {"drag_force",         [](const Space& s) { return s.getAircraftNetForce().drag_force; }},
+            {"lift_force",         [](const Space& s) { return s.getAircraftNetForce().lift_force; }},
+            // 环境状态
+            {"friction_coefficient", [](const Space& s) { return s.getEnvironmentState().friction_coefficient; }},
+            {"runway_elevation",     [](const Space& s) { return s.getEnvironmentState().runway_elevation; }},
+            {"air_density",          [](const Space& s) { return s.getEnvironmentState().air_density; }},
+            {"wind_speed",           [](const Space& s) { return s.getEnvironmentState().wind_speed; }},
+            {"wind_direction",       [](const Space& s) { return s.getEnvironmentState().wind_direction; }},
+        };
+
+        std::string trim(const std::string& text) {
+            const auto first = text.find_first_not_of(" \t");
+            if (first == std::string::npos) return "";
+            const auto last = text.find_last_not_of(" \t");
+            return text.substr(first, last - first + 1);
+        }
+
+    } // namespace
+
+    std::vector<std::string> TelemetryPublisher::availableChannels() {
+        std::vector<std::string> names;
+        for (const auto& definition : CHANNEL_TABLE) {
+            names.emplace_back(definition.name);
+        }
+        return names;
+    }
+
+    TelemetryPublisher::ChannelGetter TelemetryPublisher::findChannel(const std::string& name) {
+        for (const auto& definition : CHANNEL_TABLE) {
+            if (name == definition.name) return definition.getter;
+        }
+        return nullptr;
+    }
+
+    bool TelemetryPublisher::initialize(const std::string& shm_name, const std::string& channels, uint32_t capacity) {
+        getters.clear();
+        channel_names.clear();
+
+        std::stringstream ss(channels);
+        std::string token;
+        while (std::getline(ss, token, ',')) {
+            const std::string name = trim(token);
+            if (name.empty()) continue;
+            const ChannelGetter getter = findChannel(name);
+            if (getter) {
+                getters.push_back(getter);
+                channel_names.push_back(name);
+            } else {
+                VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "遥测通道不存在，已忽略: " + name);
+            }
+            if (channel_names.size() == MAX_CHANNELS) break;
+        }
+
+        if (channel_names.empty()) {
+            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "遥测未配置有效通道，遥测发布已禁用");
+            return false;
+        }
+        if (!writer.create(shm_name, channel_names, capacity)) {
+            VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "遥测共享内存创建失败: " + shm_name);
+            return false;
+        }
+
+        sample.assign(channel_names.size(), 0.0);
+        VFT_SMF::logBrief(VFT_SMF::LogLevel::Brief, "遥测共享内存已创建: " + shm_name + "，通道数: " +
+                          std::to_string(channel_names.size()) + "，容量: " + std::to_string(capacity));
+        return true;
+    }
+
+    void TelemetryPublisher::publish(double simulation_time,
+                                     const VFT_SMF::GlobalShared_DataSpace::GlobalSharedDataSpace& shared_data_space) {
+        if (!writer.isOpen()) return;
+        for (size_t i = 0; i < getters.size(); ++i) {
+            sample[i] = getters[i](shared_data_space);
+        }
+        writer.push(simulation_time, sample.data());
+    }
+
+    bool initializeGlobalTelemetry(const std::string& shm_name, const std::string& channels, uint32_t capacity) {
+        auto publisher = std::make_unique<TelemetryPublisher>();
+        if (!publisher->initialize(shm_name, channels, capacity)) {
+            globalTelemetryPublisher.reset();
+            return false;
+        }
+        globalTelemetryPublisher = std::move(publisher);
+        return true;
+    }
+
+} // namespace Telemetry
+} // namespace VFT_SMF
@@ -0,0 +1,83 @@
+/**
+ * @file TelemetryPublisher.hpp
+ * @brief 实时遥测发布器
+ * @details 在全局共享数据空间的发布路径上，把选定通道镜像到共享内存遥测环，
+ *          供外部监视工具在仿真运行期间实时查看。通道在初始化时解析为取值函数表，
+ *          每步发布仅做若干次字段读取与一次槽位写入，不加锁、不分配内存。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#pragma once
+
+#include "TelemetryRing.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+// 前向声明
+namespace VFT_SMF {
+    namespace GlobalShared_DataSpace {
+        class GlobalSharedDataSpace;
+    }
+}
+
+namespace VFT_SMF {
+namespace Telemetry {
+
+    /**
+     * @brief 遥测发布器
+     */
+    class TelemetryPublisher {
+    public:
+        using ChannelGetter = double (*)(const VFT_SMF::GlobalShared_DataSpace::GlobalSharedDataSpace&);
+
+    private:
+        TelemetryRingWriter writer;
+        std::vector<ChannelGetter> getters;
+        std::vector<std::string> channel_names;
+        std::vector<double> sample;   ///< 预分配的单步样本
+
+    public:
+        /**
+         * @brief 初始化遥测环
+         * @param shm_name 共享内存名称
+         * @param channels 逗号分隔的通道名列表（与CSV列名一致，如 "latitude,altitude,airspeed"）
+         * @param capacity 环容量（样本数）
+         * @return 是否成功
+         */
+        bool initialize(const std::string& shm_name, const std::string& channels,
+                        uint32_t capacity = DEFAULT_RING_CAPACITY);
+
+        /**
+         * @brief 发布一步数据
+         * @param simulation_time 仿真时间
+         * @param shared_data_space 全局共享数据空间
+         */
+        void publish(double simulation_time, const VFT_SMF::GlobalShared_DataSpace::GlobalSharedDataSpace& shared_data_space);
+
+        bool isActive() const { return writer.isOpen(); }
+        const std::vector<std::string>& getChannelNames() const { return channel_names; }
+
+        /**
+         * @brief 获取全部可用通道名
+         */
+        static std::vector<std::string> availableChannels();
+
+        /**
+         * @brief 按通道名查找取值函数，未知通道返回空指针
+         */
+        static ChannelGetter findChannel(const std::string& name);
+    };
+
+    // 全局遥测发布器实例（未启用时为空）
+    inline std::unique_ptr<TelemetryPublisher> globalTelemetryPublisher = nullptr;
+
+    /**
+     * @brief 初始化全局遥测发布器，失败时记录日志并保持禁用
+     */
+    bool initializeGlobalTelemetry(const std::string& shm_name, const std::string& channels,
+                                   uint32_t capacity = DEFAULT_RING_CAPACITY);
+
+} // namespace Telemetry
+} // namespace VFT_SMF
@@ -0,0 +1,281 @@
+/**
+ * @file TelemetryRing.cpp
+ * @brief 共享内存遥测环形缓冲区实现
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include "TelemetryRing.hpp"
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace VFT_SMF {
+namespace Telemetry {
+
+    // ==================== SharedMemoryRegion ====================
+
+    SharedMemoryRegion::~SharedMemoryRegion() {
+        close();
+    }
+
+#ifdef _WIN32
+    bool SharedMemoryRegion::create(const std::string& region_name, size_t region_size) {
+        close();
+        const std::string mapping_name = "Local\\" + region_name;
+        HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                            static_cast<DWORD>(static_cast<uint64_t>(region_size) >> 32),
+                                            static_cast<DWORD>(region_size & 0xFFFFFFFFu), mapping_name.c_str());
+        if (!mapping) return false;
+        void* view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, region_size);
+        if (!view) {
+            CloseHandle(mapping);
+            return false;
+        }
+        name = region_name;
+        handle = mapping;
+        address = view;
+        size = region_size;
+        owner = true;
+        return true;
+    }
+
+    bool SharedMemoryRegion::open(const std::string& region_name, bool writable) {
+        close();
+        const std::string mapping_name = "Local\\" + region_name;
+        const DWORD access = writable ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ;
+        HANDLE mapping = OpenFileMappingA(access, FALSE, mapping_name.c_str());
+        if (!mapping) return false;
+        void* view = MapViewOfFile(mapping, access, 0, 0, 0);
+        if (!view) {
+            CloseHandle(mapping);
+            return false;
+        }
+        MEMORY_BASIC_INFORMATION info;
+        VirtualQuery(view, &info, sizeof(info));
+        name = region_name;
+        handle = mapping;
+        address = view;
+        size = info.RegionSize;
+        owner = false;
+        return true;
+    }
+
+    void SharedMemoryRegion::close() {
+        if (address) UnmapViewOfFile(address);
+        if (handle) CloseHandle(static_cast<HANDLE>(handle));
+        address = nullptr;
+        handle = nullptr;
+        size = 0;
+        owner = false;
+    }
+#else
+    bool SharedMemoryRegion::create(const std::string& region_name, size_t region_size) {
+        close();
+        const std::string shm_name = "/" + region_name;
+        // 清理上次异常退出遗留的同名对象，避免读端附加到旧布局
+        shm_unlink(shm_name.c_str());
+        int fd = shm_open(shm_name.c_str(), O_CREAT | O_RDWR, 0644);
+        if (fd < 0) return false;
+        if (ftruncate(fd, static_cast<off_t>(region_size)) != 0) {
+            ::close(fd);
+            shm_unlink(shm_name.c_str());
+            return false;
+        }
+        void* mapped = mmap(nullptr, region_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapped == MAP_FAILED) {
+            shm_unlink(shm_name.c_str());
+            return false;
+        }
+        name = region_name;
+        address = mapped;
+        size = region_size;
+        owner = true;
+        return true;
+    }
+
+    bool SharedMemoryRegion::open(const std::string& region_name, bool writable) {
+        close();
+        const std::string shm_name = "/" + region_name;
+        int fd = shm_open(shm_name.c_str(), writable ? O_RDWR : O_RDONLY, 0);
+        if (fd < 0) return false;
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+            ::close(fd);
+            return false;
+        }
+        void* mapped = mmap(nullptr, static_cast<size_t>(info.st_size), writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                            MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapped == MAP_FAILED) return false;
+        name = region_name;
+        address = mapped;
+        size = static_cast<size_t>(info.st_size);
+        owner = false;
+        return true;
+    }
+
+    void SharedMemoryRegion::close() {
+        if (address) munmap(address, size);
+        if (owner) shm_unlink(("/" + name).c_str());
+        address = nullptr;
+        size = 0;
+        owner = false;
+    }
+#endif
+
+    namespace {
+        // 头部按槽位对齐向上取整，槽位紧随其后
+        constexpr size_t ringHeaderSize() {
+            return (sizeof(RingHeader) + alignof(RingSlot) - 1) / alignof(RingSlot) * alignof(RingSlot);
+        }
+
+        template <typename Slot, typename Header>
+        Slot* slotsAfter(Header* header) {
+            using Byte = std::conditional_t<std::is_const_v<Header>, const char, char>;
+            return reinterpret_cast<Slot*>(reinterpret_cast<Byte*>(header) + ringHeaderSize());
+        }
+    }
+
+    size_t ringRegionSize(uint32_t capacity) {
+        return ringHeaderSize() + static_cast<size_t>(capacity) * sizeof(RingSlot);
+    }
+
+    // ==================== TelemetryRingWriter ====================
+
+    bool TelemetryRingWriter::create(const std::string& region_name, const std::vector<std::string>& channel_names,
+                                     uint32_t capacity) {
+        capacity = std::max<uint32_t>(2, capacity);
+        if (!region.create(region_name, ringRegionSize(capacity))) {
+            header = nullptr;
+            slots = nullptr;
+            return false;
+        }
+
+        std::memset(region.data(), 0, region.getSize());
+        header = new (region.data()) RingHeader();
+        slots = slotsAfter<RingSlot>(header);
+        for (uint32_t i = 0; i < capacity; ++i) {
+            new (&slots[i]) RingSlot();
+            slots[i].sequence.store(0, std::memory_order_relaxed);
+        }
+
+        channel_count = static_cast<uint32_t>(std::min<size_t>(channel_names.size(), MAX_CHANNELS));
+        for (uint32_t i = 0; i < channel_count; ++i) {
+            std::strncpy(header->channel_names[i], channel_names[i].c_str(), CHANNEL_NAME_LENGTH - 1);
+        }
+        header->capacity = capacity;
+        header->channel_count = channel_count;
+        header->version = RING_VERSION;
+        header->write_count.store(0, std::memory_order_relaxed);
+        // magic最后写入并以release发布，读端看到magic即可认为头部完整
+        std::atomic_thread_fence(std::memory_order_release);
+        header->magic = RING_MAGIC;
+        return true;
+    }
+
+    void TelemetryRingWriter::push(double simulation_time, const double* values) {
+        if (!header) return;
+        const uint64_t n = header->write_count.load(std::memory_order_relaxed);
+        RingSlot& slot = slots[n % header->capacity];
+
+        slot.sequence.store(2 * n + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.simulation_time = simulation_time;
+        std::memcpy(slot.values, values, channel_count * sizeof(double));
+        slot.sequence.store(2 * n + 2, std::memory_order_release);
+
+        header->write_count.store(n + 1, std::memory_order_release);
+    }
+
+    // ==================== TelemetryRingReader ====================
+
+    bool TelemetryRingReader::attach(const std::string& region_name, bool from_latest) {
+        header = nullptr;
+        slots = nullptr;
+        channel_names.clear();
+        if (!region.open(region_name) || region.getSize() < sizeof(RingHeader)) return false;
+
+        const RingHeader* candidate = static_cast<const RingHeader*>(region.data());
+        if (candidate->magic != RING_MAGIC || candidate->version != RING_VERSION ||
+            candidate->channel_count > MAX_CHANNELS || candidate->capacity == 0 ||
+            region.getSize() < ringRegionSize(candidate->capacity)) {
+            region.close();
+            return false;
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        header = candidate;
+        slots = slotsAfter<const RingSlot>(header);
+        for (uint32_t i = 0; i < header->channel_count; ++i) {
+            channel_names.emplace_back(header->channel_names[i],
+                                       strnlen(header->channel_names[i], CHANNEL_NAME_LENGTH));
+        }
+
+        const uint64_t written = header->write_count.load(std::memory_order_acquire);
+        cursor = from_latest ? written : (written > header->capacity ? written - header->capacity : 0);
+        dropped = 0;
+        return true;
+    }
+
+    bool TelemetryRingReader::next(TelemetrySample& sample) {
+        if (!header) return false;
+        const uint64_t capacity = header->capacity;
+
+        while (true) {
+            const uint64_t written = header->write_count.load(std::memory_order_acquire);
+            if (cursor >= written) return false;
+
+            // 读端落后超过一圈：跳到环中仍然有效的最旧样本
+            if (written - cursor > capacity) {
+                dropped += written - capacity - cursor;
+                cursor = written - capacity;
+            }
+
+            const RingSlot& slot = slots[cursor % capacity];
+            const uint64_t expected = 2 * cursor + 2;
+            const uint64_t before = slot.sequence.load(std::memory_order_acquire);
+            if (before != expected) {
+                if (before > expected) {
+                    // 已被下一圈覆盖
+                    ++dropped;
+                    ++cursor;
+                    continue;
+                }
+                return false;   // 写端尚未完成该槽位
+            }
+
+            sample.index = cursor;
+            sample.simulation_time = slot.simulation_time;
+            sample.values.resize(header->channel_count);
+            std::memcpy(sample.values.data(), slot.values, header->channel_count * sizeof(double));
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const uint64_t after = slot.sequence.load(std::memory_order_relaxed);
+            ++cursor;
+            if (after != before) {
+                // 读取期间被覆盖，丢弃该样本
+                ++dropped;
+                continue;
+            }
+            return true;
+        }
+    }
+
+    uint64_t TelemetryRingReader::getWriteCount() const {
+        return header ? header->write_count.load(std::memory_order_acquire) : 0;
+    }
+
+} // namespace Telemetry
+} // namespace VFT_SMF
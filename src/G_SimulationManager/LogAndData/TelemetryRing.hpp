@@ -0,0 +1,171 @@
+/**
+ * @file TelemetryRing.hpp
+ * @brief 共享内存遥测环形缓冲区
+ * @details 单写者、多读者、覆盖最旧数据的共享内存环。写端（仿真进程）每步写入一个样本，
+ *          外部监视进程可随时附加读取而不影响仿真。每个槽位以序号做seqlock保护，
+ *          读端检测到被覆盖的样本时跳过并计入丢失数。
+ *          POSIX平台使用 shm_open/mmap，Windows平台使用命名文件映射。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace VFT_SMF {
+namespace Telemetry {
+
+    constexpr uint32_t RING_MAGIC = 0x56544C4D;   ///< "VTLM"
+    constexpr uint32_t RING_VERSION = 1;
+    constexpr uint32_t MAX_CHANNELS = 32;
+    constexpr uint32_t CHANNEL_NAME_LENGTH = 32;
+    constexpr uint32_t DEFAULT_RING_CAPACITY = 4096;
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "共享内存中的原子计数器必须无锁");
+
+    /**
+     * @brief 共享内存头（位于映射区起始处）
+     */
+    struct RingHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t capacity;                                      ///< 槽位数
+        uint32_t channel_count;                                 ///< 有效通道数
+        char channel_names[MAX_CHANNELS][CHANNEL_NAME_LENGTH];  ///< 通道名（以'\0'结尾）
+        alignas(64) std::atomic<uint64_t> write_count;          ///< 已写入样本总数
+    };
+
+    /**
+     * @brief 环形槽位
+     * @details sequence为奇数表示正在写入，为 2*n+2 表示第n个样本已写完
+     */
+    struct alignas(64) RingSlot {
+        std::atomic<uint64_t> sequence;
+        double simulation_time;
+        double values[MAX_CHANNELS];
+    };
+
+    /**
+     * @brief 读端取得的一个样本
+     */
+    struct TelemetrySample {
+        uint64_t index;                 ///< 样本序号
+        double simulation_time;         ///< 仿真时间 (s)
+        std::vector<double> values;     ///< 各通道数值
+    };
+
+    /**
+     * @brief 共享内存映射（平台相关部分）
+     */
+    class SharedMemoryRegion {
+    private:
+        std::string name;
+        void* address;
+        size_t size;
+        bool owner;
+        void* handle;   ///< Windows映射句柄；POSIX下不使用
+
+    public:
+        SharedMemoryRegion() : address(nullptr), size(0), owner(false), handle(nullptr) {}
+        ~SharedMemoryRegion();
+        SharedMemoryRegion(const SharedMemoryRegion&) = delete;
+        SharedMemoryRegion& operator=(const SharedMemoryRegion&) = delete;
+
+        /**
+         * @brief 创建（或重建）指定名称的共享内存
+         */
+        bool create(const std::string& region_name, size_t region_size);
+
+        /**
+         * @brief 附加到已存在的共享内存
+         * @param writable 是否以读写方式映射（遥测读端只读；代理传输的参与端需写入）
+         */
+        bool open(const std::string& region_name, bool writable = false);
+
+        void close();
+
+        void* data() const { return address; }
+        size_t getSize() const { return size; }
+    };
+
+    /**
+     * @brief 计算给定容量的共享内存总大小
+     */
+    size_t ringRegionSize(uint32_t capacity);
+
+    /**
+     * @brief 遥测环写端（仿真进程内唯一）
+     */
+    class TelemetryRingWriter {
+    private:
+        SharedMemoryRegion region;
+        RingHeader* header;
+        RingSlot* slots;
+        uint32_t channel_count;
+
+    public:
+        TelemetryRingWriter() : header(nullptr), slots(nullptr), channel_count(0) {}
+
+        /**
+         * @brief 创建共享内存环
+         * @param region_name 共享内存名称（不含前导'/'）
+         * @param channel_names 通道名，超过MAX_CHANNELS的部分被忽略
+         * @param capacity 槽位数
+         * @return 是否成功
+         */
+        bool create(const std::string& region_name, const std::vector<std::string>& channel_names,
+                    uint32_t capacity = DEFAULT_RING_CAPACITY);
+
+        /**
+         * @brief 写入一个样本（无锁、无分配）
+         * @param simulation_time 仿真时间
+         * @param values 通道数值，长度至少为通道数
+         */
+        void push(double simulation_time, const double* values);
+
+        bool isOpen() const { return header != nullptr; }
+        uint32_t getChannelCount() const { return channel_count; }
+    };
+
+    /**
+     * @brief 遥测环读端（监视进程使用，可多个并存）
+     */
+    class TelemetryRingReader {
+    private:
+        SharedMemoryRegion region;
+        const RingHeader* header;
+        const RingSlot* slots;
+        uint64_t cursor;
+        uint64_t dropped;
+        std::vector<std::string> channel_names;
+
+    public:
+        TelemetryRingReader() : header(nullptr), slots(nullptr), cursor(0), dropped(0) {}
+
+        /**
+         * @brief 附加到共享内存环
+         * @param region_name 共享内存名称
+         * @param from_latest true 从最新样本开始跟随；false 从环中最旧的样本开始
+         * @return 是否成功（不存在或格式不符返回false）
+         */
+        bool attach(const std::string& region_name, bool from_latest = true);
+
+        /**
+         * @brief 读取下一个样本
+         * @param sample 输出样本
+         * @return 有新样本返回true，否则返回false（不阻塞）
+         */
+        bool next(TelemetrySample& sample);
+
+        bool isAttached() const { return header != nullptr; }
+        const std::vector<std::string>& getChannelNames() const { return channel_names; }
+        uint64_t getDroppedCount() const { return dropped; }
+        uint64_t getWriteCount() const;
+    };
+
+} // namespace Telemetry
+} // namespace VFT_SMF
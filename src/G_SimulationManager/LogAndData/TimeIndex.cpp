@@ -0,0 +1,206 @@
+/**
+ * @file TimeIndex.cpp
+ * @brief 记录文件稀疏时间索引与时间窗口读取实现
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include "TimeIndex.hpp"
+#include "TimeSeriesCodec.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+namespace VFT_SMF {
+namespace TimeIndex {
+
+    namespace {
+
+        constexpr const char* INDEX_HEADER = "# VFT_SMF time index v1: sample_index time byte_offset";
+
+        std::vector<std::string> splitWhitespace(const std::string& line) {
+            std::vector<std::string> tokens;
+            std::istringstream ss(line);
+            std::string token;
+            while (ss >> token) {
+                tokens.push_back(token);
+            }
+            return tokens;
+        }
+
+        double parseCell(const std::string& cell) {
+            if (cell == "true") return 1.0;
+            if (cell == "false") return 0.0;
+            char* end = nullptr;
+            const double value = std::strtod(cell.c_str(), &end);
+            if (end == cell.c_str() || *end != '\0') {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            return value;
+        }
+
+        // 将需要的列名映射为源文件列下标；wanted为空时选择全部候选列
+        bool selectColumns(const std::vector<std::string>& available, size_t first_candidate,
+                           const std::vector<std::string>& wanted,
+                           std::vector<size_t>& selected, ChannelWindow& window) {
+            selected.clear();
+            window.column_names.clear();
+            if (wanted.empty()) {
+                for (size_t i = first_candidate; i < available.size(); ++i) {
+                    selected.push_back(i);
+                    window.column_names.push_back(available[i]);
+                }
+            } else {
+                for (const auto& name : wanted) {
+                    auto it = std::find(available.begin() + first_candidate, available.end(), name);
+                    if (it == available.end()) {
+                        return false;
+                    }
+                    selected.push_back(static_cast<size_t>(it - available.begin()));
+                    window.column_names.push_back(name);
+                }
+            }
+            window.time.clear();
+            window.columns.assign(selected.size(), {});
+            return true;
+        }
+
+        bool readCompressedWindow(const std::string& channel_path, double t0, double t1,
+                                  const std::vector<std::string>& wanted_columns, ChannelWindow& window) {
+            TimeSeriesCodec::CompressedChannelReader reader(channel_path);
+            if (!reader.isOpen()) return false;
+
+            std::vector<size_t> selected;
+            if (!selectColumns(reader.getColumnNames(), 0, wanted_columns, selected, window)) return false;
+
+            std::vector<IndexEntry> entries;
+            if (loadIndex(indexPathFor(channel_path), entries)) {
+                const uint64_t offset = findStartOffset(entries, t0);
+                if (offset > 0 && !reader.seek(offset)) return false;
+            }
+
+            double timestamp = 0.0;
+            std::vector<double> values;
+            while (reader.next(timestamp, values)) {
+                if (timestamp < t0) continue;
+                if (timestamp > t1) break;
+                window.time.push_back(timestamp);
+                for (size_t k = 0; k < selected.size(); ++k) {
+                    window.columns[k].push_back(values[selected[k]]);
+                }
+            }
+            return true;
+        }
+
+        bool readTextWindow(const std::string& channel_path, double t0, double t1,
+                            const std::vector<std::string>& wanted_columns, ChannelWindow& window) {
+            std::ifstream file(channel_path);
+            if (!file.is_open()) return false;
+
+            std::string line;
+            if (!std::getline(file, line)) return false;
+            const std::vector<std::string> headers = splitWhitespace(line);
+            if (headers.empty()) return false;
+
+            std::vector<size_t> selected;
+            if (!selectColumns(headers, 1, wanted_columns, selected, window)) return false;
+
+            std::vector<IndexEntry> entries;
+            if (loadIndex(indexPathFor(channel_path), entries)) {
+                // 文本中时间按两位小数输出，多回退一个索引点，保证舍入后等于t0的行也在读取范围内
+                const uint64_t offset = findStartOffset(entries, t0, 1);
+                if (offset > 0) {
+                    file.seekg(static_cast<std::streamoff>(offset));
+                }
+            }
+
+            while (std::getline(file, line)) {
+                const std::vector<std::string> cells = splitWhitespace(line);
+                if (cells.empty()) continue;
+                const double timestamp = parseCell(cells[0]);
+                if (std::isnan(timestamp) || timestamp < t0) continue;
+                if (timestamp > t1) break;
+                window.time.push_back(timestamp);
+                for (size_t k = 0; k < selected.size(); ++k) {
+                    const size_t column = selected[k];
+                    window.columns[k].push_back(column < cells.size() ? parseCell(cells[column])
+                                                                      : std::numeric_limits<double>::quiet_NaN());
+                }
+            }
+            return true;
+        }
+
+    } // namespace
+
+    // ==================== TimeIndexBuilder ====================
+
+    void TimeIndexBuilder::onRow(double time, std::ostream& out) {
+        if (row_count % stride == 0) {
+            entries.push_back({row_count, time, static_cast<uint64_t>(out.tellp())});
+        }
+        ++row_count;
+    }
+
+    void TimeIndexBuilder::onRow(double time, uint64_t byte_offset) {
+        if (row_count % stride == 0) {
+            entries.push_back({row_count, time, byte_offset});
+        }
+        ++row_count;
+    }
+
+    void TimeIndexBuilder::addEntry(uint64_t sample_index, double time, uint64_t byte_offset) {
+        entries.push_back({sample_index, time, byte_offset});
+    }
+
+    bool TimeIndexBuilder::write(const std::string& index_path) const {
+        std::ofstream file(index_path);
+        if (!file.is_open()) return false;
+        file << INDEX_HEADER << "\n";
+        file << std::setprecision(17);
+        for (const auto& entry : entries) {
+            file << entry.sample_index << " " << entry.time << " " << entry.byte_offset << "\n";
+        }
+        return static_cast<bool>(file);
+    }
+
+    // ==================== 读取 ====================
+
+    bool loadIndex(const std::string& index_path, std::vector<IndexEntry>& entries) {
+        entries.clear();
+        std::ifstream file(index_path);
+        if (!file.is_open()) return false;
+
+        std::string line;
+        if (!std::getline(file, line) || line != INDEX_HEADER) return false;
+
+        IndexEntry entry{};
+        while (file >> entry.sample_index >> entry.time >> entry.byte_offset) {
+            entries.push_back(entry);
+        }
+        return true;
+    }
+
+    uint64_t findStartOffset(const std::vector<IndexEntry>& entries, double t0, size_t extra_entries) {
+        // 第一个时间不小于t0的索引点，其前一个即为早于t0的最后一个索引点
+        auto it = std::lower_bound(entries.begin(), entries.end(), t0,
+                                   [](const IndexEntry& entry, double t) { return entry.time < t; });
+        const size_t position = static_cast<size_t>(it - entries.begin());
+        if (position < 1 + extra_entries) return 0;
+        return entries[position - 1 - extra_entries].byte_offset;
+    }
+
+    bool readWindow(const std::string& channel_path, double t0, double t1,
+                    const std::vector<std::string>& wanted_columns, ChannelWindow& window) {
+        if (std::filesystem::path(channel_path).extension() == ".vts") {
+            return readCompressedWindow(channel_path, t0, t1, wanted_columns, window);
+        }
+        return readTextWindow(channel_path, t0, t1, wanted_columns, window);
+    }
+
+} // namespace TimeIndex
+} // namespace VFT_SMF
@@ -0,0 +1,122 @@
+/**
+ * @file TimeIndex.hpp
+ * @brief 记录文件稀疏时间索引与时间窗口读取
+ * @details 记录器在写出每个逐步通道文件(.csv / .vts)时同步生成稀疏索引文件(<文件名>.idx)
+ *          （计划事件库、计划控制器库等静态表与只有一行的事件队列快照不生成索引），
+ *          每隔固定行数（或每个压缩块）记录一次 步号 → 时间 → 字节偏移。
+ *          读取端据此直接定位到窗口起点，读取 [t0, t1] 的代价仅与窗口长度相关。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace VFT_SMF {
+namespace TimeIndex {
+
+    constexpr const char* INDEX_SUFFIX = ".idx";
+    constexpr uint32_t DEFAULT_INDEX_STRIDE = 256;   ///< CSV每隔多少行记录一个索引点
+
+    /**
+     * @brief 索引点
+     */
+    struct IndexEntry {
+        uint64_t sample_index;   ///< 样本序号（步号，从0开始）
+        double time;             ///< 该样本的仿真时间 (s)
+        uint64_t byte_offset;    ///< 该样本（或其所在块）在通道文件中的字节偏移
+    };
+
+    /**
+     * @brief 获取通道文件对应的索引文件路径
+     */
+    inline std::string indexPathFor(const std::string& channel_path) {
+        return channel_path + INDEX_SUFFIX;
+    }
+
+    /**
+     * @brief 稀疏索引构建器
+     */
+    class TimeIndexBuilder {
+    private:
+        std::vector<IndexEntry> entries;
+        uint32_t stride;
+        uint64_t row_count;
+
+    public:
+        explicit TimeIndexBuilder(uint32_t row_stride = DEFAULT_INDEX_STRIDE)
+            : stride(row_stride == 0 ? 1 : row_stride), row_count(0) {}
+
+        /**
+         * @brief 文本文件逐行写出前调用，每stride行记录一次当前写位置
+         * @param time 本行仿真时间
+         * @param out 正在写的输出流
+         */
+        void onRow(double time, std::ostream& out);
+
+        /**
+         * @brief 同上，由调用方给出当前写位置（缓冲写出时使用）
+         */
+        void onRow(double time, uint64_t byte_offset);
+
+        /**
+         * @brief 直接添加索引点（压缩通道按块调用）
+         */
+        void addEntry(uint64_t sample_index, double time, uint64_t byte_offset);
+
+        /**
+         * @brief 写出索引文件
+         * @param index_path 索引文件路径
+         * @return 是否成功
+         */
+        bool write(const std::string& index_path) const;
+
+        const std::vector<IndexEntry>& getEntries() const { return entries; }
+    };
+
+    /**
+     * @brief 读取索引文件
+     * @param index_path 索引文件路径
+     * @param entries 输出索引点（按时间递增）
+     * @return 是否成功（文件不存在或格式错误返回false）
+     */
+    bool loadIndex(const std::string& index_path, std::vector<IndexEntry>& entries);
+
+    /**
+     * @brief 查找早于t0的最后一个索引点，找不到时返回文件起点
+     * @param entries 索引点
+     * @param t0 窗口起点 (s)
+     * @param extra_entries 额外回退的索引点个数
+     * @return 起始字节偏移；返回0表示从文件头读取
+     */
+    uint64_t findStartOffset(const std::vector<IndexEntry>& entries, double t0, size_t extra_entries = 0);
+
+    /**
+     * @brief 时间窗口数据
+     */
+    struct ChannelWindow {
+        std::vector<std::string> column_names;     ///< 已选列名
+        std::vector<double> time;                  ///< 仿真时间
+        std::vector<std::vector<double>> columns;  ///< 每列一个数组，与column_names对应
+    };
+
+    /**
+     * @brief 按时间窗口读取通道文件
+     * @details 支持记录器输出的定宽CSV与压缩通道文件(.vts)；存在索引时从索引点开始读取，
+     *          否则从文件头顺序扫描。CSV中的true/false记为1/0，其他非数值单元记为NaN。
+     * @param channel_path 通道文件路径
+     * @param t0 窗口起点 (s)
+     * @param t1 窗口终点 (s)，包含端点
+     * @param wanted_columns 需要的列名，为空表示全部列（不含SimulationTime）
+     * @param window 输出窗口数据
+     * @return 是否成功
+     */
+    bool readWindow(const std::string& channel_path, double t0, double t1,
+                    const std::vector<std::string>& wanted_columns, ChannelWindow& window);
+
+} // namespace TimeIndex
+} // namespace VFT_SMF
@@ -0,0 +1,381 @@
+/**
+ * @file TimeSeriesCodec.cpp
+ * @brief 时间序列通道压缩编解码器实现
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include "TimeSeriesCodec.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace VFT_SMF {
+namespace TimeSeriesCodec {
+
+    namespace {
+
+        uint64_t doubleToBits(double value) {
+            uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        double bitsToDouble(uint64_t bits) {
+            double value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        int countLeadingZeros(uint64_t value) {
+            return value == 0 ? 64 : __builtin_clzll(value);
+        }
+
+        int countTrailingZeros(uint64_t value) {
+            return value == 0 ? 64 : __builtin_ctzll(value);
+        }
+
+        // 判断有符号数能否以bit_count位二进制补码表示
+        bool fitsSigned(int64_t value, int bit_count) {
+            const int64_t limit = int64_t(1) << (bit_count - 1);
+            return value >= -limit && value < limit;
+        }
+
+        int64_t signExtend(uint64_t value, int bit_count) {
+            const uint64_t sign_bit = uint64_t(1) << (bit_count - 1);
+            return static_cast<int64_t>((value ^ sign_bit) - sign_bit);
+        }
+
+        void writeUint16(std::ostream& out, uint16_t value) {
+            const char bytes[2] = {char(value & 0xFF), char(value >> 8)};
+            out.write(bytes, 2);
+        }
+
+        void writeUint32(std::ostream& out, uint32_t value) {
+            const char bytes[4] = {char(value & 0xFF), char((value >> 8) & 0xFF),
+                                   char((value >> 16) & 0xFF), char((value >> 24) & 0xFF)};
+            out.write(bytes, 4);
+        }
+
+        bool readUint16(std::istream& in, uint16_t& value) {
+            unsigned char bytes[2];
+            if (!in.read(reinterpret_cast<char*>(bytes), 2)) return false;
+            value = uint16_t(bytes[0] | (bytes[1] << 8));
+            return true;
+        }
+
+        bool readUint32(std::istream& in, uint32_t& value) {
+            unsigned char bytes[4];
+            if (!in.read(reinterpret_cast<char*>(bytes), 4)) return false;
+            value = uint32_t(bytes[0]) | (uint32_t(bytes[1]) << 8) |
+                    (uint32_t(bytes[2]) << 16) | (uint32_t(bytes[3]) << 24);
+            return true;
+        }
+
+    } // namespace
+
+    // ==================== BitWriter / BitReader ====================
+
+    void BitWriter::writeBits(uint64_t value, int bit_count) {
+        while (bit_count > 0) {
+            const int take = std::min(8 - pending_bits, bit_count);
+            const uint64_t chunk = (value >> (bit_count - take)) & ((uint64_t(1) << take) - 1);
+            accumulator = (accumulator << take) | chunk;
+            pending_bits += take;
+            bit_count -= take;
+            if (pending_bits == 8) {
+                bytes.push_back(static_cast<uint8_t>(accumulator));
+                accumulator = 0;
+                pending_bits = 0;
+            }
+        }
+    }
+
+    const std::vector<uint8_t>& BitWriter::finish() {
+        if (pending_bits > 0) {
+            bytes.push_back(static_cast<uint8_t>(accumulator << (8 - pending_bits)));
+            accumulator = 0;
+            pending_bits = 0;
+        }
+        return bytes;
+    }
+
+    void BitWriter::clear() {
+        bytes.clear();
+        accumulator = 0;
+        pending_bits = 0;
+    }
+
+    uint64_t BitReader::readBits(int bit_count) {
+        if (bit_position + static_cast<size_t>(bit_count) > size * 8) {
+            throw std::runtime_error("压缩数据块越界");
+        }
+        uint64_t value = 0;
+        while (bit_count > 0) {
+            const int offset = static_cast<int>(bit_position & 7);
+            const int take = std::min(8 - offset, bit_count);
+            const uint8_t byte = data[bit_position >> 3];
+            const uint64_t chunk = (byte >> (8 - offset - take)) & ((1u << take) - 1);
+            value = (value << take) | chunk;
+            bit_position += take;
+            bit_count -= take;
+        }
+        return value;
+    }
+
+    // ==================== BlockEncoder ====================
+
+    void BlockEncoder::append(double timestamp, const double* values) {
+        const uint64_t time_bits = doubleToBits(timestamp);
+        if (sample_count == 0) {
+            writer.writeBits(time_bits, 64);
+            for (size_t i = 0; i < columns.size(); ++i) {
+                columns[i].previous_bits = doubleToBits(values[i]);
+                writer.writeBits(columns[i].previous_bits, 64);
+            }
+        } else {
+            // 时间戳：对64位表示做二阶差分，固定步长下通常为0，仅占1位
+            const int64_t delta = static_cast<int64_t>(time_bits - previous_timestamp);
+            const int64_t delta_of_delta = static_cast<int64_t>(
+                static_cast<uint64_t>(delta) - static_cast<uint64_t>(previous_delta));
+            if (delta_of_delta == 0) {
+                writer.writeBit(false);
+            } else if (fitsSigned(delta_of_delta, 7)) {
+                writer.writeBits(0b10, 2);
+                writer.writeBits(static_cast<uint64_t>(delta_of_delta), 7);
+            } else if (fitsSigned(delta_of_delta, 9)) {
+                writer.writeBits(0b110, 3);
+                writer.writeBits(static_cast<uint64_t>(delta_of_delta), 9);
+            } else if (fitsSigned(delta_of_delta, 12)) {
+                writer.writeBits(0b1110, 4);
+                writer.writeBits(static_cast<uint64_t>(delta_of_delta), 12);
+            } else {
+                writer.writeBits(0b1111, 4);
+                writer.writeBits(static_cast<uint64_t>(delta_of_delta), 64);
+            }
+            previous_delta = delta;
+
+            for (size_t i = 0; i < columns.size(); ++i) {
+                encodeValue(columns[i], values[i]);
+            }
+        }
+        previous_timestamp = time_bits;
+        ++sample_count;
+    }
+
+    void BlockEncoder::encodeValue(ColumnState& state, double value) {
+        const uint64_t bits = doubleToBits(value);
+        const uint64_t xor_value = bits ^ state.previous_bits;
+        state.previous_bits = bits;
+
+        if (xor_value == 0) {
+            writer.writeBit(false);
+            return;
+        }
+        writer.writeBit(true);
+
+        const int leading = std::min(countLeadingZeros(xor_value), 31);
+        const int trailing = countTrailingZeros(xor_value);
+
+        if (state.previous_leading >= 0 && leading >= state.previous_leading &&
+            trailing >= state.previous_trailing) {
+            // 复用上一个有效位窗口
+            const int meaningful = 64 - state.previous_leading - state.previous_trailing;
+            writer.writeBit(false);
+            writer.writeBits(xor_value >> state.previous_trailing, meaningful);
+        } else {
+            const int meaningful = 64 - leading - trailing;
+            writer.writeBit(true);
+            writer.writeBits(static_cast<uint64_t>(leading), 5);
+            writer.writeBits(static_cast<uint64_t>(meaningful - 1), 6);
+            writer.writeBits(xor_value >> trailing, meaningful);
+            state.previous_leading = leading;
+            state.previous_trailing = trailing;
+        }
+    }
+
+    void BlockEncoder::reset() {
+        writer.clear();
+        for (auto& column : columns) {
+            column = ColumnState();
+        }
+        previous_timestamp = 0;
+        previous_delta = 0;
+        sample_count = 0;
+    }
+
+    // ==================== BlockDecoder ====================
+
+    void BlockDecoder::next(double& timestamp, double* values) {
+        if (decoded_count == 0) {
+            previous_timestamp = reader.readBits(64);
+            for (size_t i = 0; i < columns.size(); ++i) {
+                columns[i].previous_bits = reader.readBits(64);
+                values[i] = bitsToDouble(columns[i].previous_bits);
+            }
+        } else {
+            int64_t delta_of_delta = 0;
+            if (reader.readBit()) {
+                if (!reader.readBit()) {
+                    delta_of_delta = signExtend(reader.readBits(7), 7);
+                } else if (!reader.readBit()) {
+                    delta_of_delta = signExtend(reader.readBits(9), 9);
+                } else if (!reader.readBit()) {
+                    delta_of_delta = signExtend(reader.readBits(12), 12);
+                } else {
+                    delta_of_delta = static_cast<int64_t>(reader.readBits(64));
+                }
+            }
+            const uint64_t delta = static_cast<uint64_t>(previous_delta) + static_cast<uint64_t>(delta_of_delta);
+            previous_delta = static_cast<int64_t>(delta);
+            previous_timestamp += delta;
+
+            for (size_t i = 0; i < columns.size(); ++i) {
+                values[i] = decodeValue(columns[i]);
+            }
+        }
+        timestamp = bitsToDouble(previous_timestamp);
+        ++decoded_count;
+    }
+
+    double BlockDecoder::decodeValue(ColumnState& state) {
+        if (reader.readBit()) {
+            if (reader.readBit()) {
+                state.previous_leading = static_cast<int>(reader.readBits(5));
+                const int meaningful = static_cast<int>(reader.readBits(6)) + 1;
+                state.previous_trailing = 64 - state.previous_leading - meaningful;
+            }
+            const int meaningful = 64 - state.previous_leading - state.previous_trailing;
+            state.previous_bits ^= reader.readBits(meaningful) << state.previous_trailing;
+        }
+        return bitsToDouble(state.previous_bits);
+    }
+
+    // ==================== CompressedChannelWriter ====================
+
+    CompressedChannelWriter::CompressedChannelWriter(const std::string& path, const std::vector<std::string>& columns,
+                                                     uint32_t block_capacity)
+        : file(path, std::ios::binary | std::ios::trunc),
+          file_path(path),
+          column_names(columns),
+          block_size(std::max<uint32_t>(1, block_capacity)),
+          encoder(columns.size()),
+          total_samples(0),
+          block_index(1),
+          block_first_time(0.0) {
+        if (!file.is_open()) return;
+
+        file.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+        writeUint16(file, FILE_VERSION);
+        writeUint16(file, static_cast<uint16_t>(column_names.size()));
+        writeUint32(file, block_size);
+        for (const auto& name : column_names) {
+            writeUint16(file, static_cast<uint16_t>(name.size()));
+            file.write(name.data(), static_cast<std::streamsize>(name.size()));
+        }
+    }
+
+    CompressedChannelWriter::~CompressedChannelWriter() {
+        close();
+    }
+
+    void CompressedChannelWriter::append(double timestamp, const std::vector<double>& values) {
+        if (!file.is_open()) return;
+        if (values.size() != column_names.size()) {
+            throw std::invalid_argument("压缩通道列数不匹配");
+        }
+        if (encoder.getSampleCount() == 0) {
+            block_first_time = timestamp;
+        }
+        encoder.append(timestamp, values.data());
+        ++total_samples;
+        if (encoder.getSampleCount() >= block_size) {
+            writeBlock();
+        }
+    }
+
+    void CompressedChannelWriter::writeBlock() {
+        const uint32_t samples = encoder.getSampleCount();
+        if (samples == 0) return;
+        const std::vector<uint8_t>& payload = encoder.finish();
+        block_index.addEntry(total_samples - samples, block_first_time, static_cast<uint64_t>(file.tellp()));
+        writeUint32(file, samples);
+        writeUint32(file, static_cast<uint32_t>(payload.size()));
+        file.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+        encoder.reset();
+    }
+
+    void CompressedChannelWriter::close() {
+        if (!file.is_open()) return;
+        writeBlock();
+        file.close();
+        block_index.write(TimeIndex::indexPathFor(file_path));
+    }
+
+    // ==================== CompressedChannelReader ====================
+
+    CompressedChannelReader::CompressedChannelReader(const std::string& path)
+        : file(path, std::ios::binary), block_size(0), block_samples(0), block_consumed(0) {
+        if (!file.is_open()) return;
+
+        char magic[4];
+        uint16_t version = 0;
+        uint16_t column_count = 0;
+        if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, FILE_MAGIC, sizeof(magic)) != 0 ||
+            !readUint16(file, version) || version != FILE_VERSION ||
+            !readUint16(file, column_count) || !readUint32(file, block_size)) {
+            file.close();
+            return;
+        }
+
+        for (uint16_t i = 0; i < column_count; ++i) {
+            uint16_t length = 0;
+            if (!readUint16(file, length)) {
+                column_names.clear();
+                file.close();
+                return;
+            }
+            std::string name(length, '\0');
+            file.read(name.data(), length);
+            column_names.push_back(name);
+        }
+    }
+
+    bool CompressedChannelReader::loadNextBlock() {
+        decoder.reset();
+        uint32_t payload_bytes = 0;
+        if (!readUint32(file, block_samples) || !readUint32(file, payload_bytes)) {
+            return false;
+        }
+        block_payload.resize(payload_bytes);
+        if (!file.read(reinterpret_cast<char*>(block_payload.data()), payload_bytes)) {
+            return false;
+        }
+        block_consumed = 0;
+        decoder.emplace(block_payload.data(), block_payload.size(), column_names.size());
+        return true;
+    }
+
+    bool CompressedChannelReader::seek(uint64_t block_offset) {
+        if (!isOpen()) return false;
+        file.clear();
+        file.seekg(static_cast<std::streamoff>(block_offset));
+        decoder.reset();
+        block_samples = 0;
+        block_consumed = 0;
+        return static_cast<bool>(file);
+    }
+
+    bool CompressedChannelReader::next(double& timestamp, std::vector<double>& values) {
+        if (!isOpen()) return false;
+        if (!decoder || block_consumed >= block_samples) {
+            if (!loadNextBlock()) return false;
+        }
+        values.resize(column_names.size());
+        decoder->next(timestamp, values.data());
+        ++block_consumed;
+        return true;
+    }
+
+} // namespace TimeSeriesCodec
+} // namespace VFT_SMF
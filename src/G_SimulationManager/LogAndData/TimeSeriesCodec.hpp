@@ -0,0 +1,221 @@
+/**
+ * @file TimeSeriesCodec.hpp
+ * @brief 时间序列通道压缩编解码器
+ * @details Gorilla风格的无损压缩：时间戳采用二阶差分（delta-of-delta）编码，
+ *          数值采用相邻样本XOR编码。数据按块组织，每块独立编码，支持流式解码。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#pragma once
+
+#include "TimeIndex.hpp"
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace VFT_SMF {
+namespace TimeSeriesCodec {
+
+    /**
+     * 文件格式（.vts，所有整数均为小端序）:
+     *   文件头: "VFTS" | uint16 版本 | uint16 列数 | uint32 块容量 | 列名[uint16 长度 + 字节]
+     *   数据块: uint32 样本数 | uint32 载荷字节数 | 载荷比特流
+     * 块内每个样本依次编码: 时间戳 + 各列数值。块首样本以原始64位存储。
+     * 写出时同步生成稀疏索引文件(<文件名>.idx)，每块一个索引点，指向块头的字节偏移。
+     */
+    constexpr char FILE_MAGIC[4] = {'V', 'F', 'T', 'S'};
+    constexpr uint16_t FILE_VERSION = 1;
+    constexpr uint32_t DEFAULT_BLOCK_SIZE = 1024;
+
+    /**
+     * @brief 比特写入器
+     */
+    class BitWriter {
+    private:
+        std::vector<uint8_t> bytes;
+        uint64_t accumulator;   ///< 尚未写出的比特
+        int pending_bits;       ///< accumulator中有效比特数 (0..7)
+
+    public:
+        BitWriter() : accumulator(0), pending_bits(0) {}
+
+        /**
+         * @brief 写入value的低bit_count位（高位在前）
+         * @param value 数值
+         * @param bit_count 位数 (0..64)
+         */
+        void writeBits(uint64_t value, int bit_count);
+
+        void writeBit(bool bit) { writeBits(bit ? 1u : 0u, 1); }
+
+        /**
+         * @brief 补齐到字节边界并返回缓冲区
+         */
+        const std::vector<uint8_t>& finish();
+
+        void clear();
+    };
+
+    /**
+     * @brief 比特读取器
+     */
+    class BitReader {
+    private:
+        const uint8_t* data;
+        size_t size;
+        size_t bit_position;
+
+    public:
+        BitReader(const uint8_t* buffer, size_t length) : data(buffer), size(length), bit_position(0) {}
+
+        /**
+         * @brief 读取bit_count位（高位在前）
+         * @throws std::runtime_error 越界时抛出
+         */
+        uint64_t readBits(int bit_count);
+
+        bool readBit() { return readBits(1) != 0; }
+    };
+
+    /**
+     * @brief 块编码器：维护时间戳与各列的XOR编码状态
+     */
+    class BlockEncoder {
+    private:
+        struct ColumnState {
+            uint64_t previous_bits = 0;
+            int previous_leading = -1;   ///< -1 表示尚无有效窗口
+            int previous_trailing = 0;
+        };
+
+        BitWriter writer;
+        std::vector<ColumnState> columns;
+        uint64_t previous_timestamp = 0;
+        int64_t previous_delta = 0;
+        uint32_t sample_count = 0;
+
+        void encodeValue(ColumnState& state, double value);
+
+    public:
+        explicit BlockEncoder(size_t column_count) : columns(column_count) {}
+
+        void append(double timestamp, const double* values);
+        uint32_t getSampleCount() const { return sample_count; }
+        const std::vector<uint8_t>& finish() { return writer.finish(); }
+        void reset();
+    };
+
+    /**
+     * @brief 块解码器：按样本流式解码
+     */
+    class BlockDecoder {
+    private:
+        struct ColumnState {
+            uint64_t previous_bits = 0;
+            int previous_leading = 0;
+            int previous_trailing = 0;
+        };
+
+        BitReader reader;
+        std::vector<ColumnState> columns;
+        uint64_t previous_timestamp = 0;
+        int64_t previous_delta = 0;
+        uint32_t decoded_count = 0;
+
+        double decodeValue(ColumnState& state);
+
+    public:
+        BlockDecoder(const uint8_t* payload, size_t length, size_t column_count)
+            : reader(payload, length), columns(column_count) {}
+
+        /**
+         * @brief 解码下一个样本
+         * @param timestamp 输出时间戳
+         * @param values 输出数值（长度为列数）
+         */
+        void next(double& timestamp, double* values);
+    };
+
+    /**
+     * @brief 压缩通道文件写入器
+     * @details 追加样本时在内存中编码当前块，块满后写出，内存占用与总样本数无关
+     */
+    class CompressedChannelWriter {
+    private:
+        std::ofstream file;
+        std::string file_path;
+        std::vector<std::string> column_names;
+        uint32_t block_size;
+        BlockEncoder encoder;
+        uint64_t total_samples;
+        TimeIndex::TimeIndexBuilder block_index;
+        double block_first_time;
+
+        void writeBlock();
+
+    public:
+        CompressedChannelWriter(const std::string& path, const std::vector<std::string>& columns,
+                                uint32_t block_capacity = DEFAULT_BLOCK_SIZE);
+        ~CompressedChannelWriter();
+
+        bool isOpen() const { return file.is_open(); }
+
+        /**
+         * @brief 追加一个样本
+         * @param timestamp 仿真时间 (s)
+         * @param values 各列数值，长度必须等于列数
+         */
+        void append(double timestamp, const std::vector<double>& values);
+
+        /**
+         * @brief 写出未满的块、关闭文件并写出索引文件
+         */
+        void close();
+
+        uint64_t getSampleCount() const { return total_samples; }
+    };
+
+    /**
+     * @brief 压缩通道文件读取器（流式）
+     * @details 每次仅载入一个块，适合可视化工具逐行消费
+     */
+    class CompressedChannelReader {
+    private:
+        std::ifstream file;
+        std::vector<std::string> column_names;
+        uint32_t block_size;
+        std::vector<uint8_t> block_payload;
+        uint32_t block_samples;
+        uint32_t block_consumed;
+        std::optional<BlockDecoder> decoder;   ///< 当前块的解码器
+
+        bool loadNextBlock();
+
+    public:
+        explicit CompressedChannelReader(const std::string& path);
+
+        /**
+         * @brief 定位到指定块头（偏移取自索引文件）
+         * @param block_offset 块头字节偏移
+         * @return 是否成功
+         */
+        bool seek(uint64_t block_offset);
+
+        bool isOpen() const { return file.is_open() && !column_names.empty(); }
+        const std::vector<std::string>& getColumnNames() const { return column_names; }
+        uint32_t getBlockSize() const { return block_size; }
+
+        /**
+         * @brief 读取下一个样本
+         * @param timestamp 输出时间戳
+         * @param values 输出数值，自动调整为列数
+         * @return 是否读取成功（文件结束返回false）
+         */
+        bool next(double& timestamp, std::vector<double>& values);
+    };
+
+} // namespace TimeSeriesCodec
+} // namespace VFT_SMF
@@ -14,7 +14,7 @@ set WARNINGS=-Wall -Wextra
 set INCLUDES=-I"%PROJECT_ROOT%\src" -I"%PROJECT_ROOT%\src\E_GlobalSharedDataSpace" -I"%PROJECT_ROOT%\src\G_SimulationManager\LogAndData"
 set LIBS=
 
-set SOURCE_FILE=visualize_aircraft_system.cpp
+set SOURCE_FILE=visualize_aircraft_system.cpp "%PROJECT_ROOT%\src\G_SimulationManager\LogAndData\TimeIndex.cpp"
 set OUTPUT_EXE=visualize_aircraft_system.exe
 
 echo Compiling %SOURCE_FILE%...
@@ -0,0 +1,30 @@
+@echo off
+chcp 65001 >nul
+echo ========================================
+echo 编译控制律增益整定工具
+echo ========================================
+echo.
+
+echo 正在编译 control_tuning.cpp...
+g++ -std=c++17 -O2 -I../src -o control_tuning.exe control_tuning.cpp ../src/F_ScenarioModelling/D_ControlTuning/ControlTuning.cpp ../src/F_ScenarioModelling/C_ParameterSweep/ParameterSweep.cpp ../src/B_AircraftAgentModel/B737/ModelTwin/FlightControl/B737_AutoFlightControlLaw.cpp ../src/E_FlightDynamics/LinearModel.cpp ../src/E_FlightDynamics/TrimSolver.cpp ../src/E_FlightDynamics/FlightDynamicsAgent.cpp ../src/E_FlightDynamics/B737/B737_FlightDynamicsModel_New.cpp ../src/E_FlightDynamics/LandingGear.cpp ../src/E_FlightDynamics/LocalTangentFrame.cpp ../src/G_SimulationManager/LogAndData/DataRecorder.cpp ../src/G_SimulationManager/LogAndData/TelemetryRing.cpp ../src/G_SimulationManager/LogAndData/TimeIndex.cpp ../src/G_SimulationManager/LogAndData/CsvExport.cpp ../src/G_SimulationManager/LogAndData/TimeSeriesCodec.cpp
+
+if %errorlevel% equ 0 (
+    echo.
+    echo 编译成功！
+    echo 生成的可执行文件: control_tuning.exe
+    echo.
+    echo 使用方法:
+    echo control_tuning.exe [autothrottle^|altitude_hold^|heading_hold^|yaw_damper] [nonlinear^|linear] [阶跃幅值] [并行线程数]
+    echo.
+    echo 示例:
+    echo control_tuning.exe autothrottle
+    echo control_tuning.exe altitude_hold linear 30
+    echo.
+) else (
+    echo.
+    echo 编译失败！
+    echo 请检查错误信息并修复代码。
+    echo.
+)
+
+pause
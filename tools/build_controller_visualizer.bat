@@ -7,8 +7,9 @@ echo ========================================
 echo 正在编译 visualize_controller_execution.cpp...
 
 g++ -std=c++17 -O2 -Wall -Wextra ^
-    -I. ^
+    -I. -I../src ^
     visualize_controller_execution.cpp ^
+    ../src/G_SimulationManager/LogAndData/TimeIndex.cpp ^
     -o visualize_controller_execution.exe
 
 if %errorlevel% equ 0 (
@@ -19,7 +20,7 @@ if %errorlevel% equ 0 (
     echo 可执行文件: visualize_controller_execution.exe
     echo.
     echo 使用方法:
-    echo   visualize_controller_execution.exe ^<controller_execution_status.csv文件路径^>
+    echo   visualize_controller_execution.exe ^<controller_execution_status.csv文件路径^> [t0 t1]
     echo.
     echo 示例:
     echo   visualize_controller_execution.exe "../ScenarioExamples/B737_Taxi/output/controller_execution_status.csv"
@@ -6,7 +6,7 @@ echo ========================================
 echo.
 
 echo 正在编译 visualize_triggered_events.cpp...
-g++ -std=c++17 -O2 -o visualize_triggered_events.exe visualize_triggered_events.cpp
+g++ -std=c++17 -O2 -I../src -o visualize_triggered_events.exe visualize_triggered_events.cpp ../src/G_SimulationManager/LogAndData/TimeIndex.cpp
 
 if %errorlevel% equ 0 (
     echo.
@@ -14,7 +14,7 @@ if %errorlevel% equ 0 (
     echo 生成的可执行文件: visualize_triggered_events.exe
     echo.
     echo 使用方法:
-    echo visualize_triggered_events.exe "CSV文件路径" [输出目录]
+    echo visualize_triggered_events.exe "CSV文件路径" [输出目录] [t0 t1]
     echo.
     echo 示例:
     echo visualize_triggered_events.exe "..\ScenarioExamples\B737_Taxi\output\triggered_events.csv"
@@ -0,0 +1,30 @@
+@echo off
+chcp 65001 >nul
+echo ========================================
+echo 编译线性化工具
+echo ========================================
+echo.
+
+echo 正在编译 linearize.cpp...
+g++ -std=c++17 -O2 -I../src -o linearize.exe linearize.cpp ../src/E_FlightDynamics/LinearModel.cpp ../src/E_FlightDynamics/TrimSolver.cpp ../src/E_FlightDynamics/FlightDynamicsAgent.cpp ../src/E_FlightDynamics/B737/B737_FlightDynamicsModel_New.cpp ../src/E_FlightDynamics/LandingGear.cpp ../src/E_FlightDynamics/LocalTangentFrame.cpp ../src/G_SimulationManager/LogAndData/DataRecorder.cpp ../src/G_SimulationManager/LogAndData/TelemetryRing.cpp ../src/G_SimulationManager/LogAndData/TimeIndex.cpp ../src/G_SimulationManager/LogAndData/CsvExport.cpp ../src/G_SimulationManager/LogAndData/TimeSeriesCodec.cpp
+
+if %errorlevel% equ 0 (
+    echo.
+    echo 编译成功！
+    echo 生成的可执行文件: linearize.exe
+    echo.
+    echo 使用方法:
+    echo linearize.exe [空速m/s] [高度m] [航迹角度] [转弯角速度度/秒] [输出.json]
+    echo.
+    echo 示例:
+    echo linearize.exe 120 1000
+    echo linearize.exe 100 1500 3 3 climb_turn_model.json
+    echo.
+) else (
+    echo.
+    echo 编译失败！
+    echo 请检查错误信息并修复代码。
+    echo.
+)
+
+pause
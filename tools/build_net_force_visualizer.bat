@@ -6,7 +6,7 @@ echo ========================================
 echo.
 
 echo 正在编译 visualize_aircraft_net_force.cpp...
-g++ -std=c++17 -O2 -o visualize_aircraft_net_force.exe visualize_aircraft_net_force.cpp
+g++ -std=c++17 -O2 -I../src -o visualize_aircraft_net_force.exe visualize_aircraft_net_force.cpp ../src/G_SimulationManager/LogAndData/TimeSeriesCodec.cpp ../src/G_SimulationManager/LogAndData/TimeIndex.cpp
 
 if %errorlevel% equ 0 (
     echo.
@@ -0,0 +1,30 @@
+@echo off
+chcp 65001 >nul
+echo ========================================
+echo 编译参数扫描工具
+echo ========================================
+echo.
+
+echo 正在编译 parameter_sweep.cpp...
+g++ -std=c++17 -O2 -I../src -o parameter_sweep.exe parameter_sweep.cpp ../src/F_ScenarioModelling/C_ParameterSweep/ParameterSweep.cpp
+
+if %errorlevel% equ 0 (
+    echo.
+    echo 编译成功！
+    echo 生成的可执行文件: parameter_sweep.exe
+    echo.
+    echo 使用方法:
+    echo parameter_sweep.exe [扫描定义.json] [--dry-run]
+    echo.
+    echo 示例（需先编译 ScenarioExamples/B737_Taxi 场景）:
+    echo parameter_sweep.exe parameter_sweep_example.json --dry-run
+    echo parameter_sweep.exe parameter_sweep_example.json
+    echo.
+) else (
+    echo.
+    echo 编译失败！
+    echo 请检查错误信息并修复代码。
+    echo.
+)
+
+pause
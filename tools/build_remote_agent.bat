@@ -0,0 +1,78 @@
+@echo off
+chcp 65001 >nul
+echo ========================================
+echo 编译远程代理工具
+echo ========================================
+echo.
+
+echo 正在编译 remote_agent.cpp...
+g++ -std=c++17 -O2 -I../src -I../src/I_ThirdPartyTools -o remote_agent.exe remote_agent.cpp ^
+../src/G_SimulationManager/D_EventDrivenArchitecture/AgentThreadFunctions.cpp ^
+../src/G_SimulationManager/D_EventDrivenArchitecture/EventDispatcher.cpp ^
+../src/E_GlobalSharedDataSpace/GlobalSharedDataSpace.cpp ^
+../src/E_GlobalSharedDataSpace/GlobalSharedDataStruct.cpp ^
+../src/G_SimulationManager/LogAndData/DataRecorder.cpp ^
+../src/G_SimulationManager/LogAndData/TimeSeriesCodec.cpp ^
+../src/G_SimulationManager/LogAndData/TimeIndex.cpp ^
+../src/G_SimulationManager/LogAndData/TelemetryRing.cpp ^
+../src/G_SimulationManager/LogAndData/TelemetryPublisher.cpp ^
+../src/G_SimulationManager/LogAndData/StreamingStatistics.cpp ^
+../src/G_SimulationManager/LogAndData/MonteCarloAggregator.cpp ^
+../src/G_SimulationManager/A_TimeSYNC/Simulation_Clock.cpp ^
+../src/G_SimulationManager/B_SimManage/EventMonitor.cpp ^
+../src/G_SimulationManager/B_SimManage/TerminationMonitor.cpp ^
+../src/G_SimulationManager/B_SimManage/DataPack.cpp ^
+../src/G_SimulationManager/B_SimManage/AllocationTracker.cpp ^
+../src/G_SimulationManager/B_SimManage/ThreadPlacement.cpp ^
+../src/G_SimulationManager/B_SimManage/PerfCounterProfiler.cpp ^
+../src/G_SimulationManager/B_SimManage/InstrumentedMutex.cpp ^
+../src/G_SimulationManager/B_SimManage/SimulationMetrics.cpp ^
+../src/G_SimulationManager/B_SimManage/MetricsServer.cpp ^
+../src/E_GlobalSharedDataSpace/StateTransport.cpp ^
+../src/G_SimulationManager/A_TimeSYNC/TransportStepRelay.cpp ^
+../src/G_SimulationManager/LogAndData/CsvExport.cpp ^
+../src/G_SimulationManager/C_ConfigManager/ConfigManager.cpp ^
+../src/F_ScenarioModelling/A_FlightPlanParser/FlightPlanParser.cpp ^
+../src/A_PilotAgentModel/PilotAgent.cpp ^
+../src/A_PilotAgentModel/Pilot_001/Pilot_001_Strategy.cpp ^
+../src/A_PilotAgentModel/Pilot_002/Pilot_002_Strategy.cpp ^
+../src/A_PilotAgentModel/Pilot_001/ServiceTwin/PilotATCCommandHandler.cpp ^
+../src/A_PilotAgentModel/Pilot_001/ServiceTwin/PilotManualControlHandler.cpp ^
+../src/B_AircraftAgentModel/AircraftAgent.cpp ^
+../src/B_AircraftAgentModel/AircraftDigitalTwinFactory.cpp ^
+../src/B_AircraftAgentModel/B737/B737DigitalTwin.cpp ^
+../src/B_AircraftAgentModel/B737/ModelTwin/FlightControl/B737_AutoFlightControlLaw.cpp ^
+../src/B_AircraftAgentModel/B737/ServiceTwin/ServiceTwin_StateManager.cpp ^
+../src/B_AircraftAgentModel/B737/ServiceTwin/ControlPriorityManager.cpp ^
+../src/C_EnvirnomentAgentModel/EnvironmentAgent.cpp ^
+../src/C_EnvirnomentAgentModel/EnvironmentConfigManager.cpp ^
+../src/D_ATCAgentModel/A_StandardBase/ATCAgent.cpp ^
+../src/D_ATCAgentModel/ATC_001/ATC_001_Strategy.cpp ^
+../src/D_ATCAgentModel/ATC_002/ATC_002_Strategy.cpp ^
+../src/E_FlightDynamics/FlightDynamicsAgent.cpp ^
+../src/E_FlightDynamics/B737/B737_FlightDynamicsModel_New.cpp ^
+../src/E_FlightDynamics/LandingGear.cpp ^
+../src/E_FlightDynamics/LocalTangentFrame.cpp ^
+../src/E_FlightDynamics/TrimSolver.cpp ^
+../src/E_FlightDynamics/LinearModel.cpp ^
+-lpthread -lws2_32
+
+if %errorlevel% equ 0 (
+    echo.
+    echo 编译成功！
+    echo 生成的可执行文件: remote_agent.exe
+    echo.
+    echo 使用方法（在场景目录下运行）:
+    echo remote_agent.exe [代理名] [共享内存名称] [--log]
+    echo.
+    echo 示例（需先在SimulationConfig.json中设置 "agent_transport": "shared_memory" 与 "remote_agents": "environment"）:
+    echo remote_agent.exe environment vft_smf_agents
+    echo.
+) else (
+    echo.
+    echo 编译失败！
+    echo 请检查错误信息并修复代码。
+    echo.
+)
+
+pause
@@ -0,0 +1,29 @@
+@echo off
+chcp 65001 >nul
+echo ========================================
+echo 编译实时遥测监视工具
+echo ========================================
+echo.
+
+echo 正在编译 telemetry_monitor.cpp...
+g++ -std=c++17 -O2 -I../src -o telemetry_monitor.exe telemetry_monitor.cpp ../src/G_SimulationManager/LogAndData/TelemetryRing.cpp
+
+if %errorlevel% equ 0 (
+    echo.
+    echo 编译成功！
+    echo 生成的可执行文件: telemetry_monitor.exe
+    echo.
+    echo 使用方法:
+    echo telemetry_monitor.exe [共享内存名称] [每N个样本打印一行] [--from-oldest]
+    echo.
+    echo 示例（需先在SimulationConfig.json中设置 "enable_telemetry": true）:
+    echo telemetry_monitor.exe vft_smf_telemetry 10
+    echo.
+) else (
+    echo.
+    echo 编译失败！
+    echo 请检查错误信息并修复代码。
+    echo.
+)
+
+pause
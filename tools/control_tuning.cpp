@@ -0,0 +1,93 @@
+/**
+ * @file control_tuning.cpp
+ * @brief 控制律增益整定工具 - 阶跃响应代价最小化
+ * @details 用法: control_tuning <回路> [nonlinear|linear] [阶跃幅值] [并行线程数]
+ *          回路: autothrottle / altitude_hold / heading_hold / yaw_damper
+ *          以控制律构造函数中的默认增益为起点，在 B737 120 m/s、1000 m 平飞配平点整定，
+ *          输出整定前后的增益与阶跃响应指标，并把两条响应曲线写入 control_tuning_<回路>.csv。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "F_ScenarioModelling/D_ControlTuning/ControlTuning.hpp"
+
+using namespace VFT_SMF::ControlTuning;
+
+namespace {
+
+    void printGains(const std::string& label, const PidGains& gains, const StepResponseMetrics& metrics, double cost) {
+        std::cout << label << ": kp=" << gains.kp << " ki=" << gains.ki << " kd=" << gains.kd
+                  << " | 代价=" << cost;
+        if (!metrics.stable) {
+            std::cout << " 发散于 " << metrics.diverged_at << "s" << std::endl;
+            return;
+        }
+        std::cout << " 超调=" << metrics.overshoot << "% 上升=" << metrics.rise_time
+                  << "s 调节=" << metrics.settling_time << "s" << (metrics.settled ? "" : "(未调节)")
+                  << " 稳态误差=" << metrics.steady_state_error
+                  << " 控制量RMS=" << metrics.control_effort << std::endl;
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    TuningCase tuning_case;
+    if (argc < 2 || !parseTuningLoop(argv[1], tuning_case.loop)) {
+        std::cout << "用法: control_tuning <autothrottle|altitude_hold|heading_hold|yaw_damper> "
+                     "[nonlinear|linear] [阶跃幅值] [并行线程数]" << std::endl;
+        return 1;
+    }
+    if (argc > 2) tuning_case.plant = std::string(argv[2]) == "linear" ? PlantModel::Linear : PlantModel::Nonlinear;
+    switch (tuning_case.loop) {
+        case TuningLoop::Autothrottle: tuning_case.step = 5.0; break;
+        case TuningLoop::AltitudeHold: tuning_case.step = 30.0; break;
+        case TuningLoop::HeadingHold:  tuning_case.step = 10.0; break;
+        case TuningLoop::YawDamper:    tuning_case.step = 2.0; break;
+    }
+    if (argc > 3) tuning_case.step = std::atof(argv[3]);
+
+    TuningOptions options;
+    if (argc > 4) options.parallel_workers = std::atoi(argv[4]);
+
+    StepResponseEvaluator evaluator(tuning_case);
+    if (!evaluator.isReady()) {
+        std::cerr << "工作点配平未收敛" << std::endl;
+        return 2;
+    }
+
+    GainTuner tuner(evaluator, options);
+    std::cout << std::fixed << std::setprecision(4);
+    const TuningResult result = tuner.tune(StepResponseEvaluator::defaultGains(tuning_case.loop),
+        [](int iteration, const PidGains& best, double best_cost, double step) {
+            std::cout << "轮次 " << iteration << ": 代价=" << best_cost << " kp=" << best.kp
+                      << " ki=" << best.ki << " kd=" << best.kd << " 步长=" << step << std::endl;
+        });
+
+    printGains("初始", result.initial_gains, result.initial_metrics, result.initial_cost);
+    printGains("整定", result.best_gains, result.best_metrics, result.best_cost);
+    std::cout << "评估次数 " << result.evaluations << "，耗时 " << result.elapsed_seconds << "s，平均 "
+              << result.elapsed_seconds * 1000.0 / result.evaluations << " ms/次" << std::endl;
+
+    // 响应曲线
+    std::vector<ResponseSample> initial_trace, best_trace;
+    evaluator.evaluate(result.initial_gains, &initial_trace);
+    evaluator.evaluate(result.best_gains, &best_trace);
+    const std::string csv_path = "control_tuning_" + tuningLoopName(tuning_case.loop) + ".csv";
+    std::ofstream csv(csv_path);
+    csv << "time,initial_response,initial_command,tuned_response,tuned_command\n";
+    for (size_t i = 0; i < std::max(initial_trace.size(), best_trace.size()); ++i) {
+        const ResponseSample* a = i < initial_trace.size() ? &initial_trace[i] : nullptr;
+        const ResponseSample* b = i < best_trace.size() ? &best_trace[i] : nullptr;
+        csv << (a ? a->time : b->time) << ","
+            << (a ? std::to_string(a->response) : "") << "," << (a ? std::to_string(a->command) : "") << ","
+            << (b ? std::to_string(b->response) : "") << "," << (b ? std::to_string(b->command) : "") << "\n";
+    }
+    std::cout << "响应曲线已写出: " << csv_path << std::endl;
+    return 0;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file linearize.cpp
+ * @brief 线性化工具 - 在配平点生成线性状态空间模型并评估代理模型速度
+ * @details 用法: linearize <空速m/s> <高度m> [航迹角度] [转弯角速度度/秒] [输出.json]
+ *          先求配平，再在配平点做中心差分线性化，写出 A/B/C/D 矩阵与离散化后的 Ad/Bd；
+ *          随后以同一油门阶跃分别推进非线性代理与线性代理模型，对比终值与单步耗时。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "E_FlightDynamics/LinearModel.hpp"
+
+using namespace VFT_SMF::FlightDynamics;
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cout << "用法: linearize <空速m/s> <高度m> [航迹角度] [转弯角速度度/秒] [输出.json]" << std::endl;
+        return 1;
+    }
+
+    TrimTarget target;
+    target.airspeed = std::atof(argv[1]);
+    target.altitude = std::atof(argv[2]);
+    if (argc > 3) target.flight_path_angle = std::atof(argv[3]);
+    if (argc > 4) target.turn_rate = std::atof(argv[4]);
+    const std::string output_path = argc > 5 ? argv[5] : "linear_model.json";
+
+    TrimSolver solver;
+    const TrimResult trim = solver.solve(target);
+    std::cout << std::fixed << std::setprecision(4)
+              << "配平" << (trim.converged ? "收敛" : "未收敛") << ": 残差=" << trim.residual_norm
+              << " 油门=" << trim.throttle << " 升降舵=" << trim.elevator << "° 俯仰角=" << trim.pitch
+              << "° 滚转角=" << trim.roll << "°" << std::endl;
+    if (!trim.converged) return 2;
+
+    Linearizer linearizer;
+    const LinearModel model = linearizer.linearize(trim);
+    if (!model.writeJson(output_path)) return 3;
+    std::cout << "线性模型已写出: " << output_path << std::endl;
+
+    const double dt = 0.01;
+    const int steps = 100000;
+    LinearSurrogate surrogate(model, dt);
+
+    // 油门阶跃 +0.02，两种模型推进相同步数
+    std::vector<double> input = model.input0;
+    input[LinearModel::THROTTLE] += 0.02;
+    auto system_state = trim.system_state;
+    system_state.current_throttle_position = input[LinearModel::THROTTLE];
+
+    FlightDynamicsAgent agent("B737");
+    agent.initialize(trim.flight_state);
+    VFT_SMF::GlobalSharedDataStruct::AircraftFlightState nonlinear = trim.flight_state;
+    const auto nonlinear_start = std::chrono::steady_clock::now();
+    for (int step = 0; step < steps / 100; ++step) {
+        nonlinear = agent.updateFromGlobalState(dt, system_state, trim.env_state);
+    }
+    const auto nonlinear_end = std::chrono::steady_clock::now();
+
+    const auto linear_start = std::chrono::steady_clock::now();
+    for (int step = 0; step < steps / 100; ++step) surrogate.step(input);
+    const auto linear_state = surrogate.getFlightState();
+    for (int step = steps / 100; step < steps; ++step) surrogate.step(input);
+    const auto linear_end = std::chrono::steady_clock::now();
+
+    const double nonlinear_us = std::chrono::duration<double, std::micro>(nonlinear_end - nonlinear_start).count() / (steps / 100);
+    const double linear_us = std::chrono::duration<double, std::micro>(linear_end - linear_start).count() / steps;
+
+    std::cout << "油门阶跃 +0.02 推进 " << (steps / 100) * dt << "s 后:" << std::endl
+              << "  空速   非线性 " << nonlinear.airspeed << " m/s, 线性 " << linear_state.airspeed << " m/s" << std::endl
+              << "  垂直速度 非线性 " << nonlinear.vertical_speed << " m/s, 线性 " << linear_state.vertical_speed << " m/s" << std::endl
+              << "  俯仰角 非线性 " << nonlinear.pitch << "°, 线性 " << linear_state.pitch << "°" << std::endl
+              << "单步耗时: 非线性 " << nonlinear_us << " us, 线性 " << linear_us << " us, 加速比 "
+              << std::setprecision(0) << nonlinear_us / linear_us << "x" << std::endl;
+    return 0;
+}
@@ -0,0 +1,63 @@
+/**
+ * @file parameter_sweep.cpp
+ * @brief 参数扫描工具 - 按扫描定义生成试验设计并批量运行场景
+ * @details 用法: parameter_sweep <扫描定义.json> [--dry-run]
+ *          每个样本在 <output_directory>/run_NNNNN/ 下得到一份独立的配置副本与输出目录，
+ *          场景可执行文件以该目录为工作目录运行；全部完成后写出 sweep_results.csv。
+ *          --dry-run 只生成运行目录，便于检查参数写入是否正确。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "F_ScenarioModelling/C_ParameterSweep/ParameterSweep.hpp"
+
+using namespace VFT_SMF::ParameterSweep;
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cout << "用法: parameter_sweep <扫描定义.json> [--dry-run]" << std::endl;
+        return 1;
+    }
+    const bool dry_run = argc > 2 && std::string(argv[2]) == "--dry-run";
+
+    SweepDefinition definition;
+    std::string error;
+    if (!SweepDefinition::load(argv[1], definition, error)) {
+        std::cerr << "加载扫描定义失败: " << error << std::endl;
+        return 1;
+    }
+
+    std::cout << "参数数: " << definition.parameters.size()
+              << "，并行运行数: " << definition.parallel_runs
+              << "，输出目录: " << definition.output_directory << std::endl;
+
+    SweepRunner runner(definition);
+    const auto results = runner.run(dry_run, [](const SampleResult& result, size_t completed, size_t total) {
+        std::cout << "[" << completed << "/" << total << "] run_" << std::setw(5) << std::setfill('0')
+                  << result.point.id << std::setfill(' ') << " 轮次 " << result.point.round
+                  << " 退出码 " << result.exit_code;
+        if (result.has_outcome) {
+            std::cout << " 结果 " << result.outcome << (result.passed ? " 通过" : " 不通过");
+        }
+        std::cout << std::endl;
+    });
+
+    size_t failed_runs = 0, passed = 0, evaluated = 0;
+    for (const auto& result : results) {
+        if (result.exit_code != 0) ++failed_runs;
+        if (result.has_outcome) {
+            ++evaluated;
+            if (result.passed) ++passed;
+        }
+    }
+    std::cout << "完成 " << results.size() << " 次运行，异常退出 " << failed_runs;
+    if (definition.outcome.enabled && !dry_run) {
+        std::cout << "，通过 " << passed << "/" << evaluated;
+    }
+    std::cout << std::endl;
+    return failed_runs == 0 ? 0 : 2;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file remote_agent.cpp
+ * @brief 远程代理进程 - 以独立进程运行代理，经共享内存状态传输附加到仿真主进程
+ * @details 用法: remote_agent <代理名> [共享内存名称] [--log]
+ *          仿真配置中需将 agent_transport_config.agent_transport 设为 "shared_memory"，
+ *          并在 remote_agents 中列出该代理；主进程启动后在 remote_attach_timeout_ms 内等待本进程附加，
+ *          超时则改在主进程内运行该代理。
+ *          本进程须在场景目录下运行（与主进程相同的工作目录，代理从 input/ 读取配置）。
+ *          本进程崩溃或卡死时主进程剔除本代理并继续仿真；重新启动本进程即以同一名称重新附加。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "E_GlobalSharedDataSpace/GlobalSharedDataSpace.hpp"
+#include "E_GlobalSharedDataSpace/StateTransport.hpp"
+#include "G_SimulationManager/A_TimeSYNC/TransportStepRelay.hpp"
+#include "G_SimulationManager/D_EventDrivenArchitecture/AgentThreadFunctions.hpp"
+
+using namespace VFT_SMF;
+
+namespace {
+
+    constexpr std::chrono::seconds OPEN_TIMEOUT{30};    ///< 等待主进程创建传输段的上限
+
+    /**
+     * @brief 可远程运行的代理：线程函数与就绪等待函数均与主进程相同
+     */
+    struct RemoteAgentEntry {
+        const char* name;
+        std::function<void(std::shared_ptr<GlobalShared_DataSpace::GlobalSharedDataSpace>)> thread_function;
+        std::function<void()> wait_ready;
+    };
+
+    const RemoteAgentEntry REMOTE_AGENTS[] = {
+        {"environment", environment_thread_function, wait_for_environment_thread_ready},
+    };
+
+    void printUsage() {
+        std::cout << "用法: remote_agent <代理名> [共享内存名称] [--log]" << std::endl;
+        std::cout << "可用代理:";
+        for (const auto& entry : REMOTE_AGENTS) std::cout << " " << entry.name;
+        std::cout << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        printUsage();
+        return 1;
+    }
+    const std::string agent_name = argv[1];
+    std::string segment_name = "vft_smf_agents";
+    bool enable_log = false;
+    for (int i = 2; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--log") == 0) {
+            enable_log = true;
+        } else {
+            segment_name = argv[i];
+        }
+    }
+
+    const RemoteAgentEntry* agent = nullptr;
+    for (const auto& entry : REMOTE_AGENTS) {
+        if (agent_name == entry.name) agent = &entry;
+    }
+    if (!agent) {
+        std::cout << "未知的代理: " << agent_name << std::endl;
+        printUsage();
+        return 1;
+    }
+
+    if (enable_log) {
+        initializeGlobalLogger("output/log_brief_remote_" + agent_name + ".txt",
+                               "output/log_detail_remote_" + agent_name + ".txt", false);
+    }
+
+    // 主进程可能尚未启动：重试打开传输段
+    auto transport = std::make_shared<GlobalShared_DataSpace::SharedMemoryTransport>();
+    const auto open_deadline = std::chrono::steady_clock::now() + OPEN_TIMEOUT;
+    while (!transport->open(segment_name)) {
+        if (std::chrono::steady_clock::now() >= open_deadline) {
+            std::cout << "无法打开共享内存传输段: " << segment_name << std::endl;
+            return 1;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    if (!transport->attach(agent_name)) {
+        std::cout << "附加失败: 参与端已满或同名代理仍在运行" << std::endl;
+        return 1;
+    }
+    std::cout << "已附加到传输段 " << segment_name << "，参与端编号: " << transport->localParticipant() << std::endl;
+
+    // 本进程的共享数据空间：先导入主进程已发布的状态，代理初始化时即可读到
+    auto shared_data_space = std::make_shared<GlobalShared_DataSpace::GlobalSharedDataSpace>();
+    shared_data_space->attachStateTransport(transport);
+    shared_data_space->importTransportStates();
+
+    std::thread agent_thread(agent->thread_function, shared_data_space);
+    agent->wait_ready();
+    std::cout << "代理 " << agent_name << " 已就绪，等待步信号" << std::endl;
+
+    TransportStepRelay relay(shared_data_space, transport, agent_name);
+    const uint64_t relayed_steps = relay.run();
+    agent_thread.join();
+
+    std::cout << "仿真结束，已完成步数: " << relayed_steps
+              << "，重新附加次数: " << relay.getReattachCount() << std::endl;
+    return 0;
+}
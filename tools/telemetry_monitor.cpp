@@ -0,0 +1,96 @@
+/**
+ * @file telemetry_monitor.cpp
+ * @brief 实时遥测监视工具 - 附加到仿真进程的共享内存遥测环并滚动输出样本
+ * @details 用法: telemetry_monitor [共享内存名称] [输出间隔(每N个样本打印一行)] [--from-oldest]
+ *          仿真配置中需将 telemetry_config.enable_telemetry 设为 true。
+ *          监视器只读附加，不会阻塞或减慢仿真；跟不上时跳过被覆盖的样本并统计丢失数。
+ * @author VFT_SMF Development Team
+ * @date 2024
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "G_SimulationManager/LogAndData/TelemetryRing.hpp"
+
+using namespace VFT_SMF::Telemetry;
+
+namespace {
+
+    void printHeader(const TelemetryRingReader& reader) {
+        std::cout << std::setw(10) << "index" << std::setw(12) << "time";
+        for (const auto& name : reader.getChannelNames()) {
+            std::cout << "  " << std::setw(14) << name.substr(0, 14);
+        }
+        std::cout << std::endl;
+    }
+
+    void printSample(const TelemetrySample& sample) {
+        std::cout << std::setw(10) << sample.index
+                  << std::setw(12) << std::fixed << std::setprecision(2) << sample.simulation_time;
+        for (double value : sample.values) {
+            std::cout << "  " << std::setw(14) << std::setprecision(6) << value;
+        }
+        std::cout << std::endl;
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::string shm_name = argc > 1 ? argv[1] : "vft_smf_telemetry";
+    const long print_every = argc > 2 ? std::max(1L, std::strtol(argv[2], nullptr, 10)) : 10;
+    const bool from_oldest = argc > 3 && std::string(argv[3]) == "--from-oldest";
+
+    TelemetryRingReader reader;
+    std::cout << "等待遥测共享内存: " << shm_name << " ..." << std::endl;
+    while (!reader.attach(shm_name, !from_oldest)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    }
+
+    std::cout << "已附加，通道数: " << reader.getChannelNames().size() << std::endl;
+    printHeader(reader);
+
+    TelemetrySample sample;
+    uint64_t received = 0;
+    uint64_t reported_dropped = 0;
+    auto last_activity = std::chrono::steady_clock::now();
+
+    while (true) {
+        bool got_any = false;
+        while (reader.next(sample)) {
+            got_any = true;
+            if (received++ % static_cast<uint64_t>(print_every) == 0) {
+                printSample(sample);
+            }
+        }
+
+        if (reader.getDroppedCount() != reported_dropped) {
+            reported_dropped = reader.getDroppedCount();
+            std::cout << "[监视器] 读取落后，累计丢失样本: " << reported_dropped << std::endl;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        if (got_any) {
+            last_activity = now;
+        } else if (now - last_activity > std::chrono::seconds(5)) {
+            // 长时间无新数据：仿真可能已结束或重启，尝试重新附加
+            TelemetryRingReader fresh;
+            if (!fresh.attach(shm_name, false)) {
+                std::cout << "遥测共享内存已关闭，接收样本: " << received
+                          << "，丢失样本: " << reported_dropped << std::endl;
+                return 0;
+            }
+            if (fresh.getWriteCount() < reader.getWriteCount()) {
+                std::cout << "[监视器] 检测到仿真重启，重新附加" << std::endl;
+                reader.attach(shm_name, false);
+                printHeader(reader);
+            }
+            last_activity = now;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+}
@@ -15,6 +15,8 @@
 #include <iomanip>
 #include <filesystem>
 
+#include "G_SimulationManager/LogAndData/TimeIndex.hpp"
+
 /**
  * @brief 飞机系统状态数据结构
  */
@@ -119,6 +121,45 @@ public:
         std::cout << "成功加载 " << data.size() << " 条飞机系统状态记录" << std::endl;
         return true;
     }
+
+    /**
+     * @brief 借助稀疏时间索引只读取 [t0, t1] 时间窗口（窗口读取不含 datasource 文本列）
+     */
+    bool loadWindow(const std::string& filename, double t0, double t1) {
+        const std::vector<std::string> columns = {
+            "current_mass", "current_fuel", "current_center_of_gravity", "current_brake_pressure",
+            "current_landing_gear_deployed", "current_flaps_deployed", "current_spoilers_deployed",
+            "current_throttle_position", "current_engine_rpm", "left_engine_failed", "left_engine_rpm",
+            "right_engine_failed", "right_engine_rpm", "brake_efficiency"};
+        VFT_SMF::TimeIndex::ChannelWindow window;
+        if (!VFT_SMF::TimeIndex::readWindow(filename, t0, t1, columns, window)) {
+            std::cerr << "错误: 无法读取时间窗口 " << filename << std::endl;
+            return false;
+        }
+
+        data.resize(window.time.size());
+        for (size_t i = 0; i < window.time.size(); ++i) {
+            AircraftSystemData& record = data[i];
+            record.time = window.time[i];
+            record.current_mass = window.columns[0][i];
+            record.current_fuel = window.columns[1][i];
+            record.current_center_of_gravity = window.columns[2][i];
+            record.current_brake_pressure = window.columns[3][i];
+            record.current_landing_gear_deployed = window.columns[4][i];
+            record.current_flaps_deployed = window.columns[5][i];
+            record.current_spoilers_deployed = window.columns[6][i];
+            record.current_throttle_position = window.columns[7][i];
+            record.current_engine_rpm = window.columns[8][i];
+            record.left_engine_failed = window.columns[9][i] != 0.0;
+            record.left_engine_rpm = window.columns[10][i];
+            record.right_engine_failed = window.columns[11][i] != 0.0;
+            record.right_engine_rpm = window.columns[12][i];
+            record.brake_efficiency = window.columns[13][i];
+        }
+
+        std::cout << "成功读取时间窗口 [" << t0 << ", " << t1 << "] 内 " << data.size() << " 条飞机系统状态记录" << std::endl;
+        return true;
+    }
 };
 
 /**
@@ -345,16 +386,20 @@ int main(int argc, char* argv[]) {
     std::cout << "========================================" << std::endl;
     
     // 检查命令行参数
-    if (argc != 2) {
-        std::cerr << "用法: " << argv[0] << " <aircraft_system_state.csv文件路径>" << std::endl;
+    if (argc != 2 && argc != 4) {
+        std::cerr << "用法: " << argv[0] << " <aircraft_system_state.csv文件路径> [t0 t1]" << std::endl;
         return 1;
     }
     
     std::string csv_file = argv[1];
+    // 可选时间窗口：只读取 [t0, t1] 内的数据
+    const bool use_window = argc == 4;
     
     // 解析CSV文件
     CSVParser parser;
-    if (!parser.loadCSV(csv_file)) {
+    const bool loaded = use_window ? parser.loadWindow(csv_file, std::stod(argv[2]), std::stod(argv[3]))
+                                   : parser.loadCSV(csv_file);
+    if (!loaded) {
         return 1;
     }
     
@@ -15,6 +15,8 @@
 #include <iomanip>
 #include <filesystem>
 
+#include "G_SimulationManager/LogAndData/TimeIndex.hpp"
+
 /**
  * @brief ATC指令数据结构
  */
@@ -90,6 +92,27 @@ public:
         std::cout << "成功加载 " << data.size() << " 条ATC指令记录" << std::endl;
         return true;
     }
+
+    /**
+     * @brief 借助稀疏时间索引只读取 [t0, t1] 时间窗口（窗口读取不含 datasource 文本列）
+     */
+    bool loadWindow(const std::string& filename, double t0, double t1) {
+        VFT_SMF::TimeIndex::ChannelWindow window;
+        if (!VFT_SMF::TimeIndex::readWindow(filename, t0, t1, {"clearance_granted", "emergency_brake"}, window)) {
+            std::cerr << "错误: 无法读取时间窗口 " << filename << std::endl;
+            return false;
+        }
+
+        data.resize(window.time.size());
+        for (size_t i = 0; i < window.time.size(); ++i) {
+            data[i].time = window.time[i];
+            data[i].clearance_granted = window.columns[0][i] != 0.0;
+            data[i].emergency_brake = window.columns[1][i] != 0.0;
+        }
+
+        std::cout << "成功读取时间窗口 [" << t0 << ", " << t1 << "] 内 " << data.size() << " 条ATC指令记录" << std::endl;
+        return true;
+    }
 };
 
 /**
@@ -213,16 +236,20 @@ int main(int argc, char* argv[]) {
     std::cout << "========================================" << std::endl;
     
     // 检查命令行参数
-    if (argc != 2) {
-        std::cerr << "用法: " << argv[0] << " <atc_command.csv文件路径>" << std::endl;
+    if (argc != 2 && argc != 4) {
+        std::cerr << "用法: " << argv[0] << " <atc_command.csv文件路径> [t0 t1]" << std::endl;
         return 1;
     }
     
     std::string csv_file = argv[1];
+    // 可选时间窗口：只读取 [t0, t1] 内的数据
+    const bool use_window = argc == 4;
     
     // 解析CSV文件
     CSVParser parser;
-    if (!parser.loadCSV(csv_file)) {
+    const bool loaded = use_window ? parser.loadWindow(csv_file, std::stod(argv[2]), std::stod(argv[3]))
+                                   : parser.loadCSV(csv_file);
+    if (!loaded) {
         return 1;
     }
     
@@ -15,6 +15,8 @@
 #include <iomanip>
 #include <filesystem>
 
+#include "G_SimulationManager/LogAndData/TimeIndex.hpp"
+
 /**
  * @brief 环境状态数据结构
  */
@@ -100,6 +102,34 @@ public:
         std::cout << "成功加载 " << data.size() << " 条环境状态记录" << std::endl;
         return true;
     }
+
+    /**
+     * @brief 借助稀疏时间索引只读取 [t0, t1] 时间窗口（窗口读取不含 datasource 文本列）
+     */
+    bool loadWindow(const std::string& filename, double t0, double t1) {
+        VFT_SMF::TimeIndex::ChannelWindow window;
+        if (!VFT_SMF::TimeIndex::readWindow(filename, t0, t1,
+                                            {"runway_length", "runway_width", "friction_coefficient",
+                                             "air_density", "wind_speed", "wind_direction"}, window)) {
+            std::cerr << "错误: 无法读取时间窗口 " << filename << std::endl;
+            return false;
+        }
+
+        data.resize(window.time.size());
+        for (size_t i = 0; i < window.time.size(); ++i) {
+            EnvironmentStateData& record = data[i];
+            record.time = window.time[i];
+            record.runway_length = window.columns[0][i];
+            record.runway_width = window.columns[1][i];
+            record.friction_coefficient = window.columns[2][i];
+            record.air_density = window.columns[3][i];
+            record.wind_speed = window.columns[4][i];
+            record.wind_direction = window.columns[5][i];
+        }
+
+        std::cout << "成功读取时间窗口 [" << t0 << ", " << t1 << "] 内 " << data.size() << " 条环境状态记录" << std::endl;
+        return true;
+    }
 };
 
 /**
@@ -293,16 +323,20 @@ int main(int argc, char* argv[]) {
     std::cout << "========================================" << std::endl;
     
     // 检查命令行参数
-    if (argc != 2) {
-        std::cerr << "用法: " << argv[0] << " <environment_state.csv文件路径>" << std::endl;
+    if (argc != 2 && argc != 4) {
+        std::cerr << "用法: " << argv[0] << " <environment_state.csv文件路径> [t0 t1]" << std::endl;
         return 1;
     }
     
     std::string csv_file = argv[1];
+    // 可选时间窗口：只读取 [t0, t1] 内的数据
+    const bool use_window = argc == 4;
     
     // 解析CSV文件
     CSVParser parser;
-    if (!parser.loadCSV(csv_file)) {
+    const bool loaded = use_window ? parser.loadWindow(csv_file, std::stod(argv[2]), std::stod(argv[3]))
+                                   : parser.loadCSV(csv_file);
+    if (!loaded) {
         return 1;
     }
     
@@ -15,6 +15,9 @@
 #include <chrono>
 #include <windows.h>
 
+#include "G_SimulationManager/LogAndData/TimeSeriesCodec.hpp"
+#include "G_SimulationManager/LogAndData/TimeIndex.hpp"
+
 namespace fs = std::filesystem;
 
 /**
@@ -107,6 +110,77 @@ public:
         return true;
     }
 
+    /**
+     * @brief 流式读取压缩通道文件(.vts)，逐样本解码，不整体载入文件
+     * @param filename 文件路径
+     * @param wanted_columns 需要的列名（为空则读取全部列）
+     */
+    bool loadVTS(const std::string& filename, const std::vector<std::string>& wanted_columns = {}) {
+        VFT_SMF::TimeSeriesCodec::CompressedChannelReader reader(filename);
+        if (!reader.isOpen()) {
+            std::cerr << "错误: 无法打开压缩通道文件 " << filename << std::endl;
+            return false;
+        }
+
+        // 与CSV保持一致的列布局: 0=SimulationTime, 1=datasource(压缩文件中不含), 2..=数值列
+        std::vector<size_t> selected;
+        const auto& columns = reader.getColumnNames();
+        headers = {"SimulationTime", "datasource"};
+        for (size_t i = 0; i < columns.size(); ++i) {
+            if (wanted_columns.empty() ||
+                std::find(wanted_columns.begin(), wanted_columns.end(), columns[i]) != wanted_columns.end()) {
+                selected.push_back(i);
+                headers.push_back(columns[i]);
+            }
+        }
+        data.assign(headers.size(), {});
+        datasource.clear();
+
+        double timestamp = 0.0;
+        std::vector<double> values;
+        int rowCount = 0;
+        while (reader.next(timestamp, values)) {
+            data[0].push_back(timestamp);
+            for (size_t k = 0; k < selected.size(); ++k) {
+                data[k + 2].push_back(values[selected[k]]);
+            }
+            rowCount++;
+        }
+
+        std::cout << "成功读取 " << rowCount << " 行数据，共 " << headers.size() - 2 << " 个数值列" << std::endl;
+        return true;
+    }
+
+    /**
+     * @brief 借助稀疏时间索引只读取 [t0, t1] 时间窗口（支持CSV与VTS）
+     * @param filename 文件路径
+     * @param t0 窗口起点 (s)
+     * @param t1 窗口终点 (s)
+     * @param wanted_columns 需要的列名（为空则读取全部列）
+     */
+    bool loadWindow(const std::string& filename, double t0, double t1,
+                    const std::vector<std::string>& wanted_columns = {}) {
+        VFT_SMF::TimeIndex::ChannelWindow window;
+        if (!VFT_SMF::TimeIndex::readWindow(filename, t0, t1, wanted_columns, window)) {
+            std::cerr << "错误: 无法读取时间窗口 " << filename << std::endl;
+            return false;
+        }
+
+        // 与CSV保持一致的列布局: 0=SimulationTime, 1=datasource(窗口读取不含), 2..=数值列
+        headers = {"SimulationTime", "datasource"};
+        data.assign(2, {});
+        data[0] = std::move(window.time);
+        for (size_t k = 0; k < window.column_names.size(); ++k) {
+            if (window.column_names[k] == "datasource") continue;
+            headers.push_back(window.column_names[k]);
+            data.push_back(std::move(window.columns[k]));
+        }
+        datasource.clear();
+
+        std::cout << "成功读取时间窗口 [" << t0 << ", " << t1 << "] 内 " << data[0].size() << " 行数据" << std::endl;
+        return true;
+    }
+
     const std::vector<std::string>& getHeaders() const { return headers; }
     const std::vector<std::vector<double>>& getData() const { return data; }
     const std::vector<std::string>& getDatasource() const { return datasource; }
@@ -305,13 +379,17 @@ int main(int argc, char* argv[]) {
     
     // 检查命令行参数
     if (argc < 2) {
-        std::cout << "用法: " << argv[0] << " <CSV文件路径> [输出目录]\n";
+        std::cout << "用法: " << argv[0] << " <CSV或VTS文件路径> [输出目录] [t0 t1]\n";
         std::cout << "示例: " << argv[0] << " ../ScenarioExamples/B737_Taxi/output/aircraft_flight_state.csv\n";
         return 1;
     }
     
     std::string csv_file = argv[1];
     std::string output_dir = (argc > 2) ? argv[2] : fs::path(csv_file).parent_path().string();
+    // 可选时间窗口：只读取 [t0, t1] 内的数据
+    const bool use_window = argc > 4;
+    const double window_t0 = use_window ? std::stod(argv[3]) : 0.0;
+    const double window_t1 = use_window ? std::stod(argv[4]) : 0.0;
     
     // 检查CSV文件是否存在
     if (!fs::exists(csv_file)) {
@@ -325,7 +403,12 @@ int main(int argc, char* argv[]) {
     
     // 解析CSV数据
     CSVParser parser;
-    if (!parser.loadCSV(csv_file)) {
+    const std::vector<std::string> plot_columns = {"latitude", "longitude", "altitude", "heading", "pitch", "roll",
+                                                   "airspeed", "groundspeed", "vertical_speed", "distance_m"};
+    bool loaded = use_window ? parser.loadWindow(csv_file, window_t0, window_t1, plot_columns)
+                : fs::path(csv_file).extension() == ".vts" ? parser.loadVTS(csv_file, plot_columns)
+                : parser.loadCSV(csv_file);
+    if (!loaded) {
         std::cerr << "错误: 无法解析CSV文件" << std::endl;
         return 1;
     }
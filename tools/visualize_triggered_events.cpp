@@ -16,6 +16,10 @@
 #include <windows.h>
 #include <map>
 #include <climits>
+#include <cmath>
+#include <limits>
+
+#include "G_SimulationManager/LogAndData/TimeIndex.hpp"
 
 namespace fs = std::filesystem;
 
@@ -39,7 +43,13 @@ private:
     std::map<std::string, int> eventNameToId;
 
 public:
-    bool loadCSV(const std::string& filename) {
+    /**
+     * @brief 读取事件文件；给定 [t0, t1] 时借助稀疏时间索引从窗口起点附近开始读取，越过t1即停止
+     * @details 事件列表为文本列，不经 TimeIndex::readWindow（只取数值列），直接按索引定位后逐行解析
+     */
+    bool loadCSV(const std::string& filename,
+                 double t0 = -std::numeric_limits<double>::infinity(),
+                 double t1 = std::numeric_limits<double>::infinity()) {
         std::ifstream file(filename);
         if (!file.is_open()) {
             std::cerr << "错误: 无法打开文件 " << filename << std::endl;
@@ -63,6 +73,15 @@ public:
             return false;
         }
 
+        // 时间窗口：跳到早于t0的索引点（多回退一个，与两位小数的时间舍入对齐）
+        std::vector<VFT_SMF::TimeIndex::IndexEntry> entries;
+        if (std::isfinite(t0) && VFT_SMF::TimeIndex::loadIndex(VFT_SMF::TimeIndex::indexPathFor(filename), entries)) {
+            const uint64_t offset = VFT_SMF::TimeIndex::findStartOffset(entries, t0, 1);
+            if (offset > 0) {
+                file.seekg(static_cast<std::streamoff>(offset));
+            }
+        }
+
         // 读取数据行
         int rowCount = 0;
         int eventIdCounter = 1;
@@ -77,6 +96,8 @@ public:
             // 解析数据
             try {
                 double time = std::stod(values[0]);
+                if (time < t0) continue;
+                if (time > t1) break;
                 int stepNumber = std::stoi(values[1]);
                 int eventCount = std::stoi(values[2]);
                 std::string eventList = values[3];
@@ -397,13 +418,17 @@ int main(int argc, char* argv[]) {
     
     // 检查命令行参数
     if (argc < 2) {
-        std::cout << "用法: " << argv[0] << " <CSV文件路径> [输出目录]\n";
+        std::cout << "用法: " << argv[0] << " <CSV文件路径> [输出目录] [t0 t1]\n";
         std::cout << "示例: " << argv[0] << " ../ScenarioExamples/B737_Taxi/output/triggered_events.csv\n";
         return 1;
     }
     
     std::string csv_file = argv[1];
     std::string output_dir = (argc > 2) ? argv[2] : fs::path(csv_file).parent_path().string();
+    // 可选时间窗口：只读取 [t0, t1] 内的数据
+    const bool use_window = argc > 4;
+    const double window_t0 = use_window ? std::stod(argv[3]) : -std::numeric_limits<double>::infinity();
+    const double window_t1 = use_window ? std::stod(argv[4]) : std::numeric_limits<double>::infinity();
     
     // 检查CSV文件是否存在
     if (!fs::exists(csv_file)) {
@@ -417,7 +442,7 @@ int main(int argc, char* argv[]) {
     
     // 解析CSV数据
     CSVParser parser;
-    if (!parser.loadCSV(csv_file)) {
+    if (!parser.loadCSV(csv_file, window_t0, window_t1)) {
         std::cerr << "错误: 无法解析CSV文件" << std::endl;
         return 1;
     }